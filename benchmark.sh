@@ -4,3 +4,4 @@ make clean
 BUILD=release make
 TL_MODULE_PATH=./modules:./cmodules ./tl rect_bench.tl --publish
 
+TL_MODULE_PATH=./modules:./cmodules ./tl beval_bench.tl
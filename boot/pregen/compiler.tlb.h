@@ -1,2 +1,2 @@
-const char modules_compiler[] = {0x74,0x6c,0x30,0x31,0xab,0x1c,0x2,0x65,0x71,0x6,0x72,0x65,0x74,0x75,0x72,0x6e,0x3,0x62,0x6f,0x72,0xc1,0x1,0x80,0x6,0x6f,0x66,0x66,0x73,0x65,0x74,0x4,0x74,0x65,0x78,0x74,0x3,0x70,0x6f,0x73,0xc1,0x10,0x2c,0xc1,0x10,0x46,0x26,0x7,0x7,0x8,0x8,0x8,0x7,0x4,0x6c,0x69,0x6e,0x65,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9,0xa,0xf0,0xb6,0xc3,0xc4,0xc4,0xc4,0xb,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x0,0xd3,0xd3,0x0,0xc1,0x10,0x82,0xc1,0x10,0x9c,0x26,0xd,0xd,0xe,0xe,0xe,0xd,0x64,0x4,0xc8,0x5,0xc3,0x6,0xf,0xa,0xf1,0xb6,0xc3,0xc4,0xc4,0xc4,0x10,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x1,0xd3,0xd3,0x0,0xc1,0x10,0xd8,0xc1,0x10,0xf2,0x26,0x12,0x12,0x13,0x13,0x13,0x12,0x64,0x4,0xc8,0x5,0xc3,0x6,0x14,0xa,0xf2,0xb6,0xc3,0xc4,0xc4,0xc4,0x15,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x2,0xd3,0xd3,0x0,0x0,0xc1,0x11,0x2e,0xc1,0x11,0x48,0x26,0x18,0x18,0x19,0x19,0x19,0x18,0x64,0x4,0xc8,0x5,0xc3,0x6,0x1a,0xa,0xf3,0xb6,0xc3,0xc4,0xc4,0xc4,0x1b,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x3,0xd3,0xd3,0x0,0x6,0x5f,0x5f,0x6c,0x69,0x73,0x74,0xc1,0x11,0x84,0xc1,0x11,0x9e,0x26,0x1e,0x1e,0x1f,0x1f,0x1f,0x1e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x20,0xa,0xf4,0xb6,0xc3,0xc4,0xc4,0xc4,0x21,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x4,0xd3,0xd3,0x0,0x8,0x5f,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x60,0xc1,0x11,0xda,0xc1,0x11,0xf4,0x26,0x25,0x25,0x26,0x26,0x26,0x25,0x64,0x4,0xc8,0x5,0xc3,0x6,0x27,0xa,0xf5,0xb6,0xc3,0xc4,0xc4,0xc4,0x28,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x5,0xd3,0xd3,0x0,0xc0,0x5,0xc1,0x12,0x30,0xc1,0x12,0x4a,0x26,0x2b,0x2b,0x2c,0x2c,0x2c,0x2b,0x64,0x4,0xc8,0x5,0xc3,0x6,0x2d,0xa,0xf6,0xb6,0xc3,0xc4,0xc4,0xc4,0x2e,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x6,0xd3,0xd3,0x0,0xc0,0x3,0xc1,0x12,0x86,0xc1,0x12,0xa0,0x26,0x31,0x31,0x32,0x32,0x32,0x31,0x64,0x4,0xc8,0x5,0xc3,0x6,0x33,0xa,0xf7,0xb6,0xc3,0xc4,0xc4,0xc4,0x34,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x7,0xd3,0xd3,0x0,0x3,0x61,0x6e,0x64,0x3,0x67,0x74,0x65,0x3,0x6c,0x74,0x65,0x3,0x73,0x75,0x62,0xc0,0x7e,0x3,0x61,0x64,0x64,0xc1,0x13,0x6,0xc1,0x13,0x20,0xc1,0x13,0x2a,0x29,0x3c,0x3c,0x3d,0x3d,0x3e,0x3e,0x3e,0x3d,0x3c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x3f,0xa,0xf8,0xbe,0xc3,0xc4,0xc4,0xc4,0x40,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xe1,0x2,0xc7,0x9,0xc4,0x8,0xc8,0x0,0x0,0xd3,0xd3,0xd3,0x0,0xc1,0x13,0x68,0x23,0x42,0x42,0x42,0x64,0x4,0xc8,0x5,0xc3,0x6,0x43,0xa,0xf9,0xae,0xc3,0xc4,0xc4,0xc4,0x44,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc2,0xd3,0x0,0xd,0x65,0x6e,0x63,0x6f,0x64,0x65,0x4c,0x69,0x74,0x65,0x72,0x61,0x6c,0x1,0x76,0x21,0x47,0x21,0x48,0xc1,0x10,0x8,0xc1,0x10,0x5e,0xc1,0x10,0xb4,0xc1,0x11,0xa,0xc1,0x11,0x60,0xc1,0x11,0x66,0xc1,0x11,0xb6,0xc1,0x12,0xc,0xc1,0x12,0x62,0xc1,0x12,0xc2,0xc1,0x12,0xb8,0xc1,0x12,0xce,0xc1,0x12,0xec,0xe1,0x3e,0x4a,0x4a,0x4a,0xc0,0xc0,0x4b,0x4b,0x4b,0xc0,0xc0,0x4c,0x4c,0x4c,0xc0,0xc0,0x4d,0x4d,0x4d,0xc0,0xc0,0x4e,0x4e,0x4f,0x4f,0x4f,0x4e,0xc0,0xc0,0x50,0x50,0xc0,0xc0,0xc0,0x50,0xc0,0xc0,0x51,0x51,0x51,0xc0,0xc0,0x52,0x52,0x52,0xc0,0xc0,0x53,0x53,0x54,0x54,0x54,0x55,0x55,0x56,0x56,0x56,0x55,0x53,0xc0,0xc0,0xc0,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x57,0xa,0xef,0xe5,0x81,0x25,0x46,0x49,0xc4,0xc4,0x58,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc2,0xd3,0xe3,0x0,0xd0,0xc,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc1,0xd3,0xe3,0x0,0xd0,0x11,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc0,0xd3,0xe3,0x0,0xd0,0x16,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x17,0xd3,0xe3,0x0,0xd0,0x1c,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xe3,0x0,0xd0,0x22,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xe1,0x1,0xc7,0x4,0xc6,0x24,0xd3,0xd3,0xe3,0x0,0xd0,0x29,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x2a,0xd3,0xe3,0x0,0xd0,0x2f,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x30,0xd3,0xe3,0x0,0xd0,0x35,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x6,0xca,0x0,0xc4,0x0,0xd3,0xe1,0x2,0xc7,0x7,0xca,0x0,0xe1,0x2,0xc7,0x8,0xc6,0x3a,0xc4,0x8,0xd3,0xd3,0xd3,0xe3,0x0,0xd0,0x41,0xd3,0xc0,0xe3,0x0,0xd0,0x45,0xd3,0xd4,0x0,0x6,0x73,0x74,0x72,0x69,0x6e,0x67,0x22,0xc0,0x5a,0x6,0x61,0x73,0x73,0x65,0x72,0x74,0x6,0x69,0x20,0x3e,0x3d,0x20,0x30,0x5,0x62,0x6c,0x6f,0x63,0x6b,0x22,0xc0,0x5e,0x2,0x69,0x66,0x2,0x6c,0x74,0x3,0x72,0x73,0x68,0x3,0x6c,0x73,0x68,0xc1,0x13,0xfa,0x23,0x64,0x64,0x64,0x64,0x4,0xc8,0x5,0xc3,0x6,0x65,0xa,0xfd,0xb0,0xc3,0xc4,0xc4,0xc4,0x66,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc8,0x0,0x0,0xd3,0x0,0x3,0x42,0x69,0x6e,0xc1,0x1,0x0,0x4,0x62,0x61,0x6e,0x64,0xc0,0xfe,0xc1,0x14,0x3e,0xc1,0x14,0x46,0xc1,0x14,0x40,0xc1,0x14,0x60,0xc1,0x14,0x68,0xc1,0x14,0x78,0x2f,0x6c,0x6c,0x6d,0x6e,0x6f,0x6f,0x70,0x70,0x70,0x6f,0x71,0x71,0x71,0x6d,0x6c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x72,0xa,0xfe,0xe5,0x2d,0xc3,0xc4,0xc4,0xc4,0x73,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x69,0xe1,0x2,0xc7,0xd,0xc8,0x0,0x0,0xc4,0x7,0xd3,0xd3,0xe1,0x2,0xc7,0x10,0xc8,0x0,0x0,0xc6,0x6b,0xd3,0xd3,0xd3,0x0,0xc1,0x14,0xd4,0xc1,0x14,0xdc,0xc1,0x14,0xd6,0xc1,0x14,0xf6,0xc1,0x14,0xfe,0xc1,0x15,0x24,0xc1,0x15,0x38,0xc1,0x15,0x2e,0xc1,0x15,0x5c,0x38,0x75,0x75,0x76,0x77,0x78,0x78,0x79,0x79,0x79,0x78,0x7a,0x7a,0x7b,0x7b,0x7c,0x7c,0x7c,0x7b,0x7a,0x7d,0x7d,0x7d,0x76,0x75,0x64,0x4,0xc8,0x5,0xc3,0x6,0x7e,0xa,0xff,0xe5,0x45,0xc3,0xc4,0xc4,0xc4,0x7f,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x3,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x69,0xe1,0x2,0xc7,0xd,0xc8,0x0,0x0,0xc4,0xd,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x69,0xe1,0x2,0xc7,0x10,0xe1,0x2,0xc7,0xd,0xc8,0x0,0x0,0xc4,0x7,0xd3,0xc6,0x3a,0xd3,0xd3,0xe1,0x2,0xc7,0x10,0xc8,0x0,0x0,0xc6,0x6b,0xd3,0xd3,0xd3,0x0,0xc1,0x15,0xb8,0xc1,0x15,0xc0,0xc1,0x15,0xba,0xc1,0x15,0xda,0xc1,0x15,0xe2,0xc1,0x16,0x8,0xc1,0x16,0x1e,0xc1,0x16,0x12,0xc1,0x16,0x9e,0xc1,0x16,0xb2,0xc1,0x16,0xa8,0xc1,0x16,0xd6,0xe1,0x21,0x81,0x1,0x81,0x1,0x81,0x2,0x81,0x3,0x81,0x4,0x81,0x4,0x81,0x5,0x81,0x5,0x81,0x5,0x81,0x4,0x81,0x6,0x81,0x6,0x81,0x7,0x81,0x7,0x81,0x8,0x81,0x8,0x81,0x8,0x81,0x7,0x81,0x6,0x81,0x9,0x81,0x9,0x81,0xa,0x81,0xa,0x81,0xb,0x81,0xb,0x81,0xb,0x81,0xa,0x81,0x9,0x81,0xc,0x81,0xc,0x81,0xc,0x81,0x2,0x81,0x1,0xc0,0x70,0x64,0x4,0xc8,0x5,0xc3,0x6,0x81,0xd,0xa,0x81,0xe,0xe5,0x5e,0xc3,0xc4,0xc4,0xc4,0x81,0xf,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x4,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x69,0xe1,0x2,0xc7,0xd,0xc8,0x0,0x0,0xc4,0x13,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x69,0xe1,0x2,0xc7,0x10,0xe1,0x2,0xc7,0xd,0xc8,0x0,0x0,0xc4,0xd,0xd3,0xc6,0x3a,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x69,0xe1,0x2,0xc7,0x10,0xe1,0x2,0xc7,0xd,0xc8,0x0,0x0,0xc4,0x7,0xd3,0xc6,0x3a,0xd3,0xd3,0xe1,0x2,0xc7,0x10,0xc8,0x0,0x0,0xc6,0x6b,0xd3,0xd3,0xd3,0x0,0xc1,0x17,0x32,0xc1,0x17,0x3a,0xc1,0x17,0x34,0xc1,0x17,0x54,0xc1,0x17,0x5c,0xc1,0x17,0x82,0xc1,0x17,0x98,0xc1,0x17,0x8c,0xc1,0x18,0x18,0xc1,0x18,0x2e,0xc1,0x18,0x22,0xc1,0x18,0x66,0xc1,0x18,0x7a,0xc1,0x18,0x70,0xc1,0x18,0x9e,0xe1,0x2a,0x81,0x11,0x81,0x11,0x81,0x12,0x81,0x13,0x81,0x14,0x81,0x14,0x81,0x15,0x81,0x15,0x81,0x15,0x81,0x14,0x81,0x16,0x81,0x16,0x81,0x17,0x81,0x17,0x81,0x18,0x81,0x18,0x81,0x18,0x81,0x17,0x81,0x16,0x81,0x19,0x81,0x19,0x81,0x1a,0x81,0x1a,0x81,0x1b,0x81,0x1b,0x81,0x1b,0x81,0x1a,0x81,0x19,0x81,0x1c,0x81,0x1c,0x81,0x1d,0x81,0x1d,0x81,0x1e,0x81,0x1e,0x81,0x1e,0x81,0x1d,0x81,0x1c,0x81,0x1f,0x81,0x1f,0x81,0x1f,0x81,0x12,0x81,0x11,0xc0,0x74,0x64,0x4,0xc8,0x5,0xc3,0x6,0x81,0x20,0xa,0x81,0x21,0xe5,0x76,0xc3,0xc4,0xc4,0xc4,0x81,0x22,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x5,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x69,0xe1,0x2,0xc7,0xd,0xc8,0x0,0x0,0xc4,0x19,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x69,0xe1,0x2,0xc7,0x10,0xe1,0x2,0xc7,0xd,0xc8,0x0,0x0,0xc4,0x13,0xd3,0xc6,0x3a,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x69,0xe1,0x2,0xc7,0x10,0xe1,0x2,0xc7,0xd,0xc8,0x0,0x0,0xc4,0xd,0xd3,0xc6,0x3a,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x69,0xe1,0x2,0xc7,0x10,0xe1,0x2,0xc7,0xd,0xc8,0x0,0x0,0xc4,0x7,0xd3,0xc6,0x3a,0xd3,0xd3,0xe1,0x2,0xc7,0x10,0xc8,0x0,0x0,0xc6,0x6b,0xd3,0xd3,0xd3,0x0,0x5,0x66,0x61,0x6c,0x73,0x65,0x9,0x65,0x6e,0x63,0x6f,0x64,0x65,0x49,0x6e,0x74,0x1,0x69,0x21,0x81,0x26,0x21,0x81,0x27,0xc1,0x13,0xae,0xc1,0x13,0xa0,0xc1,0x13,0xb2,0xc1,0x13,0xc4,0xc1,0x13,0xda,0xc1,0x13,0xce,0xc1,0x13,0xe2,0xc1,0x14,0x8,0xc1,0x14,0x1e,0xc1,0x14,0x12,0xc1,0x14,0x26,0xc1,0x14,0x9e,0xc1,0x14,0xb4,0xc1,0x14,0xa8,0xc1,0x14,0xbc,0xc1,0x15,0x82,0xc1,0x15,0x98,0xc1,0x15,0x8c,0xc1,0x15,0xa0,0xc1,0x16,0xfc,0xc1,0x17,0x12,0xc1,0x17,0x6,0xc1,0x17,0x1a,0xc1,0x18,0xd2,0xc1,0x18,0xc4,0xe1,0x45,0x81,0x29,0x81,0x2a,0x81,0x2b,0x81,0x2b,0x81,0x2b,0x81,0x29,0xc0,0x81,0x2c,0x81,0x2d,0x81,0x2d,0x81,0x2e,0x81,0x2e,0x81,0x2e,0x81,0x2f,0x81,0x2f,0x81,0x2f,0x81,0x2d,0xc0,0xc0,0x81,0x30,0x81,0x31,0x81,0x31,0x81,0x32,0x81,0x32,0x81,0x32,0x81,0x33,0x81,0x33,0x81,0x33,0x81,0x31,0xc0,0xc0,0x81,0x34,0x81,0x35,0x81,0x35,0x81,0x36,0x81,0x36,0x81,0x36,0x81,0x37,0x81,0x37,0x81,0x37,0x81,0x35,0xc0,0xc0,0x81,0x38,0x81,0x39,0x81,0x39,0x81,0x3a,0x81,0x3a,0x81,0x3a,0x81,0x3b,0x81,0x3b,0x81,0x3b,0x81,0x39,0xc0,0xc0,0x81,0x3c,0x81,0x3d,0x81,0x3d,0x81,0x3e,0x81,0x3e,0x81,0x3e,0x81,0x3f,0x81,0x3f,0x81,0x3f,0x81,0x3d,0xc0,0x81,0x40,0x81,0x41,0x81,0x40,0x64,0x4,0xc8,0x5,0xc3,0x6,0x81,0x42,0xa,0xfb,0xe5,0x81,0x42,0x81,0x25,0x81,0x28,0xc4,0xc4,0x81,0x43,0xf1,0x2,0x5b,0xc7,0xa,0xe1,0x2,0xc7,0x6,0xca,0x0,0xc4,0x0,0xd3,0xc6,0x5d,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xe1,0x2,0xc7,0xd,0xca,0x0,0xc4,0x0,0xd3,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc4,0x7,0xd3,0xd3,0xd0,0x67,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xe1,0x2,0xc7,0xd,0xca,0x0,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc4,0x6,0xd3,0xd3,0xd0,0x74,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xe1,0x2,0xc7,0xd,0xca,0x0,0xc4,0xd,0xd3,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc4,0x6,0xd3,0xd3,0xd0,0x81,0x0,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xe1,0x2,0xc7,0xd,0xca,0x0,0xc4,0x13,0xd3,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc4,0x6,0xd3,0xd3,0xd0,0x81,0x10,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xe1,0x2,0xc7,0xd,0xca,0x0,0xc4,0x19,0xd3,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc4,0x6,0xd3,0xd3,0xd0,0x81,0x23,0xd3,0xf1,0x2,0x5b,0xc7,0xa,0xc1,0xc6,0x81,0x24,0xd3,0x0,0xc1,0x1,0x92,0x5,0x62,0x79,0x74,0x65,0x73,0xb,0x65,0x6e,0x63,0x6f,0x64,0x65,0x46,0x6c,0x6f,0x61,0x74,0x1,0x66,0x21,0x81,0x48,0x21,0x81,0x49,0xc1,0x19,0x30,0xc1,0x19,0x14,0xc1,0x19,0xe,0xc1,0x19,0x36,0x28,0x81,0x4b,0x81,0x4b,0x81,0x4c,0x81,0x4d,0x81,0x4c,0x81,0x4e,0x81,0x4e,0x81,0x4b,0xc0,0x7c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x81,0x4f,0xa,0x81,0x50,0xbe,0x81,0x47,0x81,0x4a,0xc4,0xc4,0x81,0x51,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0xf,0xc6,0x81,0x45,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x81,0x46,0xd3,0xd3,0x0,0x3,0x61,0x62,0x73,0x4,0x62,0x6f,0x6f,0x6c,0xc1,0x19,0xee,0xc1,0x19,0xf6,0xc1,0x19,0xf0,0xc1,0x1a,0x10,0xc1,0x1a,0x5c,0xc1,0x1a,0x52,0xc1,0x1a,0x68,0xc1,0x1a,0x60,0x32,0x81,0x55,0x81,0x55,0x81,0x56,0x81,0x57,0x81,0x58,0x81,0x58,0x81,0x58,0x81,0x59,0x81,0x59,0x81,0x5a,0x81,0x5a,0x81,0x5a,0x81,0x5b,0x81,0x5c,0x81,0x5b,0x81,0x59,0x81,0x56,0x81,0x55,0xc0,0x88,0x64,0x4,0xc8,0x5,0xc3,0x6,0x81,0x5d,0xa,0x81,0x5e,0xe5,0x37,0xc3,0xc4,0xc4,0xc4,0x81,0x5f,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x0,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xe,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x11,0xc9,0x0,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0x0,0xc1,0x1a,0xb4,0xc1,0x1a,0xbc,0xc1,0x1a,0xb6,0xc1,0x1a,0xd6,0xc1,0x1b,0x8,0xc1,0x1b,0x22,0xc1,0x1b,0x18,0xc1,0x1b,0x2e,0xc1,0x1b,0x26,0x35,0x81,0x61,0x81,0x61,0x81,0x62,0x81,0x63,0x81,0x64,0x81,0x64,0x81,0x64,0x81,0x65,0x81,0x65,0x81,0x65,0x81,0x66,0x81,0x66,0x81,0x67,0x81,0x67,0x81,0x67,0x81,0x68,0x81,0x69,0x81,0x68,0x81,0x66,0x81,0x62,0x81,0x61,0xc0,0x8a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x81,0x6a,0xa,0x81,0x6b,0xe5,0x41,0xc3,0xc4,0xc4,0xc4,0x81,0x6c,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x3,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xe,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x11,0xc9,0x0,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0x0,0xc1,0x1b,0x7a,0xc1,0x1b,0x82,0xc1,0x1b,0x7c,0xc1,0x1b,0x9c,0xc1,0x1b,0xbc,0xc1,0x1b,0xce,0xc1,0x1b,0xe8,0xc1,0x1b,0xde,0xc1,0x1b,0xf4,0xc1,0x1b,0xec,0x38,0x81,0x6e,0x81,0x6e,0x81,0x6f,0x81,0x70,0x81,0x71,0x81,0x71,0x81,0x71,0x81,0x72,0x81,0x72,0x81,0x72,0x81,0x73,0x81,0x73,0x81,0x73,0x81,0x74,0x81,0x74,0x81,0x75,0x81,0x75,0x81,0x75,0x81,0x76,0x81,0x77,0x81,0x76,0x81,0x74,0x81,0x6f,0x81,0x6e,0xc0,0x8c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x81,0x78,0xa,0x81,0x79,0xe5,0x4b,0xc3,0xc4,0xc4,0xc4,0x81,0x7a,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x4,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x2,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xe,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x11,0xc9,0x0,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0x0,0xc0,0x3e,0xc1,0x1c,0x40,0xc1,0x1c,0x48,0xc1,0x1c,0x42,0xc1,0x1c,0x62,0xc1,0x1c,0x70,0xc1,0x1c,0x82,0xc1,0x1c,0x94,0xc1,0x1c,0xae,0xc1,0x1c,0xa4,0xc1,0x1c,0xba,0xc1,0x1c,0xb2,0x3b,0x81,0x7d,0x81,0x7d,0x81,0x7e,0x81,0x7f,0x82,0x0,0x82,0x0,0x82,0x0,0x82,0x1,0x82,0x1,0x82,0x1,0x82,0x2,0x82,0x2,0x82,0x2,0x82,0x3,0x82,0x3,0x82,0x3,0x82,0x4,0x82,0x4,0x82,0x5,0x82,0x5,0x82,0x5,0x82,0x6,0x82,0x7,0x82,0x6,0x82,0x4,0x81,0x7e,0x81,0x7d,0xc0,0x8e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x82,0x8,0xa,0x82,0x9,0xe5,0x55,0xc3,0xc4,0xc4,0xc4,0x82,0xa,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x5,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x3,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x17,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xe,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x11,0xc9,0x0,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0x0,0xc0,0x4e,0xc1,0x1d,0x8,0xc1,0x1d,0x10,0xc1,0x1d,0xa,0xc1,0x1d,0x2a,0xc1,0x1d,0x6e,0xc1,0x1d,0x80,0xc1,0x1d,0x92,0xc1,0x1d,0xa4,0xc1,0x1d,0xbe,0xc1,0x1d,0xb4,0xc1,0x1d,0xca,0xc1,0x1d,0xc2,0x3e,0x82,0xd,0x82,0xd,0x82,0xe,0x82,0xf,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x11,0x82,0x11,0x82,0x11,0x82,0x12,0x82,0x12,0x82,0x12,0x82,0x13,0x82,0x13,0x82,0x13,0x82,0x14,0x82,0x14,0x82,0x14,0x82,0x15,0x82,0x15,0x82,0x16,0x82,0x16,0x82,0x16,0x82,0x17,0x82,0x18,0x82,0x17,0x82,0x15,0x82,0xe,0x82,0xd,0xc0,0x92,0x64,0x4,0xc8,0x5,0xc3,0x6,0x82,0x19,0xa,0x82,0x1a,0xe5,0x60,0xc3,0xc4,0xc4,0xc4,0x82,0x1b,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x6,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x4,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc6,0x81,0x7c,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x17,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xe,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x11,0xc9,0x0,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0x0,0xc0,0x5e,0xc1,0x1e,0x16,0xc1,0x1e,0x1e,0xc1,0x1e,0x18,0xc1,0x1e,0x38,0xc1,0x1e,0x6a,0xc1,0x1e,0x7c,0xc1,0x1e,0x8e,0xc1,0x1e,0xa0,0xc1,0x1e,0xb2,0xc1,0x1e,0xcc,0xc1,0x1e,0xc2,0xc1,0x1e,0xd8,0xc1,0x1e,0xd0,0xe1,0x21,0x82,0x1e,0x82,0x1e,0x82,0x1f,0x82,0x20,0x82,0x21,0x82,0x21,0x82,0x21,0x82,0x22,0x82,0x22,0x82,0x22,0x82,0x23,0x82,0x23,0x82,0x23,0x82,0x24,0x82,0x24,0x82,0x24,0x82,0x25,0x82,0x25,0x82,0x25,0x82,0x26,0x82,0x26,0x82,0x26,0x82,0x27,0x82,0x27,0x82,0x28,0x82,0x28,0x82,0x28,0x82,0x29,0x82,0x2a,0x82,0x29,0x82,0x27,0x82,0x1f,0x82,0x1e,0xc0,0x94,0x64,0x4,0xc8,0x5,0xc3,0x6,0x82,0x2b,0xa,0x82,0x2c,0xe5,0x6b,0xc3,0xc4,0xc4,0xc4,0x82,0x2d,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x7,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x5,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc6,0x82,0xc,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc6,0x81,0x7c,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x17,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xe,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x11,0xc9,0x0,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0x0,0xc0,0x6e,0xc1,0x1f,0x24,0xc1,0x1f,0x2c,0xc1,0x1f,0x26,0xc1,0x1f,0x46,0xc1,0x1f,0x66,0xc1,0x1f,0x78,0xc1,0x1f,0x8a,0xc1,0x1f,0x9c,0xc1,0x1f,0xae,0xc1,0x1f,0xc0,0xc1,0x1f,0xda,0xc1,0x1f,0xd0,0xc1,0x1f,0xe6,0xc1,0x1f,0xde,0xe1,0x24,0x82,0x30,0x82,0x30,0x82,0x31,0x82,0x32,0x82,0x33,0x82,0x33,0x82,0x33,0x82,0x34,0x82,0x34,0x82,0x34,0x82,0x35,0x82,0x35,0x82,0x35,0x82,0x36,0x82,0x36,0x82,0x36,0x82,0x37,0x82,0x37,0x82,0x37,0x82,0x38,0x82,0x38,0x82,0x38,0x82,0x39,0x82,0x39,0x82,0x39,0x82,0x3a,0x82,0x3a,0x82,0x3b,0x82,0x3b,0x82,0x3b,0x82,0x3c,0x82,0x3d,0x82,0x3c,0x82,0x3a,0x82,0x31,0x82,0x30,0xc0,0x96,0x64,0x4,0xc8,0x5,0xc3,0x6,0x82,0x3e,0xa,0x82,0x3f,0xe5,0x76,0xc3,0xc4,0xc4,0xc4,0x82,0x40,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x8,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x6,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc6,0x82,0x1d,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc6,0x82,0xc,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc6,0x81,0x7c,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x17,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xe,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x11,0xc9,0x0,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0x0,0xc1,0x20,0x32,0xc1,0x20,0x3a,0xc1,0x20,0x34,0xc1,0x20,0x54,0xc1,0x20,0x62,0xc1,0x20,0x74,0xc1,0x20,0x86,0xc1,0x20,0x98,0xc1,0x20,0xaa,0xc1,0x20,0xbc,0xc1,0x20,0xce,0xc1,0x20,0xe8,0xc1,0x20,0xde,0xc1,0x20,0xf4,0xc1,0x20,0xec,0xe1,0x27,0x82,0x42,0x82,0x42,0x82,0x43,0x82,0x44,0x82,0x45,0x82,0x45,0x82,0x45,0x82,0x46,0x82,0x46,0x82,0x46,0x82,0x47,0x82,0x47,0x82,0x47,0x82,0x48,0x82,0x48,0x82,0x48,0x82,0x49,0x82,0x49,0x82,0x49,0x82,0x4a,0x82,0x4a,0x82,0x4a,0x82,0x4b,0x82,0x4b,0x82,0x4b,0x82,0x4c,0x82,0x4c,0x82,0x4c,0x82,0x4d,0x82,0x4d,0x82,0x4e,0x82,0x4e,0x82,0x4e,0x82,0x4f,0x82,0x50,0x82,0x4f,0x82,0x4d,0x82,0x43,0x82,0x42,0xc0,0x98,0x64,0x4,0xc8,0x5,0xc3,0x6,0x82,0x51,0xa,0x82,0x52,0xe5,0x81,0x1,0xc3,0xc4,0xc4,0xc4,0x82,0x53,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x9,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc6,0x82,0x2f,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc6,0x82,0x1d,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc6,0x82,0xc,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc6,0x81,0x7c,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x17,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xe,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x11,0xc9,0x0,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0x0,0xc1,0x1,0xcc,0x4,0x73,0x69,0x7a,0x65,0xc,0x65,0x6e,0x63,0x6f,0x64,0x65,0x4e,0x75,0x6d,0x62,0x65,0x72,0x3,0x6e,0x75,0x6d,0x21,0x82,0x58,0x21,0x82,0x59,0x1,0x6e,0x23,0x6,0x82,0x5b,0x81,0x46,0x23,0xc1,0xc1,0xc1,0xc1,0x19,0x8e,0xc1,0x19,0xae,0xc1,0x19,0xc0,0xc1,0x19,0xca,0xc1,0x19,0xd2,0xc1,0x1a,0x86,0xc1,0x1a,0x90,0xc1,0x1a,0x98,0xc1,0x1b,0x4c,0xc1,0x1b,0x56,0xc1,0x1b,0x5e,0xc1,0x1c,0x12,0xc1,0x1c,0x1c,0xc1,0x1c,0x24,0xc1,0x1c,0xda,0xc1,0x1c,0xe4,0xc1,0x1c,0xec,0xc1,0x1d,0xe8,0xc1,0x1d,0xf2,0xc1,0x1d,0xfa,0xc1,0x1e,0xf6,0xc1,0x1f,0x0,0xc1,0x1f,0x8,0xc1,0x20,0x4,0xc1,0x20,0xe,0xc1,0x20,0x16,0xc1,0x21,0x2a,0xc1,0x21,0x4c,0xc1,0x21,0x54,0xc1,0x21,0x4e,0xc1,0x21,0x82,0xc1,0x21,0x8e,0xe1,0x59,0x82,0x5e,0x82,0x5e,0x82,0x5e,0x82,0x5f,0x82,0x5f,0xc0,0x82,0x60,0x82,0x61,0x82,0x61,0x82,0x62,0x82,0x62,0x82,0x62,0x82,0x61,0xc0,0xc0,0x82,0x63,0x82,0x64,0x82,0x64,0x82,0x65,0x82,0x65,0x82,0x65,0x82,0x64,0xc0,0xc0,0x82,0x66,0x82,0x67,0x82,0x67,0x82,0x68,0x82,0x68,0x82,0x68,0x82,0x67,0xc0,0xc0,0x82,0x69,0x82,0x6a,0x82,0x6a,0x82,0x6b,0x82,0x6b,0x82,0x6b,0x82,0x6a,0xc0,0xc0,0x82,0x6c,0x82,0x6d,0x82,0x6d,0x82,0x6e,0x82,0x6e,0x82,0x6e,0x82,0x6d,0xc0,0xc0,0x82,0x6f,0x82,0x70,0x82,0x70,0x82,0x71,0x82,0x71,0x82,0x71,0x82,0x70,0xc0,0xc0,0x82,0x72,0x82,0x73,0x82,0x73,0x82,0x74,0x82,0x74,0x82,0x74,0x82,0x73,0xc0,0xc0,0x82,0x75,0x82,0x76,0x82,0x76,0x82,0x77,0x82,0x77,0x82,0x77,0x82,0x76,0xc0,0x82,0x78,0x82,0x78,0x82,0x79,0x82,0x79,0x82,0x7a,0x82,0x7b,0x82,0x7c,0x82,0x7d,0x82,0x7d,0x82,0x7c,0x82,0x7a,0x82,0x79,0xc0,0x82,0x64,0x4,0xc8,0x5,0xc3,0x6,0x82,0x7e,0xa,0x82,0x7f,0xe5,0x82,0x15,0x82,0x57,0x82,0x5a,0x82,0x5c,0x82,0x5d,0x83,0x0,0xe1,0x2,0xc7,0x6,0xca,0x0,0xc4,0x0,0xd3,0xd1,0x0,0xe0,0x0,0xca,0x0,0xc6,0x81,0x53,0xd3,0xd1,0x1,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc4,0x7,0xd3,0xd3,0xd0,0x81,0x60,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc4,0xf,0xd3,0xd3,0xd0,0x81,0x6d,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc4,0x17,0xd3,0xd3,0xd0,0x81,0x7b,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc6,0x81,0x7c,0xd3,0xd3,0xd0,0x82,0xb,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc6,0x82,0xc,0xd3,0xd3,0xd0,0x82,0x1c,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc6,0x82,0x1d,0xd3,0xd3,0xd0,0x82,0x2e,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc6,0x82,0x2f,0xd3,0xd3,0xd0,0x82,0x41,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xe1,0x2,0xc7,0xe,0xc4,0x1,0xc6,0x3a,0xd3,0xd3,0xd0,0x82,0x54,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x81,0x46,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x3,0xc7,0xf,0xc6,0x82,0x55,0xe1,0x1,0xc9,0x0,0x1,0xe0,0x0,0xcb,0x2,0xc6,0x82,0x56,0xd3,0xd3,0xcb,0x2,0xd3,0xd3,0x0,0x8,0x69,0x73,0x53,0x74,0x72,0x69,0x6e,0x67,0xa,0x69,0x73,0x53,0x74,0x72,0x69,0x6e,0x67,0x20,0x73,0xc0,0x40,0xc1,0x22,0x38,0xc1,0x22,0x40,0xc1,0x22,0x3a,0xc1,0x22,0x5a,0xc1,0x22,0x60,0x2b,0x83,0x5,0x83,0x5,0x83,0x6,0x83,0x7,0x83,0x8,0x83,0x8,0x83,0x9,0x83,0x9,0x83,0x8,0x83,0x6,0x83,0x5,0xc0,0xa6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x83,0xa,0xa,0x83,0xb,0xe5,0x26,0xc3,0xc4,0xc4,0xc4,0x83,0xc,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc4,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x81,0x46,0xd3,0xd3,0xc8,0x0,0x0,0xd3,0xd3,0x0,0xc1,0x1,0xc0,0xc,0x65,0x6e,0x63,0x6f,0x64,0x65,0x53,0x74,0x72,0x69,0x6e,0x67,0x1,0x73,0x21,0x83,0x10,0x21,0x83,0x11,0xc1,0x21,0xec,0xc1,0x21,0xde,0xc1,0x21,0xfc,0xc1,0x22,0xa,0xc1,0x22,0x20,0xc1,0x22,0x12,0xc1,0x22,0x8a,0xc1,0x22,0x92,0xc1,0x22,0x8c,0xc1,0x22,0xc0,0xc1,0x22,0xc4,0x38,0x83,0x13,0x83,0x14,0x83,0x15,0x83,0x13,0x83,0x15,0x83,0x13,0xc0,0x83,0x16,0x83,0x17,0x83,0x17,0x83,0x18,0x83,0x18,0x83,0x17,0xc0,0x83,0x19,0x83,0x19,0x83,0x1a,0x83,0x1b,0x83,0x1c,0x83,0x1d,0x83,0x1d,0x83,0x1c,0x83,0x1a,0x83,0x19,0xc0,0xa2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x83,0x1e,0xa,0x83,0x1f,0xe5,0x51,0x83,0xf,0x83,0x12,0xc4,0xc4,0x83,0x20,0xf1,0x2,0x5b,0xc7,0xa,0xe1,0x1,0xc7,0x12,0xca,0x0,0xd3,0xc6,0x83,0x3,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xe0,0x0,0xca,0x0,0xc6,0x81,0x46,0xd3,0xc6,0x83,0x4,0xd3,0xd0,0x83,0xd,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x3,0xc7,0xf,0xc6,0x83,0xe,0xe1,0x1,0xc9,0x0,0x1,0xe0,0x0,0xca,0x0,0xc6,0x81,0x46,0xd3,0xd3,0xca,0x0,0xd3,0xd3,0x0,0x6,0x42,0x75,0x66,0x66,0x65,0x72,0x3,0x6e,0x65,0x77,0x21,0x5e,0x4,0x65,0x61,0x63,0x68,0x5,0x77,0x72,0x69,0x74,0x65,0x1,0x65,0x21,0x83,0x27,0x21,0x83,0x28,0xc1,0x23,0xb8,0x22,0x83,0x2a,0x83,0x2a,0xc0,0xb2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x83,0x2b,0xa,0x83,0x2c,0xb3,0xc3,0x83,0x29,0xc4,0xc4,0x83,0x2d,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x83,0x26,0xca,0x0,0xd3,0x0,0x4,0x72,0x65,0x61,0x64,0x3,0x62,0x75,0x66,0x21,0x83,0x30,0x21,0xc1,0xc1,0x23,0x52,0xc1,0x23,0x46,0xc1,0x23,0x74,0xc1,0x23,0x7a,0xc1,0x23,0x9a,0xc1,0x23,0xe8,0xc1,0x23,0xf0,0x2f,0x83,0x33,0x83,0x34,0x83,0x35,0x83,0x35,0x83,0x36,0x83,0x36,0x83,0x35,0x83,0x33,0x83,0x37,0x83,0x37,0x83,0x38,0x83,0x38,0x83,0x39,0x83,0x39,0x83,0x38,0xc0,0xae,0x64,0x4,0xc8,0x5,0xc3,0x6,0x83,0x3a,0xa,0x83,0x3b,0xe5,0x41,0xc3,0xc4,0x83,0x31,0x83,0x32,0x83,0x3c,0xe0,0x1,0xc7,0x13,0xc6,0x83,0x23,0xe1,0x2,0xc7,0x2,0xc6,0x83,0x4,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x82,0x56,0xd3,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x83,0x24,0xc8,0x0,0x0,0xc6,0x83,0x25,0xd0,0x83,0x2e,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x0,0xcb,0x0,0xc6,0x83,0x2f,0xd3,0xd3,0x0,0xc1,0x1,0xc2,0xc1,0x24,0x8e,0x22,0x83,0x3f,0x83,0x3f,0xc0,0xb8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x83,0x40,0xa,0x83,0x41,0xb3,0xc3,0x83,0x29,0xc4,0xc4,0x83,0x42,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x83,0x26,0xca,0x0,0xd3,0x0,0xa,0x65,0x6e,0x63,0x6f,0x64,0x65,0x4c,0x69,0x73,0x74,0x1,0x6c,0x21,0x83,0x45,0x21,0x83,0x46,0xc1,0x23,0xa,0xc1,0x23,0x1e,0xc1,0x23,0x12,0xc1,0x24,0x1c,0xc1,0x24,0x10,0xc1,0x24,0x52,0xc1,0x24,0x56,0xc1,0x24,0x70,0xc1,0x24,0xb6,0xc1,0x24,0xbe,0x36,0xc0,0x83,0x48,0x83,0x49,0x83,0x49,0x83,0x4a,0x83,0x4a,0x83,0x49,0xc0,0x83,0x4b,0x83,0x4c,0x83,0x4d,0x83,0x4e,0x83,0x4e,0x83,0x4d,0x83,0x4b,0x83,0x4f,0x83,0x4f,0x83,0x50,0x83,0x50,0x83,0x51,0x83,0x51,0x83,0x50,0xc0,0xac,0x64,0x4,0xc8,0x5,0xc3,0x6,0x83,0x52,0xa,0x83,0x53,0xe5,0x5b,0x83,0x44,0x83,0x47,0x83,0x31,0x83,0x32,0x83,0x54,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xe0,0x0,0xca,0x0,0xc6,0x82,0x56,0xd3,0xc6,0x83,0x4,0xd3,0xd0,0x83,0x3d,0xd3,0xe0,0x2,0xc7,0x13,0xc6,0x83,0x23,0xc6,0x83,0x3e,0xe1,0x1,0xc9,0x0,0x1,0xe0,0x0,0xca,0x0,0xc6,0x82,0x56,0xd3,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x83,0x24,0xca,0x0,0xc6,0x83,0x25,0xd0,0x83,0x43,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x83,0x2f,0xd3,0xd3,0x0,0x3,0x6d,0x75,0x6c,0x12,0x73,0x69,0x7a,0x65,0x20,0x2a,0x20,0x32,0x20,0x3d,0x3d,0x20,0x6d,0x2e,0x73,0x69,0x7a,0x65,0xc0,0xc0,0xc1,0x26,0x6,0x22,0x83,0x59,0x83,0x59,0xc0,0xc8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x83,0x5a,0xa,0x83,0x5b,0xb3,0xc3,0x83,0x29,0xc4,0xc4,0x83,0x5c,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x83,0x26,0xca,0x0,0xd3,0x0,0xc1,0x25,0xa4,0xc1,0x25,0x98,0xc1,0x25,0xc6,0xc1,0x25,0xe8,0xc1,0x26,0x36,0xc1,0x26,0x3e,0x2d,0x83,0x5e,0x83,0x5f,0x83,0x60,0x83,0x60,0x83,0x60,0x83,0x5e,0x83,0x61,0x83,0x61,0x83,0x62,0x83,0x62,0x83,0x63,0x83,0x63,0x83,0x62,0xc0,0xc4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x83,0x64,0xa,0x83,0x65,0xe5,0x3b,0xc3,0xc4,0x83,0x31,0x83,0x32,0x83,0x66,0xe0,0x1,0xc7,0x13,0xc6,0x83,0x23,0xe1,0x2,0xc7,0x2,0xc6,0x83,0x58,0xc9,0x0,0x0,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x83,0x24,0xc8,0x0,0x0,0xc6,0x83,0x25,0xd0,0x83,0x5d,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x0,0xcb,0x0,0xc6,0x83,0x2f,0xd3,0xd3,0x0,0xc1,0x1,0xc6,0xc1,0x26,0xd8,0x22,0x83,0x69,0x83,0x69,0xc0,0xce,0x64,0x4,0xc8,0x5,0xc3,0x6,0x83,0x6a,0xa,0x83,0x6b,0xb3,0xc3,0x83,0x29,0xc4,0xc4,0x83,0x6c,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x83,0x26,0xca,0x0,0xd3,0x0,0x9,0x65,0x6e,0x63,0x6f,0x64,0x65,0x4d,0x61,0x70,0x1,0x6d,0x21,0x83,0x6f,0x21,0x83,0x70,0x22,0x82,0x56,0x83,0x30,0x22,0xc1,0xc1,0xc1,0x25,0x12,0xc1,0x25,0x6,0xc1,0x25,0x32,0xc1,0x25,0x24,0xc1,0x25,0x44,0xc1,0x25,0x3c,0xc1,0x25,0x4c,0xc1,0x25,0x60,0xc1,0x25,0x70,0xc1,0x26,0x6a,0xc1,0x26,0x5e,0xc1,0x26,0xa0,0xc1,0x26,0xba,0xc1,0x27,0x0,0xc1,0x27,0x8,0xe1,0x22,0x83,0x74,0x83,0x74,0x83,0x75,0x83,0x75,0x83,0x74,0x83,0x76,0x83,0x77,0x83,0x78,0x83,0x78,0x83,0x79,0x83,0x79,0x83,0x79,0x83,0x7a,0x83,0x7a,0x83,0x78,0x83,0x76,0xc0,0x83,0x7b,0x83,0x7c,0x83,0x7c,0x83,0x7c,0xc0,0x83,0x7d,0x83,0x7e,0x83,0x7f,0x83,0x7f,0x83,0x7d,0x84,0x0,0x84,0x0,0x84,0x1,0x84,0x1,0x84,0x2,0x84,0x2,0x84,0x1,0xc0,0xbe,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0x3,0xa,0x84,0x4,0xe5,0x7f,0x83,0x6e,0x83,0x71,0x83,0x72,0x83,0x73,0x84,0x5,0xe1,0x2,0xc7,0xd,0xe0,0x0,0xca,0x0,0xc6,0x82,0x56,0xd3,0xc4,0x1,0xd3,0xd1,0x0,0xf1,0x2,0x5b,0xc7,0xa,0xe1,0x2,0xc7,0x0,0xe1,0x2,0xc7,0x14,0xcb,0x0,0xc4,0x2,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x82,0x56,0xd3,0xd3,0xc6,0x83,0x57,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xcb,0x0,0xc6,0x83,0x4,0xd3,0xd0,0x83,0x67,0xd3,0xe0,0x2,0xc7,0x13,0xc6,0x83,0x23,0xc6,0x83,0x68,0xe1,0x1,0xc9,0x0,0x1,0xcb,0x0,0xd3,0xd3,0xd1,0x1,0xf0,0x1,0x83,0x24,0xca,0x0,0xc6,0x83,0x25,0xd0,0x83,0x6d,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x0,0xcb,0x1,0xc6,0x83,0x2f,0xd3,0xd3,0x0,0x5,0x41,0x72,0x72,0x61,0x79,0x4,0x6c,0x6f,0x6f,0x70,0x4,0x63,0x6f,0x64,0x65,0x3,0x67,0x65,0x74,0x23,0xc0,0xc0,0xc0,0xc0,0xde,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x84,0xc,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0xd,0xe1,0x2,0xc7,0x9,0xc9,0x1,0x1,0xc4,0x1,0xd3,0xd9,0x1,0x1,0x0,0x3,0x65,0x6e,0x64,0x5,0x62,0x72,0x65,0x61,0x6b,0xc1,0x28,0x7c,0xc1,0x28,0xa8,0x28,0x84,0x11,0x84,0x11,0x84,0x12,0x84,0x12,0x84,0x12,0x84,0x12,0x84,0x12,0x84,0x12,0xc0,0xe2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0x13,0xa,0x84,0x14,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x84,0x15,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xc4,0x0,0xd3,0xe1,0x1,0xc7,0x17,0xe1,0x2,0xc7,0x3,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0x0,0x6,0x73,0x79,0x73,0x74,0x65,0x6d,0x4,0x64,0x61,0x74,0x61,0xc0,0xea,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x84,0x19,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x1a,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x29,0x50,0xc1,0x29,0x76,0xc1,0x29,0x9e,0xc1,0x29,0xb2,0xc1,0x29,0xca,0xc1,0x29,0xc0,0x2f,0x84,0x1c,0x84,0x1d,0x84,0x1d,0x84,0x1d,0x84,0x1c,0x84,0x1e,0x84,0x1f,0x84,0x20,0x84,0x21,0x84,0x21,0xc0,0xc0,0x84,0x20,0x84,0x1f,0x84,0x1e,0xc0,0xe8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0x22,0xa,0x84,0x23,0xe5,0x40,0xc3,0xc4,0xc4,0xc4,0x84,0x24,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x5,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x84,0x18,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x84,0x1b,0xd3,0xd3,0xd3,0xd3,0x0,0xc0,0xf0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x84,0x26,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x27,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x2a,0x72,0xc1,0x2a,0x98,0xc1,0x2a,0xc0,0xc1,0x2a,0xd4,0xc1,0x2a,0xec,0xc1,0x2a,0xe2,0x2f,0x84,0x29,0x84,0x2a,0x84,0x2a,0x84,0x2a,0x84,0x29,0x84,0x2b,0x84,0x2c,0x84,0x2d,0x84,0x2e,0x84,0x2e,0xc0,0xc0,0x84,0x2d,0x84,0x2c,0x84,0x2b,0xc0,0xee,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0x2f,0xa,0x84,0x30,0xe5,0x41,0xc3,0xc4,0xc4,0xc4,0x84,0x31,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x6,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe0,0x2,0xc8,0x1,0x0,0xc6,0x84,0x18,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x84,0x28,0xd3,0xd3,0xc0,0xd3,0xd3,0x0,0x6,0x67,0x6c,0x6f,0x62,0x61,0x6c,0xc0,0xf4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x84,0x34,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x35,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc0,0xf8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x84,0x37,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x38,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x2b,0xc8,0xc1,0x2b,0xde,0xc1,0x2b,0xd4,0xc1,0x2c,0x18,0xc1,0x2c,0x3e,0xc1,0x2c,0x66,0xc1,0x2c,0x7a,0xc1,0x2c,0x96,0xc1,0x2c,0x8c,0x37,0x84,0x3a,0x84,0x3b,0x84,0x3c,0x84,0x3c,0xc0,0xc0,0x84,0x3b,0x84,0x3a,0x84,0x3d,0x84,0x3e,0x84,0x3e,0x84,0x3e,0x84,0x3d,0x84,0x3f,0x84,0x40,0x84,0x41,0x84,0x42,0x84,0x42,0xc0,0xc0,0x84,0x41,0x84,0x40,0x84,0x3f,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0x43,0xa,0x84,0x34,0xe5,0x5d,0xc3,0xc4,0xc4,0xc4,0x84,0x44,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x84,0x36,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x7,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x84,0x33,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x84,0x39,0xd3,0xd3,0xd3,0xd3,0x0,0x4,0x62,0x69,0x6e,0x64,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x6b,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x47,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x2d,0x9a,0xc1,0x2d,0xc0,0xc1,0x2d,0xea,0xc1,0x2d,0xfe,0xc1,0x2e,0x16,0xc1,0x2e,0xc,0x2f,0x84,0x49,0x84,0x4a,0x84,0x4a,0x84,0x4a,0x84,0x49,0x84,0x4b,0x84,0x4c,0x84,0x4d,0x84,0x4e,0x84,0x4e,0xc0,0xc0,0x84,0x4d,0x84,0x4c,0x84,0x4b,0xc0,0xfc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0x4f,0xa,0x84,0x50,0xe5,0x40,0xc3,0xc4,0xc4,0xc4,0x84,0x51,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x10,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x84,0x9,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x84,0x48,0xd3,0xd3,0xd3,0xd3,0x0,0x4,0x74,0x72,0x75,0x65,0xc1,0x2e,0x72,0xc1,0x2e,0x98,0x25,0x84,0x54,0x84,0x55,0x84,0x55,0x84,0x55,0x84,0x54,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0x56,0xa,0x69,0xb9,0xc3,0xc4,0xc4,0xc4,0x84,0x57,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x0,0xd3,0xd3,0x0,0xc1,0x2e,0xe0,0xc1,0x2f,0x6,0x25,0x84,0x59,0x84,0x5a,0x84,0x5a,0x84,0x5a,0x84,0x59,0xc1,0x1,0x2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0x5b,0xa,0x84,0x5c,0xb9,0xc3,0xc4,0xc4,0xc4,0x84,0x5d,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x1,0xd3,0xd3,0x0,0x4,0x6e,0x75,0x6c,0x6c,0xc1,0x2f,0x4e,0xc1,0x2f,0x74,0x25,0x84,0x60,0x84,0x61,0x84,0x61,0x84,0x61,0x84,0x60,0xc1,0x1,0x4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0x62,0xa,0x84,0x63,0xb9,0xc3,0xc4,0xc4,0xc4,0x84,0x64,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x2,0xd3,0xd3,0x0,0x5,0x75,0x6e,0x64,0x65,0x66,0xc1,0x2f,0xbc,0xc1,0x2f,0xe2,0x25,0x84,0x67,0x84,0x68,0x84,0x68,0x84,0x68,0x84,0x67,0xc1,0x1,0x6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0x69,0xa,0x84,0x6a,0xb9,0xc3,0xc4,0xc4,0xc4,0x84,0x6b,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x3,0xd3,0xd3,0x0,0x3,0x69,0x6e,0x74,0xc1,0x1,0x8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x84,0x6e,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x6f,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x30,0x2a,0xc1,0x30,0x50,0xc1,0x30,0x62,0xc1,0x30,0x82,0xc1,0x30,0x90,0xc1,0x30,0x86,0x2f,0x84,0x71,0x84,0x72,0x84,0x72,0x84,0x72,0x84,0x71,0x84,0x73,0x84,0x74,0x84,0x75,0x84,0x76,0x84,0x76,0xc0,0xc0,0x84,0x75,0x84,0x74,0x84,0x73,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0x77,0xa,0x84,0x6e,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x84,0x78,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x4,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x84,0x70,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x65,0x6e,0x76,0x61,0x72,0x67,0xc1,0x1,0xa,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x84,0x7b,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x7c,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x7c,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x30,0xec,0xc1,0x31,0x12,0xc1,0x31,0x24,0xc1,0x31,0x44,0xc1,0x31,0x52,0xc1,0x31,0x48,0xc1,0x31,0x78,0xc1,0x31,0x98,0xc1,0x31,0xa6,0xc1,0x31,0x9c,0x39,0x84,0x7f,0x85,0x0,0x85,0x0,0x85,0x0,0x84,0x7f,0x85,0x1,0x85,0x2,0x85,0x3,0x85,0x4,0x85,0x4,0xc0,0xc0,0x85,0x3,0x85,0x2,0x85,0x1,0x85,0x5,0x85,0x6,0x85,0x7,0x85,0x8,0x85,0x8,0xc0,0xc0,0x85,0x7,0x85,0x6,0x85,0x5,0x64,0x4,0xc8,0x5,0xc3,0x6,0x85,0x9,0xa,0x84,0x7b,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x85,0xa,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x8,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x84,0x7d,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x84,0x7e,0xd3,0xd3,0xd3,0xd3,0x0,0x3,0x65,0x6e,0x76,0xc1,0x1,0xc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x85,0xd,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0xe,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0xe,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x32,0x2,0xc1,0x32,0x28,0xc1,0x32,0x3a,0xc1,0x32,0x5a,0xc1,0x32,0x68,0xc1,0x32,0x5e,0xc1,0x32,0x8e,0xc1,0x32,0xae,0xc1,0x32,0xbc,0xc1,0x32,0xb2,0x39,0x85,0x11,0x85,0x12,0x85,0x12,0x85,0x12,0x85,0x11,0x85,0x13,0x85,0x14,0x85,0x15,0x85,0x16,0x85,0x16,0xc0,0xc0,0x85,0x15,0x85,0x14,0x85,0x13,0x85,0x17,0x85,0x18,0x85,0x19,0x85,0x1a,0x85,0x1a,0xc0,0xc0,0x85,0x19,0x85,0x18,0x85,0x17,0x64,0x4,0xc8,0x5,0xc3,0x6,0x85,0x1b,0xa,0x85,0xd,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x85,0x1c,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x9,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x85,0xf,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x85,0x10,0xd3,0xd3,0xd3,0xd3,0x0,0x3,0x61,0x72,0x67,0xc1,0x1,0xe,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x85,0x1f,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x20,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x33,0x18,0xc1,0x33,0x3e,0xc1,0x33,0x52,0xc1,0x33,0x72,0xc1,0x33,0x80,0xc1,0x33,0x76,0x2f,0x85,0x22,0x85,0x23,0x85,0x23,0x85,0x23,0x85,0x22,0x85,0x24,0x85,0x25,0x85,0x26,0x85,0x27,0x85,0x27,0xc0,0xc0,0x85,0x26,0x85,0x25,0x85,0x24,0x64,0x4,0xc8,0x5,0xc3,0x6,0x85,0x28,0xa,0x85,0x1f,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x85,0x29,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xa,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x85,0x21,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x6c,0x6f,0x63,0x61,0x6c,0xc1,0x1,0x10,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x85,0x2c,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x2d,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x33,0xdc,0xc1,0x34,0x2,0xc1,0x34,0x16,0xc1,0x34,0x36,0xc1,0x34,0x44,0xc1,0x34,0x3a,0x2f,0x85,0x2f,0x85,0x30,0x85,0x30,0x85,0x30,0x85,0x2f,0x85,0x31,0x85,0x32,0x85,0x33,0x85,0x34,0x85,0x34,0xc0,0xc0,0x85,0x33,0x85,0x32,0x85,0x31,0x64,0x4,0xc8,0x5,0xc3,0x6,0x85,0x35,0xa,0x85,0x2c,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x85,0x36,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xb,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x85,0x2e,0xd3,0xd3,0xd3,0xd3,0x0,0x4,0x61,0x72,0x67,0x73,0xc1,0x34,0xa0,0xc1,0x34,0xc6,0x25,0x85,0x39,0x85,0x3a,0x85,0x3a,0x85,0x3a,0x85,0x39,0xc1,0x1,0x12,0x64,0x4,0xc8,0x5,0xc3,0x6,0x85,0x3b,0xa,0x85,0x3c,0xb9,0xc3,0xc4,0xc4,0xc4,0x85,0x3d,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xc,0xd3,0xd3,0x0,0x7,0x65,0x6e,0x76,0x61,0x72,0x67,0x73,0xc1,0x1,0x14,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x85,0x40,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x41,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x35,0x10,0xc1,0x35,0x36,0xc1,0x35,0x4a,0xc1,0x35,0x6a,0xc1,0x35,0x78,0xc1,0x35,0x6e,0x2f,0x85,0x43,0x85,0x44,0x85,0x44,0x85,0x44,0x85,0x43,0x85,0x45,0x85,0x46,0x85,0x47,0x85,0x48,0x85,0x48,0xc0,0xc0,0x85,0x47,0x85,0x46,0x85,0x45,0x64,0x4,0xc8,0x5,0xc3,0x6,0x85,0x49,0xa,0x85,0x40,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x85,0x4a,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xd,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x85,0x42,0xd3,0xd3,0xd3,0xd3,0x0,0x4,0x74,0x68,0x69,0x73,0xc1,0x35,0xd4,0xc1,0x35,0xfa,0x25,0x85,0x4d,0x85,0x4e,0x85,0x4e,0x85,0x4e,0x85,0x4d,0xc1,0x1,0x16,0x64,0x4,0xc8,0x5,0xc3,0x6,0x85,0x4f,0xa,0x85,0x50,0xb9,0xc3,0xc4,0xc4,0xc4,0x85,0x51,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xe,0xd3,0xd3,0x0,0x7,0x65,0x6e,0x76,0x74,0x68,0x69,0x73,0xc1,0x1,0x18,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x85,0x54,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x55,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x36,0x44,0xc1,0x36,0x6a,0xc1,0x36,0x7e,0xc1,0x36,0x9e,0xc1,0x36,0xac,0xc1,0x36,0xa2,0x2f,0x85,0x57,0x85,0x58,0x85,0x58,0x85,0x58,0x85,0x57,0x85,0x59,0x85,0x5a,0x85,0x5b,0x85,0x5c,0x85,0x5c,0xc0,0xc0,0x85,0x5b,0x85,0x5a,0x85,0x59,0x64,0x4,0xc8,0x5,0xc3,0x6,0x85,0x5d,0xa,0x85,0x54,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x85,0x5e,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xf,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x85,0x56,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x1c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x85,0x61,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x62,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x37,0xa,0xc1,0x37,0x30,0xc1,0x37,0x44,0xc1,0x37,0x64,0xc1,0x37,0x72,0xc1,0x37,0x68,0x2f,0x85,0x64,0x85,0x65,0x85,0x65,0x85,0x65,0x85,0x64,0x85,0x66,0x85,0x67,0x85,0x68,0x85,0x69,0x85,0x69,0xc0,0xc0,0x85,0x68,0x85,0x67,0x85,0x66,0x64,0x4,0xc8,0x5,0xc3,0x6,0x85,0x6a,0xa,0x85,0x61,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x85,0x6b,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x11,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x85,0x63,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x72,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x1e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x85,0x6e,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x6f,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x6f,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x37,0xce,0xc1,0x37,0xf4,0xc1,0x38,0x8,0xc1,0x38,0x28,0xc1,0x38,0x36,0xc1,0x38,0x2c,0xc1,0x38,0x5c,0xc1,0x38,0x7c,0xc1,0x38,0x8a,0xc1,0x38,0x80,0x39,0x85,0x72,0x85,0x73,0x85,0x73,0x85,0x73,0x85,0x72,0x85,0x74,0x85,0x75,0x85,0x76,0x85,0x77,0x85,0x77,0xc0,0xc0,0x85,0x76,0x85,0x75,0x85,0x74,0x85,0x78,0x85,0x79,0x85,0x7a,0x85,0x7b,0x85,0x7b,0xc0,0xc0,0x85,0x7a,0x85,0x79,0x85,0x78,0x64,0x4,0xc8,0x5,0xc3,0x6,0x85,0x7c,0xa,0x85,0x6e,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x85,0x7d,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x12,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x85,0x70,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x85,0x71,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x69,0x6e,0x76,0x6f,0x6b,0x65,0xc1,0x1,0x20,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x86,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x1,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x38,0xe6,0xc1,0x39,0xc,0xc1,0x39,0x24,0xc1,0x39,0x3a,0xc1,0x39,0x30,0x2d,0x86,0x3,0x86,0x4,0x86,0x4,0x86,0x4,0x86,0x3,0x86,0x5,0x86,0x6,0x86,0x7,0x86,0x7,0xc0,0xc0,0x86,0x6,0x86,0x5,0x64,0x4,0xc8,0x5,0xc3,0x6,0x86,0x8,0xa,0x86,0x0,0xe5,0x36,0xc3,0xc4,0xc4,0xc4,0x86,0x9,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x13,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x2,0xd3,0xd3,0xd3,0x0,0x4,0x63,0x65,0x72,0x72,0xc1,0x39,0x94,0xc1,0x39,0xba,0x25,0x86,0xc,0x86,0xd,0x86,0xd,0x86,0xd,0x86,0xc,0xc1,0x1,0x22,0x64,0x4,0xc8,0x5,0xc3,0x6,0x86,0xe,0xa,0x86,0xf,0xb9,0xc3,0xc4,0xc4,0xc4,0x86,0x10,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x14,0xd3,0xd3,0x0,0x4,0x76,0x67,0x65,0x74,0xc1,0x1,0x26,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x86,0x13,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x14,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3a,0x8,0xc1,0x3a,0x2e,0xc1,0x3a,0x42,0xc1,0x3a,0x62,0xc1,0x3a,0x70,0xc1,0x3a,0x66,0x2f,0x86,0x16,0x86,0x17,0x86,0x17,0x86,0x17,0x86,0x16,0x86,0x18,0x86,0x19,0x86,0x1a,0x86,0x1b,0x86,0x1b,0xc0,0xc0,0x86,0x1a,0x86,0x19,0x86,0x18,0x64,0x4,0xc8,0x5,0xc3,0x6,0x86,0x1c,0xa,0x86,0x13,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x86,0x1d,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x15,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x15,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x76,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x28,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x86,0x20,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x21,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3a,0xce,0xc1,0x3a,0xf4,0xc1,0x3b,0x8,0xc1,0x3b,0x28,0xc1,0x3b,0x36,0xc1,0x3b,0x2c,0x2f,0x86,0x23,0x86,0x24,0x86,0x24,0x86,0x24,0x86,0x23,0x86,0x25,0x86,0x26,0x86,0x27,0x86,0x28,0x86,0x28,0xc0,0xc0,0x86,0x27,0x86,0x26,0x86,0x25,0x64,0x4,0xc8,0x5,0xc3,0x6,0x86,0x29,0xa,0x86,0x20,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x86,0x2a,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x16,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x22,0xd3,0xd3,0xd3,0xd3,0x0,0x7,0x76,0x72,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x2a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x86,0x2d,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x2e,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x2e,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3b,0x94,0xc1,0x3b,0xba,0xc1,0x3b,0xce,0xc1,0x3b,0xee,0xc1,0x3b,0xfc,0xc1,0x3b,0xf2,0xc1,0x3c,0x22,0xc1,0x3c,0x42,0xc1,0x3c,0x50,0xc1,0x3c,0x46,0x39,0x86,0x31,0x86,0x32,0x86,0x32,0x86,0x32,0x86,0x31,0x86,0x33,0x86,0x34,0x86,0x35,0x86,0x36,0x86,0x36,0xc0,0xc0,0x86,0x35,0x86,0x34,0x86,0x33,0x86,0x37,0x86,0x38,0x86,0x39,0x86,0x3a,0x86,0x3a,0xc0,0xc0,0x86,0x39,0x86,0x38,0x86,0x37,0x64,0x4,0xc8,0x5,0xc3,0x6,0x86,0x3b,0xa,0x86,0x2d,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x86,0x3c,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x17,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x2f,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x30,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x65,0x76,0x67,0x65,0x74,0xc1,0x1,0x2c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x86,0x3f,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x40,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x40,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3c,0xae,0xc1,0x3c,0xd4,0xc1,0x3c,0xe8,0xc1,0x3d,0x8,0xc1,0x3d,0x16,0xc1,0x3d,0xc,0xc1,0x3d,0x3c,0xc1,0x3d,0x5c,0xc1,0x3d,0x6a,0xc1,0x3d,0x60,0x39,0x86,0x43,0x86,0x44,0x86,0x44,0x86,0x44,0x86,0x43,0x86,0x45,0x86,0x46,0x86,0x47,0x86,0x48,0x86,0x48,0xc0,0xc0,0x86,0x47,0x86,0x46,0x86,0x45,0x86,0x49,0x86,0x4a,0x86,0x4b,0x86,0x4c,0x86,0x4c,0xc0,0xc0,0x86,0x4b,0x86,0x4a,0x86,0x49,0x64,0x4,0xc8,0x5,0xc3,0x6,0x86,0x4d,0xa,0x86,0x3f,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x86,0x4e,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x18,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x41,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x42,0xd3,0xd3,0xd3,0xd3,0x0,0x7,0x65,0x76,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x2e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x86,0x51,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x52,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x52,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3d,0xc8,0xc1,0x3d,0xee,0xc1,0x3e,0x2,0xc1,0x3e,0x22,0xc1,0x3e,0x30,0xc1,0x3e,0x26,0xc1,0x3e,0x56,0xc1,0x3e,0x76,0xc1,0x3e,0x84,0xc1,0x3e,0x7a,0x39,0x86,0x55,0x86,0x56,0x86,0x56,0x86,0x56,0x86,0x55,0x86,0x57,0x86,0x58,0x86,0x59,0x86,0x5a,0x86,0x5a,0xc0,0xc0,0x86,0x59,0x86,0x58,0x86,0x57,0x86,0x5b,0x86,0x5c,0x86,0x5d,0x86,0x5e,0x86,0x5e,0xc0,0xc0,0x86,0x5d,0x86,0x5c,0x86,0x5b,0x64,0x4,0xc8,0x5,0xc3,0x6,0x86,0x5f,0xa,0x86,0x51,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x86,0x60,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x19,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x53,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x54,0xd3,0xd3,0xd3,0xd3,0x0,0x8,0x65,0x76,0x72,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x30,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x86,0x63,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x64,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x64,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x64,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3e,0xe2,0xc1,0x3f,0x8,0xc1,0x3f,0x1c,0xc1,0x3f,0x3c,0xc1,0x3f,0x4a,0xc1,0x3f,0x40,0xc1,0x3f,0x70,0xc1,0x3f,0x90,0xc1,0x3f,0x9e,0xc1,0x3f,0x94,0xc1,0x3f,0xc4,0xc1,0x3f,0xe4,0xc1,0x3f,0xf2,0xc1,0x3f,0xe8,0xe1,0x23,0x86,0x68,0x86,0x69,0x86,0x69,0x86,0x69,0x86,0x68,0x86,0x6a,0x86,0x6b,0x86,0x6c,0x86,0x6d,0x86,0x6d,0xc0,0xc0,0x86,0x6c,0x86,0x6b,0x86,0x6a,0x86,0x6e,0x86,0x6f,0x86,0x70,0x86,0x71,0x86,0x71,0xc0,0xc0,0x86,0x70,0x86,0x6f,0x86,0x6e,0x86,0x72,0x86,0x73,0x86,0x74,0x86,0x75,0x86,0x75,0xc0,0xc0,0x86,0x74,0x86,0x73,0x86,0x72,0x64,0x4,0xc8,0x5,0xc3,0x6,0x86,0x76,0xa,0x86,0x63,0xe5,0x81,0x5,0xc3,0xc4,0xc4,0xc4,0x86,0x77,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x1a,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x65,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x66,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x67,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x6d,0x63,0x61,0x6c,0x6c,0xc1,0x1,0x34,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x86,0x7a,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x7b,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x7b,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x40,0x54,0xc1,0x40,0x6a,0xc1,0x40,0x60,0xc1,0x40,0x8e,0xc1,0x40,0xb4,0xc1,0x40,0xc6,0xc1,0x40,0xe6,0xc1,0x40,0xf4,0xc1,0x40,0xea,0x37,0x86,0x7e,0x86,0x7f,0x87,0x0,0x87,0x0,0xc0,0xc0,0x86,0x7f,0x86,0x7e,0x87,0x1,0x87,0x2,0x87,0x2,0x87,0x2,0x87,0x1,0x87,0x3,0x87,0x4,0x87,0x5,0x87,0x6,0x87,0x6,0xc0,0xc0,0x87,0x5,0x87,0x4,0x87,0x3,0x64,0x4,0xc8,0x5,0xc3,0x6,0x87,0x7,0xa,0x86,0x7a,0xe5,0x5b,0xc3,0xc4,0xc4,0xc4,0x87,0x8,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x7c,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x83,0xe,0xc4,0x0,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x86,0x7d,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x6d,0x63,0x61,0x6c,0x6c,0x73,0xc1,0x1,0x36,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x87,0xb,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0xc,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x1,0xd0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0xc,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x41,0x54,0xc1,0x41,0x6a,0xc1,0x41,0x60,0xc1,0x41,0x8e,0xc1,0x41,0xb4,0xc1,0x41,0xc6,0xc1,0x41,0xe6,0xc1,0x41,0xf4,0xc1,0x41,0xea,0x37,0x87,0x10,0x87,0x11,0x87,0x12,0x87,0x12,0xc0,0xc0,0x87,0x11,0x87,0x10,0x87,0x13,0x87,0x14,0x87,0x14,0x87,0x14,0x87,0x13,0x87,0x15,0x87,0x16,0x87,0x17,0x87,0x18,0x87,0x18,0xc0,0xc0,0x87,0x17,0x87,0x16,0x87,0x15,0x64,0x4,0xc8,0x5,0xc3,0x6,0x87,0x19,0xa,0x87,0xb,0xe5,0x5b,0xc3,0xc4,0xc4,0xc4,0x87,0x1a,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0xd,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x87,0xe,0xc4,0x0,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0xf,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x66,0x63,0x61,0x6c,0x6c,0xc1,0x1,0x38,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x87,0x1d,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x1e,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x1e,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x42,0x54,0xc1,0x42,0x6a,0xc1,0x42,0x60,0xc1,0x42,0x8e,0xc1,0x42,0xb4,0xc1,0x42,0xc6,0xc1,0x42,0xe6,0xc1,0x42,0xf4,0xc1,0x42,0xea,0x37,0x87,0x21,0x87,0x22,0x87,0x23,0x87,0x23,0xc0,0xc0,0x87,0x22,0x87,0x21,0x87,0x24,0x87,0x25,0x87,0x25,0x87,0x25,0x87,0x24,0x87,0x26,0x87,0x27,0x87,0x28,0x87,0x29,0x87,0x29,0xc0,0xc0,0x87,0x28,0x87,0x27,0x87,0x26,0x64,0x4,0xc8,0x5,0xc3,0x6,0x87,0x2a,0xa,0x87,0x1d,0xe5,0x5b,0xc3,0xc4,0xc4,0xc4,0x87,0x2b,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x1f,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x83,0xe,0xc4,0x1,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x20,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x62,0x63,0x61,0x6c,0x6c,0xc1,0x1,0x3a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x87,0x2e,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x2f,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x2f,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x43,0x54,0xc1,0x43,0x6a,0xc1,0x43,0x60,0xc1,0x43,0x8e,0xc1,0x43,0xb4,0xc1,0x43,0xc6,0xc1,0x43,0xe6,0xc1,0x43,0xf4,0xc1,0x43,0xea,0x37,0x87,0x32,0x87,0x33,0x87,0x34,0x87,0x34,0xc0,0xc0,0x87,0x33,0x87,0x32,0x87,0x35,0x87,0x36,0x87,0x36,0x87,0x36,0x87,0x35,0x87,0x37,0x87,0x38,0x87,0x39,0x87,0x3a,0x87,0x3a,0xc0,0xc0,0x87,0x39,0x87,0x38,0x87,0x37,0x64,0x4,0xc8,0x5,0xc3,0x6,0x87,0x3b,0xa,0x87,0x2e,0xe5,0x5b,0xc3,0xc4,0xc4,0xc4,0x87,0x3c,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x30,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x83,0xe,0xc4,0x2,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x31,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x63,0x63,0x61,0x6c,0x6c,0xc1,0x1,0x3c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x87,0x3f,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x40,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x40,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x44,0x54,0xc1,0x44,0x6a,0xc1,0x44,0x60,0xc1,0x44,0x8e,0xc1,0x44,0xb4,0xc1,0x44,0xc6,0xc1,0x44,0xe6,0xc1,0x44,0xf4,0xc1,0x44,0xea,0x37,0x87,0x43,0x87,0x44,0x87,0x45,0x87,0x45,0xc0,0xc0,0x87,0x44,0x87,0x43,0x87,0x46,0x87,0x47,0x87,0x47,0x87,0x47,0x87,0x46,0x87,0x48,0x87,0x49,0x87,0x4a,0x87,0x4b,0x87,0x4b,0xc0,0xc0,0x87,0x4a,0x87,0x49,0x87,0x48,0x64,0x4,0xc8,0x5,0xc3,0x6,0x87,0x4c,0xa,0x87,0x3f,0xe5,0x5b,0xc3,0xc4,0xc4,0xc4,0x87,0x4d,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x41,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x83,0xe,0xc4,0x3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x42,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x6d,0x63,0x61,0x6c,0x6c,0x6e,0xc1,0x1,0x3e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x87,0x50,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x51,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x1,0xe0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x51,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x51,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0x2,0x6e,0x73,0xc1,0x45,0x54,0xc1,0x45,0x6a,0xc1,0x45,0x60,0xc1,0x45,0x8e,0xc1,0x45,0xb4,0xc1,0x45,0xc6,0xc1,0x45,0xe6,0xc1,0x45,0xf4,0xc1,0x45,0xea,0xc1,0x46,0x1a,0xc1,0x46,0x2e,0xc1,0x46,0x5e,0xc1,0x46,0x46,0xc1,0x46,0x3c,0xe1,0x23,0x87,0x57,0x87,0x58,0x87,0x59,0x87,0x59,0xc0,0xc0,0x87,0x58,0x87,0x57,0x87,0x5a,0x87,0x5b,0x87,0x5b,0x87,0x5b,0x87,0x5a,0x87,0x5c,0x87,0x5d,0x87,0x5e,0x87,0x5f,0x87,0x5f,0xc0,0xc0,0x87,0x5e,0x87,0x5d,0x87,0x5c,0x87,0x60,0x87,0x61,0x87,0x62,0x87,0x63,0x87,0x64,0x87,0x64,0xc0,0xc0,0x87,0x63,0x87,0x62,0x87,0x61,0x87,0x60,0x64,0x4,0xc8,0x5,0xc3,0x6,0x87,0x65,0xa,0x87,0x50,0xe5,0x81,0x8,0xc3,0xc4,0xc4,0xc4,0x87,0x66,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x52,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x87,0x53,0xc4,0x0,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x54,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x84,0x18,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x55,0xd3,0xd3,0xc6,0x87,0x56,0xd3,0xd3,0xd3,0x0,0x7,0x6d,0x63,0x61,0x6c,0x6c,0x6e,0x73,0xc1,0x1,0x40,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x87,0x69,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x6a,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x1,0xf0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x6a,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x6a,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x46,0xac,0xc1,0x46,0xc2,0xc1,0x46,0xb8,0xc1,0x46,0xe6,0xc1,0x47,0xc,0xc1,0x47,0x1e,0xc1,0x47,0x3e,0xc1,0x47,0x4c,0xc1,0x47,0x42,0xc1,0x47,0x72,0xc1,0x47,0x86,0xc1,0x47,0xb6,0xc1,0x47,0x9e,0xc1,0x47,0x94,0xe1,0x23,0x87,0x6f,0x87,0x70,0x87,0x71,0x87,0x71,0xc0,0xc0,0x87,0x70,0x87,0x6f,0x87,0x72,0x87,0x73,0x87,0x73,0x87,0x73,0x87,0x72,0x87,0x74,0x87,0x75,0x87,0x76,0x87,0x77,0x87,0x77,0xc0,0xc0,0x87,0x76,0x87,0x75,0x87,0x74,0x87,0x78,0x87,0x79,0x87,0x7a,0x87,0x7b,0x87,0x7c,0x87,0x7c,0xc0,0xc0,0x87,0x7b,0x87,0x7a,0x87,0x79,0x87,0x78,0x64,0x4,0xc8,0x5,0xc3,0x6,0x87,0x7d,0xa,0x87,0x69,0xe5,0x81,0x8,0xc3,0xc4,0xc4,0xc4,0x87,0x7e,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x6b,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x87,0x6c,0xc4,0x0,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x6d,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x84,0x18,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x87,0x6e,0xd3,0xd3,0xc6,0x87,0x56,0xd3,0xd3,0xd3,0x0,0x6,0x66,0x63,0x61,0x6c,0x6c,0x6e,0xc1,0x1,0x42,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x88,0x1,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x2,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x2,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x2,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x48,0x4,0xc1,0x48,0x1a,0xc1,0x48,0x10,0xc1,0x48,0x3e,0xc1,0x48,0x64,0xc1,0x48,0x76,0xc1,0x48,0x96,0xc1,0x48,0xa4,0xc1,0x48,0x9a,0xc1,0x48,0xca,0xc1,0x48,0xde,0xc1,0x49,0xe,0xc1,0x48,0xf6,0xc1,0x48,0xec,0xe1,0x23,0x88,0x6,0x88,0x7,0x88,0x8,0x88,0x8,0xc0,0xc0,0x88,0x7,0x88,0x6,0x88,0x9,0x88,0xa,0x88,0xa,0x88,0xa,0x88,0x9,0x88,0xb,0x88,0xc,0x88,0xd,0x88,0xe,0x88,0xe,0xc0,0xc0,0x88,0xd,0x88,0xc,0x88,0xb,0x88,0xf,0x88,0x10,0x88,0x11,0x88,0x12,0x88,0x13,0x88,0x13,0xc0,0xc0,0x88,0x12,0x88,0x11,0x88,0x10,0x88,0xf,0x64,0x4,0xc8,0x5,0xc3,0x6,0x88,0x14,0xa,0x88,0x1,0xe5,0x81,0x8,0xc3,0xc4,0xc4,0xc4,0x88,0x15,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x88,0x3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x87,0x53,0xc4,0x1,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x88,0x4,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x84,0x18,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x88,0x5,0xd3,0xd3,0xc6,0x87,0x56,0xd3,0xd3,0xd3,0x0,0x6,0x62,0x63,0x61,0x6c,0x6c,0x6e,0xc1,0x1,0x44,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x88,0x18,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x19,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x19,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x19,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x49,0x5c,0xc1,0x49,0x72,0xc1,0x49,0x68,0xc1,0x49,0x96,0xc1,0x49,0xbc,0xc1,0x49,0xce,0xc1,0x49,0xee,0xc1,0x49,0xfc,0xc1,0x49,0xf2,0xc1,0x4a,0x22,0xc1,0x4a,0x36,0xc1,0x4a,0x66,0xc1,0x4a,0x4e,0xc1,0x4a,0x44,0xe1,0x23,0x88,0x1d,0x88,0x1e,0x88,0x1f,0x88,0x1f,0xc0,0xc0,0x88,0x1e,0x88,0x1d,0x88,0x20,0x88,0x21,0x88,0x21,0x88,0x21,0x88,0x20,0x88,0x22,0x88,0x23,0x88,0x24,0x88,0x25,0x88,0x25,0xc0,0xc0,0x88,0x24,0x88,0x23,0x88,0x22,0x88,0x26,0x88,0x27,0x88,0x28,0x88,0x29,0x88,0x2a,0x88,0x2a,0xc0,0xc0,0x88,0x29,0x88,0x28,0x88,0x27,0x88,0x26,0x64,0x4,0xc8,0x5,0xc3,0x6,0x88,0x2b,0xa,0x88,0x18,0xe5,0x81,0x8,0xc3,0xc4,0xc4,0xc4,0x88,0x2c,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x88,0x1a,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xc6,0x87,0x53,0xc4,0x2,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x88,0x1b,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x26,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x84,0x18,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x88,0x1c,0xd3,0xd3,0xc6,0x87,0x56,0xd3,0xd3,0xd3,0x0,0x5,0x74,0x68,0x72,0x6f,0x77,0xb,0x5f,0x53,0x74,0x72,0x69,0x6e,0x67,0x5f,0x63,0x61,0x74,0xc,0x75,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x6f,0x70,0x3a,0x20,0x1,0x20,0x4,0x72,0x65,0x70,0x72,0xc1,0x4a,0xe6,0xc1,0x4a,0xde,0x23,0x88,0x33,0x88,0x34,0x88,0x33,0xc1,0x1,0x48,0x64,0x4,0xc8,0x5,0xc3,0x6,0x88,0x35,0xa,0x88,0x36,0xaf,0xc3,0xc4,0xc4,0xc4,0x88,0x37,0xe1,0x1,0xc7,0x1a,0xc9,0x1,0x0,0xd3,0x0,0xc1,0x4a,0xb6,0xc1,0x4a,0xac,0x28,0x88,0x39,0x88,0x3a,0xc0,0xc0,0xc0,0xc0,0xc0,0x88,0x39,0x64,0x4,0xc8,0x5,0xc3,0x6,0x88,0x3b,0xa,0x88,0x36,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x88,0x3c,0xe1,0x1,0xc7,0x18,0xe1,0x4,0xc7,0x19,0xc6,0x88,0x30,0xc9,0x0,0x0,0xc6,0x88,0x31,0xe1,0x0,0xd0,0x88,0x38,0xd3,0xd3,0xd3,0x0,0x2,0x6f,0x70,0x21,0x88,0x3e,0xc1,0x28,0x0,0xc1,0x27,0xf6,0xc1,0x28,0x34,0xc1,0x28,0xce,0xc1,0x2a,0x2,0xc1,0x2b,0x30,0xc1,0x2c,0xce,0xc1,0x2e,0x4e,0xc1,0x2e,0xbc,0xc1,0x2f,0x2a,0xc1,0x2f,0x98,0xc1,0x30,0x6,0xc1,0x30,0xc8,0xc1,0x31,0xde,0xc1,0x32,0xf4,0xc1,0x33,0xb8,0xc1,0x34,0x7c,0xc1,0x34,0xec,0xc1,0x35,0xb0,0xc1,0x36,0x20,0xc1,0x36,0xe6,0xc1,0x37,0xaa,0xc1,0x38,0xc2,0xc1,0x39,0x70,0xc1,0x39,0xe2,0xc1,0x3a,0xa8,0xc1,0x3b,0x6e,0xc1,0x3c,0x88,0xc1,0x3d,0xa2,0xc1,0x3e,0xbc,0xc1,0x40,0x2c,0xc1,0x41,0x2c,0xc1,0x42,0x2c,0xc1,0x43,0x2c,0xc1,0x44,0x2c,0xc1,0x45,0x2c,0xc1,0x46,0x84,0xc1,0x47,0xdc,0xc1,0x49,0x34,0xe1,0x81,0x41,0x88,0x40,0x88,0x41,0x88,0x41,0xc0,0xc0,0x88,0x40,0x88,0x42,0x88,0x42,0x88,0x42,0xc0,0xc0,0x88,0x43,0x88,0x43,0x88,0x43,0xc0,0xc0,0x88,0x44,0x88,0x44,0x88,0x44,0xc0,0xc0,0x88,0x45,0x88,0x45,0x88,0x45,0xc0,0xc0,0x88,0x46,0x88,0x46,0x88,0x46,0xc0,0xc0,0x88,0x47,0x88,0x47,0x88,0x47,0xc0,0xc0,0x88,0x48,0x88,0x48,0x88,0x48,0xc0,0xc0,0x88,0x49,0x88,0x49,0x88,0x49,0xc0,0xc0,0x88,0x4a,0x88,0x4a,0x88,0x4a,0xc0,0xc0,0x88,0x4b,0x88,0x4b,0x88,0x4b,0xc0,0xc0,0x88,0x4c,0x88,0x4c,0x88,0x4c,0xc0,0xc0,0x88,0x4d,0x88,0x4d,0x88,0x4d,0xc0,0xc0,0x88,0x4e,0x88,0x4e,0x88,0x4e,0xc0,0xc0,0x88,0x4f,0x88,0x4f,0x88,0x4f,0xc0,0xc0,0x88,0x50,0x88,0x50,0x88,0x50,0xc0,0xc0,0x88,0x51,0x88,0x51,0x88,0x51,0xc0,0xc0,0x88,0x52,0x88,0x52,0x88,0x52,0xc0,0xc0,0x88,0x53,0x88,0x53,0x88,0x53,0xc0,0xc0,0x88,0x54,0x88,0x54,0x88,0x54,0xc0,0xc0,0x88,0x55,0x88,0x55,0x88,0x55,0xc0,0xc0,0x88,0x56,0x88,0x56,0x88,0x56,0xc0,0xc0,0x88,0x57,0x88,0x57,0x88,0x57,0xc0,0xc0,0x88,0x58,0x88,0x58,0x88,0x58,0xc0,0xc0,0x88,0x59,0x88,0x59,0x88,0x59,0xc0,0xc0,0x88,0x5a,0x88,0x5a,0x88,0x5a,0xc0,0xc0,0x88,0x5b,0x88,0x5b,0x88,0x5b,0xc0,0xc0,0x88,0x5c,0x88,0x5c,0x88,0x5c,0xc0,0xc0,0x88,0x5d,0x88,0x5d,0x88,0x5d,0xc0,0xc0,0x88,0x5e,0x88,0x5e,0x88,0x5e,0xc0,0xc0,0x88,0x5f,0x88,0x5f,0x88,0x5f,0xc0,0xc0,0x88,0x60,0x88,0x60,0x88,0x60,0xc0,0xc0,0x88,0x61,0x88,0x61,0x88,0x61,0xc0,0xc0,0x88,0x62,0x88,0x62,0x88,0x62,0xc0,0xc0,0x88,0x63,0x88,0x63,0x88,0x63,0xc0,0xc0,0x88,0x64,0x88,0x64,0x88,0x64,0xc0,0xc0,0x88,0x65,0x88,0x65,0x88,0x65,0xc0,0xc0,0x88,0x66,0x88,0x66,0x88,0x66,0xc0,0xc0,0xc0,0xc0,0xc0,0xdc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x88,0x67,0xa,0x88,0x68,0xe5,0x84,0x78,0xc3,0xc4,0x88,0x3f,0x83,0x32,0x88,0x69,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x84,0x9,0xd3,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x84,0xe,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0xf,0xd3,0xe3,0x0,0xd0,0x84,0x16,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x17,0xd3,0xe3,0x0,0xd0,0x84,0x25,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x18,0xd3,0xe3,0x0,0xd0,0x84,0x32,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x33,0xd3,0xe3,0x0,0xd0,0x84,0x45,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x46,0xd3,0xe3,0x0,0xd0,0x84,0x52,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x53,0xd3,0xe3,0x0,0xd0,0x84,0x58,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x81,0x24,0xd3,0xe3,0x0,0xd0,0x84,0x5e,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x5f,0xd3,0xe3,0x0,0xd0,0x84,0x65,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x66,0xd3,0xe3,0x0,0xd0,0x84,0x6c,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x6d,0xd3,0xe3,0x0,0xd0,0x84,0x79,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x7a,0xd3,0xe3,0x0,0xd0,0x85,0xb,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0xc,0xd3,0xe3,0x0,0xd0,0x85,0x1d,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x1e,0xd3,0xe3,0x0,0xd0,0x85,0x2a,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x2b,0xd3,0xe3,0x0,0xd0,0x85,0x37,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x38,0xd3,0xe3,0x0,0xd0,0x85,0x3e,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x3f,0xd3,0xe3,0x0,0xd0,0x85,0x4b,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x4c,0xd3,0xe3,0x0,0xd0,0x85,0x52,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x53,0xd3,0xe3,0x0,0xd0,0x85,0x5f,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x60,0xd3,0xe3,0x0,0xd0,0x85,0x6c,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x6d,0xd3,0xe3,0x0,0xd0,0x85,0x7e,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x7f,0xd3,0xe3,0x0,0xd0,0x86,0xa,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0xb,0xd3,0xe3,0x0,0xd0,0x86,0x11,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x12,0xd3,0xe3,0x0,0xd0,0x86,0x1e,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x1f,0xd3,0xe3,0x0,0xd0,0x86,0x2b,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x2c,0xd3,0xe3,0x0,0xd0,0x86,0x3d,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x3e,0xd3,0xe3,0x0,0xd0,0x86,0x4f,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x50,0xd3,0xe3,0x0,0xd0,0x86,0x61,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x62,0xd3,0xe3,0x0,0xd0,0x86,0x78,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x79,0xd3,0xe3,0x0,0xd0,0x87,0x9,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0xa,0xd3,0xe3,0x0,0xd0,0x87,0x1b,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x1c,0xd3,0xe3,0x0,0xd0,0x87,0x2c,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x2d,0xd3,0xe3,0x0,0xd0,0x87,0x3d,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x3e,0xd3,0xe3,0x0,0xd0,0x87,0x4e,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x4f,0xd3,0xe3,0x0,0xd0,0x87,0x67,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x68,0xd3,0xe3,0x0,0xd0,0x87,0x7f,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x88,0x0,0xd3,0xe3,0x0,0xd0,0x88,0x16,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x88,0x17,0xd3,0xe3,0x0,0xd0,0x88,0x2d,0xd3,0xc0,0xe3,0x0,0xd0,0x88,0x3d,0xd3,0xd4,0x0,0x4,0x6e,0x61,0x6d,0x65,0x8,0x61,0x72,0x67,0x73,0x70,0x65,0x63,0x73,0x6,0x6c,0x6f,0x63,0x61,0x6c,0x73,0x9,0x6c,0x6f,0x63,0x61,0x6c,0x76,0x61,0x72,0x73,0xc1,0x4c,0xd8,0xc1,0x4c,0xec,0xc1,0x4d,0x2,0x26,0x88,0x6f,0x88,0x70,0x88,0x71,0x88,0x71,0x88,0x70,0x88,0x6f,0xc1,0x1,0x56,0x64,0x4,0xc8,0x5,0xc3,0x6,0x88,0x72,0xa,0x88,0x73,0xe5,0x22,0xc3,0xc4,0xc4,0xc4,0x88,0x74,0xe0,0x1,0xc9,0x0,0x3,0xc6,0x83,0x26,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x84,0x18,0xe8,0x0,0xc8,0x0,0x2,0xc6,0x88,0x6e,0xd3,0xd3,0xd3,0x0,0xc1,0x4d,0xae,0xc1,0x4d,0xc2,0x24,0x88,0x76,0x88,0x77,0x88,0x77,0x88,0x76,0xc1,0x1,0x5a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x88,0x78,0xa,0x88,0x79,0xba,0xc3,0xc4,0xc4,0xc4,0x88,0x7a,0xe0,0x1,0xc9,0x0,0x3,0xc6,0x83,0x26,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x84,0x18,0xc2,0xd3,0xd3,0x0,0x6,0x4f,0x62,0x6a,0x65,0x63,0x74,0x3,0x73,0x65,0x74,0x2,0x6f,0x72,0x9,0x64,0x65,0x62,0x75,0x67,0x69,0x6e,0x66,0x6f,0x61,0x6,0xc0,0x6,0x74,0x6f,0x4c,0x69,0x73,0x74,0xc1,0x4e,0xfa,0xc1,0x4f,0x2,0xc1,0x4e,0xfc,0xc1,0x4f,0x1c,0xc1,0x4f,0x36,0xc1,0x4f,0x2a,0xc1,0x4f,0x40,0x30,0x89,0x2,0x89,0x2,0x89,0x3,0x89,0x4,0x89,0x5,0x89,0x5,0x89,0x6,0x89,0x6,0x89,0x7,0x89,0x7,0x89,0x8,0x89,0x8,0x89,0x6,0x89,0x5,0x89,0x3,0x89,0x2,0xc1,0x1,0x62,0x64,0x4,0xc8,0x5,0xc3,0x6,0x89,0x9,0xa,0x89,0xa,0xe5,0x38,0xc3,0xc4,0xc4,0xc4,0x89,0xb,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x3,0xc7,0xf,0xe1,0x2,0xc7,0x2,0xc6,0x87,0x69,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xc9,0x0,0x3,0xc6,0x82,0x56,0xd3,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x82,0x56,0xd3,0xd3,0xd3,0xc9,0x0,0x3,0xc9,0x0,0x0,0xd3,0xd3,0x0,0xc1,0x1,0xca,0x9,0x77,0x72,0x69,0x74,0x65,0x43,0x6f,0x64,0x65,0x3,0x6d,0x6f,0x64,0x21,0x89,0xf,0x1,0x63,0x21,0x89,0x11,0x5,0x73,0x63,0x6f,0x70,0x65,0x21,0x89,0x13,0x23,0x89,0x10,0x89,0x12,0x89,0x14,0x3,0x24,0x70,0x63,0x5,0x63,0x61,0x6c,0x6c,0x73,0x4,0x68,0x65,0x61,0x64,0x25,0x83,0x30,0x89,0x16,0x89,0x17,0x89,0x18,0x88,0x7f,0x25,0xc1,0xc2,0xc1,0xc1,0xc1,0xc1,0x27,0x70,0xc1,0x27,0x64,0xc1,0x27,0xbc,0xc1,0x27,0xb2,0xc1,0x27,0xce,0xc1,0x4b,0x18,0xc1,0x4b,0xc,0xc1,0x4b,0x32,0xc1,0x4b,0x46,0xc1,0x4b,0x54,0xc1,0x4b,0x74,0xc1,0x4b,0x88,0xc1,0x4b,0x96,0xc1,0x4c,0x6c,0xc1,0x4c,0x80,0xc1,0x4c,0x8e,0xc1,0x4e,0x8,0xc1,0x4d,0xfc,0xc1,0x4e,0x2a,0xc1,0x4e,0x14,0xc1,0x4e,0x4c,0xc1,0x4e,0x70,0xc1,0x4e,0x84,0xc1,0x4e,0xb2,0xc1,0x4e,0xe2,0xc1,0x4e,0xcc,0xc1,0x4e,0xc0,0xc1,0x4e,0xd6,0xc1,0x4f,0x7a,0xc1,0x4f,0x82,0xc1,0x4f,0x7c,0xc1,0x4f,0xb0,0xc1,0x4f,0xc6,0xc1,0x4f,0xba,0xc1,0x4f,0xd0,0xe1,0x52,0x89,0x1b,0x89,0x1c,0x89,0x1b,0x89,0x1d,0x89,0x1e,0x89,0x1d,0x89,0x1f,0x89,0x1f,0x89,0x1f,0x89,0x20,0x89,0x21,0x89,0x20,0x89,0x22,0x89,0x23,0x89,0x24,0x89,0x24,0x89,0x23,0x89,0x22,0x89,0x25,0x89,0x26,0x89,0x27,0x89,0x27,0x89,0x26,0x89,0x25,0x89,0x28,0x89,0x29,0x89,0x2a,0x89,0x2a,0x89,0x29,0x89,0x28,0xc0,0xc0,0xc0,0xc0,0x89,0x2b,0x89,0x2c,0x89,0x2d,0x89,0x2d,0x89,0x2e,0x89,0x2e,0xc0,0xc0,0xc0,0x89,0x2d,0xc0,0xc0,0x89,0x2f,0x89,0x2f,0xc0,0x89,0x2b,0x89,0x30,0x89,0x31,0x89,0x31,0x89,0x30,0xc0,0x89,0x32,0x89,0x33,0x89,0x33,0x89,0x34,0x89,0x34,0x89,0x35,0x89,0x35,0x89,0x36,0x89,0x36,0x89,0x34,0x89,0x33,0xc0,0x89,0x37,0x89,0x37,0x89,0x38,0x89,0x39,0x89,0x3a,0x89,0x3b,0x89,0x3b,0x89,0x3c,0x89,0x3c,0x89,0x3d,0x89,0x3d,0x89,0x3b,0x89,0x3a,0x89,0x38,0x89,0x37,0xc0,0xd4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x89,0x3e,0xa,0x89,0x3f,0xe5,0x82,0x25,0x89,0xe,0x89,0x15,0x89,0x19,0x89,0x1a,0x89,0x40,0xe0,0x0,0xc7,0x13,0xc6,0x83,0x23,0xd3,0xd1,0x0,0xc4,0x0,0xd6,0x1,0xe0,0x0,0xc7,0x15,0xc6,0x83,0x23,0xd3,0xd1,0x2,0xf1,0x1,0x83,0x24,0xc7,0x16,0xd0,0x88,0x6a,0xd3,0xe0,0x0,0xc7,0x13,0xc6,0x83,0x23,0xd3,0xd1,0x3,0xe0,0x1,0xcb,0x3,0xc6,0x83,0x26,0xe0,0x1,0xca,0x0,0xc6,0x84,0x18,0xe0,0x0,0xca,0x1,0xc6,0x88,0x6b,0xd3,0xd3,0xd3,0xe0,0x1,0xcb,0x3,0xc6,0x83,0x26,0xe0,0x1,0xca,0x0,0xc6,0x84,0x18,0xe0,0x0,0xca,0x1,0xc6,0x88,0x6c,0xd3,0xd3,0xd3,0xe0,0x1,0xcb,0x3,0xc6,0x83,0x26,0xe0,0x1,0xca,0x0,0xc6,0x84,0x18,0xe0,0x0,0xca,0x1,0xc6,0x88,0x6d,0xd3,0xd3,0xd3,0xca,0x2,0xe3,0x0,0xd0,0x88,0x75,0xd3,0xc0,0xe3,0x0,0xd0,0x88,0x7b,0xd3,0xd4,0xe0,0x2,0xc7,0x1b,0xc6,0x88,0x7d,0xe1,0x2,0xc7,0x1c,0xe0,0x0,0xca,0x1,0xc6,0x88,0x7f,0xd3,0xe1,0x1,0xc7,0x4,0xc6,0x24,0xd3,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x89,0x0,0xc6,0x6,0xe0,0x0,0xcb,0x2,0xc6,0x89,0x1,0xd3,0xd3,0xd3,0xd1,0x4,0xe0,0x1,0xcb,0x3,0xc6,0x83,0x26,0xe0,0x1,0xca,0x0,0xc6,0x84,0x18,0xcb,0x4,0xd3,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xcb,0x3,0xc6,0x82,0x56,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x82,0x56,0xd3,0xd3,0xc6,0x83,0x4,0xd3,0xd0,0x89,0xc,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x4,0xc7,0xf,0xc6,0x89,0xd,0xe1,0x1,0xc9,0x0,0x1,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xcb,0x3,0xc6,0x82,0x56,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x82,0x56,0xd3,0xd3,0xd3,0xcb,0x3,0xcb,0x0,0xd3,0xd3,0x0,0xc1,0x1,0x6a,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x89,0x42,0xaa,0xc3,0xc4,0xc4,0xc4,0x89,0x43,0xc8,0x0,0x0,0x0,0xc1,0x1,0x6c,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x89,0x45,0xaa,0xc3,0xc4,0xc4,0xc4,0x89,0x46,0xc8,0x0,0x0,0x0,0x3,0x78,0x6f,0x72,0xc1,0x1,0x6e,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x89,0x49,0xaa,0xc3,0xc4,0xc4,0xc4,0x89,0x4a,0xc8,0x0,0x0,0x0,0x3,0x6e,0x6f,0x74,0xc1,0x1,0x70,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x89,0x4d,0xaa,0xc3,0xc4,0xc4,0xc4,0x89,0x4e,0xc8,0x0,0x0,0x0,0x3,0x69,0x73,0x61,0xc1,0x1,0x72,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x89,0x51,0xaa,0xc3,0xc4,0xc4,0xc4,0x89,0x52,0xc8,0x0,0x0,0x0,0x2,0x3d,0x3d,0xc1,0x51,0x3c,0x23,0x89,0x55,0x89,0x55,0x89,0x55,0xc1,0x1,0x76,0x64,0x4,0xc8,0x5,0xc3,0x6,0x89,0x56,0xa,0x89,0x57,0xb0,0xc3,0xc4,0xc4,0xc4,0x89,0x58,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x0,0xd3,0x0,0x2,0x21,0x3d,0x3,0x6e,0x65,0x71,0xc1,0x51,0x7c,0x23,0x89,0x5c,0x89,0x5c,0x89,0x5c,0xc1,0x1,0x78,0x64,0x4,0xc8,0x5,0xc3,0x6,0x89,0x5d,0xa,0x89,0x5e,0xb1,0xc3,0xc4,0xc4,0xc4,0x89,0x5f,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x89,0x5b,0xd3,0x0,0x1,0x3e,0x2,0x67,0x74,0xc1,0x51,0xbe,0x23,0x89,0x63,0x89,0x63,0x89,0x63,0xc1,0x1,0x7c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x89,0x64,0xa,0x89,0x65,0xb1,0xc3,0xc4,0xc4,0xc4,0x89,0x66,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x89,0x62,0xd3,0x0,0x2,0x3e,0x3d,0xc1,0x51,0xfe,0x23,0x89,0x69,0x89,0x69,0x89,0x69,0xc1,0x1,0x7e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x89,0x6a,0xa,0x89,0x6b,0xb0,0xc3,0xc4,0xc4,0xc4,0x89,0x6c,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x37,0xd3,0x0,0x1,0x3c,0xc1,0x52,0x3e,0x23,0x89,0x6f,0x89,0x6f,0x89,0x6f,0x64,0x4,0xc8,0x5,0xc3,0x6,0x89,0x70,0xa,0x3,0xb0,0xc3,0xc4,0xc4,0xc4,0x89,0x71,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x61,0xd3,0x0,0x2,0x3c,0x3d,0xc1,0x52,0x7e,0x23,0x89,0x74,0x89,0x74,0x89,0x74,0xc1,0x1,0x82,0x64,0x4,0xc8,0x5,0xc3,0x6,0x89,0x75,0xa,0x89,0x76,0xb0,0xc3,0xc4,0xc4,0xc4,0x89,0x77,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x38,0xd3,0x0,0x1,0x7e,0x4,0x62,0x6e,0x6f,0x74,0xc1,0x52,0xc0,0x23,0x89,0x7b,0x89,0x7b,0x89,0x7b,0xc1,0x1,0x86,0x64,0x4,0xc8,0x5,0xc3,0x6,0x89,0x7c,0xa,0x89,0x7d,0xb1,0xc3,0xc4,0xc4,0xc4,0x89,0x7e,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x89,0x7a,0xd3,0x0,0x1,0x26,0xc1,0x53,0x2,0x23,0x8a,0x1,0x8a,0x1,0x8a,0x1,0xc1,0x1,0x88,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x2,0xa,0x8a,0x3,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x4,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x6a,0xd3,0x0,0x1,0x7c,0xc1,0x53,0x44,0x23,0x8a,0x7,0x8a,0x7,0x8a,0x7,0xc1,0x1,0x8a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x8,0xa,0x8a,0x9,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0xa,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x2,0xd3,0x0,0x1,0x5e,0x4,0x62,0x78,0x6f,0x72,0xc1,0x53,0x84,0x23,0x8a,0xe,0x8a,0xe,0x8a,0xe,0xc1,0x1,0x8c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0xf,0xa,0x8a,0x10,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x11,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0xd,0xd3,0x0,0x2,0x3c,0x3c,0xc1,0x53,0xc8,0x23,0x8a,0x14,0x8a,0x14,0x8a,0x14,0xc1,0x1,0x8e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x15,0xa,0x8a,0x16,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x17,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x63,0xd3,0x0,0x2,0x3e,0x3e,0xc1,0x54,0xa,0x23,0x8a,0x1a,0x8a,0x1a,0x8a,0x1a,0xc1,0x1,0x90,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x1b,0xa,0x8a,0x1c,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x1d,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x62,0xd3,0x0,0x3,0x3e,0x3e,0x3e,0x4,0x72,0x72,0x73,0x68,0xc1,0x54,0x4e,0x23,0x8a,0x21,0x8a,0x21,0x8a,0x21,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x22,0xa,0x81,0x45,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x23,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x20,0xd3,0x0,0x1,0x2b,0xc1,0x54,0x92,0x23,0x8a,0x26,0x8a,0x26,0x8a,0x26,0xc1,0x1,0x96,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x27,0xa,0x8a,0x28,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x29,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x3b,0xd3,0x0,0x1,0x2d,0xc1,0x54,0xd2,0x23,0x8a,0x2c,0x8a,0x2c,0x8a,0x2c,0xc1,0x1,0x98,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x2d,0xa,0x8a,0x2e,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x2f,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x39,0xd3,0x0,0x1,0x2a,0xc1,0x55,0x12,0x23,0x8a,0x32,0x8a,0x32,0x8a,0x32,0xc1,0x1,0x9a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x33,0xa,0x8a,0x34,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x35,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x83,0x56,0xd3,0x0,0x1,0x2f,0x3,0x64,0x69,0x76,0xc1,0x55,0x52,0x23,0x8a,0x39,0x8a,0x39,0x8a,0x39,0xc1,0x1,0x9c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x3a,0xa,0x8a,0x3b,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x3c,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x38,0xd3,0x0,0x2,0x2f,0x2f,0x4,0x69,0x64,0x69,0x76,0xc1,0x55,0x92,0x23,0x8a,0x40,0x8a,0x40,0x8a,0x40,0xc1,0x1,0x9e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x41,0xa,0x8a,0x42,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x43,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x3f,0xd3,0x0,0x2,0x2f,0x2e,0x4,0x66,0x64,0x69,0x76,0xc1,0x55,0xd4,0x23,0x8a,0x47,0x8a,0x47,0x8a,0x47,0xc1,0x1,0xa0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x48,0xa,0x8a,0x49,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x4a,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x46,0xd3,0x0,0x1,0x25,0xc1,0x56,0x16,0x23,0x8a,0x4d,0x8a,0x4d,0x8a,0x4d,0xc1,0x1,0xa2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x4e,0xa,0x8a,0x4f,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x50,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x89,0xf,0xd3,0x0,0x2,0x2a,0x2a,0x3,0x70,0x6f,0x77,0xc1,0x56,0x58,0x23,0x8a,0x54,0x8a,0x54,0x8a,0x54,0xc1,0x1,0xa4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x55,0xa,0x8a,0x56,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x57,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x53,0xd3,0x0,0x6,0x6f,0x70,0x6e,0x61,0x6d,0x65,0x21,0x88,0x3f,0xc1,0x50,0x28,0xc1,0x50,0x58,0xc1,0x50,0x88,0xc1,0x50,0xb8,0xc1,0x50,0xe8,0xc1,0x51,0x1a,0xc1,0x51,0x5a,0xc1,0x51,0x9e,0xc1,0x51,0xdc,0xc1,0x52,0x1e,0xc1,0x52,0x5c,0xc1,0x52,0xa0,0xc1,0x52,0xe2,0xc1,0x53,0x24,0xc1,0x53,0x64,0xc1,0x53,0xa6,0xc1,0x53,0xe8,0xc1,0x54,0x2a,0xc1,0x54,0x72,0xc1,0x54,0xb2,0xc1,0x54,0xf2,0xc1,0x55,0x32,0xc1,0x55,0x72,0xc1,0x55,0xb4,0xc1,0x55,0xf6,0xc1,0x56,0x36,0xe1,0x81,0x2,0x8a,0x5b,0x8a,0x5b,0x8a,0x5b,0xc0,0xc0,0x8a,0x5c,0x8a,0x5c,0x8a,0x5c,0xc0,0xc0,0x8a,0x5d,0x8a,0x5d,0x8a,0x5d,0xc0,0xc0,0x8a,0x5e,0x8a,0x5e,0x8a,0x5e,0xc0,0xc0,0x8a,0x5f,0x8a,0x5f,0x8a,0x5f,0xc0,0xc0,0x8a,0x60,0x8a,0x60,0x8a,0x60,0xc0,0xc0,0x8a,0x61,0x8a,0x61,0x8a,0x61,0xc0,0xc0,0x8a,0x62,0x8a,0x62,0x8a,0x62,0xc0,0xc0,0x8a,0x63,0x8a,0x63,0x8a,0x63,0xc0,0xc0,0x8a,0x64,0x8a,0x64,0x8a,0x64,0xc0,0xc0,0x8a,0x65,0x8a,0x65,0x8a,0x65,0xc0,0xc0,0x8a,0x66,0x8a,0x66,0x8a,0x66,0xc0,0xc0,0x8a,0x67,0x8a,0x67,0x8a,0x67,0xc0,0xc0,0x8a,0x68,0x8a,0x68,0x8a,0x68,0xc0,0xc0,0x8a,0x69,0x8a,0x69,0x8a,0x69,0xc0,0xc0,0x8a,0x6a,0x8a,0x6a,0x8a,0x6a,0xc0,0xc0,0x8a,0x6b,0x8a,0x6b,0x8a,0x6b,0xc0,0xc0,0x8a,0x6c,0x8a,0x6c,0x8a,0x6c,0xc0,0xc0,0x8a,0x6d,0x8a,0x6d,0x8a,0x6d,0xc0,0xc0,0x8a,0x6e,0x8a,0x6e,0x8a,0x6e,0xc0,0xc0,0x8a,0x6f,0x8a,0x6f,0x8a,0x6f,0xc0,0xc0,0x8a,0x70,0x8a,0x70,0x8a,0x70,0xc0,0xc0,0x8a,0x71,0x8a,0x71,0x8a,0x71,0xc0,0xc0,0x8a,0x72,0x8a,0x72,0x8a,0x72,0xc0,0xc0,0x8a,0x73,0x8a,0x73,0x8a,0x73,0xc0,0xc0,0x8a,0x74,0x8a,0x74,0x8a,0x74,0xc0,0xc0,0xc1,0x1,0x68,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8a,0x75,0xa,0x8a,0x76,0xe5,0x83,0x29,0x8a,0x59,0x8a,0x5a,0xc4,0xc4,0x8a,0x77,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x88,0x7e,0xd3,0xe3,0x0,0xd0,0x89,0x44,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x36,0xd3,0xe3,0x0,0xd0,0x89,0x47,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x89,0x48,0xd3,0xe3,0x0,0xd0,0x89,0x4b,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x89,0x4c,0xd3,0xe3,0x0,0xd0,0x89,0x4f,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x89,0x50,0xd3,0xe3,0x0,0xd0,0x89,0x53,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x89,0x54,0xd3,0xe3,0x0,0xd0,0x89,0x59,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x89,0x5a,0xd3,0xe3,0x0,0xd0,0x89,0x60,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x89,0x61,0xd3,0xe3,0x0,0xd0,0x89,0x67,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x89,0x68,0xd3,0xe3,0x0,0xd0,0x89,0x6d,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x89,0x6e,0xd3,0xe3,0x0,0xd0,0x89,0x72,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x89,0x73,0xd3,0xe3,0x0,0xd0,0x89,0x78,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x89,0x79,0xd3,0xe3,0x0,0xd0,0x89,0x7f,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x0,0xd3,0xe3,0x0,0xd0,0x8a,0x5,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x6,0xd3,0xe3,0x0,0xd0,0x8a,0xb,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0xc,0xd3,0xe3,0x0,0xd0,0x8a,0x12,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x13,0xd3,0xe3,0x0,0xd0,0x8a,0x18,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x19,0xd3,0xe3,0x0,0xd0,0x8a,0x1e,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x1f,0xd3,0xe3,0x0,0xd0,0x8a,0x24,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x25,0xd3,0xe3,0x0,0xd0,0x8a,0x2a,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x2b,0xd3,0xe3,0x0,0xd0,0x8a,0x30,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x31,0xd3,0xe3,0x0,0xd0,0x8a,0x36,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x37,0xd3,0xe3,0x0,0xd0,0x8a,0x3d,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x3e,0xd3,0xe3,0x0,0xd0,0x8a,0x44,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x45,0xd3,0xe3,0x0,0xd0,0x8a,0x4b,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x4c,0xd3,0xe3,0x0,0xd0,0x8a,0x51,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x52,0xd3,0xe3,0x0,0xd0,0x8a,0x58,0xd3,0xd4,0x0,0x7,0x48,0x61,0x73,0x68,0x4d,0x61,0x70,0xc,0x61,0x64,0x64,0x4f,0x70,0x65,0x6e,0x43,0x6c,0x61,0x73,0x73,0x7,0x61,0x64,0x64,0x4f,0x70,0x65,0x6e,0x3,0x72,0x65,0x66,0x6,0x61,0x64,0x64,0x61,0x72,0x67,0x7,0x67,0x72,0x65,0x74,0x75,0x72,0x6e,0x5,0x67,0x67,0x6f,0x74,0x6f,0x6,0x67,0x62,0x72,0x65,0x61,0x6b,0x9,0x67,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x5,0x63,0x6c,0x6f,0x73,0x65,0x6b,0x8a,0x7a,0xc0,0x8a,0x7b,0xc0,0x8a,0x7c,0xc0,0x8a,0x7d,0xc0,0x8a,0x7e,0xc0,0x8a,0x7f,0xc0,0x8b,0x0,0xc0,0x8b,0x1,0xc0,0x88,0x6e,0xc0,0x8b,0x2,0xc0,0x3b,0xc0,0x4,0x6f,0x70,0x65,0x6e,0x63,0x8b,0x4,0xc0,0x89,0x13,0xc0,0x88,0x6b,0xc0,0x4,0x70,0x65,0x65,0x6b,0x22,0xc0,0x8b,0x6,0x2,0x69,0x64,0x4,0x74,0x79,0x70,0x65,0x3,0x76,0x61,0x72,0x5,0x73,0x74,0x79,0x70,0x65,0xc1,0x5a,0xf0,0x23,0x8b,0xc,0x8b,0xc,0x8b,0xc,0xc1,0x1,0xc4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8b,0xd,0xa,0x8b,0xe,0xb1,0xc3,0xc4,0xc4,0xc4,0x8b,0xf,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xc9,0x1,0x1,0xd3,0x0,0x2,0x61,0x74,0x63,0x8b,0x11,0xc0,0x8b,0x9,0xc0,0x88,0x6b,0xc0,0x5,0x6e,0x61,0x6d,0x65,0x73,0x2,0x66,0x6e,0x65,0x85,0x1e,0xc0,0x8b,0x14,0xc0,0x8b,0x11,0xc0,0x8b,0x9,0xc0,0x8b,0x8,0xc0,0x1,0x5f,0x27,0x8a,0x7c,0x8b,0x9,0x8b,0x9,0x8b,0x16,0x8b,0x8,0x8b,0x16,0x8b,0x11,0x27,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0x59,0xf6,0xc1,0x5a,0x56,0xc1,0x5a,0x5e,0xc1,0x5a,0x88,0xc1,0x5a,0xb4,0xc1,0x5a,0xa2,0xc1,0x5a,0x96,0xc1,0x5a,0xd0,0xc1,0x5a,0xc2,0xc1,0x5b,0xce,0xc1,0x5c,0x2,0xc1,0x5b,0xf8,0xc1,0x5c,0xc,0xc1,0x5c,0x64,0xc1,0x5c,0x56,0xc1,0x5c,0xae,0xc1,0x5c,0xa2,0xe1,0x2c,0x8b,0x19,0x8b,0x19,0x8b,0x1a,0x8b,0x1b,0x8b,0x1b,0x8b,0x1a,0xc0,0x8b,0x1c,0x8b,0x1d,0x8b,0x1d,0x8b,0x1e,0x8b,0x1e,0x8b,0x1f,0x8b,0x1f,0x8b,0x1e,0x8b,0x20,0x8b,0x20,0x8b,0x21,0x8b,0x21,0x8b,0x20,0x8b,0x1d,0xc0,0x8b,0x22,0xc0,0xc0,0x8b,0x23,0x8b,0x24,0x8b,0x25,0x8b,0x25,0x8b,0x25,0x8b,0x23,0xc0,0x8b,0x22,0x8b,0x26,0x8b,0x27,0x8b,0x27,0x8b,0x26,0x8b,0x28,0x8b,0x29,0x8b,0x29,0xc0,0xc0,0xc0,0x8b,0x28,0xc1,0x1,0xbc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8b,0x2a,0xa,0x8b,0x2b,0xe5,0x81,0x5b,0xc3,0xc4,0x8b,0x17,0x8b,0x18,0x8b,0x2c,0xf0,0x2,0x8b,0x7,0xcf,0x0,0xc6,0x8a,0x7c,0xc8,0x0,0x1,0xc0,0xd3,0xd1,0x0,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x84,0xa,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x8,0xd3,0xd3,0xd1,0x1,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0xa,0xd3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x1,0xc6,0x8b,0xb,0xd3,0xc6,0x8b,0xa,0xd3,0xd3,0xd0,0x8b,0x10,0xd3,0xc6,0x85,0x2b,0xd1,0x2,0xe0,0x1,0xc9,0x1,0x2,0xc6,0x3b,0xe1,0x7,0xc7,0x4,0xc6,0x8b,0x12,0xc6,0x88,0x6b,0xc8,0x0,0x1,0xc6,0x8b,0x9,0xcb,0x2,0xc6,0x8b,0x11,0xe0,0x1,0xc7,0x15,0xc6,0x83,0x23,0xe1,0x1,0xc7,0x3,0xc8,0x0,0x2,0xd3,0xd3,0xd3,0xd3,0xd2,0x0,0x3,0xd2,0x1,0x4,0xe0,0x1,0xe0,0x0,0xcf,0x0,0xc6,0x88,0x6d,0xd3,0xc6,0x3b,0xc8,0x0,0x1,0xd3,0xd2,0x0,0x5,0xd2,0x1,0x6,0xe0,0x2,0xe0,0x0,0xcf,0x0,0xc6,0x8b,0x13,0xd3,0xc6,0x88,0x7d,0xc8,0x0,0x1,0xe1,0xb,0xc7,0x4,0xc6,0x8b,0x15,0xc6,0x85,0x1e,0xc1,0xc6,0x8b,0x11,0xcb,0x6,0xc6,0x8b,0x8,0xcb,0x4,0xc6,0x8b,0x14,0xc9,0x0,0x1,0xc6,0x8b,0x9,0xcb,0x2,0xd3,0xd3,0x0,0x8,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x21,0x8b,0x2e,0x21,0x88,0x6b,0x21,0x6,0x23,0x8b,0x2f,0x8b,0x30,0x8b,0x31,0x22,0x8b,0x16,0x8b,0x14,0xc1,0x58,0xca,0xc1,0x58,0xea,0xc1,0x59,0x44,0xc1,0x5d,0x1c,0x2e,0x8b,0x34,0xc0,0xc0,0x8b,0x35,0x8b,0x35,0x8b,0x35,0xc0,0x8b,0x34,0xc0,0x8b,0x36,0xc0,0x8b,0x37,0x8b,0x37,0x8b,0x37,0xc1,0x1,0xb8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8b,0x38,0xa,0x8b,0x39,0xe5,0x49,0xc3,0x8b,0x32,0x8b,0x33,0x83,0x73,0x8b,0x3a,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x3b,0xe1,0x7,0xc7,0x4,0xc6,0x8b,0x5,0xc6,0x88,0x6b,0xe1,0x2,0xc7,0x1c,0xca,0x1,0xc6,0x17,0xd3,0xc6,0x8b,0x4,0xca,0x0,0xc6,0x89,0x13,0xce,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xf1,0x2,0x5f,0xc7,0xb,0xca,0x1,0xd0,0x8b,0x2d,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x1,0xd3,0x0,0xc1,0x5d,0xce,0xc1,0x5d,0xc2,0xc1,0x5d,0xb8,0x26,0x8b,0x3c,0x8b,0x3d,0x8b,0x3e,0x8b,0x3e,0x8b,0x3d,0x8b,0x3c,0xc1,0x1,0xd6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8b,0x3f,0xa,0x8b,0x40,0xbe,0xc3,0xc4,0xc4,0xc4,0x8b,0x41,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xcf,0x0,0xc6,0x8b,0x4,0xd3,0xc6,0x84,0xa,0xc8,0x0,0x1,0xd3,0xc6,0x8b,0x2,0xd3,0x0,0x5,0x63,0x6c,0x61,0x73,0x73,0x21,0x8b,0x43,0x22,0x8b,0x44,0x8b,0x30,0xc1,0x5d,0x88,0xc1,0x5d,0xa0,0xc1,0x5d,0x96,0xc1,0x5e,0x6,0xc1,0x5d,0xfc,0x2b,0xc0,0x8b,0x46,0x8b,0x47,0x8b,0x48,0x8b,0x48,0x8b,0x47,0xc0,0x8b,0x49,0x8b,0x4a,0x8b,0x4a,0x8b,0x49,0xc1,0x1,0xd4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8b,0x4b,0xa,0x8b,0x4c,0xe5,0x31,0xc3,0x8b,0x45,0xc4,0xc4,0x8b,0x4d,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x4,0xd3,0xc6,0x84,0xa,0xca,0x1,0xd3,0xd0,0x8b,0x42,0xd3,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8b,0x4,0xd3,0xc6,0x88,0x7d,0xca,0x1,0xca,0x0,0xd3,0x0,0x21,0x8a,0x7c,0xc1,0x5f,0x6c,0xc1,0x5f,0x60,0xc1,0x5f,0xa6,0xc1,0x5f,0xae,0xc1,0x5f,0xbe,0x2b,0x8b,0x50,0x8b,0x51,0x8b,0x51,0x8b,0x50,0x8b,0x52,0x8b,0x52,0x8b,0x53,0x8b,0x53,0x8b,0x54,0x8b,0x54,0x8b,0x52,0xc1,0x1,0xde,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8b,0x55,0xa,0x8b,0x56,0xe5,0x33,0xc3,0xc4,0x8b,0x4f,0x83,0x32,0x8b,0x57,0xe0,0x1,0xe0,0x0,0xcf,0x0,0xc6,0x8b,0x13,0xd3,0xc6,0x84,0xa,0xc8,0x0,0x0,0xd3,0xd1,0x0,0xe1,0x3,0xc7,0x1,0xc4,0x1,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x11,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x8,0xd3,0xd3,0x0,0x64,0x85,0x1e,0xc0,0x8b,0x11,0xc0,0x8b,0x9,0xc0,0x8b,0x8,0xc0,0x21,0x8b,0x9,0x23,0x8b,0x30,0x8b,0x31,0x8b,0x5a,0x25,0x8b,0x9,0x8b,0x16,0x8b,0x8,0x8b,0x16,0x8b,0x11,0x25,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0x5e,0x96,0xc1,0x5e,0xc4,0xc1,0x5e,0xfa,0xc1,0x5e,0xea,0xc1,0x5e,0xe0,0xc1,0x5e,0xd2,0xc1,0x5f,0x22,0xc1,0x5f,0x16,0xc1,0x5f,0xa,0xc1,0x5f,0xf4,0xc1,0x60,0x28,0xc1,0x60,0x1e,0xc1,0x60,0x32,0xc1,0x60,0x82,0xc1,0x60,0x74,0xc1,0x60,0xc4,0xc1,0x60,0xb8,0xc1,0x61,0x2c,0xe1,0x2f,0x8b,0x5e,0x8b,0x5e,0x8b,0x5e,0xc0,0x8b,0x5f,0x8b,0x60,0x8b,0x60,0x8b,0x61,0x8b,0x61,0x8b,0x62,0x8b,0x63,0x8b,0x63,0x8b,0x62,0x8b,0x61,0x8b,0x64,0x8b,0x65,0x8b,0x66,0x8b,0x66,0x8b,0x65,0x8b,0x64,0x8b,0x60,0xc0,0x8b,0x67,0xc0,0xc0,0x8b,0x68,0x8b,0x69,0x8b,0x6a,0x8b,0x6a,0x8b,0x6a,0x8b,0x68,0xc0,0x8b,0x67,0x8b,0x6b,0x8b,0x6c,0x8b,0x6c,0x8b,0x6b,0x8b,0x6d,0x8b,0x6e,0x8b,0x6e,0xc0,0xc0,0xc0,0x8b,0x6d,0x8b,0x6f,0x8b,0x6f,0x8b,0x6f,0xc1,0x1,0xda,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8b,0x70,0xa,0x8b,0x71,0xe5,0x81,0x4a,0xc3,0x8b,0x5b,0x8b,0x5c,0x8b,0x5d,0x8b,0x72,0xe1,0x2,0xc7,0x1c,0xca,0x2,0xc6,0x85,0x2b,0xd3,0xd1,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x88,0x6d,0xd3,0xc6,0x84,0xa,0xc6,0x30,0xd3,0xca,0x0,0xd3,0xe8,0x0,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x13,0xd3,0xc6,0x84,0xa,0xca,0x0,0xd3,0xc6,0x8b,0x14,0xd3,0xd3,0xd0,0x8b,0x58,0xd3,0xe0,0x1,0xc9,0x0,0x2,0xc6,0x3b,0xe1,0x7,0xc7,0x4,0xc6,0x8b,0x12,0xc6,0x88,0x6b,0xca,0x0,0xc6,0x8b,0x9,0xcb,0x0,0xc6,0x8b,0x11,0xe0,0x1,0xc7,0x15,0xc6,0x83,0x23,0xe1,0x1,0xc7,0x3,0xca,0x1,0xd3,0xd3,0xd3,0xd3,0xd2,0x0,0x1,0xd2,0x1,0x2,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x88,0x6d,0xd3,0xc6,0x3b,0xca,0x0,0xd3,0xd2,0x0,0x3,0xd2,0x1,0x4,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8b,0x13,0xd3,0xc6,0x88,0x7d,0xca,0x0,0xe1,0x9,0xc7,0x4,0xc6,0x8b,0x59,0xc6,0x85,0x1e,0xc1,0xc6,0x8b,0x11,0xcb,0x4,0xc6,0x8b,0x8,0xcb,0x2,0xc6,0x8b,0x9,0xcb,0x0,0xd3,0xd3,0xe1,0x3,0xc7,0x1,0xc4,0x0,0xcb,0x4,0xcb,0x2,0xd3,0x0,0xc1,0x62,0x18,0xc1,0x62,0x20,0x24,0x8b,0x74,0x8b,0x75,0x8b,0x75,0x8b,0x74,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8b,0x76,0xa,0x87,0x6c,0xb6,0xc3,0xc4,0xc4,0xc4,0x8b,0x77,0xe1,0x1,0xc9,0x2,0x3,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8b,0x14,0xd3,0xd3,0x0,0x22,0x8b,0x30,0x8b,0x4f,0xc1,0x61,0xd4,0xc1,0x61,0xfc,0xc1,0x61,0xec,0xc1,0x61,0xf4,0x29,0xc0,0x8b,0x7a,0x8b,0x7b,0x8b,0x7c,0x8b,0x7d,0x8b,0x7d,0x8b,0x7c,0x8b,0x7b,0xc0,0xc1,0x1,0xee,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8b,0x7e,0xa,0x8b,0x7f,0xe5,0x28,0xc3,0x8b,0x79,0xc4,0xc4,0x8c,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xe8,0x0,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x84,0xa,0xe8,0x0,0xca,0x1,0xc6,0x8b,0x14,0xd3,0xd3,0xc6,0x8b,0x4,0xd3,0xd0,0x8b,0x78,0xd3,0x0,0x21,0x8b,0x4,0x22,0x8b,0x30,0x8c,0x2,0xc1,0x62,0xa0,0x22,0x8c,0x4,0x8c,0x4,0xc1,0x1,0xf4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x5,0xa,0x8c,0x6,0xb0,0xc3,0x8c,0x3,0xc4,0xc4,0x8c,0x7,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x2,0xd3,0x0,0xc1,0x61,0x8e,0xc1,0x61,0x82,0xc1,0x62,0x70,0xc1,0x62,0x66,0x28,0x8c,0x9,0x8c,0xa,0x8c,0xa,0x8c,0x9,0x8c,0xb,0x8c,0xc,0x8c,0xc,0x8c,0xb,0xc1,0x1,0xec,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0xd,0xa,0x8c,0xe,0xe5,0x2b,0xc3,0xc4,0xc4,0xc4,0x8c,0xf,0xf0,0x1,0x83,0x24,0xe0,0x0,0xce,0xc6,0x8b,0x13,0xd3,0xc6,0x83,0x25,0xd0,0x8c,0x1,0xd3,0xf0,0x1,0x83,0x24,0xe0,0x0,0xce,0xc6,0x8b,0x4,0xd3,0xc6,0x83,0x25,0xd0,0x8c,0x8,0xd3,0x0,0x3,0x6d,0x61,0x70,0x21,0x8b,0x30,0xc1,0x63,0x52,0xc1,0x63,0x46,0xc1,0x63,0x3a,0xc1,0x63,0x2e,0x29,0x8c,0x13,0x8c,0x13,0x8c,0x14,0x8c,0x15,0x8c,0x16,0x8c,0x16,0x8c,0x15,0x8c,0x14,0x8c,0x13,0xc1,0x1,0xf8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x17,0xa,0x8c,0x18,0xe5,0x25,0xc3,0x8c,0x12,0xc4,0xc4,0x8c,0x19,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x13,0xd3,0xc6,0x84,0xa,0xca,0x0,0xd3,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0xa,0xd3,0x0,0xc1,0x63,0xc,0xc1,0x62,0xfe,0x24,0x8c,0x1b,0x8c,0x1c,0x8c,0x1c,0x8c,0x1b,0xc1,0x1,0xf6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x1d,0xa,0x8c,0x1e,0xb9,0xc3,0xc4,0xc4,0xc4,0x8c,0x1f,0xf0,0x1,0x83,0x24,0xe0,0x0,0xce,0xc6,0x88,0x6d,0xd3,0xc6,0x8c,0x11,0xd0,0x8c,0x1a,0xd3,0x0,0x62,0x8b,0x11,0xc0,0x88,0x6b,0xc0,0x63,0x85,0x1e,0xc0,0x8b,0x11,0xc0,0x8b,0x8,0xc0,0x22,0x8b,0x30,0x8b,0x31,0x24,0x8b,0x16,0x8b,0x8,0x8b,0x16,0x8b,0x11,0x24,0xc1,0xc1,0xc1,0xc1,0xc1,0x63,0xd0,0xc1,0x63,0xfa,0xc1,0x63,0xf0,0xc1,0x64,0x4,0xc1,0x64,0x50,0xc1,0x64,0x46,0xc1,0x64,0x92,0xc1,0x64,0x86,0xc1,0x64,0xee,0x39,0x8c,0x26,0xc0,0xc0,0x8c,0x27,0x8c,0x28,0x8c,0x29,0x8c,0x29,0x8c,0x29,0x8c,0x27,0xc0,0x8c,0x26,0x8c,0x2a,0x8c,0x2b,0x8c,0x2b,0x8c,0x2a,0x8c,0x2c,0x8c,0x2d,0x8c,0x2d,0xc0,0xc0,0xc0,0x8c,0x2c,0x8c,0x2e,0x8c,0x2e,0x8c,0x2e,0xc1,0x1,0xfa,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x2f,0xa,0x8c,0x30,0xe5,0x79,0xc3,0x8c,0x23,0x8c,0x24,0x8c,0x25,0x8c,0x31,0xe0,0x1,0xc9,0x0,0x2,0xc6,0x3b,0xe1,0x5,0xc7,0x4,0xc6,0x8c,0x21,0xc6,0x88,0x6b,0xca,0x0,0xc6,0x8b,0x11,0xe0,0x1,0xc7,0x15,0xc6,0x83,0x23,0xe1,0x1,0xc7,0x3,0xca,0x1,0xd3,0xd3,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x85,0x38,0xd3,0xc6,0x3b,0xca,0x0,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8b,0x13,0xd3,0xc6,0x88,0x7d,0xca,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x8c,0x22,0xc6,0x85,0x1e,0xc0,0xc6,0x8b,0x11,0xcb,0x3,0xc6,0x8b,0x8,0xcb,0x1,0xd3,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x1,0xd3,0x0,0x6,0x70,0x61,0x72,0x65,0x6e,0x74,0xc1,0x65,0x78,0xc1,0x65,0x90,0xc1,0x65,0x82,0xc1,0x65,0xae,0x2a,0x8c,0x34,0x8c,0x34,0x8c,0x35,0x8c,0x36,0x8c,0x36,0x8c,0x37,0x8c,0x37,0x8c,0x37,0x8c,0x35,0x8c,0x34,0xc1,0x2,0x6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x38,0xa,0x8c,0x39,0xe5,0x29,0xc3,0xc4,0xc4,0xc4,0x8c,0x3a,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x2,0xe0,0x0,0xcf,0x0,0xc6,0x8c,0x33,0xd3,0xc6,0x8a,0x7e,0xe1,0x2,0xc7,0x9,0xc8,0x0,0x0,0xc4,0x1,0xd3,0xc8,0x0,0x1,0xd3,0xd3,0x0,0x63,0x89,0x13,0xc0,0x8b,0x9,0xc0,0x6,0xc0,0x5,0x6c,0x65,0x76,0x65,0x6c,0x21,0x8c,0x3d,0x22,0x8c,0x3e,0x8b,0x31,0xc1,0x65,0x4e,0xc1,0x65,0x5c,0x28,0xc0,0x8c,0x40,0x8c,0x41,0x8c,0x41,0xc0,0xc0,0xc0,0xc0,0xc1,0x2,0x4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x42,0xa,0x8c,0x43,0xe5,0x2d,0xc3,0x8c,0x3f,0xc4,0xc4,0x8c,0x44,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x5e,0xd3,0xd0,0x8c,0x3b,0xd3,0xe1,0x7,0xc7,0x4,0xc6,0x8c,0x3c,0xc6,0x8b,0x9,0xc6,0x1,0xc6,0x89,0x13,0xca,0x0,0xc6,0x6,0xca,0x1,0xd3,0x0,0xc1,0x66,0xa2,0xc1,0x66,0xba,0xc1,0x66,0xac,0xc1,0x66,0xd4,0x2a,0x8c,0x46,0x8c,0x46,0x8c,0x47,0x8c,0x48,0x8c,0x48,0x8c,0x49,0x8c,0x49,0x8c,0x49,0x8c,0x47,0x8c,0x46,0xc1,0x2,0xc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x4a,0xa,0x8c,0x4b,0xe5,0x29,0xc3,0xc4,0xc4,0xc4,0x8c,0x4c,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x2,0xe0,0x0,0xcf,0x0,0xc6,0x8c,0x33,0xd3,0xc6,0x8a,0x7f,0xe1,0x2,0xc7,0x9,0xc8,0x0,0x0,0xc4,0x1,0xd3,0xc8,0x0,0x1,0xd3,0xd3,0x0,0x4,0x67,0x6f,0x74,0x6f,0xc1,0x66,0x78,0xc1,0x66,0x86,0x28,0xc0,0x8c,0x4f,0x8c,0x50,0x8c,0x50,0xc0,0xc0,0xc0,0xc0,0xc1,0x2,0xa,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x51,0xa,0x8c,0x52,0xe5,0x2e,0xc3,0x8c,0x3f,0xc4,0xc4,0x8c,0x53,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x5e,0xd3,0xd0,0x8c,0x4d,0xd3,0xe1,0x7,0xc7,0x4,0xc6,0x8c,0x3c,0xc6,0x8b,0x9,0xc6,0x8c,0x4e,0xc6,0x89,0x13,0xca,0x0,0xc6,0x6,0xca,0x1,0xd3,0x0,0xc1,0x67,0xce,0xc1,0x67,0xe6,0xc1,0x67,0xd8,0xc1,0x68,0x2,0xc1,0x68,0x1a,0x2c,0x8c,0x55,0x8c,0x55,0x8c,0x56,0x8c,0x57,0x8c,0x57,0x8c,0x58,0x8c,0x58,0x8c,0x58,0x8c,0x59,0x8c,0x59,0x8c,0x56,0x8c,0x55,0xc1,0x2,0x12,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x5a,0xa,0x8c,0x5b,0xe5,0x34,0xc3,0xc4,0xc4,0xc4,0x8c,0x5c,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x3,0xe0,0x0,0xcf,0x0,0xc6,0x8c,0x33,0xd3,0xc6,0x8b,0x0,0xe1,0x2,0xc7,0x9,0xc8,0x0,0x0,0xc4,0x1,0xd3,0xc8,0x0,0x1,0xe0,0x1,0xc8,0x0,0x2,0xc6,0x3b,0xc8,0x0,0x0,0xd3,0xd3,0xd3,0x0,0xc1,0x68,0x78,0xc1,0x68,0x90,0xc1,0x68,0x82,0xc1,0x68,0xac,0x2a,0x8c,0x5e,0x8c,0x5e,0x8c,0x5f,0x8c,0x60,0x8c,0x60,0x8c,0x61,0x8c,0x61,0x8c,0x61,0x8c,0x5f,0x8c,0x5e,0xc1,0x2,0x14,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x62,0xa,0x8c,0x63,0xe5,0x2c,0xc3,0xc4,0xc4,0xc4,0x8c,0x64,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x3,0xe0,0x0,0xcf,0x0,0xc6,0x8c,0x33,0xd3,0xc6,0x8b,0x0,0xe1,0x2,0xc7,0x9,0xc8,0x0,0x0,0xc4,0x1,0xd3,0xc8,0x0,0x1,0xc8,0x0,0x2,0xd3,0xd3,0x0,0x2,0x6c,0x73,0x21,0x8c,0x66,0x23,0x8c,0x3e,0x8b,0x31,0x8c,0x67,0xc1,0x67,0xa4,0xc1,0x67,0xb2,0xc1,0x68,0x4c,0xc1,0x68,0x5a,0x2d,0xc0,0x8c,0x69,0x8c,0x6a,0x8c,0x6a,0xc0,0xc0,0x8c,0x6b,0x8c,0x6c,0x8c,0x6c,0xc0,0xc0,0xc0,0xc0,0xc1,0x2,0x10,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x6d,0xa,0x8c,0x6e,0xe5,0x3e,0xc3,0x8c,0x68,0xc4,0xc4,0x8c,0x6f,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x5e,0xd3,0xd0,0x8c,0x5d,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x8c,0x33,0xd3,0xd0,0x8c,0x65,0xd3,0xe1,0x7,0xc7,0x4,0xc6,0x8c,0x3c,0xc6,0x8b,0x9,0xc6,0x84,0x10,0xc6,0x89,0x13,0xca,0x2,0xc6,0x6,0xca,0x1,0xd3,0x0,0xc1,0x69,0xb0,0xc1,0x69,0xc8,0xc1,0x69,0xba,0xc1,0x69,0xea,0xc1,0x6a,0x2,0x2c,0x8c,0x71,0x8c,0x71,0x8c,0x72,0x8c,0x73,0x8c,0x73,0x8c,0x74,0x8c,0x74,0x8c,0x74,0x8c,0x75,0x8c,0x75,0x8c,0x72,0x8c,0x71,0xc1,0x2,0x1a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x76,0xa,0x8c,0x77,0xe5,0x34,0xc3,0xc4,0xc4,0xc4,0x8c,0x78,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x3,0xe0,0x0,0xcf,0x0,0xc6,0x8c,0x33,0xd3,0xc6,0x8b,0x1,0xe1,0x2,0xc7,0x9,0xc8,0x0,0x0,0xc4,0x1,0xd3,0xc8,0x0,0x1,0xe0,0x1,0xc8,0x0,0x2,0xc6,0x3b,0xc8,0x0,0x0,0xd3,0xd3,0xd3,0x0,0xc1,0x6a,0x60,0xc1,0x6a,0x78,0xc1,0x6a,0x6a,0xc1,0x6a,0x9a,0x2a,0x8c,0x7a,0x8c,0x7a,0x8c,0x7b,0x8c,0x7c,0x8c,0x7c,0x8c,0x7d,0x8c,0x7d,0x8c,0x7d,0x8c,0x7b,0x8c,0x7a,0xc1,0x2,0x1c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8c,0x7e,0xa,0x8c,0x7f,0xe5,0x2c,0xc3,0xc4,0xc4,0xc4,0x8d,0x0,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x3,0xe0,0x0,0xcf,0x0,0xc6,0x8c,0x33,0xd3,0xc6,0x8b,0x1,0xe1,0x2,0xc7,0x9,0xc8,0x0,0x0,0xc4,0x1,0xd3,0xc8,0x0,0x1,0xc8,0x0,0x2,0xd3,0xd3,0x0,0x8,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0xc1,0x69,0x86,0xc1,0x69,0x94,0xc1,0x6a,0x34,0xc1,0x6a,0x42,0x2d,0xc0,0x8d,0x3,0x8d,0x4,0x8d,0x4,0xc0,0xc0,0x8d,0x5,0x8d,0x6,0x8d,0x6,0xc0,0xc0,0xc0,0xc0,0xc1,0x2,0x18,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x7,0xa,0x8d,0x8,0xe5,0x3e,0xc3,0x8c,0x68,0xc4,0xc4,0x8d,0x9,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x5e,0xd3,0xd0,0x8c,0x79,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x8c,0x33,0xd3,0xd0,0x8d,0x1,0xd3,0xe1,0x7,0xc7,0x4,0xc6,0x8c,0x3c,0xc6,0x8b,0x9,0xc6,0x8d,0x2,0xc6,0x89,0x13,0xca,0x2,0xc6,0x6,0xca,0x1,0xd3,0x0,0xc1,0x6b,0xa8,0xc1,0x6b,0xb2,0x25,0x8d,0xb,0x8d,0xb,0x8d,0xc,0x8d,0xc,0x8d,0xb,0xc1,0x2,0x22,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0xd,0xa,0x8d,0xe,0xbb,0xc3,0xc4,0xc4,0xc4,0x8d,0xf,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x2,0xcf,0x0,0xc6,0x8a,0x7e,0xc4,0x0,0xc8,0x0,0x2,0xd3,0xd3,0x0,0xc1,0x6c,0x1e,0xc1,0x6c,0x28,0x25,0x8d,0x11,0x8d,0x11,0x8d,0x12,0x8d,0x12,0x8d,0x11,0xc1,0x2,0x24,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x13,0xa,0x8d,0x14,0xbb,0xc3,0xc4,0xc4,0xc4,0x8d,0x15,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x2,0xcf,0x0,0xc6,0x8a,0x7f,0xc4,0x0,0xc8,0x0,0x2,0xd3,0xd3,0x0,0xc1,0x6c,0x92,0xc1,0x6c,0x9c,0xc1,0x6c,0xbc,0x28,0x8d,0x17,0x8d,0x17,0x8d,0x18,0x8d,0x19,0x8d,0x19,0x8d,0x19,0x8d,0x18,0x8d,0x17,0xc1,0x2,0x26,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x1a,0xa,0x8d,0x1b,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x8d,0x1c,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x3,0xcf,0x0,0xc6,0x8b,0x0,0xc4,0x0,0xc8,0x0,0x2,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xd3,0x0,0xc1,0x6d,0x16,0xc1,0x6d,0x20,0xc1,0x6d,0x46,0x28,0x8d,0x1e,0x8d,0x1e,0x8d,0x1f,0x8d,0x20,0x8d,0x20,0x8d,0x20,0x8d,0x1f,0x8d,0x1e,0xc1,0x2,0x28,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x21,0xa,0x8d,0x22,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x8d,0x23,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x3,0xcf,0x0,0xc6,0x8b,0x1,0xc4,0x0,0xc8,0x0,0x2,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xd3,0x0,0xc1,0x6e,0x50,0xc1,0x6e,0x58,0x24,0x8d,0x25,0x8d,0x26,0x8d,0x26,0x8d,0x25,0xc1,0x2,0x2e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x27,0xa,0x8d,0x28,0xb6,0xc3,0xc4,0xc4,0xc4,0x8d,0x29,0xe1,0x1,0xc9,0x2,0x3,0xe0,0x0,0xc9,0x1,0x0,0xc6,0x8b,0x14,0xd3,0xd3,0x0,0xc1,0x6e,0xc,0xc1,0x6e,0x34,0xc1,0x6e,0x24,0xc1,0x6e,0x2c,0x29,0xc0,0x8d,0x2b,0x8d,0x2c,0x8d,0x2d,0x8d,0x2e,0x8d,0x2e,0x8d,0x2d,0x8d,0x2c,0xc0,0xc1,0x2,0x2c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x2f,0xa,0x8d,0x30,0xe5,0x28,0xc3,0xc4,0xc4,0xc4,0x8d,0x31,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x84,0xa,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x14,0xd3,0xd3,0xc6,0x8b,0x4,0xd3,0xd0,0x8d,0x2a,0xd3,0x0,0x3,0x64,0x65,0x6c,0xc1,0x6f,0x22,0xc1,0x6f,0xe,0xc1,0x6f,0x4,0x26,0x8d,0x34,0x8d,0x35,0x8d,0x36,0x8d,0x36,0x8d,0x35,0x8d,0x34,0xc1,0x2,0x30,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x37,0xa,0x8d,0x38,0xbe,0xc3,0xc4,0xc4,0xc4,0x8d,0x39,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xcf,0x0,0xc6,0x8b,0x4,0xd3,0xc6,0x8d,0x33,0xc8,0x0,0x0,0xd3,0xc6,0x8b,0x2,0xd3,0x0,0x63,0x8b,0x11,0xc0,0x8b,0x9,0xc0,0x8b,0x8,0xc0,0xc1,0x6f,0xe0,0xc1,0x70,0x6,0xc1,0x70,0x1a,0x2a,0x8d,0x3c,0x8d,0x3c,0xc0,0xc0,0x8d,0x3d,0x8d,0x3d,0x8d,0x3e,0x8d,0x3e,0xc0,0x8d,0x3c,0xc1,0x2,0x38,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x3f,0xa,0x8d,0x40,0xe5,0x34,0xc3,0xc4,0xc4,0xc4,0x8d,0x41,0xe1,0x2,0xc7,0x1,0xc4,0x3,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x9,0xc6,0x85,0x1e,0xc6,0x8b,0x11,0xe0,0x0,0xc9,0x2,0x0,0xc6,0x8b,0x11,0xd3,0xc6,0x8b,0x8,0xe0,0x0,0xc9,0x2,0x0,0xc6,0x8b,0x8,0xd3,0xd3,0xd3,0x0,0x2,0x75,0x70,0x64,0x8d,0x43,0xc0,0x8b,0x11,0xc0,0x8b,0x9,0xc0,0x8b,0x8,0xc0,0xc1,0x6f,0xb8,0xc1,0x6f,0xbe,0xc1,0x70,0x58,0xc1,0x70,0x96,0xc1,0x70,0xaa,0x30,0xc0,0x8d,0x45,0x8d,0x46,0x8d,0x46,0x8d,0x46,0xc0,0x8d,0x47,0x8d,0x47,0xc0,0xc0,0x8d,0x48,0x8d,0x48,0x8d,0x49,0x8d,0x49,0xc0,0x8d,0x47,0xc1,0x2,0x36,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x4a,0xa,0x8d,0x4b,0xe5,0x4b,0xc3,0xc4,0xc4,0xc4,0x8d,0x4c,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x1e,0xc8,0x1,0x1,0xd3,0xd0,0x8d,0x42,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe1,0x9,0xc7,0x4,0xc6,0x8d,0x44,0xc6,0x8b,0x9,0xc6,0x84,0x7a,0xc6,0x8d,0x43,0xc8,0x1,0x1,0xc6,0x8b,0x11,0xe0,0x0,0xc9,0x1,0x0,0xc6,0x8b,0x11,0xd3,0xc6,0x8b,0x8,0xe0,0x0,0xc9,0x1,0x0,0xc6,0x8b,0x8,0xd3,0xd3,0xd3,0x0,0x64,0x8b,0xb,0xc0,0x8b,0x11,0xc0,0x8b,0x9,0xc0,0x8b,0x8,0xc0,0xc1,0x70,0xfc,0xc1,0x71,0x26,0xc1,0x71,0x3a,0xc1,0x71,0x54,0x2c,0x8d,0x4f,0x8d,0x4f,0xc0,0xc0,0x8d,0x50,0x8d,0x50,0x8d,0x51,0x8d,0x51,0x8d,0x52,0x8d,0x52,0xc0,0x8d,0x4f,0xc1,0x2,0x3c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x53,0xa,0x8d,0x54,0xe5,0x40,0xc3,0xc4,0xc4,0xc4,0x8d,0x55,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe1,0x9,0xc7,0x4,0xc6,0x8d,0x4e,0xc6,0x8b,0x9,0xc6,0x85,0x2b,0xc6,0x8b,0x11,0xe0,0x0,0xc9,0x1,0x0,0xc6,0x8b,0x11,0xd3,0xc6,0x8b,0x8,0xe0,0x0,0xc9,0x1,0x0,0xc6,0x8b,0x8,0xd3,0xc6,0x8b,0xb,0xe0,0x0,0xc9,0x1,0x0,0xc6,0x8b,0x9,0xd3,0xd3,0xd3,0x0,0x65,0x8d,0x43,0xc0,0x8b,0xb,0xc0,0x8b,0x11,0xc0,0x8b,0x9,0xc0,0x8b,0x8,0xc0,0xc1,0x6f,0x78,0xc1,0x6f,0x84,0xc1,0x70,0xd4,0xc1,0x70,0xda,0xc1,0x71,0x8e,0xc1,0x71,0xc6,0xc1,0x71,0xda,0xc1,0x71,0xf4,0x37,0xc0,0x8d,0x58,0x8d,0x59,0x8d,0x59,0xc0,0xc0,0x8d,0x5a,0x8d,0x5b,0x8d,0x5b,0x8d,0x5b,0xc0,0x8d,0x5c,0x8d,0x5c,0xc0,0xc0,0x8d,0x5d,0x8d,0x5d,0x8d,0x5e,0x8d,0x5e,0x8d,0x5f,0x8d,0x5f,0xc0,0x8d,0x5c,0xc1,0x2,0x34,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x60,0xa,0x8d,0x61,0xe5,0x69,0xc3,0xc4,0xc4,0xc4,0x8d,0x62,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x85,0x1e,0xd3,0xd0,0x8d,0x4d,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x1e,0xc8,0x0,0x1,0xd3,0xd0,0x8d,0x56,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0xb,0xc7,0x4,0xc6,0x8d,0x57,0xc6,0x8b,0x9,0xc6,0x85,0xc,0xc6,0x8d,0x43,0xc8,0x0,0x1,0xc6,0x8b,0x11,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x11,0xd3,0xc6,0x8b,0x8,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x8,0xd3,0xc6,0x8b,0xb,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x9,0xd3,0xd3,0xd3,0x0,0x61,0x8b,0x9,0xc0,0xc1,0x72,0xae,0x26,0x8d,0x65,0x8d,0x65,0xc0,0xc0,0xc0,0x8d,0x65,0xc1,0x2,0x42,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x66,0xa,0x8d,0x67,0xbc,0xc3,0xc4,0xc4,0xc4,0x8d,0x68,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe1,0x3,0xc7,0x4,0xc6,0x8d,0x64,0xc6,0x8b,0x9,0xc6,0x85,0x38,0xd3,0xd3,0x0,0x62,0x8d,0x43,0xc0,0x8b,0x9,0xc0,0xc1,0x72,0x86,0xc1,0x72,0x8c,0xc1,0x72,0xf8,0x2c,0xc0,0x8d,0x6b,0x8d,0x6c,0x8d,0x6c,0x8d,0x6c,0xc0,0x8d,0x6d,0x8d,0x6d,0xc0,0xc0,0xc0,0x8d,0x6d,0xc1,0x2,0x40,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x6e,0xa,0x8d,0x6f,0xe5,0x33,0xc3,0xc4,0xc4,0xc4,0x8d,0x70,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x1e,0xc8,0x0,0x1,0xd3,0xd0,0x8d,0x69,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x5,0xc7,0x4,0xc6,0x8d,0x6a,0xc6,0x8b,0x9,0xc6,0x85,0x3f,0xc6,0x8d,0x43,0xc8,0x0,0x1,0xd3,0xd3,0x0,0xc1,0x73,0xda,0x26,0x8d,0x72,0x8d,0x72,0xc0,0xc0,0xc0,0x8d,0x72,0xc1,0x2,0x48,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x73,0xa,0x8d,0x74,0xbc,0xc3,0xc4,0xc4,0xc4,0x8d,0x75,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe1,0x3,0xc7,0x4,0xc6,0x8d,0x64,0xc6,0x8b,0x9,0xc6,0x85,0x4c,0xd3,0xd3,0x0,0xc1,0x73,0xb2,0xc1,0x73,0xb8,0xc1,0x74,0x24,0x2c,0xc0,0x8d,0x77,0x8d,0x78,0x8d,0x78,0x8d,0x78,0xc0,0x8d,0x79,0x8d,0x79,0xc0,0xc0,0xc0,0x8d,0x79,0xc1,0x2,0x46,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8d,0x7a,0xa,0x8d,0x7b,0xe5,0x33,0xc3,0xc4,0xc4,0xc4,0x8d,0x7c,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x1e,0xc8,0x0,0x1,0xd3,0xd0,0x8d,0x76,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x5,0xc7,0x4,0xc6,0x8d,0x6a,0xc6,0x8b,0x9,0xc6,0x85,0x53,0xc6,0x8d,0x43,0xc8,0x0,0x1,0xd3,0xd3,0x0,0xc1,0x74,0xda,0xc1,0x74,0xf2,0xc1,0x74,0xe4,0x27,0x8d,0x7e,0x8d,0x7e,0x8d,0x7f,0x8e,0x0,0x8e,0x0,0x8d,0x7f,0x8d,0x7e,0xc1,0x2,0x4e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8e,0x1,0xa,0x8e,0x2,0xe5,0x24,0xc3,0xc4,0xc4,0xc4,0x8e,0x3,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe0,0x3,0xe0,0x0,0xcf,0x1,0xc6,0x8c,0x33,0xd3,0xc6,0x8a,0x7c,0xc8,0x1,0x0,0xc4,0x1,0xc8,0x1,0x2,0xd3,0xd3,0x0,0xc1,0x74,0xb2,0xc1,0x74,0xb8,0xc1,0x75,0x44,0xc1,0x75,0x5c,0xc1,0x75,0x4e,0xc1,0x75,0x7e,0x30,0xc0,0x8e,0x5,0x8e,0x6,0x8e,0x6,0x8e,0x6,0xc0,0x8e,0x7,0x8e,0x7,0x8e,0x8,0x8e,0x9,0x8e,0x9,0x8e,0xa,0x8e,0xa,0x8e,0xa,0x8e,0x8,0x8e,0x7,0xc1,0x2,0x4c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8e,0xb,0xa,0x8e,0xc,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x8e,0xd,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x1e,0xc8,0x0,0x1,0xd3,0xd0,0x8e,0x4,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x3,0xe0,0x0,0xcf,0x0,0xc6,0x8c,0x33,0xd3,0xc6,0x8a,0x7c,0xc8,0x0,0x0,0xe1,0x2,0xc7,0x9,0xc8,0x0,0x1,0xc4,0x1,0xd3,0xc8,0x0,0x2,0xd3,0xd3,0x0,0x63,0x8b,0x9,0xc0,0x6,0xc0,0x88,0x6b,0xc0,0x23,0x8b,0x30,0x8c,0x3e,0x8b,0x31,0xc1,0x6b,0x72,0xc1,0x6b,0x82,0xc1,0x6b,0xec,0xc1,0x6b,0xfc,0xc1,0x6c,0x5e,0xc1,0x6c,0x6e,0xc1,0x6c,0xdc,0xc1,0x6c,0xec,0xc1,0x6d,0x86,0xc1,0x6d,0x7a,0xc1,0x6d,0xac,0xc1,0x6d,0xc0,0xc1,0x6d,0xb8,0xc1,0x6d,0xc8,0xc1,0x6d,0xd8,0xc1,0x6e,0x7a,0xc1,0x6e,0xb0,0xc1,0x6e,0x88,0xc1,0x6e,0xa2,0xc1,0x6e,0x98,0xc1,0x6e,0xb8,0xc1,0x6e,0xc8,0xc1,0x6f,0x48,0xc1,0x72,0x1a,0xc1,0x72,0x3e,0xc1,0x72,0x2a,0xc1,0x72,0x46,0xc1,0x72,0x56,0xc1,0x73,0x46,0xc1,0x73,0x6a,0xc1,0x73,0x56,0xc1,0x73,0x72,0xc1,0x73,0x82,0xc1,0x74,0x72,0xc1,0x74,0x80,0xc1,0x75,0xb8,0xc1,0x75,0xf8,0xe1,0x67,0xc0,0x8e,0x11,0x8e,0x12,0x8e,0x12,0x8e,0x12,0xc0,0xc0,0x8e,0x13,0x8e,0x14,0x8e,0x14,0x8e,0x14,0xc0,0xc0,0x8e,0x15,0x8e,0x16,0x8e,0x16,0x8e,0x16,0xc0,0xc0,0x8e,0x17,0x8e,0x18,0x8e,0x18,0x8e,0x18,0xc0,0x8e,0x19,0x8e,0x1a,0x8e,0x1a,0x8e,0x19,0xc0,0x8e,0x1b,0x8e,0x1c,0x8e,0x1c,0x8e,0x1d,0x8e,0x1d,0x8e,0x1e,0x8e,0x1e,0x8e,0x1f,0x8e,0x1f,0x8e,0x1e,0x8e,0x1c,0xc0,0xc0,0x8e,0x20,0x8e,0x21,0x8e,0x21,0x8e,0x22,0x8e,0x22,0x8e,0x23,0x8e,0x24,0x8e,0x24,0x8e,0x23,0x8e,0x22,0x8e,0x25,0x8e,0x25,0x8e,0x26,0x8e,0x26,0x8e,0x25,0x8e,0x21,0xc0,0xc0,0x8e,0x27,0xc0,0xc0,0x8e,0x28,0x8e,0x29,0x8e,0x29,0x8e,0x2a,0x8e,0x2a,0x8e,0x2a,0x8e,0x2b,0x8e,0x2b,0x8e,0x2c,0x8e,0x2c,0x8e,0x2b,0x8e,0x29,0xc0,0xc0,0x8e,0x2d,0x8e,0x2e,0x8e,0x2e,0x8e,0x2f,0x8e,0x2f,0x8e,0x2f,0x8e,0x30,0x8e,0x30,0x8e,0x31,0x8e,0x31,0x8e,0x30,0x8e,0x2e,0xc0,0xc0,0x8e,0x32,0x8e,0x33,0x8e,0x33,0xc0,0x8e,0x34,0x8e,0x34,0x8e,0x35,0x8e,0x35,0xc0,0xc0,0xc0,0x8e,0x35,0xc1,0x2,0x20,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8e,0x36,0xa,0x8e,0x37,0xe5,0x82,0x49,0xc3,0x8e,0x10,0x8b,0x4f,0x83,0x32,0x8e,0x38,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x1,0xd3,0xd0,0x8d,0x10,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8c,0x4e,0xd3,0xd0,0x8d,0x16,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x84,0x10,0xd3,0xd0,0x8d,0x1d,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8d,0x2,0xd3,0xd0,0x8d,0x24,0xd3,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x13,0xd3,0xc6,0x84,0xa,0xca,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x5,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x14,0xd3,0xe1,0x1,0xc7,0x1e,0xe0,0x1,0xcc,0xc6,0x84,0xa,0xc6,0x8b,0x6,0xd3,0xd3,0xd3,0xd0,0x8d,0x32,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x5,0xcb,0x0,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x4,0xd3,0xc6,0x84,0xa,0xca,0x0,0xd3,0xd3,0xe1,0x1,0xc7,0x1e,0xe0,0x1,0xcc,0xc6,0x84,0xa,0xc6,0x8b,0x6,0xd3,0xd3,0xd3,0xd0,0x8d,0x3a,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xcb,0x0,0xd0,0x8d,0x63,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x85,0x38,0xd3,0xe1,0x1,0xc7,0x1e,0xe0,0x0,0xce,0xc6,0x5e,0xd3,0xd3,0xd3,0xd0,0x8d,0x71,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x85,0x4c,0xd3,0xe1,0x1,0xc7,0x1e,0xe0,0x0,0xce,0xc6,0x5e,0xd3,0xd3,0xd3,0xd0,0x8d,0x7d,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x8c,0x33,0xd3,0xd0,0x8e,0xe,0xd3,0xe0,0x2,0xc9,0x0,0x0,0xc6,0x88,0x7d,0xca,0x0,0xc0,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x84,0x33,0xc6,0x88,0x6b,0xca,0x0,0xc6,0x6,0xca,0x2,0xd3,0xd3,0x0,0xd,0x70,0x61,0x72,0x65,0x6e,0x74,0x56,0x69,0x73,0x69,0x62,0x6c,0x65,0x68,0x8e,0x3a,0xc0,0x8c,0x33,0xc0,0x8b,0x4,0xc0,0x88,0x6d,0xc0,0x8b,0x13,0xc0,0x85,0x38,0xc0,0x5e,0xc0,0x8b,0x43,0xc0,0x5,0x53,0x63,0x6f,0x70,0x65,0x21,0x8c,0x33,0x22,0x8e,0x3d,0x83,0x24,0xc1,0x77,0x36,0xc1,0x77,0x2a,0xc1,0x77,0x1c,0xc1,0x77,0x6c,0xc1,0x77,0xac,0xc1,0x77,0x9e,0xc1,0x77,0xe2,0xc1,0x77,0xd4,0xc1,0x78,0x18,0xc1,0x78,0xe,0xc1,0x78,0x4a,0xc1,0x78,0x40,0x39,0xc0,0xc0,0x8e,0x3f,0x8e,0x3f,0x8e,0x40,0x8e,0x41,0x8e,0x41,0x8e,0x40,0x8e,0x3f,0x8e,0x42,0x8e,0x42,0x8e,0x42,0x8e,0x43,0x8e,0x44,0x8e,0x43,0x8e,0x45,0x8e,0x46,0x8e,0x45,0x8e,0x47,0x8e,0x48,0x8e,0x47,0x8e,0x49,0x8e,0x4a,0x8e,0x49,0xc0,0xc1,0x2,0x58,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8e,0x4b,0xa,0x8e,0x4c,0xe5,0x6e,0x8e,0x3c,0x8e,0x3e,0xc4,0xc4,0x8e,0x4d,0xe1,0x13,0xc7,0x4,0xc6,0x8e,0x3b,0xc6,0x8b,0x43,0xc9,0x0,0x4,0xc6,0x8c,0x33,0xca,0x0,0xc6,0x5e,0xca,0x1,0xc6,0x8e,0x3a,0xe1,0x2,0xc7,0x1c,0xe0,0x0,0xe8,0x0,0xca,0x0,0xc6,0x88,0x6d,0xd3,0xc6,0x82,0x56,0xd3,0xc4,0x0,0xd3,0xc6,0x5e,0xe1,0x2,0xc7,0x1c,0xca,0x1,0xc1,0xd3,0xc6,0x8b,0x13,0xe0,0x0,0xc7,0x1d,0xc6,0x83,0x23,0xd3,0xc6,0x8b,0x4,0xe0,0x0,0xc7,0x1d,0xc6,0x83,0x23,0xd3,0xc6,0x88,0x6d,0xe0,0x0,0xc7,0x15,0xc6,0x83,0x23,0xd3,0xc6,0x85,0x38,0xe0,0x0,0xc7,0x15,0xc6,0x83,0x23,0xd3,0xd3,0x0,0x62,0x8b,0x4,0xc0,0x88,0x6b,0xc0,0x63,0x8b,0x2e,0xc0,0x8b,0x4,0xc0,0x88,0x6b,0xc0,0x7,0x63,0x6c,0x6f,0x73,0x65,0x66,0x6e,0x21,0x82,0x5b,0x21,0x8e,0x52,0x22,0x8a,0x7c,0x8b,0x14,0xc1,0x78,0xb6,0xc1,0x78,0xe0,0xc1,0x78,0xfe,0xc1,0x79,0x48,0xc1,0x79,0x50,0xc1,0x79,0x66,0xc1,0x79,0x96,0xc1,0x79,0xb4,0x36,0x8e,0x55,0x8e,0x55,0x8e,0x56,0xc0,0xc0,0x8e,0x57,0x8e,0x57,0xc0,0x8e,0x56,0x8e,0x58,0x8e,0x59,0x8e,0x59,0x8e,0x5a,0x8e,0x5a,0x8e,0x58,0x8e,0x5b,0xc0,0xc0,0x8e,0x5c,0x8e,0x5c,0xc0,0x8e,0x5b,0xc1,0x2,0x6e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8e,0x5d,0xa,0x8e,0x5e,0xe5,0x79,0x8e,0x51,0x8e,0x53,0x8e,0x54,0x83,0x73,0x8e,0x5f,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x84,0xa,0xca,0x0,0xd3,0xd1,0x0,0xe0,0x2,0xc9,0x0,0x1,0xc6,0x88,0x7d,0xca,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x8e,0x4f,0xc6,0x88,0x6b,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x6b,0xd3,0xc6,0x8b,0x4,0xc1,0xd3,0xd3,0xe1,0x2,0xc9,0x0,0x7,0xe0,0x0,0xcb,0x0,0xc6,0x89,0x13,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x4,0xd3,0xd3,0xd1,0x1,0xe0,0x2,0xc9,0x0,0x1,0xc6,0x88,0x7d,0xca,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0x50,0xc6,0x88,0x6b,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x6b,0xd3,0xc6,0x8b,0x4,0xc1,0xc6,0x8b,0x2e,0xcb,0x1,0xd3,0xd3,0x0,0x4,0x6c,0x61,0x7a,0x79,0x1,0x64,0xc1,0x7a,0x66,0xc1,0x7a,0x68,0xc1,0x7a,0x70,0xc1,0x7a,0x84,0x2a,0x8e,0x63,0x8e,0x63,0x8e,0x64,0x8e,0x64,0x8e,0x65,0x8e,0x65,0x8e,0x66,0x8e,0x66,0x8e,0x64,0x8e,0x63,0xc1,0x2,0x7c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8e,0x67,0xa,0x8e,0x68,0xe5,0x26,0xc3,0xc4,0xc4,0xc4,0x8e,0x69,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x3,0xc7,0x3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8e,0x62,0xd3,0xc0,0xd3,0xd3,0x0,0xc1,0x7a,0xc8,0xc1,0x7a,0xca,0xc1,0x7a,0xd2,0xc1,0x7a,0xe6,0x2a,0x8e,0x6b,0x8e,0x6b,0x8e,0x6c,0x8e,0x6c,0x8e,0x6d,0x8e,0x6d,0x8e,0x6e,0x8e,0x6e,0x8e,0x6c,0x8e,0x6b,0xc1,0x2,0x7e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8e,0x6f,0xa,0x8e,0x70,0xe5,0x25,0xc3,0xc4,0xc4,0xc4,0x8e,0x71,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8e,0x62,0xd3,0xd3,0xd3,0x0,0x7,0x61,0x72,0x67,0x73,0x70,0x65,0x63,0x21,0x85,0x1e,0x21,0x8e,0x74,0xc1,0x7a,0x2c,0xc1,0x7a,0x44,0xc1,0x7a,0x38,0xc1,0x7a,0xa8,0xc1,0x7a,0xb4,0xc1,0x7a,0xfe,0xc1,0x7b,0x6,0x32,0xc0,0x8e,0x76,0x8e,0x77,0x8e,0x77,0x8e,0x78,0x8e,0x78,0x8e,0x77,0xc0,0xc0,0x8e,0x79,0x8e,0x7a,0x8e,0x7a,0xc0,0x8e,0x7b,0x8e,0x7b,0x8e,0x7c,0x8e,0x7c,0x8e,0x7b,0xc1,0x2,0x7a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8e,0x7d,0xa,0x8e,0x7e,0xe5,0x40,0x8e,0x73,0x8e,0x75,0xc4,0xc4,0x8e,0x7f,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x8e,0x61,0xd3,0xd0,0x8e,0x6a,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe8,0x0,0xca,0x0,0xc6,0x8e,0x62,0xd3,0xd0,0x8e,0x72,0xd3,0xe1,0x1,0xc7,0x3,0xe0,0x0,0xca,0x0,0xc6,0x88,0x6b,0xd3,0xd3,0x0,0x7,0x69,0x73,0x46,0x72,0x61,0x6d,0x65,0xc1,0x2,0x8e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x8f,0x2,0xb4,0xc3,0xc4,0xc4,0xc4,0x8f,0x3,0xe1,0x2,0xc7,0x9,0xc9,0x1,0x0,0xc4,0x1,0xd3,0xd9,0x1,0x0,0x0,0xc1,0x7d,0x1a,0x26,0x8f,0x5,0x8f,0x5,0x8f,0x5,0x8f,0x5,0x8f,0x5,0x8f,0x5,0xc1,0x2,0x90,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x6,0xa,0x8f,0x7,0xb7,0xc3,0xc4,0xc4,0xc4,0x8f,0x8,0xe1,0x1,0xc7,0x17,0xe1,0x3,0xc7,0x3,0xc4,0x0,0xc4,0x1,0xc4,0x2,0xd3,0xd3,0x0,0x23,0xc0,0xc0,0x8b,0x9,0x24,0x8b,0x16,0x88,0x6b,0x8b,0x9,0x6,0xc1,0x7c,0xbe,0xc1,0x7d,0x0,0xc1,0x7d,0x6,0xc1,0x7d,0x50,0x2c,0x8f,0xc,0xc0,0xc0,0x8f,0xc,0xc0,0x8f,0xd,0x8f,0xe,0x8f,0xe,0x8f,0xe,0xc0,0x8f,0xf,0x8f,0xf,0xc1,0x2,0x8c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x10,0xa,0x8f,0x11,0xe5,0x44,0xc3,0xc4,0x8f,0xb,0x8c,0x25,0x8f,0x12,0xe0,0x1,0xc8,0x1,0x2,0xc6,0x84,0xa,0xe1,0x0,0xd0,0x8f,0x4,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xd2,0x2,0x2,0xd2,0x3,0x3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x1e,0xcb,0x1,0xd3,0xd0,0x8f,0x9,0xd3,0xf0,0x3,0x8f,0xa,0xc9,0x1,0x0,0xc6,0x3b,0xcb,0x1,0xcb,0x3,0xcb,0x2,0xd3,0x0,0x3,0x24,0x61,0x74,0x21,0x8f,0x14,0x21,0xc2,0xc1,0x7c,0x56,0x23,0x8f,0x17,0x8f,0x17,0x8f,0x17,0xc1,0x2,0x88,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x18,0xa,0x8f,0x19,0xb7,0xc3,0xc4,0x8f,0x15,0x8f,0x16,0x8f,0x1a,0xc4,0x0,0xd6,0x0,0xf1,0x1,0x83,0x24,0xc7,0x16,0xd0,0x8f,0x13,0xd3,0x0,0x2,0x61,0x73,0x22,0x8e,0x74,0x8e,0x52,0xc1,0x7e,0x3c,0xc1,0x7e,0x52,0xc1,0x7e,0x66,0xc1,0x7e,0x82,0x28,0x8f,0x1e,0x8f,0x1f,0x8f,0x1f,0x8f,0x20,0x8f,0x20,0x8f,0x1e,0x8f,0x21,0x8f,0x21,0xc1,0x2,0x96,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x22,0xa,0x8f,0x23,0xe5,0x28,0xc3,0x8f,0x1d,0xc4,0xc4,0x8f,0x24,0xe0,0x2,0xc9,0x1,0x0,0xc6,0x8a,0x7d,0xe0,0x0,0xca,0x0,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x6,0xca,0x0,0xd3,0x0,0x4,0x62,0x6f,0x64,0x79,0x3,0x73,0x74,0x6d,0x21,0x8f,0x27,0x21,0x8f,0x28,0xc1,0x7e,0xe6,0x22,0x8f,0x2a,0x8f,0x2a,0xc1,0x2,0x98,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x2b,0xa,0x8f,0x2c,0xb3,0xc3,0x8f,0x29,0xc4,0xc4,0x8f,0x2d,0xe1,0x2,0xc9,0x2,0x8,0xc9,0x1,0x0,0xca,0x0,0xd3,0x0,0x66,0x8f,0x26,0xc0,0x89,0x13,0xc0,0x8b,0x9,0xc0,0x6,0xc0,0x88,0x6d,0xc0,0x85,0x38,0xc0,0x22,0x85,0x38,0x8f,0x26,0xc1,0x7e,0x14,0xc1,0x7e,0x8,0xc1,0x7e,0x0,0xc1,0x7e,0xe,0xc1,0x7e,0xc8,0xc1,0x7e,0xbe,0xc1,0x7f,0x24,0xc1,0x7f,0xb6,0xc1,0x7f,0xa8,0xc1,0x7f,0xd6,0x39,0x8f,0x31,0x8f,0x32,0x8f,0x32,0x8f,0x33,0x8f,0x33,0x8f,0x34,0x8f,0x34,0x8f,0x34,0x8f,0x32,0x8f,0x31,0x8f,0x35,0x8f,0x36,0x8f,0x36,0x8f,0x35,0x8f,0x37,0x8f,0x37,0xc0,0xc0,0x8f,0x38,0x8f,0x39,0x8f,0x39,0x8f,0x38,0x8f,0x3a,0x8f,0x3a,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x3b,0xa,0x8f,0x23,0xe5,0x81,0x2,0xc3,0xc4,0x8f,0x30,0x83,0x73,0x8f,0x3c,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x1c,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x8f,0x25,0xd3,0xd1,0x0,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x26,0xd3,0xc6,0x8c,0x11,0xd0,0x8f,0x2e,0xd3,0xd1,0x1,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x2,0xd3,0xe1,0xd,0xc7,0x4,0xc6,0x8f,0x2f,0xc6,0x8b,0x9,0xc6,0x8b,0x2e,0xc6,0x89,0x13,0xc9,0x0,0x0,0xc6,0x85,0x38,0xcb,0x0,0xc6,0x8f,0x26,0xcb,0x1,0xc6,0x88,0x6d,0xe0,0x0,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x88,0x6d,0xd3,0xc6,0x89,0x1,0xd3,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0xc1,0x80,0x92,0xc1,0x80,0xa8,0xc1,0x80,0xbc,0xc1,0x80,0xd8,0x28,0x8f,0x3e,0x8f,0x3f,0x8f,0x3f,0x8f,0x40,0x8f,0x40,0x8f,0x3e,0x8f,0x41,0x8f,0x41,0xc1,0x2,0xa0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x42,0xa,0x8f,0x43,0xe5,0x28,0xc3,0x8f,0x1d,0xc4,0xc4,0x8f,0x44,0xe0,0x2,0xc9,0x1,0x0,0xc6,0x8a,0x7d,0xe0,0x0,0xca,0x0,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x6,0xca,0x0,0xd3,0x0,0xc1,0x81,0x3c,0x22,0x8f,0x46,0x8f,0x46,0xc1,0x2,0xa2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x47,0xa,0x8f,0x48,0xb3,0xc3,0x8f,0x29,0xc4,0xc4,0x8f,0x49,0xe1,0x2,0xc9,0x2,0x8,0xc9,0x1,0x0,0xca,0x0,0xd3,0x0,0xc1,0x80,0x6a,0xc1,0x80,0x5e,0xc1,0x80,0x56,0xc1,0x80,0x64,0xc1,0x81,0x1e,0xc1,0x81,0x14,0xc1,0x81,0x7a,0xc1,0x82,0x6,0xc1,0x81,0xf8,0xc1,0x82,0x26,0x39,0x8f,0x4b,0x8f,0x4c,0x8f,0x4c,0x8f,0x4d,0x8f,0x4d,0x8f,0x4e,0x8f,0x4e,0x8f,0x4e,0x8f,0x4c,0x8f,0x4b,0x8f,0x4f,0x8f,0x50,0x8f,0x50,0x8f,0x4f,0x8f,0x51,0x8f,0x51,0xc0,0xc0,0x8f,0x52,0x8f,0x53,0x8f,0x53,0x8f,0x52,0x8f,0x54,0x8f,0x54,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x55,0xa,0x8f,0x43,0xe5,0x81,0x1,0xc3,0xc4,0x8f,0x30,0x83,0x73,0x8f,0x56,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x1c,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x8f,0x45,0xd3,0xd1,0x0,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x26,0xd3,0xc6,0x8c,0x11,0xd0,0x8f,0x4a,0xd3,0xd1,0x1,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x2,0xd3,0xe1,0xd,0xc7,0x4,0xc6,0x8f,0x2f,0xc6,0x8b,0x9,0xc6,0x5e,0xc6,0x89,0x13,0xc9,0x0,0x0,0xc6,0x85,0x38,0xcb,0x0,0xc6,0x8f,0x26,0xcb,0x1,0xc6,0x88,0x6d,0xe0,0x0,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x88,0x6d,0xd3,0xc6,0x89,0x1,0xd3,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0xc1,0x82,0xe2,0xc1,0x82,0xf8,0xc1,0x83,0xc,0xc1,0x83,0x28,0x28,0x8f,0x58,0x8f,0x59,0x8f,0x59,0x8f,0x5a,0x8f,0x5a,0x8f,0x58,0x8f,0x5b,0x8f,0x5b,0xc1,0x2,0xaa,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x5c,0xa,0x8f,0x5d,0xe5,0x28,0xc3,0x8f,0x1d,0xc4,0xc4,0x8f,0x5e,0xe0,0x2,0xc9,0x1,0x0,0xc6,0x8a,0x7d,0xe0,0x0,0xca,0x0,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x6,0xca,0x0,0xd3,0x0,0xc1,0x83,0x8c,0x22,0x8f,0x60,0x8f,0x60,0xc1,0x2,0xac,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x61,0xa,0x8f,0x62,0xb3,0xc3,0x8f,0x29,0xc4,0xc4,0x8f,0x63,0xe1,0x2,0xc9,0x2,0x8,0xc9,0x1,0x0,0xca,0x0,0xd3,0x0,0xc1,0x82,0xba,0xc1,0x82,0xae,0xc1,0x82,0xa6,0xc1,0x82,0xb4,0xc1,0x83,0x6e,0xc1,0x83,0x64,0xc1,0x83,0xca,0xc1,0x84,0x56,0xc1,0x84,0x48,0xc1,0x84,0x76,0x39,0x8f,0x65,0x8f,0x66,0x8f,0x66,0x8f,0x67,0x8f,0x67,0x8f,0x68,0x8f,0x68,0x8f,0x68,0x8f,0x66,0x8f,0x65,0x8f,0x69,0x8f,0x6a,0x8f,0x6a,0x8f,0x69,0x8f,0x6b,0x8f,0x6b,0xc0,0xc0,0x8f,0x6c,0x8f,0x6d,0x8f,0x6d,0x8f,0x6c,0x8f,0x6e,0x8f,0x6e,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x8f,0x6f,0xa,0x8f,0x5d,0xe5,0x81,0x2,0xc3,0xc4,0x8f,0x30,0x83,0x73,0x8f,0x70,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x1c,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x8f,0x5f,0xd3,0xd1,0x0,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x26,0xd3,0xc6,0x8c,0x11,0xd0,0x8f,0x64,0xd3,0xd1,0x1,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x2,0xd3,0xe1,0xd,0xc7,0x4,0xc6,0x8f,0x2f,0xc6,0x8b,0x9,0xc6,0x89,0x13,0xc6,0x89,0x13,0xc9,0x0,0x0,0xc6,0x85,0x38,0xcb,0x0,0xc6,0x8f,0x26,0xcb,0x1,0xc6,0x88,0x6d,0xe0,0x0,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x88,0x6d,0xd3,0xc6,0x89,0x1,0xd3,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0x6,0x6c,0x65,0x78,0x74,0x6f,0x70,0x4,0x74,0x65,0x72,0x6d,0x21,0x8f,0x73,0x9,0x6c,0x69,0x6e,0x6b,0x66,0x72,0x61,0x6d,0x65,0x21,0x8f,0x75,0x23,0x89,0x14,0x8f,0x74,0x8f,0x76,0xc1,0x7b,0x8e,0xc1,0x7b,0xb2,0xc1,0x7b,0xa6,0xc1,0x7b,0xe0,0xc1,0x7b,0xf4,0xc1,0x7b,0xe6,0xc1,0x7d,0xae,0xc1,0x7d,0xa2,0xc1,0x80,0xa,0xc1,0x7f,0xfe,0xc1,0x82,0x5a,0xc1,0x82,0x4e,0xe1,0x22,0x8f,0x78,0x8f,0x79,0x8f,0x79,0x8f,0x7a,0x8f,0x7a,0x8f,0x79,0x8f,0x78,0xc0,0x8f,0x7b,0x8f,0x7c,0x8f,0x7d,0x8f,0x7c,0xc0,0x8f,0x7e,0x8f,0x7e,0x8f,0x7f,0x8f,0x7f,0x8f,0x7e,0xc0,0xc0,0x90,0x0,0x90,0x0,0x90,0x1,0x90,0x1,0x90,0x0,0xc0,0xc0,0x90,0x2,0x90,0x2,0x90,0x3,0x90,0x3,0x90,0x2,0xc0,0xc0,0xc1,0x2,0x84,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x4,0xa,0x90,0x5,0xe5,0x77,0x8f,0x72,0x8f,0x77,0x89,0x14,0x83,0x32,0x90,0x6,0xe1,0x2,0xc9,0x0,0x5,0xca,0x0,0xe1,0x2,0xc7,0x1f,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0x2e,0xd3,0xd3,0xd1,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x20,0xca,0x2,0xd3,0xd0,0x8f,0x1b,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0x2e,0xd3,0xe3,0x0,0xd0,0x8f,0x3d,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x5e,0xd3,0xe3,0x0,0xd0,0x8f,0x57,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x89,0x13,0xd3,0xe3,0x0,0xd0,0x8f,0x71,0xd3,0xd4,0x0,0xc1,0x2,0xb6,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x90,0x8,0xaa,0xc3,0xc4,0xc4,0xc4,0x90,0x9,0xc6,0x84,0x5f,0x0,0x6,0x69,0x73,0x43,0x68,0x61,0x72,0x6,0x74,0x61,0x72,0x67,0x65,0x74,0x64,0x90,0xc,0xc0,0x8b,0x9,0xc0,0x6,0xc0,0x85,0x38,0xc0,0x4,0x63,0x61,0x6c,0x6c,0x4,0x43,0x68,0x61,0x72,0x8,0x74,0x6f,0x4e,0x75,0x6d,0x62,0x65,0x72,0xc1,0x85,0xe6,0xc1,0x85,0xfc,0xc1,0x86,0x6,0xc1,0x86,0x2e,0x2f,0xc0,0xc0,0xc0,0xc0,0x90,0x11,0x90,0x11,0xc0,0x90,0x12,0x90,0x12,0x90,0x13,0x90,0x13,0x90,0x12,0x90,0x14,0x90,0x14,0xc0,0xc1,0x2,0xb8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x15,0xa,0x90,0x16,0xe5,0x51,0xc3,0xc4,0xc4,0xc4,0x90,0x17,0xe1,0x9,0xc7,0x4,0xc6,0x90,0xd,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x84,0x33,0xc6,0x88,0x6b,0xc6,0x90,0xf,0xc6,0x6,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0xc6,0x85,0x38,0xe1,0x1,0xc7,0x3,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x10,0xd3,0xd3,0xc6,0x6,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0xc1,0x2,0xba,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x90,0x19,0xaa,0xc3,0xc4,0xc4,0xc4,0x90,0x1a,0xc8,0x0,0x1,0x0,0xc1,0x2,0xbc,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x90,0x1c,0xaa,0xc3,0xc4,0xc4,0xc4,0x90,0x1d,0xc8,0x0,0x1,0x0,0xa,0x73,0x74,0x72,0x69,0x6e,0x67,0x6c,0x69,0x73,0x74,0x62,0x84,0x18,0xc0,0x8b,0x9,0xc0,0xc1,0x2,0xc2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x90,0x21,0xba,0xc3,0xc4,0xc4,0xc4,0x90,0x22,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x5a,0xc6,0x84,0x18,0xc8,0x0,0x0,0xd3,0x0,0xc1,0x88,0x3c,0x22,0x90,0x24,0x90,0x24,0xc1,0x2,0xc4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x25,0xa,0x90,0x26,0xb3,0xc3,0xc4,0xc4,0xc4,0x90,0x27,0xe1,0x2,0xc9,0x3,0x8,0xc8,0x2,0x0,0xc8,0x0,0x0,0xd3,0x0,0xc1,0x87,0xb8,0xc1,0x87,0xa8,0x27,0x90,0x29,0x90,0x2a,0x90,0x29,0xc0,0xc0,0xc0,0xc0,0xc1,0x2,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x2b,0xa,0x90,0x2c,0xbd,0xc3,0x83,0x12,0xc4,0xc4,0x90,0x2d,0xe1,0x1,0xc7,0x12,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x90,0x23,0xd3,0xc0,0xe3,0x0,0xd0,0x90,0x28,0xd3,0xd4,0x0,0x21,0x84,0x18,0xc1,0x87,0x70,0xc1,0x87,0x66,0xc1,0x89,0x4,0xc1,0x89,0x36,0x2e,0x90,0x30,0x90,0x31,0x90,0x31,0x90,0x30,0xc0,0xc0,0xc0,0xc0,0x90,0x32,0x90,0x32,0xc0,0x90,0x33,0x90,0x33,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x34,0xa,0x90,0x2c,0xe5,0x5d,0xc3,0xc4,0x90,0x2f,0x83,0x32,0x90,0x35,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x84,0x18,0xd3,0xc6,0x8c,0x11,0xd0,0x90,0x2e,0xd3,0xd1,0x0,0xe1,0x9,0xc7,0x4,0xc6,0x90,0xd,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x84,0x33,0xc6,0x88,0x6b,0xc6,0x88,0x2f,0xc6,0x6,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0xc6,0x85,0x38,0xcb,0x0,0xc6,0x6,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0x62,0x90,0xc,0xc0,0x8b,0x9,0xc0,0x62,0x8b,0x2e,0xc0,0x8b,0x9,0xc0,0x23,0x8b,0x2e,0x8b,0x16,0x8b,0x14,0xc1,0x89,0xc0,0xc1,0x8a,0x16,0x2d,0x90,0x3a,0x90,0x3a,0x90,0x3b,0xc0,0xc0,0xc0,0x90,0x3b,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc1,0x2,0xcc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x3c,0xa,0x90,0x3d,0xe5,0x5f,0xc3,0xc4,0x90,0x39,0x82,0x5d,0x90,0x3e,0xe1,0x2,0xc9,0x1,0x7,0xc8,0x0,0x0,0xc8,0x0,0x1,0xd3,0xd1,0x0,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x3b,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0x50,0xc6,0x88,0x6b,0xc6,0x17,0xc6,0x8b,0x4,0xc1,0xc6,0x8b,0x2e,0xcb,0x0,0xd3,0xd3,0xd2,0x0,0x1,0xd2,0x1,0x2,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x37,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x38,0xc6,0x8b,0x9,0xc6,0x8b,0x2e,0xc6,0x8b,0x2e,0xcb,0x2,0xd3,0xd3,0x0,0xc1,0x8c,0x14,0x22,0x90,0x40,0x90,0x40,0xc1,0x2,0xd6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x41,0xa,0x90,0x42,0xb0,0xc3,0xc4,0xc4,0xc4,0x90,0x43,0xe1,0x1,0xc9,0x2,0x3,0xc9,0x0,0x0,0xd3,0x0,0xc1,0x8b,0xa0,0xc1,0x8b,0xec,0xc1,0x8b,0xf2,0x2b,0x90,0x45,0x90,0x45,0xc0,0x90,0x46,0x90,0x47,0x90,0x47,0x90,0x47,0xc0,0xc0,0xc0,0xc0,0xc1,0x2,0xd4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x48,0xa,0x90,0x49,0xe5,0x41,0xc3,0xc4,0x8b,0x2f,0x83,0x32,0x90,0x4a,0xe0,0x3,0xc8,0x0,0x0,0xc6,0x8a,0x7b,0xc8,0x0,0x1,0xc8,0x0,0x2,0xc8,0x0,0x3,0xd3,0xd1,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x1e,0xc8,0x0,0x2,0xd3,0xd0,0x90,0x44,0xd3,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x38,0xc6,0x8b,0x9,0xc6,0x8b,0x2e,0xc6,0x8b,0x2e,0xcb,0x0,0xd3,0x0,0x62,0x6,0xc0,0x88,0x6b,0xc0,0xc1,0x8d,0xf0,0xc1,0x8e,0x6,0xc1,0x8e,0x1a,0xc1,0x8e,0x36,0x28,0x90,0x4d,0x90,0x4e,0x90,0x4e,0x90,0x4f,0x90,0x4f,0x90,0x4d,0x90,0x50,0x90,0x50,0xc1,0x2,0xe0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x51,0xa,0x90,0x52,0xe5,0x28,0xc3,0x8f,0x1d,0xc4,0xc4,0x90,0x53,0xe0,0x2,0xc9,0x0,0x1,0xc6,0x8a,0x7d,0xe0,0x0,0xca,0x0,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x6,0xca,0x0,0xd3,0x0,0x5,0x66,0x69,0x65,0x6c,0x64,0x8,0x76,0x61,0x72,0x66,0x69,0x65,0x6c,0x64,0xc1,0x2,0xfc,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x90,0x57,0xab,0xc3,0xc4,0xc4,0xc4,0x90,0x58,0xc0,0xd9,0x2,0x3,0x0,0x9,0x5f,0x73,0x65,0x74,0x66,0x69,0x65,0x6c,0x64,0x5,0x76,0x61,0x6c,0x75,0x65,0x22,0x90,0x55,0x90,0x5b,0xc1,0x91,0x80,0xc1,0x91,0x98,0xc1,0x91,0x8c,0xc1,0x92,0x12,0xc1,0x92,0x5c,0xc1,0x92,0x94,0xc1,0x92,0xb0,0xc1,0x93,0x4e,0xc1,0x93,0x9a,0xc1,0x93,0xf0,0xc1,0x94,0x28,0xc1,0x94,0x94,0xe1,0x2b,0xc0,0x90,0x5d,0x90,0x5e,0x90,0x5e,0x90,0x5f,0x90,0x5f,0x90,0x5e,0xc0,0x90,0x60,0x90,0x60,0x90,0x61,0xc0,0xc0,0x90,0x62,0x90,0x62,0x90,0x63,0x90,0x63,0xc0,0x90,0x61,0x90,0x64,0x90,0x64,0x90,0x65,0x90,0x65,0xc0,0xc0,0xc0,0xc0,0x90,0x66,0x90,0x66,0xc0,0x90,0x67,0x90,0x67,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x90,0x67,0x90,0x68,0x90,0x68,0xc0,0x90,0x65,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x69,0xa,0x90,0x57,0xe5,0x81,0x52,0xc3,0xc4,0x90,0x5c,0x83,0x73,0x90,0x6a,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x56,0xd3,0xd0,0x90,0x59,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x3,0x8,0xc9,0x1,0x1,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x8a,0x7c,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x88,0x6b,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xd3,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x1,0x4,0xc6,0x3b,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x9,0xc7,0x4,0xc6,0x90,0xd,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x84,0x33,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x88,0x6b,0xc6,0x90,0x5a,0xd3,0xc6,0x85,0x38,0xe1,0x3,0xc7,0x3,0xe1,0x3,0xc7,0x4,0xc6,0x8d,0x64,0xc6,0x8b,0x9,0xc6,0x85,0x4c,0xd3,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x84,0x18,0xc6,0x84,0x18,0xcb,0x0,0xd3,0xcb,0x1,0xd3,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0xc1,0x94,0xf2,0x26,0x90,0x6c,0x90,0x6c,0x90,0x6c,0x90,0x6c,0x90,0x6c,0x90,0x6c,0xc1,0x3,0x8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x6d,0xa,0x90,0x6e,0xb5,0xc3,0xc4,0xc4,0xc4,0x90,0x6f,0xe1,0x1,0xc7,0x22,0xe1,0x2,0xc7,0x3,0xc4,0x0,0xc4,0x2,0xd3,0xd3,0x0,0xc1,0x91,0x1e,0xc1,0x91,0x8,0xc1,0x90,0xfc,0xc1,0x91,0x36,0xc1,0x91,0x2a,0x31,0x90,0x71,0x90,0x71,0x90,0x72,0x90,0x72,0x90,0x73,0x90,0x73,0x90,0x72,0x90,0x74,0x90,0x74,0x90,0x75,0x90,0x75,0x90,0x74,0x90,0x71,0xc0,0xc0,0xc0,0xc0,0xc1,0x2,0xf8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x90,0x76,0xa,0x90,0x77,0xe5,0x3b,0xc3,0x8f,0x1d,0xc4,0xc4,0x90,0x78,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x55,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x56,0xd3,0xd3,0xe3,0x0,0xd0,0x90,0x6b,0xd3,0xc0,0xe3,0x0,0xd0,0x90,0x70,0xd3,0xd4,0x0,0x6,0x61,0x73,0x73,0x69,0x67,0x6e,0x2,0x74,0x6f,0xc1,0x97,0xb8,0xc1,0x97,0xda,0xc1,0x97,0xd4,0xc1,0x97,0xf8,0xc1,0x98,0x64,0xc1,0x98,0x72,0xc1,0x98,0x6c,0xc1,0x98,0xb2,0x37,0x90,0x7c,0xc0,0xc0,0x90,0x7d,0x90,0x7e,0x90,0x7e,0x90,0x7d,0x90,0x7f,0x90,0x7f,0xc0,0x90,0x7c,0x91,0x0,0x91,0x1,0x91,0x2,0x91,0x2,0x91,0x1,0x91,0x0,0x91,0x3,0x91,0x3,0x91,0x3,0x91,0x3,0x91,0x3,0x91,0x3,0xc1,0x3,0x16,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x4,0xa,0x91,0x5,0xe5,0x6b,0xc3,0xc4,0x8b,0x33,0x83,0x73,0x91,0x6,0xe0,0x1,0xc9,0x3,0x1,0xc6,0x3b,0xe1,0x7,0xc7,0x4,0xc6,0x8b,0x5,0xc6,0x88,0x6b,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xc6,0x8b,0x4,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x5b,0xd3,0xc6,0x89,0x13,0xc9,0x1,0x0,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe0,0x2,0xc9,0x1,0x5,0xc6,0x88,0x7d,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xcb,0x1,0xd3,0xe1,0x1,0xc7,0x22,0xe1,0x2,0xc7,0x3,0xc4,0x0,0xc4,0x2,0xd3,0xd3,0x0,0xc1,0x99,0x92,0xc1,0x99,0x8c,0xc1,0x99,0xdc,0xc1,0x99,0xf2,0xc1,0x9a,0x90,0xc1,0x9a,0xdc,0xc1,0x9b,0x38,0xc1,0x9b,0x32,0xc1,0x9b,0x70,0xc1,0x9b,0xe2,0xc1,0x9b,0xdc,0xe1,0x24,0x91,0x8,0x91,0x9,0x91,0x9,0x91,0x8,0x91,0xa,0x91,0xb,0x91,0xb,0x91,0xa,0x91,0xc,0x91,0xc,0x91,0xd,0x91,0xd,0xc0,0xc0,0xc0,0xc0,0x91,0xe,0x91,0xf,0x91,0xf,0x91,0xe,0xc0,0x91,0x10,0x91,0x10,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x91,0x10,0x91,0x11,0x91,0x12,0x91,0x12,0x91,0x11,0xc0,0x91,0xd,0xc1,0x3,0x1e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x13,0xa,0x91,0x14,0xe5,0x81,0x2f,0xc3,0xc4,0x90,0x5c,0x83,0x73,0x91,0x15,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x3,0x8,0xc9,0x1,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x5b,0xd3,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x1,0x4,0xc6,0x3b,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x9,0xc7,0x4,0xc6,0x90,0xd,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x84,0x33,0xc6,0x6,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x7b,0xd3,0xc6,0x6,0xd3,0xc6,0x88,0x6b,0xc6,0x90,0x5a,0xd3,0xc6,0x85,0x38,0xe1,0x3,0xc7,0x3,0xe1,0x3,0xc7,0x4,0xc6,0x8d,0x64,0xc6,0x8b,0x9,0xc6,0x85,0x4c,0xd3,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x84,0x18,0xc6,0x84,0x18,0xcb,0x0,0xd3,0xcb,0x1,0xd3,0xc6,0x6,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x7b,0xd3,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0x6,0x6e,0x65,0x77,0x76,0x61,0x72,0xc1,0x9d,0x4,0xc1,0x9c,0xfe,0xc1,0x9d,0x4e,0xc1,0x9d,0x64,0xc1,0x9e,0x2,0xc1,0x9e,0x4e,0xc1,0x9e,0xaa,0xc1,0x9e,0xa4,0xc1,0x9e,0xe2,0xc1,0x9f,0x54,0xc1,0x9f,0x4e,0xe1,0x24,0x91,0x18,0x91,0x19,0x91,0x19,0x91,0x18,0x91,0x1a,0x91,0x1b,0x91,0x1b,0x91,0x1a,0x91,0x1c,0x91,0x1c,0x91,0x1d,0x91,0x1d,0xc0,0xc0,0xc0,0xc0,0x91,0x1e,0x91,0x1f,0x91,0x1f,0x91,0x1e,0xc0,0x91,0x20,0x91,0x20,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x91,0x20,0x91,0x21,0x91,0x22,0x91,0x22,0x91,0x21,0xc0,0x91,0x1d,0xc1,0x3,0x2a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x23,0xa,0x91,0x24,0xe5,0x81,0x33,0xc3,0xc4,0x90,0x5c,0x83,0x73,0x91,0x25,0xc0,0xd9,0x1,0x3,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x3,0x8,0xc9,0x1,0x1,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x90,0x5b,0xd3,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x1,0x4,0xc6,0x3b,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x9,0xc7,0x4,0xc6,0x90,0xd,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x84,0x33,0xc6,0x6,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x7b,0xd3,0xc6,0x6,0xd3,0xc6,0x88,0x6b,0xc6,0x90,0x5a,0xd3,0xc6,0x85,0x38,0xe1,0x3,0xc7,0x3,0xe1,0x3,0xc7,0x4,0xc6,0x8d,0x64,0xc6,0x8b,0x9,0xc6,0x85,0x4c,0xd3,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x84,0x18,0xc6,0x84,0x18,0xcb,0x0,0xd3,0xcb,0x1,0xd3,0xc6,0x6,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x7b,0xd3,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0xe0,0x31,0x63,0x6c,0x61,0x73,0x73,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x61,0x20,0x27,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x76,0x61,0x6c,0x75,0x65,0x27,0x20,0x6f,0x6e,0x20,0x6c,0x69,0x6e,0x65,0x20,0x4,0x63,0x68,0x61,0x72,0x22,0xa,0x91,0x28,0xc1,0xa1,0x8,0xc1,0xa1,0x10,0xc1,0xa1,0x56,0xc1,0xa1,0x4c,0x2a,0x91,0x2a,0x91,0x2b,0x91,0x2b,0x91,0x2a,0x91,0x2c,0x91,0x2d,0xc0,0xc0,0xc0,0x91,0x2c,0xc1,0x3,0x38,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x2e,0xa,0x91,0x2f,0xe5,0x2c,0xc3,0xc4,0x91,0x29,0x83,0x73,0x91,0x30,0xe1,0x1,0xc9,0x4,0xd,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x6,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x18,0xe1,0x2,0xc7,0x19,0xc6,0x91,0x27,0xcb,0x0,0xd3,0xd3,0x0,0xc1,0xa3,0x26,0xc1,0xa3,0xce,0xc1,0xa4,0x50,0x30,0x91,0x32,0xc0,0xc0,0xc0,0x91,0x32,0x91,0x33,0xc0,0xc0,0xc0,0x91,0x33,0x91,0x34,0x91,0x34,0x91,0x34,0x91,0x34,0x91,0x34,0x91,0x34,0xc1,0x3,0x42,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x35,0xa,0x91,0x36,0xe5,0x60,0xc3,0xc4,0x8b,0x33,0x83,0x73,0x91,0x37,0xe0,0x1,0xc9,0x4,0x1,0xc6,0x3b,0xe1,0x7,0xc7,0x4,0xc6,0x8b,0x5,0xc6,0x88,0x6b,0xc9,0x0,0x0,0xc6,0x8b,0x4,0xc9,0x0,0x1,0xc6,0x89,0x13,0xc9,0x2,0x0,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe0,0x2,0xc9,0x2,0x8,0xc6,0x88,0x7d,0xc9,0x0,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x38,0xc6,0x8b,0x9,0xc6,0x8b,0x2e,0xc6,0x8b,0x2e,0xcb,0x1,0xd3,0xd3,0xe1,0x1,0xc7,0x22,0xe1,0x3,0xc7,0x3,0xc4,0x0,0xc4,0x1,0xc4,0x3,0xd3,0xd3,0x0,0x23,0x90,0x55,0x90,0x5b,0x90,0x5b,0xc1,0xa0,0x50,0xc1,0xa0,0x7c,0xc1,0xa0,0x72,0xc1,0xa0,0x66,0xc1,0xa0,0x5c,0xc1,0xa0,0x82,0xc1,0xa0,0xa0,0xc1,0xa0,0x9a,0xc1,0xa0,0x90,0xc1,0xa2,0x18,0xc1,0xa2,0x12,0xc1,0xa2,0x8,0xc1,0xa2,0x6c,0xc1,0xa2,0x66,0xc1,0xa2,0x5c,0xc1,0xa2,0x9a,0xc1,0xa2,0xb6,0xc1,0xa2,0xaa,0xc1,0xa4,0xa0,0xc1,0xa5,0x6,0xc1,0xa5,0x4e,0xe1,0x34,0xc0,0x91,0x3a,0x91,0x3b,0x91,0x3b,0x91,0x3c,0x91,0x3c,0x91,0x3d,0x91,0x3e,0x91,0x3e,0x91,0x3d,0x91,0x3c,0x91,0x3f,0x91,0x3f,0x91,0x40,0x91,0x41,0x91,0x42,0x91,0x42,0x91,0x41,0x91,0x40,0x91,0x3f,0x91,0x3b,0xc0,0x91,0x43,0x91,0x44,0x91,0x45,0x91,0x45,0x91,0x44,0x91,0x43,0x91,0x46,0x91,0x47,0x91,0x48,0x91,0x48,0x91,0x47,0x91,0x46,0xc0,0x91,0x49,0x91,0x4a,0x91,0x4a,0x91,0x4b,0x91,0x4b,0x91,0x4a,0xc0,0x91,0x4c,0x91,0x4c,0x91,0x4d,0x91,0x4d,0x91,0x4e,0x91,0x4e,0x91,0x4e,0x91,0x4e,0x91,0x4e,0x91,0x4e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x4f,0xa,0x91,0x2f,0xe5,0x81,0x3b,0xc3,0xc4,0x91,0x39,0x82,0x5d,0x91,0x50,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x1f,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x38,0xd3,0xc6,0x82,0x56,0xd3,0xc4,0x1,0xd3,0xe1,0x1,0xc7,0x1e,0xe8,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x38,0xd3,0xc6,0x84,0xa,0xc4,0x1,0xd3,0xc6,0x82,0x5b,0xd3,0xd3,0xd3,0xd0,0x91,0x31,0xd3,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x38,0xd3,0xc6,0x84,0xa,0xc4,0x1,0xd3,0xc6,0x82,0x5b,0xd3,0xd1,0x0,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x38,0xd3,0xc6,0x84,0xa,0xc4,0x1,0xd3,0xc6,0x47,0xd3,0xd1,0x1,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0x2e,0xd3,0xd0,0x91,0x38,0xd3,0xe1,0x2,0xc9,0x3,0x8,0xc9,0x1,0x0,0xcb,0x1,0xd3,0xd1,0x2,0xe0,0x2,0xc9,0x1,0x8,0xc6,0x88,0x7d,0xcb,0x0,0xcb,0x2,0xd3,0xe1,0x1,0xc7,0x22,0xe1,0x2,0xc7,0x3,0xc4,0x0,0xc4,0x2,0xd3,0xd3,0x0,0x6,0x65,0x78,0x74,0x65,0x6e,0x64,0xe0,0x21,0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,0x65,0x78,0x74,0x65,0x6e,0x64,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x72,0x20,0x6f,0x6e,0x20,0x6c,0x69,0x6e,0x65,0x20,0xc1,0xa7,0x2,0xc1,0xa7,0xa,0xc1,0xa7,0x50,0xc1,0xa7,0x46,0x2a,0x91,0x54,0x91,0x55,0x91,0x55,0x91,0x54,0x91,0x56,0x91,0x57,0xc0,0xc0,0xc0,0x91,0x56,0xc1,0x3,0x52,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x58,0xa,0x91,0x59,0xe5,0x2c,0xc3,0xc4,0x91,0x29,0x83,0x73,0x91,0x5a,0xe1,0x1,0xc9,0x4,0xd,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x6,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x18,0xe1,0x2,0xc7,0x19,0xc6,0x91,0x53,0xcb,0x0,0xd3,0xd3,0x0,0xc1,0xa8,0x5c,0xc1,0xa8,0x78,0x24,0x91,0x5c,0x91,0x5d,0x91,0x5d,0x91,0x5c,0xc1,0x3,0x5a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x5e,0xa,0x91,0x5f,0xb9,0xc3,0xc4,0xc4,0xc4,0x91,0x60,0xe1,0x2,0xc9,0x4,0x8,0xc9,0x2,0x0,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x90,0xc,0xd3,0xd3,0x0,0xc1,0xa8,0xf6,0x22,0x91,0x62,0x91,0x62,0xc1,0x3,0x5c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x63,0xa,0x91,0x64,0xb3,0xc3,0xc4,0xc4,0xc4,0x91,0x65,0xe1,0x2,0xc9,0x4,0x8,0xc9,0x2,0x0,0xc9,0x0,0x0,0xd3,0x0,0xc1,0xa9,0xac,0xc1,0xa9,0xb4,0xc1,0xaa,0x30,0xc1,0xaa,0x26,0x2a,0x91,0x67,0x91,0x68,0x91,0x68,0x91,0x67,0x91,0x69,0x91,0x6a,0xc0,0xc0,0xc0,0x91,0x69,0xc1,0x3,0x5e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x6b,0xa,0x91,0x6c,0xe5,0x2c,0xc3,0xc4,0x91,0x29,0x83,0x73,0x91,0x6d,0xe1,0x1,0xc9,0x4,0xd,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x6,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x18,0xe1,0x2,0xc7,0x19,0xc6,0x91,0x53,0xcb,0x0,0xd3,0xd3,0x0,0xc1,0xac,0xa4,0x22,0x91,0x6f,0x91,0x6f,0xc1,0x3,0x68,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x70,0xa,0x91,0x71,0xb0,0xc3,0x8f,0x29,0xc4,0xc4,0x91,0x72,0xe8,0x0,0xca,0x0,0xc6,0x82,0x5b,0xd3,0x0,0xc1,0xad,0x1c,0xc1,0xad,0x32,0x24,0x91,0x74,0x91,0x75,0x91,0x75,0x91,0x74,0xc1,0x3,0x6a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x91,0x76,0xa,0x91,0x77,0xb8,0xc3,0x8f,0x29,0xc4,0xc4,0x91,0x78,0xe1,0x2,0xc9,0x4,0x8,0xc9,0x2,0x1,0xe0,0x0,0xca,0x0,0xc6,0x47,0xd3,0xd3,0x0,0x65,0x90,0xc,0xc0,0x8b,0x9,0xc0,0x6,0xc0,0x8b,0x13,0xc0,0x85,0x38,0xc0,0x7,0x5f,0x65,0x78,0x74,0x65,0x6e,0x64,0x1,0x74,0x3,0x63,0x6c,0x73,0x3,0x74,0x68,0x73,0x26,0x91,0x7c,0x90,0xc,0x91,0x7d,0x91,0x7e,0x8b,0x13,0x85,0x38,0x26,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xa6,0x52,0xc1,0xa6,0x7e,0xc1,0xa6,0x74,0xc1,0xa6,0x68,0xc1,0xa6,0x5e,0xc1,0xa6,0x9a,0xc1,0xa6,0x94,0xc1,0xa6,0x8a,0xc1,0xa7,0xea,0xc1,0xa7,0xe4,0xc1,0xa7,0xda,0xc1,0xa8,0x3c,0xc1,0xa8,0x30,0xc1,0xa8,0xd6,0xc1,0xa8,0xca,0xc1,0xaa,0xba,0xc1,0xab,0xe,0xc1,0xab,0x44,0xc1,0xab,0xa6,0xc1,0xab,0xdc,0xc1,0xac,0x84,0xc1,0xac,0x62,0xc1,0xac,0x3c,0xc1,0xac,0x76,0xc1,0xac,0x6a,0xc1,0xac,0x7c,0xc1,0xac,0xfc,0xc1,0xac,0xf0,0xc1,0xac,0xe4,0xc1,0xac,0xf6,0xc1,0xad,0x6e,0xc1,0xad,0xc4,0xc1,0xae,0x2e,0xc1,0xad,0xf8,0xc1,0xae,0x24,0xc1,0xae,0x18,0xc1,0xae,0x4a,0xe1,0x6b,0xc0,0x92,0x1,0x92,0x2,0x92,0x2,0x92,0x3,0x92,0x3,0x92,0x4,0x92,0x5,0x92,0x5,0x92,0x4,0x92,0x3,0x92,0x6,0x92,0x7,0x92,0x8,0x92,0x8,0x92,0x7,0x92,0x6,0x92,0x2,0xc0,0x92,0x9,0x92,0xa,0x92,0xb,0x92,0xb,0x92,0xa,0x92,0x9,0x92,0xc,0x92,0xc,0x92,0xd,0x92,0xd,0x92,0xc,0xc0,0xc0,0x92,0xe,0x92,0xe,0x92,0xf,0x92,0xf,0x92,0xe,0xc0,0xc0,0xc0,0xc0,0x92,0x10,0x92,0x10,0x92,0x11,0xc0,0xc0,0x92,0x12,0x92,0x12,0xc0,0x92,0x11,0x92,0x13,0xc0,0xc0,0x92,0x14,0x92,0x14,0xc0,0x92,0x13,0x92,0x15,0x92,0x16,0x92,0x16,0x92,0x17,0x92,0x17,0x92,0x17,0x92,0x18,0x92,0x18,0x92,0x19,0x92,0x19,0x92,0x1a,0x92,0x1a,0x92,0x1a,0x92,0x18,0x92,0x16,0x92,0x15,0x92,0x1b,0x92,0x1c,0x92,0x1c,0x92,0x1d,0x92,0x1d,0x92,0x1e,0x92,0x1e,0x92,0x1e,0x92,0x1c,0x92,0x1b,0x92,0x1f,0x92,0x1f,0xc0,0xc0,0xc0,0xc0,0x92,0x20,0x92,0x20,0xc0,0x92,0x21,0x92,0x21,0x92,0x22,0x92,0x22,0x92,0x23,0x92,0x23,0x92,0x24,0x92,0x24,0x92,0x23,0x92,0x22,0x92,0x21,0x92,0x25,0x92,0x25,0xc0,0x92,0x1f,0x64,0x4,0xc8,0x5,0xc3,0x6,0x92,0x26,0xa,0x91,0x59,0xe5,0x83,0x21,0xc3,0xc4,0x91,0x7f,0x92,0x0,0x92,0x27,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x1f,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x38,0xd3,0xc6,0x82,0x56,0xd3,0xc4,0x1,0xd3,0xe8,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x38,0xd3,0xc6,0x84,0xa,0xc4,0x1,0xd3,0xc6,0x82,0x5b,0xd3,0xd3,0xd0,0x91,0x5b,0xd3,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x38,0xd3,0xc6,0x84,0xa,0xc4,0x1,0xd3,0xc6,0x47,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0xe,0xd3,0xe3,0x0,0xd0,0x91,0x61,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x8a,0x7c,0xd3,0xe3,0x0,0xd0,0x91,0x66,0xd3,0xc0,0xe3,0x0,0xd0,0x91,0x6e,0xd3,0xd4,0xd1,0x1,0xe0,0x1,0xc9,0x1,0x7,0xc6,0x3b,0xcb,0x1,0xd3,0xe1,0x2,0xc9,0x3,0x8,0xc9,0x1,0x1,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x8a,0x7c,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x88,0x6b,0xc6,0x8b,0x43,0xd3,0xd3,0xd1,0x2,0xe1,0x2,0xc9,0x3,0x8,0xc9,0x1,0x1,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x8a,0x7c,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x88,0x6b,0xc6,0x85,0x4c,0xd3,0xd3,0xd1,0x3,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x9,0xe1,0x3,0xc7,0x3,0xc2,0xc2,0xc2,0xd3,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xcb,0x0,0xc6,0x85,0x38,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x91,0x73,0xd3,0xd1,0x4,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xcb,0x0,0xc6,0x85,0x38,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x91,0x79,0xd3,0xd1,0x5,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0xb,0xc7,0x4,0xc6,0x91,0x7a,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x84,0x33,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x88,0x6b,0xc6,0x91,0x7b,0xd3,0xc6,0x85,0x38,0xe1,0x2,0xc7,0x9,0xe1,0x3,0xc7,0x3,0xcb,0x2,0xcb,0x3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc9,0x1,0x7,0xc6,0x82,0x56,0xd3,0xc4,0x1,0xd3,0xd3,0xcb,0x5,0xd3,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x8b,0x13,0xcb,0x4,0xd3,0xd3,0x0,0xc1,0x3,0x6e,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x92,0x29,0xa8,0xc3,0xc4,0xc4,0xc4,0x92,0x2a,0xc2,0x0,0x22,0x8f,0x28,0x8e,0x52,0xc1,0x97,0x26,0xc1,0x97,0xe,0xc1,0x97,0x2,0xc1,0x97,0x4c,0xc1,0x97,0x40,0xc1,0x97,0x34,0xc1,0x99,0x12,0xc1,0x98,0xfa,0xc1,0x98,0xee,0xc1,0x99,0x32,0xc1,0x99,0x26,0xc1,0x99,0x20,0xc1,0x9c,0x3c,0xc1,0x9c,0x24,0xc1,0x9c,0x18,0xc1,0x9c,0x5c,0xc1,0x9c,0x50,0xc1,0x9c,0x4a,0xc1,0x9f,0xe4,0xc1,0x9f,0xaa,0xc1,0x9f,0x96,0xc1,0x9f,0x8a,0xc1,0x9f,0xd2,0xc1,0x9f,0xc6,0xc1,0x9f,0xb8,0xc1,0xa0,0xc,0xc1,0xa0,0x0,0xc1,0x9f,0xf2,0xc1,0xa5,0xe4,0xc1,0xa5,0xaa,0xc1,0xa5,0x96,0xc1,0xa5,0x8a,0xc1,0xa5,0xd2,0xc1,0xa5,0xc6,0xc1,0xa5,0xb8,0xc1,0xa6,0xc,0xc1,0xa6,0x0,0xc1,0xa5,0xf2,0xc1,0xaf,0x3c,0xe1,0x6d,0x92,0x2d,0x92,0x2d,0x92,0x2e,0x92,0x2e,0x92,0x2f,0x92,0x2f,0x92,0x2e,0x92,0x30,0x92,0x30,0x92,0x31,0x92,0x32,0x92,0x32,0x92,0x31,0x92,0x30,0x92,0x2d,0xc0,0xc0,0x92,0x33,0x92,0x33,0x92,0x34,0x92,0x34,0x92,0x35,0x92,0x35,0x92,0x34,0x92,0x36,0x92,0x36,0x92,0x37,0x92,0x38,0x92,0x38,0x92,0x37,0x92,0x36,0x92,0x33,0xc0,0xc0,0x92,0x39,0x92,0x39,0x92,0x3a,0x92,0x3a,0x92,0x3b,0x92,0x3b,0x92,0x3a,0x92,0x3c,0x92,0x3c,0x92,0x3d,0x92,0x3e,0x92,0x3e,0x92,0x3d,0x92,0x3c,0x92,0x39,0xc0,0xc0,0x92,0x3f,0x92,0x3f,0x92,0x40,0x92,0x40,0x92,0x41,0x92,0x41,0x92,0x42,0x92,0x42,0x92,0x41,0x92,0x43,0x92,0x43,0x92,0x44,0x92,0x45,0x92,0x45,0x92,0x44,0x92,0x43,0x92,0x40,0x92,0x46,0x92,0x46,0x92,0x47,0x92,0x48,0x92,0x48,0x92,0x47,0x92,0x46,0x92,0x3f,0xc0,0xc0,0x92,0x49,0x92,0x49,0x92,0x4a,0x92,0x4a,0x92,0x4b,0x92,0x4b,0x92,0x4c,0x92,0x4c,0x92,0x4b,0x92,0x4d,0x92,0x4d,0x92,0x4e,0x92,0x4f,0x92,0x4f,0x92,0x4e,0x92,0x4d,0x92,0x4a,0x92,0x50,0x92,0x50,0x92,0x51,0x92,0x52,0x92,0x52,0x92,0x51,0x92,0x50,0x92,0x49,0xc0,0xc0,0xc0,0xc0,0x92,0x53,0x92,0x53,0xc1,0x3,0xe,0x64,0x4,0xc8,0x5,0xc3,0x6,0x92,0x54,0xa,0x92,0x55,0xe5,0x82,0x46,0xc3,0x92,0x2c,0xc4,0xc4,0x92,0x56,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x7a,0xd3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xe8,0x0,0xca,0x0,0xc6,0x90,0x5b,0xd3,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0x2e,0xd3,0xd3,0xe3,0x0,0xd0,0x91,0x7,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x7a,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x90,0x7b,0xd3,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0x2b,0xd3,0xd3,0xe3,0x0,0xd0,0x91,0x16,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x7a,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x90,0x7b,0xd3,0xc6,0x8b,0x9,0xd3,0xc6,0x91,0x17,0xd3,0xd3,0xe3,0x0,0xd0,0x91,0x26,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0xe,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x90,0xc,0xd3,0xc6,0x8b,0x9,0xd3,0xc6,0x8a,0x7c,0xd3,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x90,0xc,0xd3,0xc6,0x88,0x6b,0xd3,0xc6,0x8b,0x43,0xd3,0xd3,0xe3,0x0,0xd0,0x91,0x51,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0xe,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x90,0xc,0xd3,0xc6,0x8b,0x9,0xd3,0xc6,0x8a,0x7c,0xd3,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x90,0xc,0xd3,0xc6,0x88,0x6b,0xd3,0xc6,0x91,0x52,0xd3,0xd3,0xe3,0x0,0xd0,0x92,0x28,0xd3,0xc0,0xe3,0x0,0xd0,0x92,0x2b,0xd3,0xd4,0xe1,0x2,0xc9,0x2,0x8,0xc9,0x0,0x1,0xca,0x0,0xd3,0x0,0xc,0x5f,0x63,0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,0xb,0x63,0x6c,0x61,0x73,0x73,0x66,0x69,0x65,0x6c,0x64,0x73,0x7,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x63,0x92,0x59,0xc0,0x8b,0x2,0xc0,0x92,0x5a,0xc0,0x5,0x74,0x6f,0x4d,0x61,0x70,0x1,0x6b,0x21,0x92,0x5d,0x22,0x92,0x5e,0x48,0xc1,0xb5,0xd2,0x22,0x92,0x60,0x92,0x60,0xc1,0x3,0x96,0x64,0x4,0xc8,0x5,0xc3,0x6,0x92,0x61,0xa,0x92,0x62,0xb0,0xc3,0x92,0x5f,0xc4,0xc4,0x92,0x63,0xe8,0x0,0xca,0x1,0xc6,0x8b,0x2e,0xd3,0x0,0x6,0x66,0x69,0x6c,0x74,0x65,0x72,0xc1,0xb6,0x96,0x22,0x92,0x66,0x92,0x66,0xc1,0x3,0x9a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x92,0x67,0xa,0x92,0x68,0xb0,0xc3,0x92,0x5f,0xc4,0xc4,0x92,0x69,0xe1,0x1,0xc9,0x3,0x3,0xca,0x1,0xd3,0x0,0xc1,0xb7,0xc,0x22,0x92,0x6b,0x92,0x6b,0xc1,0x3,0x9c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x92,0x6c,0xa,0x92,0x6d,0xaf,0xc3,0x49,0xc4,0xc4,0x92,0x6e,0xe1,0x1,0xc9,0x3,0x3,0xca,0x0,0xd3,0x0,0xc1,0xb6,0x6c,0xc1,0xb6,0x5c,0xc1,0xb6,0xe8,0xc1,0xb6,0xd0,0x28,0x92,0x70,0x92,0x71,0x92,0x71,0x92,0x70,0x92,0x72,0x92,0x73,0x92,0x73,0x92,0x72,0xc1,0x3,0x98,0x64,0x4,0xc8,0x5,0xc3,0x6,0x92,0x74,0xa,0x92,0x75,0xe5,0x2b,0xc3,0xc4,0xc4,0xc4,0x92,0x76,0xf0,0x1,0x83,0x24,0xe0,0x0,0xce,0xc6,0x92,0x5a,0xd3,0xc6,0x83,0x25,0xd0,0x92,0x6a,0xd3,0xf0,0x1,0x83,0x24,0xe0,0x0,0xce,0xc6,0x92,0x59,0xd3,0xc6,0x83,0x25,0xd0,0x92,0x6f,0xd3,0x0,0xc1,0xb7,0x92,0x26,0x92,0x78,0x92,0x78,0xc0,0xc0,0xc0,0x92,0x78,0xc1,0x3,0xa2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x92,0x79,0xa,0x92,0x7a,0xe5,0x22,0xc3,0x92,0x5f,0xc4,0xc4,0x92,0x7b,0xe1,0x2,0xc7,0x3,0xca,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x38,0xc6,0x8b,0x9,0xc6,0x8b,0x2e,0xc6,0x8b,0x2e,0xca,0x1,0xd3,0xd3,0x0,0xc1,0xb8,0x2a,0x22,0x92,0x7d,0x92,0x7d,0xc1,0x3,0xa4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x92,0x7e,0xa,0x92,0x7f,0xb4,0xc3,0x92,0x5f,0xc4,0xc4,0x93,0x0,0xe0,0x2,0xc9,0x0,0x5,0xc6,0x88,0x7d,0xca,0x0,0xc2,0xd3,0x0,0xc1,0xb8,0x9c,0x23,0x93,0x2,0x93,0x2,0x93,0x2,0xc1,0x3,0xa8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x93,0x3,0xa,0x93,0x4,0xb1,0xc3,0x92,0x5f,0xc4,0xc4,0x93,0x5,0xe1,0x2,0xc7,0x3,0xca,0x0,0xca,0x1,0xd3,0x0,0xc1,0xb9,0xc,0x22,0x93,0x7,0x93,0x7,0xc1,0x3,0xaa,0x64,0x4,0xc8,0x5,0xc3,0x6,0x93,0x8,0xa,0x93,0x9,0xb4,0xc3,0x92,0x5f,0xc4,0xc4,0x93,0xa,0xe0,0x2,0xc9,0x0,0x8,0xc6,0x88,0x7d,0xca,0x0,0xc2,0xd3,0x0,0x4,0x66,0x69,0x6c,0x6c,0x63,0x93,0xc,0xc0,0x8b,0x9,0xc0,0x8c,0x11,0xc0,0x6,0x6f,0x62,0x6a,0x65,0x63,0x74,0x6,0x5f,0x63,0x6c,0x61,0x73,0x73,0x6,0x3c,0x41,0x6e,0x6f,0x6e,0x3e,0x4,0x6c,0x69,0x73,0x74,0xc1,0x3,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0x93,0x12,0xbb,0xc3,0x8e,0x53,0xc4,0xc4,0x93,0x13,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x84,0x18,0xc6,0x84,0x18,0xca,0x0,0xd3,0x0,0xa,0x6f,0x75,0x74,0x65,0x72,0x73,0x63,0x6f,0x70,0x65,0x7,0x6d,0x75,0x74,0x61,0x62,0x6c,0x65,0x6,0x66,0x69,0x65,0x6c,0x64,0x73,0xc,0x63,0x6c,0x61,0x73,0x73,0x6d,0x75,0x74,0x61,0x62,0x6c,0x65,0x7,0x65,0x78,0x74,0x65,0x6e,0x64,0x73,0xc,0x61,0x72,0x67,0x66,0x69,0x65,0x6c,0x64,0x69,0x6e,0x69,0x74,0xb,0x63,0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,0x5,0x6d,0x66,0x69,0x6c,0x6c,0x5,0x63,0x66,0x69,0x6c,0x6c,0x34,0x93,0x15,0x89,0x13,0x85,0x38,0x93,0x16,0x93,0x17,0x92,0x5a,0x93,0x18,0x93,0x19,0x92,0x59,0x93,0x1a,0x8f,0x26,0x8f,0x26,0x93,0x1b,0x8b,0x16,0x8b,0x14,0x93,0x1b,0x93,0x1c,0x93,0x1d,0x92,0x5a,0x92,0x59,0x34,0xc1,0xc1,0xc1,0xc2,0xc1,0xc1,0xc2,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0x8d,0x30,0xc1,0x8d,0xc8,0xc1,0x8d,0xa4,0xc1,0x8d,0x68,0xc1,0x8d,0x96,0xc1,0x8d,0xba,0xc1,0x8d,0xb2,0xc1,0x8d,0xc0,0xc1,0x8e,0xfa,0xc1,0x8e,0xf0,0xc1,0x8f,0x3e,0xc1,0x8f,0x30,0xc1,0x90,0x8,0xc1,0x8f,0xfe,0xc1,0x90,0x54,0xc1,0x90,0x46,0xc1,0x90,0xb4,0xc1,0x90,0xa8,0xc1,0x90,0xa0,0xc1,0x90,0xae,0xc1,0xaf,0x70,0xc1,0x95,0x5a,0xc1,0x95,0x50,0xc1,0xaf,0x80,0xc1,0xaf,0xb8,0xc1,0xb2,0xca,0xc1,0xb3,0x78,0xc1,0xb3,0x6a,0xc1,0xb3,0x98,0xc1,0xb3,0xde,0xc1,0xb4,0xf4,0xc1,0xb5,0x56,0xc1,0xb5,0xe6,0xc1,0xb5,0xb6,0xc1,0xb7,0x78,0xc1,0xb8,0x0,0xc1,0xb8,0x82,0xc1,0xb8,0xda,0xc1,0xb9,0xa0,0xc1,0xba,0x3a,0xc1,0xbb,0x50,0xc1,0xbb,0x96,0xc1,0xbb,0xc8,0xc1,0xbc,0x20,0xc1,0xbc,0x64,0xc1,0xbc,0x5c,0xc1,0xbd,0x20,0xc1,0xbd,0x82,0xe1,0x81,0xb,0x93,0x20,0x93,0x20,0x93,0x21,0x93,0x22,0x93,0x22,0x93,0x23,0x93,0x23,0xc0,0xc0,0x93,0x24,0x93,0x24,0xc0,0x93,0x23,0x93,0x25,0x93,0x25,0x93,0x26,0x93,0x26,0x93,0x27,0x93,0x27,0x93,0x27,0x93,0x25,0x93,0x22,0x93,0x21,0x93,0x28,0x93,0x29,0x93,0x28,0x93,0x2a,0x93,0x2b,0x93,0x2a,0x93,0x2c,0x93,0x2d,0x93,0x2c,0x93,0x2e,0x93,0x2f,0x93,0x2e,0x93,0x30,0x93,0x31,0x93,0x31,0x93,0x32,0x93,0x32,0x93,0x33,0x93,0x33,0x93,0x33,0x93,0x31,0x93,0x30,0x93,0x34,0x93,0x35,0x93,0x36,0x93,0x36,0x93,0x35,0x93,0x37,0xc0,0xc0,0x93,0x38,0x93,0x38,0xc0,0x93,0x37,0x93,0x34,0x93,0x39,0x93,0x39,0x93,0x39,0xc0,0xc0,0x93,0x3a,0x93,0x3b,0x93,0x3b,0x93,0x3a,0x93,0x3c,0x93,0x3c,0xc0,0x93,0x3d,0xc0,0xc0,0xc0,0x93,0x3d,0xc0,0xc0,0xc0,0x93,0x3e,0xc0,0xc0,0x93,0x3f,0x93,0x3f,0x93,0x40,0x93,0x41,0x93,0x41,0x93,0x40,0xc0,0x93,0x3e,0x93,0x42,0x93,0x42,0x93,0x43,0x93,0x43,0x93,0x44,0x93,0x44,0x93,0x45,0x93,0x45,0xc0,0xc0,0x93,0x46,0x93,0x46,0xc0,0xc0,0xc0,0x93,0x47,0x93,0x47,0xc0,0xc0,0xc0,0x93,0x48,0x93,0x48,0xc0,0xc0,0x93,0x49,0x93,0x49,0xc0,0x93,0x4a,0x93,0x4a,0xc0,0xc0,0x93,0x4b,0x93,0x4b,0x93,0x4b,0xc0,0x93,0x4c,0x93,0x4d,0x93,0x4c,0xc0,0xc0,0x93,0x4e,0x93,0x4e,0xc0,0xc0,0xc0,0x93,0x4f,0x93,0x4f,0xc0,0x93,0x4a,0xc0,0xc1,0x2,0xdc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x93,0x50,0xa,0x93,0x51,0xe5,0x85,0x41,0xc3,0xc4,0x93,0x1e,0x93,0x1f,0x93,0x52,0xc8,0x0,0x0,0xd1,0x0,0xe1,0x1,0xc9,0x1,0x5,0xc8,0x0,0x0,0xd3,0xd1,0x1,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x4c,0xc6,0x88,0x6b,0xc6,0x8b,0x43,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0xd3,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x1c,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x90,0x54,0xd3,0xd1,0x2,0xc1,0xd6,0x3,0xe0,0x0,0xc7,0x15,0xc6,0x83,0x23,0xd3,0xd1,0x4,0xe0,0x0,0xc7,0x1d,0xc6,0x83,0x23,0xd3,0xd1,0x5,0xc1,0xd6,0x6,0xe0,0x0,0xc7,0x15,0xc6,0x83,0x23,0xd3,0xd1,0x7,0xe0,0x0,0xc7,0x1d,0xc6,0x83,0x23,0xd3,0xd1,0x8,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x1c,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x90,0x79,0xd3,0xd1,0x9,0xe0,0x1,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x26,0xd3,0xc6,0x8c,0x11,0xd0,0x92,0x57,0xd3,0xc6,0x3b,0xe1,0x2,0xc9,0x1,0x8,0xcb,0x1,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x8a,0x7c,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xc6,0x88,0x6b,0xc6,0x85,0x4c,0xd3,0xd3,0xd3,0xd1,0xa,0xe1,0x2,0xc7,0x9,0xcb,0x9,0xcb,0xa,0xd3,0xd1,0xb,0xe1,0xd,0xc7,0x4,0xc6,0x8f,0x2f,0xc6,0x8b,0x9,0xc6,0x8b,0x2e,0xc6,0x89,0x13,0xcb,0x1,0xc6,0x85,0x38,0xcb,0x2,0xc6,0x8f,0x26,0xcb,0xb,0xc6,0x88,0x6d,0xe0,0x0,0xe0,0x0,0xcb,0x1,0xc6,0x88,0x6d,0xd3,0xc6,0x89,0x1,0xd3,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0xd1,0xc,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x3b,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0x50,0xc6,0x88,0x6b,0xc6,0x92,0x58,0xc6,0x8b,0x4,0xc1,0xc6,0x8b,0x2e,0xcb,0xc,0xd3,0xd3,0xd2,0x0,0xd,0xd2,0x1,0xe,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x38,0xc6,0x8b,0x9,0xc6,0x8b,0x2e,0xc6,0x8b,0x2e,0xcb,0xe,0xd3,0xd1,0xf,0xe0,0x2,0xcb,0x0,0xc6,0x8a,0x7a,0xe1,0x7,0xc7,0x4,0xc6,0x92,0x5b,0xc6,0x92,0x5a,0xe0,0x0,0xcb,0x5,0xc6,0x92,0x5c,0xd3,0xc6,0x92,0x59,0xe0,0x0,0xf0,0x1,0x83,0x24,0xcb,0x8,0xc6,0x8c,0x11,0xd0,0x92,0x64,0xd3,0xc6,0x92,0x65,0xd3,0xc6,0x8b,0x2,0xd0,0x92,0x77,0xd3,0xc8,0x0,0x2,0xd3,0xf0,0x1,0x83,0x24,0xcb,0x5,0xc6,0x8c,0x11,0xd0,0x92,0x7c,0xd3,0xd1,0x10,0xf0,0x1,0x83,0x24,0xcb,0x5,0xc6,0x83,0x25,0xd0,0x93,0x1,0xd3,0xf0,0x1,0x83,0x24,0xcb,0x8,0xc6,0x8c,0x11,0xd0,0x93,0x6,0xd3,0xd1,0x11,0xf0,0x1,0x83,0x24,0xcb,0x8,0xc6,0x83,0x25,0xd0,0x93,0xb,0xd3,0xe1,0x7,0xc7,0x4,0xc6,0x93,0xd,0xc6,0x8b,0x9,0xc6,0x93,0xe,0xc6,0x93,0xc,0xcb,0x10,0xc6,0x8c,0x11,0xe0,0x0,0xcb,0x5,0xc6,0x92,0x5c,0xd3,0xd3,0xd1,0x12,0xe1,0x7,0xc7,0x4,0xc6,0x93,0xd,0xc6,0x8b,0x9,0xc6,0x93,0xe,0xc6,0x93,0xc,0xcb,0x11,0xc6,0x8c,0x11,0xe0,0x0,0xcb,0x8,0xc6,0x92,0x5c,0xd3,0xd3,0xd1,0x13,0xe1,0x9,0xc7,0x4,0xc6,0x90,0xd,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xc6,0x90,0xc,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x84,0x33,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xc6,0x88,0x6b,0xc6,0x93,0xf,0xd3,0xc6,0x85,0x38,0xe1,0x7,0xc7,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x5a,0xc6,0x84,0x18,0xe1,0x2,0xc7,0x1c,0xc8,0x0,0x2,0xc6,0x93,0x10,0xd3,0xd3,0xe1,0x3,0xc7,0x11,0xcb,0x3,0xc6,0x84,0x53,0xc6,0x81,0x24,0xd3,0xcb,0xf,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x93,0x11,0xc6,0x84,0x18,0xe0,0x0,0xcb,0x7,0xc6,0x89,0x1,0xd3,0xd3,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x93,0x11,0xc6,0x84,0x18,0xf0,0x1,0x83,0x24,0xcb,0x4,0xc6,0x8c,0x11,0xd0,0x93,0x14,0xd3,0xd3,0xcb,0x12,0xcb,0x13,0xd3,0xd3,0x0,0x65,0x90,0xc,0xc0,0x8b,0x9,0xc0,0x6,0xc0,0x90,0x5b,0xc0,0x88,0x6b,0xc0,0x4,0x76,0x73,0x65,0x74,0xc1,0xc0,0xde,0xc1,0xc1,0x38,0xc1,0xc1,0x32,0xc1,0xc1,0x5a,0xc1,0xc1,0x54,0x2e,0x93,0x56,0x93,0x56,0xc0,0xc0,0x93,0x57,0x93,0x58,0x93,0x58,0x93,0x57,0x93,0x59,0x93,0x5a,0x93,0x5a,0x93,0x59,0xc0,0x93,0x56,0xc1,0x3,0xd2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x93,0x5b,0xa,0x93,0x5c,0xe5,0x4a,0xc3,0xc4,0xc4,0xc4,0x93,0x5d,0xe1,0x2,0xc7,0x1,0xc4,0x3,0xe1,0xb,0xc7,0x4,0xc6,0x93,0x54,0xc6,0x8b,0x9,0xc6,0x93,0x55,0xc6,0x90,0xc,0xc9,0x0,0x1,0xc6,0x90,0x5b,0xc9,0x0,0x0,0xc6,0x88,0x6b,0xe0,0x0,0xe0,0x0,0xc8,0x2,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xc6,0x6,0xe0,0x0,0xe0,0x0,0xc8,0x2,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0x65,0x8b,0x11,0xc0,0x8b,0x9,0xc0,0x6,0xc0,0x8b,0x8,0xc0,0x88,0x6b,0xc0,0x63,0x8b,0x9,0xc0,0x90,0x5b,0xc0,0x90,0x7b,0xc0,0x26,0x90,0x5b,0x8a,0x7c,0x8b,0x9,0x85,0x2b,0x8b,0x8,0x90,0x7b,0xc1,0xbf,0x18,0xc1,0xbf,0x30,0xc1,0xbf,0x4e,0xc1,0xbf,0x48,0xc1,0xbf,0x6a,0xc1,0xbf,0x64,0xc1,0xbf,0xac,0xc1,0xbf,0xc4,0xc1,0xbf,0xbe,0xc1,0xc0,0x1c,0xc1,0xc0,0x24,0xc1,0xc0,0x4e,0xc1,0xc0,0x7a,0xc1,0xc0,0x68,0xc1,0xc0,0x5c,0xc1,0xc0,0x96,0xc1,0xc0,0x88,0xc1,0xc1,0xa8,0xc1,0xc1,0xc0,0xc1,0xc1,0xba,0xc1,0xc1,0xdc,0xc1,0xc1,0xd6,0xc1,0xc2,0x42,0xc1,0xc2,0x3c,0xc1,0xc2,0x64,0xc1,0xc2,0x5e,0xe1,0x3e,0x93,0x62,0x93,0x63,0x93,0x63,0x93,0x64,0x93,0x65,0x93,0x65,0x93,0x64,0x93,0x66,0x93,0x67,0x93,0x67,0x93,0x66,0x93,0x62,0x93,0x68,0x93,0x69,0x93,0x6a,0x93,0x6a,0x93,0x69,0x93,0x68,0x93,0x6b,0x93,0x6c,0x93,0x6c,0x93,0x6b,0xc0,0x93,0x6d,0x93,0x6e,0x93,0x6e,0x93,0x6f,0x93,0x6f,0x93,0x70,0x93,0x70,0x93,0x6f,0x93,0x71,0x93,0x71,0x93,0x72,0x93,0x72,0x93,0x71,0x93,0x6e,0xc0,0x93,0x73,0x93,0x74,0x93,0x75,0x93,0x75,0x93,0x74,0x93,0x76,0x93,0x77,0x93,0x77,0x93,0x76,0x93,0x73,0xc0,0xc0,0x93,0x78,0x93,0x79,0x93,0x79,0x93,0x78,0x93,0x7a,0x93,0x7b,0x93,0x7b,0x93,0x7a,0xc0,0xc0,0xc0,0xc0,0xc1,0x3,0xcc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x93,0x7c,0xa,0x93,0x7d,0xe5,0x82,0x17,0xc3,0xc4,0x93,0x61,0x92,0x0,0x93,0x7e,0xe1,0x4,0xc9,0x2,0x8,0xc8,0x1,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x5b,0xd3,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x6,0xd3,0xd3,0xd1,0x0,0xf0,0x2,0x8b,0x7,0xc8,0x1,0x0,0xc6,0x8a,0x7c,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xc0,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x2,0x2,0xc6,0x84,0xa,0xe8,0x0,0xcb,0x1,0xc6,0x8b,0x8,0xd3,0xd3,0xd1,0x2,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x2,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0xa,0xd3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x2,0xc6,0x8b,0xb,0xd3,0xc6,0x8b,0xa,0xd3,0xd3,0xd0,0x93,0x5e,0xd3,0xe0,0x2,0xc8,0x1,0x0,0xc6,0x3b,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x6,0xd3,0xd3,0xd2,0x0,0x3,0xd2,0x1,0x4,0xe1,0xb,0xc7,0x4,0xc6,0x93,0x5f,0xc6,0x8b,0x9,0xc6,0x85,0x2b,0xc6,0x88,0x6b,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xc6,0x6,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x6,0xd3,0xc6,0x8b,0x11,0xcb,0x3,0xc6,0x8b,0x8,0xcb,0x4,0xd3,0xd1,0x5,0xe1,0x7,0xc7,0x4,0xc6,0x93,0x60,0xc6,0x8b,0x9,0xc6,0x90,0x7a,0xc6,0x90,0x7b,0xcb,0x5,0xc6,0x90,0x5b,0xcb,0x0,0xd3,0x0,0x23,0x90,0x5b,0x85,0x2b,0x8b,0x8,0xc1,0xc3,0x6c,0xc1,0xc3,0x84,0xc1,0xc3,0xd6,0xc1,0xc3,0xee,0xc1,0xc3,0xe8,0xc1,0xc4,0xa,0xc1,0xc4,0x4,0xc1,0xc4,0x80,0xc1,0xc4,0x98,0xc1,0xc4,0x92,0xc1,0xc4,0xce,0xc1,0xc4,0xc8,0xc1,0xc4,0xf0,0xc1,0xc4,0xea,0x3f,0x94,0x1,0x94,0x2,0x94,0x2,0x94,0x1,0x94,0x3,0x94,0x4,0x94,0x5,0x94,0x5,0x94,0x4,0x94,0x6,0x94,0x7,0x94,0x7,0x94,0x6,0x94,0x3,0xc0,0xc0,0x94,0x8,0x94,0x9,0x94,0xa,0x94,0xa,0x94,0x9,0x94,0x8,0x94,0xb,0x94,0xc,0x94,0xc,0x94,0xb,0x94,0xd,0x94,0xe,0x94,0xe,0x94,0xd,0xc0,0xc1,0x3,0xde,0x64,0x4,0xc8,0x5,0xc3,0x6,0x94,0xf,0xa,0x94,0x10,0xe5,0x81,0x1d,0xc3,0xc4,0x94,0x0,0x82,0x5d,0x94,0x11,0xe1,0x2,0xc9,0x2,0x8,0xc8,0x1,0x0,0xe8,0x0,0xc8,0x1,0x1,0xc6,0x90,0x5b,0xd3,0xd3,0xd1,0x0,0xf0,0x3,0x8f,0xa,0xc8,0x1,0x0,0xc6,0x3b,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x6,0xd3,0xc6,0x8b,0xa,0xd3,0xd2,0x0,0x1,0xd2,0x1,0x2,0xe1,0xb,0xc7,0x4,0xc6,0x93,0x54,0xc6,0x8b,0x9,0xc6,0x93,0x55,0xc6,0x90,0xc,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x8a,0x7c,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xd3,0xc6,0x90,0x5b,0xcb,0x0,0xc6,0x88,0x6b,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xc6,0x6,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x6,0xd3,0xd3,0x0,0x6,0x6d,0x65,0x74,0x68,0x6f,0x64,0x65,0x90,0xc,0xc0,0x8b,0x9,0xc0,0x6,0xc0,0x85,0x38,0xc0,0x94,0x13,0xc0,0x4,0x5f,0x73,0x65,0x74,0x23,0x90,0xc,0x90,0x5b,0x88,0x6b,0xc1,0xc5,0x86,0xc1,0xc5,0xa4,0xc1,0xc5,0x9e,0xc1,0xc5,0xec,0xc1,0xc6,0x4,0xc1,0xc6,0x78,0xc1,0xc6,0x72,0xc1,0xc7,0x6,0xc1,0xc7,0x36,0xc1,0xc7,0x30,0x3b,0x94,0x17,0x94,0x18,0x94,0x19,0x94,0x19,0x94,0x18,0x94,0x17,0x94,0x1a,0x94,0x1b,0x94,0x1b,0x94,0x1a,0xc0,0xc0,0x94,0x1c,0x94,0x1d,0x94,0x1d,0x94,0x1c,0xc0,0xc0,0xc0,0x94,0x1e,0x94,0x1e,0x94,0x1e,0x94,0x1f,0x94,0x20,0x94,0x20,0x94,0x1f,0xc0,0xc1,0x3,0xe6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x94,0x21,0xa,0x94,0x22,0xe5,0x81,0xd,0xc3,0xc4,0x94,0x16,0x82,0x5d,0x94,0x23,0xe1,0x2,0xc9,0x2,0x8,0xc8,0x1,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x90,0xc,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x2,0x8,0xc8,0x1,0x0,0xe8,0x0,0xc8,0x1,0x1,0xc6,0x90,0x5b,0xd3,0xd3,0xd1,0x1,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x5a,0xc6,0x84,0x18,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x88,0x6b,0xd3,0xd3,0xd1,0x2,0xe1,0xb,0xc7,0x4,0xc6,0x94,0x14,0xc6,0x8b,0x9,0xc6,0x94,0x13,0xc6,0x90,0xc,0xcb,0x0,0xc6,0x94,0x13,0xc6,0x94,0x15,0xc6,0x85,0x38,0xe1,0x2,0xc7,0x3,0xcb,0x2,0xcb,0x1,0xd3,0xc6,0x6,0xe8,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x6,0xd3,0xd3,0x0,0xc1,0xbe,0xc6,0xc1,0xbe,0xba,0xc1,0xbe,0xb4,0xc1,0xc3,0x18,0xc1,0xc3,0xc,0xc1,0xc3,0x6,0xc1,0xc5,0x32,0xc1,0xc5,0x26,0xc1,0xc5,0x20,0x3b,0x94,0x25,0x94,0x25,0x94,0x26,0x94,0x27,0x94,0x27,0x94,0x26,0x94,0x25,0xc0,0xc0,0x94,0x28,0x94,0x28,0x94,0x29,0x94,0x2a,0x94,0x2a,0x94,0x29,0x94,0x28,0xc0,0xc0,0x94,0x2b,0x94,0x2b,0x94,0x2c,0x94,0x2d,0x94,0x2d,0x94,0x2c,0x94,0x2b,0xc0,0xc0,0xc1,0x3,0xca,0x64,0x4,0xc8,0x5,0xc3,0x6,0x94,0x2e,0xa,0x94,0x2f,0xe5,0x5f,0xc3,0xc4,0xc4,0xc4,0x94,0x30,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0x2b,0xd3,0xe3,0x0,0xd0,0x93,0x7f,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x8b,0x9,0xd3,0xc6,0x91,0x17,0xd3,0xe3,0x0,0xd0,0x94,0x12,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x7b,0xd3,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x55,0xd3,0xe3,0x0,0xd0,0x94,0x24,0xd3,0xd4,0x0,0xb,0x6d,0x75,0x6c,0x74,0x69,0x61,0x73,0x73,0x69,0x67,0x6e,0x5,0x6d,0x75,0x6c,0x74,0x69,0xc1,0xca,0x94,0x23,0x94,0x34,0x94,0x34,0x94,0x34,0xc1,0x3,0xfc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x94,0x35,0xa,0x94,0x36,0xb1,0xc3,0xc4,0xc4,0xc4,0x94,0x37,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xc9,0x0,0x0,0xd3,0x0,0x22,0x8a,0x7c,0x8b,0x9,0xc1,0xc9,0x54,0xc1,0xc9,0x62,0xc1,0xc9,0xc2,0xc1,0xc9,0xca,0xc1,0xc9,0xfc,0xc1,0xca,0x28,0xc1,0xca,0x16,0xc1,0xca,0xa,0xc1,0xca,0x44,0xc1,0xca,0x36,0xc1,0xca,0xd0,0xc1,0xca,0xde,0xc1,0xca,0xf0,0x3e,0x94,0x3a,0x94,0x3b,0x94,0x3b,0x94,0x3a,0x94,0x3c,0x94,0x3d,0x94,0x3d,0x94,0x3c,0xc0,0x94,0x3e,0x94,0x3f,0x94,0x3f,0x94,0x40,0x94,0x40,0x94,0x41,0x94,0x41,0x94,0x40,0x94,0x42,0x94,0x42,0x94,0x43,0x94,0x43,0x94,0x42,0x94,0x3f,0xc0,0x94,0x44,0x94,0x45,0x94,0x45,0x94,0x46,0x94,0x46,0x94,0x44,0xc1,0x3,0xf8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x94,0x47,0xa,0x94,0x48,0xe5,0x7a,0xc3,0xc4,0x94,0x39,0x83,0x73,0x94,0x49,0xf0,0x2,0x8b,0x7,0xc8,0x2,0x0,0xc6,0x8a,0x7c,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xc0,0xd3,0xd1,0x0,0xe0,0x1,0xc9,0x3,0x2,0xc6,0x84,0xa,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x8,0xd3,0xd3,0xd1,0x1,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0xa,0xd3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x1,0xc6,0x8b,0xb,0xd3,0xc6,0x8b,0xa,0xd3,0xd3,0xd0,0x94,0x38,0xd3,0xe0,0x2,0xc8,0x2,0x0,0xc6,0x3b,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0x12,0x74,0x79,0x70,0x65,0x3f,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x22,0x76,0x61,0x72,0x22,0xc1,0xcb,0x80,0xc1,0xcb,0x8e,0xc1,0xcb,0xa0,0xc1,0xcc,0x2,0xc1,0xcc,0x10,0xc1,0xcc,0x70,0xc1,0xcc,0x78,0xc1,0xcc,0xb8,0xc1,0xcc,0xaa,0xc1,0xcc,0xcc,0xc1,0xcc,0xc0,0xc1,0xcd,0x12,0x39,0x94,0x4c,0x94,0x4d,0x94,0x4d,0x94,0x4e,0x94,0x4e,0x94,0x4c,0x94,0x4f,0x94,0x50,0x94,0x50,0x94,0x4f,0x94,0x51,0x94,0x52,0x94,0x52,0x94,0x51,0x94,0x53,0x94,0x54,0x94,0x55,0x94,0x55,0x94,0x56,0x94,0x56,0x94,0x55,0x94,0x53,0x94,0x57,0x94,0x57,0x94,0x57,0xc1,0x4,0x4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x94,0x58,0xa,0x94,0x59,0xe5,0x73,0xc3,0xc4,0x94,0x39,0x83,0x73,0x94,0x5a,0xf0,0x3,0x8f,0xa,0xc8,0x2,0x0,0xc6,0x3b,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x8b,0xa,0xd3,0xf0,0x2,0x8b,0x7,0xc8,0x2,0x0,0xc6,0x8a,0x7c,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xc0,0xd3,0xd1,0x0,0xe0,0x1,0xc9,0x3,0x2,0xc6,0x84,0xa,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x8,0xd3,0xd3,0xd1,0x1,0xf1,0x2,0x5b,0xc7,0xa,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0xa,0xd3,0xc6,0x94,0x4b,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xcb,0x0,0xd3,0x0,0x1,0x2e,0xc1,0xcd,0xb6,0x22,0x94,0x5d,0x94,0x5d,0xc1,0x4,0x10,0x64,0x4,0xc8,0x5,0xc3,0x6,0x94,0x5e,0xa,0x94,0x5f,0xb0,0xc3,0xc4,0xc4,0xc4,0x94,0x60,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x88,0x6b,0xd3,0x0,0xc1,0xcd,0xa0,0xc1,0xcd,0xcc,0x29,0x94,0x62,0xc0,0xc0,0xc0,0xc0,0xc0,0x94,0x63,0x94,0x63,0x94,0x62,0x64,0x4,0xc8,0x5,0xc3,0x6,0x94,0x64,0xa,0x94,0x5f,0xe5,0x25,0xc3,0xc4,0xc4,0xc4,0x94,0x65,0xe0,0x2,0xc8,0x2,0x0,0xc6,0x3b,0xe1,0x2,0xc7,0x19,0xc6,0x94,0x5c,0xe1,0x0,0xd0,0x94,0x61,0xd3,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0xe,0x61,0x73,0x73,0x69,0x67,0x6e,0x69,0x6e,0x67,0x20,0x74,0x6f,0x20,0x27,0xc1,0xcf,0x12,0x22,0x94,0x68,0x94,0x68,0xc1,0x4,0x16,0x64,0x4,0xc8,0x5,0xc3,0x6,0x94,0x69,0xa,0x94,0x6a,0xb0,0xc3,0xc4,0xc4,0xc4,0x94,0x6b,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x88,0x6b,0xd3,0x0,0x16,0x27,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x79,0x65,0x74,0x20,0x73,0x75,0x70,0x70,0x6f,0x72,0x74,0x65,0x64,0xc1,0xce,0xa6,0xc1,0xce,0xac,0xc1,0xce,0xea,0xc1,0xce,0xe0,0x2c,0x94,0x6e,0x94,0x6f,0x94,0x6f,0x94,0x6e,0x94,0x70,0x94,0x71,0xc0,0xc0,0xc0,0xc0,0xc0,0x94,0x70,0xc1,0x4,0x14,0x64,0x4,0xc8,0x5,0xc3,0x6,0x94,0x72,0xa,0x94,0x73,0xe5,0x33,0xc3,0xc4,0x91,0x29,0x83,0x73,0x94,0x74,0xe1,0x1,0xc9,0x3,0xd,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x18,0xe1,0x3,0xc7,0x19,0xc6,0x94,0x67,0xe1,0x0,0xd0,0x94,0x6c,0xd3,0xc6,0x94,0x6d,0xd3,0xd3,0x0,0x21,0x90,0x7b,0x21,0x94,0x76,0xc1,0xc8,0xfa,0xc1,0xc8,0xee,0xc1,0xcb,0x30,0xc1,0xcb,0x24,0xc1,0xcd,0x50,0xc1,0xcd,0x44,0x37,0x94,0x78,0x94,0x78,0x94,0x79,0x94,0x79,0x94,0x78,0xc0,0xc0,0x94,0x7a,0x94,0x7a,0x94,0x7b,0x94,0x7b,0x94,0x7a,0xc0,0xc0,0x94,0x7c,0x94,0x7c,0x94,0x7d,0x94,0x7d,0x94,0x7c,0xc0,0xc0,0xc0,0xc0,0xc1,0x3,0xf4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x94,0x7e,0xa,0x94,0x7f,0xe5,0x52,0xc3,0x94,0x77,0xc4,0xc4,0x95,0x0,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0x2b,0xd3,0xe3,0x0,0xd0,0x94,0x4a,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x91,0x17,0xd3,0xe3,0x0,0xd0,0x94,0x5b,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x55,0xd3,0xe3,0x0,0xd0,0x94,0x66,0xd3,0xc0,0xe3,0x0,0xd0,0x94,0x75,0xd3,0xd4,0x0,0xc1,0x4,0x1e,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x95,0x2,0xa8,0xc3,0xc4,0xc4,0xc4,0x95,0x3,0xc2,0x0,0xc1,0x4,0x20,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x95,0x5,0xa8,0xc3,0xc4,0xc4,0xc4,0x95,0x6,0xc2,0x0,0x62,0x8b,0x11,0xc0,0x8b,0x9,0xc0,0xc1,0xd1,0x4c,0xc1,0xd1,0x60,0xc1,0xd1,0xda,0xc1,0xd2,0x46,0xc1,0xd2,0xdc,0xc1,0xd3,0x2,0x36,0x95,0x9,0x95,0xa,0x95,0xa,0x95,0x9,0xc0,0xc0,0x95,0xb,0x95,0xb,0xc0,0xc0,0xc0,0x95,0xc,0x95,0xc,0xc0,0xc0,0xc0,0x95,0xd,0x95,0xd,0x95,0xd,0x95,0xe,0x95,0xe,0xc0,0xc1,0x4,0x24,0x64,0x4,0xc8,0x5,0xc3,0x6,0x95,0xf,0xa,0x95,0x10,0xe5,0x81,0x6,0xc3,0xc4,0x94,0x16,0x82,0x5d,0x95,0x11,0xe1,0x2,0xc9,0x3,0x8,0xc8,0x2,0x0,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x90,0xc,0xd3,0xd3,0xd1,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x95,0x8,0xc6,0x8b,0x9,0xc6,0x85,0x2b,0xc6,0x8b,0x11,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x84,0xa,0xc8,0x0,0x1,0xd3,0xd3,0xd1,0x1,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x5a,0xc6,0x84,0x18,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xd3,0xd1,0x2,0xe1,0xb,0xc7,0x4,0xc6,0x94,0x14,0xc6,0x8b,0x9,0xc6,0x94,0x13,0xc6,0x90,0xc,0xcb,0x0,0xc6,0x94,0x13,0xc6,0x94,0x15,0xc6,0x85,0x38,0xe1,0x2,0xc7,0x3,0xcb,0x2,0xcb,0x1,0xd3,0xc6,0x6,0xe8,0x0,0xc9,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0xc1,0xd3,0x6e,0xc1,0xd3,0x60,0x23,0x95,0x13,0x95,0x14,0x95,0x13,0xc1,0x4,0x2c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x95,0x15,0xa,0x95,0x16,0xb1,0xc3,0xc4,0xc4,0xc4,0x95,0x17,0xf1,0x2,0x5b,0xc7,0xa,0xc1,0xc6,0x81,0x24,0xd3,0x0,0x22,0x83,0x46,0x8e,0x52,0xc1,0xcf,0xfa,0xc1,0xcf,0xee,0xc1,0xd0,0x36,0xc1,0xd0,0x2a,0xc1,0xd0,0x92,0xc1,0xd0,0x86,0xc1,0xd0,0xee,0xc1,0xd0,0xe2,0x3b,0x95,0x1a,0x95,0x1b,0x95,0x1b,0x95,0x1a,0x95,0x1c,0x95,0x1c,0x95,0x1d,0x95,0x1d,0x95,0x1c,0xc0,0xc0,0x95,0x1e,0x95,0x1e,0x95,0x1f,0x95,0x1f,0x95,0x1e,0xc0,0xc0,0x95,0x20,0x95,0x20,0x95,0x21,0x95,0x21,0x95,0x20,0xc0,0xc0,0xc0,0xc0,0xc1,0x4,0x1a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x95,0x22,0xa,0x95,0x23,0xe5,0x67,0xc3,0x95,0x19,0x94,0x76,0x83,0x32,0x95,0x24,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x33,0xd3,0xc6,0x84,0xa,0xca,0x1,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0x2b,0xd3,0xe3,0x0,0xd0,0x95,0x4,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x91,0x17,0xd3,0xe3,0x0,0xd0,0x95,0x7,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x55,0xd3,0xe3,0x0,0xd0,0x95,0x12,0xd3,0xc0,0xe3,0x0,0xd0,0x95,0x18,0xd3,0xd4,0x0,0x7,0x61,0x73,0x73,0x69,0x67,0x6e,0x73,0x64,0x95,0x26,0xc0,0x8b,0x9,0xc0,0x88,0x6d,0xc0,0x90,0x5b,0xc0,0x23,0x90,0x5b,0x88,0x6d,0x95,0x26,0xc1,0xc8,0x4a,0xc1,0xc8,0x62,0xc1,0xc8,0xb0,0xc1,0xc8,0xa4,0xc1,0xcf,0xa2,0x2d,0x95,0x29,0x95,0x2a,0x95,0x2a,0x95,0x29,0x95,0x2b,0x95,0x2c,0x95,0x2c,0x95,0x2b,0x95,0x2d,0x95,0x2d,0xc0,0xc0,0xc0,0xc1,0x3,0xf2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x95,0x2e,0xa,0x95,0x2f,0xe5,0x5f,0xc3,0xc4,0x95,0x28,0x82,0x5d,0x95,0x30,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x5b,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x94,0x33,0xd3,0xc6,0x8c,0x11,0xd0,0x95,0x1,0xd3,0xd1,0x1,0xf0,0x1,0x83,0x24,0xcb,0x1,0xc6,0x8c,0x11,0xd0,0x95,0x25,0xd3,0xd1,0x2,0xe1,0x9,0xc7,0x4,0xc6,0x95,0x27,0xc6,0x8b,0x9,0xc6,0x94,0x32,0xc6,0x90,0x5b,0xcb,0x0,0xc6,0x88,0x6d,0xcb,0x1,0xc6,0x95,0x26,0xcb,0x2,0xd3,0x0,0xc1,0xd5,0x44,0x22,0x95,0x32,0x95,0x32,0xc1,0x4,0x36,0x64,0x4,0xc8,0x5,0xc3,0x6,0x95,0x33,0xa,0x95,0x34,0xb0,0xc3,0x8f,0x29,0xc4,0xc4,0x95,0x35,0xe8,0x0,0xca,0x0,0xc6,0x82,0x5b,0xd3,0x0,0xc1,0xd5,0xb2,0xc1,0xd5,0xc8,0x24,0x95,0x37,0x95,0x38,0x95,0x38,0x95,0x37,0xc1,0x4,0x38,0x64,0x4,0xc8,0x5,0xc3,0x6,0x95,0x39,0xa,0x95,0x3a,0xb8,0xc3,0x8f,0x29,0xc4,0xc4,0x95,0x3b,0xe1,0x2,0xc9,0x2,0x8,0xc8,0x1,0x0,0xe0,0x0,0xca,0x0,0xc6,0x47,0xd3,0xd3,0x0,0xc1,0xd6,0x1e,0xc1,0xd6,0x36,0x24,0x95,0x3d,0x95,0x3e,0x95,0x3e,0x95,0x3d,0xc1,0x4,0x3a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x95,0x3f,0xa,0x95,0x40,0xb8,0xc3,0xc4,0xc4,0xc4,0x95,0x41,0xe1,0x2,0xc9,0x2,0x8,0xc8,0x1,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x5e,0xd3,0xd3,0x0,0xc1,0x4,0x3c,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x95,0x43,0xa8,0xc3,0xc4,0xc4,0xc4,0x95,0x44,0xc2,0x0,0x66,0x90,0xc,0xc0,0x8b,0x9,0xc0,0x6,0xc0,0x8b,0x13,0xc0,0x85,0x38,0xc0,0x5e,0xc0,0x21,0x91,0x7c,0xc1,0xd7,0x76,0xc1,0xd7,0x92,0xc1,0xd7,0xca,0xc1,0xd8,0x1e,0xc1,0xd8,0x2,0xc1,0xd8,0x10,0xc1,0xd8,0x42,0xc1,0xd8,0x36,0xc1,0xd8,0x70,0x3d,0xc0,0xc0,0x95,0x48,0x95,0x48,0x95,0x49,0x95,0x49,0xc0,0x95,0x4a,0x95,0x4a,0xc0,0xc0,0x95,0x4b,0x95,0x4b,0x95,0x4c,0x95,0x4c,0x95,0x4d,0x95,0x4d,0x95,0x4c,0x95,0x4b,0x95,0x4e,0x95,0x4e,0x95,0x4f,0x95,0x4f,0x95,0x4f,0x95,0x4e,0x95,0x50,0x95,0x50,0xc0,0x95,0x4a,0xc1,0x4,0x3e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x95,0x51,0xa,0x95,0x52,0xe5,0x81,0x2,0xc3,0xc4,0x95,0x47,0x83,0x32,0x95,0x53,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x84,0x33,0xc6,0x88,0x6b,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x6,0xe8,0x0,0xc8,0x1,0x1,0xc6,0x6,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe1,0xd,0xc7,0x4,0xc6,0x95,0x46,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xcb,0x0,0xc6,0x85,0x38,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0x3,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x89,0x13,0xd3,0xd3,0xc9,0x0,0x2,0xd3,0xc6,0x8b,0x13,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0x3,0xc2,0xd3,0xc9,0x0,0x1,0xd3,0xc6,0x5e,0xc9,0x0,0x3,0xc6,0x6,0xe8,0x0,0xc8,0x1,0x1,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0x63,0x84,0x18,0xc0,0x8b,0x9,0xc0,0x6,0xc0,0x22,0x91,0x7c,0x83,0x10,0xc1,0xd9,0x60,0xc1,0xd9,0x7e,0xc1,0xd9,0xb8,0xc1,0xd9,0xf8,0xc1,0xda,0x18,0xc1,0xda,0x52,0xc1,0xda,0x90,0xc1,0xda,0x8a,0xc1,0xda,0xb4,0xc1,0xda,0xa8,0xc1,0xda,0xe4,0xe1,0x24,0xc0,0xc0,0x95,0x57,0x95,0x57,0x95,0x58,0x95,0x58,0xc0,0x95,0x59,0xc0,0xc0,0x95,0x5a,0x95,0x5a,0x95,0x5b,0x95,0x5b,0xc0,0x95,0x59,0x95,0x5c,0x95,0x5c,0xc0,0xc0,0x95,0x5d,0x95,0x5d,0x95,0x5e,0x95,0x5e,0x95,0x5e,0x95,0x5d,0x95,0x5f,0x95,0x5f,0x95,0x60,0x95,0x60,0x95,0x60,0x95,0x5f,0x95,0x61,0x95,0x61,0xc0,0x95,0x5c,0xc1,0x4,0x44,0x64,0x4,0xc8,0x5,0xc3,0x6,0x95,0x62,0xa,0x95,0x63,0xe5,0x81,0x2a,0xc3,0xc4,0x95,0x56,0x83,0x73,0x95,0x64,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0xf,0xc6,0x8b,0x9,0xc6,0x84,0x33,0xc6,0x88,0x6b,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x6,0xe8,0x0,0xc8,0x1,0x1,0xc6,0x6,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x2,0x8,0xc8,0x1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x95,0x55,0xc6,0x8b,0x9,0xc6,0x93,0x11,0xc6,0x84,0x18,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x89,0x13,0xd3,0xc6,0x6,0xe8,0x0,0xc8,0x1,0x1,0xc6,0x6,0xd3,0xd3,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe1,0xd,0xc7,0x4,0xc6,0x95,0x46,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xcb,0x0,0xc6,0x85,0x38,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0x3,0xcb,0x1,0xd3,0xc9,0x0,0x2,0xd3,0xc6,0x8b,0x13,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0x3,0xc2,0xd3,0xc9,0x0,0x1,0xd3,0xc6,0x5e,0xc9,0x0,0x3,0xc6,0x6,0xe8,0x0,0xc8,0x1,0x1,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0x24,0x90,0xc,0x8b,0x13,0x85,0x38,0x5e,0xc1,0xd4,0xb0,0xc1,0xd4,0xc8,0xc1,0xd5,0x24,0xc1,0xd5,0x18,0xc1,0xd5,0xc,0xc1,0xd5,0x1e,0xc1,0xd5,0x92,0xc1,0xd5,0x86,0xc1,0xd5,0x7a,0xc1,0xd5,0x8c,0xc1,0xd6,0x4,0xc1,0xd6,0xb0,0xc1,0xd6,0xe6,0xc1,0xd6,0xce,0xc1,0xd6,0xc2,0xc1,0xd7,0x4,0xc1,0xd6,0xf8,0xc1,0xd8,0x94,0xc1,0xd8,0xc8,0xc1,0xd8,0xb2,0xc1,0xd8,0xa6,0xc1,0xd8,0xe6,0xc1,0xd8,0xda,0xc1,0xdb,0x66,0xe1,0x43,0x95,0x67,0x95,0x68,0x95,0x68,0x95,0x67,0x95,0x69,0x95,0x6a,0x95,0x6a,0x95,0x6b,0x95,0x6b,0x95,0x6c,0x95,0x6c,0x95,0x6c,0x95,0x6a,0x95,0x69,0x95,0x6d,0x95,0x6e,0x95,0x6e,0x95,0x6f,0x95,0x6f,0x95,0x70,0x95,0x70,0x95,0x70,0x95,0x6e,0x95,0x6d,0x95,0x71,0x95,0x71,0xc0,0xc0,0xc0,0xc0,0xc0,0x95,0x72,0x95,0x73,0x95,0x73,0x95,0x74,0x95,0x74,0x95,0x75,0x95,0x75,0x95,0x74,0x95,0x76,0x95,0x76,0x95,0x77,0x95,0x77,0x95,0x76,0x95,0x73,0xc0,0xc0,0x95,0x78,0x95,0x79,0x95,0x79,0x95,0x7a,0x95,0x7a,0x95,0x7b,0x95,0x7b,0x95,0x7a,0x95,0x7c,0x95,0x7c,0x95,0x7d,0x95,0x7d,0x95,0x7c,0x95,0x79,0xc0,0xc0,0xc0,0x95,0x7e,0x95,0x7e,0xc0,0xc1,0x4,0x34,0x64,0x4,0xc8,0x5,0xc3,0x6,0x95,0x7f,0xa,0x96,0x0,0xe5,0x81,0x7b,0xc3,0xc4,0x95,0x66,0x8c,0x25,0x96,0x1,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0xc,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x85,0x38,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x95,0x36,0xd3,0xd1,0x1,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x85,0x38,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x95,0x3c,0xd3,0xd1,0x2,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x5e,0xd3,0xe3,0x0,0xd0,0x95,0x42,0xd3,0xc0,0xe3,0x0,0xd0,0x95,0x45,0xd3,0xd4,0xd1,0x3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x1,0xd3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x8c,0x4e,0xd3,0xd3,0xd0,0x95,0x54,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x84,0x10,0xd3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x8d,0x2,0xd3,0xd3,0xd0,0x95,0x65,0xd3,0xe1,0xd,0xc7,0x4,0xc6,0x95,0x46,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xcb,0x0,0xc6,0x85,0x38,0xcb,0x2,0xc6,0x8b,0x13,0xcb,0x1,0xc6,0x5e,0xcb,0x3,0xc6,0x6,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0x5,0x73,0x75,0x70,0x65,0x72,0x63,0x90,0xc,0xc0,0x8b,0x9,0xc0,0x85,0x38,0xc0,0x6,0x5f,0x73,0x75,0x70,0x65,0x72,0x61,0x47,0xc0,0x4,0x41,0x72,0x67,0x73,0x62,0x82,0x5b,0xc0,0x47,0xc0,0x8,0x63,0x61,0x6c,0x6c,0x61,0x72,0x67,0x73,0x24,0x85,0x4c,0x90,0xc,0x96,0x9,0x85,0x38,0xc1,0xdc,0xe0,0xc1,0xdc,0xd4,0xc1,0xdc,0xf2,0xc1,0xdd,0x84,0xc1,0xdd,0x78,0xc1,0xdd,0x96,0xc1,0xdd,0xd8,0xc1,0xde,0x22,0xc1,0xde,0x9e,0xc1,0xde,0x92,0xc1,0xde,0xb0,0xc1,0xde,0xf6,0xc1,0xdf,0x2a,0xc1,0xdf,0x86,0xc1,0xdf,0xea,0xc1,0xe0,0x44,0xe1,0x3d,0x96,0xb,0x96,0xc,0x96,0xd,0x96,0xd,0x96,0xb,0xc0,0xc0,0x96,0xe,0x96,0xf,0x96,0x10,0x96,0x10,0x96,0xe,0x96,0x11,0x96,0x11,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x96,0x12,0x96,0x12,0xc0,0xc0,0x96,0x11,0xc0,0xc0,0xc0,0x96,0x13,0x96,0x14,0x96,0x15,0x96,0x15,0x96,0x13,0x96,0x16,0x96,0x16,0xc0,0x96,0x17,0x96,0x17,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x96,0x18,0x96,0x18,0xc0,0xc0,0xc0,0xc0,0xc0,0x96,0x17,0x96,0x19,0xc0,0xc0,0x96,0x1a,0x96,0x1a,0xc0,0x96,0x19,0xc1,0x4,0x52,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x1b,0xa,0x96,0x1c,0xe5,0x82,0x38,0xc3,0xc4,0x96,0xa,0x8c,0x25,0x96,0x1d,0xe0,0x3,0xc7,0x1b,0xc6,0x88,0x7d,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0xc,0xd3,0xc6,0x88,0x6b,0xc6,0x85,0x4c,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x96,0x4,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xe0,0x3,0xc7,0x1b,0xc6,0x88,0x7d,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0xc,0xd3,0xc6,0x88,0x6b,0xc6,0x96,0x5,0xd3,0xc6,0x85,0x38,0xe1,0x2,0xc7,0x3,0xe1,0x3,0xc7,0x4,0xc6,0x96,0x6,0xc6,0x47,0xcb,0x0,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x96,0x6,0xc6,0x47,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x5a,0xc6,0x84,0x18,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x94,0x13,0xd3,0xd3,0xd3,0xd3,0xd3,0xd1,0x1,0xe1,0x7,0xc7,0x4,0xc6,0x96,0x4,0xc6,0x8b,0x9,0xc6,0x90,0xe,0xc6,0x90,0xc,0xe0,0x3,0xc7,0x1b,0xc6,0x88,0x7d,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0xc,0xd3,0xc6,0x88,0x6b,0xc6,0x96,0x7,0xd3,0xc6,0x85,0x38,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x85,0x38,0xd3,0xd3,0xd1,0x2,0xe1,0x3,0xc7,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x96,0x8,0xc6,0x47,0xcb,0x0,0xc6,0x82,0x5b,0xc6,0x85,0x4c,0xd3,0xe1,0x5,0xc7,0x4,0xc6,0x96,0x8,0xc6,0x47,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x5a,0xc6,0x84,0x18,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x94,0x13,0xd3,0xd3,0xc6,0x82,0x5b,0xc6,0x94,0x13,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x96,0x6,0xc6,0x47,0xcb,0x2,0xd3,0xd3,0xd1,0x3,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe1,0xb,0xc7,0x4,0xc6,0x94,0x14,0xc6,0x8b,0x9,0xc6,0x94,0x13,0xc6,0x94,0x13,0xc6,0x90,0xe,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xc6,0x90,0xc,0xcb,0x1,0xc6,0x85,0x38,0xcb,0x3,0xd3,0xd3,0x0,0xa,0x73,0x61,0x66,0x65,0x6d,0x65,0x74,0x68,0x6f,0x64,0xc1,0xe1,0xb2,0x22,0x96,0x20,0x96,0x20,0xc1,0x4,0x60,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x21,0xa,0x96,0x22,0xb0,0xc3,0x8f,0x29,0xc4,0xc4,0x96,0x23,0xe8,0x0,0xca,0x0,0xc6,0x82,0x5b,0xd3,0x0,0xc1,0xe2,0x20,0xc1,0xe2,0x36,0x24,0x96,0x25,0x96,0x26,0x96,0x26,0x96,0x25,0xc1,0x4,0x62,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x27,0xa,0x96,0x28,0xb8,0xc3,0x8f,0x29,0xc4,0xc4,0x96,0x29,0xe1,0x2,0xc9,0x2,0x8,0xc8,0x1,0x0,0xe0,0x0,0xca,0x0,0xc6,0x47,0xd3,0xd3,0x0,0xc1,0xe2,0x8c,0xc1,0xe2,0xa4,0x24,0x96,0x2b,0x96,0x2c,0x96,0x2c,0x96,0x2b,0xc1,0x4,0x64,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x2d,0xa,0x96,0x2e,0xb8,0xc3,0xc4,0xc4,0xc4,0x96,0x2f,0xe1,0x2,0xc9,0x2,0x8,0xc8,0x1,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x5e,0xd3,0xd3,0x0,0xc1,0x4,0x66,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x96,0x31,0xa8,0xc3,0xc4,0xc4,0xc4,0x96,0x32,0xc2,0x0,0x67,0x90,0xc,0xc0,0x8b,0x9,0xc0,0x6,0xc0,0x8b,0x13,0xc0,0x85,0x38,0xc0,0x5e,0xc0,0x94,0x13,0xc0,0xc1,0xe1,0x1e,0xc1,0xe1,0x36,0xc1,0xe1,0x92,0xc1,0xe1,0x86,0xc1,0xe1,0x7a,0xc1,0xe1,0x8c,0xc1,0xe2,0x0,0xc1,0xe1,0xf4,0xc1,0xe1,0xe8,0xc1,0xe1,0xfa,0xc1,0xe2,0x72,0xc1,0xe3,0x32,0xc1,0xe3,0x54,0xc1,0xe3,0xa8,0xe1,0x27,0x96,0x35,0x96,0x36,0x96,0x36,0x96,0x35,0x96,0x37,0x96,0x38,0x96,0x38,0x96,0x39,0x96,0x39,0x96,0x3a,0x96,0x3a,0x96,0x3a,0x96,0x38,0x96,0x37,0x96,0x3b,0x96,0x3c,0x96,0x3c,0x96,0x3d,0x96,0x3d,0x96,0x3e,0x96,0x3e,0x96,0x3e,0x96,0x3c,0x96,0x3b,0x96,0x3f,0x96,0x3f,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x96,0x40,0x96,0x40,0x96,0x41,0x96,0x41,0x96,0x42,0x96,0x42,0xc0,0xc1,0x4,0x5e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x43,0xa,0x96,0x44,0xe5,0x81,0x32,0xc3,0xc4,0x95,0x66,0x8c,0x25,0x96,0x45,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0xc,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x85,0x38,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x96,0x24,0xd3,0xd1,0x1,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x85,0x38,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x96,0x2a,0xd3,0xd1,0x2,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x5e,0xd3,0xe3,0x0,0xd0,0x96,0x30,0xd3,0xc0,0xe3,0x0,0xd0,0x96,0x33,0xd3,0xd4,0xd1,0x3,0xe1,0xf,0xc7,0x4,0xc6,0x96,0x34,0xc6,0x8b,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x94,0x13,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x94,0x13,0xd3,0xc6,0x90,0xc,0xcb,0x0,0xc6,0x85,0x38,0xcb,0x2,0xc6,0x8b,0x13,0xcb,0x1,0xc6,0x5e,0xcb,0x3,0xc6,0x6,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0x5,0x61,0x73,0x79,0x6e,0x63,0xc1,0xe4,0x44,0x22,0x96,0x48,0x96,0x48,0xc1,0x4,0x6c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x49,0xa,0x96,0x4a,0xb0,0xc3,0xc4,0xc4,0xc4,0x96,0x4b,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x8f,0x26,0xd3,0x0,0x3,0x72,0x68,0x73,0xc1,0xe4,0x94,0xc1,0xe4,0x9e,0x25,0x96,0x4e,0x96,0x4e,0x96,0x4f,0x96,0x4f,0x96,0x4e,0xc1,0x4,0x6e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x50,0xa,0x96,0x51,0xb5,0xc3,0xc4,0xc4,0xc4,0x96,0x52,0xe1,0x1,0xc7,0x3,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x96,0x4d,0xd3,0xd3,0x0,0x63,0x8f,0x26,0xc0,0x8b,0x9,0xc0,0x6,0xc0,0x62,0x8f,0x26,0xc0,0x8b,0x9,0xc0,0x24,0x8f,0x26,0x8b,0x2e,0x8b,0x16,0x8b,0x14,0xc1,0xe4,0x2a,0xc1,0xe4,0xe4,0xc1,0xe5,0x2e,0xc1,0xe5,0x76,0x38,0x96,0x57,0x96,0x57,0xc0,0xc0,0xc0,0xc0,0x96,0x58,0xc0,0xc0,0x96,0x59,0x96,0x59,0xc0,0x96,0x58,0x96,0x5a,0xc0,0xc0,0xc0,0x96,0x5a,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x5b,0xa,0x96,0x4a,0xe5,0x81,0x12,0xc3,0xc4,0x96,0x56,0x8c,0x25,0x96,0x5c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x26,0xd3,0xe3,0x0,0xd0,0x96,0x4c,0xd3,0xc0,0xe3,0x0,0xd0,0x96,0x53,0xd3,0xd4,0xd1,0x0,0xe1,0x2,0xc9,0x1,0x7,0xc8,0x0,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x96,0x54,0xc6,0x8b,0x9,0xc6,0x89,0x13,0xc6,0x8f,0x26,0xcb,0x0,0xc6,0x6,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x3b,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0x50,0xc6,0x88,0x6b,0xc6,0x17,0xc6,0x8b,0x4,0xc1,0xc6,0x8b,0x2e,0xcb,0x1,0xd3,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x96,0x55,0xc6,0x8b,0x9,0xc6,0x96,0x47,0xc6,0x8f,0x26,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x38,0xc6,0x8b,0x9,0xc6,0x8b,0x2e,0xc6,0x8b,0x2e,0xcb,0x3,0xd3,0xd3,0x0,0x63,0x8b,0x9,0xc0,0x6,0xc0,0x96,0x4d,0xc0,0x21,0x96,0x4d,0xc1,0xe6,0xb6,0xc1,0xe6,0xce,0xc1,0xe7,0x2a,0x29,0x96,0x60,0x96,0x61,0x96,0x61,0x96,0x60,0xc0,0xc0,0x96,0x62,0x96,0x62,0xc0,0xc1,0x4,0x78,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x63,0xa,0x96,0x64,0xe5,0x3a,0xc3,0xc4,0x96,0x5f,0x83,0x32,0x96,0x65,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x96,0x4d,0xd3,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x96,0x5e,0xc6,0x8b,0x9,0xc6,0x89,0x4c,0xc6,0x96,0x4d,0xcb,0x0,0xc6,0x6,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0xc1,0xe7,0x9c,0xc1,0xe7,0xb4,0xc1,0xe8,0xc,0x29,0x96,0x67,0x96,0x68,0x96,0x68,0x96,0x67,0xc0,0xc0,0x96,0x69,0x96,0x69,0xc0,0xc1,0x4,0x7e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x6a,0xa,0x96,0x6b,0xe5,0x3a,0xc3,0xc4,0x96,0x5f,0x83,0x32,0x96,0x6c,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x96,0x4d,0xd3,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x96,0x5e,0xc6,0x8b,0x9,0xc6,0x89,0x79,0xc6,0x96,0x4d,0xcb,0x0,0xc6,0x6,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0xc1,0xe8,0x7e,0xc1,0xe8,0x96,0xc1,0xe8,0xee,0x29,0x96,0x6e,0x96,0x6f,0x96,0x6f,0x96,0x6e,0xc0,0xc0,0x96,0x70,0x96,0x70,0xc0,0xc1,0x4,0x84,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x71,0xa,0x96,0x72,0xe5,0x3a,0xc3,0xc4,0x96,0x5f,0x83,0x32,0x96,0x73,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x96,0x4d,0xd3,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x96,0x5e,0xc6,0x8b,0x9,0xc6,0x8a,0x2b,0xc6,0x96,0x4d,0xcb,0x0,0xc6,0x6,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0x3,0x6c,0x68,0x73,0x65,0x8b,0x9,0xc0,0x6,0xc0,0x96,0x75,0xc0,0x96,0x4d,0xc0,0x88,0x3e,0xc0,0x22,0x96,0x75,0x96,0x4d,0xc1,0xe9,0x64,0xc1,0xe9,0x7c,0xc1,0xe9,0xb2,0xc1,0xe9,0xca,0xc1,0xea,0x14,0xc1,0xea,0x46,0x2f,0x96,0x78,0x96,0x79,0x96,0x79,0x96,0x78,0x96,0x7a,0x96,0x7b,0x96,0x7b,0x96,0x7a,0xc0,0xc0,0x96,0x7c,0x96,0x7c,0x96,0x7d,0x96,0x7d,0xc0,0xc1,0x4,0x8a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x96,0x7e,0xa,0x96,0x7f,0xe5,0x5f,0xc3,0xc4,0x96,0x77,0x83,0x73,0x97,0x0,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x96,0x75,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x96,0x4d,0xd3,0xd3,0xd1,0x1,0xe1,0xb,0xc7,0x4,0xc6,0x96,0x76,0xc6,0x8b,0x9,0xc6,0x88,0x3e,0xc6,0x88,0x3e,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x88,0x3e,0xd3,0xc6,0x96,0x75,0xcb,0x0,0xc6,0x96,0x4d,0xcb,0x1,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0x22,0xc0,0x6,0xc1,0xea,0xb6,0xc1,0xea,0xc2,0xc1,0xea,0xd4,0xc1,0xea,0xf2,0x29,0x97,0x3,0x97,0x3,0x97,0x4,0x97,0x5,0x97,0x5,0x97,0x6,0x97,0x6,0x97,0x4,0x97,0x3,0xc1,0x4,0x92,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0x7,0xa,0x97,0x8,0xe5,0x2a,0xc3,0xc4,0xc4,0xc4,0x97,0x9,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xf0,0x2,0x97,0x2,0xc8,0x0,0x0,0xc6,0x8a,0x7c,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x88,0x6b,0xd3,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0x6,0x76,0x61,0x72,0x72,0x65,0x66,0xc1,0xeb,0x68,0xc1,0xeb,0x74,0xc1,0xeb,0x86,0x27,0x97,0xc,0x97,0xc,0x97,0xd,0x97,0xe,0x97,0xe,0x97,0xd,0x97,0xc,0xc1,0x4,0x96,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0xf,0xa,0x97,0x10,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x97,0x11,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x8a,0x7c,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x88,0x6b,0xd3,0xd3,0xd3,0x0,0xa,0x73,0x65,0x74,0x66,0x69,0x65,0x6c,0x64,0x6f,0x70,0x63,0x90,0xc,0xc0,0x8b,0x9,0xc0,0x94,0x13,0xc0,0x64,0x8b,0x9,0xc0,0x96,0x75,0xc0,0x96,0x4d,0xc0,0x88,0x3e,0xc0,0x24,0x90,0xc,0x96,0x75,0x96,0x4d,0x88,0x3e,0xc1,0xec,0x12,0xc1,0xec,0x2a,0xc1,0xec,0x94,0xc1,0xec,0xe0,0xc1,0xed,0x0,0xc1,0xec,0xf8,0xc1,0xed,0x4e,0xc1,0xed,0xc8,0xc1,0xed,0xfa,0xc1,0xee,0x22,0xe1,0x21,0x97,0x17,0x97,0x18,0x97,0x18,0x97,0x17,0xc0,0xc0,0x97,0x19,0x97,0x19,0xc0,0x97,0x1a,0x97,0x1b,0x97,0x1c,0x97,0x1c,0x97,0x1b,0x97,0x1a,0xc0,0xc0,0x97,0x1d,0x97,0x1d,0xc0,0xc0,0xc0,0x97,0x1e,0x97,0x1e,0xc0,0xc0,0x97,0x1f,0x97,0x1f,0xc0,0x97,0x1e,0x97,0x20,0x97,0x20,0xc0,0xc1,0x4,0x9a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0x21,0xa,0x97,0x22,0xe5,0x81,0x43,0xc3,0xc4,0x97,0x16,0x8c,0x25,0x97,0x23,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0xc,0xd3,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x97,0x14,0xc6,0x8b,0x9,0xc6,0x94,0x13,0xc6,0x94,0x13,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x55,0xd3,0xc6,0x90,0xc,0xcb,0x0,0xd3,0xd1,0x1,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x96,0x4d,0xd3,0xc6,0x47,0xd3,0xd3,0xd1,0x2,0xe1,0x9,0xc7,0x4,0xc6,0x97,0x15,0xc6,0x8b,0x9,0xc6,0x88,0x3e,0xc6,0x88,0x3e,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x88,0x3e,0xd3,0xc6,0x96,0x75,0xcb,0x1,0xc6,0x96,0x4d,0xcb,0x2,0xd3,0xd1,0x3,0xe1,0xb,0xc7,0x4,0xc6,0x94,0x14,0xc6,0x8b,0x9,0xc6,0x94,0x13,0xc6,0x94,0x13,0xc6,0x94,0x15,0xc6,0x85,0x38,0xe1,0x2,0xc7,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x20,0xc6,0x8b,0x9,0xc6,0x5a,0xc6,0x84,0x18,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x55,0xd3,0xd3,0xcb,0x3,0xd3,0xc6,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xc6,0x90,0xc,0xcb,0x0,0xd3,0x0,0x8,0x61,0x73,0x73,0x69,0x67,0x6e,0x6f,0x70,0x1,0x27,0xc1,0xf0,0x52,0x22,0x97,0x27,0x97,0x27,0xc1,0x4,0xae,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0x28,0xa,0x97,0x29,0xb0,0xc3,0xc4,0xc4,0xc4,0x97,0x2a,0xe0,0x0,0xc8,0x2,0x1,0xc6,0x90,0x7b,0xd3,0x0,0xa,0x27,0x20,0x6f,0x6e,0x20,0x6c,0x69,0x6e,0x65,0x20,0x11,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x61,0x20,0x6d,0x75,0x74,0x61,0x62,0x6c,0x65,0xc1,0xf0,0x0,0xc1,0xf0,0xa,0xc1,0xf0,0x40,0xc1,0xf0,0x36,0x2c,0x97,0x2e,0x97,0x2f,0x97,0x2f,0x97,0x2e,0x97,0x30,0x97,0x31,0xc0,0xc0,0xc0,0xc0,0xc0,0x97,0x30,0xc1,0x4,0xa8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0x32,0xa,0x97,0x33,0xe5,0x38,0xc3,0xc4,0x91,0x29,0x83,0x73,0x97,0x34,0xe1,0x1,0xc9,0x2,0xd,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x6,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x18,0xe1,0x5,0xc7,0x19,0xc6,0x97,0x26,0xe1,0x0,0xd0,0x97,0x2b,0xd3,0xc6,0x97,0x2c,0xcb,0x0,0xc6,0x97,0x2d,0xd3,0xd3,0x0,0x63,0x90,0xc,0xc0,0x8b,0x9,0xc0,0x90,0x5b,0xc0,0x23,0x8a,0x7c,0x96,0x4d,0x90,0x5b,0xc1,0xee,0xb8,0xc1,0xee,0xca,0xc1,0xee,0xec,0xc1,0xef,0x1c,0xc1,0xef,0x4,0xc1,0xee,0xf8,0xc1,0xef,0x36,0xc1,0xef,0x28,0xc1,0xf0,0xc8,0xc1,0xf0,0xe0,0xc1,0xf1,0x3c,0xe1,0x20,0x97,0x38,0x97,0x39,0x97,0x39,0x97,0x38,0xc0,0x97,0x3a,0x97,0x3b,0x97,0x3b,0x97,0x3c,0x97,0x3c,0x97,0x3d,0x97,0x3d,0x97,0x3c,0x97,0x3e,0x97,0x3e,0x97,0x3f,0x97,0x3f,0x97,0x3e,0x97,0x3b,0xc0,0x97,0x40,0x97,0x41,0x97,0x41,0x97,0x40,0xc0,0xc0,0x97,0x42,0x97,0x42,0xc0,0xc0,0xc0,0xc0,0xc1,0x4,0xa6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0x43,0xa,0x97,0x44,0xe5,0x81,0x1d,0xc3,0xc4,0x97,0x37,0x82,0x5d,0x97,0x45,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x8a,0x7c,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x7b,0xd3,0xd3,0xd1,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x84,0x33,0xd3,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0xb,0xd3,0xc6,0x8b,0xa,0xd3,0xd3,0xd0,0x97,0x35,0xd3,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x5b,0xd3,0xd3,0xd1,0x1,0xe1,0x9,0xc7,0x4,0xc6,0x97,0x15,0xc6,0x8b,0x9,0xc6,0x88,0x3e,0xc6,0x88,0x3e,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x88,0x3e,0xd3,0xc6,0x96,0x75,0xcb,0x0,0xc6,0x96,0x4d,0xcb,0x1,0xd3,0xd1,0x2,0xe1,0x7,0xc7,0x4,0xc6,0x97,0x36,0xc6,0x8b,0x9,0xc6,0x93,0x55,0xc6,0x90,0xc,0xcb,0x0,0xc6,0x90,0x5b,0xcb,0x2,0xd3,0x0,0x21,0x8f,0x74,0xc1,0xf2,0x66,0x22,0x97,0x48,0x97,0x48,0xc1,0x4,0xb8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0x49,0xa,0x97,0x4a,0xb3,0xc3,0x97,0x47,0xc4,0xc4,0x97,0x4b,0xe1,0x2,0xc9,0x2,0x8,0xc8,0x1,0x0,0xca,0x0,0xd3,0x0,0xc1,0xf2,0x46,0xc1,0xf2,0x3a,0xc1,0xf2,0x2e,0xc1,0xf2,0x40,0xc1,0xf2,0xd6,0x2f,0x97,0x4d,0x97,0x4e,0x97,0x4e,0x97,0x4f,0x97,0x4f,0x97,0x50,0x97,0x50,0x97,0x50,0x97,0x4e,0x97,0x4d,0xc0,0xc0,0x97,0x51,0x97,0x51,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0x52,0xa,0x97,0x4a,0xe5,0x46,0xc3,0xc4,0x90,0x2f,0x83,0x32,0x97,0x53,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x84,0x18,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x97,0x4c,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x95,0x55,0xc6,0x8b,0x9,0xc6,0x93,0x11,0xc6,0x84,0x18,0xcb,0x0,0xc6,0x6,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x6,0xd3,0xd3,0x0,0xc1,0xf4,0x8c,0xc1,0xf4,0x98,0xc1,0xf4,0xde,0xc1,0xf4,0xe8,0xc1,0xf4,0xf4,0xc1,0xf5,0x0,0xc1,0xf5,0x1a,0x2f,0x97,0x55,0x97,0x56,0x97,0x56,0x97,0x55,0x97,0x57,0x97,0x58,0x97,0x58,0x97,0x59,0x97,0x59,0x97,0x5a,0x97,0x5b,0x97,0x5b,0x97,0x5a,0x97,0x58,0x97,0x57,0xc1,0x4,0xc6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0x5c,0xa,0x97,0x5d,0xe5,0x41,0xc3,0xc4,0xc4,0xc4,0x97,0x5e,0xe0,0x2,0xc9,0x1,0x0,0xc6,0x88,0x7d,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x82,0x5b,0xd3,0xc2,0xd3,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x3b,0xe1,0x2,0xc7,0x3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x82,0x5b,0xd3,0xe1,0x2,0xc9,0x3,0x8,0xc8,0x2,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x47,0xd3,0xd3,0xd3,0xd3,0x0,0xc1,0xf5,0xf0,0xc1,0xf5,0xfa,0xc1,0xf6,0x4e,0xc1,0xf6,0x58,0xc1,0xf6,0x62,0xc1,0xf6,0x76,0x2d,0x97,0x60,0x97,0x61,0x97,0x61,0x97,0x60,0x97,0x62,0x97,0x63,0x97,0x63,0x97,0x64,0x97,0x64,0x97,0x65,0x97,0x65,0x97,0x63,0x97,0x62,0xc1,0x4,0xcc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0x66,0xa,0x97,0x67,0xe5,0x3a,0xc3,0x97,0x47,0xc4,0xc4,0x97,0x68,0xe0,0x2,0xc9,0x2,0x0,0xc6,0x88,0x7d,0xe0,0x0,0xca,0x0,0xc6,0x88,0x6b,0xd3,0xc2,0xd3,0xe0,0x1,0xc9,0x2,0x1,0xc6,0x3b,0xe1,0x2,0xc7,0x3,0xe0,0x0,0xca,0x0,0xc6,0x88,0x6b,0xd3,0xe1,0x2,0xc9,0x4,0x8,0xc8,0x3,0x0,0xca,0x0,0xd3,0xd3,0xd3,0x0,0xc1,0xf5,0x9e,0xc1,0xf5,0x92,0x24,0x97,0x6a,0x97,0x6b,0x97,0x6b,0x97,0x6a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0x6c,0xa,0x97,0x67,0xbb,0xc3,0xc4,0xc4,0xc4,0x97,0x6d,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x13,0xd3,0xc6,0x83,0x25,0xd0,0x97,0x69,0xd3,0x0,0x5,0x65,0x6e,0x74,0x72,0x79,0x21,0x97,0x6f,0x21,0x97,0x70,0xc1,0xf4,0x52,0x26,0x97,0x72,0x97,0x72,0xc0,0xc0,0xc0,0xc0,0xc1,0x4,0xc2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x97,0x73,0xa,0x97,0x74,0xbe,0xc3,0x97,0x71,0xc4,0xc4,0x97,0x75,0xe8,0x0,0xca,0x0,0xc6,0x82,0x5b,0xd3,0xe3,0x0,0xd0,0x97,0x5f,0xd3,0xc0,0xe3,0x0,0xd0,0x97,0x6e,0xd3,0xd4,0x0,0x22,0x8c,0x11,0x93,0xc,0xc1,0xf3,0x86,0xc1,0xf3,0x78,0xc1,0xf3,0xc0,0xc1,0xf3,0xb6,0xc1,0xf4,0x4,0xc1,0xf3,0xf8,0xc1,0xf3,0xec,0xc1,0xf3,0xfe,0xc1,0xf7,0x8a,0xc1,0xf7,0xb6,0x37,0x97,0x78,0x97,0x79,0x97,0x78,0x97,0x7a,0x97,0x7b,0x97,0x7a,0x97,0x7c,0x97,0x7d,0x97,0x7d,0x97,0x7e,0x97,0x7e,0x97,0x7f,0x97,0x7f,0x97,0x7f,0x97,0x7d,0x97,0x7c,0xc0,0xc0,0x98,0x0,0x98,0x0,0x98,0x1,0x98,0x1,0xc0,0xc1,0x4,0xbe,0x64,0x4,0xc8,0x5,0xc3,0x6,0x98,0x2,0xa,0x98,0x3,0xe5,0x5f,0xc3,0xc4,0x97,0x77,0x83,0x73,0x98,0x4,0xe0,0x0,0xc7,0x1d,0xc6,0x83,0x23,0xd3,0xd1,0x0,0xe0,0x0,0xc7,0x15,0xc6,0x83,0x23,0xd3,0xd1,0x1,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x84,0x18,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x83,0x25,0xd0,0x97,0x76,0xd3,0xe1,0x7,0xc7,0x4,0xc6,0x93,0xd,0xc6,0x8b,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x93,0xc,0xcb,0x1,0xc6,0x8c,0x11,0xe0,0x0,0xcb,0x0,0xc6,0x92,0x5c,0xd3,0xd3,0x0,0x6,0x67,0x75,0x61,0x72,0x64,0x73,0x4,0x63,0x6f,0x6e,0x64,0x62,0x98,0x7,0xc0,0x5e,0xc0,0x5,0x67,0x75,0x61,0x72,0x64,0x21,0x98,0x9,0x21,0x98,0xa,0x25,0x98,0x7,0x8b,0x2e,0x8b,0x16,0x8b,0x14,0x5e,0xc1,0xf8,0x94,0xc1,0xf8,0xbc,0xc1,0xf8,0xb0,0xc1,0xf9,0x16,0xc1,0xf9,0x56,0xc1,0xf9,0x76,0xc1,0xf9,0xc6,0x3b,0x98,0xd,0x98,0xe,0x98,0xe,0x98,0xf,0x98,0xf,0x98,0xe,0x98,0xd,0x98,0x10,0xc0,0xc0,0x98,0x11,0x98,0x11,0x98,0x12,0x98,0x12,0xc0,0x98,0x10,0x98,0x13,0xc0,0xc0,0xc0,0x98,0x13,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc1,0x4,0xda,0x64,0x4,0xc8,0x5,0xc3,0x6,0x98,0x14,0xa,0x98,0x15,0xe5,0x81,0x1b,0xc3,0x98,0xb,0x98,0xc,0x8b,0x5d,0x98,0x16,0xe1,0x2,0xc9,0x2,0x8,0xc8,0x1,0x0,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xca,0x0,0xc6,0x98,0x7,0xd3,0xc6,0x84,0x53,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x2,0x7,0xc8,0x1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x96,0x54,0xc6,0x8b,0x9,0xc6,0x5e,0xc6,0x8f,0x26,0xe0,0x0,0xca,0x0,0xc6,0x8f,0x26,0xd3,0xc6,0x6,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x2,0x1,0xc6,0x3b,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0x50,0xc6,0x88,0x6b,0xc6,0x17,0xc6,0x8b,0x4,0xc1,0xc6,0x8b,0x2e,0xcb,0x1,0xd3,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x90,0x38,0xc6,0x8b,0x9,0xc6,0x8b,0x2e,0xc6,0x8b,0x2e,0xcb,0x3,0xd3,0xd1,0x4,0xe1,0x5,0xc7,0x4,0xc6,0x98,0x8,0xc6,0x98,0x7,0xcb,0x0,0xc6,0x5e,0xcb,0x4,0xd3,0x0,0x62,0x98,0x6,0xc0,0x8b,0x9,0xc0,0x2,0x67,0x73,0x21,0x98,0x19,0xc1,0xf8,0x44,0xc1,0xf8,0x36,0x27,0x98,0x1b,0x98,0x1c,0x98,0x1c,0x98,0x1b,0xc0,0xc0,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x98,0x1d,0xa,0x98,0x15,0xe5,0x32,0xc3,0xc4,0x98,0x1a,0x83,0x32,0x98,0x1e,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x98,0x6,0xd3,0xc6,0x8c,0x11,0xd0,0x98,0x17,0xd3,0xd1,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x98,0x18,0xc6,0x8b,0x9,0xc6,0x98,0x6,0xc6,0x98,0x6,0xcb,0x0,0xd3,0x0,0x5,0x70,0x72,0x69,0x6e,0x74,0x5,0x45,0x52,0x52,0x4f,0x52,0xd,0x75,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x74,0x65,0x72,0x6d,0x20,0xc1,0xfc,0x8,0x22,0x98,0x23,0x98,0x23,0xc1,0x4,0xf0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x98,0x24,0xa,0x98,0x25,0xb0,0xc3,0xc4,0xc4,0xc4,0x98,0x26,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x8b,0x9,0xd3,0x0,0xc1,0xfb,0x70,0xc1,0xfb,0x66,0xc1,0xfb,0xa4,0xc1,0xfb,0x9a,0xc1,0xfb,0xae,0xc1,0xfb,0xa6,0xc1,0xfb,0xde,0xc1,0xfb,0xd4,0x31,0x98,0x28,0x98,0x29,0x98,0x28,0x98,0x2a,0x98,0x2b,0x98,0x2c,0x98,0x2d,0x98,0x2c,0x98,0x2a,0x98,0x2e,0x98,0x2f,0xc0,0xc0,0xc0,0xc0,0xc0,0x98,0x2e,0xc1,0x4,0xec,0x64,0x4,0xc8,0x5,0xc3,0x6,0x98,0x30,0xa,0x98,0x31,0xe5,0x2f,0xc3,0xc4,0xc4,0xc4,0x98,0x32,0xe1,0x1,0xc7,0x23,0xc6,0x98,0x21,0xd3,0xe1,0x1,0xc7,0x23,0xe1,0x1,0xc7,0x1a,0xc8,0x0,0x1,0xd3,0xd3,0xe1,0x1,0xc7,0x18,0xe1,0x2,0xc7,0x19,0xc6,0x98,0x22,0xe1,0x0,0xd0,0x98,0x27,0xd3,0xd3,0xd3,0x0,0x3,0x6c,0x65,0x78,0x24,0x89,0x14,0x8f,0x74,0x8b,0x30,0x8b,0x31,0xc1,0x84,0xea,0xc1,0x85,0x48,0xc1,0x85,0x3c,0xc1,0x86,0x4e,0xc1,0x86,0x5e,0xc1,0x86,0xba,0xc1,0x86,0xae,0xc1,0x87,0x12,0xc1,0x87,0x6,0xc1,0x89,0x6a,0xc1,0x89,0x5e,0xc1,0x8b,0x32,0xc1,0x8b,0x16,0xc1,0x8b,0xa,0xc1,0x8b,0x4c,0xc1,0x8b,0x40,0xc1,0x8c,0xa4,0xc1,0x8c,0x98,0xc1,0xbe,0x72,0xc1,0xbe,0x66,0xc1,0xc7,0x6a,0xc1,0xc7,0x5e,0xc1,0xd4,0x66,0xc1,0xd4,0x5a,0xc1,0xdb,0xb2,0xc1,0xdb,0x9a,0xc1,0xdb,0x8e,0xc1,0xdb,0xdc,0xc1,0xdb,0xd0,0xc1,0xdb,0xc2,0xc1,0xe0,0xae,0xc1,0xe0,0x96,0xc1,0xe0,0x8a,0xc1,0xe0,0xc8,0xc1,0xe0,0xbc,0xc1,0xe3,0xdc,0xc1,0xe3,0xd0,0xc1,0xe6,0x74,0xc1,0xe6,0x68,0xc1,0xe7,0x5e,0xc1,0xe7,0x52,0xc1,0xe8,0x40,0xc1,0xe8,0x34,0xc1,0xe9,0x22,0xc1,0xe9,0x16,0xc1,0xea,0x7a,0xc1,0xea,0x6e,0xc1,0xeb,0x26,0xc1,0xeb,0x1a,0xc1,0xeb,0xbc,0xc1,0xeb,0xb0,0xc1,0xee,0x68,0xc1,0xee,0x5c,0xc1,0xf1,0xe4,0xc1,0xf1,0xd8,0xc1,0xf3,0x22,0xc1,0xf3,0xa,0xc1,0xf2,0xfe,0xc1,0xf3,0x3c,0xc1,0xf3,0x30,0xc1,0xf7,0xee,0xc1,0xf7,0xe2,0xe1,0x81,0x4f,0x98,0x36,0x98,0x36,0x98,0x36,0xc0,0xc0,0x98,0x37,0x98,0x38,0x98,0x37,0xc0,0xc0,0x98,0x39,0x98,0x39,0x98,0x3a,0x98,0x3a,0x98,0x39,0xc0,0xc0,0x98,0x3b,0x98,0x3b,0x98,0x3c,0x98,0x3c,0x98,0x3b,0xc0,0xc0,0x98,0x3d,0x98,0x3d,0x98,0x3e,0x98,0x3e,0x98,0x3d,0xc0,0xc0,0x98,0x3f,0x98,0x3f,0x98,0x40,0x98,0x40,0x98,0x3f,0xc0,0xc0,0x98,0x41,0x98,0x41,0x98,0x42,0x98,0x42,0x98,0x43,0x98,0x43,0x98,0x42,0x98,0x44,0x98,0x44,0x98,0x45,0x98,0x45,0x98,0x44,0x98,0x41,0xc0,0xc0,0x98,0x46,0x98,0x46,0x98,0x47,0x98,0x47,0x98,0x46,0xc0,0xc0,0x98,0x48,0x98,0x48,0x98,0x49,0x98,0x49,0x98,0x48,0xc0,0xc0,0x98,0x4a,0x98,0x4a,0x98,0x4b,0x98,0x4b,0x98,0x4a,0xc0,0xc0,0x98,0x4c,0x98,0x4c,0x98,0x4d,0x98,0x4d,0x98,0x4c,0xc0,0xc0,0x98,0x4e,0x98,0x4e,0x98,0x4f,0x98,0x4f,0x98,0x50,0x98,0x50,0x98,0x4f,0x98,0x51,0x98,0x51,0x98,0x52,0x98,0x53,0x98,0x53,0x98,0x52,0x98,0x51,0x98,0x4e,0xc0,0xc0,0x98,0x54,0x98,0x54,0x98,0x55,0x98,0x55,0x98,0x56,0x98,0x56,0x98,0x55,0x98,0x57,0x98,0x57,0x98,0x58,0x98,0x58,0x98,0x57,0x98,0x54,0xc0,0xc0,0x98,0x59,0x98,0x59,0x98,0x5a,0x98,0x5a,0x98,0x59,0xc0,0xc0,0x98,0x5b,0x98,0x5b,0x98,0x5c,0x98,0x5c,0x98,0x5b,0xc0,0xc0,0x98,0x5d,0x98,0x5d,0x98,0x5e,0x98,0x5e,0x98,0x5d,0xc0,0xc0,0x98,0x5f,0x98,0x5f,0x98,0x60,0x98,0x60,0x98,0x5f,0xc0,0xc0,0x98,0x61,0x98,0x61,0x98,0x62,0x98,0x62,0x98,0x61,0xc0,0xc0,0x98,0x63,0x98,0x63,0x98,0x64,0x98,0x64,0x98,0x63,0xc0,0xc0,0x98,0x65,0x98,0x65,0x98,0x66,0x98,0x66,0x98,0x65,0xc0,0xc0,0x98,0x67,0x98,0x67,0x98,0x68,0x98,0x68,0x98,0x67,0xc0,0xc0,0x98,0x69,0x98,0x69,0x98,0x6a,0x98,0x6a,0x98,0x69,0xc0,0xc0,0x98,0x6b,0x98,0x6b,0x98,0x6c,0x98,0x6c,0x98,0x6b,0xc0,0xc0,0x98,0x6d,0x98,0x6d,0x98,0x6e,0x98,0x6e,0x98,0x6f,0x98,0x6f,0x98,0x6e,0x98,0x70,0x98,0x70,0x98,0x71,0x98,0x71,0x98,0x70,0x98,0x6d,0xc0,0xc0,0x98,0x72,0x98,0x72,0x98,0x73,0x98,0x73,0x98,0x72,0xc0,0xc0,0xc0,0xc0,0xc1,0x2,0xb4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x98,0x74,0xa,0x98,0x75,0xe5,0x84,0x7b,0x98,0x34,0x98,0x35,0xc4,0xc4,0x98,0x76,0xe1,0x2,0xc7,0x0,0xca,0x1,0xc2,0xd3,0xe3,0x0,0xd0,0x90,0xa,0xd3,0xe1,0x1,0xc7,0x21,0xca,0x1,0xd3,0xe3,0x0,0xd0,0x90,0x18,0xd3,0xe1,0x1,0xc7,0x1e,0xe8,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xd3,0xe3,0x0,0xd0,0x90,0x1b,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x5a,0xd3,0xe3,0x0,0xd0,0x90,0x1e,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x1f,0xd3,0xe3,0x0,0xd0,0x90,0x36,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x89,0x13,0xd3,0xe3,0x0,0xd0,0x90,0x3f,0xd3,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0x2e,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x5e,0xd3,0xd3,0xe3,0x0,0xd0,0x90,0x4b,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0x43,0xd3,0xe3,0x0,0xd0,0x93,0x53,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x7a,0xd3,0xe3,0x0,0xd0,0x94,0x31,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x94,0x32,0xd3,0xe3,0x0,0xd0,0x95,0x31,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0xe,0xd3,0xe3,0x0,0xd0,0x96,0x2,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x94,0x13,0xd3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xe0,0x0,0xca,0x1,0xc6,0x90,0xc,0xd3,0xc6,0x88,0x6b,0xd3,0xc6,0x96,0x3,0xd3,0xd3,0xe3,0x0,0xd0,0x96,0x1e,0xd3,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x94,0x13,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x96,0x1f,0xd3,0xd3,0xe3,0x0,0xd0,0x96,0x46,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x96,0x47,0xd3,0xe3,0x0,0xd0,0x96,0x5d,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x89,0x4c,0xd3,0xe3,0x0,0xd0,0x96,0x66,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x89,0x79,0xd3,0xe3,0x0,0xd0,0x96,0x6d,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x8a,0x2b,0xd3,0xe3,0x0,0xd0,0x96,0x74,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x88,0x3e,0xd3,0xe3,0x0,0xd0,0x97,0x1,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x8a,0x7c,0xd3,0xe3,0x0,0xd0,0x97,0xa,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x97,0xb,0xd3,0xe3,0x0,0xd0,0x97,0x12,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x97,0x13,0xd3,0xe3,0x0,0xd0,0x97,0x24,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x97,0x25,0xd3,0xe3,0x0,0xd0,0x97,0x46,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x93,0x11,0xd3,0xe3,0x0,0xd0,0x97,0x54,0xd3,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x93,0xe,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x8c,0x11,0xd3,0xd3,0xe3,0x0,0xd0,0x98,0x5,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x9,0xd3,0xc6,0x98,0x6,0xd3,0xe3,0x0,0xd0,0x98,0x1f,0xd3,0xc0,0xe3,0x0,0xd0,0x98,0x33,0xd3,0xd4,0x0,0x9,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0xc1,0xfc,0x82,0x23,0x98,0x79,0x98,0x79,0x98,0x79,0xc1,0x4,0xf6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x98,0x7a,0xa,0x98,0x7b,0xaf,0xc3,0xc4,0xc4,0xc4,0x98,0x7c,0xe1,0x1,0xc7,0x3,0xc6,0x84,0x66,0xd3,0x0,0xc1,0xfc,0xd8,0x23,0x98,0x7e,0x98,0x7e,0x98,0x7e,0xc1,0x4,0xf8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x98,0x7f,0xa,0x99,0x0,0xaf,0xc3,0xc4,0xc4,0xc4,0x99,0x1,0xe1,0x1,0xc7,0x3,0xc6,0x84,0x5f,0xd3,0x0,0xc1,0xfd,0x2c,0x23,0x99,0x3,0x99,0x3,0x99,0x3,0xc1,0x4,0xfa,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x4,0xa,0x99,0x5,0xaf,0xc3,0xc4,0xc4,0xc4,0x99,0x6,0xe1,0x1,0xc7,0x3,0xc6,0x81,0x24,0xd3,0x0,0xc1,0xfd,0x82,0x23,0x99,0x8,0x99,0x8,0x99,0x8,0xc1,0x4,0xfc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x9,0xa,0x99,0xa,0xaf,0xc3,0xc4,0xc4,0xc4,0x99,0xb,0xe1,0x1,0xc7,0x3,0xc6,0x84,0x53,0xd3,0x0,0x8,0x69,0x73,0x4e,0x75,0x6d,0x62,0x65,0x72,0x7,0x69,0x73,0x46,0x6c,0x6f,0x61,0x74,0xc1,0xfe,0xa,0x23,0x99,0xf,0x99,0xf,0x99,0xf,0xc1,0x5,0x0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x10,0xa,0x99,0x11,0xb2,0xc3,0xc4,0xc4,0xc4,0x99,0x12,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x18,0xc8,0x1,0x0,0xd3,0x0,0xc1,0xfe,0x66,0x23,0x99,0x14,0x99,0x14,0x99,0x14,0xc1,0x5,0x2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x15,0xa,0x99,0x16,0xb2,0xc3,0xc4,0xc4,0xc4,0x99,0x17,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x18,0xc8,0x1,0x0,0xd3,0x0,0xc1,0xfe,0xc2,0x23,0x99,0x19,0x99,0x19,0x99,0x19,0xc1,0x5,0x4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x1a,0xa,0x99,0x1b,0xb2,0xc3,0xc4,0xc4,0xc4,0x99,0x1c,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x18,0xc8,0x1,0x0,0xd3,0x0,0xc1,0xff,0x1e,0x23,0x99,0x1e,0x99,0x1e,0x99,0x1e,0xc1,0x5,0x6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x1f,0xa,0x99,0x20,0xb2,0xc3,0xc4,0xc4,0xc4,0x99,0x21,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x6d,0xc8,0x1,0x0,0xd3,0x0,0xc1,0xfd,0xf6,0xc1,0xfd,0xe8,0xc1,0xfe,0x4e,0xc1,0xfe,0xaa,0xc1,0xfe,0xb2,0x34,0x99,0x23,0x99,0x24,0x99,0x23,0xc0,0xc0,0x99,0x25,0x99,0x25,0x99,0x25,0xc0,0xc0,0x99,0x26,0x99,0x26,0x99,0x27,0x99,0x27,0x99,0x27,0x99,0x26,0xc0,0xc0,0xc0,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x28,0xa,0x99,0x11,0xe5,0x44,0xc3,0xc4,0xc4,0xc4,0x99,0x29,0xe1,0x1,0xc7,0x25,0xc8,0x0,0x0,0xd3,0xe3,0x0,0xd0,0x99,0x13,0xd3,0xe1,0x2,0xc7,0xc,0xc8,0x0,0x0,0xc4,0x0,0xd3,0xe3,0x0,0xd0,0x99,0x18,0xd3,0xe1,0x2,0xc7,0x6,0xc8,0x0,0x0,0xe1,0x2,0xc7,0x26,0xc4,0x2,0xc4,0x19,0xd3,0xd3,0xe3,0x0,0xd0,0x99,0x1d,0xd3,0xc0,0xe3,0x0,0xd0,0x99,0x22,0xd3,0xd4,0x0,0xc1,0xff,0x84,0xc1,0xff,0x9e,0x25,0x99,0x2b,0x99,0x2b,0x99,0x2c,0x99,0x2c,0x99,0x2b,0xc1,0x5,0x8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x2d,0xa,0x99,0x2e,0xb8,0xc3,0xc4,0xc4,0xc4,0x99,0x2f,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x18,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x84,0x18,0xd3,0xd3,0x0,0xc1,0xff,0xf6,0xc2,0x1,0x0,0x10,0x25,0x99,0x31,0x99,0x31,0x99,0x32,0x99,0x32,0x99,0x31,0xc1,0x5,0xa,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x33,0xa,0x99,0x34,0xb8,0xc3,0xc4,0xc4,0xc4,0x99,0x35,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x18,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x84,0x18,0xd3,0xd3,0x0,0xc2,0x1,0x0,0x68,0xc2,0x1,0x0,0x82,0x25,0x99,0x37,0x99,0x37,0x99,0x38,0x99,0x38,0x99,0x37,0xc1,0x5,0xc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x39,0xa,0x99,0x3a,0xb8,0xc3,0xc4,0xc4,0xc4,0x99,0x3b,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x46,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x2e,0xd3,0xd3,0x0,0xc2,0x1,0x0,0xe2,0xc2,0x1,0x1,0x0,0x25,0x99,0x3d,0x99,0x3d,0x99,0x3e,0x99,0x3e,0x99,0x3d,0xc1,0x5,0xe,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x3f,0xa,0x99,0x40,0xb8,0xc3,0xc4,0xc4,0xc4,0x99,0x41,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x17,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xd3,0x0,0xc2,0x1,0x1,0x7a,0xc2,0x1,0x1,0x60,0xc2,0x1,0x1,0x6a,0xc2,0x1,0x1,0x7e,0xc2,0x1,0x1,0xa8,0xc2,0x1,0x1,0xa0,0xc2,0x1,0x1,0x9a,0x31,0x99,0x43,0x99,0x43,0x99,0x44,0x99,0x45,0x99,0x45,0x99,0x44,0x99,0x46,0x99,0x46,0x99,0x47,0x99,0x47,0x99,0x48,0x99,0x49,0x99,0x49,0x99,0x48,0x99,0x47,0x99,0x46,0x99,0x43,0xc1,0x5,0x10,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x4a,0xa,0x99,0x4b,0xe5,0x39,0xc3,0xc4,0xc4,0xc4,0x99,0x4c,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x5b,0xd3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x60,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x7b,0xd3,0xc6,0x8b,0x11,0xd3,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x2,0x74,0xc2,0x1,0x2,0x5a,0xc2,0x1,0x2,0x64,0xc2,0x1,0x2,0x78,0xc2,0x1,0x2,0xae,0xc2,0x1,0x2,0xa6,0xc2,0x1,0x2,0x98,0xc2,0x1,0x2,0xd6,0xc2,0x1,0x2,0xce,0xc2,0x1,0x2,0xc0,0x38,0x99,0x4e,0x99,0x4e,0x99,0x4f,0x99,0x50,0x99,0x50,0x99,0x4f,0x99,0x51,0x99,0x51,0x99,0x52,0x99,0x52,0x99,0x53,0x99,0x54,0x99,0x54,0x99,0x53,0x99,0x52,0x99,0x55,0x99,0x55,0x99,0x56,0x99,0x57,0x99,0x57,0x99,0x56,0x99,0x55,0x99,0x51,0x99,0x4e,0xc1,0x5,0x14,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x58,0xa,0x99,0x59,0xe5,0x4f,0xc3,0xc4,0xc4,0xc4,0x99,0x5a,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc9,0x2,0x9,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x90,0x5b,0xd3,0xd3,0xe1,0x3,0xc7,0x3,0xc6,0x86,0x50,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x90,0xc,0xd3,0xc6,0x8d,0x43,0xd3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x90,0xc,0xd3,0xc6,0x8b,0x11,0xd3,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x3,0x58,0xc2,0x1,0x3,0x3e,0xc2,0x1,0x3,0x48,0xc2,0x1,0x3,0x5c,0xc2,0x1,0x3,0x90,0xc2,0x1,0x3,0x88,0xc2,0x1,0x3,0x7a,0x31,0x99,0x5c,0x99,0x5c,0x99,0x5d,0x99,0x5e,0x99,0x5e,0x99,0x5d,0x99,0x5f,0x99,0x5f,0x99,0x60,0x99,0x60,0x99,0x61,0x99,0x62,0x99,0x62,0x99,0x61,0x99,0x60,0x99,0x5f,0x99,0x5c,0xc1,0x5,0x16,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x63,0xa,0x99,0x64,0xe5,0x39,0xc3,0xc4,0xc4,0xc4,0x99,0x65,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc9,0x2,0x9,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x90,0x5b,0xd3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x86,0x1f,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x90,0xc,0xd3,0xc6,0x8b,0x11,0xd3,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x2,0x3a,0xc2,0x1,0x2,0x2e,0xc2,0x1,0x2,0x20,0x2b,0x99,0x67,0x99,0x67,0x99,0x68,0x99,0x69,0x99,0x69,0x99,0x68,0x99,0x67,0xc0,0xc0,0xc0,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x6a,0xa,0x99,0x59,0xe5,0x2c,0xc3,0xc4,0xc4,0xc4,0x99,0x6b,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0xc,0xd3,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0xc,0xd3,0xe3,0x0,0xd0,0x99,0x5b,0xd3,0xc0,0xe3,0x0,0xd0,0x99,0x66,0xd3,0xd4,0x0,0xc2,0x1,0x4,0xc8,0xc2,0x1,0x4,0xe2,0xc2,0x1,0x4,0xf0,0x29,0x99,0x6d,0x99,0x6d,0x99,0x6e,0x99,0x6e,0x99,0x6e,0x99,0x6f,0x99,0x6f,0x99,0x6f,0x99,0x6d,0xc1,0x5,0x1e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x70,0xa,0x99,0x71,0xe5,0x23,0xc3,0xc4,0xc4,0xc4,0x99,0x72,0xe1,0x3,0xc7,0x3,0xc6,0x85,0x6d,0xe1,0x2,0xc7,0x8,0xc8,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xc8,0x0,0x0,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x5,0x44,0xc2,0x1,0x5,0x62,0xc2,0x1,0x5,0x76,0xc2,0x1,0x5,0x6e,0xc2,0x1,0x5,0x8a,0xc2,0x1,0x5,0x82,0x30,0x99,0x74,0x99,0x74,0x99,0x75,0x99,0x75,0x99,0x75,0x99,0x76,0x99,0x76,0x99,0x77,0x99,0x77,0x99,0x76,0x99,0x78,0x99,0x78,0x99,0x79,0x99,0x79,0x99,0x78,0x99,0x74,0xc1,0x5,0x20,0x64,0x4,0xc8,0x5,0xc3,0x6,0x99,0x7a,0xa,0x99,0x7b,0xe5,0x39,0xc3,0xc4,0xc4,0xc4,0x99,0x7c,0xe1,0x4,0xc7,0x3,0xc6,0x86,0x62,0xe1,0x2,0xc7,0x8,0xc8,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8d,0x43,0xd3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x11,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x5,0xde,0xc2,0x1,0x5,0xfa,0xc2,0x1,0x6,0xe,0xc2,0x1,0x6,0x6,0x2b,0x99,0x7e,0x99,0x7e,0x99,0x7f,0x99,0x7f,0x99,0x7f,0x9a,0x0,0x9a,0x0,0x9a,0x1,0x9a,0x1,0x9a,0x0,0x99,0x7e,0xc1,0x5,0x22,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9a,0x2,0xa,0x9a,0x3,0xe5,0x29,0xc3,0xc4,0xc4,0xc4,0x9a,0x4,0xe1,0x3,0xc7,0x3,0xc6,0x86,0x2c,0xe1,0x2,0xc7,0x8,0xc8,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x11,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x4,0xb2,0xc2,0x1,0x4,0xa2,0xc2,0x1,0x5,0x2c,0xc2,0x1,0x5,0x20,0x2e,0x9a,0x6,0x9a,0x7,0x9a,0x6,0xc0,0xc0,0x9a,0x8,0x9a,0x8,0x9a,0x9,0x9a,0x9,0x9a,0x8,0xc0,0xc0,0xc0,0xc0,0xc1,0x5,0x1c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9a,0xa,0xa,0x9a,0xb,0xe5,0x33,0xc3,0x95,0x19,0xc4,0xc4,0x9a,0xc,0xe1,0x1,0xc7,0x24,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x99,0x73,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0xc,0xd3,0xe3,0x0,0xd0,0x99,0x7d,0xd3,0xc0,0xe3,0x0,0xd0,0x9a,0x5,0xd3,0xd4,0x0,0x7,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x1,0x61,0x21,0x9a,0xf,0x21,0x9a,0x10,0xc2,0x1,0x6,0xa8,0x22,0x9a,0x12,0x9a,0x12,0xc1,0x5,0x26,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9a,0x13,0xa,0x9a,0x14,0xb0,0xc3,0x9a,0x11,0xc4,0xc4,0x9a,0x15,0xe1,0x1,0xc9,0x2,0x9,0xca,0x0,0xd3,0x0,0x23,0x47,0x8c,0x66,0x8f,0x1c,0xc2,0x1,0x4,0x12,0xc2,0x1,0x4,0x1c,0xc2,0x1,0x6,0x32,0xc2,0x1,0x4,0x64,0xc2,0x1,0x4,0x56,0xc2,0x1,0x6,0xb0,0xc2,0x1,0x6,0x8c,0xc2,0x1,0x6,0x7e,0xc2,0x1,0x6,0x6e,0xc2,0x1,0x6,0xe8,0xc2,0x1,0x6,0xde,0x38,0x9a,0x18,0x9a,0x19,0x9a,0x19,0x9a,0x18,0x9a,0x1a,0x9a,0x1b,0x9a,0x1c,0x9a,0x1c,0x9a,0x1b,0x9a,0x1a,0x9a,0x1d,0x9a,0x1e,0x9a,0x1f,0x9a,0x20,0x9a,0x20,0x9a,0x1f,0x9a,0x1e,0x9a,0x1d,0x9a,0x21,0x9a,0x21,0x9a,0x22,0x9a,0x22,0x9a,0x22,0x9a,0x21,0xc1,0x5,0x1a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9a,0x23,0xa,0x9a,0x24,0xe5,0x68,0xc3,0xc4,0x9a,0x17,0x82,0x5d,0x9a,0x25,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x5b,0xd3,0xd3,0xd1,0x0,0xe0,0x0,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6d,0xd3,0xc6,0x8c,0x11,0xd0,0x9a,0xd,0xd3,0xc6,0x9a,0xe,0xd3,0xd1,0x1,0xe0,0x0,0xf0,0x1,0x83,0x24,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x95,0x26,0xd3,0xc6,0x92,0x65,0xd3,0xc6,0x8c,0x11,0xd0,0x9a,0x16,0xd3,0xc6,0x9a,0xe,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xcb,0x0,0xcb,0x1,0xd3,0xcb,0x2,0xd3,0x0,0xc2,0x1,0x7,0x4e,0xc2,0x1,0x7,0x6a,0xc2,0x1,0x7,0xa4,0xc2,0x1,0x7,0xce,0x29,0x9a,0x27,0x9a,0x27,0x9a,0x28,0x9a,0x28,0x9a,0x29,0x9a,0x29,0x9a,0x2a,0x9a,0x2a,0x9a,0x27,0xc1,0x5,0x2c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9a,0x2b,0xa,0x9a,0x2c,0xe5,0x33,0xc3,0xc4,0xc4,0xc4,0x9a,0x2d,0xe1,0x8,0xc7,0x3,0xc6,0x86,0x79,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc4,0x0,0xc6,0x85,0x4c,0xc6,0x84,0x18,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0xc2,0x1,0x8,0xd2,0x22,0x9a,0x2f,0x9a,0x2f,0xc1,0x5,0x32,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9a,0x30,0xa,0x9a,0x31,0xb0,0xc3,0x8e,0x75,0xc4,0xc4,0x9a,0x32,0xe1,0x1,0xc9,0x2,0x9,0xca,0x0,0xd3,0x0,0x61,0x87,0x56,0xc0,0x22,0x8b,0x13,0x85,0x38,0xc2,0x1,0x9,0x5a,0xc2,0x1,0x9,0x4e,0xc2,0x1,0x9,0xac,0xc2,0x1,0x9,0xbe,0xc2,0x1,0x9,0xc8,0xc2,0x1,0xa,0x6,0xc2,0x1,0xa,0x80,0xc2,0x1,0xa,0x72,0xc2,0x1,0xa,0x60,0xc2,0x1,0xa,0x8,0xc2,0x1,0xa,0x26,0xc2,0x1,0xa,0x3a,0xc2,0x1,0xa,0x84,0xc2,0x1,0xa,0xa2,0xe1,0x25,0x9a,0x36,0x9a,0x37,0x9a,0x37,0x9a,0x36,0x9a,0x38,0x9a,0x39,0x9a,0x3a,0x9a,0x3a,0x9a,0x39,0x9a,0x38,0x9a,0x3b,0x9a,0x3b,0x9a,0x3c,0x9a,0x3c,0x9a,0x3d,0x9a,0x3d,0x9a,0x3e,0x9a,0x3e,0x9a,0x3f,0x9a,0x3f,0x9a,0x40,0x9a,0x40,0x9a,0x41,0x9a,0x41,0xc0,0xc0,0xc0,0x9a,0x3f,0x9a,0x3e,0x9a,0x3d,0x9a,0x42,0x9a,0x42,0x9a,0x43,0x9a,0x43,0x9a,0x42,0x9a,0x3c,0x9a,0x3b,0xc1,0x5,0x34,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9a,0x44,0xa,0x9a,0x45,0xe5,0x81,0x3,0xc3,0xc4,0x9a,0x35,0x83,0x73,0x9a,0x46,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8b,0x13,0xd3,0xc6,0x3b,0xc6,0x5e,0xd3,0xd1,0x0,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x3b,0xe1,0x1,0xc9,0x2,0x9,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x5e,0xd3,0xd3,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x4,0xc7,0x3,0xc6,0x88,0x0,0xe8,0x0,0xc8,0x1,0x0,0xc6,0x6,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x82,0x56,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x9a,0x34,0xc6,0x87,0x56,0xcb,0x0,0xd3,0xd3,0xc9,0x0,0x0,0xd3,0xcb,0x1,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x1,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0xd3,0x0,0x3,0x74,0x72,0x79,0xc2,0x1,0xb,0x3a,0xc2,0x1,0xb,0xbe,0xc2,0x1,0xb,0xb0,0xc2,0x1,0xb,0x9e,0xc2,0x1,0xb,0x3c,0xc2,0x1,0xb,0x5a,0xc2,0x1,0xb,0x6e,0xc2,0x1,0xb,0x8c,0xc2,0x1,0xb,0xc2,0xc2,0x1,0xb,0xe0,0x3d,0x9a,0x49,0x9a,0x49,0x9a,0x4a,0x9a,0x4a,0x9a,0x4b,0x9a,0x4b,0x9a,0x4c,0x9a,0x4c,0x9a,0x4d,0x9a,0x4d,0x9a,0x4e,0x9a,0x4e,0x9a,0x4f,0x9a,0x4f,0xc0,0xc0,0x9a,0x50,0x9a,0x50,0xc0,0x9a,0x4d,0x9a,0x4c,0x9a,0x4b,0x9a,0x51,0x9a,0x51,0x9a,0x52,0x9a,0x52,0x9a,0x51,0x9a,0x4a,0x9a,0x49,0xc1,0x5,0x3c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9a,0x53,0xa,0x9a,0x54,0xe5,0x60,0xc3,0xc4,0xc4,0xc4,0x9a,0x55,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x4,0xc7,0x3,0xc6,0x88,0x0,0xe8,0x0,0xc8,0x1,0x0,0xc6,0x6,0xd3,0xe0,0x0,0xc9,0x0,0x1,0xc6,0x82,0x56,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x9a,0x34,0xc6,0x87,0x56,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8b,0x13,0xd3,0xd3,0xd3,0xc9,0x0,0x0,0xd3,0xc9,0x0,0x1,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x1,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0xd3,0x0,0x22,0x90,0xc,0x85,0x38,0xc2,0x1,0x8,0x4e,0xc2,0x1,0x8,0x58,0xc2,0x1,0x8,0xb2,0xc2,0x1,0x8,0xa6,0xc2,0x1,0x8,0x9a,0xc2,0x1,0x8,0xac,0xc2,0x1,0x8,0xf8,0xc2,0x1,0x9,0x6,0xc2,0x1,0xa,0xc6,0xc2,0x1,0xa,0xd2,0xc2,0x1,0xa,0xcc,0xc2,0x1,0xb,0x2,0xc2,0x1,0xa,0xf6,0xc2,0x1,0xa,0xe8,0xc2,0x1,0xa,0xdc,0xc2,0x1,0xc,0x62,0xc2,0x1,0xc,0x54,0xc2,0x1,0xc,0x42,0xc2,0x1,0xc,0x4,0xc2,0x1,0xc,0x20,0xc2,0x1,0xc,0x34,0xc2,0x1,0xc,0x66,0xc2,0x1,0xc,0x84,0xe1,0x37,0x9a,0x58,0x9a,0x59,0x9a,0x59,0x9a,0x58,0x9a,0x5a,0x9a,0x5b,0x9a,0x5b,0x9a,0x5c,0x9a,0x5c,0x9a,0x5d,0x9a,0x5d,0x9a,0x5d,0x9a,0x5b,0x9a,0x5a,0xc0,0x9a,0x5e,0x9a,0x5f,0x9a,0x5f,0xc0,0xc0,0x9a,0x60,0x9a,0x61,0x9a,0x62,0x9a,0x63,0x9a,0x63,0x9a,0x64,0x9a,0x65,0x9a,0x66,0x9a,0x66,0x9a,0x65,0x9a,0x64,0x9a,0x63,0x9a,0x61,0xc0,0x9a,0x67,0x9a,0x67,0x9a,0x68,0x9a,0x68,0x9a,0x69,0x9a,0x69,0x9a,0x6a,0x9a,0x6a,0x9a,0x6b,0x9a,0x6b,0x9a,0x6c,0x9a,0x6c,0x9a,0x6a,0x9a,0x69,0x9a,0x68,0x9a,0x6d,0x9a,0x6d,0x9a,0x6e,0x9a,0x6e,0x9a,0x6d,0x9a,0x67,0xc1,0x5,0x30,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9a,0x6f,0xa,0x9a,0x70,0xe5,0x81,0x30,0xc3,0xc4,0x9a,0x57,0x83,0x73,0x9a,0x71,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0xc,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x85,0x38,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x9a,0x33,0xd3,0xd1,0x1,0xf1,0x2,0x5f,0xc7,0xb,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x5e,0xd3,0xd0,0x9a,0x47,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x27,0xe1,0x2,0xc7,0x28,0xe0,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x13,0xd3,0xc6,0x92,0x65,0xd3,0xc6,0x82,0x56,0xd3,0xc4,0x0,0xd3,0xd3,0xd0,0x9a,0x56,0xd3,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x3,0xc7,0x3,0xc6,0x87,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x82,0x56,0xd3,0xd3,0xcb,0x0,0xd3,0xcb,0x1,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0xd,0xc6,0x22,0x9a,0x73,0x9a,0x73,0xc1,0x5,0x46,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9a,0x74,0xa,0x9a,0x75,0xb0,0xc3,0x8e,0x75,0xc4,0xc4,0x9a,0x76,0xe1,0x1,0xc9,0x2,0x9,0xca,0x0,0xd3,0x0,0xc2,0x1,0xe,0xc0,0xc2,0x1,0xe,0xb4,0xc2,0x1,0xf,0x12,0xc2,0x1,0xf,0x24,0xc2,0x1,0xf,0x2e,0xc2,0x1,0xf,0x6c,0xc2,0x1,0x10,0x1a,0xc2,0x1,0x10,0xc,0xc2,0x1,0xf,0xdc,0xc2,0x1,0xf,0xca,0xc2,0x1,0xf,0x6e,0xc2,0x1,0xf,0x90,0xc2,0x1,0xf,0xa4,0xc2,0x1,0xf,0xe0,0xc2,0x1,0xf,0xfa,0xc2,0x1,0x10,0x1e,0xc2,0x1,0x10,0x3c,0xe1,0x30,0x9a,0x78,0x9a,0x79,0x9a,0x79,0x9a,0x78,0x9a,0x7a,0x9a,0x7b,0x9a,0x7c,0x9a,0x7c,0x9a,0x7b,0x9a,0x7a,0x9a,0x7d,0x9a,0x7d,0x9a,0x7e,0x9a,0x7e,0x9a,0x7f,0x9a,0x7f,0x9b,0x0,0x9b,0x0,0x9b,0x1,0x9b,0x1,0x9b,0x2,0x9b,0x2,0xc0,0xc0,0xc0,0x9b,0x3,0x9b,0x3,0x9b,0x4,0x9b,0x4,0xc0,0xc0,0xc0,0x9b,0x2,0x9b,0x1,0x9b,0x5,0x9b,0x5,0x9b,0x6,0x9b,0x6,0x9b,0x5,0x9b,0x0,0x9a,0x7f,0x9b,0x7,0x9b,0x7,0x9b,0x8,0x9b,0x8,0x9b,0x7,0x9a,0x7e,0x9a,0x7d,0xc1,0x5,0x4a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9b,0x9,0xa,0x9b,0xa,0xe5,0x81,0x21,0xc3,0xc4,0x9a,0x35,0x83,0x73,0x9b,0xb,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8b,0x13,0xd3,0xc6,0x3b,0xc6,0x5e,0xd3,0xd1,0x0,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x3b,0xe1,0x1,0xc9,0x2,0x9,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x5e,0xd3,0xd3,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x4,0xc7,0x3,0xe1,0x2,0xc7,0x19,0xc6,0x87,0x4f,0xc9,0x0,0x2,0xd3,0xe8,0x0,0xc8,0x1,0x0,0xc6,0x6,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x82,0x56,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x9a,0x34,0xc6,0x87,0x56,0xcb,0x0,0xd3,0xd3,0xc9,0x0,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x18,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x94,0x13,0xd3,0xd3,0xd3,0xcb,0x1,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x1,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x10,0xd4,0xc2,0x1,0x11,0x8c,0xc2,0x1,0x11,0x7e,0xc2,0x1,0x11,0x4e,0xc2,0x1,0x11,0x3c,0xc2,0x1,0x10,0xd6,0xc2,0x1,0x10,0xf8,0xc2,0x1,0x11,0xc,0xc2,0x1,0x11,0x2a,0xc2,0x1,0x11,0x52,0xc2,0x1,0x11,0x6c,0xc2,0x1,0x11,0x90,0xc2,0x1,0x11,0xae,0xe1,0x28,0x9b,0xd,0x9b,0xd,0x9b,0xe,0x9b,0xe,0x9b,0xf,0x9b,0xf,0x9b,0x10,0x9b,0x10,0x9b,0x11,0x9b,0x11,0x9b,0x12,0x9b,0x12,0xc0,0xc0,0xc0,0x9b,0x13,0x9b,0x13,0x9b,0x14,0x9b,0x14,0xc0,0xc0,0x9b,0x15,0x9b,0x15,0xc0,0x9b,0x12,0x9b,0x11,0x9b,0x16,0x9b,0x16,0x9b,0x17,0x9b,0x17,0x9b,0x16,0x9b,0x10,0x9b,0xf,0x9b,0x18,0x9b,0x18,0x9b,0x19,0x9b,0x19,0x9b,0x18,0x9b,0xe,0x9b,0xd,0xc1,0x5,0x52,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9b,0x1a,0xa,0x9b,0x1b,0xe5,0x7e,0xc3,0xc4,0xc4,0xc4,0x9b,0x1c,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x4,0xc7,0x3,0xe1,0x2,0xc7,0x19,0xc6,0x87,0x4f,0xc9,0x0,0x2,0xd3,0xe8,0x0,0xc8,0x1,0x0,0xc6,0x6,0xd3,0xe0,0x0,0xc9,0x0,0x1,0xc6,0x82,0x56,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x9a,0x34,0xc6,0x87,0x56,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8b,0x13,0xd3,0xd3,0xd3,0xc9,0x0,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x18,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x94,0x13,0xd3,0xd3,0xd3,0xc9,0x0,0x1,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x1,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0xd3,0x0,0x23,0x90,0xc,0x85,0x38,0x83,0x10,0xc2,0x1,0xd,0x42,0xc2,0x1,0xd,0x4c,0xc2,0x1,0xd,0xa6,0xc2,0x1,0xd,0x9a,0xc2,0x1,0xd,0x8e,0xc2,0x1,0xd,0xa0,0xc2,0x1,0xd,0xfc,0xc2,0x1,0xd,0xf4,0xc2,0x1,0xe,0x12,0xc2,0x1,0xe,0x6,0xc2,0x1,0xe,0x5e,0xc2,0x1,0xe,0x6c,0xc2,0x1,0x10,0x60,0xc2,0x1,0x10,0x6c,0xc2,0x1,0x10,0x66,0xc2,0x1,0x10,0x9c,0xc2,0x1,0x10,0x90,0xc2,0x1,0x10,0x82,0xc2,0x1,0x10,0x76,0xc2,0x1,0x12,0x64,0xc2,0x1,0x12,0x56,0xc2,0x1,0x12,0x26,0xc2,0x1,0x12,0x14,0xc2,0x1,0x11,0xd2,0xc2,0x1,0x11,0xf2,0xc2,0x1,0x12,0x6,0xc2,0x1,0x12,0x2a,0xc2,0x1,0x12,0x44,0xc2,0x1,0x12,0x68,0xc2,0x1,0x12,0x86,0xe1,0x4a,0x9b,0x1f,0x9b,0x20,0x9b,0x20,0x9b,0x1f,0x9b,0x21,0x9b,0x22,0x9b,0x22,0x9b,0x23,0x9b,0x23,0x9b,0x24,0x9b,0x24,0x9b,0x24,0x9b,0x22,0x9b,0x21,0x9b,0x25,0x9b,0x26,0x9b,0x27,0x9b,0x27,0x9b,0x28,0x9b,0x28,0x9b,0x27,0x9b,0x25,0xc0,0x9b,0x29,0x9b,0x2a,0x9b,0x2a,0xc0,0xc0,0x9b,0x2b,0x9b,0x2c,0x9b,0x2d,0x9b,0x2e,0x9b,0x2e,0x9b,0x2f,0x9b,0x30,0x9b,0x31,0x9b,0x31,0x9b,0x30,0x9b,0x2f,0x9b,0x2e,0x9b,0x2c,0xc0,0x9b,0x32,0x9b,0x32,0x9b,0x33,0x9b,0x33,0x9b,0x34,0x9b,0x34,0x9b,0x35,0x9b,0x35,0x9b,0x36,0x9b,0x36,0xc0,0xc0,0xc0,0x9b,0x37,0x9b,0x37,0x9b,0x38,0x9b,0x38,0x9b,0x36,0x9b,0x35,0x9b,0x39,0x9b,0x39,0x9b,0x3a,0x9b,0x3a,0x9b,0x39,0x9b,0x34,0x9b,0x33,0x9b,0x3b,0x9b,0x3b,0x9b,0x3c,0x9b,0x3c,0x9b,0x3b,0x9b,0x32,0xc1,0x5,0x44,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9b,0x3d,0xa,0x9b,0x3e,0xe5,0x81,0x6a,0xc3,0xc4,0x9b,0x1e,0x82,0x5d,0x9b,0x3f,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0xc,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x83,0x24,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x85,0x38,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x8c,0x11,0xd0,0x9a,0x77,0xd3,0xd1,0x1,0xe1,0x3,0xc7,0x11,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x96,0x1f,0xd3,0xc6,0x83,0x10,0xc6,0x17,0xd3,0xd1,0x2,0xf1,0x2,0x5f,0xc7,0xb,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x5e,0xd3,0xd0,0x9b,0xc,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x27,0xe1,0x2,0xc7,0x28,0xe0,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x13,0xd3,0xc6,0x92,0x65,0xd3,0xc6,0x82,0x56,0xd3,0xc4,0x0,0xd3,0xd3,0xd0,0x9b,0x1d,0xd3,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x3,0xc7,0x3,0xe1,0x2,0xc7,0x19,0xc6,0x86,0x79,0xcb,0x2,0xd3,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x82,0x56,0xd3,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x18,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x94,0x13,0xd3,0xd3,0xd3,0xcb,0x1,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0x9,0x5f,0x54,0x61,0x73,0x6b,0x5f,0x6e,0x65,0x77,0x21,0x8f,0x26,0xc2,0x1,0x13,0x4,0xc2,0x1,0x13,0xe,0xc2,0x1,0x13,0x34,0xc2,0x1,0x13,0x50,0xc2,0x1,0x13,0x7e,0xc2,0x1,0x13,0xcc,0x2d,0x9b,0x43,0x9b,0x44,0x9b,0x44,0x9b,0x43,0x9b,0x45,0x9b,0x45,0x9b,0x46,0x9b,0x46,0x9b,0x47,0x9b,0x47,0x9b,0x48,0x9b,0x48,0x9b,0x45,0xc1,0x5,0x5a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9b,0x49,0xa,0x9b,0x4a,0xe5,0x47,0xc3,0xc4,0x9b,0x42,0x83,0x32,0x9b,0x4b,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8f,0x26,0xd3,0xd3,0xd1,0x0,0xe1,0x9,0xc7,0x3,0xc6,0x87,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc4,0x1,0xc6,0x84,0x33,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x9b,0x41,0xcb,0x0,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0xc2,0x1,0x14,0x44,0xc2,0x1,0x14,0x4e,0xc2,0x1,0x14,0x72,0xc2,0x1,0x14,0x8e,0xc2,0x1,0x14,0xbc,0xc2,0x1,0x14,0xfc,0x2d,0x9b,0x4d,0x9b,0x4e,0x9b,0x4e,0x9b,0x4d,0x9b,0x4f,0x9b,0x4f,0x9b,0x50,0x9b,0x50,0x9b,0x51,0x9b,0x51,0x9b,0x52,0x9b,0x52,0x9b,0x4f,0xc1,0x5,0x60,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9b,0x53,0xa,0x9b,0x54,0xe5,0x47,0xc3,0xc4,0x96,0x5f,0x83,0x32,0x9b,0x55,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x96,0x4d,0xd3,0xd3,0xd1,0x0,0xe1,0x9,0xc7,0x3,0xc6,0x87,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc4,0x1,0xc6,0x84,0x33,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x89,0x4c,0xcb,0x0,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0xc2,0x1,0x15,0x70,0xc2,0x1,0x15,0x7a,0xc2,0x1,0x15,0x9e,0xc2,0x1,0x15,0xba,0xc2,0x1,0x15,0xe8,0xc2,0x1,0x16,0x2a,0x2d,0x9b,0x57,0x9b,0x58,0x9b,0x58,0x9b,0x57,0x9b,0x59,0x9b,0x59,0x9b,0x5a,0x9b,0x5a,0x9b,0x5b,0x9b,0x5b,0x9b,0x5c,0x9b,0x5c,0x9b,0x59,0xc1,0x5,0x66,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9b,0x5d,0xa,0x9b,0x5e,0xe5,0x47,0xc3,0xc4,0x96,0x5f,0x83,0x32,0x9b,0x5f,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x96,0x4d,0xd3,0xd3,0xd1,0x0,0xe1,0x9,0xc7,0x3,0xc6,0x87,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc4,0x1,0xc6,0x84,0x33,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x89,0x7a,0xcb,0x0,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0x3,0x6e,0x65,0x67,0xc2,0x1,0x16,0x9e,0xc2,0x1,0x16,0xa8,0xc2,0x1,0x16,0xcc,0xc2,0x1,0x16,0xe8,0xc2,0x1,0x17,0x16,0xc2,0x1,0x17,0x56,0x2d,0x9b,0x62,0x9b,0x63,0x9b,0x63,0x9b,0x62,0x9b,0x64,0x9b,0x64,0x9b,0x65,0x9b,0x65,0x9b,0x66,0x9b,0x66,0x9b,0x67,0x9b,0x67,0x9b,0x64,0xc1,0x5,0x6c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9b,0x68,0xa,0x9b,0x69,0xe5,0x47,0xc3,0xc4,0x96,0x5f,0x83,0x32,0x9b,0x6a,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x96,0x4d,0xd3,0xd3,0xd1,0x0,0xe1,0x9,0xc7,0x3,0xc6,0x87,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc4,0x1,0xc6,0x84,0x33,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x9b,0x61,0xcb,0x0,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0xc2,0x1,0x17,0xce,0xc2,0x1,0x17,0xd8,0xc2,0x1,0x18,0x10,0xc2,0x1,0x18,0x1a,0xc2,0x1,0x18,0x3e,0xc2,0x1,0x18,0x5a,0xc2,0x1,0x18,0x88,0xc2,0x1,0x18,0xa0,0xc2,0x1,0x18,0xaa,0xc2,0x1,0x18,0xe6,0x35,0x9b,0x6c,0x9b,0x6d,0x9b,0x6d,0x9b,0x6c,0x9b,0x6e,0x9b,0x6f,0x9b,0x6f,0x9b,0x6e,0x9b,0x70,0x9b,0x70,0x9b,0x71,0x9b,0x71,0x9b,0x72,0x9b,0x72,0x9b,0x73,0x9b,0x74,0x9b,0x74,0x9b,0x73,0x9b,0x75,0x9b,0x75,0x9b,0x70,0xc1,0x5,0x72,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9b,0x76,0xa,0x9b,0x77,0xe5,0x66,0xc3,0xc4,0x96,0x77,0x83,0x73,0x9b,0x78,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x96,0x75,0xd3,0xd3,0xd1,0x0,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x96,0x4d,0xd3,0xd3,0xd1,0x1,0xe1,0xa,0xc7,0x3,0xc6,0x87,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc4,0x2,0xc6,0x84,0x33,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xe1,0x1,0xc9,0x2,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x3e,0xd3,0xd3,0xcb,0x0,0xcb,0x1,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0xc2,0x1,0x19,0xa0,0xc2,0x1,0x19,0xaa,0xc2,0x1,0x19,0xb4,0xc2,0x1,0x19,0xde,0xc2,0x1,0x19,0xf8,0xc2,0x1,0x1a,0x2,0xc2,0x1,0x1a,0x30,0x2f,0x9b,0x7a,0x9b,0x7a,0x9b,0x7b,0x9b,0x7c,0x9b,0x7c,0x9b,0x7b,0x9b,0x7d,0x9b,0x7d,0x9b,0x7e,0x9b,0x7f,0x9b,0x7f,0x9b,0x7e,0x9c,0x0,0x9c,0x0,0x9b,0x7a,0xc1,0x5,0x7a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x1,0xa,0x9c,0x2,0xe5,0x3e,0xc3,0x97,0x47,0xc4,0xc4,0x9c,0x3,0xe1,0x7,0xc7,0x3,0xe1,0x1,0xc9,0x2,0x9,0xe0,0x0,0xca,0x0,0xc6,0x98,0x7,0xd3,0xd3,0xc6,0x87,0x3e,0xe8,0x0,0xca,0x0,0xc6,0x6,0xd3,0xc4,0x0,0xe1,0x1,0xc9,0x2,0x9,0xe0,0x0,0xca,0x0,0xc6,0x5e,0xd3,0xd3,0xc6,0x85,0x7f,0xe8,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd3,0x0,0xc2,0x1,0x1a,0x68,0xc2,0x1,0x1a,0x56,0xc2,0x1,0x19,0x66,0xc2,0x1,0x19,0x58,0xc2,0x1,0x1a,0x6c,0x2c,0x9c,0x5,0x9c,0x5,0x9c,0x6,0x9c,0x7,0x9c,0x8,0x9c,0x8,0x9c,0x7,0x9c,0x6,0x9c,0x9,0x9c,0x9,0x9c,0x9,0x9c,0x5,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0xa,0xa,0x9c,0x2,0xe5,0x2e,0xc3,0xc4,0xc4,0xc4,0x9c,0xb,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x98,0x6,0xd3,0xc6,0x8c,0x11,0xd0,0x9c,0x4,0xd3,0xc6,0x9a,0xe,0xd3,0xe1,0x1,0xc7,0x3,0xc6,0x86,0xb,0xd3,0xd3,0x0,0xc2,0x1,0x1a,0xf8,0xc2,0x1,0x1b,0x1a,0xc2,0x1,0x1b,0x12,0x28,0x9c,0xd,0x9c,0xd,0x9c,0xe,0x9c,0xe,0x9c,0xf,0x9c,0xf,0x9c,0xe,0x9c,0xd,0xc1,0x5,0x82,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x10,0xa,0x9c,0x11,0xbf,0xc3,0xc4,0xc4,0xc4,0x9c,0x12,0xe1,0x2,0xc7,0x3,0xc6,0x86,0x12,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8b,0x11,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x1b,0x58,0xc2,0x1,0x1b,0x7c,0xc2,0x1,0x1b,0x74,0x28,0x9c,0x14,0x9c,0x14,0x9c,0x15,0x9c,0x15,0x9c,0x16,0x9c,0x16,0x9c,0x15,0x9c,0x14,0xc1,0x5,0x84,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x17,0xa,0x9c,0x18,0xbf,0xc3,0xc4,0xc4,0xc4,0x9c,0x19,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x2b,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8b,0x11,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x1a,0xe8,0x26,0x9c,0x1b,0x9c,0x1b,0xc0,0xc0,0xc0,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x1c,0xa,0x9c,0x11,0xbe,0xc3,0xc4,0xc4,0xc4,0x9c,0x1d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x8b,0xa,0xd3,0xe3,0x0,0xd0,0x9c,0x13,0xd3,0xc0,0xe3,0x0,0xd0,0x9c,0x1a,0xd3,0xd4,0x0,0xc2,0x1,0x1b,0xcc,0xc2,0x1,0x1b,0xec,0xc2,0x1,0x1b,0xe4,0x28,0x9c,0x1f,0x9c,0x1f,0x9c,0x20,0x9c,0x20,0x9c,0x21,0x9c,0x21,0x9c,0x20,0x9c,0x1f,0xc1,0x5,0x86,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x22,0xa,0x9c,0x23,0xbf,0xc3,0xc4,0xc4,0xc4,0x9c,0x24,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x1e,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x11,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x1c,0x70,0xc2,0x1,0x1c,0x94,0xc2,0x1,0x1c,0x8c,0xc2,0x1,0x1c,0xae,0xc2,0x1,0x1c,0xa6,0x2d,0x9c,0x26,0x9c,0x26,0x9c,0x27,0x9c,0x27,0x9c,0x28,0x9c,0x28,0x9c,0x27,0x9c,0x29,0x9c,0x29,0x9c,0x2a,0x9c,0x2a,0x9c,0x29,0x9c,0x26,0xc1,0x5,0x8a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x2b,0xa,0x9c,0x2c,0xe5,0x2f,0xc3,0xc4,0xc4,0xc4,0x9c,0x2d,0xe1,0x3,0xc7,0x3,0xc6,0x86,0x3e,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8d,0x43,0xd3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8b,0x11,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x1c,0xec,0xc2,0x1,0x1d,0xc,0xc2,0x1,0x1d,0x4,0xc2,0x1,0x1d,0x26,0xc2,0x1,0x1d,0x1e,0x2d,0x9c,0x2f,0x9c,0x2f,0x9c,0x30,0x9c,0x30,0x9c,0x31,0x9c,0x31,0x9c,0x30,0x9c,0x32,0x9c,0x32,0x9c,0x33,0x9c,0x33,0x9c,0x32,0x9c,0x2f,0xc1,0x5,0x8c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x34,0xa,0x9c,0x35,0xe5,0x2f,0xc3,0xc4,0xc4,0xc4,0x9c,0x36,0xe1,0x3,0xc7,0x3,0xc6,0x85,0xc,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8d,0x43,0xd3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8b,0x11,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x1c,0x60,0x26,0x9c,0x38,0x9c,0x38,0xc0,0xc0,0xc0,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x39,0xa,0x9c,0x2c,0xbe,0xc3,0xc4,0xc4,0xc4,0x9c,0x3a,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x8b,0xa,0xd3,0xe3,0x0,0xd0,0x9c,0x2e,0xd3,0xc0,0xe3,0x0,0xd0,0x9c,0x37,0xd3,0xd4,0x0,0xc2,0x1,0x1d,0x76,0xc2,0x1,0x1d,0x9c,0xc2,0x1,0x1d,0x94,0xc2,0x1,0x1d,0xb6,0xc2,0x1,0x1d,0xae,0x2d,0x9c,0x3c,0x9c,0x3c,0x9c,0x3d,0x9c,0x3d,0x9c,0x3e,0x9c,0x3e,0x9c,0x3d,0x9c,0x3f,0x9c,0x3f,0x9c,0x40,0x9c,0x40,0x9c,0x3f,0x9c,0x3c,0xc1,0x5,0x8e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x41,0xa,0x9c,0x42,0xe5,0x2f,0xc3,0xc4,0xc4,0xc4,0x9c,0x43,0xe1,0x3,0xc7,0x3,0xc6,0x84,0x7a,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8d,0x43,0xd3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x11,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x1e,0x6,0xc2,0x1,0x1e,0x24,0xc2,0x1,0x1e,0x38,0x27,0x9c,0x45,0x9c,0x45,0x9c,0x46,0x9c,0x46,0x9c,0x47,0x9c,0x47,0x9c,0x45,0xc1,0x5,0x90,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x48,0xa,0x9c,0x49,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x9c,0x4a,0xe1,0x3,0xc7,0x3,0xc6,0x84,0x33,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x6b,0xd3,0xd3,0x0,0xc2,0x1,0x1e,0x8c,0x23,0x9c,0x4c,0x9c,0x4c,0x9c,0x4c,0xc1,0x5,0x92,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x4d,0xa,0x9c,0x4e,0xaf,0xc3,0xc4,0xc4,0xc4,0x9c,0x4f,0xe1,0x1,0xc7,0x3,0xc6,0x85,0x38,0xd3,0x0,0xc2,0x1,0x1e,0xe4,0xc2,0x1,0x1f,0xc,0xc2,0x1,0x1f,0x4,0x28,0x9c,0x51,0x9c,0x51,0x9c,0x52,0x9c,0x52,0x9c,0x53,0x9c,0x53,0x9c,0x52,0x9c,0x51,0xc1,0x5,0x94,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x54,0xa,0x9c,0x55,0xbf,0xc3,0xc4,0xc4,0xc4,0x9c,0x56,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x3f,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8d,0x43,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x1f,0x5c,0x23,0x9c,0x58,0x9c,0x58,0x9c,0x58,0xc1,0x5,0x96,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x59,0xa,0x9c,0x5a,0xaf,0xc3,0xc4,0xc4,0xc4,0x9c,0x5b,0xe1,0x1,0xc7,0x3,0xc6,0x85,0x4c,0xd3,0x0,0xc2,0x1,0x1f,0xb4,0xc2,0x1,0x1f,0xdc,0xc2,0x1,0x1f,0xd4,0x28,0x9c,0x5d,0x9c,0x5d,0x9c,0x5e,0x9c,0x5e,0x9c,0x5f,0x9c,0x5f,0x9c,0x5e,0x9c,0x5d,0xc1,0x5,0x98,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x60,0xa,0x9c,0x61,0xbf,0xc3,0xc4,0xc4,0xc4,0x9c,0x62,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x53,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8d,0x43,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x20,0x8c,0x22,0x9c,0x64,0x9c,0x64,0xc1,0x5,0x9c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x65,0xa,0x9c,0x66,0xb0,0xc3,0x97,0x71,0xc4,0xc4,0x9c,0x67,0xe1,0x1,0xc9,0x2,0x9,0xca,0x0,0xd3,0x0,0x8,0x65,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x21,0x9c,0x69,0xc2,0x1,0x20,0x68,0xc2,0x1,0x20,0x5e,0xc2,0x1,0x21,0x4e,0xc2,0x1,0x21,0x38,0xc2,0x1,0x20,0xb6,0xc2,0x1,0x20,0xd2,0xc2,0x1,0x20,0xee,0xc2,0x1,0x21,0x18,0xc2,0x1,0x21,0x52,0xc2,0x1,0x21,0x70,0x38,0x9c,0x6b,0x9c,0x6c,0x9c,0x6c,0x9c,0x6b,0x9c,0x6d,0x9c,0x6d,0x9c,0x6e,0x9c,0x6e,0x9c,0x6f,0x9c,0x6f,0x9c,0x70,0x9c,0x70,0x9c,0x71,0x9c,0x71,0x9c,0x72,0x9c,0x72,0x9c,0x6f,0x9c,0x6e,0x9c,0x73,0x9c,0x73,0x9c,0x74,0x9c,0x74,0x9c,0x73,0x9c,0x6d,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x75,0xa,0x9c,0x66,0xe5,0x60,0xc3,0xc4,0x9c,0x6a,0x83,0x32,0x9c,0x76,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x84,0x18,0xd3,0xc6,0x8c,0x11,0xd0,0x9c,0x68,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x6,0xc7,0x3,0xc6,0x87,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x82,0x56,0xd3,0xc6,0x84,0x33,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x1d,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x22,0x2c,0xc2,0x1,0x22,0xe,0xc2,0x1,0x22,0x22,0xc2,0x1,0x22,0x38,0xc2,0x1,0x22,0x3c,0x2c,0x9c,0x78,0x9c,0x78,0x9c,0x79,0x9c,0x79,0x9c,0x7a,0x9c,0x7a,0x9c,0x79,0x9c,0x7b,0x9c,0x7c,0x9c,0x7c,0x9c,0x7b,0x9c,0x78,0xc1,0x5,0xa2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9c,0x7d,0xa,0x9c,0x7e,0xe5,0x2f,0xc3,0x83,0x29,0xc4,0xc4,0x9c,0x7f,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x18,0xe0,0x1,0xca,0x0,0xc6,0x84,0xa,0xc4,0x1,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x9,0xe0,0x1,0xca,0x0,0xc6,0x84,0xa,0xc4,0x2,0xd3,0xd3,0xd3,0x0,0x8,0x74,0x6f,0x4f,0x62,0x6a,0x65,0x63,0x74,0x21,0x93,0xc,0xc2,0x1,0x21,0xfa,0xc2,0x1,0x21,0xf0,0xc2,0x1,0x23,0x32,0xc2,0x1,0x23,0x24,0xc2,0x1,0x22,0x60,0xc2,0x1,0x22,0x7c,0xc2,0x1,0x22,0x8c,0xc2,0x1,0x22,0xa4,0xc2,0x1,0x22,0x98,0xc2,0x1,0x22,0xca,0xc2,0x1,0x23,0xe,0xc2,0x1,0x23,0x6,0xc2,0x1,0x23,0x36,0xc2,0x1,0x23,0x54,0xe1,0x22,0x9d,0x3,0x9d,0x4,0x9d,0x4,0x9d,0x3,0x9d,0x5,0x9d,0x5,0x9d,0x6,0x9d,0x6,0x9d,0x7,0x9d,0x7,0x9d,0x8,0x9d,0x8,0x9d,0x9,0x9d,0x9,0x9d,0xa,0x9d,0xa,0x9d,0xb,0x9d,0xb,0x9d,0xa,0x9d,0x9,0x9d,0xc,0x9d,0xc,0x9d,0xd,0x9d,0xe,0x9d,0xe,0x9d,0xd,0x9d,0x7,0x9d,0x6,0x9d,0xf,0x9d,0xf,0x9d,0x10,0x9d,0x10,0x9d,0xf,0x9d,0x5,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9d,0x11,0xa,0x9c,0x7e,0xe5,0x81,0x0,0xc3,0xc4,0x9d,0x2,0x83,0x32,0x9d,0x12,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0xc,0xd3,0xc6,0x8c,0x11,0xd0,0x9d,0x0,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x8,0xc7,0x3,0xc6,0x87,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xe1,0x2,0xc7,0x9,0xc4,0x1,0xe1,0x2,0xc7,0x14,0xe0,0x0,0xcb,0x0,0xc6,0x82,0x56,0xd3,0xc4,0x2,0xd3,0xd3,0xc6,0x84,0x33,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x23,0xc6,0x84,0x18,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8c,0x11,0xd3,0xc6,0x9d,0x1,0xd3,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x24,0xa,0xc2,0x1,0x23,0xec,0xc2,0x1,0x24,0x0,0xc2,0x1,0x24,0x16,0xc2,0x1,0x24,0x1a,0x2c,0x9d,0x14,0x9d,0x14,0x9d,0x15,0x9d,0x15,0x9d,0x16,0x9d,0x16,0x9d,0x15,0x9d,0x17,0x9d,0x18,0x9d,0x18,0x9d,0x17,0x9d,0x14,0xc1,0x5,0xa8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9d,0x19,0xa,0x9d,0x1a,0xe5,0x2f,0xc3,0x83,0x29,0xc4,0xc4,0x9d,0x1b,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x18,0xe0,0x1,0xca,0x0,0xc6,0x84,0xa,0xc4,0x1,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x9,0xe0,0x1,0xca,0x0,0xc6,0x84,0xa,0xc4,0x2,0xd3,0xd3,0xd3,0x0,0x5,0x5f,0x5f,0x6d,0x61,0x70,0xc2,0x1,0x23,0xd8,0xc2,0x1,0x23,0xce,0xc2,0x1,0x25,0xa,0xc2,0x1,0x24,0xfc,0xc2,0x1,0x24,0x3e,0xc2,0x1,0x24,0x5a,0xc2,0x1,0x24,0x6a,0xc2,0x1,0x24,0x82,0xc2,0x1,0x24,0x76,0xc2,0x1,0x24,0xa8,0xc2,0x1,0x24,0xe6,0xc2,0x1,0x24,0xde,0xc2,0x1,0x25,0xe,0xc2,0x1,0x25,0x2c,0xe1,0x22,0x9d,0x1e,0x9d,0x1f,0x9d,0x1f,0x9d,0x1e,0x9d,0x20,0x9d,0x20,0x9d,0x21,0x9d,0x21,0x9d,0x22,0x9d,0x22,0x9d,0x23,0x9d,0x23,0x9d,0x24,0x9d,0x24,0x9d,0x25,0x9d,0x25,0x9d,0x26,0x9d,0x26,0x9d,0x25,0x9d,0x24,0x9d,0x27,0x9d,0x27,0x9d,0x28,0x9d,0x29,0x9d,0x29,0x9d,0x28,0x9d,0x22,0x9d,0x21,0x9d,0x2a,0x9d,0x2a,0x9d,0x2b,0x9d,0x2b,0x9d,0x2a,0x9d,0x20,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9d,0x2c,0xa,0x9d,0x1a,0xe5,0x81,0x1,0xc3,0xc4,0x9d,0x2,0x83,0x32,0x9d,0x2d,0xf0,0x1,0x83,0x24,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0xc,0xd3,0xc6,0x8c,0x11,0xd0,0x9d,0x1c,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x8,0xc7,0x3,0xc6,0x87,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xe1,0x2,0xc7,0x9,0xc4,0x1,0xe1,0x2,0xc7,0x14,0xe0,0x0,0xcb,0x0,0xc6,0x82,0x56,0xd3,0xc4,0x2,0xd3,0xd3,0xc6,0x84,0x33,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x9d,0x1d,0xc6,0x84,0x18,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8c,0x11,0xd3,0xc6,0x9d,0x1,0xd3,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0x0,0x6,0x5f,0x62,0x6c,0x65,0x73,0x73,0xc2,0x1,0x25,0x94,0xc2,0x1,0x25,0xb0,0xc2,0x1,0x25,0xde,0xc2,0x1,0x26,0x6,0xc2,0x1,0x26,0x10,0xc2,0x1,0x26,0x2e,0xc2,0x1,0x26,0x38,0xc2,0x1,0x26,0x66,0x31,0x9d,0x30,0x9d,0x30,0x9d,0x31,0x9d,0x31,0x9d,0x32,0x9d,0x32,0x9d,0x33,0x9d,0x34,0x9d,0x34,0x9d,0x33,0x9d,0x35,0x9d,0x36,0x9d,0x36,0x9d,0x35,0x9d,0x37,0x9d,0x37,0x9d,0x30,0xc1,0x5,0xae,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9d,0x38,0xa,0x9d,0x39,0xe5,0x50,0xc3,0xc4,0xc4,0xc4,0x9d,0x3a,0xe1,0xa,0xc7,0x3,0xc6,0x87,0x1c,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc4,0x2,0xc6,0x84,0x33,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xc6,0x9d,0x2f,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x92,0x5a,0xd3,0xd3,0xe1,0x1,0xc9,0x1,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x43,0xd3,0xd3,0xc6,0x85,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0xc2,0x1,0x27,0x46,0x22,0x9d,0x3c,0x9d,0x3c,0xc1,0x5,0xb6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9d,0x3d,0xa,0x9d,0x3e,0xb0,0xc3,0xc4,0xc4,0xc4,0x9d,0x3f,0xe8,0x0,0xc8,0x1,0x0,0xc6,0x8b,0x9,0xd3,0x0,0x2,0x2c,0x20,0xc2,0x1,0x27,0x62,0xc2,0x1,0x27,0x5a,0x23,0x9d,0x42,0x9d,0x43,0x9d,0x42,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9d,0x44,0xa,0x9d,0x3e,0xaf,0xc3,0xc4,0xc4,0xc4,0x9d,0x45,0xe1,0x1,0xc7,0x1a,0xc8,0x1,0x0,0xd3,0x0,0xc2,0x1,0x26,0xae,0xc2,0x1,0x26,0xa4,0xc2,0x1,0x26,0xe2,0xc2,0x1,0x26,0xd8,0xc2,0x1,0x26,0xec,0xc2,0x1,0x26,0xe4,0xc2,0x1,0x27,0x1c,0xc2,0x1,0x27,0x12,0x33,0x9d,0x47,0x9d,0x48,0x9d,0x47,0x9d,0x49,0x9d,0x4a,0x9d,0x4b,0x9d,0x4c,0x9d,0x4b,0x9d,0x49,0x9d,0x4d,0x9d,0x4e,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x9d,0x4d,0xc1,0x5,0xb2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9d,0x4f,0xa,0x9d,0x50,0xe5,0x38,0xc3,0xc4,0xc4,0xc4,0x9d,0x51,0xe1,0x1,0xc7,0x23,0xc6,0x98,0x21,0xd3,0xe1,0x1,0xc7,0x23,0xe1,0x1,0xc7,0x1a,0xc8,0x0,0x0,0xd3,0xd3,0xe1,0x1,0xc7,0x18,0xe1,0x4,0xc7,0x19,0xc6,0x98,0x22,0xe1,0x0,0xd0,0x9d,0x40,0xd3,0xc6,0x9d,0x41,0xe1,0x0,0xd0,0x9d,0x46,0xd3,0xd3,0xd3,0x0,0x4,0x65,0x6d,0x69,0x74,0xc1,0xfc,0x5e,0xc1,0xfc,0xb4,0xc1,0xfd,0x8,0xc1,0xfd,0x5e,0xc1,0xfd,0xb8,0xc1,0xfd,0xa8,0xc1,0xff,0x62,0xc1,0xff,0x56,0xc1,0xff,0xd4,0xc1,0xff,0xc8,0xc2,0x1,0x0,0x46,0xc2,0x1,0x0,0x3a,0xc2,0x1,0x0,0xc0,0xc2,0x1,0x0,0xb4,0xc2,0x1,0x1,0x36,0xc2,0x1,0x1,0x2a,0xc2,0x1,0x1,0xda,0xc2,0x1,0x1,0xce,0xc2,0x1,0x3,0xc2,0xc2,0x1,0x3,0xb6,0xc2,0x1,0x7,0x1a,0xc2,0x1,0x7,0xe,0xc2,0x1,0x8,0x2,0xc2,0x1,0x7,0xf6,0xc2,0x1,0xc,0xd0,0xc2,0x1,0xc,0xb8,0xc2,0x1,0xc,0xac,0xc2,0x1,0xc,0xea,0xc2,0x1,0xc,0xde,0xc2,0x1,0x12,0xba,0xc2,0x1,0x12,0xae,0xc2,0x1,0x14,0x0,0xc2,0x1,0x13,0xf4,0xc2,0x1,0x15,0x30,0xc2,0x1,0x15,0x24,0xc2,0x1,0x16,0x5e,0xc2,0x1,0x16,0x52,0xc2,0x1,0x17,0x8a,0xc2,0x1,0x17,0x7e,0xc2,0x1,0x19,0x1a,0xc2,0x1,0x19,0xe,0xc2,0x1,0x1a,0xa6,0xc2,0x1,0x1a,0x9a,0xc2,0x1,0x1b,0xae,0xc2,0x1,0x1b,0xa2,0xc2,0x1,0x1c,0x1e,0xc2,0x1,0x1c,0x12,0xc2,0x1,0x1d,0x58,0xc2,0x1,0x1d,0x4c,0xc2,0x1,0x1d,0xe8,0xc2,0x1,0x1d,0xdc,0xc2,0x1,0x1e,0x6e,0xc2,0x1,0x1e,0x62,0xc2,0x1,0x1e,0xc6,0xc2,0x1,0x1e,0xba,0xc2,0x1,0x1f,0x3e,0xc2,0x1,0x1f,0x32,0xc2,0x1,0x1f,0x96,0xc2,0x1,0x1f,0x8a,0xc2,0x1,0x20,0xe,0xc2,0x1,0x20,0x2,0xc2,0x1,0x21,0xa4,0xc2,0x1,0x21,0x98,0xc2,0x1,0x23,0x88,0xc2,0x1,0x23,0x7c,0xc2,0x1,0x25,0x60,0xc2,0x1,0x25,0x54,0xe1,0x81,0x6e,0x9d,0x54,0x9d,0x54,0x9d,0x54,0xc0,0xc0,0x9d,0x55,0x9d,0x55,0x9d,0x55,0xc0,0xc0,0x9d,0x56,0x9d,0x56,0x9d,0x56,0xc0,0xc0,0x9d,0x57,0x9d,0x57,0x9d,0x57,0xc0,0xc0,0x9d,0x58,0x9d,0x59,0x9d,0x58,0xc0,0xc0,0x9d,0x5a,0x9d,0x5a,0x9d,0x5b,0x9d,0x5b,0x9d,0x5a,0xc0,0xc0,0x9d,0x5c,0x9d,0x5c,0x9d,0x5d,0x9d,0x5d,0x9d,0x5c,0xc0,0xc0,0x9d,0x5e,0x9d,0x5e,0x9d,0x5f,0x9d,0x5f,0x9d,0x5e,0xc0,0xc0,0x9d,0x60,0x9d,0x60,0x9d,0x61,0x9d,0x61,0x9d,0x60,0xc0,0xc0,0x9d,0x62,0x9d,0x62,0x9d,0x63,0x9d,0x63,0x9d,0x62,0xc0,0xc0,0x9d,0x64,0x9d,0x64,0x9d,0x65,0x9d,0x65,0x9d,0x64,0xc0,0xc0,0x9d,0x66,0x9d,0x66,0x9d,0x67,0x9d,0x67,0x9d,0x66,0xc0,0xc0,0x9d,0x68,0x9d,0x68,0x9d,0x69,0x9d,0x69,0x9d,0x68,0xc0,0xc0,0x9d,0x6a,0x9d,0x6a,0x9d,0x6b,0x9d,0x6b,0x9d,0x6a,0xc0,0xc0,0x9d,0x6c,0x9d,0x6c,0x9d,0x6d,0x9d,0x6d,0x9d,0x6e,0x9d,0x6e,0x9d,0x6d,0x9d,0x6f,0x9d,0x6f,0x9d,0x70,0x9d,0x70,0x9d,0x6f,0x9d,0x6c,0xc0,0xc0,0x9d,0x71,0x9d,0x71,0x9d,0x72,0x9d,0x72,0x9d,0x71,0xc0,0xc0,0x9d,0x73,0x9d,0x73,0x9d,0x74,0x9d,0x74,0x9d,0x73,0xc0,0xc0,0x9d,0x75,0x9d,0x75,0x9d,0x76,0x9d,0x76,0x9d,0x75,0xc0,0xc0,0x9d,0x77,0x9d,0x77,0x9d,0x78,0x9d,0x78,0x9d,0x77,0xc0,0xc0,0x9d,0x79,0x9d,0x79,0x9d,0x7a,0x9d,0x7a,0x9d,0x79,0xc0,0xc0,0x9d,0x7b,0x9d,0x7b,0x9d,0x7c,0x9d,0x7c,0x9d,0x7b,0xc0,0xc0,0x9d,0x7d,0x9d,0x7d,0x9d,0x7e,0x9d,0x7e,0x9d,0x7d,0xc0,0xc0,0x9d,0x7f,0x9d,0x7f,0x9e,0x0,0x9e,0x0,0x9d,0x7f,0xc0,0xc0,0x9e,0x1,0x9e,0x1,0x9e,0x2,0x9e,0x2,0x9e,0x1,0xc0,0xc0,0x9e,0x3,0x9e,0x3,0x9e,0x4,0x9e,0x4,0x9e,0x3,0xc0,0xc0,0x9e,0x5,0x9e,0x5,0x9e,0x6,0x9e,0x6,0x9e,0x5,0xc0,0xc0,0x9e,0x7,0x9e,0x7,0x9e,0x8,0x9e,0x8,0x9e,0x7,0xc0,0xc0,0x9e,0x9,0x9e,0x9,0x9e,0xa,0x9e,0xa,0x9e,0x9,0xc0,0xc0,0x9e,0xb,0x9e,0xb,0x9e,0xc,0x9e,0xc,0x9e,0xb,0xc0,0xc0,0x9e,0xd,0x9e,0xd,0x9e,0xe,0x9e,0xe,0x9e,0xd,0xc0,0xc0,0x9e,0xf,0x9e,0xf,0x9e,0x10,0x9e,0x10,0x9e,0xf,0xc0,0xc0,0x9e,0x11,0x9e,0x11,0x9e,0x12,0x9e,0x12,0x9e,0x11,0xc0,0xc0,0x9e,0x13,0x9e,0x13,0x9e,0x14,0x9e,0x14,0x9e,0x13,0xc0,0xc0,0x9e,0x15,0x9e,0x15,0x9e,0x16,0x9e,0x16,0x9e,0x15,0xc0,0xc0,0xc0,0xc0,0xc1,0x4,0xf4,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x17,0xa,0x9e,0x18,0xe5,0x85,0x70,0x9d,0x53,0x97,0x47,0xc4,0xc4,0x9e,0x19,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x98,0x78,0xd3,0xe3,0x0,0xd0,0x98,0x7d,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x84,0x5f,0xd3,0xe3,0x0,0xd0,0x99,0x2,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x81,0x24,0xd3,0xe3,0x0,0xd0,0x99,0x7,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x84,0x53,0xd3,0xe3,0x0,0xd0,0x99,0xc,0xd3,0xe1,0x1,0xc7,0x24,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x99,0x2a,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x5a,0xd3,0xe3,0x0,0xd0,0x99,0x30,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x84,0x18,0xd3,0xe3,0x0,0xd0,0x99,0x36,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0x2e,0xd3,0xe3,0x0,0xd0,0x99,0x3c,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x84,0x17,0xd3,0xe3,0x0,0xd0,0x99,0x42,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x7a,0xd3,0xe3,0x0,0xd0,0x99,0x4d,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x93,0x55,0xd3,0xe3,0x0,0xd0,0x99,0x6c,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x94,0x32,0xd3,0xe3,0x0,0xd0,0x9a,0x26,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0x55,0xd3,0xe3,0x0,0xd0,0x9a,0x2e,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x90,0xe,0xd3,0xe3,0x0,0xd0,0x9a,0x72,0xd3,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x94,0x13,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x96,0x1f,0xd3,0xd3,0xe3,0x0,0xd0,0x9b,0x40,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x96,0x47,0xd3,0xe3,0x0,0xd0,0x9b,0x4c,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x89,0x4c,0xd3,0xe3,0x0,0xd0,0x9b,0x56,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x89,0x79,0xd3,0xe3,0x0,0xd0,0x9b,0x60,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x8a,0x2b,0xd3,0xe3,0x0,0xd0,0x9b,0x6b,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x88,0x3e,0xd3,0xe3,0x0,0xd0,0x9b,0x79,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x98,0x6,0xd3,0xe3,0x0,0xd0,0x9c,0xc,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0x2b,0xd3,0xe3,0x0,0xd0,0x9c,0x1e,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0x1e,0xd3,0xe3,0x0,0xd0,0x9c,0x25,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0xc,0xd3,0xe3,0x0,0xd0,0x9c,0x3b,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x84,0x7a,0xd3,0xe3,0x0,0xd0,0x9c,0x44,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x84,0x33,0xd3,0xe3,0x0,0xd0,0x9c,0x4b,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0x38,0xd3,0xe3,0x0,0xd0,0x9c,0x50,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0x3f,0xd3,0xe3,0x0,0xd0,0x9c,0x57,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0x4c,0xd3,0xe3,0x0,0xd0,0x9c,0x5c,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x85,0x53,0xd3,0xe3,0x0,0xd0,0x9c,0x63,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x93,0x11,0xd3,0xe3,0x0,0xd0,0x9c,0x77,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x93,0xe,0xd3,0xe3,0x0,0xd0,0x9d,0x13,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x8c,0x11,0xd3,0xe3,0x0,0xd0,0x9d,0x2e,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x9,0xd3,0xc6,0x8b,0x43,0xd3,0xe3,0x0,0xd0,0x9d,0x3b,0xd3,0xc0,0xe3,0x0,0xd0,0x9d,0x52,0xd3,0xd4,0x0,0xc2,0x1,0x27,0xf6,0x22,0x9e,0x1b,0x9e,0x1b,0xc1,0x5,0xbc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x1c,0xa,0x9e,0x1d,0xb0,0xc3,0x97,0x47,0xc4,0xc4,0x9e,0x1e,0xe1,0x1,0xc9,0x1,0x9,0xca,0x0,0xd3,0x0,0x66,0x89,0x13,0xc0,0x84,0x9,0xc0,0x6,0xc0,0x88,0x6d,0xc0,0x85,0x38,0xc0,0x88,0x6b,0xc0,0x7,0x65,0x6d,0x69,0x74,0x74,0x6f,0x70,0x21,0x8b,0x14,0x22,0x9e,0x22,0x8b,0x30,0x21,0x84,0x9,0xc2,0x1,0x28,0x4,0xc2,0x1,0x27,0xd4,0xc2,0x1,0x27,0xca,0xc2,0x1,0x28,0x62,0xc2,0x1,0x28,0x52,0xc2,0x1,0x28,0x46,0xc2,0x1,0x28,0x82,0xc2,0x1,0x28,0xa0,0xc2,0x1,0x28,0xb8,0xc2,0x1,0x28,0xd2,0x39,0x9e,0x25,0x9e,0x26,0x9e,0x27,0x9e,0x27,0x9e,0x26,0x9e,0x25,0xc0,0xc0,0x9e,0x28,0x9e,0x28,0x9e,0x29,0x9e,0x29,0x9e,0x2a,0x9e,0x2a,0x9e,0x29,0x9e,0x28,0x9e,0x2b,0x9e,0x2b,0x9e,0x2c,0x9e,0x2c,0x9e,0x2d,0x9e,0x2d,0x9e,0x2e,0x9e,0x2e,0xc0,0xc1,0x5,0xba,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x2f,0xa,0x9e,0x30,0xe5,0x76,0x9e,0x21,0x9e,0x23,0x9e,0x24,0x83,0x32,0x9e,0x31,0xe0,0x0,0xf0,0x1,0x83,0x24,0xe0,0x0,0xca,0x0,0xc6,0x8f,0x26,0xd3,0xc6,0x8c,0x11,0xd0,0x9e,0x1f,0xd3,0xc6,0x9a,0xe,0xd3,0xd1,0x0,0xe1,0xd,0xc7,0x4,0xc6,0x9e,0x20,0xc6,0x84,0x9,0xcb,0x0,0xc6,0x88,0x6b,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xca,0x0,0xc6,0x88,0x6b,0xd3,0xca,0x1,0xd3,0xc6,0x17,0xd3,0xc6,0x88,0x6d,0xe0,0x0,0xca,0x0,0xc6,0x88,0x6d,0xd3,0xc6,0x85,0x38,0xe0,0x0,0xca,0x0,0xc6,0x85,0x38,0xd3,0xc6,0x6,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xc6,0x89,0x13,0xe8,0x0,0xca,0x0,0xc6,0x89,0x13,0xd3,0xd3,0x0,0xc1,0x5,0xc4,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x9e,0x33,0xaa,0xc3,0xc4,0xc4,0xc4,0x9e,0x34,0xc8,0x0,0x1,0x0,0x5,0x70,0x61,0x72,0x73,0x65,0xc2,0x1,0x29,0xa2,0xc2,0x1,0x29,0x98,0x23,0x9e,0x37,0x9e,0x38,0x9e,0x37,0xc1,0x5,0xc6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x39,0xa,0x9e,0x3a,0xaf,0xc3,0xc4,0xc4,0xc4,0x9e,0x3b,0xe1,0x1,0xc7,0x29,0xc8,0x0,0x0,0xd3,0x0,0xc2,0x1,0x2b,0x2a,0x22,0x9e,0x3d,0x9e,0x3d,0xc1,0x5,0xcc,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x3e,0xa,0x9e,0x3f,0xb0,0xc3,0xc4,0xc4,0xc4,0x9e,0x40,0xe1,0x1,0xc9,0x2,0x3,0xc8,0x0,0x1,0xd3,0x0,0x22,0x9e,0x22,0x8e,0x52,0xc2,0x1,0x2b,0x4,0xc2,0x1,0x2b,0xe,0x25,0xc0,0x9e,0x43,0x9e,0x44,0x9e,0x44,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x45,0xa,0x9e,0x3f,0xb9,0xc3,0x9e,0x42,0xc4,0xc4,0x9e,0x46,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x4,0xd3,0xd0,0x9e,0x41,0xd3,0x0,0xc2,0x1,0x2b,0x9a,0x22,0x9e,0x48,0x9e,0x48,0xc1,0x5,0xce,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x49,0xa,0x9e,0x4a,0xb0,0xc3,0xc4,0xc4,0xc4,0x9e,0x4b,0xe1,0x1,0xc9,0x2,0x3,0xc8,0x0,0x1,0xd3,0x0,0xc2,0x1,0x2b,0x74,0xc2,0x1,0x2b,0x7e,0x25,0xc0,0x9e,0x4d,0x9e,0x4e,0x9e,0x4e,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x4f,0xa,0x9e,0x4a,0xb9,0xc3,0x9e,0x42,0xc4,0xc4,0x9e,0x50,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x4,0xd3,0xd0,0x9e,0x4c,0xd3,0x0,0xc2,0x1,0x2c,0xa,0x22,0x9e,0x52,0x9e,0x52,0xc1,0x5,0xd0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x53,0xa,0x9e,0x54,0xb0,0xc3,0xc4,0xc4,0xc4,0x9e,0x55,0xe1,0x1,0xc9,0x2,0x3,0xc8,0x0,0x1,0xd3,0x0,0xc2,0x1,0x2b,0xe4,0xc2,0x1,0x2b,0xee,0x25,0xc0,0x9e,0x57,0x9e,0x58,0x9e,0x58,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x59,0xa,0x9e,0x54,0xb9,0xc3,0x9e,0x42,0xc4,0xc4,0x9e,0x5a,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x4,0xd3,0xd0,0x9e,0x56,0xd3,0x0,0xc2,0x1,0x2d,0x20,0xc2,0x1,0x2d,0x3a,0xc2,0x1,0x2d,0x40,0xc2,0x1,0x2d,0x5a,0x28,0x9e,0x5c,0x9e,0x5d,0x9e,0x5e,0x9e,0x5e,0x9e,0x5f,0x9e,0x5f,0x9e,0x5d,0x9e,0x5c,0xc1,0x5,0xd6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x60,0xa,0x9e,0x61,0xe5,0x29,0xc3,0x9e,0x42,0xc4,0xc4,0x9e,0x62,0xe0,0x2,0xc9,0x1,0x1,0xc6,0x88,0x7d,0xca,0x1,0xe1,0x2,0xc9,0x1,0xa,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x2e,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x88,0x6b,0xd3,0xd3,0xd3,0x0,0x6,0x3c,0x6d,0x61,0x69,0x6e,0x3e,0x9,0x70,0x61,0x72,0x73,0x65,0x65,0x6d,0x69,0x74,0x21,0x5,0x3,0x61,0x73,0x74,0x21,0x9e,0x67,0x23,0x9e,0x66,0x9e,0x68,0x8f,0x76,0x4,0x6d,0x61,0x69,0x6e,0x23,0x9e,0x67,0x9e,0x67,0x9e,0x6a,0xc2,0x1,0x29,0xd8,0xc2,0x1,0x29,0xe4,0xc2,0x1,0x2a,0xe4,0xc2,0x1,0x2b,0x54,0xc2,0x1,0x2b,0xc4,0xc2,0x1,0x2c,0xee,0xc2,0x1,0x2d,0x94,0xc2,0x1,0x2d,0xd0,0x35,0xc0,0xc0,0xc0,0xc0,0x9e,0x6c,0x9e,0x6d,0x9e,0x6d,0x9e,0x6c,0x9e,0x6e,0x9e,0x6e,0x9e,0x6f,0x9e,0x6f,0x9e,0x70,0x9e,0x70,0x9e,0x71,0x9e,0x71,0x9e,0x72,0x9e,0x72,0x9e,0x73,0x9e,0x73,0x9e,0x73,0xc1,0x5,0xc2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x74,0xa,0x9e,0x75,0xe5,0x81,0x1,0x9e,0x65,0x9e,0x69,0x9e,0x6b,0x82,0x5d,0x9e,0x76,0xca,0x1,0xe3,0x0,0xd0,0x9e,0x35,0xd3,0xc0,0xe3,0x0,0xd0,0x9e,0x3c,0xd3,0xd4,0xd1,0x0,0xe1,0x3,0xc9,0x0,0x7,0xe1,0x1,0xc9,0x0,0x5,0xc2,0xd3,0xcb,0x0,0xca,0x2,0xd3,0xd1,0x1,0xf0,0x1,0x83,0x24,0xc9,0x0,0x1,0xc6,0x83,0x25,0xd0,0x9e,0x47,0xd3,0xf0,0x1,0x83,0x24,0xc9,0x0,0x1,0xc6,0x83,0x25,0xd0,0x9e,0x51,0xd3,0xf0,0x1,0x83,0x24,0xc9,0x0,0x1,0xc6,0x83,0x25,0xd0,0x9e,0x5b,0xd3,0xf0,0x1,0x83,0x24,0xc9,0x0,0x1,0xc6,0x83,0x25,0xd0,0x9e,0x63,0xd3,0xe1,0x2,0xc9,0x0,0xa,0xcb,0x1,0xc6,0x9e,0x64,0xd3,0xd1,0x2,0xe1,0x3,0xc7,0x1,0xc4,0x0,0xcb,0x2,0xc9,0x0,0x1,0xd3,0x0,0x4,0x66,0x69,0x6e,0x64,0xc2,0x1,0x2f,0xb4,0xc2,0x1,0x2f,0xc6,0xc2,0x1,0x2f,0xf4,0x2a,0x9e,0x79,0x9e,0x7a,0x9e,0x7a,0x9e,0x79,0x9e,0x7b,0x9e,0x7b,0x9e,0x7b,0x9e,0x7b,0x9e,0x7b,0x9e,0x7b,0xc1,0x5,0xea,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9e,0x7c,0xa,0x9e,0x7d,0xe5,0x28,0xc3,0xc4,0xc4,0xc4,0x9e,0x7e,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x3b,0xe0,0x0,0xc8,0x2,0x0,0xc6,0x82,0x56,0xd3,0xd3,0xe1,0x1,0xc7,0x17,0xe1,0x3,0xc7,0x3,0xc4,0x0,0xc4,0x1,0xc4,0x2,0xd3,0xd3,0x0,0xc2,0x1,0x30,0x32,0x22,0x9f,0x0,0x9f,0x0,0xc1,0x5,0xf0,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x1,0xa,0x9f,0x2,0xb2,0xc3,0xc4,0xc4,0xc4,0x9f,0x3,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x3b,0xc9,0x1,0x0,0xd3,0x0,0xc2,0x1,0x2f,0x30,0xc2,0x1,0x2f,0x50,0xc2,0x1,0x2f,0x72,0xc2,0x1,0x2f,0x78,0xc2,0x1,0x30,0x18,0x31,0x9f,0x5,0xc0,0xc0,0xc0,0x9f,0x6,0x9f,0x6,0x9f,0x6,0x9f,0x5,0xc0,0x9f,0x7,0x9f,0x8,0x9f,0x8,0x9f,0x8,0xc0,0xc0,0x9f,0x9,0xc0,0xc1,0x5,0xe6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0xa,0xa,0x9f,0xb,0xe5,0x41,0xc3,0xc4,0xc4,0xc4,0x9f,0xc,0xe0,0x2,0xc8,0x1,0x0,0xc6,0x9e,0x78,0xe1,0x1,0xc7,0x2a,0xc4,0xa,0xd3,0xe1,0x2,0xc7,0x9,0xc9,0x0,0x0,0xc4,0x1,0xd3,0xd3,0xd9,0x0,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x1e,0xc9,0x0,0x0,0xd3,0xd0,0x9e,0x7f,0xd3,0xf1,0x2,0x5f,0xc7,0xb,0xc9,0x0,0x0,0xd0,0x9f,0x4,0xd3,0x0,0x5,0x6c,0x69,0x6e,0x65,0x73,0x22,0x8f,0x14,0x9f,0xe,0x22,0xc2,0xc1,0xc2,0x1,0x2e,0xde,0xc2,0x1,0x2e,0xd4,0xc2,0x1,0x2e,0xf8,0xc2,0x1,0x30,0x60,0x28,0x9f,0x11,0x9f,0x12,0x9f,0x11,0x9f,0x13,0x9f,0x13,0x9f,0x13,0x9f,0x14,0x9f,0x14,0xc1,0x5,0xe2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x15,0xa,0x9f,0x16,0xe5,0x29,0xc3,0xc4,0x9f,0xf,0x9f,0x10,0x9f,0x17,0xc4,0x0,0xd6,0x0,0xe0,0x0,0xc7,0x15,0xc6,0x83,0x23,0xd3,0xd1,0x1,0xf1,0x1,0x83,0x24,0xc7,0x16,0xd0,0x9f,0xd,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x89,0x1,0xd3,0x0,0x5,0x77,0x68,0x69,0x6c,0x65,0xc2,0x1,0x31,0xf0,0x23,0x9f,0x1a,0x9f,0x1a,0x9f,0x1a,0xc1,0x6,0x2,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x1b,0xa,0x9f,0x1c,0xb4,0xc3,0xc4,0xc4,0xc4,0x9f,0x1d,0xe1,0x2,0xc7,0x9,0xc9,0x0,0x0,0xc4,0x1,0xd3,0xd9,0x1,0x0,0x0,0xc1,0x6,0x4,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0x9f,0x1f,0xad,0xc3,0xc4,0xc4,0xc4,0x9f,0x20,0xc9,0x0,0x0,0xd9,0x1,0x1,0x0,0x3,0x6d,0x69,0x64,0x21,0x9f,0x22,0xc2,0x1,0x31,0x8c,0xc2,0x1,0x31,0x7c,0xc2,0x1,0x31,0xc8,0xc2,0x1,0x31,0xbc,0x2f,0x9f,0x24,0x9f,0x24,0x9f,0x25,0x9f,0x25,0x9f,0x25,0x9f,0x24,0x9f,0x26,0x9f,0x26,0x9f,0x27,0x9f,0x27,0x9f,0x26,0xc0,0xc0,0xc0,0xc0,0xc1,0x5,0xfe,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x28,0xa,0x9f,0x29,0xe5,0x3e,0xc3,0xc4,0x9f,0x23,0x83,0x32,0x9f,0x2a,0xe1,0x2,0xc7,0x2c,0xe1,0x2,0xc7,0x9,0xc9,0x0,0x0,0xc9,0x0,0x1,0xd3,0xc4,0x2,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0xc,0xe0,0x1,0xc9,0x1,0xc,0xc6,0x84,0xa,0xcb,0x0,0xd3,0xc8,0x0,0x0,0xd3,0xe3,0x0,0xd0,0x9f,0x1e,0xd3,0xc0,0xe3,0x0,0xd0,0x9f,0x21,0xd3,0xd4,0x0,0xb,0x6c,0x69,0x6e,0x65,0x46,0x72,0x6f,0x6d,0x50,0x6f,0x73,0x21,0x8b,0x31,0x4,0x24,0x6d,0x69,0x6e,0x4,0x24,0x6d,0x61,0x78,0x22,0x9f,0x2e,0x9f,0x2f,0x22,0xc2,0xc2,0xc2,0x1,0x31,0xa,0xc2,0x1,0x31,0x30,0xc2,0x1,0x31,0x26,0xc2,0x1,0x31,0x3c,0xc2,0x1,0x32,0x6e,0xc2,0x1,0x32,0x84,0x2e,0x9f,0x32,0x9f,0x32,0x9f,0x33,0x9f,0x34,0x9f,0x35,0x9f,0x35,0x9f,0x35,0x9f,0x33,0x9f,0x36,0x9f,0x36,0x9f,0x37,0x9f,0x37,0x9f,0x37,0x9f,0x36,0xc1,0x5,0xf8,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x38,0xa,0x9f,0x39,0xe5,0x3e,0x9f,0x2c,0x9f,0x2d,0x9f,0x30,0x9f,0x31,0x9f,0x3a,0xc4,0x1,0xd6,0x0,0xe0,0x0,0xc9,0x0,0xc,0xc6,0x82,0x56,0xd3,0xd6,0x1,0xf1,0x2,0x5f,0xc7,0x2b,0xe1,0x2,0xc7,0xc,0xcb,0x0,0xcb,0x1,0xd3,0xd0,0x9f,0x2b,0xd3,0xe1,0x3,0xc7,0x1,0xc4,0x0,0xcb,0x0,0xe1,0x2,0xc7,0x8,0xca,0x0,0xcb,0x0,0xd3,0xd3,0x0,0x9,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0x5,0x64,0x61,0x74,0x61,0x73,0x9,0x64,0x61,0x74,0x61,0x49,0x6e,0x64,0x65,0x78,0xc,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x49,0x6e,0x64,0x65,0x78,0x6,0x63,0x72,0x65,0x61,0x74,0x65,0x7,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x6a,0x9f,0x3c,0xc0,0x9f,0x3d,0xc0,0x9f,0x3e,0xc0,0x9f,0x3f,0xc0,0x9f,0x40,0xc0,0x9f,0x41,0xc0,0x8b,0x2e,0xc0,0x84,0x9,0xc0,0x84,0x18,0xc0,0x84,0x33,0xc0,0xc2,0x1,0x35,0x32,0x23,0x9f,0x43,0x9f,0x43,0x9f,0x43,0xc1,0x6,0x1e,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x44,0xa,0x9f,0x45,0xb1,0xc3,0xc4,0xc4,0xc4,0x9f,0x46,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xc9,0x0,0x0,0xd3,0x0,0xc2,0x1,0x34,0xf0,0xc2,0x1,0x35,0x16,0x25,0x9f,0x48,0x9f,0x48,0xc0,0x9f,0x49,0xc0,0xc1,0x6,0x1a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x4a,0xa,0x9f,0x4b,0xbf,0xc3,0xc4,0x8b,0x4f,0x83,0x32,0x9f,0x4c,0xe1,0x1,0xc9,0x3,0x0,0xc8,0x0,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xcb,0x0,0xd0,0x9f,0x47,0xd3,0x0,0xc2,0x1,0x35,0xb8,0x23,0x9f,0x4e,0x9f,0x4e,0x9f,0x4e,0xc1,0x6,0x22,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x4f,0xa,0x9f,0x50,0xb1,0xc3,0xc4,0xc4,0xc4,0x9f,0x51,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc9,0x0,0x0,0xd3,0x0,0x6,0x69,0x73,0x4c,0x69,0x73,0x74,0xc2,0x1,0x36,0x3c,0x22,0x9f,0x54,0x9f,0x54,0xc1,0x6,0x24,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x55,0xa,0x9f,0x56,0xb0,0xc3,0x49,0xc4,0xc4,0x9f,0x57,0xe0,0x1,0xce,0xc6,0x84,0x18,0xca,0x0,0xd3,0x0,0xc2,0x1,0x36,0x1c,0xc2,0x1,0x36,0x20,0x24,0x9f,0x59,0x9f,0x5a,0x9f,0x5a,0x9f,0x59,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x5b,0xa,0x9f,0x56,0xbb,0xc3,0xc4,0xc4,0xc4,0x9f,0x5c,0xe1,0x1,0xc9,0x3,0x5,0xf0,0x1,0x83,0x24,0xc8,0x0,0x0,0xc6,0x8c,0x11,0xd0,0x9f,0x58,0xd3,0xd3,0x0,0x8,0x69,0x73,0x4f,0x62,0x6a,0x65,0x63,0x74,0xc2,0x1,0x36,0xda,0xc2,0x1,0x36,0xe4,0xc2,0x1,0x37,0x0,0x27,0x9f,0x5f,0x9f,0x5f,0x9f,0x60,0x9f,0x60,0x9f,0x61,0x9f,0x61,0x9f,0x5f,0xc1,0x6,0x26,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x62,0xa,0x9f,0x63,0xbf,0xc3,0x92,0x5f,0xc4,0xc4,0x9f,0x64,0xe1,0x2,0xc7,0x3,0xe0,0x1,0xce,0xc6,0x84,0x18,0xca,0x0,0xd3,0xe0,0x1,0xce,0xc6,0x84,0x18,0xca,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x36,0xaa,0xc2,0x1,0x37,0x16,0xc2,0x1,0x36,0xb8,0xc2,0x1,0x36,0xac,0x27,0x9f,0x66,0x9f,0x67,0x9f,0x68,0x9f,0x69,0x9f,0x68,0x9f,0x67,0x9f,0x66,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x6a,0xa,0x9f,0x63,0xe5,0x21,0xc3,0xc4,0xc4,0xc4,0x9f,0x6b,0xe1,0x1,0xc9,0x3,0x6,0xe0,0x0,0xe0,0x2,0xc7,0x1b,0xc6,0x8c,0x11,0xc8,0x0,0x0,0xd0,0x9f,0x65,0xd3,0xc6,0x9a,0xe,0xd3,0xd3,0x0,0xc2,0x1,0x37,0x88,0x22,0x9f,0x6d,0x9f,0x6d,0xc1,0x6,0x28,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x6e,0xa,0x9f,0x6f,0xb0,0xc3,0xc4,0xc4,0xc4,0x9f,0x70,0xe1,0x1,0xc9,0x3,0x4,0xc8,0x0,0x0,0xd3,0x0,0xc2,0x1,0x37,0xec,0x22,0x9f,0x72,0x9f,0x72,0xc1,0x6,0x2a,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x73,0xa,0x9f,0x74,0xb0,0xc3,0xc4,0xc4,0xc4,0x9f,0x75,0xe1,0x1,0xc9,0x3,0x2,0xc8,0x0,0x0,0xd3,0x0,0xc2,0x1,0x38,0x52,0x22,0x9f,0x77,0x9f,0x77,0xc1,0x6,0x2c,0x64,0x4,0xc8,0x5,0xc3,0x6,0x9f,0x78,0xa,0x9f,0x79,0xb0,0xc3,0xc4,0xc4,0xc4,0x9f,0x7a,0xe1,0x1,0xc9,0x3,0x3,0xc8,0x0,0x0,0xd3,0x0,0x5,0x45,0x72,0x72,0x6f,0x72,0x1a,0x64,0x6f,0x6e,0x27,0x74,0x20,0x6b,0x6e,0x6f,0x77,0x20,0x68,0x6f,0x77,0x20,0x74,0x6f,0x20,0x65,0x6e,0x63,0x6f,0x64,0x65,0x3a,0x20,0xc2,0x1,0x38,0xee,0xc2,0x1,0x38,0xe6,0x23,0x9f,0x7e,0x9f,0x7f,0x9f,0x7e,0xc1,0x6,0x2e,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa0,0x0,0xa,0xa0,0x1,0xaf,0xc3,0xc4,0xc4,0xc4,0xa0,0x2,0xe1,0x1,0xc7,0x1a,0xc8,0x1,0x0,0xd3,0x0,0xc2,0x1,0x38,0xfa,0xc2,0x1,0x38,0xaa,0xc2,0x1,0x38,0xa0,0x2a,0xa0,0x4,0xa0,0x5,0xa0,0x6,0xc0,0xc0,0xc0,0xc0,0xc0,0xa0,0x5,0xa0,0x4,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa0,0x7,0xa,0xa0,0x1,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0xa0,0x8,0xe0,0x0,0xe1,0x1,0xc7,0x2f,0xe1,0x2,0xc7,0x19,0xc6,0x9f,0x7d,0xe1,0x0,0xd0,0xa0,0x3,0xd3,0xd3,0xd3,0xc6,0x88,0x2e,0xd3,0x0,0x22,0x48,0x9e,0x24,0x3,0x62,0x69,0x6e,0x24,0x8a,0x7c,0xa0,0xb,0x8b,0x16,0x8b,0x11,0xc2,0x1,0x34,0x90,0xc2,0x1,0x34,0x96,0xc2,0x1,0x35,0x7c,0xc2,0x1,0x35,0x68,0xc2,0x1,0x35,0x9c,0xc2,0x1,0x35,0xf6,0xc2,0x1,0x35,0xea,0xc2,0x1,0x36,0x8a,0xc2,0x1,0x36,0x7a,0xc2,0x1,0x37,0x62,0xc2,0x1,0x37,0x52,0xc2,0x1,0x37,0xc6,0xc2,0x1,0x37,0xb8,0xc2,0x1,0x38,0x2c,0xc2,0x1,0x38,0x1c,0xc2,0x1,0x39,0x44,0xc2,0x1,0x39,0x38,0xc2,0x1,0x39,0xda,0xc2,0x1,0x39,0xc6,0xc2,0x1,0x39,0xf8,0xc2,0x1,0x3a,0x0,0xe1,0x35,0xc0,0xa0,0xd,0xa0,0xe,0xa0,0xe,0xa0,0xe,0xc0,0xa0,0xf,0xa0,0x10,0xa0,0x10,0xa0,0xf,0xc0,0xa0,0x11,0xc0,0xa0,0x12,0xa0,0x13,0xa0,0x12,0xc0,0xc0,0xa0,0x14,0xa0,0x15,0xa0,0x14,0xc0,0xc0,0xa0,0x16,0xa0,0x17,0xa0,0x16,0xc0,0xc0,0xa0,0x18,0xa0,0x19,0xa0,0x18,0xc0,0xc0,0xa0,0x1a,0xa0,0x1b,0xa0,0x1a,0xc0,0xc0,0xc0,0xc0,0xa0,0x1c,0xa0,0x1d,0xa0,0x1d,0xa0,0x1c,0xa0,0x1e,0xa0,0x1f,0xa0,0x1f,0xa0,0x20,0xa0,0x21,0xa0,0x21,0xa0,0x21,0xa0,0x20,0xa0,0x1e,0xc1,0x6,0x18,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa0,0x22,0xa,0xa0,0x23,0xe5,0x81,0x33,0xc3,0xa0,0xa,0xa0,0xc,0x8c,0x25,0xa0,0x24,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x1e,0xca,0x1,0xd3,0xd0,0x9f,0x4d,0xd3,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x9f,0x3e,0xd3,0xc6,0x84,0xa,0xca,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xcb,0x0,0xd0,0x9f,0x52,0xd3,0xe1,0x1,0xc7,0x2d,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x9f,0x5d,0xd3,0xe1,0x1,0xc7,0x2e,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x9f,0x6c,0xd3,0xe1,0x1,0xc7,0x12,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x9f,0x71,0xd3,0xe1,0x1,0xc7,0x25,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x9f,0x76,0xd3,0xe1,0x1,0xc7,0x24,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x9f,0x7b,0xd3,0xc0,0xe3,0x0,0xd0,0xa0,0x9,0xd3,0xd4,0xd1,0x1,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x9f,0x3d,0xd3,0xc6,0x3b,0xcb,0x1,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x9f,0x3e,0xd3,0xc6,0x88,0x7d,0xca,0x0,0xe1,0x1,0xc9,0x2,0x1,0xe1,0x2,0xc7,0x8,0xcb,0x3,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0xb,0x69,0x73,0x53,0x74,0x72,0x69,0x6e,0x67,0x28,0x76,0x29,0xc2,0x1,0x3a,0xf6,0x23,0xa0,0x27,0xa0,0x27,0xa0,0x27,0xc1,0x6,0x3c,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa0,0x28,0xa,0xa0,0x29,0xb1,0xc3,0xc4,0xc4,0xc4,0xa0,0x2a,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc9,0x0,0x0,0xd3,0x0,0x24,0x8a,0x7c,0x8a,0x7c,0x8b,0x16,0x8b,0x11,0xc2,0x1,0x3a,0x5c,0xc2,0x1,0x3a,0x4e,0xc2,0x1,0x3a,0x6c,0xc2,0x1,0x3a,0xba,0xc2,0x1,0x3a,0xa0,0xc2,0x1,0x3a,0xda,0xc2,0x1,0x3b,0x2c,0xc2,0x1,0x3b,0x7e,0xc2,0x1,0x3b,0x6e,0xc2,0x1,0x3b,0xcc,0xc2,0x1,0x3b,0xb2,0xc2,0x1,0x3b,0xea,0xc2,0x1,0x3b,0xf2,0x3c,0xa0,0x2d,0xa0,0x2e,0xa0,0x2f,0xa0,0x2d,0xa0,0x2f,0xa0,0x2d,0xa0,0x30,0xa0,0x31,0xa0,0x31,0xa0,0x30,0xc0,0xa0,0x32,0xc0,0xa0,0x33,0xa0,0x33,0xa0,0x34,0xa0,0x35,0xa0,0x35,0xa0,0x34,0xa0,0x36,0xa0,0x37,0xa0,0x37,0xa0,0x38,0xa0,0x39,0xa0,0x39,0xa0,0x39,0xa0,0x38,0xa0,0x36,0xc1,0x6,0x36,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa0,0x3a,0xa,0xa0,0x3b,0xe5,0x72,0xc3,0x49,0xa0,0x2c,0x8c,0x25,0xa0,0x3c,0xf1,0x2,0x5b,0xc7,0xa,0xe1,0x1,0xc7,0x12,0xca,0x0,0xd3,0xc6,0xa0,0x26,0xd3,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x9f,0x3f,0xd3,0xc6,0x84,0xa,0xca,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xcb,0x0,0xd0,0xa0,0x2b,0xd3,0xe0,0x1,0xce,0xc6,0x84,0x18,0xca,0x0,0xd3,0xd1,0x1,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x9f,0x41,0xd3,0xc6,0x3b,0xcb,0x1,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x9f,0x3f,0xd3,0xc6,0x88,0x7d,0xca,0x0,0xe1,0x1,0xc9,0x2,0x1,0xe1,0x2,0xc7,0x8,0xcb,0x3,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0x65,0x88,0x6c,0xc0,0x88,0x7f,0xc0,0x84,0x9,0xc0,0x88,0x6d,0xc0,0x88,0x6b,0xc0,0x21,0x88,0x6d,0x21,0x88,0x6c,0x21,0x88,0x7f,0x26,0x8b,0x30,0x9e,0x24,0xa0,0x3f,0xa0,0x40,0xa0,0x41,0x89,0x14,0x24,0x84,0x9,0xa0,0xb,0x8b,0x16,0x8b,0x11,0xc2,0x1,0x3c,0xb4,0xc2,0x1,0x3d,0x86,0xc2,0x1,0x3e,0x38,0xc2,0x1,0x3e,0x2c,0xc2,0x1,0x3e,0xd0,0xc2,0x1,0x3e,0xbc,0xc2,0x1,0x3e,0xf4,0xc2,0x1,0x3e,0xfc,0x34,0xa0,0x44,0xa0,0x44,0xa0,0x45,0xc0,0xc0,0xc0,0xa0,0x45,0xa0,0x46,0xa0,0x47,0xa0,0x47,0xa0,0x46,0xa0,0x48,0xa0,0x49,0xa0,0x49,0xa0,0x4a,0xa0,0x4b,0xa0,0x4b,0xa0,0x4b,0xa0,0x4a,0xa0,0x48,0xc1,0x6,0x44,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa0,0x4c,0xa,0xa0,0x4d,0xe5,0x74,0xc3,0xa0,0x42,0xa0,0x43,0x8c,0x25,0xa0,0x4e,0xe0,0x1,0xca,0x1,0xc6,0x3b,0xc6,0x84,0xf,0xd3,0xd1,0x0,0xe1,0x3,0xc9,0x2,0x7,0xce,0xe1,0xb,0xc7,0x4,0xc6,0xa0,0x3e,0xc6,0x88,0x6b,0xca,0x0,0xc6,0x88,0x6d,0xca,0x2,0xc6,0x88,0x6c,0xca,0x3,0xc6,0x84,0x9,0xcb,0x0,0xc6,0x88,0x7f,0xca,0x4,0xd3,0xca,0x5,0xd3,0xd1,0x1,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x9f,0x3d,0xd3,0xc6,0x3b,0xcb,0x1,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x9f,0x3c,0xd3,0xc6,0x88,0x7d,0xca,0x0,0xe1,0x1,0xc9,0x2,0x1,0xe1,0x2,0xc7,0x8,0xcb,0x3,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0x64,0x4,0xc0,0x5,0xc0,0x6,0xc0,0xa,0xc0,0xc2,0x1,0x3f,0x62,0xc2,0x1,0x3f,0x8e,0xc2,0x1,0x3f,0x98,0xc2,0x1,0x3f,0xb0,0xc2,0x1,0x3f,0xc2,0xc2,0x1,0x3f,0xd4,0xc2,0x1,0x3f,0xea,0xc2,0x1,0x40,0x1a,0xc2,0x1,0x40,0x20,0xc2,0x1,0x40,0x56,0xc2,0x1,0x40,0x64,0x3b,0xa0,0x51,0xa0,0x51,0xa0,0x52,0xa0,0x52,0xa0,0x53,0xa0,0x54,0xa0,0x54,0xa0,0x55,0xa0,0x55,0xa0,0x56,0xa0,0x56,0xa0,0x57,0xa0,0x57,0xc0,0xc0,0xa0,0x58,0xa0,0x59,0xa0,0x59,0xa0,0x58,0xa0,0x5a,0xa0,0x5a,0xa0,0x5a,0xc0,0xa0,0x5b,0xa0,0x5b,0xa0,0x53,0xa0,0x52,0xc1,0x6,0x52,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa0,0x5c,0xa,0xa0,0x5d,0xe5,0x72,0xc3,0x49,0x9e,0x22,0x83,0x32,0xa0,0x5e,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x84,0xa,0xca,0x0,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x6,0xce,0xc6,0x8b,0x2e,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x6b,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x84,0x9,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x6d,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x85,0x38,0xd3,0xe1,0x9,0xc7,0x4,0xc6,0xa0,0x50,0xc6,0xa,0xe1,0x1,0xc9,0x1,0xd,0xe0,0x0,0xcb,0x0,0xc6,0x6,0xd3,0xd3,0xc6,0x5,0xc6,0x17,0xc6,0x4,0xc4,0x0,0xc6,0x6,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xe8,0x0,0xcb,0x0,0xc6,0x89,0x13,0xd3,0xd3,0xd3,0x0,0x4,0x74,0x6c,0x30,0x31,0x5,0x73,0x6c,0x69,0x63,0x65,0xc2,0x1,0x41,0xd2,0x22,0xa0,0x62,0xa0,0x62,0xc1,0x6,0x60,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa0,0x63,0xa,0xa0,0x64,0xb2,0xc3,0x49,0xc4,0xc4,0xa0,0x65,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x83,0x26,0xca,0x0,0xd3,0x0,0xc2,0x1,0x40,0xcc,0xc2,0x1,0x40,0xc0,0xc2,0x1,0x40,0xf4,0xc2,0x1,0x41,0x30,0xc2,0x1,0x41,0x50,0xc2,0x1,0x41,0x72,0xc2,0x1,0x41,0x66,0xc2,0x1,0x41,0x5a,0xc2,0x1,0x41,0xb4,0xc2,0x1,0x41,0xaa,0xc2,0x1,0x41,0x9e,0xc2,0x1,0x42,0x4,0xc2,0x1,0x42,0x26,0xc2,0x1,0x42,0x30,0xc2,0x1,0x42,0x82,0xc2,0x1,0x42,0xa4,0xc2,0x1,0x42,0x98,0xc2,0x1,0x42,0xec,0xe1,0x25,0xa0,0x67,0xa0,0x68,0xa0,0x67,0xa0,0x69,0xa0,0x69,0xa0,0x6a,0xa0,0x6b,0xa0,0x6c,0xa0,0x6c,0xa0,0x6d,0xa0,0x6e,0xa0,0x6e,0xa0,0x6d,0xa0,0x6c,0xa0,0x6b,0xa0,0x6a,0xa0,0x6f,0xa0,0x70,0xa0,0x71,0xa0,0x71,0xa0,0x70,0xa0,0x6f,0xa0,0x72,0xa0,0x73,0xa0,0x74,0xa0,0x74,0xa0,0x73,0xa0,0x72,0xa0,0x75,0xa0,0x76,0xa0,0x77,0xa0,0x77,0xa0,0x76,0xa0,0x75,0xa0,0x78,0xa0,0x78,0xa0,0x78,0xc1,0x6,0x58,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa0,0x79,0xa,0xa0,0x7a,0xe5,0x81,0x10,0xc3,0xc4,0x83,0x31,0x83,0x32,0xa0,0x7b,0xe0,0x0,0xc7,0x13,0xc6,0x83,0x23,0xd3,0xd1,0x0,0xe0,0x1,0xcb,0x0,0xc6,0x83,0x26,0xc6,0xa0,0x60,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x1,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xe0,0x0,0xce,0xc6,0x9f,0x3d,0xd3,0xc6,0x82,0x56,0xd3,0xc4,0x1,0xd3,0xd3,0xd3,0xf0,0x1,0x83,0x24,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x9f,0x3d,0xd3,0xc6,0xa0,0x61,0xc2,0xc6,0x2a,0xd3,0xc6,0x83,0x25,0xd0,0xa0,0x66,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x83,0x26,0xe1,0x1,0xc9,0x2,0x5,0xe0,0x0,0xce,0xc6,0x9f,0x41,0xd3,0xd3,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x83,0x26,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x9f,0x3d,0xd3,0xc6,0x84,0xa,0xc6,0x30,0xd3,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x0,0xd3,0x0,0xb,0x62,0x75,0x69,0x6c,0x64,0x65,0x72,0x5f,0x6e,0x65,0x77,0x21,0x9f,0x3c,0x21,0xa0,0x7e,0xc2,0x1,0x33,0x3c,0xc2,0x1,0x33,0x32,0xc2,0x1,0x33,0x7c,0xc2,0x1,0x33,0x6e,0xc2,0x1,0x33,0xb4,0xc2,0x1,0x33,0xaa,0xc2,0x1,0x33,0xfa,0xc2,0x1,0x33,0xec,0xc2,0x1,0x34,0x3a,0xc2,0x1,0x34,0x2c,0x32,0xc0,0xc0,0xa1,0x0,0xa1,0x1,0xa1,0x0,0xa1,0x2,0xa1,0x3,0xa1,0x2,0xa1,0x4,0xa1,0x5,0xa1,0x4,0xa1,0x6,0xa1,0x7,0xa1,0x6,0xa1,0x8,0xa1,0x9,0xa1,0x8,0xc0,0xc1,0x6,0xa,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa1,0xa,0xa,0xa1,0xb,0xe5,0x6b,0xa0,0x7d,0xa0,0x7f,0xc4,0xc4,0xa1,0xc,0xe1,0x17,0xc7,0x4,0xc6,0x9f,0x42,0xc6,0x9f,0x3c,0xca,0x0,0xc6,0x9f,0x3d,0xe0,0x0,0xc7,0x15,0xc6,0x83,0x23,0xd3,0xc6,0x9f,0x3e,0xe0,0x0,0xc7,0x1d,0xc6,0x83,0x23,0xd3,0xc6,0x9f,0x41,0xe0,0x0,0xc7,0x15,0xc6,0x83,0x23,0xd3,0xc6,0x9f,0x3f,0xe0,0x0,0xc7,0x1d,0xc6,0x83,0x23,0xd3,0xc6,0x9f,0x3c,0xe0,0x0,0xc7,0x1d,0xc6,0x83,0x23,0xd3,0xc6,0x84,0x18,0xd0,0xa0,0x25,0xc6,0x84,0x33,0xd0,0xa0,0x3d,0xc6,0x8b,0x2e,0xd0,0xa0,0x4f,0xc6,0x84,0x9,0xd0,0xa0,0x5f,0xc6,0x9f,0x40,0xd0,0xa0,0x7c,0xd3,0x0,0x65,0x4,0xc0,0x5,0xc0,0x9f,0xe,0xc0,0x6,0xc0,0xa,0xc0,0xb,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x6d,0x61,0x69,0x6e,0x21,0x9e,0x6a,0x22,0xa1,0x10,0x8b,0x2f,0x7,0x62,0x75,0x69,0x6c,0x64,0x65,0x72,0x26,0x88,0x6b,0x88,0x6d,0x8e,0x73,0x5,0x6,0xa1,0x12,0xc2,0x1,0x43,0x7e,0xc2,0x1,0x43,0x72,0xc2,0x1,0x43,0xd0,0xc2,0x1,0x43,0xc0,0xc2,0x1,0x43,0xd6,0xc2,0x1,0x44,0x14,0xc2,0x1,0x44,0x8,0xc2,0x1,0x44,0x1a,0xc2,0x1,0x44,0x52,0xc2,0x1,0x44,0x46,0xc2,0x1,0x44,0x8c,0xc2,0x1,0x44,0x82,0xc2,0x1,0x44,0x92,0xc2,0x1,0x44,0xd4,0xc2,0x1,0x45,0xa,0xc2,0x1,0x45,0x32,0xc2,0x1,0x45,0x84,0xc2,0x1,0x45,0x8e,0xc2,0x1,0x45,0xc8,0xc2,0x1,0x45,0xf2,0xc2,0x1,0x46,0x20,0xe1,0x36,0xa1,0x14,0xa1,0x14,0xa1,0x15,0xa1,0x15,0xa1,0x14,0xa1,0x16,0xa1,0x16,0xa1,0x17,0xa1,0x17,0xa1,0x18,0xa1,0x18,0xa1,0x18,0xa1,0x16,0xa1,0x19,0xa1,0x19,0xa1,0x1a,0xa1,0x1a,0xa1,0x1b,0xa1,0x1b,0xa1,0x1b,0xa1,0x19,0xa1,0x1c,0xa1,0x1c,0xa1,0x1d,0xa1,0x1d,0xa1,0x1c,0xa1,0x1e,0xa1,0x1e,0xa1,0x1f,0xa1,0x1f,0xa1,0x20,0xa1,0x20,0xa1,0x20,0xa1,0x1e,0xa1,0x21,0xa1,0x21,0xa1,0x22,0xa1,0x23,0xa1,0x23,0xc0,0xc0,0xa1,0x24,0xa1,0x25,0xa1,0x25,0xa1,0x24,0xa1,0x26,0xa1,0x26,0xa1,0x26,0xc0,0xa1,0x27,0xa1,0x27,0xa1,0x22,0xa1,0x28,0xa1,0x28,0xc1,0x6,0x6c,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa1,0x29,0xa,0xa1,0x2a,0xe5,0x81,0x45,0xa1,0xf,0xa1,0x11,0xa1,0x13,0x92,0x0,0xa1,0x2b,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xca,0x0,0xc6,0x88,0x6b,0xd3,0xc6,0x9e,0x64,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xca,0x0,0xc6,0x88,0x6d,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xca,0x0,0xc6,0x85,0x38,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xca,0x0,0xc6,0x5,0xd3,0xc6,0x17,0xd3,0xd1,0x3,0xe1,0x2,0xc7,0x1c,0xe8,0x0,0xca,0x0,0xc6,0x6,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xd1,0x4,0xe1,0x1,0xc9,0x0,0xe,0xc9,0x0,0x1,0xd3,0xd1,0x5,0xe0,0x6,0xcb,0x5,0xc6,0x8b,0x2e,0xcb,0x0,0xe0,0x0,0xca,0x0,0xc6,0x84,0x9,0xd3,0xcb,0x1,0xcb,0x2,0xe1,0xb,0xc7,0x4,0xc6,0xa1,0xe,0xc6,0xa,0xe1,0x1,0xc9,0x0,0xd,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd3,0xc6,0x5,0xcb,0x3,0xc6,0x4,0xc4,0x0,0xc6,0x6,0xe1,0x0,0xc7,0x3,0xd3,0xc6,0x9f,0xe,0xc9,0x0,0xc,0xd3,0xe8,0x0,0xca,0x0,0xc6,0x89,0x13,0xd3,0xd3,0xe0,0x0,0xcb,0x5,0xc6,0x9f,0x40,0xd3,0x0,0x4,0x6c,0x69,0x6e,0x6b,0x6,0x62,0x75,0x66,0x66,0x65,0x72,0xc2,0x1,0x47,0x30,0x23,0xa1,0x2f,0xa1,0x2f,0xa1,0x2f,0xc1,0x6,0x86,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa1,0x30,0xa,0xa1,0x31,0xb1,0xc3,0xc4,0xc4,0xc4,0xa1,0x32,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc9,0x0,0x12,0xd3,0x0,0x7,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x22,0x9e,0x66,0x9e,0x68,0x3,0x69,0x64,0x73,0xa,0x53,0x63,0x6f,0x70,0x65,0x43,0x6c,0x61,0x73,0x73,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0x32,0x33,0x9f,0x41,0x9f,0x3c,0xa1,0x36,0x8e,0x51,0xa1,0x37,0x8e,0x3c,0x8e,0x73,0x8f,0x72,0x98,0x34,0x9d,0x53,0x9e,0x21,0x9e,0x65,0x9f,0xe,0x9f,0x2c,0xa0,0x7d,0xa1,0xf,0x9e,0x6a,0xa1,0x38,0x83,0x30,0x33,0xc1,0xc1,0xc1,0xc2,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0x56,0xc2,0xc1,0x56,0xb4,0xc1,0x56,0xf6,0xc1,0x56,0xec,0xc1,0x57,0x1e,0xc1,0x57,0x14,0xc2,0x1,0x46,0x72,0xc2,0x1,0x46,0x92,0xc2,0x1,0x46,0xd0,0xc2,0x1,0x46,0xfe,0xc2,0x1,0x47,0xc,0xc2,0x1,0x47,0x4e,0xc2,0x1,0x47,0x56,0x3e,0xa1,0x3b,0xa1,0x3c,0xa1,0x3b,0xa1,0x3d,0xa1,0x3e,0xa1,0x3d,0xa1,0x3f,0xa1,0x40,0xa1,0x3f,0xc0,0xc0,0xc0,0xc0,0xc0,0xa1,0x41,0xa1,0x42,0xa1,0x42,0xa1,0x41,0xa1,0x43,0xa1,0x43,0xc0,0xa1,0x44,0xa1,0x45,0xa1,0x45,0xc0,0xa1,0x46,0xa1,0x46,0xa1,0x47,0xa1,0x47,0xa1,0x46,0xc1,0x1,0xa8,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa1,0x48,0xa,0xa1,0x49,0xe5,0x81,0x7c,0xa1,0x34,0xa1,0x35,0xa1,0x39,0xa1,0x3a,0xa1,0x4a,0xe0,0x0,0xc7,0x1d,0xc6,0x83,0x23,0xd3,0xd1,0x0,0xe0,0x0,0xc7,0x15,0xc6,0x83,0x23,0xd3,0xd1,0x1,0xe0,0x0,0xc7,0x15,0xc6,0x83,0x23,0xd3,0xd1,0x2,0xc2,0xd6,0x3,0xe1,0x17,0xc7,0x4,0xc6,0x8b,0x3,0xc6,0x8a,0x7b,0xd0,0x8b,0x3b,0xc6,0x8a,0x7a,0xd0,0x8b,0x4e,0xc6,0x3b,0xd0,0x8b,0x73,0xc6,0x8b,0x2,0xd0,0x8c,0x10,0xc6,0x88,0x6e,0xd0,0x8c,0x20,0xc6,0x8a,0x7d,0xd0,0x8c,0x32,0xc6,0x8a,0x7e,0xd0,0x8c,0x45,0xc6,0x8a,0x7f,0xd0,0x8c,0x54,0xc6,0x8b,0x0,0xd0,0x8c,0x70,0xc6,0x8b,0x1,0xd0,0x8d,0xa,0xc6,0x8a,0x7c,0xd0,0x8e,0x39,0xd3,0xd1,0x4,0xd0,0x8e,0x4e,0xd1,0x5,0xd0,0x8e,0x60,0xd6,0x3,0xd0,0x8f,0x0,0xd1,0x6,0xd0,0x90,0x7,0xd1,0x7,0xd0,0x98,0x77,0xd1,0x8,0xd0,0x9e,0x1a,0xd1,0x9,0xd0,0x9e,0x32,0xd1,0xa,0xd0,0x9e,0x77,0xd1,0xb,0xe1,0x0,0xd0,0x9f,0x18,0xd3,0xd1,0xc,0xd0,0x9f,0x3b,0xd1,0xd,0xd0,0xa1,0xd,0xd1,0xe,0xd0,0xa1,0x2c,0xd1,0xf,0xe1,0x3,0xcb,0xb,0xca,0x0,0xca,0x1,0xe0,0x1,0xcc,0xc6,0x84,0xa,0xc6,0xa1,0x2d,0xd3,0xd3,0xd2,0x0,0x10,0xd2,0x1,0x11,0xe1,0x2,0xcb,0xf,0xcb,0x10,0xcb,0x11,0xd3,0xd1,0x12,0xf1,0x2,0x5f,0xc7,0xb,0xe0,0x1,0xcc,0xc6,0x84,0xa,0xc6,0xa1,0x2e,0xd3,0xd0,0xa1,0x33,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x0,0xcb,0x12,0xc6,0x83,0x2f,0xd3,0xd3,0x0,0xc2,0x1,0x48,0x2,0x23,0xa1,0x4c,0xa1,0x4c,0xa1,0x4c,0xc1,0x6,0x92,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa1,0x4d,0xa,0xa1,0x4e,0xae,0xc3,0xc4,0xc4,0xc4,0xa1,0x4f,0xe1,0x1,0xc7,0x1,0xc4,0x1,0xd3,0x0,0x8,0x62,0x61,0x63,0x6b,0x77,0x61,0x72,0x64,0x23,0xc0,0xc0,0xa1,0x51,0x1,0xa,0x5,0x74,0x69,0x6d,0x65,0x73,0x2,0x5e,0xa,0x9,0x70,0x72,0x69,0x6e,0x74,0x5f,0x70,0x6f,0x73,0x8,0x64,0x65,0x62,0x75,0x67,0x67,0x65,0x72,0x21,0xa1,0x57,0x6,0x73,0x74,0x72,0x65,0x61,0x6d,0x21,0xa1,0x59,0x22,0xa1,0x58,0xa1,0x5a,0x5,0x62,0x65,0x67,0x69,0x6e,0x24,0x6,0x5,0xa1,0x5c,0x84,0xf,0xc2,0x1,0x47,0xd8,0xc2,0x1,0x47,0xea,0xc2,0x1,0x47,0xf0,0xc2,0x1,0x48,0x80,0xc2,0x1,0x48,0x72,0xc2,0x1,0x48,0x32,0xc2,0x1,0x48,0xec,0xc2,0x1,0x48,0xc8,0xc2,0x1,0x48,0xa6,0xc2,0x1,0x48,0xe2,0xc2,0x1,0x48,0xd6,0xc2,0x1,0x49,0x8,0xc2,0x1,0x49,0x42,0xc2,0x1,0x49,0x76,0xc2,0x1,0x49,0x56,0xc2,0x1,0x49,0x6c,0xe1,0x2f,0xa1,0x5e,0xa1,0x5e,0xc0,0xa1,0x5f,0xa1,0x60,0xa1,0x60,0xa1,0x60,0xc0,0xa1,0x61,0xa1,0x61,0xa1,0x62,0xa1,0x62,0xa1,0x63,0xc0,0xc0,0xc0,0xa1,0x63,0xa1,0x62,0xa1,0x61,0xa1,0x64,0xa1,0x64,0xa1,0x65,0xa1,0x65,0xa1,0x66,0xc0,0xc0,0xc0,0xa1,0x66,0xa1,0x67,0xa1,0x67,0xa1,0x68,0xa1,0x68,0xa1,0x67,0xa1,0x65,0xa1,0x64,0xa1,0x69,0xa1,0x69,0xa1,0x6a,0xa1,0x6b,0xa1,0x6b,0xa1,0x6c,0xa1,0x6d,0xa1,0x6d,0xa1,0x6d,0xa1,0x6c,0xa1,0x6b,0xa1,0x6a,0xc1,0x6,0x8e,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa1,0x6e,0xa,0xa1,0x6f,0xe5,0x81,0x29,0xa1,0x56,0xa1,0x5b,0xa1,0x5d,0x8c,0x25,0xa1,0x70,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x1e,0xcb,0x0,0xd3,0xd0,0xa1,0x50,0xd3,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x1c,0xf0,0x3,0xa1,0x52,0xcb,0x1,0xc6,0x9e,0x78,0xe1,0x1,0xc7,0x2a,0xc4,0xa,0xd3,0xcb,0x0,0xc0,0xd3,0xc6,0x30,0xd3,0xc4,0x1,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x8,0xe1,0x2,0xc7,0x1c,0xe0,0x2,0xcb,0x1,0xc6,0x9e,0x78,0xe1,0x1,0xc7,0x2a,0xc4,0xa,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xcb,0x1,0xc6,0x82,0x56,0xd3,0xc4,0x1,0xd3,0xd3,0xc4,0x1,0xd3,0xd1,0x3,0xe0,0x2,0xca,0x1,0xc6,0x83,0x26,0xcb,0x1,0xc6,0xa1,0x53,0xd3,0xe0,0x1,0xca,0x1,0xc6,0x83,0x26,0xe1,0x2,0xc7,0x9,0xe0,0x1,0xc6,0x88,0x31,0xc6,0xa1,0x54,0xe1,0x2,0xc7,0x8,0xcb,0x0,0xc4,0x1,0xd3,0xd3,0xc6,0xa1,0x55,0xd3,0xd3,0x0,0x7,0x49,0x4e,0x50,0x55,0x54,0x3e,0xa,0xa,0x72,0x65,0x61,0x64,0x53,0x74,0x72,0x69,0x6e,0x67,0x4,0x74,0x72,0x69,0x6d,0xc2,0x1,0x4b,0x70,0xc2,0x1,0x4b,0x86,0xc2,0x1,0x4b,0x7e,0xc2,0x1,0x4b,0x98,0x27,0xa1,0x75,0xa1,0x76,0xa1,0x77,0xa1,0x78,0xa1,0x78,0xa1,0x76,0xa1,0x75,0xc1,0x6,0xac,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa1,0x79,0xa,0xa1,0x7a,0xe5,0x21,0xc3,0xc4,0xc4,0xc4,0xa1,0x7b,0xe0,0x2,0xc8,0x1,0x1,0xc6,0x83,0x26,0xe1,0x1,0xc7,0x1a,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x90,0xe,0xd3,0xd3,0xc6,0xa1,0x53,0xd3,0x0,0xc2,0x1,0x4c,0x12,0xc2,0x1,0x4c,0x28,0xc2,0x1,0x4c,0x20,0xc2,0x1,0x4c,0x3a,0x27,0xa1,0x7d,0xa1,0x7e,0xa1,0x7f,0xa2,0x0,0xa2,0x0,0xa1,0x7e,0xa1,0x7d,0xc1,0x6,0xb0,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0x1,0xa,0xa2,0x2,0xe5,0x21,0xc3,0xc4,0xc4,0xc4,0xa2,0x3,0xe0,0x2,0xc8,0x1,0x1,0xc6,0x83,0x26,0xe1,0x1,0xc7,0x1a,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x88,0x6d,0xd3,0xd3,0xc6,0xa1,0x53,0xd3,0x0,0xc2,0x1,0x4c,0xd4,0xc2,0x1,0x4c,0xf4,0x24,0xa2,0x5,0xa2,0x6,0xa2,0x6,0xa2,0x5,0xc1,0x6,0xb4,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0x7,0xa,0xa2,0x8,0xbf,0xc3,0xc4,0xc4,0xc4,0xa2,0x9,0xe0,0x2,0xc8,0x1,0x1,0xc6,0x83,0x26,0xe1,0x2,0xc9,0x2,0xa,0xc8,0x1,0x0,0xc8,0x1,0x1,0xd3,0xc6,0xa1,0x53,0xd3,0x0,0x4,0x73,0x74,0x65,0x70,0xc2,0x1,0x4d,0xa0,0xc2,0x1,0x4d,0xd6,0x24,0xa2,0xc,0xa2,0xc,0xa2,0xd,0xa2,0xd,0xc1,0x6,0xb8,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0xe,0xa,0xa2,0xf,0xbc,0xc3,0xc4,0xc4,0xc4,0xa2,0x10,0xe0,0x0,0xc8,0x1,0x0,0xc6,0xa2,0xb,0xd3,0xe1,0x2,0xc9,0x2,0xa,0xc8,0x1,0x0,0xc8,0x1,0x1,0xd3,0x0,0x4,0x73,0x74,0x6f,0x70,0x6,0x64,0x65,0x74,0x61,0x63,0x68,0x7,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0xc2,0x1,0x4e,0x5a,0xc2,0x1,0x4e,0x7a,0xc2,0x1,0x4e,0xb6,0xc2,0x1,0x4e,0xe2,0x2c,0xa2,0x15,0xa2,0x16,0xa2,0x16,0xa2,0x15,0xa2,0x17,0xa2,0x17,0xa2,0x18,0xa2,0x18,0xa2,0x18,0xa2,0x18,0xa2,0x18,0xa2,0x18,0xc1,0x6,0xbe,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0x19,0xa,0xa2,0x1a,0xe5,0x30,0xc3,0xc4,0xc4,0xc4,0xa2,0x1b,0xe0,0x1,0xc8,0x1,0x0,0xc6,0xa2,0x13,0xe0,0x0,0xc8,0x1,0x0,0xc6,0xa2,0x14,0xd3,0xd3,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8d,0x2,0xd3,0xe1,0x1,0xc7,0x17,0xe1,0x2,0xc7,0x3,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0x0,0x3,0x63,0x6d,0x64,0x22,0x8b,0x11,0xa2,0x1d,0xc2,0x1,0x4a,0x60,0xc2,0x1,0x4a,0xac,0xc2,0x1,0x4b,0xa,0xc2,0x1,0x4a,0xec,0xc2,0x1,0x4b,0x32,0xc2,0x1,0x4b,0xd0,0xc2,0x1,0x4c,0x8a,0xc2,0x1,0x4c,0x76,0xc2,0x1,0x4c,0x98,0xc2,0x1,0x4d,0x58,0xc2,0x1,0x4d,0x44,0xc2,0x1,0x4d,0x66,0xc2,0x1,0x4e,0x18,0xe1,0x2d,0xa2,0x1f,0xa2,0x1f,0xa2,0x20,0xa2,0x20,0xa2,0x21,0xa2,0x22,0xa2,0x22,0xa2,0x21,0xa2,0x23,0xa2,0x23,0xa2,0x23,0xc0,0xc0,0xa2,0x24,0xa2,0x24,0xa2,0x24,0xc0,0xc0,0xa2,0x25,0xa2,0x25,0xa2,0x26,0xa2,0x26,0xa2,0x26,0xa2,0x27,0xa2,0x27,0xa2,0x27,0xa2,0x25,0xc0,0xc0,0xa2,0x28,0xa2,0x28,0xa2,0x29,0xa2,0x29,0xa2,0x29,0xa2,0x2a,0xa2,0x2a,0xa2,0x2a,0xa2,0x28,0xc0,0xc0,0xa2,0x2b,0xa2,0x2b,0xa2,0x2b,0xc0,0xc0,0xc1,0x6,0xa0,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0x2c,0xa,0xa2,0x2d,0xe5,0x81,0x23,0xc3,0xc4,0xa2,0x1e,0x83,0x73,0xa2,0x2e,0xe0,0x1,0xc8,0x0,0x1,0xc6,0x83,0x26,0xc6,0xa1,0x72,0xd3,0xe0,0x1,0xc8,0x0,0x1,0xc6,0x9e,0x78,0xc6,0xa1,0x53,0xd3,0xd1,0x0,0xe0,0x0,0xe0,0x1,0xc8,0x0,0x1,0xc6,0xa1,0x73,0xcb,0x0,0xd3,0xc6,0xa1,0x74,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0x90,0xe,0xd3,0xe3,0x0,0xd0,0xa1,0x7c,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0x88,0x6d,0xd3,0xe3,0x0,0xd0,0xa2,0x4,0xd3,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0x93,0x11,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0x6,0xd3,0xd3,0xe3,0x0,0xd0,0xa2,0xa,0xd3,0xe1,0x2,0xc7,0x1c,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0xa2,0xb,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0x17,0xd3,0xd3,0xe3,0x0,0xd0,0xa2,0x11,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0xa2,0x12,0xd3,0xe3,0x0,0xd0,0xa2,0x1c,0xd3,0xd4,0x0,0xe,0x53,0x69,0x6d,0x70,0x6c,0x65,0x44,0x65,0x62,0x75,0x67,0x67,0x65,0x72,0xc2,0x1,0x49,0xdc,0x23,0xa2,0x31,0xa2,0x31,0xa2,0x31,0xc1,0x6,0x9e,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0x32,0xa,0xa2,0x33,0xb3,0xa2,0x30,0xa1,0x5b,0xc4,0xc4,0xa2,0x34,0xf1,0x1,0x83,0x24,0xc7,0x16,0xd0,0xa2,0x2f,0xd3,0x0,0x5,0x64,0x65,0x62,0x75,0x67,0x5,0x66,0x72,0x61,0x6d,0x65,0x5,0x6c,0x69,0x6e,0x6b,0x73,0x3,0x72,0x75,0x6e,0x65,0xa2,0x36,0xc0,0xa2,0x37,0xc0,0xa1,0x2d,0xc0,0xa2,0x38,0xc0,0xa2,0x39,0xc0,0xd,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x6b,0x73,0xc2,0x1,0x4f,0x50,0xc2,0x1,0x4f,0x36,0x23,0xa2,0x3c,0xa2,0x3d,0xa2,0x3c,0xc1,0x6,0xc8,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0x3e,0xa,0xa2,0x3f,0xaf,0xc3,0xc4,0xc4,0xc4,0xa2,0x40,0xe1,0x1,0xc7,0x30,0xc8,0x0,0x0,0xd3,0x0,0xc,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x6b,0x21,0x8c,0x67,0xc2,0x1,0x4f,0x8e,0xc2,0x1,0x4f,0xa8,0xc2,0x1,0x4f,0x90,0x25,0xa2,0x44,0xa2,0x45,0xa2,0x46,0xa2,0x45,0xa2,0x44,0xc1,0x6,0xca,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0x47,0xa,0xa2,0x48,0xb8,0xc3,0xa2,0x43,0xc4,0xc4,0xa2,0x49,0xe1,0x1,0xc9,0x1,0xc,0xe1,0x2,0xc7,0x31,0xc8,0x0,0x0,0xca,0x0,0xd3,0xd3,0x0,0xd,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x66,0x72,0x61,0x6d,0x65,0x21,0x8f,0x1c,0x21,0xa2,0x4c,0xc2,0x1,0x50,0x18,0xc2,0x1,0x4f,0xfe,0xc2,0x1,0x50,0x30,0x25,0xa2,0x4e,0xa2,0x4f,0xa2,0x50,0xa2,0x50,0xa2,0x4e,0xc1,0x6,0xcc,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0x51,0xa,0xa2,0x52,0xbc,0xc3,0xa2,0x4d,0xc4,0xc4,0xa2,0x53,0xe1,0x3,0xc7,0x32,0xc8,0x0,0x0,0xca,0x0,0xe0,0x1,0xcc,0xc6,0x84,0xa,0xc6,0xa1,0x2d,0xd3,0xd3,0x0,0xb,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x72,0x75,0x6e,0x4,0x74,0x61,0x73,0x6b,0x21,0xa2,0x56,0x21,0xa2,0x37,0x23,0xa2,0x4c,0xa2,0x57,0xa2,0x58,0xc2,0x1,0x50,0xb4,0xc2,0x1,0x50,0x9e,0x23,0xa2,0x5a,0xa2,0x5b,0xa2,0x5a,0xc1,0x6,0xd0,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0x5c,0xa,0xa2,0x5d,0xb6,0xc3,0xa2,0x59,0xc4,0xc4,0xa2,0x5e,0xe1,0x4,0xc7,0x33,0xc8,0x0,0x0,0xca,0x0,0xca,0x1,0xca,0x2,0xd3,0x0,0x8,0x44,0x65,0x62,0x75,0x67,0x67,0x65,0x72,0x4,0x54,0x61,0x73,0x6b,0x6,0x61,0x74,0x74,0x61,0x63,0x68,0x23,0xa1,0x5a,0xa2,0x4c,0xa2,0x58,0x22,0xa1,0x57,0xa2,0x56,0xc2,0x1,0x51,0x66,0xc2,0x1,0x51,0x56,0xc2,0x1,0x51,0x9e,0xc2,0x1,0x51,0x96,0xc2,0x1,0x51,0xd0,0xc2,0x1,0x52,0x1a,0xc2,0x1,0x52,0x4,0xc2,0x1,0x52,0x68,0xc2,0x1,0x52,0x86,0x30,0xa2,0x65,0xa2,0x66,0xa2,0x65,0xa2,0x67,0xa2,0x68,0xa2,0x67,0xa2,0x69,0xa2,0x69,0xa2,0x6a,0xa2,0x6b,0xa2,0x6a,0xa2,0x6c,0xa2,0x6c,0xa2,0x6d,0xa2,0x6d,0xa2,0x6c,0xc1,0x6,0xd4,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0x6e,0xa,0xa2,0x6f,0xe5,0x47,0xc3,0xa2,0x63,0xa2,0x64,0x83,0x73,0xa2,0x70,0xe0,0x0,0xc7,0x34,0xc6,0x83,0x23,0xd3,0xd1,0x0,0xe0,0x0,0xc7,0x35,0xc6,0x83,0x23,0xd3,0xd1,0x1,0xe0,0x1,0xcb,0x0,0xc6,0xa2,0x62,0xcb,0x1,0xd3,0xe1,0x4,0xc7,0x33,0xc8,0x0,0x0,0xca,0x1,0xcb,0x1,0xca,0x2,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x2,0xc9,0x1,0xb,0xcb,0x0,0xca,0x0,0xd3,0xd3,0x0,0x6,0x4d,0x6f,0x64,0x75,0x6c,0x65,0xc1,0x6,0xc6,0x64,0x4,0xc8,0x5,0xc3,0x6,0x84,0xb,0xa,0xa2,0x73,0xe5,0x2f,0xa2,0x72,0x83,0x71,0xc4,0xc4,0xa2,0x74,0xe1,0xb,0xc7,0x4,0xc6,0xa2,0x3a,0xc6,0xa2,0x38,0xd0,0xa2,0x41,0xc6,0xa1,0x2d,0xd0,0xa2,0x4a,0xc6,0xa2,0x37,0xd0,0xa2,0x54,0xc6,0xa2,0x39,0xd0,0xa2,0x5f,0xc6,0xa2,0x36,0xd0,0xa2,0x71,0xd3,0x0,0x1d,0x63,0x61,0x6e,0x6e,0x6f,0x74,0x20,0x6c,0x69,0x6e,0x6b,0x20,0x75,0x73,0x69,0x6e,0x67,0x20,0x61,0x20,0x53,0x74,0x72,0x69,0x6e,0x67,0x3a,0x20,0x27,0xc2,0x1,0x53,0xaa,0xc2,0x1,0x53,0x5e,0xc2,0x1,0x53,0x54,0x28,0xa2,0x77,0xa2,0x78,0xa2,0x79,0xc0,0xc0,0xc0,0xa2,0x78,0xa2,0x77,0xc1,0x6,0xe8,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa2,0x7a,0xa,0xa2,0x7b,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0xa2,0x7c,0xe0,0x0,0xe1,0x1,0xc7,0x2f,0xe1,0x3,0xc7,0x19,0xc6,0xa2,0x76,0xc8,0x0,0x0,0xc6,0x97,0x26,0xd3,0xd3,0xc6,0x88,0x2e,0xd3,0x0,0x9,0x69,0x73,0x44,0x65,0x66,0x69,0x6e,0x65,0x64,0xc2,0x1,0x54,0x56,0x23,0xa2,0x7f,0xa2,0x7f,0xa2,0x7f,0xc1,0x6,0xea,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x0,0xa,0xa3,0x1,0xb1,0xc3,0xc4,0xc4,0xc4,0xa3,0x2,0xe1,0x2,0xc7,0x1,0xc4,0x3,0xc9,0x0,0x0,0xd3,0x0,0x1,0x78,0x21,0xa3,0x4,0xc2,0x1,0x54,0x6,0xc2,0x1,0x53,0xfa,0xc2,0x1,0x54,0x28,0xc2,0x1,0x54,0x40,0xc2,0x1,0x54,0x2e,0x29,0xa3,0x6,0xa3,0x7,0xa3,0x6,0xc0,0xa3,0x8,0xa3,0x9,0xa3,0xa,0xa3,0x9,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0xb,0xa,0xa3,0x1,0xe5,0x29,0xc3,0xc4,0xa3,0x5,0x83,0x32,0xa3,0xc,0xe0,0x2,0xc7,0x1b,0xc6,0x84,0xa,0xc8,0x0,0x0,0xc8,0x1,0x1,0xd3,0xd1,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x36,0xcb,0x0,0xd3,0xd0,0xa3,0x3,0xd3,0x0,0xa,0x69,0x73,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0xc2,0x1,0x54,0xe2,0x23,0xa3,0xf,0xa3,0xf,0xa3,0xf,0xc1,0x6,0xec,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x10,0xa,0xa3,0x11,0xb1,0xc3,0xc4,0xc4,0xc4,0xa3,0x12,0xe1,0x2,0xc7,0x1,0xc4,0x3,0xc9,0x0,0x0,0xd3,0x0,0xc2,0x1,0x54,0xa4,0xc2,0x1,0x54,0xb4,0xc2,0x1,0x54,0xcc,0xc2,0x1,0x54,0xba,0x28,0xa3,0x14,0xa3,0x14,0xc0,0xa3,0x15,0xa3,0x16,0xa3,0x17,0xa3,0x16,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x18,0xa,0xa3,0x11,0xe5,0x24,0xc3,0xc4,0xa3,0x5,0x83,0x32,0xa3,0x19,0xe1,0x1,0xc8,0x0,0x0,0xc8,0x1,0x1,0xd3,0xd1,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x36,0xcb,0x0,0xd3,0xd0,0xa3,0x13,0xd3,0x0,0xc2,0x1,0x55,0x6e,0x23,0xa3,0x1b,0xa3,0x1b,0xa3,0x1b,0xc1,0x6,0xee,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x1c,0xa,0xa3,0x1d,0xb1,0xc3,0xc4,0xc4,0xc4,0xa3,0x1e,0xe1,0x2,0xc7,0x1,0xc4,0x3,0xc9,0x0,0x0,0xd3,0x0,0xc2,0x1,0x55,0x30,0xc2,0x1,0x55,0x40,0xc2,0x1,0x55,0x58,0xc2,0x1,0x55,0x46,0x28,0xa3,0x20,0xa3,0x20,0xc0,0xa3,0x21,0xa3,0x22,0xa3,0x23,0xa3,0x22,0xc0,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x24,0xa,0xa3,0x1d,0xe5,0x27,0xc3,0xc4,0xa3,0x5,0x83,0x32,0xa3,0x25,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x84,0xa,0xc8,0x1,0x1,0xd3,0xd1,0x0,0xf1,0x2,0x5f,0xc7,0xb,0xe1,0x1,0xc7,0x36,0xcb,0x0,0xd3,0xd0,0xa3,0x1f,0xd3,0x0,0x21,0x85,0xc,0x21,0xa3,0x27,0xc2,0x1,0x53,0x3e,0xc2,0x1,0x53,0x2e,0xc2,0x1,0x53,0xdc,0xc2,0x1,0x53,0xcc,0xc2,0x1,0x54,0x84,0xc2,0x1,0x54,0x70,0x31,0xa3,0x29,0xa3,0x2a,0xa3,0x29,0xc0,0xc0,0xa3,0x2b,0xa3,0x2c,0xa3,0x2b,0xc0,0xc0,0xa3,0x2d,0xa3,0x2e,0xa3,0x2d,0xc0,0xc0,0xc0,0xc0,0xc1,0x6,0xe6,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x2f,0xa,0xa3,0x30,0xe5,0x38,0xc3,0xa3,0x28,0xc4,0xc4,0xa3,0x31,0xe1,0x1,0xc7,0x12,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa2,0x7d,0xd3,0xe1,0x1,0xc7,0x2e,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa3,0xd,0xd3,0xe1,0x1,0xc7,0x37,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa3,0x1a,0xd3,0xca,0x0,0xe3,0x0,0xd0,0xa3,0x26,0xd3,0xd4,0x0,0x8,0x5f,0x75,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x9,0x6e,0x61,0x6d,0x65,0x5f,0x66,0x72,0x6f,0x6d,0x4,0x65,0x6e,0x76,0x73,0x21,0xa3,0x35,0x22,0xa3,0x36,0x8b,0x30,0xc2,0x1,0x52,0xfe,0xc2,0x1,0x55,0x88,0xc2,0x1,0x55,0x9a,0xc2,0x1,0x55,0x8a,0x28,0xa3,0x38,0xa3,0x38,0xa3,0x39,0xa3,0x39,0xa3,0x3a,0xa3,0x3b,0xa3,0x3a,0xa3,0x39,0xc1,0x6,0xe4,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x3c,0xa,0xa3,0x3d,0xe5,0x22,0xa3,0x34,0xa3,0x37,0xc4,0xc4,0xa3,0x3e,0xf0,0x1,0x83,0x24,0xca,0x0,0xc6,0x83,0x25,0xd0,0xa3,0x32,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x0,0xc7,0x38,0xd3,0xd3,0x0,0x4,0x74,0x69,0x6d,0x65,0x5,0x69,0x73,0x42,0x69,0x6e,0xc2,0x1,0x56,0x36,0xc2,0x1,0x56,0x2a,0x23,0xa3,0x42,0xa3,0x43,0xa3,0x42,0xc1,0x6,0xf8,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x44,0xa,0xa3,0x45,0xb2,0xc3,0xc4,0xc4,0xc4,0xa3,0x46,0xe0,0x1,0xc7,0x13,0xc6,0x83,0x23,0xc8,0x0,0x0,0xd3,0x0,0x8,0x69,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0xc1,0x6,0xfa,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0xa3,0x49,0xaa,0xc3,0xc4,0xc4,0xc4,0xa3,0x4a,0xc8,0x0,0x0,0x0,0x24,0xc0,0xc0,0xa1,0x2e,0xa1,0x2d,0x22,0x9e,0x67,0x83,0x30,0xc2,0x1,0x56,0xf4,0xc2,0x1,0x56,0xea,0xc2,0x1,0x58,0x0,0xc2,0x1,0x58,0x46,0x27,0xa3,0x4e,0xa3,0x4f,0xa3,0x4e,0xa3,0x50,0xa3,0x51,0xa3,0x51,0xa3,0x50,0xc1,0x6,0xfc,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x52,0xa,0xa3,0x53,0xe5,0x30,0xc3,0xc4,0xa3,0x4d,0x83,0x73,0xa3,0x54,0xe1,0x1,0xc7,0x29,0xc8,0x0,0x0,0xd3,0xd1,0x0,0xf1,0x4,0xa3,0x4c,0xc9,0x1,0x9,0xc8,0x0,0x0,0xcb,0x0,0xc0,0xe0,0x1,0xcd,0x0,0xc6,0x84,0xa,0xc6,0xa1,0x2d,0xd3,0xd3,0xd1,0x1,0xcb,0x1,0x0,0xb,0x5f,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6e,0x65,0x77,0xc2,0x1,0x5a,0x64,0x22,0xa3,0x57,0xa3,0x57,0xc1,0x7,0xc,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x58,0xa,0xa3,0x59,0xb3,0xc3,0x8c,0x12,0xc4,0xc4,0xa3,0x5a,0xe1,0x2,0xc9,0x2,0xd,0xc9,0x1,0x3,0xca,0x0,0xd3,0x0,0x21,0xa2,0x38,0xc2,0x1,0x5a,0x38,0xc2,0x1,0x5a,0x32,0xc2,0x1,0x5a,0x18,0xc2,0x1,0x5a,0xce,0xc2,0x1,0x5a,0xb6,0x28,0xa3,0x5d,0xa3,0x5e,0xa3,0x5f,0xa3,0x5e,0xa3,0x5d,0xa3,0x60,0xa3,0x61,0xa3,0x60,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x62,0xa,0xa3,0x59,0xe5,0x28,0xc3,0xc4,0xa3,0x5c,0x83,0x32,0xa3,0x63,0xf0,0x1,0x83,0x24,0xe1,0x1,0xc7,0x30,0xc9,0x0,0x2,0xd3,0xc6,0x8c,0x11,0xd0,0xa3,0x5b,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x31,0xc9,0x0,0x2,0xcb,0x0,0xd3,0x0,0xc1,0x7,0x10,0x64,0x4,0xc8,0x5,0xc3,0x6,0xc4,0xa,0xa3,0x65,0xaa,0xc3,0xc4,0xc4,0xc4,0xa3,0x66,0xc9,0x0,0x2,0x0,0x4,0x6c,0x6f,0x61,0x64,0x21,0x81,0x46,0x21,0xa3,0x69,0x5,0x73,0x74,0x61,0x72,0x74,0x25,0xa3,0x6b,0x81,0x46,0x83,0x6f,0xa3,0x35,0x83,0x6f,0xc2,0x1,0x55,0xe2,0xc2,0x1,0x55,0xda,0xc2,0x1,0x56,0xe,0xc2,0x1,0x56,0x4,0xc2,0x1,0x56,0x7a,0xc2,0x1,0x56,0x6a,0xc2,0x1,0x59,0x70,0xc2,0x1,0x59,0x5a,0xc2,0x1,0x59,0x9a,0xc2,0x1,0x59,0x88,0xc2,0x1,0x59,0xc8,0xc2,0x1,0x59,0xfa,0xc2,0x1,0x59,0xee,0xc2,0x1,0x5b,0xce,0xe1,0x24,0xa3,0x6d,0xa3,0x6e,0xa3,0x6d,0xa3,0x6f,0xa3,0x70,0xa3,0x6f,0xc0,0xc0,0xa3,0x71,0xa3,0x72,0xa3,0x71,0xc0,0xc0,0xc0,0xc0,0xa3,0x73,0xa3,0x74,0xa3,0x75,0xa3,0x75,0xa3,0x76,0xa3,0x76,0xa3,0x75,0xa3,0x73,0xa3,0x77,0xa3,0x77,0xa3,0x78,0xa3,0x78,0xa3,0x79,0xa3,0x79,0xa3,0x78,0xc0,0xc0,0xc0,0xc0,0xa3,0x7a,0xa3,0x7a,0xc1,0x6,0xf4,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa3,0x7b,0xa,0xa3,0x7c,0xe5,0x81,0x3,0xa3,0x68,0xa3,0x6a,0xa3,0x6c,0x8b,0x5d,0xa3,0x7d,0xe1,0x0,0xc7,0x39,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x3a,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa3,0x47,0xd3,0xe1,0x1,0xc7,0x3b,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa3,0x4b,0xd3,0xc0,0xe3,0x0,0xd0,0xa3,0x55,0xd3,0xd4,0xd1,0x1,0xe1,0x2,0xc7,0x3c,0xcb,0x1,0xe1,0x2,0xc7,0x1c,0xe0,0x1,0xcc,0xc6,0x84,0xa,0xc6,0x88,0x6b,0xd3,0xc6,0x17,0xd3,0xd3,0xd1,0x2,0xe0,0x2,0xcc,0xc6,0xa0,0x61,0xc4,0x2,0xc2,0xd3,0xd1,0x3,0xe1,0x2,0xc7,0x28,0xe0,0x0,0xcb,0x3,0xc6,0x82,0x56,0xd3,0xc4,0x0,0xd3,0xe3,0x0,0xd0,0xa3,0x64,0xd3,0xc0,0xe3,0x0,0xd0,0xa3,0x67,0xd3,0xd4,0xd1,0x4,0xe1,0x1,0xc9,0x0,0xc,0xcb,0x4,0xd3,0x0,0x6,0x5f,0x70,0x61,0x72,0x73,0x65,0x21,0x9e,0x66,0xc2,0x1,0x5c,0x4,0xc2,0x1,0x5b,0xfa,0x23,0xa4,0x1,0xa4,0x2,0xa4,0x1,0xc1,0x7,0x1a,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa4,0x3,0xa,0xa4,0x4,0xb0,0xa3,0x7f,0xa4,0x0,0xc4,0xc4,0xa4,0x5,0xe1,0x1,0xc7,0x29,0xca,0x0,0xd3,0x0,0x7,0x75,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x64,0xa4,0x7,0xc0,0xa1,0x34,0xc0,0xa3,0x68,0xc0,0x9e,0x36,0xc0,0xc2,0x1,0x5c,0x86,0xc2,0x1,0x5c,0x76,0x23,0xa4,0x9,0xa4,0xa,0xa4,0x9,0xc1,0x7,0x1e,0x64,0x4,0xc8,0x5,0xc3,0x6,0xa4,0xb,0xa,0xa4,0xc,0xac,0xc3,0xc4,0xc4,0xc4,0xa4,0xd,0xe1,0x0,0xc7,0x38,0xd3,0x0,0x30,0x46,0x81,0x25,0x81,0x47,0x82,0x57,0x83,0xf,0x83,0x44,0x83,0x6e,0x89,0xe,0x8a,0x59,0xa1,0x34,0xa1,0x56,0xa2,0x30,0xa2,0x72,0xa3,0x34,0xa3,0x68,0xa3,0x7f,0x30,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc0,0x80,0xc1,0x2,0xa4,0xc1,0x2,0xa6,0xc1,0x3,0x36,0xc1,0x5,0xa4,0xc1,0x5,0xa6,0xc1,0x6,0x1c,0xc1,0x6,0x84,0xc1,0x7,0xbc,0xc1,0x7,0xbe,0xc1,0x8,0x36,0xc1,0x8,0x7e,0xc1,0x8,0xc6,0xc1,0x9,0x16,0xc1,0x9,0x78,0xc1,0x9,0xda,0xc1,0xa,0x54,0xc1,0xa,0x56,0xc1,0xa,0xfa,0xc1,0xb,0xb0,0xc1,0xc,0x2c,0xc1,0xc,0x8a,0xc1,0xc,0xea,0xc1,0xd,0x4a,0xc1,0xd,0xaa,0xc1,0xe,0x6e,0xc1,0xf,0x24,0xc1,0xf,0xcc,0xc1,0xf,0xce,0xc1,0xf,0xf8,0xc1,0x10,0x4e,0xc1,0x10,0xa4,0xc1,0x10,0xfa,0xc1,0x11,0x50,0xc1,0x11,0xa6,0xc1,0x11,0xfc,0xc1,0x12,0x52,0xc1,0x12,0xa8,0xc1,0x13,0x34,0xc1,0x13,0x74,0xc1,0x13,0x76,0xc1,0x13,0x98,0xc1,0x13,0xbc,0xc1,0x14,0x0,0xc1,0x14,0x96,0xc1,0x15,0x7a,0xc1,0x16,0x3e,0xc1,0x16,0xf4,0xc1,0x17,0xb8,0xc1,0x18,0xbc,0xc1,0x18,0xde,0xc1,0x18,0xe0,0xc1,0x19,0x6,0xc1,0x19,0x44,0xc1,0x19,0x46,0xc1,0x19,0x72,0xc1,0x19,0x98,0xc1,0x19,0xb8,0xc1,0x1a,0x7e,0xc1,0x1b,0x44,0xc1,0x1c,0xa,0xc1,0x1c,0xd0,0xc1,0x1c,0xd2,0xc1,0x1d,0xe0,0xc1,0x1e,0xee,0xc1,0x1f,0xfc,0xc1,0x21,0xa,0xc1,0x21,0xc,0xc1,0x21,0x38,0xc1,0x21,0xac,0xc1,0x21,0xae,0xc1,0x21,0xd6,0xc1,0x22,0x2,0xc1,0x22,0x76,0xc1,0x22,0xdc,0xc1,0x22,0xde,0xc1,0x23,0x2,0xc1,0x23,0x2a,0xc1,0x23,0x88,0xc1,0x23,0xcc,0xc1,0x23,0xfc,0xc1,0x24,0x66,0xc1,0x24,0xa2,0xc1,0x24,0xca,0xc1,0x24,0xcc,0xc1,0x24,0xee,0xc1,0x25,0x1c,0xc1,0x25,0x58,0xc1,0x25,0x7c,0xc1,0x25,0xd6,0xc1,0x26,0x1a,0xc1,0x26,0x4a,0xc1,0x26,0xb0,0xc1,0x26,0xec,0xc1,0x27,0x14,0xc1,0x27,0x16,0xc1,0x27,0x50,0xc1,0x27,0x7a,0xc1,0x27,0x9a,0xc1,0x27,0xc6,0xc1,0x27,0xda,0xc1,0x28,0x1a,0xc1,0x28,0x5e,0xc1,0x28,0x90,0xc1,0x28,0xb4,0xc1,0x29,0x32,0xc1,0x29,0x80,0xc1,0x29,0xe8,0xc1,0x2a,0x54,0xc1,0x2a,0xa2,0xc1,0x2b,0x16,0xc1,0x2b,0xa6,0xc1,0x2b,0xfa,0xc1,0x2c,0x48,0xc1,0x2c,0xb4,0xc1,0x2d,0x7c,0xc1,0x2d,0xcc,0xc1,0x2e,0x34,0xc1,0x2e,0xa2,0xc1,0x2f,0x10,0xc1,0x2f,0x7e,0xc1,0x2f,0xec,0xc1,0x30,0xae,0xc1,0x31,0xc4,0xc1,0x32,0xda,0xc1,0x33,0x9e,0xc1,0x34,0x62,0xc1,0x34,0xd2,0xc1,0x35,0x96,0xc1,0x36,0x6,0xc1,0x36,0xca,0xc1,0x36,0xcc,0xc1,0x37,0x90,0xc1,0x38,0xa8,0xc1,0x39,0x56,0xc1,0x39,0xc6,0xc1,0x39,0xc8,0xc1,0x3a,0x8e,0xc1,0x3b,0x54,0xc1,0x3c,0x6e,0xc1,0x3d,0x88,0xc1,0x3e,0xa2,0xc1,0x40,0x10,0xc1,0x40,0x12,0xc1,0x41,0x12,0xc1,0x42,0x12,0xc1,0x43,0x12,0xc1,0x44,0x12,0xc1,0x45,0x12,0xc1,0x46,0x6a,0xc1,0x47,0xc2,0xc1,0x49,0x1a,0xc1,0x4a,0x72,0xc1,0x4a,0x74,0xc1,0x4a,0xf4,0xc1,0x4a,0xf6,0xc1,0x4b,0x22,0xc1,0x4b,0x64,0xc1,0x4c,0x5c,0xc1,0x4c,0xa2,0xc1,0x4c,0xc0,0xc1,0x4d,0x78,0xc1,0x4d,0x96,0xc1,0x4d,0xdc,0xc1,0x4e,0x60,0xc1,0x4e,0xa8,0xc1,0x4e,0xaa,0xc1,0x4f,0x66,0xc1,0x4f,0xf6,0xc1,0x4f,0xf8,0xc1,0x50,0x16,0xc1,0x50,0x46,0xc1,0x50,0x76,0xc1,0x50,0xa6,0xc1,0x50,0xd6,0xc1,0x51,0x6,0xc1,0x51,0x8,0xc1,0x51,0x48,0xc1,0x51,0x8a,0xc1,0x51,0x8c,0xc1,0x51,0xca,0xc1,0x52,0xc,0xc1,0x52,0x4a,0xc1,0x52,0x8c,0xc1,0x52,0x8e,0xc1,0x52,0xd0,0xc1,0x53,0x12,0xc1,0x53,0x52,0xc1,0x53,0x94,0xc1,0x53,0xd6,0xc1,0x54,0x18,0xc1,0x54,0x5e,0xc1,0x54,0x60,0xc1,0x54,0xa0,0xc1,0x54,0xe0,0xc1,0x55,0x20,0xc1,0x55,0x60,0xc1,0x55,0xa2,0xc1,0x55,0xe4,0xc1,0x56,0x24,0xc1,0x56,0x66,0xc1,0x56,0x68,0xc1,0x56,0x98,0xc1,0x56,0xcc,0xc1,0x57,0x0,0xc1,0x57,0x28,0xc1,0x57,0x2a,0xc1,0x57,0x4a,0xc1,0x57,0x70,0xc1,0x58,0x3e,0xc1,0x58,0x90,0xc1,0x59,0x2c,0xc1,0x59,0x56,0xc1,0x59,0xc2,0xc1,0x5a,0x22,0xc1,0x5a,0x68,0xc1,0x5a,0xf8,0xc1,0x5a,0xfa,0xc1,0x5b,0x5a,0xc1,0x5b,0x98,0xc1,0x5c,0x1e,0xc1,0x5c,0x7a,0xc1,0x5c,0xf8,0xc1,0x5d,0x24,0xc1,0x5d,0x70,0xc1,0x5d,0xdc,0xc1,0x5e,0x24,0xc1,0x5e,0x66,0xc1,0x5e,0xac,0xc1,0x5f,0x2c,0xc1,0x5f,0x7a,0xc1,0x5f,0xc6,0xc1,0x60,0x44,0xc1,0x60,0x98,0xc1,0x61,0x8,0xc1,0x61,0x3c,0xc1,0x61,0x62,0xc1,0x61,0xb4,0xc1,0x62,0x2a,0xc1,0x62,0x46,0xc1,0x62,0xb0,0xc1,0x62,0xde,0xc1,0x63,0x66,0xc1,0x63,0xa2,0xc1,0x64,0x16,0xc1,0x64,0x66,0xc1,0x64,0xca,0xc1,0x64,0xf6,0xc1,0x65,0x36,0xc1,0x65,0xc2,0xc1,0x66,0x24,0xc1,0x66,0x60,0xc1,0x66,0xe8,0xc1,0x67,0x46,0xc1,0x67,0x8c,0xc1,0x68,0x34,0xc1,0x68,0xc8,0xc1,0x69,0x22,0xc1,0x69,0x6e,0xc1,0x6a,0x1c,0xc1,0x6a,0xb6,0xc1,0x6b,0x16,0xc1,0x6b,0x5a,0xc1,0x6b,0xd4,0xc1,0x6c,0x46,0xc1,0x6c,0xc4,0xc1,0x6d,0x4e,0xc1,0x6d,0x94,0xc1,0x6d,0xec,0xc1,0x6e,0x62,0xc1,0x6e,0xdc,0xc1,0x6f,0x30,0xc1,0x6f,0x58,0xc1,0x6f,0x90,0xc1,0x70,0x24,0xc1,0x70,0xb4,0xc1,0x71,0x62,0xc1,0x72,0x2,0xc1,0x72,0x66,0xc1,0x72,0xcc,0xc1,0x73,0x2e,0xc1,0x73,0x92,0xc1,0x73,0xf8,0xc1,0x74,0x5a,0xc1,0x74,0x92,0xc1,0x75,0x18,0xc1,0x75,0x92,0xc1,0x75,0xd4,0xc1,0x76,0x30,0xc1,0x76,0x3c,0xc1,0x76,0x7a,0xc1,0x76,0xb0,0xc1,0x76,0xe0,0xc1,0x77,0x40,0xc1,0x77,0x7e,0xc1,0x77,0xb6,0xc1,0x77,0xec,0xc1,0x78,0x22,0xc1,0x78,0x54,0xc1,0x78,0x60,0xc1,0x78,0x62,0xc1,0x78,0x88,0xc1,0x78,0xbe,0xc1,0x79,0x22,0xc1,0x79,0x74,0xc1,0x79,0xf0,0xc1,0x79,0xf2,0xc1,0x7a,0x1c,0xc1,0x7a,0x98,0xc1,0x7a,0xee,0xc1,0x7b,0x14,0xc1,0x7b,0x16,0xc1,0x7b,0x64,0xc1,0x7b,0xd0,0xc1,0x7c,0xe,0xc1,0x7c,0x3e,0xc1,0x7c,0x62,0xc1,0x7c,0xe0,0xc1,0x7d,0x26,0xc1,0x7d,0x86,0xc1,0x7d,0xd0,0xc1,0x7e,0x90,0xc1,0x7f,0x2,0xc1,0x7f,0x32,0xc1,0x7f,0xe2,0xc1,0x80,0x26,0xc1,0x80,0xe6,0xc1,0x81,0x58,0xc1,0x81,0x88,0xc1,0x82,0x32,0xc1,0x82,0x76,0xc1,0x83,0x36,0xc1,0x83,0xa8,0xc1,0x83,0xd8,0xc1,0x84,0x82,0xc1,0x84,0x84,0xc1,0x84,0xcc,0xc1,0x85,0x28,0xc1,0x86,0x3a,0xc1,0x86,0x92,0xc1,0x86,0xea,0xc1,0x87,0x38,0xc1,0x87,0x84,0xc1,0x87,0xf4,0xc1,0x88,0x52,0xc1,0x88,0x6e,0xc1,0x89,0x42,0xc1,0x89,0x86,0xc1,0x89,0xdc,0xc1,0x8a,0x70,0xc1,0x8a,0xee,0xc1,0x8b,0x68,0xc1,0x8b,0xd4,0xc1,0x8c,0x2a,0xc1,0x8c,0x7c,0xc1,0x8c,0xc0,0xc1,0x8c,0xfe,0xc1,0x8d,0x40,0xc1,0x8e,0x44,0xc1,0x8e,0x46,0xc1,0x8e,0x86,0xc1,0x8e,0xc6,0xc1,0x8f,0x4,0xc1,0x8f,0x48,0xc1,0x8f,0x4a,0xc1,0x8f,0x88,0xc1,0x8f,0xd2,0xc1,0x90,0x12,0xc1,0x90,0x5e,0xc1,0x90,0x60,0xc1,0x90,0xd2,0xc1,0x91,0x58,0xc1,0x91,0xd4,0xc1,0x92,0x1e,0xc1,0x92,0xc0,0xc1,0x93,0x1a,0xc1,0x93,0x66,0xc1,0x94,0xa0,0xc1,0x95,0x4,0xc1,0x95,0x20,0xc1,0x95,0x22,0xc1,0x95,0x78,0xc1,0x96,0x42,0xc1,0x96,0xd8,0xc1,0x97,0x6e,0xc1,0x98,0x2e,0xc1,0x98,0x8a,0xc1,0x98,0xc4,0xc1,0x99,0x4e,0xc1,0x99,0x9e,0xc1,0x9a,0x2,0xc1,0x9a,0x5c,0xc1,0x9a,0xa8,0xc1,0x9b,0xee,0xc1,0x9c,0x7a,0xc1,0x9c,0xc0,0xc1,0x9d,0x10,0xc1,0x9d,0x74,0xc1,0x9d,0xce,0xc1,0x9e,0x1a,0xc1,0x9f,0x60,0xc1,0xa0,0x28,0xc1,0xa0,0xa8,0xc1,0xa1,0x1c,0xc1,0xa1,0xca,0xc1,0xa2,0x1e,0xc1,0xa2,0x72,0xc1,0xa2,0xd4,0xc1,0xa3,0x88,0xc1,0xa4,0x20,0xc1,0xa4,0x62,0xc1,0xa4,0xc8,0xc1,0xa5,0x26,0xc1,0xa5,0x60,0xc1,0xa6,0x2a,0xc1,0xa6,0xa2,0xc1,0xa7,0x16,0xc1,0xa7,0xa4,0xc1,0xa7,0xf0,0xc1,0xa8,0x8a,0xc1,0xa9,0x16,0xc1,0xa9,0xc0,0xc1,0xaa,0x84,0xc1,0xaa,0xd4,0xc1,0xab,0x6c,0xc1,0xac,0x2,0xc1,0xac,0xaa,0xc1,0xad,0x3a,0xc1,0xae,0x6e,0xc1,0xae,0xa2,0xc1,0xae,0xa4,0xc1,0xaf,0x16,0xc1,0xaf,0x56,0xc1,0xaf,0xe0,0xc1,0xb0,0x0,0xc1,0xb0,0x6c,0xc1,0xb0,0xd6,0xc1,0xb1,0x3a,0xc1,0xb1,0xa2,0xc1,0xb2,0xa,0xc1,0xb2,0x82,0xc1,0xb2,0x8a,0xc1,0xb2,0xd8,0xc1,0xb3,0xa4,0xc1,0xb4,0x56,0xc1,0xb4,0xc6,0xc1,0xb4,0xc8,0xc1,0xb5,0x14,0xc1,0xb5,0x64,0xc1,0xb5,0xf6,0xc1,0xb6,0x2c,0xc1,0xb6,0xa0,0xc1,0xb7,0x16,0xc1,0xb7,0x40,0xc1,0xb7,0x42,0xc1,0xb7,0xda,0xc1,0xb8,0x42,0xc1,0xb8,0x44,0xc1,0xb8,0xac,0xc1,0xb9,0x24,0xc1,0xb9,0x26,0xc1,0xb9,0xb0,0xc1,0xba,0x4a,0xc1,0xba,0x4c,0xc1,0xbb,0xe,0xc1,0xbb,0xcc,0xc1,0xbc,0x3c,0xc1,0xbc,0x96,0xc1,0xbc,0xce,0xc1,0xbd,0x32,0xc1,0xbd,0xc4,0xc1,0xbd,0xf4,0xc1,0xbe,0x2c,0xc1,0xbe,0x4a,0xc1,0xbe,0x90,0xc1,0xbe,0xe2,0xc1,0xbf,0x76,0xc1,0xbf,0xe8,0xc1,0xc0,0x2e,0xc1,0xc0,0xaa,0xc1,0xc1,0x66,0xc1,0xc1,0xe8,0xc1,0xc2,0x8c,0xc1,0xc2,0xe2,0xc1,0xc3,0x36,0xc1,0xc3,0x94,0xc1,0xc4,0x2e,0xc1,0xc4,0xfc,0xc1,0xc5,0x4e,0xc1,0xc5,0xb6,0xc1,0xc6,0x14,0xc1,0xc6,0x86,0xc1,0xc7,0x42,0xc1,0xc7,0x92,0xc1,0xc8,0x1c,0xc1,0xc8,0x72,0xc1,0xc8,0xc6,0xc1,0xc9,0x16,0xc1,0xc9,0x86,0xc1,0xc9,0xd4,0xc1,0xca,0x58,0xc1,0xca,0x9e,0xc1,0xca,0xfc,0xc1,0xcb,0x4e,0xc1,0xcb,0xc4,0xc1,0xcc,0x34,0xc1,0xcc,0x82,0xc1,0xcc,0xde,0xc1,0xcd,0x1c,0xc1,0xcd,0x6e,0xc1,0xcd,0xfc,0xc1,0xce,0x4e,0xc1,0xce,0xb8,0xc1,0xcf,0x4e,0xc1,0xcf,0x6a,0xc1,0xcf,0xbc,0xc1,0xd0,0x2,0xc1,0xd0,0x5e,0xc1,0xd0,0xba,0xc1,0xd1,0xc,0xc1,0xd1,0x72,0xc1,0xd1,0xe4,0xc1,0xd2,0x54,0xc1,0xd3,0xe,0xc1,0xd3,0xb2,0xc1,0xd3,0xce,0xc1,0xd4,0x3e,0xc1,0xd4,0x80,0xc1,0xd4,0xda,0xc1,0xd5,0x4a,0xc1,0xd5,0xd0,0xc1,0xd6,0x46,0xc1,0xd6,0x98,0xc1,0xd7,0x1a,0xc1,0xd7,0x9e,0xc1,0xd8,0x7c,0xc1,0xd9,0x4,0xc1,0xd9,0x8a,0xc1,0xda,0x26,0xc1,0xda,0xf0,0xc1,0xdb,0x72,0xc1,0xdb,0xf8,0xc1,0xdc,0xae,0xc1,0xdd,0x24,0xc1,0xde,0x3a,0xc1,0xdf,0x4,0xc1,0xdf,0xcc,0xc1,0xe0,0x6e,0xc1,0xe0,0xee,0xc1,0xe1,0x48,0xc1,0xe1,0xb8,0xc1,0xe2,0x3e,0xc1,0xe2,0xb4,0xc1,0xe3,0x6,0xc1,0xe3,0xb4,0xc1,0xe3,0xf8,0xc1,0xe4,0x50,0xc1,0xe4,0xaa,0xc1,0xe5,0x3c,0xc1,0xe5,0xd0,0xc1,0xe6,0x4c,0xc1,0xe6,0x8c,0xc1,0xe6,0xda,0xc1,0xe7,0x36,0xc1,0xe7,0x72,0xc1,0xe7,0xc0,0xc1,0xe8,0x18,0xc1,0xe8,0x54,0xc1,0xe8,0xa2,0xc1,0xe8,0xfa,0xc1,0xe9,0x3a,0xc1,0xe9,0x88,0xc1,0xe9,0xd6,0xc1,0xea,0x52,0xc1,0xea,0x92,0xc1,0xea,0xfe,0xc1,0xeb,0x44,0xc1,0xeb,0x94,0xc1,0xeb,0xe2,0xc1,0xec,0x3c,0xc1,0xec,0xb6,0xc1,0xed,0x8,0xc1,0xed,0x6c,0xc1,0xee,0x40,0xc1,0xee,0x8a,0xc1,0xee,0xd4,0xc1,0xef,0x4a,0xc1,0xef,0xb0,0xc1,0xf0,0x16,0xc1,0xf0,0x9e,0xc1,0xf0,0xf0,0xc1,0xf1,0x62,0xc1,0xf1,0xbc,0xc1,0xf1,0xfe,0xc1,0xf2,0x84,0xc1,0xf2,0xe2,0xc1,0xf3,0x54,0xc1,0xf3,0x90,0xc1,0xf3,0xca,0xc1,0xf4,0x24,0xc1,0xf4,0x5e,0xc1,0xf4,0xae,0xc1,0xf5,0x26,0xc1,0xf5,0x60,0xc1,0xf5,0xba,0xc1,0xf6,0x16,0xc1,0xf6,0x96,0xc1,0xf6,0xc2,0xc1,0xf7,0x5e,0xc1,0xf7,0xc6,0xc1,0xf8,0xc,0xc1,0xf8,0x60,0xc1,0xf8,0xd4,0xc1,0xf9,0x84,0xc1,0xfa,0x20,0xc1,0xfa,0x8c,0xc1,0xfa,0xcc,0xc1,0xfa,0xe8,0xc1,0xfb,0x34,0xc1,0xfb,0x4e,0xc1,0xfb,0x82,0xc1,0xfb,0xbc,0xc1,0xfc,0x18,0xc1,0xfc,0x1a,0xc1,0xfc,0x40,0xc1,0xfc,0x96,0xc1,0xfc,0xea,0xc1,0xfd,0x40,0xc1,0xfd,0x94,0xc1,0xfd,0xcc,0xc1,0xfe,0x28,0xc1,0xfe,0x84,0xc1,0xfe,0xe0,0xc1,0xff,0x3a,0xc1,0xff,0xac,0xc2,0x1,0x0,0x1e,0xc2,0x1,0x0,0x98,0xc2,0x1,0x1,0xe,0xc2,0x1,0x1,0xb2,0xc2,0x1,0x1,0xfc,0xc2,0x1,0x2,0xe0,0xc2,0x1,0x3,0x9a,0xc2,0x1,0x3,0xea,0xc2,0x1,0x4,0x2c,0xc2,0x1,0x4,0x7e,0xc2,0x1,0x4,0xfa,0xc2,0x1,0x5,0x94,0xc2,0x1,0x6,0x18,0xc2,0x1,0x6,0x44,0xc2,0x1,0x6,0xc2,0xc2,0x1,0x6,0xf2,0xc2,0x1,0x7,0x36,0xc2,0x1,0x7,0xda,0xc2,0x1,0x8,0x1c,0xc2,0x1,0x8,0x6a,0xc2,0x1,0x8,0xe0,0xc2,0x1,0x9,0x16,0xc2,0x1,0x9,0x76,0xc2,0x1,0x9,0xda,0xc2,0x1,0xa,0xae,0xc2,0x1,0xb,0xe,0xc2,0x1,0xb,0xec,0xc2,0x1,0xc,0x90,0xc2,0x1,0xd,0x10,0xc2,0x1,0xd,0x5e,0xc2,0x1,0xd,0xd4,0xc2,0x1,0xe,0x46,0xc2,0x1,0xe,0x7c,0xc2,0x1,0xe,0xdc,0xc2,0x1,0xf,0x40,0xc2,0x1,0x10,0x48,0xc2,0x1,0x10,0xa8,0xc2,0x1,0x11,0xba,0xc2,0x1,0x12,0x92,0xc2,0x1,0x12,0xd6,0xc2,0x1,0x13,0x1c,0xc2,0x1,0x13,0xd8,0xc2,0x1,0x14,0x18,0xc2,0x1,0x14,0x5a,0xc2,0x1,0x15,0x8,0xc2,0x1,0x15,0x44,0xc2,0x1,0x15,0x86,0xc2,0x1,0x16,0x36,0xc2,0x1,0x16,0x72,0xc2,0x1,0x16,0xb4,0xc2,0x1,0x17,0x62,0xc2,0x1,0x17,0xa2,0xc2,0x1,0x17,0xe4,0xc2,0x1,0x18,0x26,0xc2,0x1,0x18,0xf2,0xc2,0x1,0x19,0x38,0xc2,0x1,0x19,0x80,0xc2,0x1,0x1a,0x3c,0xc2,0x1,0x1a,0x7e,0xc2,0x1,0x1a,0xc4,0xc2,0x1,0x1b,0x24,0xc2,0x1,0x1b,0x86,0xc2,0x1,0x1b,0xf6,0xc2,0x1,0x1c,0x3c,0xc2,0x1,0x1c,0xb8,0xc2,0x1,0x1d,0x30,0xc2,0x1,0x1d,0xc0,0xc2,0x1,0x1e,0x46,0xc2,0x1,0x1e,0x9e,0xc2,0x1,0x1f,0x16,0xc2,0x1,0x1f,0x6e,0xc2,0x1,0x1f,0xe6,0xc2,0x1,0x20,0x28,0xc2,0x1,0x20,0x9e,0xc2,0x1,0x21,0x7c,0xc2,0x1,0x21,0xc2,0xc2,0x1,0x22,0x48,0xc2,0x1,0x23,0x60,0xc2,0x1,0x23,0xa0,0xc2,0x1,0x24,0x26,0xc2,0x1,0x25,0x38,0xc2,0x1,0x25,0x7c,0xc2,0x1,0x26,0x72,0xc2,0x1,0x26,0x8c,0xc2,0x1,0x26,0xc0,0xc2,0x1,0x26,0xfa,0xc2,0x1,0x27,0x72,0xc2,0x1,0x27,0x74,0xc2,0x1,0x27,0xa8,0xc2,0x1,0x28,0x16,0xc2,0x1,0x28,0xe2,0xc2,0x1,0x28,0xe4,0xc2,0x1,0x29,0x34,0xc2,0x1,0x29,0x6a,0xc2,0x1,0x29,0xb0,0xc2,0x1,0x2a,0x14,0xc2,0x1,0x2a,0xc2,0xc2,0x1,0x2b,0x32,0xc2,0x1,0x2b,0xa2,0xc2,0x1,0x2c,0x12,0xc2,0x1,0x2c,0x88,0xc2,0x1,0x2c,0xcc,0xc2,0x1,0x2d,0x68,0xc2,0x1,0x2d,0xb4,0xc2,0x1,0x2d,0xf2,0xc2,0x1,0x2d,0xf4,0xc2,0x1,0x2e,0x70,0xc2,0x1,0x2e,0x8c,0xc2,0x1,0x2e,0xb4,0xc2,0x1,0x2e,0xe8,0xc2,0x1,0x2f,0x4,0xc2,0x1,0x2f,0x5a,0xc2,0x1,0x2f,0x8a,0xc2,0x1,0x2f,0xd4,0xc2,0x1,0x30,0x0,0xc2,0x1,0x30,0x46,0xc2,0x1,0x30,0x70,0xc2,0x1,0x30,0x7c,0xc2,0x1,0x30,0x7e,0xc2,0x1,0x30,0xb0,0xc2,0x1,0x30,0xda,0xc2,0x1,0x31,0x16,0xc2,0x1,0x31,0x4c,0xc2,0x1,0x31,0x96,0xc2,0x1,0x31,0xf8,0xc2,0x1,0x32,0x52,0xc2,0x1,0x32,0x92,0xc2,0x1,0x32,0x94,0xc2,0x1,0x32,0xd6,0xc2,0x1,0x33,0x12,0xc2,0x1,0x33,0x46,0xc2,0x1,0x33,0x86,0xc2,0x1,0x33,0xbe,0xc2,0x1,0x34,0x4,0xc2,0x1,0x34,0x44,0xc2,0x1,0x34,0x78,0xc2,0x1,0x34,0xaa,0xc2,0x1,0x34,0xf6,0xc2,0x1,0x35,0x3c,0xc2,0x1,0x35,0x84,0xc2,0x1,0x35,0xc2,0xc2,0x1,0x36,0x52,0xc2,0x1,0x37,0x2a,0xc2,0x1,0x37,0x90,0xc2,0x1,0x37,0xf4,0xc2,0x1,0x38,0x5a,0xc2,0x1,0x39,0x8,0xc2,0x1,0x39,0x58,0xc2,0x1,0x39,0xa6,0xc2,0x1,0x3a,0xa,0xc2,0x1,0x3a,0x36,0xc2,0x1,0x3a,0x74,0xc2,0x1,0x3a,0xc2,0xc2,0x1,0x3b,0x0,0xc2,0x1,0x3b,0x3e,0xc2,0x1,0x3b,0x92,0xc2,0x1,0x3b,0xfc,0xc2,0x1,0x3c,0x86,0xc2,0x1,0x3c,0xcc,0xc2,0x1,0x3d,0x50,0xc2,0x1,0x3d,0xfc,0xc2,0x1,0x3e,0x4c,0xc2,0x1,0x3e,0x9c,0xc2,0x1,0x3f,0x6,0xc2,0x1,0x3f,0x2e,0xc2,0x1,0x3f,0x6a,0xc2,0x1,0x40,0x74,0xc2,0x1,0x40,0x9c,0xc2,0x1,0x40,0xd6,0xc2,0x1,0x41,0x12,0xc2,0x1,0x41,0x7e,0xc2,0x1,0x41,0xe6,0xc2,0x1,0x42,0x64,0xc2,0x1,0x42,0xc8,0xc2,0x1,0x42,0xf6,0xc2,0x1,0x43,0x2,0xc2,0x1,0x43,0x4,0xc2,0x1,0x43,0x4c,0xc2,0x1,0x43,0x96,0xc2,0x1,0x43,0xdc,0xc2,0x1,0x44,0x20,0xc2,0x1,0x44,0x5e,0xc2,0x1,0x44,0x98,0xc2,0x1,0x44,0x9a,0xc2,0x1,0x44,0xec,0xc2,0x1,0x46,0x2,0xc2,0x1,0x46,0x30,0xc2,0x1,0x46,0x32,0xc2,0x1,0x46,0xa6,0xc2,0x1,0x46,0xf6,0xc2,0x1,0x47,0x3a,0xc2,0x1,0x47,0x62,0xc2,0x1,0x47,0x66,0xc2,0x1,0x47,0x68,0xc2,0x1,0x47,0xa8,0xc2,0x1,0x47,0xe2,0xc2,0x1,0x48,0x10,0xc2,0x1,0x48,0x88,0xc2,0x1,0x48,0xf4,0xc2,0x1,0x49,0x2e,0xc2,0x1,0x49,0x88,0xc2,0x1,0x49,0x8a,0xc2,0x1,0x49,0xd4,0xc2,0x1,0x49,0xe8,0xc2,0x1,0x4a,0x44,0xc2,0x1,0x4a,0x86,0xc2,0x1,0x4a,0xc4,0xc2,0x1,0x4b,0x16,0xc2,0x1,0x4b,0x4c,0xc2,0x1,0x4b,0xb4,0xc2,0x1,0x4b,0xee,0xc2,0x1,0x4c,0x5a,0xc2,0x1,0x4c,0xb0,0xc2,0x1,0x4d,0x28,0xc2,0x1,0x4d,0x78,0xc2,0x1,0x4d,0xac,0xc2,0x1,0x4d,0xfc,0xc2,0x1,0x4e,0x32,0xc2,0x1,0x4e,0x8e,0xc2,0x1,0x4e,0xca,0xc2,0x1,0x4e,0xee,0xc2,0x1,0x4e,0xf0,0xc2,0x1,0x4f,0x10,0xc2,0x1,0x4f,0x58,0xc2,0x1,0x4f,0xba,0xc2,0x1,0x4f,0xe6,0xc2,0x1,0x50,0x44,0xc2,0x1,0x50,0x86,0xc2,0x1,0x50,0xde,0xc2,0x1,0x51,0x28,0xc2,0x1,0x51,0x70,0xc2,0x1,0x51,0xa8,0xc2,0x1,0x51,0xec,0xc2,0x1,0x52,0x44,0xc2,0x1,0x52,0xac,0xc2,0x1,0x52,0xb8,0xc2,0x1,0x52,0xba,0xc2,0x1,0x52,0xee,0xc2,0x1,0x53,0x1a,0xc2,0x1,0x53,0xb8,0xc2,0x1,0x54,0x5c,0xc2,0x1,0x54,0xe8,0xc2,0x1,0x55,0x74,0xc2,0x1,0x55,0xa0,0xc2,0x1,0x55,0xa2,0xc2,0x1,0x55,0xc2,0xc2,0x1,0x55,0xe8,0xc2,0x1,0x56,0x4e,0xc2,0x1,0x56,0x9c,0xc2,0x1,0x57,0x4,0xc2,0x1,0x57,0xa4,0xc2,0x1,0x58,0x5a,0xc2,0x1,0x59,0x0,0xc2,0x1,0x59,0x4a,0xc2,0x1,0x59,0xa8,0xc2,0x1,0x59,0xaa,0xc2,0x1,0x59,0xd2,0xc2,0x1,0x5a,0x80,0xc2,0x1,0x5a,0xe4,0xc2,0x1,0x5b,0x1e,0xc2,0x1,0x5b,0x20,0xc2,0x1,0x5b,0xba,0xc2,0x1,0x5b,0xd6,0xc2,0x1,0x5b,0xd8,0xc2,0x1,0x5c,0x12,0xc2,0x1,0x5c,0x14,0xc2,0x1,0x5c,0x90,0xc2,0x1,0x5c,0x92,0xe1,0x87,0x11,0xd9,0xa4,0x11,0x84,0xc,0x86,0x51,0x8e,0x37,0xa4,0x12,0xa4,0x13,0xa4,0x14,0x93,0x9,0x95,0x2,0x97,0x8,0x9a,0xb,0xa4,0x15,0xa4,0x16,0xa4,0x17,0xa4,0x18,0xa3,0x11,0xa4,0x19,0xa4,0x1a,0xa4,0x1b,0xa4,0x1c,0xa4,0x1d,0xa4,0x1e,0xa4,0x1f,0xa4,0x20,0xa4,0x21,0xa4,0x22,0xa4,0x23,0xa4,0x24,0xa4,0x25,0xa4,0x26,0xa4,0x27,0xa4,0x28,0xa4,0x29,0xa4,0x2a,0xa4,0x2b,0xa4,0x2c,0xa4,0x2d,0xa4,0x2e,0xa4,0x2f,0xa4,0x30,0xa4,0x31,0xa4,0x32,0xa4,0x33,0xa4,0x34,0xa4,0x35,0xa4,0x36,0xa4,0x37,0xa4,0x38,0xa4,0x39,0xa4,0x3a,0xa4,0x3b,0xa4,0x3c,0xa4,0x3d,0xa4,0x3e,0xa4,0x3f,0xa4,0x40,0xa4,0x41,0xa4,0x42,0xa4,0x43,0xa4,0x44,0xa4,0x45,0xa4,0x46,0xa4,0x47,0xa4,0x48,0xa4,0x49,0xa4,0x4a,0xa4,0x4b,0xa4,0x4c,0xa4,0x4d,0xa4,0x4e,0xa4,0x4f,0xa4,0x50,0xa4,0x51,0xa4,0x52,0xa4,0x53,0xa4,0x54,0xa4,0x55,0xa4,0x56,0xa4,0x57,0xa4,0x58,0xa4,0x59,0xa4,0x5a,0xa4,0x5b,0xa4,0x5c,0xa4,0x5d,0xa4,0x5e,0xa4,0x5f,0xa4,0x60,0xa4,0x61,0xa4,0x62,0xa4,0x63,0xa4,0x64,0xa4,0x65,0xa4,0x66,0xa4,0x67,0xa4,0x68,0xa4,0x69,0xa4,0x6a,0xa4,0x6b,0xa4,0x6c,0xa4,0x6d,0xa4,0x6e,0xa4,0x6f,0xa4,0x70,0xa4,0x71,0xa4,0x72,0xa4,0x73,0xa4,0x74,0xa4,0x75,0xa4,0x76,0xa4,0x77,0xa4,0x78,0xa4,0x79,0xa4,0x7a,0xa4,0x7b,0xa4,0x7c,0xa4,0x7d,0xa4,0x7e,0xa4,0x7f,0xa5,0x0,0xa5,0x1,0xa5,0x2,0xa5,0x3,0xa5,0x4,0xa5,0x5,0xa5,0x6,0xa5,0x7,0xa5,0x8,0xa5,0x9,0xa5,0xa,0xa5,0xb,0xa5,0xc,0xa5,0xd,0xa5,0xe,0xa5,0xf,0xa5,0x10,0xa5,0x11,0xa5,0x12,0xa5,0x13,0xa5,0x14,0xa5,0x15,0xa5,0x16,0xa5,0x17,0xa5,0x18,0xa5,0x19,0xa5,0x1a,0xa5,0x1b,0xa5,0x1c,0xa5,0x1d,0xa5,0x1e,0xa5,0x1f,0xa5,0x20,0xa5,0x21,0xa5,0x22,0xa5,0x23,0xa5,0x24,0xa5,0x25,0xa5,0x26,0xa5,0x27,0xa5,0x28,0xa5,0x29,0xa5,0x2a,0xa5,0x2b,0xa5,0x2c,0xa5,0x2d,0xa5,0x2e,0xa5,0x2f,0xa5,0x30,0xa5,0x31,0xa5,0x32,0xa5,0x33,0xa5,0x34,0xa5,0x35,0xa5,0x36,0xa5,0x37,0xa5,0x38,0xa5,0x39,0xa5,0x3a,0xa5,0x3b,0xa5,0x3c,0xa5,0x3d,0xa5,0x3e,0xa5,0x3f,0xa5,0x40,0xa5,0x41,0xa5,0x42,0xa5,0x43,0xa5,0x44,0xa5,0x45,0xa5,0x46,0xa5,0x47,0xa5,0x48,0xa5,0x49,0xa5,0x4a,0xa5,0x4b,0xa5,0x4c,0xa5,0x4d,0xa5,0x4e,0xa5,0x4f,0xa5,0x50,0xa5,0x51,0xa5,0x52,0xa5,0x53,0xa5,0x54,0xa5,0x55,0xa5,0x56,0xa5,0x57,0xa5,0x58,0xa5,0x59,0xa5,0x5a,0xa5,0x5b,0xa5,0x5c,0xa5,0x5d,0xa5,0x5e,0xa5,0x5f,0xa5,0x60,0xa5,0x61,0xa5,0x62,0xa5,0x63,0xa5,0x64,0xa5,0x65,0xa5,0x66,0xa5,0x67,0xa5,0x68,0xa5,0x69,0xa5,0x6a,0xa5,0x6b,0xa5,0x6c,0xa5,0x6d,0xa5,0x6e,0xa5,0x6f,0xa5,0x70,0xa5,0x71,0xa5,0x72,0xa5,0x73,0xa5,0x74,0xa5,0x75,0xa5,0x76,0xa5,0x77,0xa5,0x78,0xa5,0x79,0xa5,0x7a,0xa5,0x7b,0xa5,0x7c,0xa5,0x7d,0xa5,0x7e,0xa5,0x7f,0xa6,0x0,0xa6,0x1,0xa6,0x2,0xa6,0x3,0xa6,0x4,0xa6,0x5,0xa6,0x6,0xa6,0x7,0xa6,0x8,0xa6,0x9,0xa6,0xa,0xa6,0xb,0xa6,0xc,0xa6,0xd,0xa6,0xe,0xa6,0xf,0xa6,0x10,0xa6,0x11,0xa6,0x12,0xa6,0x13,0xa6,0x14,0xa6,0x15,0xa6,0x16,0xa6,0x17,0xa6,0x18,0xa6,0x19,0xa6,0x1a,0xa6,0x1b,0xa6,0x1c,0xa6,0x1d,0xa6,0x1e,0xa6,0x1f,0xa6,0x20,0xa6,0x21,0xa6,0x22,0xa6,0x23,0xa6,0x24,0xa6,0x25,0xa6,0x26,0xa6,0x27,0xa6,0x28,0xa6,0x29,0xa6,0x2a,0xa6,0x2b,0xa6,0x2c,0xa6,0x2d,0xa6,0x2e,0xa6,0x2f,0xa6,0x30,0xa6,0x31,0xa6,0x32,0xa6,0x33,0xa6,0x34,0xa6,0x35,0xa6,0x36,0xa6,0x37,0xa6,0x38,0xa6,0x39,0xa6,0x3a,0xa6,0x3b,0xa6,0x3c,0xa6,0x3d,0xa6,0x3e,0xa6,0x3f,0xa6,0x40,0xa6,0x41,0xa6,0x42,0xa6,0x43,0xa6,0x44,0xa6,0x45,0xa6,0x46,0xa6,0x47,0xa6,0x48,0xa6,0x49,0xa6,0x4a,0xa6,0x4b,0xa6,0x4c,0xa6,0x4d,0xa6,0x4e,0xa6,0x4f,0xa6,0x50,0xa6,0x51,0xa6,0x52,0xa6,0x53,0xa6,0x54,0xa6,0x55,0xa6,0x56,0xa6,0x57,0xa6,0x58,0xa6,0x59,0xa6,0x5a,0xa6,0x5b,0xa6,0x5c,0xa6,0x5d,0xa6,0x5e,0xa6,0x5f,0xa6,0x60,0xa6,0x61,0xa6,0x62,0xa6,0x63,0xa6,0x64,0xa6,0x65,0xa6,0x66,0xa6,0x67,0xa6,0x68,0xa6,0x69,0xa6,0x6a,0xa6,0x6b,0xa6,0x6c,0xa6,0x6d,0xa6,0x6e,0xa6,0x6f,0xa6,0x70,0xa6,0x71,0xa6,0x72,0xa6,0x73,0xa6,0x74,0xa6,0x75,0xa6,0x76,0xa6,0x77,0xa6,0x78,0xa6,0x79,0xa6,0x7a,0xa6,0x7b,0xa6,0x7c,0xa6,0x7d,0xa6,0x7e,0xa6,0x7f,0xa7,0x0,0xa7,0x1,0xa7,0x2,0xa7,0x3,0xa7,0x4,0xa7,0x5,0xa7,0x6,0xa7,0x7,0xa7,0x8,0xa7,0x9,0xa7,0xa,0xa7,0xb,0xa7,0xc,0xa7,0xd,0xa7,0xe,0xa7,0xf,0xa7,0x10,0xa7,0x11,0xa7,0x12,0xa7,0x13,0xa7,0x14,0xa7,0x15,0xa7,0x16,0xa7,0x17,0xa7,0x18,0xa7,0x19,0xa7,0x1a,0xa7,0x1b,0xa7,0x1c,0xa7,0x1d,0xa7,0x1e,0xa7,0x1f,0xa7,0x20,0xa7,0x21,0xa7,0x22,0xa7,0x23,0xa7,0x24,0xa7,0x25,0xa7,0x26,0xa7,0x27,0xa7,0x28,0xa7,0x29,0xa7,0x2a,0xa7,0x2b,0xa7,0x2c,0xa7,0x2d,0xa7,0x2e,0xa7,0x2f,0xa7,0x30,0xa7,0x31,0xa7,0x32,0xa7,0x33,0xa7,0x34,0xa7,0x35,0xa7,0x36,0xa7,0x37,0xa7,0x38,0xa7,0x39,0xa7,0x3a,0xa7,0x3b,0xa7,0x3c,0xa7,0x3d,0xa7,0x3e,0xa7,0x3f,0xa7,0x40,0xa7,0x41,0xa7,0x42,0xa7,0x43,0xa7,0x44,0xa7,0x45,0xa7,0x46,0xa7,0x47,0xa7,0x48,0xa7,0x49,0xa7,0x4a,0xa7,0x4b,0xa7,0x4c,0xa7,0x4d,0xa7,0x4e,0xa7,0x4f,0xa7,0x50,0xa7,0x51,0xa7,0x52,0xa7,0x53,0xa7,0x54,0xa7,0x55,0xa7,0x56,0xa7,0x57,0xa7,0x58,0xa7,0x59,0xa7,0x5a,0xa7,0x5b,0xa7,0x5c,0xa7,0x5d,0xa7,0x5e,0xa7,0x5f,0xa7,0x60,0xa7,0x61,0xa7,0x62,0xa7,0x63,0xa7,0x64,0xa7,0x65,0xa7,0x66,0xa7,0x67,0xa7,0x68,0xa7,0x69,0xa7,0x6a,0xa7,0x6b,0xa7,0x6c,0xa7,0x6d,0xa7,0x6e,0xa7,0x6f,0xa7,0x70,0xa7,0x71,0xa7,0x72,0xa7,0x73,0xa7,0x74,0xa7,0x75,0xa7,0x76,0xa7,0x77,0xa7,0x78,0xa7,0x79,0xa7,0x7a,0xa7,0x7b,0xa7,0x7c,0xa7,0x7d,0xa7,0x7e,0xa7,0x7f,0xa8,0x0,0xa8,0x1,0xa8,0x2,0xa8,0x3,0xa8,0x4,0xa8,0x5,0xa8,0x6,0xa8,0x7,0xa8,0x8,0xa8,0x9,0xa8,0xa,0xa8,0xb,0xa8,0xc,0xa8,0xd,0xa8,0xe,0xa8,0xf,0xa8,0x10,0xa8,0x11,0xa8,0x12,0xa8,0x13,0xa8,0x14,0xa8,0x15,0xa8,0x16,0xa8,0x17,0xa8,0x18,0xa8,0x19,0xa8,0x1a,0xa8,0x1b,0xa8,0x1c,0xa8,0x1d,0xa8,0x1e,0xa8,0x1f,0xa8,0x20,0xa8,0x21,0xa8,0x22,0xa8,0x23,0xa8,0x24,0xa8,0x25,0xa8,0x26,0xa8,0x27,0xa8,0x28,0xa8,0x29,0xa8,0x2a,0xa8,0x2b,0xa8,0x2c,0xa8,0x2d,0xa8,0x2e,0xa8,0x2f,0xa8,0x30,0xa8,0x31,0xa8,0x32,0xa8,0x33,0xa8,0x34,0xa8,0x35,0xa8,0x36,0xa8,0x37,0xa8,0x38,0xa8,0x39,0xa8,0x3a,0xa8,0x3b,0xa8,0x3c,0xa8,0x3d,0xa8,0x3e,0xa8,0x3f,0xa8,0x40,0xa8,0x41,0xa8,0x42,0xa8,0x43,0xa8,0x44,0xa8,0x45,0xa8,0x46,0xa8,0x47,0xa8,0x48,0xa8,0x49,0xa8,0x4a,0xa8,0x4b,0xa8,0x4c,0xa8,0x4d,0xa8,0x4e,0xa8,0x4f,0xa8,0x50,0xa8,0x51,0xa8,0x52,0xa8,0x53,0xa8,0x54,0xa8,0x55,0xa8,0x56,0xa8,0x57,0xa8,0x58,0xa8,0x59,0xa8,0x5a,0xa8,0x5b,0xa8,0x5c,0xa8,0x5d,0xa8,0x5e,0xa8,0x5f,0xa8,0x60,0xa8,0x61,0xa8,0x62,0xa8,0x63,0xa8,0x64,0xa8,0x65,0xa8,0x66,0xa8,0x67,0xa8,0x68,0xa8,0x69,0xa8,0x6a,0xa8,0x6b,0xa8,0x6c,0xa8,0x6d,0xa8,0x6e,0xa8,0x6f,0xa8,0x70,0xa8,0x71,0xa8,0x72,0xa8,0x73,0xa8,0x74,0xa8,0x75,0xa8,0x76,0xa8,0x77,0xa8,0x78,0xa8,0x79,0xa8,0x7a,0xa8,0x7b,0xa8,0x7c,0xa8,0x7d,0xa8,0x7e,0xa8,0x7f,0xa9,0x0,0xa9,0x1,0xa9,0x2,0xa9,0x3,0xa9,0x4,0xa9,0x5,0xa9,0x6,0xa9,0x7,0xa9,0x8,0xa9,0x9,0xa9,0xa,0xa9,0xb,0xa9,0xc,0xa9,0xd,0xa9,0xe,0xa9,0xf,0xa9,0x10,0xa9,0x11,0xa9,0x12,0xa9,0x13,0xa9,0x14,0xa9,0x15,0xa9,0x16,0xa9,0x17,0xa9,0x18,0xa9,0x19,0xa9,0x1a,0xa9,0x1b,0xa9,0x1c,0xa9,0x1d,0xa9,0x1e,0xa9,0x1f,0xa9,0x20,0xa9,0x21,0xa9,0x22,0xa9,0x23,0xa9,0x24,0xa9,0x25,0xa9,0x26,0xa9,0x27,0xa9,0x28,0xa9,0x29,0xa9,0x2a,0xa9,0x2b,0xa9,0x2c,0xa9,0x2d,0xa9,0x2e,0xa9,0x2f,0xa9,0x30,0xa9,0x31,0xa9,0x32,0xa9,0x33,0xa9,0x34,0xa9,0x35,0xa9,0x36,0xa9,0x37,0xa9,0x38,0xa9,0x39,0xa9,0x3a,0xa9,0x3b,0xa9,0x3c,0xa9,0x3d,0xa9,0x3e,0xa9,0x3f,0xa9,0x40,0xa9,0x41,0xa9,0x42,0xa9,0x43,0xa9,0x44,0xa9,0x45,0xa9,0x46,0xa9,0x47,0xa9,0x48,0xa9,0x49,0xa9,0x4a,0xa9,0x4b,0xa9,0x4c,0xa9,0x4d,0xa9,0x4e,0xa9,0x4f,0xa9,0x50,0xa9,0x51,0xa9,0x52,0xa9,0x53,0xa9,0x54,0xa9,0x55,0xa9,0x56,0xa9,0x57,0xa9,0x58,0xa9,0x59,0xa9,0x5a,0xa9,0x5b,0xa9,0x5c,0xa9,0x5d,0xa9,0x5e,0xa9,0x5f,0xa9,0x60,0xa9,0x61,0xa9,0x62,0xa9,0x63,0xa9,0x64,0xa9,0x65,0xa9,0x66,0xa9,0x67,0xa9,0x68,0xa9,0x69,0xa9,0x6a,0xa9,0x6b,0xa9,0x6c,0xa9,0x6d,0xa9,0x6e,0xa9,0x6f,0xa9,0x70,0xa9,0x71,0xa9,0x72,0xa9,0x73,0xa9,0x74,0xa9,0x75,0xa9,0x76,0xa9,0x77,0xa9,0x78,0xa9,0x79,0xa9,0x7a,0xa9,0x7b,0xa9,0x7c,0xa9,0x7d,0xa9,0x7e,0xa9,0x7f,0xaa,0x0,0xaa,0x1,0xaa,0x2,0xaa,0x3,0xaa,0x4,0xaa,0x5,0xaa,0x6,0xaa,0x7,0xaa,0x8,0xaa,0x9,0xaa,0xa,0xaa,0xb,0xaa,0xc,0xaa,0xd,0xaa,0xe,0xaa,0xf,0xaa,0x10,0xaa,0x11,0xaa,0x12,0xaa,0x13,0xaa,0x14,0xaa,0x15,0xaa,0x16,0xaa,0x17,0xaa,0x18,0xaa,0x19,0xaa,0x1a,0xaa,0x1b,0xaa,0x1c,0xaa,0x1d,0xaa,0x1e,0xaa,0x1f,0xaa,0x20,0xaa,0x21,0xaa,0x22,0xaa,0x23,0xaa,0x24,0xaa,0x25,0xaa,0x26,0xaa,0x27,0xaa,0x28,0xaa,0x29,0xaa,0x2a,0xaa,0x2b,0xaa,0x2c,0xaa,0x2d,0xaa,0x2e,0xaa,0x2f,0xaa,0x30,0xaa,0x31,0xaa,0x32,0xaa,0x33,0xaa,0x34,0xaa,0x35,0xaa,0x36,0xaa,0x37,0xaa,0x38,0xaa,0x39,0xaa,0x3a,0xaa,0x3b,0xaa,0x3c,0xaa,0x3d,0xaa,0x3e,0xaa,0x3f,0xaa,0x40,0xaa,0x41,0xaa,0x42,0xaa,0x43,0xaa,0x44,0xaa,0x45,0xaa,0x46,0xaa,0x47,0xaa,0x48,0xaa,0x49,0xaa,0x4a,0xaa,0x4b,0xaa,0x4c,0xaa,0x4d,0xaa,0x4e,0xaa,0x4f,0xaa,0x50,0xaa,0x51,0xaa,0x52,0xaa,0x53,0xaa,0x54,0xaa,0x55,0xaa,0x56,0xaa,0x57,0xaa,0x58,0xaa,0x59,0xaa,0x5a,0xaa,0x5b,0xaa,0x5c,0xaa,0x5d,0xaa,0x5e,0xaa,0x5f,0xaa,0x60,0xaa,0x61,0xaa,0x62,0xaa,0x63,0xaa,0x64,0xaa,0x65,0xaa,0x66,0xaa,0x67,0xaa,0x68,0xaa,0x69,0xaa,0x6a,0xaa,0x6b,0xaa,0x6c,0xaa,0x6d,0xaa,0x6e,0xaa,0x6f,0xaa,0x70,0xaa,0x71,0xaa,0x72,0xaa,0x73,0xaa,0x74,0xaa,0x75,0xaa,0x76,0xaa,0x77,0xaa,0x78,0xaa,0x79,0xaa,0x7a,0xaa,0x7b,0xaa,0x7c,0xaa,0x7d,0xaa,0x7e,0xaa,0x7f,0xab,0x0,0xab,0x1,0xab,0x2,0xab,0x3,0xab,0x4,0xab,0x5,0xab,0x6,0xab,0x7,0xab,0x8,0xab,0x9,0xab,0xa,0xab,0xb,0xab,0xc,0xab,0xd,0xab,0xe,0xab,0xf,0xab,0x10,0xab,0x11,0xab,0x12,0xab,0x13,0xab,0x14,0xab,0x15,0xab,0x16,0xab,0x17,0xab,0x17,0x65,0x4,0xc8,0x5,0xc3,0x9f,0xe,0xab,0x18,0x6,0x84,0xb,0xa,0xee,0xe1,0x3d,0x0,0x1,0x2,0x1d,0x23,0x36,0x37,0x38,0x39,0x3b,0x5c,0x60,0x61,0x62,0x63,0x68,0x6a,0x81,0x54,0x83,0x2,0x83,0x22,0x83,0x56,0x84,0x7,0x84,0x8,0x84,0x10,0x88,0x2e,0x88,0x2f,0x88,0x32,0x88,0x7c,0x88,0x7e,0x8a,0x79,0x89,0x4c,0x89,0x5b,0x8f,0x1,0x90,0xb,0x8d,0x2,0x98,0x20,0x99,0xd,0x99,0xe,0x8a,0xd,0x9a,0x48,0x89,0x62,0x9e,0x36,0x90,0xf,0x9f,0x19,0x8a,0x3f,0x9f,0x53,0x9f,0x5e,0x9f,0x7c,0xa2,0x3b,0xa2,0x42,0xa2,0x4b,0xa2,0x55,0xa2,0x60,0xa2,0x61,0xa2,0x7e,0xa3,0xe,0xa3,0x33,0xa3,0x40,0xa3,0x41,0xa3,0x48,0xa3,0x56,0xe5,0x76,0x9e,0x64,0xc4,0xa4,0xf,0xa4,0x10,0xab,0x19,0xd0,0x59,0xd1,0x0,0xd0,0x81,0x44,0xd1,0x1,0xd0,0x81,0x52,0xd1,0x2,0xd0,0x83,0x1,0xd1,0x3,0xd0,0x83,0x21,0xd1,0x4,0xd0,0x83,0x55,0xd1,0x5,0xd0,0x84,0x6,0xd1,0x6,0xd0,0x89,0x41,0xd1,0x7,0xd0,0x8a,0x78,0xd1,0x8,0xd0,0xa1,0x4b,0xd1,0x9,0xd0,0xa1,0x71,0xd1,0xa,0xd0,0xa2,0x35,0xd1,0xb,0xd0,0xa2,0x75,0xd1,0xc,0xd0,0xa3,0x3f,0xd1,0xd,0xd0,0xa3,0x7e,0xd1,0xe,0xd0,0xa4,0x6,0xd1,0xf,0xe1,0x9,0xc7,0x4,0xc6,0xa4,0x8,0xc6,0x9e,0x36,0xcb,0xf,0xc6,0xa1,0x34,0xcb,0x9,0xc6,0xa3,0x68,0xcb,0xe,0xc6,0xa4,0x7,0xd0,0xa4,0xe,0xd3,0x0,};
-const int modules_compiler_len = 63720;
+const char modules_compiler[] = {0x74,0x6c,0x30,0x31,0xaf,0x75,0x2,0x65,0x71,0x6,0x72,0x65,0x74,0x75,0x72,0x6e,0x3,0x62,0x6f,0x72,0xc1,0x1,0x80,0x9,0x6e,0x6f,0x63,0x61,0x70,0x74,0x75,0x72,0x65,0x4,0x74,0x65,0x78,0x74,0x6,0x6f,0x66,0x66,0x73,0x65,0x74,0x8,0x6e,0x6f,0x65,0x73,0x63,0x61,0x70,0x65,0x5,0x6c,0x6f,0x6f,0x70,0x73,0x3,0x70,0x6f,0x73,0xc1,0x10,0x2c,0xc1,0x10,0x46,0x26,0xa,0xa,0xb,0xb,0xb,0xa,0x4,0x6c,0x69,0x6e,0x65,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc,0xd,0xf0,0xb6,0xc3,0xc4,0xc4,0xc4,0xe,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x0,0xd3,0xd3,0x0,0xc1,0x10,0x82,0xc1,0x10,0x9c,0x26,0x10,0x10,0x11,0x11,0x11,0x10,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x12,0xd,0xf1,0xb6,0xc3,0xc4,0xc4,0xc4,0x13,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x1,0xd3,0xd3,0x0,0xc1,0x10,0xd8,0xc1,0x10,0xf2,0x26,0x15,0x15,0x16,0x16,0x16,0x15,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x17,0xd,0xf2,0xb6,0xc3,0xc4,0xc4,0xc4,0x18,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x2,0xd3,0xd3,0x0,0x0,0xc1,0x11,0x2e,0xc1,0x11,0x48,0x26,0x1b,0x1b,0x1c,0x1c,0x1c,0x1b,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x1d,0xd,0xf3,0xb6,0xc3,0xc4,0xc4,0xc4,0x1e,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x3,0xd3,0xd3,0x0,0x6,0x5f,0x5f,0x6c,0x69,0x73,0x74,0xc1,0x11,0x84,0xc1,0x11,0x9e,0x26,0x21,0x21,0x22,0x22,0x22,0x21,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x23,0xd,0xf4,0xb6,0xc3,0xc4,0xc4,0xc4,0x24,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x4,0xd3,0xd3,0x0,0x8,0x5f,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x60,0xc1,0x11,0xda,0xc1,0x11,0xf4,0x26,0x28,0x28,0x29,0x29,0x29,0x28,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x2a,0xd,0xf5,0xb6,0xc3,0xc4,0xc4,0xc4,0x2b,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x5,0xd3,0xd3,0x0,0xc0,0x5,0xc1,0x12,0x30,0xc1,0x12,0x4a,0x26,0x2e,0x2e,0x2f,0x2f,0x2f,0x2e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x30,0xd,0xf6,0xb6,0xc3,0xc4,0xc4,0xc4,0x31,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x6,0xd3,0xd3,0x0,0xc0,0x3,0xc1,0x12,0x86,0xc1,0x12,0xa0,0x26,0x34,0x34,0x35,0x35,0x35,0x34,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x36,0xd,0xf7,0xb6,0xc3,0xc4,0xc4,0xc4,0x37,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x7,0xd3,0xd3,0x0,0x3,0x61,0x6e,0x64,0x3,0x67,0x74,0x65,0x3,0x6c,0x74,0x65,0x3,0x73,0x75,0x62,0xc0,0x7e,0x3,0x61,0x64,0x64,0xc1,0x13,0x6,0xc1,0x13,0x20,0xc1,0x13,0x2a,0x29,0x3f,0x3f,0x40,0x40,0x41,0x41,0x41,0x40,0x3f,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x42,0xd,0xf8,0xbe,0xc3,0xc4,0xc4,0xc4,0x43,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xe1,0x2,0xc7,0x9,0xc4,0x8,0xc8,0x0,0x0,0xd3,0xd3,0xd3,0x0,0xc1,0x13,0x68,0x23,0x45,0x45,0x45,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x46,0xd,0xf9,0xae,0xc3,0xc4,0xc4,0xc4,0x47,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc2,0xd3,0x0,0xd,0x65,0x6e,0x63,0x6f,0x64,0x65,0x4c,0x69,0x74,0x65,0x72,0x61,0x6c,0x1,0x76,0x21,0x4a,0x21,0x4b,0xc1,0x10,0x8,0xc1,0x10,0x5e,0xc1,0x10,0xb4,0xc1,0x11,0xa,0xc1,0x11,0x60,0xc1,0x11,0x66,0xc1,0x11,0xb6,0xc1,0x12,0xc,0xc1,0x12,0x62,0xc1,0x12,0xc2,0xc1,0x12,0xb8,0xc1,0x12,0xce,0xc1,0x12,0xec,0xe1,0x3e,0x4d,0x4d,0x4d,0xc0,0xc0,0x4e,0x4e,0x4e,0xc0,0xc0,0x4f,0x4f,0x4f,0xc0,0xc0,0x50,0x50,0x50,0xc0,0xc0,0x51,0x51,0x52,0x52,0x52,0x51,0xc0,0xc0,0x53,0x53,0xc0,0xc0,0xc0,0x53,0xc0,0xc0,0x54,0x54,0x54,0xc0,0xc0,0x55,0x55,0x55,0xc0,0xc0,0x56,0x56,0x57,0x57,0x57,0x58,0x58,0x59,0x59,0x59,0x58,0x56,0xc0,0xc0,0xc0,0xc0,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x5a,0xd,0xef,0xe5,0x81,0x25,0x49,0x4c,0xc4,0xc4,0x5b,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc2,0xd3,0xe3,0x0,0xd0,0xf,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc1,0xd3,0xe3,0x0,0xd0,0x14,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc0,0xd3,0xe3,0x0,0xd0,0x19,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x1a,0xd3,0xe3,0x0,0xd0,0x1f,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xe3,0x0,0xd0,0x25,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xe1,0x1,0xc7,0x4,0xc6,0x27,0xd3,0xd3,0xe3,0x0,0xd0,0x2c,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x2d,0xd3,0xe3,0x0,0xd0,0x32,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x33,0xd3,0xe3,0x0,0xd0,0x38,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x6,0xca,0x0,0xc4,0x0,0xd3,0xe1,0x2,0xc7,0x7,0xca,0x0,0xe1,0x2,0xc7,0x8,0xc6,0x3d,0xc4,0x8,0xd3,0xd3,0xd3,0xe3,0x0,0xd0,0x44,0xd3,0xc0,0xe3,0x0,0xd0,0x48,0xd3,0xd4,0x0,0x6,0x73,0x74,0x72,0x69,0x6e,0x67,0x22,0xc0,0x5d,0x6,0x61,0x73,0x73,0x65,0x72,0x74,0x6,0x69,0x20,0x3e,0x3d,0x20,0x30,0x2,0x6c,0x74,0x3,0x72,0x73,0x68,0x3,0x6c,0x73,0x68,0x3,0x42,0x69,0x6e,0xc1,0x1,0x0,0x4,0x62,0x61,0x6e,0x64,0xc0,0xfe,0x5,0x66,0x61,0x6c,0x73,0x65,0x9,0x65,0x6e,0x63,0x6f,0x64,0x65,0x49,0x6e,0x74,0x1,0x69,0x21,0x6a,0x21,0x6b,0xc1,0x13,0xae,0xc1,0x13,0xa0,0xc1,0x13,0xb2,0xc1,0x13,0xda,0xc1,0x13,0xce,0xc1,0x13,0xe2,0xc1,0x13,0xfa,0xc1,0x14,0x1e,0xc1,0x14,0x12,0xc1,0x14,0x26,0xc1,0x14,0x3e,0xc1,0x14,0x46,0xc1,0x14,0x40,0xc1,0x14,0x60,0xc1,0x14,0x68,0xc1,0x14,0x78,0xc1,0x14,0xb4,0xc1,0x14,0xa8,0xc1,0x14,0xbc,0xc1,0x14,0xd4,0xc1,0x14,0xdc,0xc1,0x14,0xd6,0xc1,0x14,0xf6,0xc1,0x14,0xfe,0xc1,0x15,0x24,0xc1,0x15,0x38,0xc1,0x15,0x2e,0xc1,0x15,0x5c,0xc1,0x15,0x98,0xc1,0x15,0x8c,0xc1,0x15,0xa0,0xc1,0x15,0xb8,0xc1,0x15,0xc0,0xc1,0x15,0xba,0xc1,0x15,0xda,0xc1,0x15,0xe2,0xc1,0x16,0x8,0xc1,0x16,0x1e,0xc1,0x16,0x12,0xc1,0x16,0x9e,0xc1,0x16,0xb2,0xc1,0x16,0xa8,0xc1,0x16,0xd6,0xc1,0x17,0x12,0xc1,0x17,0x6,0xc1,0x17,0x1a,0xc1,0x17,0x32,0xc1,0x17,0x3a,0xc1,0x17,0x34,0xc1,0x17,0x54,0xc1,0x17,0x5c,0xc1,0x17,0x82,0xc1,0x17,0x98,0xc1,0x17,0x8c,0xc1,0x18,0x18,0xc1,0x18,0x2e,0xc1,0x18,0x22,0xc1,0x18,0x66,0xc1,0x18,0x7a,0xc1,0x18,0x70,0xc1,0x18,0x9e,0xc1,0x18,0xd2,0xc1,0x18,0xc4,0xe1,0x81,0x2b,0x6d,0x6e,0x6f,0x6f,0x6f,0x6d,0x70,0x70,0x71,0x71,0x71,0x72,0x72,0x72,0x70,0x73,0x73,0x73,0x74,0x74,0x75,0x75,0x75,0x76,0x76,0x76,0x74,0x77,0x77,0x78,0x79,0x7a,0x7a,0x7b,0x7b,0x7b,0x7a,0x7c,0x7c,0x7c,0x78,0x77,0x7d,0x7d,0x7e,0x7e,0x7e,0x7f,0x7f,0x7f,0x7d,0x81,0x0,0x81,0x0,0x81,0x1,0x81,0x2,0x81,0x3,0x81,0x3,0x81,0x4,0x81,0x4,0x81,0x4,0x81,0x3,0x81,0x5,0x81,0x5,0x81,0x6,0x81,0x6,0x81,0x7,0x81,0x7,0x81,0x7,0x81,0x6,0x81,0x5,0x81,0x8,0x81,0x8,0x81,0x8,0x81,0x1,0x81,0x0,0x81,0x9,0x81,0x9,0x81,0xa,0x81,0xa,0x81,0xa,0x81,0xb,0x81,0xb,0x81,0xb,0x81,0x9,0x81,0xc,0x81,0xc,0x81,0xd,0x81,0xe,0x81,0xf,0x81,0xf,0x81,0x10,0x81,0x10,0x81,0x10,0x81,0xf,0x81,0x11,0x81,0x11,0x81,0x12,0x81,0x12,0x81,0x13,0x81,0x13,0x81,0x13,0x81,0x12,0x81,0x11,0x81,0x14,0x81,0x14,0x81,0x15,0x81,0x15,0x81,0x16,0x81,0x16,0x81,0x16,0x81,0x15,0x81,0x14,0x81,0x17,0x81,0x17,0x81,0x17,0x81,0xd,0x81,0xc,0x81,0x18,0x81,0x18,0x81,0x19,0x81,0x19,0x81,0x19,0x81,0x1a,0x81,0x1a,0x81,0x1a,0x81,0x18,0x81,0x1b,0x81,0x1b,0x81,0x1c,0x81,0x1d,0x81,0x1e,0x81,0x1e,0x81,0x1f,0x81,0x1f,0x81,0x1f,0x81,0x1e,0x81,0x20,0x81,0x20,0x81,0x21,0x81,0x21,0x81,0x22,0x81,0x22,0x81,0x22,0x81,0x21,0x81,0x20,0x81,0x23,0x81,0x23,0x81,0x24,0x81,0x24,0x81,0x25,0x81,0x25,0x81,0x25,0x81,0x24,0x81,0x23,0x81,0x26,0x81,0x26,0x81,0x27,0x81,0x27,0x81,0x28,0x81,0x28,0x81,0x28,0x81,0x27,0x81,0x26,0x81,0x29,0x81,0x29,0x81,0x29,0x81,0x1c,0x81,0x1b,0x81,0x2a,0x81,0x2b,0x81,0x2a,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x81,0x2c,0xd,0xfb,0xe5,0x83,0x68,0x69,0x6c,0xc4,0xc4,0x81,0x2d,0xf1,0x2,0x5e,0xc7,0xa,0xe1,0x2,0xc7,0x6,0xca,0x0,0xc4,0x0,0xd3,0xc6,0x60,0xd3,0xe1,0x2,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x0,0xd3,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc4,0x7,0xd3,0xd3,0xdd,0x0,0x0,0x39,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xca,0x0,0xd3,0xdb,0x0,0x0,0x3a,0xc2,0xe1,0x2,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc4,0x6,0xd3,0xd3,0xdd,0x0,0x0,0x7e,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x2,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x65,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x7,0xd3,0xd3,0xe1,0x2,0xc7,0xf,0xca,0x0,0xc6,0x67,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0x7f,0xc2,0xe1,0x2,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0xd,0xd3,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc4,0x6,0xd3,0xd3,0xdd,0x0,0x0,0xda,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x3,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x65,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0xd,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x65,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x7,0xd3,0xc6,0x3d,0xd3,0xd3,0xe1,0x2,0xc7,0xf,0xca,0x0,0xc6,0x67,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0xdb,0xc2,0xe1,0x2,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x13,0xd3,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc4,0x6,0xd3,0xd3,0xdd,0x0,0x1,0x4d,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x4,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x65,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x13,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x65,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0xd,0xd3,0xc6,0x3d,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x65,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x7,0xd3,0xc6,0x3d,0xd3,0xd3,0xe1,0x2,0xc7,0xf,0xca,0x0,0xc6,0x67,0xd3,0xd3,0xd3,0xdb,0x0,0x1,0x4e,0xc2,0xe1,0x2,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x19,0xd3,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc4,0x6,0xd3,0xd3,0xdd,0x0,0x1,0xd7,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x5,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x65,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x19,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x65,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x13,0xd3,0xc6,0x3d,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x65,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0xd,0xd3,0xc6,0x3d,0xd3,0xd3,0xe1,0x2,0xc7,0x2,0xc6,0x65,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x7,0xd3,0xc6,0x3d,0xd3,0xd3,0xe1,0x2,0xc7,0xf,0xca,0x0,0xc6,0x67,0xd3,0xd3,0xd3,0xdb,0x0,0x1,0xd8,0xc2,0xf1,0x2,0x5e,0xc7,0xa,0xc1,0xc6,0x68,0xd3,0x0,0xc1,0x1,0x92,0x5,0x62,0x79,0x74,0x65,0x73,0xb,0x65,0x6e,0x63,0x6f,0x64,0x65,0x46,0x6c,0x6f,0x61,0x74,0x1,0x66,0x21,0x81,0x32,0x21,0x81,0x33,0xc1,0x19,0x30,0xc1,0x19,0x14,0xc1,0x19,0xe,0xc1,0x19,0x36,0x28,0x81,0x35,0x81,0x35,0x81,0x36,0x81,0x37,0x81,0x36,0x81,0x38,0x81,0x38,0x81,0x35,0xc0,0x7c,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x81,0x39,0xd,0x81,0x3a,0xbe,0x81,0x31,0x81,0x34,0xc4,0xc4,0x81,0x3b,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0xe,0xc6,0x81,0x2f,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x81,0x30,0xd3,0xd3,0x0,0x3,0x61,0x62,0x73,0x4,0x62,0x6f,0x6f,0x6c,0xc0,0x3e,0xc0,0x4e,0xc0,0x5e,0xc0,0x6e,0xc1,0x1,0xcc,0x4,0x73,0x69,0x7a,0x65,0xc,0x65,0x6e,0x63,0x6f,0x64,0x65,0x4e,0x75,0x6d,0x62,0x65,0x72,0x3,0x6e,0x75,0x6d,0x21,0x81,0x46,0x21,0x81,0x47,0x1,0x6e,0x23,0x9,0x81,0x49,0x81,0x30,0x23,0xc1,0xc1,0xc1,0xc1,0x19,0x8e,0xc1,0x19,0xae,0xc1,0x19,0xca,0xc1,0x19,0xd2,0xc1,0x19,0xee,0xc1,0x19,0xf6,0xc1,0x19,0xf0,0xc1,0x1a,0x10,0xc1,0x1a,0x5c,0xc1,0x1a,0x52,0xc1,0x1a,0x68,0xc1,0x1a,0x60,0xc1,0x1a,0x90,0xc1,0x1a,0x98,0xc1,0x1a,0xb4,0xc1,0x1a,0xbc,0xc1,0x1a,0xb6,0xc1,0x1a,0xd6,0xc1,0x1b,0x8,0xc1,0x1b,0x22,0xc1,0x1b,0x18,0xc1,0x1b,0x2e,0xc1,0x1b,0x26,0xc1,0x1b,0x56,0xc1,0x1b,0x5e,0xc1,0x1b,0x7a,0xc1,0x1b,0x82,0xc1,0x1b,0x7c,0xc1,0x1b,0x9c,0xc1,0x1b,0xbc,0xc1,0x1b,0xce,0xc1,0x1b,0xe8,0xc1,0x1b,0xde,0xc1,0x1b,0xf4,0xc1,0x1b,0xec,0xc1,0x1c,0x1c,0xc1,0x1c,0x24,0xc1,0x1c,0x40,0xc1,0x1c,0x48,0xc1,0x1c,0x42,0xc1,0x1c,0x62,0xc1,0x1c,0x70,0xc1,0x1c,0x82,0xc1,0x1c,0x94,0xc1,0x1c,0xae,0xc1,0x1c,0xa4,0xc1,0x1c,0xba,0xc1,0x1c,0xb2,0xc1,0x1c,0xe4,0xc1,0x1c,0xec,0xc1,0x1d,0x8,0xc1,0x1d,0x10,0xc1,0x1d,0xa,0xc1,0x1d,0x2a,0xc1,0x1d,0x6e,0xc1,0x1d,0x80,0xc1,0x1d,0x92,0xc1,0x1d,0xa4,0xc1,0x1d,0xbe,0xc1,0x1d,0xb4,0xc1,0x1d,0xca,0xc1,0x1d,0xc2,0xc1,0x1d,0xf2,0xc1,0x1d,0xfa,0xc1,0x1e,0x16,0xc1,0x1e,0x1e,0xc1,0x1e,0x18,0xc1,0x1e,0x38,0xc1,0x1e,0x6a,0xc1,0x1e,0x7c,0xc1,0x1e,0x8e,0xc1,0x1e,0xa0,0xc1,0x1e,0xb2,0xc1,0x1e,0xcc,0xc1,0x1e,0xc2,0xc1,0x1e,0xd8,0xc1,0x1e,0xd0,0xc1,0x1f,0x0,0xc1,0x1f,0x8,0xc1,0x1f,0x24,0xc1,0x1f,0x2c,0xc1,0x1f,0x26,0xc1,0x1f,0x46,0xc1,0x1f,0x66,0xc1,0x1f,0x78,0xc1,0x1f,0x8a,0xc1,0x1f,0x9c,0xc1,0x1f,0xae,0xc1,0x1f,0xc0,0xc1,0x1f,0xda,0xc1,0x1f,0xd0,0xc1,0x1f,0xe6,0xc1,0x1f,0xde,0xc1,0x20,0xe,0xc1,0x20,0x16,0xc1,0x20,0x32,0xc1,0x20,0x3a,0xc1,0x20,0x34,0xc1,0x20,0x54,0xc1,0x20,0x62,0xc1,0x20,0x74,0xc1,0x20,0x86,0xc1,0x20,0x98,0xc1,0x20,0xaa,0xc1,0x20,0xbc,0xc1,0x20,0xce,0xc1,0x20,0xe8,0xc1,0x20,0xde,0xc1,0x20,0xf4,0xc1,0x20,0xec,0xc1,0x21,0x2a,0xc1,0x21,0x4c,0xc1,0x21,0x54,0xc1,0x21,0x4e,0xc1,0x21,0x82,0xc1,0x21,0x8e,0xe1,0x82,0x25,0x81,0x4c,0x81,0x4c,0x81,0x4c,0x81,0x4d,0x81,0x4d,0x81,0x4e,0x81,0x4e,0x81,0x4f,0x81,0x4f,0x81,0x4f,0x81,0x4e,0x81,0x50,0x81,0x50,0x81,0x51,0x81,0x52,0x81,0x53,0x81,0x53,0x81,0x53,0x81,0x54,0x81,0x54,0x81,0x55,0x81,0x55,0x81,0x55,0x81,0x56,0x81,0x57,0x81,0x56,0x81,0x54,0x81,0x51,0x81,0x50,0x81,0x58,0x81,0x58,0x81,0x59,0x81,0x59,0x81,0x59,0x81,0x58,0x81,0x5a,0x81,0x5a,0x81,0x5b,0x81,0x5c,0x81,0x5d,0x81,0x5d,0x81,0x5d,0x81,0x5e,0x81,0x5e,0x81,0x5e,0x81,0x5f,0x81,0x5f,0x81,0x60,0x81,0x60,0x81,0x60,0x81,0x61,0x81,0x62,0x81,0x61,0x81,0x5f,0x81,0x5b,0x81,0x5a,0x81,0x63,0x81,0x63,0x81,0x64,0x81,0x64,0x81,0x64,0x81,0x63,0x81,0x65,0x81,0x65,0x81,0x66,0x81,0x67,0x81,0x68,0x81,0x68,0x81,0x68,0x81,0x69,0x81,0x69,0x81,0x69,0x81,0x6a,0x81,0x6a,0x81,0x6a,0x81,0x6b,0x81,0x6b,0x81,0x6c,0x81,0x6c,0x81,0x6c,0x81,0x6d,0x81,0x6e,0x81,0x6d,0x81,0x6b,0x81,0x66,0x81,0x65,0x81,0x6f,0x81,0x6f,0x81,0x70,0x81,0x70,0x81,0x70,0x81,0x6f,0x81,0x71,0x81,0x71,0x81,0x72,0x81,0x73,0x81,0x74,0x81,0x74,0x81,0x74,0x81,0x75,0x81,0x75,0x81,0x75,0x81,0x76,0x81,0x76,0x81,0x76,0x81,0x77,0x81,0x77,0x81,0x77,0x81,0x78,0x81,0x78,0x81,0x79,0x81,0x79,0x81,0x79,0x81,0x7a,0x81,0x7b,0x81,0x7a,0x81,0x78,0x81,0x72,0x81,0x71,0x81,0x7c,0x81,0x7c,0x81,0x7d,0x81,0x7d,0x81,0x7d,0x81,0x7c,0x81,0x7e,0x81,0x7e,0x81,0x7f,0x82,0x0,0x82,0x1,0x82,0x1,0x82,0x1,0x82,0x2,0x82,0x2,0x82,0x2,0x82,0x3,0x82,0x3,0x82,0x3,0x82,0x4,0x82,0x4,0x82,0x4,0x82,0x5,0x82,0x5,0x82,0x5,0x82,0x6,0x82,0x6,0x82,0x7,0x82,0x7,0x82,0x7,0x82,0x8,0x82,0x9,0x82,0x8,0x82,0x6,0x81,0x7f,0x81,0x7e,0x82,0xa,0x82,0xa,0x82,0xb,0x82,0xb,0x82,0xb,0x82,0xa,0x82,0xc,0x82,0xc,0x82,0xd,0x82,0xe,0x82,0xf,0x82,0xf,0x82,0xf,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x11,0x82,0x11,0x82,0x11,0x82,0x12,0x82,0x12,0x82,0x12,0x82,0x13,0x82,0x13,0x82,0x13,0x82,0x14,0x82,0x14,0x82,0x14,0x82,0x15,0x82,0x15,0x82,0x16,0x82,0x16,0x82,0x16,0x82,0x17,0x82,0x18,0x82,0x17,0x82,0x15,0x82,0xd,0x82,0xc,0x82,0x19,0x82,0x19,0x82,0x1a,0x82,0x1a,0x82,0x1a,0x82,0x19,0x82,0x1b,0x82,0x1b,0x82,0x1c,0x82,0x1d,0x82,0x1e,0x82,0x1e,0x82,0x1e,0x82,0x1f,0x82,0x1f,0x82,0x1f,0x82,0x20,0x82,0x20,0x82,0x20,0x82,0x21,0x82,0x21,0x82,0x21,0x82,0x22,0x82,0x22,0x82,0x22,0x82,0x23,0x82,0x23,0x82,0x23,0x82,0x24,0x82,0x24,0x82,0x24,0x82,0x25,0x82,0x25,0x82,0x26,0x82,0x26,0x82,0x26,0x82,0x27,0x82,0x28,0x82,0x27,0x82,0x25,0x82,0x1c,0x82,0x1b,0x82,0x29,0x82,0x29,0x82,0x2a,0x82,0x2a,0x82,0x2a,0x82,0x29,0x82,0x2b,0x82,0x2b,0x82,0x2c,0x82,0x2d,0x82,0x2e,0x82,0x2e,0x82,0x2e,0x82,0x2f,0x82,0x2f,0x82,0x2f,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x31,0x82,0x31,0x82,0x31,0x82,0x32,0x82,0x32,0x82,0x32,0x82,0x33,0x82,0x33,0x82,0x33,0x82,0x34,0x82,0x34,0x82,0x34,0x82,0x35,0x82,0x35,0x82,0x35,0x82,0x36,0x82,0x36,0x82,0x37,0x82,0x37,0x82,0x37,0x82,0x38,0x82,0x39,0x82,0x38,0x82,0x36,0x82,0x2c,0x82,0x2b,0x82,0x3a,0x82,0x3a,0x82,0x3b,0x82,0x3b,0x82,0x3c,0x82,0x3d,0x82,0x3e,0x82,0x3f,0x82,0x3f,0x82,0x3e,0x82,0x3c,0x82,0x3b,0xc0,0x82,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x82,0x40,0xd,0x82,0x41,0xe5,0x87,0xb,0x81,0x45,0x81,0x48,0x81,0x4a,0x81,0x4b,0x82,0x42,0xe1,0x2,0xc7,0x6,0xca,0x0,0xc4,0x0,0xd3,0xd1,0x0,0xe0,0x0,0xca,0x0,0xc6,0x81,0x3d,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0xb,0xcb,0x1,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc4,0x7,0xd3,0xd3,0xdd,0x0,0x0,0x5b,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x2,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x0,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xd,0xcb,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x10,0xcb,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0x5c,0xc2,0xe1,0x2,0xc7,0xb,0xcb,0x1,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc4,0xf,0xd3,0xd3,0xdd,0x0,0x0,0xab,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x3,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xd,0xcb,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x10,0xcb,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0xac,0xc2,0xe1,0x2,0xc7,0xb,0xcb,0x1,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc4,0x17,0xd3,0xd3,0xdd,0x0,0x1,0x4,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x4,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x2,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xd,0xcb,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x10,0xcb,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x1,0x5,0xc2,0xe1,0x2,0xc7,0xb,0xcb,0x1,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc6,0x81,0x3f,0xd3,0xd3,0xdd,0x0,0x1,0x67,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x5,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x3,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x17,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xd,0xcb,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x10,0xcb,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x1,0x68,0xc2,0xe1,0x2,0xc7,0xb,0xcb,0x1,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc6,0x81,0x40,0xd3,0xd3,0xdd,0x0,0x1,0xd4,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x6,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x4,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc6,0x81,0x3f,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x17,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xd,0xcb,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x10,0xcb,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x1,0xd5,0xc2,0xe1,0x2,0xc7,0xb,0xcb,0x1,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc6,0x81,0x41,0xd3,0xd3,0xdd,0x0,0x2,0x4b,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x7,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x5,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc6,0x81,0x40,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc6,0x81,0x3f,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x17,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xd,0xcb,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x10,0xcb,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x2,0x4c,0xc2,0xe1,0x2,0xc7,0xb,0xcb,0x1,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc6,0x81,0x42,0xd3,0xd3,0xdd,0x0,0x2,0xcc,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x8,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x6,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc6,0x81,0x41,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc6,0x81,0x40,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc6,0x81,0x3f,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x17,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xd,0xcb,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x10,0xcb,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x2,0xcd,0xc2,0xe1,0x2,0xc7,0xb,0xcb,0x1,0xe1,0x2,0xc7,0xd,0xc4,0x1,0xc6,0x3d,0xd3,0xd3,0xdd,0x0,0x3,0x56,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x9,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x3,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc6,0x81,0x42,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc6,0x81,0x41,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc6,0x81,0x40,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc6,0x81,0x3f,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x17,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0xf,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x7,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x2,0xc7,0xd,0xcb,0x1,0xc4,0x1,0xd3,0xe1,0x3,0xc7,0x10,0xcb,0x0,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x3,0x57,0xc2,0xe0,0x0,0xca,0x0,0xc6,0x81,0x30,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x3,0xc7,0xe,0xc6,0x81,0x43,0xe1,0x1,0xc9,0x0,0x1,0xe0,0x0,0xcb,0x2,0xc6,0x81,0x44,0xd3,0xd3,0xcb,0x2,0xd3,0xd3,0x0,0x8,0x69,0x73,0x53,0x74,0x72,0x69,0x6e,0x67,0xa,0x69,0x73,0x53,0x74,0x72,0x69,0x6e,0x67,0x20,0x73,0xc0,0x40,0xc1,0x1,0xc0,0xc,0x65,0x6e,0x63,0x6f,0x64,0x65,0x53,0x74,0x72,0x69,0x6e,0x67,0x1,0x73,0x21,0x82,0x49,0x21,0x82,0x4a,0xc1,0x21,0xec,0xc1,0x21,0xde,0xc1,0x21,0xfc,0xc1,0x22,0x20,0xc1,0x22,0x12,0xc1,0x22,0x38,0xc1,0x22,0x40,0xc1,0x22,0x3a,0xc1,0x22,0x5a,0xc1,0x22,0x60,0xc1,0x22,0x8a,0xc1,0x22,0x92,0xc1,0x22,0x8c,0xc1,0x22,0xc0,0xc1,0x22,0xc4,0xe1,0x20,0x82,0x4c,0x82,0x4d,0x82,0x4e,0x82,0x4c,0x82,0x4e,0x82,0x4c,0x82,0x4f,0x82,0x4f,0x82,0x50,0x82,0x50,0x82,0x4f,0x82,0x51,0x82,0x51,0x82,0x52,0x82,0x53,0x82,0x54,0x82,0x54,0x82,0x55,0x82,0x55,0x82,0x54,0x82,0x52,0x82,0x51,0x82,0x56,0x82,0x56,0x82,0x57,0x82,0x58,0x82,0x59,0x82,0x5a,0x82,0x5a,0x82,0x59,0x82,0x57,0x82,0x56,0xc0,0xa2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x82,0x5b,0xd,0x82,0x5c,0xe5,0x6e,0x82,0x48,0x82,0x4b,0xc4,0xc4,0x82,0x5d,0xf1,0x2,0x5e,0xc7,0xa,0xe1,0x1,0xc7,0x11,0xca,0x0,0xd3,0xc6,0x82,0x45,0xd3,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xca,0x0,0xc6,0x81,0x30,0xd3,0xc6,0x82,0x46,0xd3,0xdd,0x0,0x0,0x45,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x2,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc4,0x0,0xe0,0x0,0xca,0x0,0xc6,0x81,0x30,0xd3,0xd3,0xca,0x0,0xd3,0xd3,0xdb,0x0,0x0,0x46,0xc2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x3,0xc7,0xe,0xc6,0x82,0x47,0xe1,0x1,0xc9,0x0,0x1,0xe0,0x0,0xca,0x0,0xc6,0x81,0x30,0xd3,0xd3,0xca,0x0,0xd3,0xd3,0x0,0x6,0x42,0x75,0x66,0x66,0x65,0x72,0x3,0x6e,0x65,0x77,0x5,0x62,0x6c,0x6f,0x63,0x6b,0x21,0x82,0x61,0x4,0x65,0x61,0x63,0x68,0x5,0x77,0x72,0x69,0x74,0x65,0x1,0x65,0x21,0x82,0x65,0x21,0x82,0x66,0xc1,0x23,0xb8,0x22,0x82,0x68,0x82,0x68,0xc0,0xb2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x82,0x69,0xd,0x82,0x6a,0xb3,0xc3,0x82,0x67,0xc4,0xc4,0x82,0x6b,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x82,0x64,0xca,0x0,0xd3,0x0,0x4,0x72,0x65,0x61,0x64,0xc1,0x1,0xc2,0xc1,0x24,0x8e,0x22,0x82,0x6f,0x82,0x6f,0xc0,0xb8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x82,0x70,0xd,0x82,0x71,0xb3,0xc3,0x82,0x67,0xc4,0xc4,0x82,0x72,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x82,0x64,0xca,0x0,0xd3,0x0,0xa,0x65,0x6e,0x63,0x6f,0x64,0x65,0x4c,0x69,0x73,0x74,0x1,0x6c,0x21,0x82,0x75,0x21,0x82,0x76,0x3,0x62,0x75,0x66,0x22,0x82,0x78,0x82,0x78,0x22,0xc1,0xc1,0xc1,0x23,0x1e,0xc1,0x23,0x12,0xc1,0x23,0x52,0xc1,0x23,0x46,0xc1,0x23,0x74,0xc1,0x23,0x7a,0xc1,0x23,0x9a,0xc1,0x23,0xe8,0xc1,0x23,0xf0,0xc1,0x24,0x1c,0xc1,0x24,0x10,0xc1,0x24,0x52,0xc1,0x24,0x56,0xc1,0x24,0x70,0xc1,0x24,0xb6,0xc1,0x24,0xbe,0xe1,0x22,0x82,0x7b,0x82,0x7b,0x82,0x7c,0x82,0x7c,0x82,0x7b,0x82,0x7d,0x82,0x7e,0x82,0x7f,0x82,0x7f,0x83,0x0,0x83,0x0,0x82,0x7f,0x82,0x7d,0x83,0x1,0x83,0x1,0x83,0x2,0x83,0x2,0x83,0x3,0x83,0x3,0x83,0x2,0x83,0x4,0x83,0x5,0x83,0x6,0x83,0x7,0x83,0x7,0x83,0x6,0x83,0x4,0x83,0x8,0x83,0x8,0x83,0x9,0x83,0x9,0x83,0xa,0x83,0xa,0x83,0x9,0xc0,0xac,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x83,0xb,0xd,0x83,0xc,0xe5,0x81,0x11,0x82,0x74,0x82,0x77,0x82,0x79,0x82,0x7a,0x83,0xd,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xca,0x0,0xc6,0x81,0x44,0xd3,0xc6,0x82,0x46,0xd3,0xdd,0x0,0x0,0x4e,0xe0,0x1,0xc7,0x12,0xc6,0x82,0x60,0xe1,0x2,0xc7,0x2,0xc6,0x82,0x46,0xe0,0x0,0xca,0x0,0xc6,0x81,0x44,0xd3,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x82,0x62,0xca,0x0,0xc6,0x82,0x63,0xd0,0x82,0x6c,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x82,0x6d,0xd3,0xd3,0xdb,0x0,0x0,0x4f,0xc2,0xe0,0x2,0xc7,0x12,0xc6,0x82,0x60,0xc6,0x82,0x6e,0xe1,0x1,0xc9,0x0,0x1,0xe0,0x0,0xca,0x0,0xc6,0x81,0x44,0xd3,0xd3,0xd3,0xd1,0x1,0xf0,0x1,0x82,0x62,0xca,0x0,0xc6,0x82,0x63,0xd0,0x82,0x73,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x0,0xcb,0x1,0xc6,0x82,0x6d,0xd3,0xd3,0x0,0x3,0x6d,0x75,0x6c,0x12,0x73,0x69,0x7a,0x65,0x20,0x2a,0x20,0x32,0x20,0x3d,0x3d,0x20,0x6d,0x2e,0x73,0x69,0x7a,0x65,0xc0,0xc0,0xc1,0x26,0x6,0x22,0x83,0x12,0x83,0x12,0xc0,0xc8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x13,0xd,0x83,0x14,0xb3,0xc3,0x82,0x67,0xc4,0xc4,0x83,0x15,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x82,0x64,0xca,0x0,0xd3,0x0,0xc1,0x1,0xc6,0xc1,0x26,0xd8,0x22,0x83,0x18,0x83,0x18,0xc0,0xce,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x19,0xd,0x83,0x1a,0xb3,0xc3,0x82,0x67,0xc4,0xc4,0x83,0x1b,0xe0,0x1,0xc9,0x0,0x2,0xc6,0x82,0x64,0xca,0x0,0xd3,0x0,0x9,0x65,0x6e,0x63,0x6f,0x64,0x65,0x4d,0x61,0x70,0x1,0x6d,0x21,0x83,0x1e,0x21,0x83,0x1f,0x23,0x81,0x44,0x82,0x78,0x82,0x78,0xc1,0x25,0x12,0xc1,0x25,0x6,0xc1,0x25,0x32,0xc1,0x25,0x24,0xc1,0x25,0x44,0xc1,0x25,0x3c,0xc1,0x25,0x4c,0xc1,0x25,0x70,0xc1,0x25,0xa4,0xc1,0x25,0x98,0xc1,0x25,0xc6,0xc1,0x25,0xe8,0xc1,0x26,0x36,0xc1,0x26,0x3e,0xc1,0x26,0x6a,0xc1,0x26,0x5e,0xc1,0x26,0xa0,0xc1,0x26,0xba,0xc1,0x27,0x0,0xc1,0x27,0x8,0xe1,0x2c,0x83,0x22,0x83,0x22,0x83,0x23,0x83,0x23,0x83,0x22,0x83,0x24,0x83,0x25,0x83,0x26,0x83,0x26,0x83,0x27,0x83,0x27,0x83,0x27,0x83,0x28,0x83,0x28,0x83,0x26,0x83,0x24,0x83,0x29,0x83,0x29,0x83,0x29,0x83,0x2a,0x83,0x2b,0x83,0x2c,0x83,0x2c,0x83,0x2c,0x83,0x2a,0x83,0x2d,0x83,0x2d,0x83,0x2e,0x83,0x2e,0x83,0x2f,0x83,0x2f,0x83,0x2e,0x83,0x30,0x83,0x31,0x83,0x32,0x83,0x32,0x83,0x30,0x83,0x33,0x83,0x33,0x83,0x34,0x83,0x34,0x83,0x35,0x83,0x35,0x83,0x34,0xc0,0xbe,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x83,0x36,0xd,0x83,0x37,0xe5,0x81,0x2f,0x83,0x1d,0x83,0x20,0x83,0x21,0x81,0x4b,0x83,0x38,0xe1,0x2,0xc7,0xc,0xe0,0x0,0xca,0x0,0xc6,0x81,0x44,0xd3,0xc4,0x1,0xd3,0xd1,0x0,0xf1,0x2,0x5e,0xc7,0xa,0xe1,0x2,0xc7,0x0,0xe1,0x2,0xc7,0x13,0xcb,0x0,0xc4,0x2,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x81,0x44,0xd3,0xd3,0xc6,0x83,0x10,0xd3,0xe1,0x2,0xc7,0xb,0xcb,0x0,0xc6,0x82,0x46,0xd3,0xdd,0x0,0x0,0x72,0xe0,0x1,0xc7,0x12,0xc6,0x82,0x60,0xe1,0x2,0xc7,0x2,0xc6,0x83,0x11,0xcb,0x0,0xd3,0xd3,0xd1,0x1,0xf0,0x1,0x82,0x62,0xca,0x0,0xc6,0x82,0x63,0xd0,0x83,0x16,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x0,0xcb,0x1,0xc6,0x82,0x6d,0xd3,0xd3,0xdb,0x0,0x0,0x73,0xc2,0xe0,0x2,0xc7,0x12,0xc6,0x82,0x60,0xc6,0x83,0x17,0xe1,0x1,0xc9,0x0,0x1,0xcb,0x0,0xd3,0xd3,0xd1,0x2,0xf0,0x1,0x82,0x62,0xca,0x0,0xc6,0x82,0x63,0xd0,0x83,0x1c,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x0,0xcb,0x2,0xc6,0x82,0x6d,0xd3,0xd3,0x0,0x5,0x41,0x72,0x72,0x61,0x79,0x7,0x48,0x61,0x73,0x68,0x4d,0x61,0x70,0x4,0x63,0x6f,0x64,0x65,0x3,0x67,0x65,0x74,0x23,0xc0,0xc0,0xc0,0xc0,0xee,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x83,0x3f,0xb4,0xc3,0xc4,0xc4,0xc4,0x83,0x40,0xe1,0x2,0xc7,0x9,0xc9,0x1,0x1,0xc4,0x1,0xd3,0xd9,0x1,0x1,0x0,0x4,0x6a,0x75,0x6d,0x70,0x2,0x6f,0x70,0x21,0x83,0x43,0x21,0x83,0x44,0xc1,0x2a,0x3a,0xc1,0x2a,0x2e,0xc1,0x2a,0x5c,0xc1,0x2a,0x6c,0xc1,0x2a,0x94,0xc1,0x2a,0x9e,0xc1,0x2a,0xb4,0xc1,0x2a,0xaa,0x37,0xc0,0xc0,0x83,0x46,0x83,0x46,0x83,0x47,0x83,0x47,0x83,0x46,0xc0,0x83,0x48,0x83,0x49,0x83,0x49,0x83,0x48,0x83,0x4a,0x83,0x4b,0x83,0x4b,0x83,0x4c,0x83,0x4d,0x83,0x4d,0xc0,0xc0,0x83,0x4c,0x83,0x4b,0x83,0x4a,0xc0,0xe8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x83,0x4e,0xd,0x83,0x4f,0xe5,0x59,0x83,0x42,0x83,0x45,0xc4,0xc4,0x83,0x50,0xe1,0x2,0xc7,0x9,0xc9,0x0,0x7,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x81,0x44,0xd3,0xc4,0x4,0xd3,0xd3,0xd9,0x0,0x7,0xe0,0x1,0xc9,0x0,0x4,0xc6,0x3e,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x82,0x6d,0xd3,0xd3,0xe0,0x1,0xc9,0x0,0x4,0xc6,0x3e,0xe1,0x2,0xc7,0x3,0xca,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x83,0x41,0xd3,0xd3,0xd3,0xd3,0x0,0x4,0x6c,0x6f,0x6f,0x70,0xc0,0xf2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x83,0x53,0xb4,0xc3,0xc4,0xc4,0xc4,0x83,0x54,0xe1,0x2,0xc7,0x9,0xc9,0x1,0x1,0xc4,0x1,0xd3,0xd9,0x1,0x1,0x0,0x3,0x65,0x6e,0x64,0x5,0x62,0x72,0x65,0x61,0x6b,0xc1,0x2b,0x88,0xc1,0x2b,0xb4,0x28,0x83,0x58,0x83,0x58,0x83,0x59,0x83,0x59,0x83,0x59,0x83,0x59,0x83,0x59,0x83,0x59,0xc0,0xf6,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x5a,0xd,0x83,0x5b,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x83,0x5c,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xc4,0x0,0xd3,0xe1,0x1,0xc7,0x17,0xe1,0x2,0xc7,0x3,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0x0,0x6,0x73,0x79,0x73,0x74,0x65,0x6d,0x4,0x64,0x61,0x74,0x61,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x67,0xb4,0xc3,0xc4,0xc4,0xc4,0x83,0x60,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x2c,0x5c,0xc1,0x2c,0x82,0xc1,0x2c,0xaa,0xc1,0x2c,0xbe,0xc1,0x2c,0xd6,0xc1,0x2c,0xcc,0x2f,0x83,0x62,0x83,0x63,0x83,0x63,0x83,0x63,0x83,0x62,0x83,0x64,0x83,0x65,0x83,0x66,0x83,0x67,0x83,0x67,0xc0,0xc0,0x83,0x66,0x83,0x65,0x83,0x64,0xc0,0xfc,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x83,0x68,0xd,0x83,0x69,0xe5,0x40,0xc3,0xc4,0xc4,0xc4,0x83,0x6a,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x5,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x83,0x5f,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x83,0x61,0xd3,0xd3,0xd3,0xd3,0x0,0xc1,0x1,0x4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x83,0x6c,0xb4,0xc3,0xc4,0xc4,0xc4,0x83,0x6d,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x2d,0x7e,0xc1,0x2d,0xa4,0xc1,0x2d,0xcc,0xc1,0x2d,0xe0,0xc1,0x2d,0xf8,0xc1,0x2d,0xee,0x2f,0x83,0x6f,0x83,0x70,0x83,0x70,0x83,0x70,0x83,0x6f,0x83,0x71,0x83,0x72,0x83,0x73,0x83,0x74,0x83,0x74,0xc0,0xc0,0x83,0x73,0x83,0x72,0x83,0x71,0xc1,0x1,0x2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x83,0x75,0xd,0x83,0x76,0xe5,0x41,0xc3,0xc4,0xc4,0xc4,0x83,0x77,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x6,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe0,0x2,0xc8,0x1,0x0,0xc6,0x83,0x5f,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x83,0x6e,0xd3,0xd3,0xc0,0xd3,0xd3,0x0,0x6,0x67,0x6c,0x6f,0x62,0x61,0x6c,0xc1,0x1,0x8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x83,0x7a,0xb4,0xc3,0xc4,0xc4,0xc4,0x83,0x7b,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x1,0xc,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x83,0x7d,0xb4,0xc3,0xc4,0xc4,0xc4,0x83,0x7e,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x2e,0xd4,0xc1,0x2e,0xea,0xc1,0x2e,0xe0,0xc1,0x2f,0x24,0xc1,0x2f,0x4a,0xc1,0x2f,0x72,0xc1,0x2f,0x86,0xc1,0x2f,0xa2,0xc1,0x2f,0x98,0x37,0x84,0x0,0x84,0x1,0x84,0x2,0x84,0x2,0xc0,0xc0,0x84,0x1,0x84,0x0,0x84,0x3,0x84,0x4,0x84,0x4,0x84,0x4,0x84,0x3,0x84,0x5,0x84,0x6,0x84,0x7,0x84,0x8,0x84,0x8,0xc0,0xc0,0x84,0x7,0x84,0x6,0x84,0x5,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x84,0x9,0xd,0x83,0x7a,0xe5,0x5d,0xc3,0xc4,0xc4,0xc4,0x84,0xa,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x83,0x7c,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x7,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x83,0x79,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x83,0x7f,0xd3,0xd3,0xd3,0xd3,0x0,0x4,0x62,0x69,0x6e,0x64,0x3,0x6e,0x6f,0x74,0xc1,0x1,0x14,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x84,0xe,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0xf,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x30,0xa6,0xc1,0x30,0xb4,0xc1,0x30,0xd6,0xc1,0x30,0xcc,0xc1,0x30,0xe0,0xc1,0x31,0x2c,0xc1,0x31,0x52,0xc1,0x31,0x7c,0xc1,0x31,0x90,0xc1,0x31,0xa8,0xc1,0x31,0x9e,0x3b,0x84,0x11,0x84,0x11,0x84,0x12,0x84,0x13,0x84,0x14,0x84,0x14,0x84,0x15,0x84,0x15,0x84,0x15,0x84,0x13,0x84,0x12,0x84,0x11,0x84,0x16,0x84,0x17,0x84,0x17,0x84,0x17,0x84,0x16,0x84,0x18,0x84,0x19,0x84,0x1a,0x84,0x1b,0x84,0x1b,0xc0,0xc0,0x84,0x1a,0x84,0x19,0x84,0x18,0xc1,0x1,0x10,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x84,0x1c,0xd,0x84,0x1d,0xe5,0x73,0xc3,0xc4,0xc4,0xc4,0x84,0x1e,0xe1,0x1,0xc7,0x18,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x4,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x2,0xc7,0x9,0xc9,0x1,0x1,0xc4,0x1,0xd3,0xd3,0xd3,0xd3,0xdd,0x0,0x0,0x32,0xc0,0xd9,0x1,0x2,0xdb,0x0,0x0,0x33,0xc2,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x10,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x83,0x3c,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x84,0x10,0xd3,0xd3,0xd3,0xd3,0x0,0x4,0x74,0x72,0x75,0x65,0xc1,0x32,0x4,0xc1,0x32,0x2a,0x25,0x84,0x21,0x84,0x22,0x84,0x22,0x84,0x22,0x84,0x21,0xc1,0x1,0x16,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x84,0x23,0xd,0x84,0x24,0xb9,0xc3,0xc4,0xc4,0xc4,0x84,0x25,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x0,0xd3,0xd3,0x0,0xc1,0x32,0x72,0xc1,0x32,0x98,0x25,0x84,0x27,0x84,0x28,0x84,0x28,0x84,0x28,0x84,0x27,0xc1,0x1,0x18,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x84,0x29,0xd,0x84,0x2a,0xb9,0xc3,0xc4,0xc4,0xc4,0x84,0x2b,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x1,0xd3,0xd3,0x0,0x4,0x6e,0x75,0x6c,0x6c,0xc1,0x32,0xe0,0xc1,0x33,0x6,0x25,0x84,0x2e,0x84,0x2f,0x84,0x2f,0x84,0x2f,0x84,0x2e,0xc1,0x1,0x1a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x84,0x30,0xd,0x84,0x31,0xb9,0xc3,0xc4,0xc4,0xc4,0x84,0x32,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x2,0xd3,0xd3,0x0,0x5,0x75,0x6e,0x64,0x65,0x66,0xc1,0x33,0x4e,0xc1,0x33,0x74,0x25,0x84,0x35,0x84,0x36,0x84,0x36,0x84,0x36,0x84,0x35,0xc1,0x1,0x1c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x84,0x37,0xd,0x84,0x38,0xb9,0xc3,0xc4,0xc4,0xc4,0x84,0x39,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x3,0xd3,0xd3,0x0,0x3,0x69,0x6e,0x74,0xc1,0x1,0x1e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x84,0x3c,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x3d,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x33,0xbc,0xc1,0x33,0xe2,0xc1,0x33,0xf4,0xc1,0x34,0x14,0xc1,0x34,0x22,0xc1,0x34,0x18,0x2f,0x84,0x3f,0x84,0x40,0x84,0x40,0x84,0x40,0x84,0x3f,0x84,0x41,0x84,0x42,0x84,0x43,0x84,0x44,0x84,0x44,0xc0,0xc0,0x84,0x43,0x84,0x42,0x84,0x41,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x84,0x45,0xd,0x84,0x3c,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x84,0x46,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x4,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x84,0x3e,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x65,0x6e,0x76,0x61,0x72,0x67,0xc1,0x1,0x20,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x84,0x49,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x4a,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x4a,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x34,0x7e,0xc1,0x34,0xa4,0xc1,0x34,0xb6,0xc1,0x34,0xd6,0xc1,0x34,0xe4,0xc1,0x34,0xda,0xc1,0x35,0xa,0xc1,0x35,0x2a,0xc1,0x35,0x38,0xc1,0x35,0x2e,0x39,0x84,0x4d,0x84,0x4e,0x84,0x4e,0x84,0x4e,0x84,0x4d,0x84,0x4f,0x84,0x50,0x84,0x51,0x84,0x52,0x84,0x52,0xc0,0xc0,0x84,0x51,0x84,0x50,0x84,0x4f,0x84,0x53,0x84,0x54,0x84,0x55,0x84,0x56,0x84,0x56,0xc0,0xc0,0x84,0x55,0x84,0x54,0x84,0x53,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x84,0x57,0xd,0x84,0x49,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x84,0x58,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x8,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x84,0x4b,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x84,0x4c,0xd3,0xd3,0xd3,0xd3,0x0,0x3,0x65,0x6e,0x76,0xc1,0x1,0x22,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x84,0x5b,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x5c,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x5c,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x35,0x94,0xc1,0x35,0xba,0xc1,0x35,0xcc,0xc1,0x35,0xec,0xc1,0x35,0xfa,0xc1,0x35,0xf0,0xc1,0x36,0x20,0xc1,0x36,0x40,0xc1,0x36,0x4e,0xc1,0x36,0x44,0x39,0x84,0x5f,0x84,0x60,0x84,0x60,0x84,0x60,0x84,0x5f,0x84,0x61,0x84,0x62,0x84,0x63,0x84,0x64,0x84,0x64,0xc0,0xc0,0x84,0x63,0x84,0x62,0x84,0x61,0x84,0x65,0x84,0x66,0x84,0x67,0x84,0x68,0x84,0x68,0xc0,0xc0,0x84,0x67,0x84,0x66,0x84,0x65,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x84,0x69,0xd,0x84,0x5b,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x84,0x6a,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x9,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x84,0x5d,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x84,0x5e,0xd3,0xd3,0xd3,0xd3,0x0,0x3,0x61,0x72,0x67,0xc1,0x1,0x24,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x84,0x6d,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x6e,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x36,0xaa,0xc1,0x36,0xd0,0xc1,0x36,0xe4,0xc1,0x37,0x4,0xc1,0x37,0x12,0xc1,0x37,0x8,0x2f,0x84,0x70,0x84,0x71,0x84,0x71,0x84,0x71,0x84,0x70,0x84,0x72,0x84,0x73,0x84,0x74,0x84,0x75,0x84,0x75,0xc0,0xc0,0x84,0x74,0x84,0x73,0x84,0x72,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x84,0x76,0xd,0x84,0x6d,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x84,0x77,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xa,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x84,0x6f,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x6c,0x6f,0x63,0x61,0x6c,0xc1,0x1,0x26,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x84,0x7a,0xb4,0xc3,0xc4,0xc4,0xc4,0x84,0x7b,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x37,0x6e,0xc1,0x37,0x94,0xc1,0x37,0xa8,0xc1,0x37,0xc8,0xc1,0x37,0xd6,0xc1,0x37,0xcc,0x2f,0x84,0x7d,0x84,0x7e,0x84,0x7e,0x84,0x7e,0x84,0x7d,0x84,0x7f,0x85,0x0,0x85,0x1,0x85,0x2,0x85,0x2,0xc0,0xc0,0x85,0x1,0x85,0x0,0x84,0x7f,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x85,0x3,0xd,0x84,0x7a,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x85,0x4,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xb,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x84,0x7c,0xd3,0xd3,0xd3,0xd3,0x0,0x4,0x61,0x72,0x67,0x73,0xc1,0x38,0x32,0xc1,0x38,0x58,0x25,0x85,0x7,0x85,0x8,0x85,0x8,0x85,0x8,0x85,0x7,0xc1,0x1,0x28,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x85,0x9,0xd,0x85,0xa,0xb9,0xc3,0xc4,0xc4,0xc4,0x85,0xb,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xc,0xd3,0xd3,0x0,0x7,0x65,0x6e,0x76,0x61,0x72,0x67,0x73,0xc1,0x1,0x2a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x85,0xe,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0xf,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x38,0xa2,0xc1,0x38,0xc8,0xc1,0x38,0xdc,0xc1,0x38,0xfc,0xc1,0x39,0xa,0xc1,0x39,0x0,0x2f,0x85,0x11,0x85,0x12,0x85,0x12,0x85,0x12,0x85,0x11,0x85,0x13,0x85,0x14,0x85,0x15,0x85,0x16,0x85,0x16,0xc0,0xc0,0x85,0x15,0x85,0x14,0x85,0x13,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x85,0x17,0xd,0x85,0xe,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x85,0x18,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xd,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x85,0x10,0xd3,0xd3,0xd3,0xd3,0x0,0x4,0x74,0x68,0x69,0x73,0xc1,0x39,0x66,0xc1,0x39,0x8c,0x25,0x85,0x1b,0x85,0x1c,0x85,0x1c,0x85,0x1c,0x85,0x1b,0xc1,0x1,0x2c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x85,0x1d,0xd,0x85,0x1e,0xb9,0xc3,0xc4,0xc4,0xc4,0x85,0x1f,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xe,0xd3,0xd3,0x0,0x7,0x65,0x6e,0x76,0x74,0x68,0x69,0x73,0xc1,0x1,0x2e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x85,0x22,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x23,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x39,0xd6,0xc1,0x39,0xfc,0xc1,0x3a,0x10,0xc1,0x3a,0x30,0xc1,0x3a,0x3e,0xc1,0x3a,0x34,0x2f,0x85,0x25,0x85,0x26,0x85,0x26,0x85,0x26,0x85,0x25,0x85,0x27,0x85,0x28,0x85,0x29,0x85,0x2a,0x85,0x2a,0xc0,0xc0,0x85,0x29,0x85,0x28,0x85,0x27,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x85,0x2b,0xd,0x85,0x22,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x85,0x2c,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0xf,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x85,0x24,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x32,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x85,0x2f,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x30,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3a,0x9c,0xc1,0x3a,0xc2,0xc1,0x3a,0xd6,0xc1,0x3a,0xf6,0xc1,0x3b,0x4,0xc1,0x3a,0xfa,0x2f,0x85,0x32,0x85,0x33,0x85,0x33,0x85,0x33,0x85,0x32,0x85,0x34,0x85,0x35,0x85,0x36,0x85,0x37,0x85,0x37,0xc0,0xc0,0x85,0x36,0x85,0x35,0x85,0x34,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x85,0x38,0xd,0x85,0x2f,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x85,0x39,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x11,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x85,0x31,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x72,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x34,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x85,0x3c,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x3d,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x3d,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3b,0x60,0xc1,0x3b,0x86,0xc1,0x3b,0x9a,0xc1,0x3b,0xba,0xc1,0x3b,0xc8,0xc1,0x3b,0xbe,0xc1,0x3b,0xee,0xc1,0x3c,0xe,0xc1,0x3c,0x1c,0xc1,0x3c,0x12,0x39,0x85,0x40,0x85,0x41,0x85,0x41,0x85,0x41,0x85,0x40,0x85,0x42,0x85,0x43,0x85,0x44,0x85,0x45,0x85,0x45,0xc0,0xc0,0x85,0x44,0x85,0x43,0x85,0x42,0x85,0x46,0x85,0x47,0x85,0x48,0x85,0x49,0x85,0x49,0xc0,0xc0,0x85,0x48,0x85,0x47,0x85,0x46,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x85,0x4a,0xd,0x85,0x3c,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x85,0x4b,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x12,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x85,0x3e,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x85,0x3f,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x69,0x6e,0x76,0x6f,0x6b,0x65,0xc1,0x1,0x36,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x85,0x4e,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x4f,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3c,0x78,0xc1,0x3c,0x9e,0xc1,0x3c,0xb6,0xc1,0x3c,0xcc,0xc1,0x3c,0xc2,0x2d,0x85,0x51,0x85,0x52,0x85,0x52,0x85,0x52,0x85,0x51,0x85,0x53,0x85,0x54,0x85,0x55,0x85,0x55,0xc0,0xc0,0x85,0x54,0x85,0x53,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x85,0x56,0xd,0x85,0x4e,0xe5,0x36,0xc3,0xc4,0xc4,0xc4,0x85,0x57,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x13,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x85,0x50,0xd3,0xd3,0xd3,0x0,0x4,0x63,0x65,0x72,0x72,0xc1,0x3d,0x26,0xc1,0x3d,0x4c,0x25,0x85,0x5a,0x85,0x5b,0x85,0x5b,0x85,0x5b,0x85,0x5a,0xc1,0x1,0x38,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x85,0x5c,0xd,0x85,0x5d,0xb9,0xc3,0xc4,0xc4,0xc4,0x85,0x5e,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x14,0xd3,0xd3,0x0,0x4,0x76,0x67,0x65,0x74,0xc1,0x1,0x3c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x85,0x61,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x62,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3d,0x9a,0xc1,0x3d,0xc0,0xc1,0x3d,0xd4,0xc1,0x3d,0xf4,0xc1,0x3e,0x2,0xc1,0x3d,0xf8,0x2f,0x85,0x64,0x85,0x65,0x85,0x65,0x85,0x65,0x85,0x64,0x85,0x66,0x85,0x67,0x85,0x68,0x85,0x69,0x85,0x69,0xc0,0xc0,0x85,0x68,0x85,0x67,0x85,0x66,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x85,0x6a,0xd,0x85,0x61,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x85,0x6b,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x15,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x85,0x63,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x76,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x3e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x85,0x6e,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x6f,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3e,0x60,0xc1,0x3e,0x86,0xc1,0x3e,0x9a,0xc1,0x3e,0xba,0xc1,0x3e,0xc8,0xc1,0x3e,0xbe,0x2f,0x85,0x71,0x85,0x72,0x85,0x72,0x85,0x72,0x85,0x71,0x85,0x73,0x85,0x74,0x85,0x75,0x85,0x76,0x85,0x76,0xc0,0xc0,0x85,0x75,0x85,0x74,0x85,0x73,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x85,0x77,0xd,0x85,0x6e,0xe5,0x3d,0xc3,0xc4,0xc4,0xc4,0x85,0x78,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x16,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x85,0x70,0xd3,0xd3,0xd3,0xd3,0x0,0x7,0x76,0x72,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x40,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x85,0x7b,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x7c,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x85,0x7c,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x3f,0x26,0xc1,0x3f,0x4c,0xc1,0x3f,0x60,0xc1,0x3f,0x80,0xc1,0x3f,0x8e,0xc1,0x3f,0x84,0xc1,0x3f,0xb4,0xc1,0x3f,0xd4,0xc1,0x3f,0xe2,0xc1,0x3f,0xd8,0x39,0x85,0x7f,0x86,0x0,0x86,0x0,0x86,0x0,0x85,0x7f,0x86,0x1,0x86,0x2,0x86,0x3,0x86,0x4,0x86,0x4,0xc0,0xc0,0x86,0x3,0x86,0x2,0x86,0x1,0x86,0x5,0x86,0x6,0x86,0x7,0x86,0x8,0x86,0x8,0xc0,0xc0,0x86,0x7,0x86,0x6,0x86,0x5,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x86,0x9,0xd,0x85,0x7b,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x86,0xa,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x17,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x85,0x7d,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x85,0x7e,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x65,0x76,0x67,0x65,0x74,0xc1,0x1,0x42,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x86,0xd,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0xe,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0xe,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x40,0x40,0xc1,0x40,0x66,0xc1,0x40,0x7a,0xc1,0x40,0x9a,0xc1,0x40,0xa8,0xc1,0x40,0x9e,0xc1,0x40,0xce,0xc1,0x40,0xee,0xc1,0x40,0xfc,0xc1,0x40,0xf2,0x39,0x86,0x11,0x86,0x12,0x86,0x12,0x86,0x12,0x86,0x11,0x86,0x13,0x86,0x14,0x86,0x15,0x86,0x16,0x86,0x16,0xc0,0xc0,0x86,0x15,0x86,0x14,0x86,0x13,0x86,0x17,0x86,0x18,0x86,0x19,0x86,0x1a,0x86,0x1a,0xc0,0xc0,0x86,0x19,0x86,0x18,0x86,0x17,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x86,0x1b,0xd,0x86,0xd,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x86,0x1c,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x18,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0xf,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0x10,0xd3,0xd3,0xd3,0xd3,0x0,0x7,0x65,0x76,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x44,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x86,0x1f,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x20,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x20,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x41,0x5a,0xc1,0x41,0x80,0xc1,0x41,0x94,0xc1,0x41,0xb4,0xc1,0x41,0xc2,0xc1,0x41,0xb8,0xc1,0x41,0xe8,0xc1,0x42,0x8,0xc1,0x42,0x16,0xc1,0x42,0xc,0x39,0x86,0x23,0x86,0x24,0x86,0x24,0x86,0x24,0x86,0x23,0x86,0x25,0x86,0x26,0x86,0x27,0x86,0x28,0x86,0x28,0xc0,0xc0,0x86,0x27,0x86,0x26,0x86,0x25,0x86,0x29,0x86,0x2a,0x86,0x2b,0x86,0x2c,0x86,0x2c,0xc0,0xc0,0x86,0x2b,0x86,0x2a,0x86,0x29,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x86,0x2d,0xd,0x86,0x1f,0xe5,0x61,0xc3,0xc4,0xc4,0xc4,0x86,0x2e,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x19,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0x21,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0x22,0xd3,0xd3,0xd3,0xd3,0x0,0x8,0x65,0x76,0x72,0x73,0x74,0x6f,0x72,0x65,0xc1,0x1,0x46,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x86,0x31,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x32,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x32,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x32,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x42,0x74,0xc1,0x42,0x9a,0xc1,0x42,0xae,0xc1,0x42,0xce,0xc1,0x42,0xdc,0xc1,0x42,0xd2,0xc1,0x43,0x2,0xc1,0x43,0x22,0xc1,0x43,0x30,0xc1,0x43,0x26,0xc1,0x43,0x56,0xc1,0x43,0x76,0xc1,0x43,0x84,0xc1,0x43,0x7a,0xe1,0x23,0x86,0x36,0x86,0x37,0x86,0x37,0x86,0x37,0x86,0x36,0x86,0x38,0x86,0x39,0x86,0x3a,0x86,0x3b,0x86,0x3b,0xc0,0xc0,0x86,0x3a,0x86,0x39,0x86,0x38,0x86,0x3c,0x86,0x3d,0x86,0x3e,0x86,0x3f,0x86,0x3f,0xc0,0xc0,0x86,0x3e,0x86,0x3d,0x86,0x3c,0x86,0x40,0x86,0x41,0x86,0x42,0x86,0x43,0x86,0x43,0xc0,0xc0,0x86,0x42,0x86,0x41,0x86,0x40,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x86,0x44,0xd,0x86,0x31,0xe5,0x81,0x5,0xc3,0xc4,0xc4,0xc4,0x86,0x45,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc4,0x1a,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0x33,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0x34,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0x35,0xd3,0xd3,0xd3,0xd3,0x0,0xc0,0x36,0xc1,0x43,0xe6,0xc1,0x44,0x0,0x25,0x86,0x48,0x86,0x49,0x86,0x49,0x86,0x49,0x86,0x48,0xc1,0x1,0x4a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x86,0x4a,0xd,0x86,0x4b,0xb7,0xc3,0xc4,0xc4,0xc4,0x86,0x4c,0xe1,0x1,0xc9,0x1,0x8,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc6,0x86,0x47,0xd3,0xd3,0x0,0x5,0x6a,0x75,0x6d,0x70,0x74,0xc0,0x38,0xc1,0x44,0x4e,0xc1,0x44,0x68,0x25,0x86,0x50,0x86,0x51,0x86,0x51,0x86,0x51,0x86,0x50,0xc1,0x1,0x4c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x86,0x52,0xd,0x86,0x53,0xb7,0xc3,0xc4,0xc4,0xc4,0x86,0x54,0xe1,0x1,0xc9,0x1,0x8,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc6,0x86,0x4f,0xd3,0xd3,0x0,0x5,0x6a,0x75,0x6d,0x70,0x66,0xc0,0x3a,0xc1,0x44,0xb6,0xc1,0x44,0xd0,0x25,0x86,0x58,0x86,0x59,0x86,0x59,0x86,0x59,0x86,0x58,0xc1,0x1,0x4e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x86,0x5a,0xd,0x86,0x5b,0xb7,0xc3,0xc4,0xc4,0xc4,0x86,0x5c,0xe1,0x1,0xc9,0x1,0x8,0xe1,0x2,0xc7,0x9,0xc6,0x3,0xc6,0x86,0x57,0xd3,0xd3,0x0,0x5,0x6c,0x61,0x62,0x65,0x6c,0x3,0x73,0x65,0x74,0xc1,0x1,0x50,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x86,0x60,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x61,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x45,0x22,0xc1,0x45,0x30,0xc1,0x45,0x26,0xc1,0x45,0x5c,0xc1,0x45,0x66,0x2d,0x86,0x63,0x86,0x64,0x86,0x65,0x86,0x65,0xc0,0xc0,0x86,0x64,0x86,0x66,0x86,0x66,0x86,0x67,0x86,0x67,0x86,0x66,0x86,0x63,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x86,0x68,0xd,0x86,0x60,0xe5,0x36,0xc3,0xc4,0xc4,0xc4,0x86,0x69,0xe0,0x2,0xc9,0x1,0x5,0xc6,0x86,0x5f,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0x62,0xd3,0xd3,0xe1,0x2,0xc7,0x9,0xc9,0x1,0x7,0xe0,0x0,0xc9,0x1,0x0,0xc6,0x81,0x44,0xd3,0xd3,0xd3,0x0,0xc1,0x1,0x52,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x86,0x6b,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x6c,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x6c,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x45,0xb6,0xc1,0x45,0xcc,0xc1,0x45,0xc2,0xc1,0x45,0xf4,0xc1,0x46,0xa,0xc1,0x46,0x0,0x30,0x86,0x6f,0x86,0x70,0x86,0x71,0x86,0x71,0xc0,0xc0,0x86,0x70,0x86,0x6f,0x86,0x72,0x86,0x73,0x86,0x74,0x86,0x74,0xc0,0xc0,0x86,0x73,0x86,0x72,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x86,0x75,0xd,0x86,0x6b,0xe5,0x41,0xc3,0xc4,0xc4,0xc4,0x86,0x76,0xe0,0x1,0xc9,0x1,0x6,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0x6d,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x6,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0x6e,0xd3,0xd3,0xd3,0x0,0x5,0x6d,0x63,0x61,0x6c,0x6c,0xc1,0x1,0x56,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x86,0x79,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x7a,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x86,0x7a,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x46,0x96,0xc1,0x46,0xac,0xc1,0x46,0xa2,0xc1,0x46,0xd0,0xc1,0x46,0xf6,0xc1,0x47,0x8,0xc1,0x47,0x28,0xc1,0x47,0x36,0xc1,0x47,0x2c,0x37,0x86,0x7d,0x86,0x7e,0x86,0x7f,0x86,0x7f,0xc0,0xc0,0x86,0x7e,0x86,0x7d,0x87,0x0,0x87,0x1,0x87,0x1,0x87,0x1,0x87,0x0,0x87,0x2,0x87,0x3,0x87,0x4,0x87,0x5,0x87,0x5,0xc0,0xc0,0x87,0x4,0x87,0x3,0x87,0x2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x87,0x6,0xd,0x86,0x79,0xe5,0x5b,0xc3,0xc4,0xc4,0xc4,0x87,0x7,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0x7b,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x82,0x47,0xc4,0x0,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x86,0x7c,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x6d,0x63,0x61,0x6c,0x6c,0x73,0xc1,0x1,0x58,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x87,0xa,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0xb,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x1,0xd0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0xb,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x47,0x96,0xc1,0x47,0xac,0xc1,0x47,0xa2,0xc1,0x47,0xd0,0xc1,0x47,0xf6,0xc1,0x48,0x8,0xc1,0x48,0x28,0xc1,0x48,0x36,0xc1,0x48,0x2c,0x37,0x87,0xf,0x87,0x10,0x87,0x11,0x87,0x11,0xc0,0xc0,0x87,0x10,0x87,0xf,0x87,0x12,0x87,0x13,0x87,0x13,0x87,0x13,0x87,0x12,0x87,0x14,0x87,0x15,0x87,0x16,0x87,0x17,0x87,0x17,0xc0,0xc0,0x87,0x16,0x87,0x15,0x87,0x14,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x87,0x18,0xd,0x87,0xa,0xe5,0x5b,0xc3,0xc4,0xc4,0xc4,0x87,0x19,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0xc,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x87,0xd,0xc4,0x0,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0xe,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x66,0x63,0x61,0x6c,0x6c,0xc1,0x1,0x5a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x87,0x1c,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x1d,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x1d,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x48,0x96,0xc1,0x48,0xac,0xc1,0x48,0xa2,0xc1,0x48,0xd0,0xc1,0x48,0xf6,0xc1,0x49,0x8,0xc1,0x49,0x28,0xc1,0x49,0x36,0xc1,0x49,0x2c,0x37,0x87,0x20,0x87,0x21,0x87,0x22,0x87,0x22,0xc0,0xc0,0x87,0x21,0x87,0x20,0x87,0x23,0x87,0x24,0x87,0x24,0x87,0x24,0x87,0x23,0x87,0x25,0x87,0x26,0x87,0x27,0x87,0x28,0x87,0x28,0xc0,0xc0,0x87,0x27,0x87,0x26,0x87,0x25,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x87,0x29,0xd,0x87,0x1c,0xe5,0x5b,0xc3,0xc4,0xc4,0xc4,0x87,0x2a,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x1e,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x82,0x47,0xc4,0x1,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x1f,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x62,0x63,0x61,0x6c,0x6c,0xc1,0x1,0x5c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x87,0x2d,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x2e,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x2e,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x49,0x96,0xc1,0x49,0xac,0xc1,0x49,0xa2,0xc1,0x49,0xd0,0xc1,0x49,0xf6,0xc1,0x4a,0x8,0xc1,0x4a,0x28,0xc1,0x4a,0x36,0xc1,0x4a,0x2c,0x37,0x87,0x31,0x87,0x32,0x87,0x33,0x87,0x33,0xc0,0xc0,0x87,0x32,0x87,0x31,0x87,0x34,0x87,0x35,0x87,0x35,0x87,0x35,0x87,0x34,0x87,0x36,0x87,0x37,0x87,0x38,0x87,0x39,0x87,0x39,0xc0,0xc0,0x87,0x38,0x87,0x37,0x87,0x36,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x87,0x3a,0xd,0x87,0x2d,0xe5,0x5b,0xc3,0xc4,0xc4,0xc4,0x87,0x3b,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x2f,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x82,0x47,0xc4,0x2,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x30,0xd3,0xd3,0xd3,0xd3,0x0,0x5,0x63,0x63,0x61,0x6c,0x6c,0xc1,0x1,0x5e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x87,0x3e,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x3f,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x3f,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x4a,0x96,0xc1,0x4a,0xac,0xc1,0x4a,0xa2,0xc1,0x4a,0xd0,0xc1,0x4a,0xf6,0xc1,0x4b,0x8,0xc1,0x4b,0x28,0xc1,0x4b,0x36,0xc1,0x4b,0x2c,0x37,0x87,0x42,0x87,0x43,0x87,0x44,0x87,0x44,0xc0,0xc0,0x87,0x43,0x87,0x42,0x87,0x45,0x87,0x46,0x87,0x46,0x87,0x46,0x87,0x45,0x87,0x47,0x87,0x48,0x87,0x49,0x87,0x4a,0x87,0x4a,0xc0,0xc0,0x87,0x49,0x87,0x48,0x87,0x47,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x87,0x4b,0xd,0x87,0x3e,0xe5,0x5b,0xc3,0xc4,0xc4,0xc4,0x87,0x4c,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x40,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x82,0x47,0xc4,0x3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x41,0xd3,0xd3,0xd3,0xd3,0x0,0x6,0x6d,0x63,0x61,0x6c,0x6c,0x6e,0xc1,0x1,0x60,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x87,0x4f,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x50,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x1,0xe0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x50,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x50,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0x2,0x6e,0x73,0xc1,0x4b,0x96,0xc1,0x4b,0xac,0xc1,0x4b,0xa2,0xc1,0x4b,0xd0,0xc1,0x4b,0xf6,0xc1,0x4c,0x8,0xc1,0x4c,0x28,0xc1,0x4c,0x36,0xc1,0x4c,0x2c,0xc1,0x4c,0x5c,0xc1,0x4c,0x70,0xc1,0x4c,0xa0,0xc1,0x4c,0x88,0xc1,0x4c,0x7e,0xe1,0x23,0x87,0x56,0x87,0x57,0x87,0x58,0x87,0x58,0xc0,0xc0,0x87,0x57,0x87,0x56,0x87,0x59,0x87,0x5a,0x87,0x5a,0x87,0x5a,0x87,0x59,0x87,0x5b,0x87,0x5c,0x87,0x5d,0x87,0x5e,0x87,0x5e,0xc0,0xc0,0x87,0x5d,0x87,0x5c,0x87,0x5b,0x87,0x5f,0x87,0x60,0x87,0x61,0x87,0x62,0x87,0x63,0x87,0x63,0xc0,0xc0,0x87,0x62,0x87,0x61,0x87,0x60,0x87,0x5f,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x87,0x64,0xd,0x87,0x4f,0xe5,0x81,0x8,0xc3,0xc4,0xc4,0xc4,0x87,0x65,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x51,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x87,0x52,0xc4,0x0,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x53,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x83,0x5f,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x54,0xd3,0xd3,0xc6,0x87,0x55,0xd3,0xd3,0xd3,0x0,0x7,0x6d,0x63,0x61,0x6c,0x6c,0x6e,0x73,0xc1,0x1,0x62,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x87,0x68,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x69,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x1,0xf0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x69,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x87,0x69,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x4c,0xee,0xc1,0x4d,0x4,0xc1,0x4c,0xfa,0xc1,0x4d,0x28,0xc1,0x4d,0x4e,0xc1,0x4d,0x60,0xc1,0x4d,0x80,0xc1,0x4d,0x8e,0xc1,0x4d,0x84,0xc1,0x4d,0xb4,0xc1,0x4d,0xc8,0xc1,0x4d,0xf8,0xc1,0x4d,0xe0,0xc1,0x4d,0xd6,0xe1,0x23,0x87,0x6e,0x87,0x6f,0x87,0x70,0x87,0x70,0xc0,0xc0,0x87,0x6f,0x87,0x6e,0x87,0x71,0x87,0x72,0x87,0x72,0x87,0x72,0x87,0x71,0x87,0x73,0x87,0x74,0x87,0x75,0x87,0x76,0x87,0x76,0xc0,0xc0,0x87,0x75,0x87,0x74,0x87,0x73,0x87,0x77,0x87,0x78,0x87,0x79,0x87,0x7a,0x87,0x7b,0x87,0x7b,0xc0,0xc0,0x87,0x7a,0x87,0x79,0x87,0x78,0x87,0x77,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x87,0x7c,0xd,0x87,0x68,0xe5,0x81,0x8,0xc3,0xc4,0xc4,0xc4,0x87,0x7d,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x6a,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x87,0x6b,0xc4,0x0,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x6c,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x83,0x5f,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x87,0x6d,0xd3,0xd3,0xc6,0x87,0x55,0xd3,0xd3,0xd3,0x0,0x6,0x66,0x63,0x61,0x6c,0x6c,0x6e,0xc1,0x1,0x64,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x88,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x1,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x1,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x1,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x4e,0x46,0xc1,0x4e,0x5c,0xc1,0x4e,0x52,0xc1,0x4e,0x80,0xc1,0x4e,0xa6,0xc1,0x4e,0xb8,0xc1,0x4e,0xd8,0xc1,0x4e,0xe6,0xc1,0x4e,0xdc,0xc1,0x4f,0xc,0xc1,0x4f,0x20,0xc1,0x4f,0x50,0xc1,0x4f,0x38,0xc1,0x4f,0x2e,0xe1,0x23,0x88,0x5,0x88,0x6,0x88,0x7,0x88,0x7,0xc0,0xc0,0x88,0x6,0x88,0x5,0x88,0x8,0x88,0x9,0x88,0x9,0x88,0x9,0x88,0x8,0x88,0xa,0x88,0xb,0x88,0xc,0x88,0xd,0x88,0xd,0xc0,0xc0,0x88,0xc,0x88,0xb,0x88,0xa,0x88,0xe,0x88,0xf,0x88,0x10,0x88,0x11,0x88,0x12,0x88,0x12,0xc0,0xc0,0x88,0x11,0x88,0x10,0x88,0xf,0x88,0xe,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x88,0x13,0xd,0x88,0x0,0xe5,0x81,0x8,0xc3,0xc4,0xc4,0xc4,0x88,0x14,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x88,0x2,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x87,0x52,0xc4,0x1,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x88,0x3,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x83,0x5f,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x88,0x4,0xd3,0xd3,0xc6,0x87,0x55,0xd3,0xd3,0xd3,0x0,0x6,0x62,0x63,0x61,0x6c,0x6c,0x6e,0xc1,0x1,0x66,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x88,0x17,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x18,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x18,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xb4,0xc3,0xc4,0xc4,0xc4,0x88,0x18,0xe1,0x2,0xc7,0x9,0xc9,0x2,0x1,0xc4,0x1,0xd3,0xd9,0x2,0x1,0x0,0xc1,0x4f,0x9e,0xc1,0x4f,0xb4,0xc1,0x4f,0xaa,0xc1,0x4f,0xd8,0xc1,0x4f,0xfe,0xc1,0x50,0x10,0xc1,0x50,0x30,0xc1,0x50,0x3e,0xc1,0x50,0x34,0xc1,0x50,0x64,0xc1,0x50,0x78,0xc1,0x50,0xa8,0xc1,0x50,0x90,0xc1,0x50,0x86,0xe1,0x23,0x88,0x1c,0x88,0x1d,0x88,0x1e,0x88,0x1e,0xc0,0xc0,0x88,0x1d,0x88,0x1c,0x88,0x1f,0x88,0x20,0x88,0x20,0x88,0x20,0x88,0x1f,0x88,0x21,0x88,0x22,0x88,0x23,0x88,0x24,0x88,0x24,0xc0,0xc0,0x88,0x23,0x88,0x22,0x88,0x21,0x88,0x25,0x88,0x26,0x88,0x27,0x88,0x28,0x88,0x29,0x88,0x29,0xc0,0xc0,0x88,0x28,0x88,0x27,0x88,0x26,0x88,0x25,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x88,0x2a,0xd,0x88,0x17,0xe5,0x81,0x8,0xc3,0xc4,0xc4,0xc4,0x88,0x2b,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x3e,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x88,0x19,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xc6,0x87,0x52,0xc4,0x2,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x88,0x1a,0xd3,0xd3,0xd3,0xd3,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x83,0x5f,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x88,0x1b,0xd3,0xd3,0xc6,0x87,0x55,0xd3,0xd3,0xd3,0x0,0x5,0x74,0x68,0x72,0x6f,0x77,0xb,0x5f,0x53,0x74,0x72,0x69,0x6e,0x67,0x5f,0x63,0x61,0x74,0xc,0x75,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x6f,0x70,0x3a,0x20,0x1,0x20,0x4,0x72,0x65,0x70,0x72,0xc1,0x51,0x28,0xc1,0x51,0x20,0x23,0x88,0x32,0x88,0x33,0x88,0x32,0xc1,0x1,0x6a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x88,0x34,0xd,0x88,0x35,0xaf,0xc3,0xc4,0xc4,0xc4,0x88,0x36,0xe1,0x1,0xc7,0x1b,0xc9,0x1,0x0,0xd3,0x0,0xc1,0x50,0xf8,0xc1,0x50,0xee,0x28,0x88,0x38,0x88,0x39,0xc0,0xc0,0xc0,0xc0,0xc0,0x88,0x38,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x88,0x3a,0xd,0x88,0x35,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x88,0x3b,0xe1,0x1,0xc7,0x19,0xe1,0x4,0xc7,0x1a,0xc6,0x88,0x2f,0xc9,0x0,0x0,0xc6,0x88,0x30,0xe1,0x0,0xd0,0x88,0x37,0xd3,0xd3,0xd3,0x0,0x21,0xc1,0xc1,0x2b,0xc,0xc1,0x2b,0x2,0xc1,0x2b,0x40,0xc1,0x2b,0xda,0xc1,0x2d,0xe,0xc1,0x2e,0x3c,0xc1,0x2f,0xda,0xc1,0x31,0xe0,0xc1,0x32,0x4e,0xc1,0x32,0xbc,0xc1,0x33,0x2a,0xc1,0x33,0x98,0xc1,0x34,0x5a,0xc1,0x35,0x70,0xc1,0x36,0x86,0xc1,0x37,0x4a,0xc1,0x38,0xe,0xc1,0x38,0x7e,0xc1,0x39,0x42,0xc1,0x39,0xb2,0xc1,0x3a,0x78,0xc1,0x3b,0x3c,0xc1,0x3c,0x54,0xc1,0x3d,0x2,0xc1,0x3d,0x74,0xc1,0x3e,0x3a,0xc1,0x3f,0x0,0xc1,0x40,0x1a,0xc1,0x41,0x34,0xc1,0x42,0x4e,0xc1,0x43,0xbe,0xc1,0x44,0x26,0xc1,0x44,0x8e,0xc1,0x44,0xf6,0xc1,0x45,0x8c,0xc1,0x46,0x6e,0xc1,0x47,0x6e,0xc1,0x48,0x6e,0xc1,0x49,0x6e,0xc1,0x4a,0x6e,0xc1,0x4b,0x6e,0xc1,0x4c,0xc6,0xc1,0x4e,0x1e,0xc1,0x4f,0x76,0xe1,0x81,0x5a,0x88,0x3e,0x88,0x3f,0x88,0x3f,0xc0,0xc0,0x88,0x3e,0x88,0x40,0x88,0x40,0x88,0x40,0xc0,0xc0,0x88,0x41,0x88,0x41,0x88,0x41,0xc0,0xc0,0x88,0x42,0x88,0x42,0x88,0x42,0xc0,0xc0,0x88,0x43,0x88,0x43,0x88,0x43,0xc0,0xc0,0x88,0x44,0x88,0x44,0x88,0x44,0xc0,0xc0,0x88,0x45,0x88,0x45,0x88,0x45,0xc0,0xc0,0x88,0x46,0x88,0x46,0x88,0x46,0xc0,0xc0,0x88,0x47,0x88,0x47,0x88,0x47,0xc0,0xc0,0x88,0x48,0x88,0x48,0x88,0x48,0xc0,0xc0,0x88,0x49,0x88,0x49,0x88,0x49,0xc0,0xc0,0x88,0x4a,0x88,0x4a,0x88,0x4a,0xc0,0xc0,0x88,0x4b,0x88,0x4b,0x88,0x4b,0xc0,0xc0,0x88,0x4c,0x88,0x4c,0x88,0x4c,0xc0,0xc0,0x88,0x4d,0x88,0x4d,0x88,0x4d,0xc0,0xc0,0x88,0x4e,0x88,0x4e,0x88,0x4e,0xc0,0xc0,0x88,0x4f,0x88,0x4f,0x88,0x4f,0xc0,0xc0,0x88,0x50,0x88,0x50,0x88,0x50,0xc0,0xc0,0x88,0x51,0x88,0x51,0x88,0x51,0xc0,0xc0,0x88,0x52,0x88,0x52,0x88,0x52,0xc0,0xc0,0x88,0x53,0x88,0x53,0x88,0x53,0xc0,0xc0,0x88,0x54,0x88,0x54,0x88,0x54,0xc0,0xc0,0x88,0x55,0x88,0x55,0x88,0x55,0xc0,0xc0,0x88,0x56,0x88,0x56,0x88,0x56,0xc0,0xc0,0x88,0x57,0x88,0x57,0x88,0x57,0xc0,0xc0,0x88,0x58,0x88,0x58,0x88,0x58,0xc0,0xc0,0x88,0x59,0x88,0x59,0x88,0x59,0xc0,0xc0,0x88,0x5a,0x88,0x5a,0x88,0x5a,0xc0,0xc0,0x88,0x5b,0x88,0x5b,0x88,0x5b,0xc0,0xc0,0x88,0x5c,0x88,0x5c,0x88,0x5c,0xc0,0xc0,0x88,0x5d,0x88,0x5d,0x88,0x5d,0xc0,0xc0,0x88,0x5e,0x88,0x5e,0x88,0x5e,0xc0,0xc0,0x88,0x5f,0x88,0x5f,0x88,0x5f,0xc0,0xc0,0x88,0x60,0x88,0x60,0x88,0x60,0xc0,0xc0,0x88,0x61,0x88,0x61,0x88,0x61,0xc0,0xc0,0x88,0x62,0x88,0x62,0x88,0x62,0xc0,0xc0,0x88,0x63,0x88,0x63,0x88,0x63,0xc0,0xc0,0x88,0x64,0x88,0x64,0x88,0x64,0xc0,0xc0,0x88,0x65,0x88,0x65,0x88,0x65,0xc0,0xc0,0x88,0x66,0x88,0x66,0x88,0x66,0xc0,0xc0,0x88,0x67,0x88,0x67,0x88,0x67,0xc0,0xc0,0x88,0x68,0x88,0x68,0x88,0x68,0xc0,0xc0,0x88,0x69,0x88,0x69,0x88,0x69,0xc0,0xc0,0xc0,0xc0,0xc0,0xf0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x88,0x6a,0xd,0x88,0x6b,0xe5,0x85,0x47,0xc3,0xc4,0x83,0x44,0x88,0x3d,0x88,0x6c,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x83,0x3c,0xd3,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x83,0x55,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x83,0x56,0xd3,0xe3,0x0,0xd0,0x83,0x5d,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x83,0x5e,0xd3,0xe3,0x0,0xd0,0x83,0x6b,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x83,0x5f,0xd3,0xe3,0x0,0xd0,0x83,0x78,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x83,0x79,0xd3,0xe3,0x0,0xd0,0x84,0xb,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0xc,0xd3,0xe3,0x0,0xd0,0x84,0x1f,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x20,0xd3,0xe3,0x0,0xd0,0x84,0x26,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x68,0xd3,0xe3,0x0,0xd0,0x84,0x2c,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x2d,0xd3,0xe3,0x0,0xd0,0x84,0x33,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x34,0xd3,0xe3,0x0,0xd0,0x84,0x3a,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x3b,0xd3,0xe3,0x0,0xd0,0x84,0x47,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x48,0xd3,0xe3,0x0,0xd0,0x84,0x59,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x5a,0xd3,0xe3,0x0,0xd0,0x84,0x6b,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x6c,0xd3,0xe3,0x0,0xd0,0x84,0x78,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x84,0x79,0xd3,0xe3,0x0,0xd0,0x85,0x5,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x6,0xd3,0xe3,0x0,0xd0,0x85,0xc,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0xd,0xd3,0xe3,0x0,0xd0,0x85,0x19,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x1a,0xd3,0xe3,0x0,0xd0,0x85,0x20,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x21,0xd3,0xe3,0x0,0xd0,0x85,0x2d,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x2e,0xd3,0xe3,0x0,0xd0,0x85,0x3a,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x3b,0xd3,0xe3,0x0,0xd0,0x85,0x4c,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x4d,0xd3,0xe3,0x0,0xd0,0x85,0x58,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x59,0xd3,0xe3,0x0,0xd0,0x85,0x5f,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x60,0xd3,0xe3,0x0,0xd0,0x85,0x6c,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x6d,0xd3,0xe3,0x0,0xd0,0x85,0x79,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x85,0x7a,0xd3,0xe3,0x0,0xd0,0x86,0xb,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0xc,0xd3,0xe3,0x0,0xd0,0x86,0x1d,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x1e,0xd3,0xe3,0x0,0xd0,0x86,0x2f,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x30,0xd3,0xe3,0x0,0xd0,0x86,0x46,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x83,0x42,0xd3,0xe3,0x0,0xd0,0x86,0x4d,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x4e,0xd3,0xe3,0x0,0xd0,0x86,0x55,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x56,0xd3,0xe3,0x0,0xd0,0x86,0x5d,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x5e,0xd3,0xe3,0x0,0xd0,0x86,0x6a,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x83,0x52,0xd3,0xe3,0x0,0xd0,0x86,0x77,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x86,0x78,0xd3,0xe3,0x0,0xd0,0x87,0x8,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x9,0xd3,0xe3,0x0,0xd0,0x87,0x1a,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x1b,0xd3,0xe3,0x0,0xd0,0x87,0x2b,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x2c,0xd3,0xe3,0x0,0xd0,0x87,0x3c,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x3d,0xd3,0xe3,0x0,0xd0,0x87,0x4d,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x4e,0xd3,0xe3,0x0,0xd0,0x87,0x66,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x67,0xd3,0xe3,0x0,0xd0,0x87,0x7e,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x87,0x7f,0xd3,0xe3,0x0,0xd0,0x88,0x15,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x88,0x16,0xd3,0xe3,0x0,0xd0,0x88,0x2c,0xd3,0xc0,0xe3,0x0,0xd0,0x88,0x3c,0xd3,0xd4,0x0,0x2,0x67,0x74,0x6,0x69,0x73,0x4c,0x69,0x73,0x74,0xc1,0x1,0xfe,0x2,0x61,0x74,0x21,0x88,0x71,0xc1,0x52,0x48,0xc1,0x52,0x52,0xc1,0x52,0x82,0xc1,0x52,0x98,0xc1,0x52,0xa8,0xc1,0x52,0xc6,0xc1,0x52,0xbc,0xc1,0x52,0xda,0x34,0x88,0x73,0x88,0x74,0x88,0x74,0x88,0x73,0x88,0x75,0x88,0x76,0x88,0x76,0x88,0x77,0x88,0x77,0x88,0x77,0x88,0x78,0x88,0x78,0x88,0x79,0x88,0x79,0x88,0x79,0x88,0x78,0x88,0x7a,0x88,0x7a,0x88,0x7a,0x88,0x75,0xc1,0x1,0x76,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x88,0x7b,0xd,0x88,0x7c,0xe5,0x57,0xc3,0xc4,0x88,0x72,0x88,0x3d,0x88,0x7d,0xe0,0x1,0xc9,0x1,0x5,0xc6,0x83,0x3d,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x83,0x3d,0xc4,0x2,0xd3,0xd3,0xd1,0x0,0xe0,0x4,0xc9,0x1,0x0,0xc6,0x82,0x64,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x0,0xc4,0x10,0xd3,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0xc,0xcb,0x0,0xc4,0x8,0xd3,0xc6,0x88,0x70,0xd3,0xe1,0x2,0xc7,0xf,0xcb,0x0,0xc6,0x88,0x70,0xd3,0xd3,0x0,0xc1,0x53,0x2a,0x22,0x88,0x7f,0x88,0x7f,0xc1,0x1,0x7a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x89,0x0,0xd,0x89,0x1,0xb3,0xc3,0xc4,0xc4,0xc4,0x89,0x2,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x82,0x64,0xc8,0x0,0x0,0xd3,0x0,0x4,0x70,0x61,0x72,0x74,0x21,0x89,0x4,0x21,0x89,0x5,0xc1,0x51,0xfe,0xc1,0x51,0xf2,0x27,0x89,0x7,0x89,0x8,0x89,0x7,0xc0,0xc0,0xc0,0xc0,0xc1,0x1,0x72,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x89,0x9,0xd,0x89,0xa,0xbd,0xc3,0x89,0x6,0xc4,0xc4,0x89,0xb,0xe1,0x1,0xc7,0x1d,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x88,0x7e,0xd3,0xc0,0xe3,0x0,0xd0,0x89,0x3,0xd3,0xd4,0x0,0x4,0x6e,0x61,0x6d,0x65,0x8,0x61,0x72,0x67,0x73,0x70,0x65,0x63,0x73,0x6,0x6c,0x6f,0x63,0x61,0x6c,0x73,0x9,0x6c,0x6f,0x63,0x61,0x6c,0x76,0x61,0x72,0x73,0xc1,0x55,0x28,0xc1,0x55,0x3c,0xc1,0x55,0x52,0x26,0x89,0x11,0x89,0x12,0x89,0x13,0x89,0x13,0x89,0x12,0x89,0x11,0xc1,0x1,0x88,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x89,0x14,0xd,0x89,0x15,0xe5,0x22,0xc3,0xc4,0xc4,0xc4,0x89,0x16,0xe0,0x1,0xc9,0x0,0x9,0xc6,0x82,0x64,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x83,0x5f,0xe8,0x0,0xc8,0x0,0x2,0xc6,0x89,0x10,0xd3,0xd3,0xd3,0x0,0xc1,0x55,0xfe,0xc1,0x56,0x12,0x24,0x89,0x18,0x89,0x19,0x89,0x19,0x89,0x18,0xc1,0x1,0x8c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x89,0x1a,0xd,0x89,0x1b,0xba,0xc3,0xc4,0xc4,0xc4,0x89,0x1c,0xe0,0x1,0xc9,0x0,0x9,0xc6,0x82,0x64,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x83,0x5f,0xc2,0xd3,0xd3,0x0,0x6,0x4f,0x62,0x6a,0x65,0x63,0x74,0x2,0x6f,0x72,0x9,0x64,0x65,0x62,0x75,0x67,0x69,0x6e,0x66,0x6f,0x64,0x4,0xc0,0x7,0xc0,0x8,0xc0,0x9,0xc0,0x6,0x74,0x6f,0x4c,0x69,0x73,0x74,0x5,0x6f,0x75,0x74,0x65,0x72,0x3,0x6d,0x61,0x70,0xc1,0x57,0x78,0x22,0x89,0x25,0x89,0x25,0xc1,0x1,0x8e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x89,0x26,0xd,0x89,0x27,0xb3,0xc3,0x82,0x77,0xc4,0xc4,0x89,0x28,0xe0,0x1,0xc9,0x0,0x5,0xc6,0x83,0x3d,0xca,0x0,0xd3,0x0,0xc1,0x1,0xca,0x9,0x77,0x72,0x69,0x74,0x65,0x43,0x6f,0x64,0x65,0x3,0x6d,0x6f,0x64,0x21,0x89,0x2c,0x1,0x63,0x21,0x89,0x2e,0x5,0x73,0x63,0x6f,0x70,0x65,0x21,0x89,0x30,0x23,0x89,0x2d,0x89,0x2f,0x89,0x31,0x3,0x24,0x70,0x63,0x8,0x24,0x65,0x73,0x63,0x61,0x70,0x65,0x73,0x5,0x63,0x61,0x6c,0x6c,0x73,0x5,0x70,0x61,0x72,0x74,0x73,0x6,0x6c,0x61,0x62,0x65,0x6c,0x73,0x5,0x24,0x62,0x61,0x73,0x65,0x4,0x68,0x65,0x61,0x64,0x2b,0x82,0x78,0x89,0x33,0x89,0x34,0x89,0x35,0x89,0x36,0x89,0x37,0x8,0x89,0x38,0x83,0x42,0x89,0x39,0x89,0x20,0x2b,0xc1,0xc2,0xc2,0xc1,0xc1,0xc1,0xc1,0xc2,0xc1,0xc1,0xc1,0xc1,0x27,0x70,0xc1,0x27,0x64,0xc1,0x28,0x76,0xc1,0x28,0x6c,0xc1,0x29,0x58,0xc1,0x29,0x4e,0xc1,0x29,0x8a,0xc1,0x29,0x7c,0xc1,0x29,0xb6,0xc1,0x29,0xac,0xc1,0x2a,0xda,0xc1,0x51,0x5c,0xc1,0x51,0x50,0xc1,0x51,0x80,0xc1,0x51,0x90,0xc1,0x51,0xb8,0xc1,0x53,0x68,0xc1,0x53,0x5c,0xc1,0x53,0x82,0xc1,0x53,0x96,0xc1,0x53,0xa4,0xc1,0x53,0xc4,0xc1,0x53,0xd8,0xc1,0x53,0xe6,0xc1,0x54,0xbc,0xc1,0x54,0xd0,0xc1,0x54,0xde,0xc1,0x56,0x58,0xc1,0x56,0x4c,0xc1,0x56,0x7a,0xc1,0x56,0x64,0xc1,0x56,0x9c,0xc1,0x56,0xbe,0xc1,0x57,0x30,0xc1,0x56,0xfa,0xc1,0x57,0x24,0xc1,0x57,0x18,0xc1,0x57,0xc,0xc1,0x57,0x58,0xc1,0x57,0x96,0xc1,0x57,0xaa,0xc1,0x58,0x8,0xc1,0x57,0xf2,0xc1,0x57,0xe6,0xc1,0x57,0xfc,0xc1,0x58,0x20,0xc1,0x58,0x28,0xc1,0x58,0x22,0xc1,0x58,0x42,0xc1,0x58,0x5c,0xc1,0x58,0x50,0xc1,0x58,0x66,0xc1,0x58,0xa0,0xc1,0x58,0xa8,0xc1,0x58,0xa2,0xc1,0x58,0xd6,0xc1,0x58,0xec,0xc1,0x58,0xe0,0xc1,0x58,0xf6,0xe1,0x81,0x5,0x89,0x3c,0x89,0x3d,0x89,0x3c,0x89,0x3e,0x89,0x3f,0x89,0x3e,0x89,0x40,0x89,0x41,0x89,0x40,0x89,0x42,0x89,0x43,0x89,0x42,0x89,0x44,0x89,0x45,0x89,0x44,0x89,0x46,0x89,0x46,0x89,0x46,0x89,0x47,0x89,0x47,0x89,0x48,0x89,0x48,0x89,0x47,0x89,0x49,0x89,0x4a,0x89,0x4a,0x89,0x49,0x89,0x4b,0x89,0x4b,0x89,0x4c,0x89,0x4d,0x89,0x4c,0x89,0x4e,0x89,0x4f,0x89,0x50,0x89,0x50,0x89,0x4f,0x89,0x4e,0x89,0x51,0x89,0x52,0x89,0x53,0x89,0x53,0x89,0x52,0x89,0x51,0x89,0x54,0x89,0x55,0x89,0x56,0x89,0x56,0x89,0x55,0x89,0x54,0xc0,0xc0,0xc0,0xc0,0x89,0x57,0x89,0x58,0x89,0x59,0x89,0x59,0x89,0x5a,0x89,0x5a,0xc0,0xc0,0xc0,0x89,0x59,0xc0,0xc0,0x89,0x5b,0x89,0x5b,0x89,0x5c,0x89,0x5c,0x89,0x5c,0x89,0x5d,0x89,0x5d,0x89,0x5e,0x89,0x5e,0x89,0x5f,0x89,0x5f,0x89,0x60,0x89,0x61,0x89,0x61,0x89,0x60,0x89,0x5f,0x89,0x5e,0x89,0x5d,0x89,0x62,0x89,0x62,0xc0,0x89,0x57,0x89,0x63,0x89,0x64,0x89,0x64,0x89,0x63,0x89,0x65,0x89,0x65,0x89,0x66,0x89,0x66,0x89,0x67,0x89,0x67,0x89,0x68,0x89,0x68,0x89,0x66,0x89,0x65,0x89,0x69,0x89,0x69,0x89,0x6a,0x89,0x6b,0x89,0x6c,0x89,0x6c,0x89,0x6d,0x89,0x6d,0x89,0x6e,0x89,0x6e,0x89,0x6f,0x89,0x6f,0x89,0x6d,0x89,0x6c,0x89,0x6a,0x89,0x69,0x89,0x70,0x89,0x70,0x89,0x71,0x89,0x72,0x89,0x73,0x89,0x74,0x89,0x74,0x89,0x75,0x89,0x75,0x89,0x76,0x89,0x76,0x89,0x74,0x89,0x73,0x89,0x71,0x89,0x70,0xc0,0xd4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x89,0x77,0xd,0x89,0x78,0xe5,0x83,0x6c,0x89,0x2b,0x89,0x32,0x89,0x3a,0x89,0x3b,0x89,0x79,0xe0,0x0,0xc7,0x12,0xc6,0x82,0x60,0xd3,0xd1,0x0,0xc4,0x0,0xd6,0x1,0xc1,0xd6,0x2,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xd1,0x3,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xd1,0x4,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xd1,0x5,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xd1,0x6,0xc4,0x0,0xd6,0x7,0xd0,0x83,0x51,0xd1,0x8,0xf1,0x1,0x82,0x62,0xc7,0x16,0xd0,0x88,0x6d,0xd3,0xe1,0x2,0xc7,0x1c,0xe0,0x0,0xcb,0x4,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x7f,0xe0,0x1,0xcb,0x4,0xc6,0x3e,0xe0,0x0,0xcb,0x0,0xc6,0x82,0x6d,0xd3,0xd3,0xf0,0x1,0x82,0x62,0xcb,0x4,0xc6,0x82,0x63,0xd0,0x89,0xc,0xd3,0xdb,0x0,0x0,0x80,0xc2,0xe0,0x0,0xc7,0x12,0xc6,0x82,0x60,0xd3,0xd1,0x9,0xe0,0x1,0xcb,0x9,0xc6,0x82,0x64,0xe0,0x1,0xca,0x0,0xc6,0x83,0x5f,0xe0,0x0,0xca,0x1,0xc6,0x89,0xd,0xd3,0xd3,0xd3,0xe0,0x1,0xcb,0x9,0xc6,0x82,0x64,0xe0,0x1,0xca,0x0,0xc6,0x83,0x5f,0xe0,0x0,0xca,0x1,0xc6,0x89,0xe,0xd3,0xd3,0xd3,0xe0,0x1,0xcb,0x9,0xc6,0x82,0x64,0xe0,0x1,0xca,0x0,0xc6,0x83,0x5f,0xe0,0x0,0xca,0x1,0xc6,0x89,0xf,0xd3,0xd3,0xd3,0xca,0x2,0xe3,0x0,0xd0,0x89,0x17,0xd3,0xc0,0xe3,0x0,0xd0,0x89,0x1d,0xd3,0xd4,0xe0,0x2,0xc7,0x1e,0xc6,0x86,0x5f,0xe1,0x2,0xc7,0x1f,0xe0,0x0,0xca,0x1,0xc6,0x89,0x20,0xd3,0xe1,0x1,0xc7,0x4,0xc6,0x27,0xd3,0xd3,0xe1,0x9,0xc7,0x4,0xc6,0x89,0x21,0xc6,0x9,0xe0,0x0,0xcb,0x3,0xc6,0x89,0x22,0xd3,0xc6,0x7,0xe1,0x1,0xc7,0x18,0xcb,0x2,0xd3,0xc6,0x4,0xe1,0x2,0xc7,0x1f,0xe1,0x2,0xc7,0x5,0xca,0x2,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x2,0xc6,0x89,0x23,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xd3,0xc1,0xd3,0xc6,0x8,0xf0,0x1,0x82,0x62,0xcb,0x6,0xc6,0x89,0x24,0xd0,0x89,0x29,0xd3,0xd3,0xd3,0xd1,0xa,0xe0,0x1,0xcb,0x9,0xc6,0x82,0x64,0xe0,0x1,0xca,0x0,0xc6,0x83,0x5f,0xcb,0xa,0xd3,0xd3,0xe1,0x2,0xc7,0xb,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xcb,0x9,0xc6,0x81,0x44,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x44,0xd3,0xd3,0xc6,0x82,0x46,0xd3,0xdd,0x0,0x1,0xb2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x3,0xc7,0xe,0xe1,0x2,0xc7,0x2,0xc6,0x85,0x7b,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xcb,0x9,0xc6,0x81,0x44,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x44,0xd3,0xd3,0xd3,0xcb,0x9,0xcb,0x0,0xd3,0xd3,0xdb,0x0,0x1,0xb3,0xc2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x4,0xc7,0xe,0xc6,0x89,0x2a,0xe1,0x1,0xc9,0x0,0x1,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xcb,0x9,0xc6,0x81,0x44,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x44,0xd3,0xd3,0xd3,0xcb,0x9,0xcb,0x0,0xd3,0xd3,0x0,0xc1,0x1,0x9c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x89,0x7b,0xaa,0xc3,0xc4,0xc4,0xc4,0x89,0x7c,0xc8,0x0,0x0,0x0,0xc1,0x1,0x9e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x89,0x7e,0xaa,0xc3,0xc4,0xc4,0xc4,0x89,0x7f,0xc8,0x0,0x0,0x0,0x3,0x78,0x6f,0x72,0xc1,0x1,0xa0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x8a,0x2,0xaa,0xc3,0xc4,0xc4,0xc4,0x8a,0x3,0xc8,0x0,0x0,0x0,0xc1,0x1,0xa2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x8a,0x5,0xaa,0xc3,0xc4,0xc4,0xc4,0x8a,0x6,0xc8,0x0,0x0,0x0,0x3,0x69,0x73,0x61,0xc1,0x1,0xa4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x8a,0x9,0xaa,0xc3,0xc4,0xc4,0xc4,0x8a,0xa,0xc8,0x0,0x0,0x0,0x2,0x3d,0x3d,0xc1,0x5a,0x62,0x23,0x8a,0xd,0x8a,0xd,0x8a,0xd,0xc1,0x1,0xa8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0xe,0xd,0x8a,0xf,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x10,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x0,0xd3,0x0,0x2,0x21,0x3d,0x3,0x6e,0x65,0x71,0xc1,0x5a,0xa2,0x23,0x8a,0x14,0x8a,0x14,0x8a,0x14,0xc1,0x1,0xaa,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x15,0xd,0x8a,0x16,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x17,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x13,0xd3,0x0,0x1,0x3e,0xc1,0x5a,0xe4,0x23,0x8a,0x1a,0x8a,0x1a,0x8a,0x1a,0xc1,0x1,0xae,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x1b,0xd,0x8a,0x1c,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x1d,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x88,0x6e,0xd3,0x0,0x2,0x3e,0x3d,0xc1,0x5b,0x24,0x23,0x8a,0x20,0x8a,0x20,0x8a,0x20,0xc1,0x1,0xb0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x21,0xd,0x8a,0x22,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x23,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x3a,0xd3,0x0,0x1,0x3c,0xc1,0x5b,0x64,0x23,0x8a,0x26,0x8a,0x26,0x8a,0x26,0xc1,0x1,0xb2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x27,0xd,0x8a,0x28,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x29,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x61,0xd3,0x0,0x2,0x3c,0x3d,0xc1,0x5b,0xa4,0x23,0x8a,0x2c,0x8a,0x2c,0x8a,0x2c,0xc1,0x1,0xb4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x2d,0xd,0x8a,0x2e,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x2f,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x3b,0xd3,0x0,0x1,0x7e,0x4,0x62,0x6e,0x6f,0x74,0xc1,0x5b,0xe6,0x23,0x8a,0x33,0x8a,0x33,0x8a,0x33,0xc1,0x1,0xb8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x34,0xd,0x8a,0x35,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x36,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x32,0xd3,0x0,0x1,0x26,0xc1,0x5c,0x28,0x23,0x8a,0x39,0x8a,0x39,0x8a,0x39,0xc1,0x1,0xba,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x3a,0xd,0x8a,0x3b,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x3c,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x66,0xd3,0x0,0x1,0x7c,0xc1,0x5c,0x6a,0x23,0x8a,0x3f,0x8a,0x3f,0x8a,0x3f,0xc1,0x1,0xbc,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x40,0xd,0x8a,0x41,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x42,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x2,0xd3,0x0,0x1,0x5e,0x4,0x62,0x78,0x6f,0x72,0xc1,0x5c,0xaa,0x23,0x8a,0x46,0x8a,0x46,0x8a,0x46,0xc1,0x1,0xbe,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x47,0xd,0x8a,0x48,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x49,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x45,0xd3,0x0,0x2,0x3c,0x3c,0xc1,0x5c,0xee,0x23,0x8a,0x4c,0x8a,0x4c,0x8a,0x4c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x4d,0xd,0x82,0x47,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x4e,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x63,0xd3,0x0,0x2,0x3e,0x3e,0xc1,0x5d,0x30,0x23,0x8a,0x51,0x8a,0x51,0x8a,0x51,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x52,0xd,0x82,0x6e,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x53,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x62,0xd3,0x0,0x3,0x3e,0x3e,0x3e,0x4,0x72,0x72,0x73,0x68,0xc1,0x5d,0x74,0x23,0x8a,0x57,0x8a,0x57,0x8a,0x57,0xc1,0x1,0xc4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x58,0xd,0x8a,0x59,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x5a,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x56,0xd3,0x0,0x1,0x2b,0xc1,0x5d,0xb8,0x23,0x8a,0x5d,0x8a,0x5d,0x8a,0x5d,0xc1,0x1,0xc8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x5e,0xd,0x8a,0x5f,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x60,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x3e,0xd3,0x0,0x1,0x2d,0xc1,0x5d,0xf8,0x23,0x8a,0x63,0x8a,0x63,0x8a,0x63,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x64,0xd,0x89,0x2a,0xb0,0xc3,0xc4,0xc4,0xc4,0x8a,0x65,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x3c,0xd3,0x0,0x1,0x2a,0xc1,0x5e,0x38,0x23,0x8a,0x68,0x8a,0x68,0x8a,0x68,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x69,0xd,0x81,0x43,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x6a,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x83,0xf,0xd3,0x0,0x1,0x2f,0x3,0x64,0x69,0x76,0xc1,0x5e,0x78,0x23,0x8a,0x6e,0x8a,0x6e,0x8a,0x6e,0xc1,0x1,0xce,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x6f,0xd,0x8a,0x70,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x71,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x6d,0xd3,0x0,0x2,0x2f,0x2f,0x4,0x69,0x64,0x69,0x76,0xc1,0x5e,0xb8,0x23,0x8a,0x75,0x8a,0x75,0x8a,0x75,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x76,0xd,0x87,0xd,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x77,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x74,0xd3,0x0,0x2,0x2f,0x2e,0x4,0x66,0x64,0x69,0x76,0xc1,0x5e,0xfa,0x23,0x8a,0x7b,0x8a,0x7b,0x8a,0x7b,0xc1,0x1,0xd2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8a,0x7c,0xd,0x8a,0x7d,0xb1,0xc3,0xc4,0xc4,0xc4,0x8a,0x7e,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8a,0x7a,0xd3,0x0,0x1,0x25,0xc1,0x5f,0x3c,0x23,0x8b,0x1,0x8b,0x1,0x8b,0x1,0xc1,0x1,0xd4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8b,0x2,0xd,0x8b,0x3,0xb1,0xc3,0xc4,0xc4,0xc4,0x8b,0x4,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x89,0x2c,0xd3,0x0,0x2,0x2a,0x2a,0x3,0x70,0x6f,0x77,0xc1,0x5f,0x7e,0x23,0x8b,0x8,0x8b,0x8,0x8b,0x8,0xc1,0x1,0xd6,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8b,0x9,0xd,0x8b,0xa,0xb1,0xc3,0xc4,0xc4,0xc4,0x8b,0xb,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc6,0x8b,0x7,0xd3,0x0,0x6,0x6f,0x70,0x6e,0x61,0x6d,0x65,0xc1,0x59,0x4e,0xc1,0x59,0x7e,0xc1,0x59,0xae,0xc1,0x59,0xde,0xc1,0x5a,0xe,0xc1,0x5a,0x40,0xc1,0x5a,0x80,0xc1,0x5a,0xc4,0xc1,0x5b,0x2,0xc1,0x5b,0x44,0xc1,0x5b,0x82,0xc1,0x5b,0xc6,0xc1,0x5c,0x8,0xc1,0x5c,0x4a,0xc1,0x5c,0x8a,0xc1,0x5c,0xcc,0xc1,0x5d,0xe,0xc1,0x5d,0x50,0xc1,0x5d,0x98,0xc1,0x5d,0xd8,0xc1,0x5e,0x18,0xc1,0x5e,0x58,0xc1,0x5e,0x98,0xc1,0x5e,0xda,0xc1,0x5f,0x1c,0xc1,0x5f,0x5c,0xe1,0x81,0x2,0x8b,0xe,0x8b,0xe,0x8b,0xe,0xc0,0xc0,0x8b,0xf,0x8b,0xf,0x8b,0xf,0xc0,0xc0,0x8b,0x10,0x8b,0x10,0x8b,0x10,0xc0,0xc0,0x8b,0x11,0x8b,0x11,0x8b,0x11,0xc0,0xc0,0x8b,0x12,0x8b,0x12,0x8b,0x12,0xc0,0xc0,0x8b,0x13,0x8b,0x13,0x8b,0x13,0xc0,0xc0,0x8b,0x14,0x8b,0x14,0x8b,0x14,0xc0,0xc0,0x8b,0x15,0x8b,0x15,0x8b,0x15,0xc0,0xc0,0x8b,0x16,0x8b,0x16,0x8b,0x16,0xc0,0xc0,0x8b,0x17,0x8b,0x17,0x8b,0x17,0xc0,0xc0,0x8b,0x18,0x8b,0x18,0x8b,0x18,0xc0,0xc0,0x8b,0x19,0x8b,0x19,0x8b,0x19,0xc0,0xc0,0x8b,0x1a,0x8b,0x1a,0x8b,0x1a,0xc0,0xc0,0x8b,0x1b,0x8b,0x1b,0x8b,0x1b,0xc0,0xc0,0x8b,0x1c,0x8b,0x1c,0x8b,0x1c,0xc0,0xc0,0x8b,0x1d,0x8b,0x1d,0x8b,0x1d,0xc0,0xc0,0x8b,0x1e,0x8b,0x1e,0x8b,0x1e,0xc0,0xc0,0x8b,0x1f,0x8b,0x1f,0x8b,0x1f,0xc0,0xc0,0x8b,0x20,0x8b,0x20,0x8b,0x20,0xc0,0xc0,0x8b,0x21,0x8b,0x21,0x8b,0x21,0xc0,0xc0,0x8b,0x22,0x8b,0x22,0x8b,0x22,0xc0,0xc0,0x8b,0x23,0x8b,0x23,0x8b,0x23,0xc0,0xc0,0x8b,0x24,0x8b,0x24,0x8b,0x24,0xc0,0xc0,0x8b,0x25,0x8b,0x25,0x8b,0x25,0xc0,0xc0,0x8b,0x26,0x8b,0x26,0x8b,0x26,0xc0,0xc0,0x8b,0x27,0x8b,0x27,0x8b,0x27,0xc0,0xc0,0xc1,0x1,0x9a,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x8b,0x28,0xd,0x8b,0x29,0xe5,0x83,0x29,0x8b,0xd,0x83,0x45,0xc4,0xc4,0x8b,0x2a,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x89,0x1f,0xd3,0xe3,0x0,0xd0,0x89,0x7d,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x39,0xd3,0xe3,0x0,0xd0,0x8a,0x0,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x1,0xd3,0xe3,0x0,0xd0,0x8a,0x4,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x84,0xd,0xd3,0xe3,0x0,0xd0,0x8a,0x7,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x8,0xd3,0xe3,0x0,0xd0,0x8a,0xb,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0xc,0xd3,0xe3,0x0,0xd0,0x8a,0x11,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x12,0xd3,0xe3,0x0,0xd0,0x8a,0x18,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x19,0xd3,0xe3,0x0,0xd0,0x8a,0x1e,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x1f,0xd3,0xe3,0x0,0xd0,0x8a,0x24,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x25,0xd3,0xe3,0x0,0xd0,0x8a,0x2a,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x2b,0xd3,0xe3,0x0,0xd0,0x8a,0x30,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x31,0xd3,0xe3,0x0,0xd0,0x8a,0x37,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x38,0xd3,0xe3,0x0,0xd0,0x8a,0x3d,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x3e,0xd3,0xe3,0x0,0xd0,0x8a,0x43,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x44,0xd3,0xe3,0x0,0xd0,0x8a,0x4a,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x4b,0xd3,0xe3,0x0,0xd0,0x8a,0x4f,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x50,0xd3,0xe3,0x0,0xd0,0x8a,0x54,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x55,0xd3,0xe3,0x0,0xd0,0x8a,0x5b,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x5c,0xd3,0xe3,0x0,0xd0,0x8a,0x61,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x62,0xd3,0xe3,0x0,0xd0,0x8a,0x66,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x67,0xd3,0xe3,0x0,0xd0,0x8a,0x6b,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x6c,0xd3,0xe3,0x0,0xd0,0x8a,0x72,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x73,0xd3,0xe3,0x0,0xd0,0x8a,0x78,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8a,0x79,0xd3,0xe3,0x0,0xd0,0x8a,0x7f,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8b,0x0,0xd3,0xe3,0x0,0xd0,0x8b,0x5,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8b,0x6,0xd3,0xe3,0x0,0xd0,0x8b,0xc,0xd3,0xd4,0x0,0xc,0x61,0x64,0x64,0x4f,0x70,0x65,0x6e,0x43,0x6c,0x61,0x73,0x73,0x7,0x61,0x64,0x64,0x4f,0x70,0x65,0x6e,0x3,0x72,0x65,0x66,0x6,0x61,0x64,0x64,0x61,0x72,0x67,0x7,0x67,0x72,0x65,0x74,0x75,0x72,0x6e,0x5,0x67,0x67,0x6f,0x74,0x6f,0x6,0x67,0x62,0x72,0x65,0x61,0x6b,0x9,0x67,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x7,0x73,0x68,0x61,0x64,0x6f,0x77,0x73,0x9,0x69,0x6e,0x6e,0x65,0x72,0x6c,0x6f,0x6f,0x70,0x5,0x63,0x6c,0x6f,0x73,0x65,0x6d,0x8b,0x2c,0xc0,0x8b,0x2d,0xc0,0x8b,0x2e,0xc0,0x8b,0x2f,0xc0,0x8b,0x30,0xc0,0x8b,0x31,0xc0,0x8b,0x32,0xc0,0x8b,0x33,0xc0,0x8b,0x34,0xc0,0x8b,0x35,0xc0,0x89,0x10,0xc0,0x8b,0x36,0xc0,0x3e,0xc0,0x4,0x6f,0x70,0x65,0x6e,0x63,0x8b,0x38,0xc0,0x89,0x30,0xc0,0x89,0xd,0xc0,0x4,0x70,0x65,0x65,0x6b,0x22,0xc0,0x8b,0x3a,0x2,0x69,0x64,0x4,0x74,0x79,0x70,0x65,0x3,0x76,0x61,0x72,0x5,0x73,0x74,0x79,0x70,0x65,0x63,0x88,0x71,0xc0,0x8b,0x3d,0xc0,0x89,0xd,0xc0,0x5,0x6e,0x61,0x6d,0x65,0x73,0x2,0x66,0x6e,0x65,0x84,0x6c,0xc0,0x88,0x71,0xc0,0x8b,0x42,0xc0,0x8b,0x3d,0xc0,0x8b,0x3c,0xc0,0x8,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x21,0x8b,0x44,0x21,0x89,0xd,0x21,0x9,0x23,0x8b,0x45,0x8b,0x46,0x8b,0x47,0x1,0x5f,0x29,0x8b,0x49,0x8b,0x42,0x8b,0x2e,0x8b,0x3d,0x8b,0x3d,0x8b,0x49,0x8b,0x3c,0x8b,0x49,0x88,0x71,0x29,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0x61,0xf0,0xc1,0x62,0x10,0xc1,0x63,0x1c,0xc1,0x63,0x7c,0xc1,0x63,0x84,0xc1,0x63,0xc8,0xc1,0x63,0xbc,0xc1,0x63,0xf6,0xc1,0x63,0xe8,0xc1,0x64,0x16,0xc1,0x64,0xf4,0xc1,0x65,0x28,0xc1,0x65,0x1e,0xc1,0x65,0x32,0xc1,0x65,0x8a,0xc1,0x65,0x7c,0xc1,0x65,0xd4,0xc1,0x65,0xc8,0xc1,0x66,0x42,0xe1,0x34,0x8b,0x4c,0xc0,0xc0,0x8b,0x4d,0x8b,0x4d,0x8b,0x4d,0xc0,0x8b,0x4c,0x8b,0x4e,0x8b,0x4e,0x8b,0x4f,0x8b,0x50,0x8b,0x50,0x8b,0x4f,0x8b,0x51,0x8b,0x51,0x8b,0x52,0x8b,0x52,0x8b,0x51,0x8b,0x53,0x8b,0x53,0x8b,0x54,0x8b,0x54,0x8b,0x53,0x8b,0x55,0x8b,0x55,0x8b,0x55,0x8b,0x56,0xc0,0xc0,0x8b,0x57,0x8b,0x58,0x8b,0x59,0x8b,0x59,0x8b,0x59,0x8b,0x57,0xc0,0x8b,0x56,0x8b,0x5a,0x8b,0x5b,0x8b,0x5b,0x8b,0x5a,0x8b,0x5c,0x8b,0x5d,0x8b,0x5d,0xc0,0xc0,0xc0,0x8b,0x5c,0x8b,0x5e,0x8b,0x5e,0x8b,0x5e,0xc1,0x1,0xea,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8b,0x5f,0xd,0x8b,0x60,0xe5,0x82,0x1a,0xc3,0x8b,0x48,0x8b,0x4a,0x8b,0x4b,0x8b,0x61,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x3e,0xe1,0x7,0xc7,0x4,0xc6,0x8b,0x39,0xc6,0x89,0xd,0xe1,0x2,0xc7,0x1f,0xca,0x1,0xc6,0x1a,0xd3,0xc6,0x8b,0x38,0xca,0x0,0xc6,0x89,0x30,0xce,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xca,0x1,0xdd,0x0,0x1,0x6,0xf0,0x2,0x8b,0x3b,0xce,0xc6,0x8b,0x2e,0xca,0x1,0xc0,0xd3,0xd1,0x2,0xe0,0x1,0xc9,0x0,0x2,0xc6,0x83,0x3d,0xe8,0x0,0xcb,0x2,0xc6,0x8b,0x3c,0xd3,0xd3,0xd1,0x3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x3,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x3e,0xd3,0xdc,0x0,0x0,0x76,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x3,0xc6,0x8b,0x3f,0xd3,0xc6,0x8b,0x3e,0xd3,0xdd,0x0,0x0,0x87,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x1,0xd3,0xdb,0x0,0x0,0x88,0xc2,0xc6,0x84,0x79,0xd1,0x4,0xe0,0x1,0xc9,0x0,0x2,0xc6,0x3e,0xe1,0x7,0xc7,0x4,0xc6,0x8b,0x40,0xc6,0x89,0xd,0xca,0x1,0xc6,0x8b,0x3d,0xcb,0x4,0xc6,0x88,0x71,0xe0,0x1,0xc7,0x14,0xc6,0x82,0x60,0xe1,0x1,0xc7,0x3,0xca,0x2,0xd3,0xd3,0xd3,0xd3,0xd2,0x0,0x5,0xd2,0x1,0x6,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x89,0xf,0xd3,0xc6,0x3e,0xca,0x1,0xd3,0xd2,0x0,0x7,0xd2,0x1,0x8,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8b,0x41,0xd3,0xc6,0x86,0x5f,0xca,0x1,0xe1,0xb,0xc7,0x4,0xc6,0x8b,0x43,0xc6,0x84,0x6c,0xc1,0xc6,0x88,0x71,0xcb,0x8,0xc6,0x8b,0x3c,0xcb,0x6,0xc6,0x8b,0x42,0xcb,0x1,0xc6,0x8b,0x3d,0xcb,0x4,0xd3,0xd3,0xdb,0x0,0x1,0x7,0xc2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x1,0xd3,0x0,0x5,0x63,0x6c,0x61,0x73,0x73,0x21,0x8b,0x63,0x22,0x8b,0x64,0x8b,0x46,0xc1,0x66,0xc6,0xc1,0x66,0xbc,0xc1,0x66,0xf4,0xc1,0x66,0xe8,0xc1,0x66,0xde,0xc1,0x67,0x2c,0xc1,0x67,0x22,0x2e,0x8b,0x66,0x8b,0x67,0x8b,0x67,0x8b,0x66,0x8b,0x68,0x8b,0x69,0x8b,0x6a,0x8b,0x6a,0x8b,0x69,0x8b,0x68,0x8b,0x6b,0x8b,0x6c,0x8b,0x6c,0x8b,0x6b,0xc1,0x2,0x6,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8b,0x6d,0xd,0x8b,0x6e,0xe5,0x46,0xc3,0x8b,0x65,0xc4,0xc4,0x8b,0x6f,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x38,0xd3,0xc6,0x83,0x3d,0xca,0x1,0xd3,0xdd,0x0,0x0,0x2c,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x38,0xd3,0xc6,0x83,0x3d,0xca,0x1,0xd3,0xc6,0x8b,0x36,0xd3,0xdb,0x0,0x0,0x2d,0xc2,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8b,0x38,0xd3,0xc6,0x86,0x5f,0xca,0x1,0xca,0x0,0xd3,0x0,0x64,0x84,0x6c,0xc0,0x88,0x71,0xc0,0x8b,0x3d,0xc0,0x8b,0x3c,0xc0,0x4,0x76,0x61,0x72,0x73,0x21,0x8b,0x3d,0x23,0x8b,0x46,0x8b,0x47,0x8b,0x73,0x26,0x8b,0x3d,0x8b,0x2e,0x8b,0x49,0x8b,0x3c,0x8b,0x49,0x88,0x71,0x26,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0x68,0x10,0xc1,0x68,0x6,0xc1,0x67,0xf8,0xc1,0x68,0x48,0xc1,0x68,0x3c,0xc1,0x68,0x30,0xc1,0x68,0x92,0xc1,0x68,0x86,0xc1,0x68,0xcc,0xc1,0x68,0xd4,0xc1,0x68,0xe4,0xc1,0x69,0x1a,0xc1,0x69,0x4e,0xc1,0x69,0x44,0xc1,0x69,0x58,0xc1,0x69,0xa8,0xc1,0x69,0x9a,0xc1,0x69,0xea,0xc1,0x69,0xde,0xc1,0x6a,0x56,0xc1,0x6a,0x7c,0xc1,0x6a,0x72,0xc1,0x6a,0xb8,0xe1,0x38,0x8b,0x77,0x8b,0x77,0x8b,0x78,0x8b,0x79,0x8b,0x79,0x8b,0x78,0x8b,0x77,0x8b,0x7a,0x8b,0x7b,0x8b,0x7c,0x8b,0x7c,0x8b,0x7b,0x8b,0x7a,0x8b,0x7d,0x8b,0x7e,0x8b,0x7e,0x8b,0x7d,0x8b,0x7f,0x8b,0x7f,0x8c,0x0,0x8c,0x0,0x8c,0x1,0x8c,0x1,0x8b,0x7f,0x8c,0x2,0xc0,0xc0,0x8c,0x3,0x8c,0x4,0x8c,0x5,0x8c,0x5,0x8c,0x5,0x8c,0x3,0xc0,0x8c,0x2,0x8c,0x6,0x8c,0x7,0x8c,0x7,0x8c,0x6,0x8c,0x8,0x8c,0x9,0x8c,0x9,0xc0,0xc0,0xc0,0x8c,0x8,0x8c,0xa,0x8c,0xa,0x8c,0xa,0x8c,0xb,0x8c,0xc,0x8c,0xc,0x8c,0xb,0x8c,0xd,0x8c,0xd,0x8c,0xd,0xc1,0x2,0xc,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8c,0xe,0xd,0x8c,0xf,0xe5,0x82,0x13,0xc3,0x8b,0x74,0x8b,0x75,0x8b,0x76,0x8c,0x10,0xca,0x2,0xdc,0x0,0x0,0x9,0xc6,0x84,0x79,0xd1,0x0,0xe1,0x2,0xc7,0x0,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x89,0xf,0xd3,0xc6,0x83,0x3d,0xc6,0x33,0xd3,0xca,0x0,0xd3,0xdd,0x0,0x0,0x3a,0xe8,0x0,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x41,0xd3,0xc6,0x83,0x3d,0xca,0x0,0xd3,0xc6,0x8b,0x42,0xd3,0xdd,0x0,0x0,0x6a,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x41,0xd3,0xc6,0x83,0x3d,0xca,0x0,0xd3,0xd1,0x1,0xe1,0x3,0xc7,0x1,0xc4,0x0,0xe0,0x0,0xcb,0x1,0xc6,0x88,0x71,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x8b,0x3c,0xd3,0xd3,0xdb,0x0,0x0,0x6b,0xc2,0xe0,0x1,0xc9,0x0,0x2,0xc6,0x3e,0xe1,0x7,0xc7,0x4,0xc6,0x8b,0x40,0xc6,0x89,0xd,0xca,0x0,0xc6,0x8b,0x3d,0xcb,0x0,0xc6,0x88,0x71,0xe0,0x1,0xc7,0x14,0xc6,0x82,0x60,0xe1,0x1,0xc7,0x3,0xca,0x1,0xd3,0xd3,0xd3,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x89,0xf,0xd3,0xc6,0x3e,0xca,0x0,0xd3,0xd2,0x0,0x4,0xd2,0x1,0x5,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8b,0x41,0xd3,0xc6,0x86,0x5f,0xca,0x0,0xe1,0x9,0xc7,0x4,0xc6,0x8b,0x71,0xc6,0x84,0x6c,0xc1,0xc6,0x88,0x71,0xcb,0x5,0xc6,0x8b,0x3c,0xcb,0x3,0xc6,0x8b,0x3d,0xcb,0x0,0xd3,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x8b,0x3e,0xd3,0xdd,0x0,0x0,0xfd,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8b,0x72,0xd3,0xc6,0x86,0x5f,0xcb,0x5,0xc0,0xd3,0xdb,0x0,0x0,0xfe,0xc2,0xe1,0x3,0xc7,0x1,0xc4,0x0,0xcb,0x5,0xcb,0x3,0xd3,0x0,0x21,0x8b,0x2e,0x22,0x8b,0x46,0x8c,0x12,0xc1,0x6b,0x88,0xc1,0x6b,0x78,0xc1,0x6b,0x80,0xc1,0x6b,0xa4,0xc1,0x6b,0xac,0x2a,0x8c,0x14,0x8c,0x15,0x8c,0x16,0x8c,0x16,0x8c,0x15,0x8c,0x14,0x8c,0x17,0x8c,0x18,0x8c,0x18,0x8c,0x17,0xc1,0x2,0x22,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8c,0x19,0xd,0x8c,0x1a,0xe5,0x36,0xc3,0x8c,0x13,0xc4,0xc4,0x8c,0x1b,0xe8,0x0,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x83,0x3d,0xe8,0x0,0xca,0x1,0xc6,0x8b,0x42,0xd3,0xd3,0xc6,0x8b,0x38,0xd3,0xdd,0x0,0x0,0x2d,0xe1,0x1,0xc9,0x1,0x3,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x42,0xd3,0xd3,0xdb,0x0,0x0,0x2e,0xc2,0x0,0x21,0x8b,0x38,0x22,0x8b,0x46,0x8c,0x1d,0xc1,0x6c,0x2c,0x22,0x8c,0x1f,0x8c,0x1f,0xc1,0x2,0x28,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8c,0x20,0xd,0x8c,0x21,0xb0,0xc3,0x8c,0x1e,0xc4,0xc4,0x8c,0x22,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x36,0xd3,0x0,0xc1,0x6b,0x1a,0xc1,0x6b,0xe,0xc1,0x6b,0xfc,0xc1,0x6b,0xf2,0x28,0x8c,0x24,0x8c,0x25,0x8c,0x25,0x8c,0x24,0x8c,0x26,0x8c,0x27,0x8c,0x27,0x8c,0x26,0xc1,0x2,0x20,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x8c,0x28,0xd,0x8c,0x29,0xe5,0x2b,0xc3,0xc4,0xc4,0xc4,0x8c,0x2a,0xf0,0x1,0x82,0x62,0xe0,0x0,0xce,0xc6,0x8b,0x41,0xd3,0xc6,0x82,0x63,0xd0,0x8c,0x1c,0xd3,0xf0,0x1,0x82,0x62,0xe0,0x0,0xce,0xc6,0x8b,0x38,0xd3,0xc6,0x82,0x63,0xd0,0x8c,0x23,0xd3,0x0,0x22,0x8b,0x46,0x88,0x72,0xc1,0x6c,0xcc,0xc1,0x6c,0xc2,0x24,0x8c,0x2d,0x8c,0x2e,0x8c,0x2e,0x8c,0x2d,0xc1,0x2,0x2c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8c,0x2f,0xd,0x8c,0x30,0xbc,0xc3,0x8c,0x2c,0xc4,0xc4,0x8c,0x31,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x72,0xd3,0xc6,0x83,0x3d,0xca,0x1,0xd3,0xdc,0x0,0x0,0x14,0xc1,0x0,0xc1,0x6c,0x98,0xc1,0x6c,0x8a,0x24,0x8c,0x33,0x8c,0x34,0x8c,0x34,0x8c,0x33,0xc1,0x2,0x2a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x8c,0x35,0xd,0x8c,0x36,0xb9,0xc3,0xc4,0xc4,0xc4,0x8c,0x37,0xf0,0x1,0x82,0x62,0xe0,0x0,0xce,0xc6,0x89,0xf,0xd3,0xc6,0x89,0x24,0xd0,0x8c,0x32,0xd3,0x0,0x6,0x70,0x61,0x72,0x65,0x6e,0x74,0x21,0x8b,0x46,0xc1,0x6d,0x50,0xc1,0x6d,0x44,0xc1,0x6d,0x6c,0xc1,0x6d,0x9e,0xc1,0x6d,0xbc,0xc1,0x6d,0xd4,0xc1,0x6d,0xc6,0x30,0x8c,0x3b,0x8c,0x3c,0x8c,0x3c,0x8c,0x3b,0x8c,0x3d,0x8c,0x3d,0x8c,0x3d,0x8c,0x3e,0x8c,0x3e,0x8c,0x3f,0x8c,0x3f,0x8c,0x40,0x8c,0x41,0x8c,0x41,0x8c,0x40,0x8c,0x3f,0xc1,0x2,0x2e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8c,0x42,0xd,0x8c,0x43,0xe5,0x4f,0xc3,0x8c,0x3a,0xc4,0xc4,0x8c,0x44,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x41,0xd3,0xc6,0x83,0x3d,0xca,0x0,0xd3,0xdd,0x0,0x0,0x1f,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xc0,0xd3,0xdb,0x0,0x0,0x20,0xc2,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xdd,0x0,0x0,0x45,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x34,0xca,0x0,0xd3,0xd3,0xdb,0x0,0x0,0x46,0xc2,0xc1,0x0,0x6,0x69,0x6e,0x6c,0x69,0x6e,0x65,0xc1,0x6e,0x6a,0xc1,0x6e,0x84,0xc1,0x6e,0x8e,0xc1,0x6e,0xc0,0xc1,0x6e,0xde,0xc1,0x6e,0xf6,0xc1,0x6e,0xe8,0x30,0x8c,0x47,0x8c,0x47,0x8c,0x48,0x8c,0x48,0x8c,0x49,0x8c,0x49,0x8c,0x48,0x8c,0x4a,0x8c,0x4a,0x8c,0x4b,0x8c,0x4b,0x8c,0x4c,0x8c,0x4d,0x8c,0x4d,0x8c,0x4c,0x8c,0x4b,0xc1,0x2,0x36,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8c,0x4e,0xd,0x8c,0x4f,0xe5,0x4a,0xc3,0xc4,0xc4,0xc4,0x8c,0x50,0xe0,0x0,0xce,0xc6,0x83,0x52,0xd3,0xdd,0x0,0x0,0x1d,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x0,0xce,0xc6,0x83,0x52,0xd3,0xd3,0xdb,0x0,0x0,0x1e,0xc2,0xe0,0x0,0xce,0xc6,0x8c,0x46,0xd3,0xdd,0x0,0x0,0x41,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x0,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x35,0xd3,0xd3,0xdb,0x0,0x0,0x42,0xc2,0xc1,0x0,0x62,0x88,0x71,0xc0,0x89,0xd,0xc0,0x63,0x84,0x6c,0xc0,0x88,0x71,0xc0,0x8b,0x3c,0xc0,0x22,0x8b,0x46,0x8b,0x47,0x24,0x8b,0x49,0x8b,0x3c,0x8b,0x49,0x88,0x71,0x24,0xc1,0xc1,0xc1,0xc1,0xc1,0x6f,0x9a,0xc1,0x6f,0xc4,0xc1,0x6f,0xba,0xc1,0x6f,0xce,0xc1,0x70,0x1a,0xc1,0x70,0x10,0xc1,0x70,0x5c,0xc1,0x70,0x50,0xc1,0x70,0xb8,0x39,0x8c,0x57,0xc0,0xc0,0x8c,0x58,0x8c,0x59,0x8c,0x5a,0x8c,0x5a,0x8c,0x5a,0x8c,0x58,0xc0,0x8c,0x57,0x8c,0x5b,0x8c,0x5c,0x8c,0x5c,0x8c,0x5b,0x8c,0x5d,0x8c,0x5e,0x8c,0x5e,0xc0,0xc0,0xc0,0x8c,0x5d,0x8c,0x5f,0x8c,0x5f,0x8c,0x5f,0xc1,0x2,0x3e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8c,0x60,0xd,0x8c,0x61,0xe5,0x79,0xc3,0x8c,0x54,0x8c,0x55,0x8c,0x56,0x8c,0x62,0xe0,0x1,0xc9,0x0,0x2,0xc6,0x3e,0xe1,0x5,0xc7,0x4,0xc6,0x8c,0x52,0xc6,0x89,0xd,0xca,0x0,0xc6,0x88,0x71,0xe0,0x1,0xc7,0x14,0xc6,0x82,0x60,0xe1,0x1,0xc7,0x3,0xca,0x1,0xd3,0xd3,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x85,0x6,0xd3,0xc6,0x3e,0xca,0x0,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8b,0x41,0xd3,0xc6,0x86,0x5f,0xca,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x8c,0x53,0xc6,0x84,0x6c,0xc0,0xc6,0x88,0x71,0xcb,0x3,0xc6,0x8b,0x3c,0xcb,0x1,0xd3,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x1,0xd3,0x0,0x63,0x89,0x30,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x5,0x6c,0x65,0x76,0x65,0x6c,0x21,0x8c,0x65,0x22,0x8c,0x66,0x8b,0x47,0xc1,0x71,0x26,0xc1,0x71,0x44,0xc1,0x71,0x5c,0xc1,0x71,0x4e,0xc1,0x71,0xac,0xc1,0x71,0xf0,0xc1,0x71,0xe4,0xc1,0x72,0x40,0xc1,0x72,0x58,0xc1,0x72,0x4a,0xc1,0x72,0x76,0x3c,0x8c,0x68,0x8c,0x68,0x8c,0x69,0x8c,0x69,0x8c,0x6a,0x8c,0x6b,0x8c,0x6b,0x8c,0x6a,0x8c,0x69,0x8c,0x6c,0x8c,0x6c,0x8c,0x6d,0x8c,0x6e,0x8c,0x6e,0x8c,0x6d,0x8c,0x6f,0x8c,0x6f,0x8c,0x70,0x8c,0x71,0x8c,0x71,0x8c,0x72,0x8c,0x72,0x8c,0x72,0x8c,0x70,0x8c,0x6f,0xc0,0xc0,0xc0,0xc1,0x2,0x48,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8c,0x73,0xd,0x8c,0x74,0xe5,0x81,0x5,0xc3,0x8c,0x67,0xc4,0xc4,0x8c,0x75,0xe0,0x0,0xce,0xc6,0x8c,0x46,0xd3,0xdd,0x0,0x0,0x27,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x30,0xca,0x0,0xca,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x28,0xc2,0xe0,0x0,0xce,0xc6,0x82,0x61,0xd3,0xdd,0x0,0x0,0x66,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x89,0x23,0xd3,0xc6,0x86,0x5f,0xc6,0x1,0xc0,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x30,0xe1,0x2,0xc7,0x9,0xca,0x0,0xc4,0x1,0xd3,0xca,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x67,0xc2,0xe1,0x7,0xc7,0x4,0xc6,0x8c,0x64,0xc6,0x8b,0x3d,0xc6,0x1,0xc6,0x89,0x30,0xca,0x0,0xc6,0x9,0xca,0x1,0xd3,0x0,0x4,0x67,0x6f,0x74,0x6f,0xc1,0x73,0x4e,0xc1,0x73,0x6c,0xc1,0x73,0x84,0xc1,0x73,0x76,0xc1,0x73,0xd0,0xc1,0x74,0x14,0xc1,0x74,0x8,0xc1,0x74,0x60,0xc1,0x74,0x78,0xc1,0x74,0x6a,0xc1,0x74,0x92,0x3c,0x8c,0x78,0x8c,0x78,0x8c,0x79,0x8c,0x79,0x8c,0x7a,0x8c,0x7b,0x8c,0x7b,0x8c,0x7a,0x8c,0x79,0x8c,0x7c,0x8c,0x7c,0x8c,0x7d,0x8c,0x7e,0x8c,0x7e,0x8c,0x7d,0x8c,0x7f,0x8c,0x7f,0x8d,0x0,0x8d,0x1,0x8d,0x1,0x8d,0x2,0x8d,0x2,0x8d,0x2,0x8d,0x0,0x8c,0x7f,0xc0,0xc0,0xc0,0xc1,0x2,0x54,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8d,0x3,0xd,0x8d,0x4,0xe5,0x81,0x7,0xc3,0x8c,0x67,0xc4,0xc4,0x8d,0x5,0xe0,0x0,0xce,0xc6,0x8c,0x46,0xd3,0xdd,0x0,0x0,0x27,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x31,0xca,0x0,0xca,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x28,0xc2,0xe0,0x0,0xce,0xc6,0x82,0x61,0xd3,0xdd,0x0,0x0,0x67,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x89,0x23,0xd3,0xc6,0x86,0x5f,0xc6,0x8c,0x77,0xc0,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x31,0xe1,0x2,0xc7,0x9,0xca,0x0,0xc4,0x1,0xd3,0xca,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x68,0xc2,0xe1,0x7,0xc7,0x4,0xc6,0x8c,0x64,0xc6,0x8b,0x3d,0xc6,0x8c,0x77,0xc6,0x89,0x30,0xca,0x0,0xc6,0x9,0xca,0x1,0xd3,0x0,0x2,0x6c,0x73,0x21,0x8d,0x7,0x23,0x8c,0x66,0x8b,0x47,0x8d,0x8,0xc1,0x75,0x70,0xc1,0x75,0x8e,0xc1,0x75,0xa6,0xc1,0x75,0x98,0xc1,0x75,0xfc,0xc1,0x76,0x18,0xc1,0x76,0x30,0xc1,0x76,0x22,0xc1,0x76,0x4c,0xc1,0x76,0x64,0xc1,0x76,0xa4,0xc1,0x76,0xc2,0xc1,0x76,0xda,0xc1,0x76,0xcc,0xc1,0x76,0xf6,0xe1,0x26,0x8d,0xa,0x8d,0xa,0x8d,0xb,0x8d,0xb,0x8d,0xc,0x8d,0xd,0x8d,0xd,0x8d,0xc,0x8d,0xb,0x8d,0xe,0x8d,0xe,0x8d,0xf,0x8d,0xf,0x8d,0x10,0x8d,0x11,0x8d,0x11,0x8d,0x12,0x8d,0x12,0x8d,0x12,0x8d,0x13,0x8d,0x13,0x8d,0x10,0x8d,0xf,0x8d,0x14,0x8d,0x14,0x8d,0x15,0x8d,0x15,0x8d,0x16,0x8d,0x17,0x8d,0x17,0x8d,0x18,0x8d,0x18,0x8d,0x18,0x8d,0x16,0x8d,0x15,0xc0,0xc0,0xc0,0xc1,0x2,0x60,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8d,0x19,0xd,0x8d,0x1a,0xe5,0x81,0x32,0xc3,0x8d,0x9,0xc4,0xc4,0x8d,0x1b,0xe0,0x0,0xce,0xc6,0x8c,0x46,0xd3,0xdd,0x0,0x0,0x29,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x3,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x32,0xca,0x0,0xca,0x1,0xca,0x2,0xd3,0xd3,0xdb,0x0,0x0,0x2a,0xc2,0xe0,0x0,0xce,0xc6,0x82,0x61,0xd3,0xdd,0x0,0x0,0x61,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x3,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x32,0xe1,0x2,0xc7,0x9,0xca,0x0,0xc4,0x1,0xd3,0xca,0x1,0xe0,0x1,0xca,0x2,0xc6,0x3e,0xca,0x0,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0x62,0xc2,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xdd,0x0,0x0,0x92,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x3,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x32,0xe1,0x2,0xc7,0x9,0xca,0x0,0xc4,0x1,0xd3,0xca,0x1,0xca,0x2,0xd3,0xd3,0xdb,0x0,0x0,0x93,0xc2,0xe1,0x7,0xc7,0x4,0xc6,0x8c,0x64,0xc6,0x8b,0x3d,0xc6,0x83,0x57,0xc6,0x89,0x30,0xca,0x2,0xc6,0x9,0xca,0x1,0xd3,0x0,0x8,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0xc1,0x77,0xde,0xc1,0x77,0xfc,0xc1,0x78,0x14,0xc1,0x78,0x6,0xc1,0x78,0x70,0xc1,0x78,0x8c,0xc1,0x78,0xa4,0xc1,0x78,0x96,0xc1,0x78,0xc6,0xc1,0x78,0xde,0xc1,0x79,0x1e,0xc1,0x79,0x3c,0xc1,0x79,0x54,0xc1,0x79,0x46,0xc1,0x79,0x76,0xe1,0x26,0x8d,0x1e,0x8d,0x1e,0x8d,0x1f,0x8d,0x1f,0x8d,0x20,0x8d,0x21,0x8d,0x21,0x8d,0x20,0x8d,0x1f,0x8d,0x22,0x8d,0x22,0x8d,0x23,0x8d,0x23,0x8d,0x24,0x8d,0x25,0x8d,0x25,0x8d,0x26,0x8d,0x26,0x8d,0x26,0x8d,0x27,0x8d,0x27,0x8d,0x24,0x8d,0x23,0x8d,0x28,0x8d,0x28,0x8d,0x29,0x8d,0x29,0x8d,0x2a,0x8d,0x2b,0x8d,0x2b,0x8d,0x2c,0x8d,0x2c,0x8d,0x2c,0x8d,0x2a,0x8d,0x29,0xc0,0xc0,0xc0,0xc1,0x2,0x6a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8d,0x2d,0xd,0x8d,0x2e,0xe5,0x81,0x32,0xc3,0x8d,0x9,0xc4,0xc4,0x8d,0x2f,0xe0,0x0,0xce,0xc6,0x8c,0x46,0xd3,0xdd,0x0,0x0,0x29,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x3,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x33,0xca,0x0,0xca,0x1,0xca,0x2,0xd3,0xd3,0xdb,0x0,0x0,0x2a,0xc2,0xe0,0x0,0xce,0xc6,0x82,0x61,0xd3,0xdd,0x0,0x0,0x61,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x3,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x33,0xe1,0x2,0xc7,0x9,0xca,0x0,0xc4,0x1,0xd3,0xca,0x1,0xe0,0x1,0xca,0x2,0xc6,0x3e,0xca,0x0,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0x62,0xc2,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xdd,0x0,0x0,0x92,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x3,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x33,0xe1,0x2,0xc7,0x9,0xca,0x0,0xc4,0x1,0xd3,0xca,0x1,0xca,0x2,0xd3,0xd3,0xdb,0x0,0x0,0x93,0xc2,0xe1,0x7,0xc7,0x4,0xc6,0x8c,0x64,0xc6,0x8b,0x3d,0xc6,0x8d,0x1d,0xc6,0x89,0x30,0xca,0x2,0xc6,0x9,0xca,0x1,0xd3,0x0,0x3,0x64,0x65,0x6c,0x63,0x88,0x71,0xc0,0x8b,0x3d,0xc0,0x8b,0x3c,0xc0,0x2,0x75,0x70,0x64,0x8d,0x33,0xc0,0x88,0x71,0xc0,0x8b,0x3d,0xc0,0x8b,0x3c,0xc0,0x64,0x8b,0x3f,0xc0,0x88,0x71,0xc0,0x8b,0x3d,0xc0,0x8b,0x3c,0xc0,0x65,0x8d,0x33,0xc0,0x8b,0x3f,0xc0,0x88,0x71,0xc0,0x8b,0x3d,0xc0,0x8b,0x3c,0xc0,0x61,0x8b,0x3d,0xc0,0x62,0x8d,0x33,0xc0,0x8b,0x3d,0xc0,0xc,0x5f,0x65,0x6e,0x76,0x5f,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x3,0x45,0x6e,0x76,0x63,0x9,0xc0,0x8b,0x3d,0xc0,0x89,0xd,0xc0,0x23,0x8b,0x46,0x8c,0x66,0x8b,0x47,0x22,0x8b,0x2e,0x8b,0x2e,0xc1,0x7a,0x5e,0xc1,0x7a,0x84,0xc1,0x7a,0x8e,0xc1,0x7a,0xd8,0xc1,0x7a,0xfa,0xc1,0x7b,0x4,0xc1,0x7b,0x4a,0xc1,0x7b,0x6e,0xc1,0x7b,0x78,0xc1,0x7b,0x98,0xc1,0x7b,0xc8,0xc1,0x7b,0xf2,0xc1,0x7b,0xfc,0xc1,0x7c,0x22,0xc1,0x7c,0x62,0xc1,0x7c,0x56,0xc1,0x7c,0x94,0xc1,0x7c,0xa4,0xc1,0x7c,0xb4,0xc1,0x7d,0x10,0xc1,0x7d,0x0,0xc1,0x7d,0x8,0xc1,0x7d,0x2c,0xc1,0x7d,0x34,0xc1,0x7d,0x7e,0xc1,0x7d,0x74,0xc1,0x7d,0x94,0xc1,0x7d,0xa4,0xc1,0x7d,0xfe,0xc1,0x7d,0xea,0xc1,0x7d,0xe0,0xc1,0x7e,0x60,0xc1,0x7e,0x9a,0xc1,0x7e,0xbc,0xc1,0x7e,0xe2,0xc1,0x7e,0xf6,0xc1,0x7f,0x34,0xc1,0x7f,0x72,0xc1,0x7f,0x86,0xc1,0x7f,0xb6,0xc1,0x7f,0xd8,0xc1,0x80,0x2,0xc1,0x80,0x16,0xc1,0x80,0x30,0xc1,0x80,0x6a,0xc1,0x80,0xa2,0xc1,0x80,0xb6,0xc1,0x80,0xd0,0xc1,0x81,0x6,0xc1,0x81,0x22,0xc1,0x81,0x32,0xc1,0x81,0x48,0xc1,0x81,0x58,0xc1,0x81,0x90,0xc1,0x81,0xb2,0xc1,0x81,0xfc,0xc1,0x82,0x5a,0xc1,0x82,0x76,0xc1,0x82,0x86,0xc1,0x82,0x9c,0xc1,0x82,0xac,0xc1,0x83,0x84,0xc1,0x83,0xd6,0xc1,0x83,0xca,0xc1,0x84,0x2a,0xc1,0x84,0x74,0xc1,0x84,0xd0,0xc1,0x85,0x10,0xc1,0x85,0x2e,0xc1,0x85,0x46,0xc1,0x85,0x38,0xc1,0x85,0xb6,0xc1,0x85,0xa8,0xc1,0x85,0xe6,0xc1,0x85,0xda,0xc1,0x86,0x32,0xc1,0x86,0x26,0xc1,0x86,0x5a,0xc1,0x86,0x8e,0xc1,0x86,0xb6,0xc1,0x86,0xaa,0xc1,0x86,0xfe,0xc1,0x87,0x2e,0xc1,0x87,0x6e,0xe1,0x81,0x69,0x8d,0x3e,0x8d,0x3e,0x8d,0x3e,0x8d,0x3f,0x8d,0x3f,0x8d,0x40,0x8d,0x40,0x8d,0x3f,0x8d,0x41,0x8d,0x41,0x8d,0x41,0x8d,0x42,0x8d,0x42,0x8d,0x43,0x8d,0x43,0x8d,0x42,0x8d,0x44,0x8d,0x44,0x8d,0x44,0x8d,0x45,0x8d,0x45,0x8d,0x46,0x8d,0x47,0x8d,0x47,0x8d,0x47,0x8d,0x46,0x8d,0x45,0x8d,0x48,0x8d,0x48,0x8d,0x48,0x8d,0x49,0x8d,0x49,0x8d,0x4a,0x8d,0x4b,0x8d,0x4b,0x8d,0x4b,0x8d,0x4a,0x8d,0x49,0x8d,0x4c,0x8d,0x4d,0x8d,0x4d,0x8d,0x4c,0x8d,0x4e,0x8d,0x4e,0x8d,0x4f,0x8d,0x4f,0x8d,0x50,0x8d,0x50,0x8d,0x4f,0x8d,0x51,0x8d,0x52,0x8d,0x53,0x8d,0x53,0x8d,0x52,0x8d,0x51,0x8d,0x54,0x8d,0x55,0x8d,0x55,0x8d,0x54,0x8d,0x56,0x8d,0x57,0x8d,0x57,0x8d,0x56,0x8d,0x58,0x8d,0x58,0x8d,0x59,0x8d,0x59,0x8d,0x58,0x8d,0x5a,0x8d,0x5b,0x8d,0x5c,0x8d,0x5c,0x8d,0x5b,0x8d,0x5a,0x8d,0x5d,0x8d,0x5d,0x8d,0x5e,0x8d,0x5e,0x8d,0x5e,0x8d,0x5f,0x8d,0x5f,0xc0,0xc0,0x8d,0x60,0x8d,0x60,0x8d,0x61,0x8d,0x61,0xc0,0x8d,0x5f,0x8d,0x62,0x8d,0x62,0xc0,0xc0,0x8d,0x63,0x8d,0x63,0x8d,0x64,0x8d,0x64,0xc0,0x8d,0x62,0x8d,0x65,0x8d,0x65,0x8d,0x65,0x8d,0x66,0x8d,0x66,0xc0,0xc0,0x8d,0x67,0x8d,0x67,0x8d,0x68,0x8d,0x68,0x8d,0x69,0x8d,0x69,0xc0,0x8d,0x66,0x8d,0x6a,0x8d,0x6a,0xc0,0xc0,0x8d,0x6b,0x8d,0x6b,0x8d,0x6c,0x8d,0x6c,0x8d,0x6d,0x8d,0x6d,0xc0,0x8d,0x6a,0x8d,0x6e,0x8d,0x6e,0x8d,0x6e,0x8d,0x6f,0x8d,0x6f,0x8d,0x70,0x8d,0x70,0x8d,0x6f,0x8d,0x71,0x8d,0x71,0x8d,0x72,0x8d,0x72,0x8d,0x71,0x8d,0x73,0x8d,0x73,0x8d,0x73,0x8d,0x74,0x8d,0x74,0xc0,0xc0,0xc0,0x8d,0x74,0x8d,0x75,0x8d,0x75,0xc0,0xc0,0xc0,0x8d,0x75,0x8d,0x76,0x8d,0x76,0x8d,0x76,0x8d,0x77,0x8d,0x77,0x8d,0x78,0x8d,0x78,0x8d,0x77,0x8d,0x79,0x8d,0x79,0x8d,0x7a,0x8d,0x7a,0x8d,0x79,0x8d,0x7b,0x8d,0x7b,0x8d,0x7b,0x8d,0x7c,0x8d,0x7d,0x8d,0x7d,0x8d,0x7c,0x8d,0x7e,0x8d,0x7e,0xc0,0xc0,0xc0,0x8d,0x7e,0x8d,0x7f,0x8d,0x7f,0xc0,0xc0,0xc0,0x8d,0x7f,0x8e,0x0,0x8e,0x0,0x8e,0x1,0x8e,0x1,0x8e,0x2,0x8e,0x2,0x8e,0x3,0x8e,0x4,0x8e,0x4,0x8e,0x3,0x8e,0x2,0x8e,0x5,0x8e,0x6,0x8e,0x6,0x8e,0x7,0x8e,0x7,0x8e,0x8,0x8e,0x8,0x8e,0x8,0x8e,0x7,0x8e,0x5,0x8e,0x9,0x8e,0x9,0x8e,0xa,0x8e,0xa,0x8e,0x9,0x8e,0xb,0x8e,0xb,0x8e,0xb,0x8e,0xc,0x8e,0xc,0x8e,0xc,0x8e,0xd,0x8e,0xe,0x8e,0xe,0x8e,0xd,0x8e,0xf,0x8e,0xf,0x8e,0xf,0x8e,0x10,0x8e,0x10,0x8e,0x11,0x8e,0x11,0xc0,0xc0,0xc0,0x8e,0x11,0xc1,0x2,0x74,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8e,0x12,0xd,0x8e,0x13,0xe5,0x88,0x22,0xc3,0x8d,0x3c,0x8d,0x3d,0x82,0x7a,0x8e,0x14,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x1,0xd3,0xdd,0x0,0x0,0x23,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x2,0xce,0xc6,0x8b,0x30,0xc4,0x0,0xca,0x2,0xd3,0xd3,0xdb,0x0,0x0,0x24,0xc2,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8c,0x77,0xd3,0xdd,0x0,0x0,0x48,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x2,0xce,0xc6,0x8b,0x31,0xc4,0x0,0xca,0x2,0xd3,0xd3,0xdb,0x0,0x0,0x49,0xc2,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x83,0x57,0xd3,0xdd,0x0,0x0,0x72,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x3,0xce,0xc6,0x8b,0x32,0xc4,0x0,0xca,0x2,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0x73,0xc2,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8d,0x1d,0xd3,0xdd,0x0,0x0,0x9c,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x3,0xce,0xc6,0x8b,0x33,0xc4,0x0,0xca,0x2,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0x9d,0xc2,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x41,0xd3,0xc6,0x83,0x3d,0xca,0x0,0xd3,0xd1,0x0,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x42,0xd3,0xdd,0x0,0x0,0xc9,0xe1,0x1,0xc7,0x18,0xe0,0x1,0xcc,0xc6,0x83,0x3d,0xc6,0x8b,0x3a,0xd3,0xd3,0xdd,0x0,0x0,0xff,0xe0,0x0,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x83,0x3d,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x42,0xd3,0xd3,0xc6,0x8b,0x38,0xd3,0xdd,0x0,0x0,0xfa,0xe1,0x1,0xc9,0x0,0x3,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x42,0xd3,0xd3,0xdb,0x0,0x0,0xfb,0xc2,0xdb,0x0,0x1,0x0,0xc2,0xcb,0x0,0xdd,0x0,0x1,0x15,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x38,0xd3,0xc6,0x83,0x3d,0xca,0x0,0xd3,0xdd,0x0,0x1,0x28,0xe1,0x1,0xc7,0x18,0xe0,0x1,0xcc,0xc6,0x83,0x3d,0xc6,0x8b,0x3a,0xd3,0xd3,0xdd,0x0,0x1,0x45,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x38,0xd3,0xc6,0x8d,0x31,0xca,0x0,0xd3,0xc6,0x8b,0x36,0xd3,0xdb,0x0,0x1,0x46,0xc2,0xcb,0x0,0xdd,0x0,0x2,0x4d,0xe0,0x0,0xcb,0x0,0xc6,0x84,0x6c,0xd3,0xdd,0x0,0x1,0xc7,0xe1,0x1,0xc7,0x18,0xca,0x1,0xd3,0xdd,0x0,0x1,0x92,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x32,0xc6,0x8b,0x3d,0xc6,0x84,0x6c,0xc6,0x88,0x71,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x71,0xd3,0xc6,0x8b,0x3c,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3c,0xd3,0xd3,0xd3,0xdb,0x0,0x1,0x93,0xc2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x9,0xc7,0x4,0xc6,0x8d,0x34,0xc6,0x8b,0x3d,0xc6,0x84,0x48,0xc6,0x8d,0x33,0xca,0x1,0xc6,0x88,0x71,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x71,0xd3,0xc6,0x8b,0x3c,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3c,0xd3,0xd3,0xd3,0xdb,0x0,0x1,0xc8,0xc2,0xe1,0x1,0xc7,0x18,0xca,0x1,0xd3,0xdd,0x0,0x2,0xd,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x9,0xc7,0x4,0xc6,0x8d,0x35,0xc6,0x8b,0x3d,0xc6,0x84,0x79,0xc6,0x88,0x71,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x71,0xd3,0xc6,0x8b,0x3c,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3c,0xd3,0xc6,0x8b,0x3f,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xd3,0xd3,0xdb,0x0,0x2,0xe,0xc2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0xb,0xc7,0x4,0xc6,0x8d,0x36,0xc6,0x8b,0x3d,0xc6,0x84,0x5a,0xc6,0x8d,0x33,0xca,0x1,0xc6,0x88,0x71,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x71,0xd3,0xc6,0x8b,0x3c,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3c,0xd3,0xc6,0x8b,0x3f,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xd3,0xd3,0xdb,0x0,0x2,0x4e,0xc2,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x85,0x6,0xd3,0xdd,0x0,0x2,0x68,0xe1,0x1,0xc7,0x18,0xe0,0x0,0xce,0xc6,0x82,0x61,0xd3,0xd3,0xdd,0x0,0x2,0x78,0xe1,0x1,0xc7,0x18,0xe0,0x0,0xce,0xc6,0x8c,0x46,0xd3,0xd3,0xdd,0x0,0x2,0xbf,0xe1,0x1,0xc7,0x18,0xca,0x1,0xd3,0xdd,0x0,0x2,0xa0,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x3,0xc7,0x4,0xc6,0x8d,0x37,0xc6,0x8b,0x3d,0xc6,0x85,0x6,0xd3,0xd3,0xdb,0x0,0x2,0xa1,0xc2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x8d,0x38,0xc6,0x8b,0x3d,0xc6,0x85,0xd,0xc6,0x8d,0x33,0xca,0x1,0xd3,0xd3,0xdb,0x0,0x2,0xc0,0xc2,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x85,0x1a,0xd3,0xdd,0x0,0x2,0xda,0xe1,0x1,0xc7,0x18,0xe0,0x0,0xce,0xc6,0x82,0x61,0xd3,0xd3,0xdd,0x0,0x2,0xea,0xe1,0x1,0xc7,0x18,0xe0,0x0,0xce,0xc6,0x8c,0x46,0xd3,0xd3,0xdd,0x0,0x3,0x42,0xe1,0x1,0xc7,0x18,0xca,0x1,0xd3,0xdd,0x0,0x3,0x23,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x89,0x23,0xd3,0xc6,0x86,0x5f,0xc6,0x85,0x1a,0xc0,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x3,0xc7,0x4,0xc6,0x8d,0x37,0xc6,0x8b,0x3d,0xc6,0x85,0x1a,0xd3,0xd3,0xdb,0x0,0x3,0x24,0xc2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x8d,0x38,0xc6,0x8b,0x3d,0xc6,0x85,0x21,0xc6,0x8d,0x33,0xca,0x1,0xd3,0xd3,0xdb,0x0,0x3,0x43,0xc2,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xdd,0x0,0x3,0xed,0xe0,0x0,0xce,0xc6,0x8c,0x46,0xd3,0xdd,0x0,0x3,0x77,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x3,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x2e,0xca,0x0,0xca,0x1,0xca,0x2,0xd3,0xd3,0xdb,0x0,0x3,0x78,0xc2,0xe0,0x3,0xe0,0x0,0xce,0xc6,0x8c,0x39,0xd3,0xc6,0x8b,0x2e,0xca,0x0,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x1f,0xca,0x1,0xc4,0x0,0xd3,0xc4,0x1,0xd3,0xca,0x2,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x20,0xe0,0x0,0xcb,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x83,0x79,0xd3,0xdc,0x0,0x3,0xb9,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8d,0x39,0xd3,0xdc,0x0,0x3,0xc7,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x8d,0x3a,0xd3,0xdd,0x0,0x3,0xdf,0xe0,0x2,0xe0,0x0,0xce,0xc6,0x89,0x23,0xd3,0xc6,0x86,0x5f,0xca,0x0,0xc0,0xd3,0xdb,0x0,0x3,0xe0,0xc2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x1,0xd3,0xdb,0x0,0x3,0xee,0xc2,0xe0,0x2,0xc9,0x0,0x0,0xc6,0x86,0x5f,0xca,0x0,0xc0,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x83,0x79,0xc6,0x89,0xd,0xca,0x0,0xc6,0x9,0xca,0x2,0xd3,0xd3,0x0,0xd,0x70,0x61,0x72,0x65,0x6e,0x74,0x56,0x69,0x73,0x69,0x62,0x6c,0x65,0x6c,0x8e,0x16,0xc0,0x8c,0x46,0xc0,0x8c,0x39,0xc0,0x8b,0x72,0xc0,0x8b,0x38,0xc0,0x89,0x23,0xc0,0x83,0x52,0xc0,0x89,0xf,0xc0,0x8b,0x41,0xc0,0x8b,0x63,0xc0,0x82,0x61,0xc0,0x85,0x6,0xc0,0x5,0x53,0x63,0x6f,0x70,0x65,0x21,0x8c,0x39,0x22,0x8e,0x19,0x82,0x62,0xc1,0x88,0xac,0xc1,0x88,0xa0,0xc1,0x88,0x92,0xc1,0x88,0xe2,0xc1,0x89,0x7a,0xc1,0x89,0x6c,0xc1,0x89,0xb2,0xc1,0x89,0xa4,0xc1,0x8a,0x7e,0xc1,0x8a,0x70,0xc1,0x8a,0xb4,0xc1,0x8a,0xaa,0xc1,0x8a,0xea,0xc1,0x8a,0xdc,0xc1,0x8b,0x1c,0xc1,0x8b,0x12,0x3f,0xc0,0xc0,0x8e,0x1b,0x8e,0x1b,0x8e,0x1c,0x8e,0x1d,0x8e,0x1d,0x8e,0x1c,0x8e,0x1b,0x8e,0x1e,0x8e,0x1e,0x8e,0x1e,0x8e,0x1f,0x8e,0x20,0x8e,0x1f,0x8e,0x21,0x8e,0x22,0x8e,0x21,0x8e,0x23,0x8e,0x24,0x8e,0x23,0x8e,0x25,0x8e,0x26,0x8e,0x25,0x8e,0x27,0x8e,0x28,0x8e,0x27,0x8e,0x29,0x8e,0x2a,0x8e,0x29,0xc0,0xc1,0x2,0xb6,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8e,0x2b,0xd,0x8e,0x2c,0xe5,0x81,0xe,0x8e,0x18,0x8e,0x1a,0xc4,0xc4,0x8e,0x2d,0xe1,0x1b,0xc7,0x4,0xc6,0x8e,0x17,0xc6,0x8b,0x63,0xc9,0x0,0x4,0xc6,0x8c,0x39,0xca,0x0,0xc6,0x82,0x61,0xca,0x1,0xc6,0x8e,0x16,0xe1,0x2,0xc7,0x1f,0xe0,0x0,0xe8,0x0,0xca,0x0,0xc6,0x89,0xf,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xc6,0x82,0x61,0xe1,0x2,0xc7,0x1f,0xca,0x1,0xc1,0xd3,0xc6,0x8c,0x46,0xc1,0xc6,0x83,0x52,0xc1,0xc6,0x8b,0x41,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xc6,0x89,0x23,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xc6,0x8b,0x38,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xc6,0x89,0xf,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xc6,0x8b,0x72,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xc6,0x85,0x6,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xd3,0x0,0x6b,0x8e,0x16,0xc0,0x8c,0x46,0xc0,0x8c,0x39,0xc0,0x8b,0x72,0xc0,0x8b,0x38,0xc0,0x83,0x52,0xc0,0x89,0xf,0xc0,0x8b,0x41,0xc0,0x8b,0x63,0xc0,0x82,0x61,0xc0,0x85,0x6,0xc0,0xb,0x49,0x6e,0x6c,0x69,0x6e,0x65,0x53,0x63,0x6f,0x70,0x65,0x21,0x83,0x52,0x22,0x8e,0x19,0x8e,0x31,0xc1,0x8d,0x7e,0xc1,0x8e,0x1c,0xc1,0x8e,0x5c,0xc1,0x8e,0x4e,0xc1,0x8e,0x92,0xc1,0x8e,0x84,0xc1,0x8e,0xca,0xc1,0x8f,0x4,0xc1,0x8f,0x3a,0x34,0xc0,0xc0,0x8e,0x33,0x8e,0x33,0x8e,0x34,0x8e,0x34,0x8e,0x34,0x8e,0x35,0x8e,0x36,0x8e,0x35,0x8e,0x37,0x8e,0x38,0x8e,0x37,0x8e,0x39,0x8e,0x39,0x8e,0x3a,0x8e,0x3a,0x8e,0x3b,0x8e,0x3b,0xc0,0xc1,0x2,0xd6,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8e,0x3c,0xd,0x8e,0x3d,0xe5,0x71,0x8e,0x30,0x8e,0x32,0xc4,0xc4,0x8e,0x3e,0xe1,0x17,0xc7,0x4,0xc6,0x8e,0x2f,0xc6,0x8b,0x63,0xc9,0x0,0x4,0xc6,0x8c,0x39,0xca,0x0,0xc6,0x8e,0x16,0xe0,0x0,0xca,0x0,0xc6,0x8e,0x16,0xd3,0xc6,0x82,0x61,0xc1,0xc6,0x8c,0x46,0xc0,0xc6,0x83,0x52,0xe1,0x2,0xc7,0x1f,0xca,0x1,0xc1,0xd3,0xc6,0x8b,0x41,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xc6,0x8b,0x38,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xc6,0x89,0xf,0xe0,0x0,0xca,0x0,0xc6,0x89,0xf,0xd3,0xc6,0x8b,0x72,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x72,0xd3,0xc6,0x85,0x6,0xe0,0x0,0xca,0x0,0xc6,0x85,0x6,0xd3,0xd3,0x0,0x62,0x8b,0x38,0xc0,0x89,0xd,0xc0,0x63,0x8b,0x44,0xc0,0x8b,0x38,0xc0,0x89,0xd,0xc0,0x7,0x63,0x6c,0x6f,0x73,0x65,0x66,0x6e,0x21,0x81,0x49,0x21,0x8e,0x43,0x22,0x8b,0x2e,0x8b,0x42,0xc1,0x8f,0xa8,0xc1,0x8f,0xd2,0xc1,0x8f,0xf0,0xc1,0x90,0x3a,0xc1,0x90,0x42,0xc1,0x90,0x58,0xc1,0x90,0x88,0xc1,0x90,0xa6,0x36,0x8e,0x46,0x8e,0x46,0x8e,0x47,0xc0,0xc0,0x8e,0x48,0x8e,0x48,0xc0,0x8e,0x47,0x8e,0x49,0x8e,0x4a,0x8e,0x4a,0x8e,0x4b,0x8e,0x4b,0x8e,0x49,0x8e,0x4c,0xc0,0xc0,0x8e,0x4d,0x8e,0x4d,0xc0,0x8e,0x4c,0xc1,0x2,0xf2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8e,0x4e,0xd,0x8e,0x4f,0xe5,0x79,0x8e,0x42,0x8e,0x44,0x8e,0x45,0x82,0x7a,0x8e,0x50,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x83,0x3d,0xca,0x0,0xd3,0xd1,0x0,0xe0,0x2,0xc9,0x0,0x1,0xc6,0x86,0x5f,0xca,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x8e,0x40,0xc6,0x89,0xd,0xe0,0x0,0xcb,0x0,0xc6,0x89,0xd,0xd3,0xc6,0x8b,0x38,0xc1,0xd3,0xd3,0xe1,0x2,0xc9,0x0,0x8,0xe0,0x0,0xcb,0x0,0xc6,0x89,0x30,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x38,0xd3,0xd3,0xd1,0x1,0xe0,0x2,0xc9,0x0,0x1,0xc6,0x86,0x5f,0xca,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0x41,0xc6,0x89,0xd,0xe0,0x0,0xcb,0x0,0xc6,0x89,0xd,0xd3,0xc6,0x8b,0x38,0xc1,0xc6,0x8b,0x44,0xcb,0x1,0xd3,0xd3,0x0,0x4,0x6c,0x61,0x7a,0x79,0x1,0x64,0x7,0x61,0x72,0x67,0x73,0x70,0x65,0x63,0x21,0x84,0x6c,0x21,0x8e,0x55,0xc1,0x91,0x36,0xc1,0x91,0x2a,0xc1,0x91,0x58,0xc1,0x91,0x5a,0xc1,0x91,0x62,0xc1,0x91,0x76,0xc1,0x91,0xa6,0xc1,0x91,0xba,0xc1,0x91,0xbc,0xc1,0x91,0xc4,0xc1,0x91,0xd8,0xc1,0x91,0xf0,0xc1,0x91,0xf8,0xe1,0x20,0x8e,0x57,0x8e,0x57,0x8e,0x58,0x8e,0x58,0x8e,0x57,0x8e,0x59,0x8e,0x59,0x8e,0x5a,0x8e,0x5a,0x8e,0x5b,0x8e,0x5b,0x8e,0x5c,0x8e,0x5c,0x8e,0x5a,0x8e,0x59,0x8e,0x5d,0x8e,0x5d,0x8e,0x5e,0x8e,0x5e,0x8e,0x5f,0x8e,0x5f,0x8e,0x60,0x8e,0x60,0x8e,0x61,0x8e,0x61,0x8e,0x5f,0x8e,0x5e,0x8e,0x62,0x8e,0x62,0x8e,0x63,0x8e,0x63,0x8e,0x62,0xc1,0x2,0xfe,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8e,0x64,0xd,0x8e,0x65,0xe5,0x79,0x8e,0x54,0x8e,0x56,0xc4,0xc4,0x8e,0x66,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x8e,0x52,0xd3,0xdd,0x0,0x0,0x35,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x3,0xc7,0x3,0xe0,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x8e,0x53,0xd3,0xc0,0xd3,0xd3,0xdb,0x0,0x0,0x36,0xc2,0xe8,0x0,0xca,0x0,0xc6,0x8e,0x53,0xd3,0xdd,0x0,0x0,0x62,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x2,0xc7,0x3,0xe0,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x8e,0x53,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0x63,0xc2,0xe1,0x1,0xc7,0x3,0xe0,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xd3,0x0,0x7,0x69,0x73,0x46,0x72,0x61,0x6d,0x65,0xc1,0x3,0x12,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x8e,0x69,0xb4,0xc3,0xc4,0xc4,0xc4,0x8e,0x6a,0xe1,0x2,0xc7,0x9,0xc9,0x1,0x1,0xc4,0x1,0xd3,0xd9,0x1,0x1,0x0,0x23,0xc0,0xc0,0x8b,0x3d,0x24,0x8b,0x49,0x89,0xd,0x8b,0x3d,0x9,0xc1,0x93,0xb0,0xc1,0x93,0xf8,0xc1,0x94,0xc,0xc1,0x94,0x42,0x2f,0x8e,0x6e,0xc0,0xc0,0x8e,0x6e,0x8e,0x6f,0x8e,0x6f,0x8e,0x6f,0x8e,0x70,0x8e,0x70,0x8e,0x70,0x8e,0x70,0x8e,0x70,0x8e,0x70,0x8e,0x71,0x8e,0x71,0xc1,0x3,0x10,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x8e,0x72,0xd,0x8e,0x73,0xe5,0x50,0xc3,0xc4,0x8e,0x6d,0x8c,0x56,0x8e,0x74,0xe0,0x1,0xc8,0x0,0x2,0xc6,0x83,0x3d,0xe1,0x0,0xd0,0x8e,0x6b,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xd2,0x2,0x2,0xd2,0x3,0x3,0xe1,0x1,0xc7,0x18,0xcb,0x1,0xd3,0xdd,0x0,0x0,0x36,0xe1,0x1,0xc7,0x17,0xe1,0x1,0xc7,0x3,0xc4,0x0,0xd3,0xd3,0xdb,0x0,0x0,0x37,0xc2,0xf0,0x3,0x8e,0x6c,0xc9,0x0,0x0,0xc6,0x3e,0xcb,0x1,0xcb,0x3,0xcb,0x2,0xd3,0x0,0x2,0x61,0x73,0x22,0x8e,0x55,0x8e,0x43,0xc1,0x95,0x2e,0xc1,0x95,0x44,0xc1,0x95,0x58,0xc1,0x95,0x74,0x28,0x8e,0x78,0x8e,0x79,0x8e,0x79,0x8e,0x7a,0x8e,0x7a,0x8e,0x78,0x8e,0x7b,0x8e,0x7b,0xc1,0x3,0x1a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8e,0x7c,0xd,0x8e,0x7d,0xe5,0x28,0xc3,0x8e,0x77,0xc4,0xc4,0x8e,0x7e,0xe0,0x2,0xc9,0x1,0x0,0xc6,0x8b,0x2f,0xe0,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x9,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x7,0xca,0x0,0xd3,0x0,0x4,0x62,0x6f,0x64,0x79,0x3,0x73,0x74,0x6d,0x21,0x8f,0x1,0x21,0x8f,0x2,0xc1,0x95,0xde,0x22,0x8f,0x4,0x8f,0x4,0xc1,0x3,0x1c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8f,0x5,0xd,0x8f,0x6,0xb3,0xc3,0x8f,0x3,0xc4,0xc4,0x8f,0x7,0xe1,0x2,0xc9,0x2,0x13,0xc9,0x1,0x0,0xca,0x0,0xd3,0x0,0x66,0x8f,0x0,0xc0,0x89,0x30,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x89,0xf,0xc0,0x85,0x6,0xc0,0x22,0x85,0x6,0x8f,0x0,0xc1,0x95,0x6,0xc1,0x94,0xfa,0xc1,0x94,0xf2,0xc1,0x95,0x0,0xc1,0x95,0xba,0xc1,0x95,0xb0,0xc1,0x96,0x1c,0xc1,0x96,0xae,0xc1,0x96,0xa0,0xc1,0x96,0xce,0x39,0x8f,0xb,0x8f,0xc,0x8f,0xc,0x8f,0xd,0x8f,0xd,0x8f,0xe,0x8f,0xe,0x8f,0xe,0x8f,0xc,0x8f,0xb,0x8f,0xf,0x8f,0x10,0x8f,0x10,0x8f,0xf,0x8f,0x11,0x8f,0x11,0xc0,0xc0,0x8f,0x12,0x8f,0x13,0x8f,0x13,0x8f,0x12,0x8f,0x14,0x8f,0x14,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x8f,0x15,0xd,0x8e,0x7d,0xe5,0x81,0x2,0xc3,0xc4,0x8f,0xa,0x82,0x7a,0x8f,0x16,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8e,0x76,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x8e,0x7f,0xd3,0xd1,0x0,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x0,0xd3,0xc6,0x89,0x24,0xd0,0x8f,0x8,0xd3,0xd1,0x1,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x36,0xd3,0xe1,0xd,0xc7,0x4,0xc6,0x8f,0x9,0xc6,0x8b,0x3d,0xc6,0x8b,0x44,0xc6,0x89,0x30,0xc9,0x0,0x0,0xc6,0x85,0x6,0xcb,0x0,0xc6,0x8f,0x0,0xcb,0x1,0xc6,0x89,0xf,0xe0,0x0,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x89,0xf,0xd3,0xc6,0x89,0x22,0xd3,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0xc1,0x97,0x8a,0xc1,0x97,0xa0,0xc1,0x97,0xb4,0xc1,0x97,0xd0,0x28,0x8f,0x18,0x8f,0x19,0x8f,0x19,0x8f,0x1a,0x8f,0x1a,0x8f,0x18,0x8f,0x1b,0x8f,0x1b,0xc1,0x3,0x24,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8f,0x1c,0xd,0x8f,0x1d,0xe5,0x28,0xc3,0x8e,0x77,0xc4,0xc4,0x8f,0x1e,0xe0,0x2,0xc9,0x1,0x0,0xc6,0x8b,0x2f,0xe0,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x9,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x7,0xca,0x0,0xd3,0x0,0xc1,0x98,0x3a,0x22,0x8f,0x20,0x8f,0x20,0xc1,0x3,0x26,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8f,0x21,0xd,0x8f,0x22,0xb3,0xc3,0x8f,0x3,0xc4,0xc4,0x8f,0x23,0xe1,0x2,0xc9,0x2,0x13,0xc9,0x1,0x0,0xca,0x0,0xd3,0x0,0xc1,0x97,0x62,0xc1,0x97,0x56,0xc1,0x97,0x4e,0xc1,0x97,0x5c,0xc1,0x98,0x16,0xc1,0x98,0xc,0xc1,0x98,0x78,0xc1,0x99,0x4,0xc1,0x98,0xf6,0xc1,0x99,0x24,0x39,0x8f,0x25,0x8f,0x26,0x8f,0x26,0x8f,0x27,0x8f,0x27,0x8f,0x28,0x8f,0x28,0x8f,0x28,0x8f,0x26,0x8f,0x25,0x8f,0x29,0x8f,0x2a,0x8f,0x2a,0x8f,0x29,0x8f,0x2b,0x8f,0x2b,0xc0,0xc0,0x8f,0x2c,0x8f,0x2d,0x8f,0x2d,0x8f,0x2c,0x8f,0x2e,0x8f,0x2e,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x8f,0x2f,0xd,0x8f,0x1d,0xe5,0x81,0x2,0xc3,0xc4,0x8f,0xa,0x82,0x7a,0x8f,0x30,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8e,0x76,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x8f,0x1f,0xd3,0xd1,0x0,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x0,0xd3,0xc6,0x89,0x24,0xd0,0x8f,0x24,0xd3,0xd1,0x1,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x36,0xd3,0xe1,0xd,0xc7,0x4,0xc6,0x8f,0x9,0xc6,0x8b,0x3d,0xc6,0x82,0x61,0xc6,0x89,0x30,0xc9,0x0,0x0,0xc6,0x85,0x6,0xcb,0x0,0xc6,0x8f,0x0,0xcb,0x1,0xc6,0x89,0xf,0xe0,0x0,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x89,0xf,0xd3,0xc6,0x89,0x22,0xd3,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0xc1,0x99,0xe0,0xc1,0x99,0xf6,0xc1,0x9a,0xa,0xc1,0x9a,0x26,0x28,0x8f,0x32,0x8f,0x33,0x8f,0x33,0x8f,0x34,0x8f,0x34,0x8f,0x32,0x8f,0x35,0x8f,0x35,0xc1,0x3,0x2e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8f,0x36,0xd,0x8f,0x37,0xe5,0x28,0xc3,0x8e,0x77,0xc4,0xc4,0x8f,0x38,0xe0,0x2,0xc9,0x1,0x0,0xc6,0x8b,0x2f,0xe0,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x9,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x7,0xca,0x0,0xd3,0x0,0xc1,0x9a,0x90,0x22,0x8f,0x3a,0x8f,0x3a,0xc1,0x3,0x30,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8f,0x3b,0xd,0x8f,0x3c,0xb3,0xc3,0x8f,0x3,0xc4,0xc4,0x8f,0x3d,0xe1,0x2,0xc9,0x2,0x13,0xc9,0x1,0x0,0xca,0x0,0xd3,0x0,0xc1,0x99,0xb8,0xc1,0x99,0xac,0xc1,0x99,0xa4,0xc1,0x99,0xb2,0xc1,0x9a,0x6c,0xc1,0x9a,0x62,0xc1,0x9a,0xce,0xc1,0x9b,0x5a,0xc1,0x9b,0x4c,0xc1,0x9b,0x7a,0x39,0x8f,0x3f,0x8f,0x40,0x8f,0x40,0x8f,0x41,0x8f,0x41,0x8f,0x42,0x8f,0x42,0x8f,0x42,0x8f,0x40,0x8f,0x3f,0x8f,0x43,0x8f,0x44,0x8f,0x44,0x8f,0x43,0x8f,0x45,0x8f,0x45,0xc0,0xc0,0x8f,0x46,0x8f,0x47,0x8f,0x47,0x8f,0x46,0x8f,0x48,0x8f,0x48,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x8f,0x49,0xd,0x8f,0x37,0xe5,0x81,0x2,0xc3,0xc4,0x8f,0xa,0x82,0x7a,0x8f,0x4a,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8e,0x76,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x8f,0x39,0xd3,0xd1,0x0,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x0,0xd3,0xc6,0x89,0x24,0xd0,0x8f,0x3e,0xd3,0xd1,0x1,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x8b,0x36,0xd3,0xe1,0xd,0xc7,0x4,0xc6,0x8f,0x9,0xc6,0x8b,0x3d,0xc6,0x89,0x30,0xc6,0x89,0x30,0xc9,0x0,0x0,0xc6,0x85,0x6,0xcb,0x0,0xc6,0x8f,0x0,0xcb,0x1,0xc6,0x89,0xf,0xe0,0x0,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x89,0xf,0xd3,0xc6,0x89,0x22,0xd3,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0x6,0x6c,0x65,0x78,0x74,0x6f,0x70,0x4,0x74,0x65,0x72,0x6d,0x21,0x8f,0x4d,0x9,0x6c,0x69,0x6e,0x6b,0x66,0x72,0x61,0x6d,0x65,0x21,0x8f,0x4f,0x23,0x89,0x31,0x8f,0x4e,0x8f,0x50,0x3,0x24,0x61,0x74,0x22,0x89,0x30,0x8f,0x52,0x22,0xc1,0xc2,0xc1,0x92,0x80,0xc1,0x92,0xa4,0xc1,0x92,0x98,0xc1,0x92,0xe6,0xc1,0x92,0xd8,0xc1,0x93,0x48,0xc1,0x94,0xa0,0xc1,0x94,0x94,0xc1,0x97,0x2,0xc1,0x96,0xf6,0xc1,0x99,0x58,0xc1,0x99,0x4c,0xe1,0x22,0x8f,0x55,0x8f,0x56,0x8f,0x56,0x8f,0x57,0x8f,0x57,0x8f,0x56,0x8f,0x55,0x8f,0x58,0x8f,0x59,0x8f,0x58,0x8f,0x5a,0x8f,0x5a,0x8f,0x5a,0x8f,0x5b,0x8f,0x5b,0x8f,0x5c,0x8f,0x5c,0x8f,0x5b,0xc0,0xc0,0x8f,0x5d,0x8f,0x5d,0x8f,0x5e,0x8f,0x5e,0x8f,0x5d,0xc0,0xc0,0x8f,0x5f,0x8f,0x5f,0x8f,0x60,0x8f,0x60,0x8f,0x5f,0xc0,0xc0,0xc1,0x3,0x8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x8f,0x61,0xd,0x8f,0x62,0xe5,0x81,0x6,0x8f,0x4c,0x8f,0x51,0x8f,0x53,0x8f,0x54,0x8f,0x63,0xe1,0x2,0xc9,0x0,0x5,0xca,0x0,0xe1,0x2,0xc7,0x20,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x44,0xd3,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x21,0xca,0x2,0xd3,0xdd,0x0,0x0,0x37,0xc4,0x0,0xd6,0x1,0xf1,0x1,0x82,0x62,0xc7,0x16,0xd0,0x8e,0x75,0xd3,0xdb,0x0,0x0,0x38,0xc2,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x44,0xd3,0xe3,0x0,0xd0,0x8f,0x17,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x82,0x61,0xd3,0xe3,0x0,0xd0,0x8f,0x31,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x89,0x30,0xd3,0xe3,0x0,0xd0,0x8f,0x4b,0xd3,0xd4,0x0,0x1,0x74,0x21,0x8f,0x65,0x21,0x8f,0x66,0xc1,0x9d,0xc8,0xc1,0x9d,0xea,0x25,0x8f,0x68,0x8f,0x68,0x8f,0x69,0x8f,0x69,0x8f,0x69,0xc1,0x3,0x3e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8f,0x6a,0xd,0x8f,0x6b,0xe5,0x24,0xc3,0x8f,0x67,0xc4,0xc4,0x8f,0x6c,0xe1,0x2,0xc9,0x2,0x9,0xca,0x0,0xc8,0x1,0x1,0xd3,0xdd,0x0,0x0,0x1b,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xc0,0xd3,0xdb,0x0,0x0,0x1c,0xc2,0x0,0xc1,0x9d,0x9a,0x22,0x8f,0x6e,0x8f,0x6e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x8f,0x6f,0xd,0x8f,0x6b,0xb5,0xc3,0xc4,0xc4,0xc4,0x8f,0x70,0xf0,0x1,0x82,0x62,0xc8,0x0,0x0,0xc6,0x82,0x63,0xd0,0x8f,0x6d,0xd3,0x0,0x8,0x69,0x73,0x4f,0x62,0x6a,0x65,0x63,0x74,0x4,0x6b,0x65,0x79,0x73,0x1,0x6b,0x21,0x8f,0x74,0x21,0x8f,0x75,0xc1,0x9f,0x20,0xc1,0x9f,0x2e,0xc1,0x9f,0x22,0xc1,0x9f,0x66,0x28,0x8f,0x77,0x8f,0x78,0x8f,0x79,0x8f,0x78,0x8f,0x77,0x8f,0x7a,0x8f,0x7a,0x8f,0x7a,0xc1,0x3,0x44,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x8f,0x7b,0xd,0x8f,0x7c,0xe5,0x2f,0xc3,0x8f,0x76,0xc4,0xc4,0x8f,0x7d,0xe1,0x2,0xc9,0x2,0x9,0xe0,0x2,0xc7,0x1e,0xc6,0x83,0x3d,0xc8,0x1,0x0,0xca,0x0,0xd3,0xc8,0x1,0x1,0xd3,0xdd,0x0,0x0,0x26,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xc0,0xd3,0xdb,0x0,0x0,0x27,0xc2,0x0,0xc1,0x9e,0x60,0xc1,0x9e,0x54,0xc1,0x9e,0x8e,0xc1,0x9e,0x82,0xc1,0x9e,0xac,0xc1,0x9e,0xf2,0xc1,0x9e,0xdc,0xc1,0x9e,0xd0,0x32,0x8f,0x7f,0x8f,0x7f,0x90,0x0,0x90,0x0,0x8f,0x7f,0x90,0x1,0x90,0x1,0x90,0x2,0x90,0x2,0x90,0x1,0x90,0x3,0x90,0x3,0x90,0x3,0x90,0x4,0x90,0x5,0x90,0x6,0x90,0x5,0x90,0x4,0xc1,0x3,0x42,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x90,0x7,0xd,0x90,0x8,0xe5,0x54,0xc3,0xc4,0xc4,0xc4,0x90,0x9,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x2e,0xd3,0xdd,0x0,0x0,0x26,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x89,0xd,0xd3,0xc8,0x0,0x1,0xd3,0xdd,0x0,0x0,0x36,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc0,0xd3,0xdb,0x0,0x0,0x37,0xc2,0xf0,0x1,0x82,0x62,0xe0,0x1,0xc7,0x1e,0xc6,0x8f,0x73,0xc8,0x0,0x0,0xd3,0xc6,0x82,0x63,0xd0,0x8f,0x7e,0xd3,0x0,0xc1,0x3,0x46,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x90,0xb,0xa8,0xc3,0xc4,0xc4,0xc4,0x90,0xc,0xc2,0x0,0x8,0x6d,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x73,0x22,0x8f,0x4e,0x8b,0x46,0xc1,0x9d,0x7a,0xc1,0x9d,0x6e,0xc1,0x9e,0x1a,0xc1,0x9e,0xa,0x2c,0x90,0x10,0x90,0x11,0x90,0x10,0xc0,0xc0,0x90,0x12,0x90,0x13,0x90,0x12,0xc0,0xc0,0xc0,0xc0,0xc1,0x3,0x3c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x90,0x14,0xd,0x90,0x15,0xe5,0x2c,0x90,0xe,0x90,0xf,0xc4,0xc4,0x90,0x16,0xe1,0x1,0xc7,0x1d,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x8f,0x71,0xd3,0xe1,0x1,0xc7,0x22,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x90,0xa,0xd3,0xc0,0xe3,0x0,0xd0,0x90,0xd,0xd3,0xd4,0xc1,0x0,0x4,0x63,0x61,0x6c,0x6c,0x6,0x74,0x61,0x72,0x67,0x65,0x74,0x9,0x69,0x6e,0x6c,0x69,0x6e,0x61,0x62,0x6c,0x65,0x23,0x89,0x31,0x8f,0x4e,0x8b,0x46,0xc1,0xa0,0x40,0xc1,0xa0,0x34,0xc1,0xa0,0x7e,0xc1,0xa0,0x72,0xc1,0xa0,0x64,0xc1,0xa0,0xba,0xc1,0xa0,0xae,0xc1,0xa0,0xa0,0xc1,0xa0,0xd2,0xc1,0xa0,0xe4,0x38,0x90,0x1c,0x90,0x1c,0x90,0x1d,0x90,0x1d,0x90,0x1c,0x90,0x1e,0x90,0x1e,0x90,0x1f,0x90,0x20,0x90,0x20,0x90,0x1f,0x90,0x1e,0x90,0x21,0x90,0x21,0x90,0x22,0x90,0x23,0x90,0x23,0x90,0x22,0x90,0x21,0x90,0x24,0x90,0x24,0x90,0x25,0x90,0x25,0x90,0x24,0xc1,0x3,0x4c,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x90,0x26,0xd,0x90,0x27,0xe5,0x5f,0x90,0x1a,0x90,0x1b,0xc4,0xc4,0x90,0x28,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x90,0x18,0xd3,0xdd,0x0,0x0,0x2a,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xe0,0x0,0xca,0x1,0xc6,0x90,0x19,0xd3,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x2e,0xd3,0xdd,0x0,0x0,0x43,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x1,0xc6,0x90,0x19,0xd3,0xc6,0x89,0xd,0xd3,0xca,0x2,0xd3,0xdd,0x0,0x0,0x56,0xe1,0x1,0xc7,0x18,0xe0,0x1,0xca,0x0,0xc6,0x8b,0x34,0xca,0x2,0xd3,0xd3,0x0,0x5,0x63,0x61,0x74,0x63,0x68,0xb,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x42,0x6c,0x6f,0x63,0x6b,0x21,0x8f,0x4e,0xc1,0xa1,0x5c,0xc1,0xa1,0x50,0xc1,0xa1,0x7a,0xc1,0xa1,0x94,0xc1,0xa1,0x8c,0xc1,0xa1,0xb6,0xc1,0xa1,0xaa,0xc1,0xa1,0xa4,0xc1,0xa1,0xc8,0xc1,0xa1,0xe0,0xc1,0xa1,0xea,0x3b,0x90,0x2d,0x90,0x2d,0x90,0x2e,0x90,0x2e,0x90,0x2d,0x90,0x2f,0x90,0x2f,0x90,0x30,0x90,0x30,0x90,0x31,0x90,0x31,0x90,0x32,0x90,0x32,0x90,0x33,0x90,0x34,0x90,0x34,0x90,0x33,0x90,0x32,0x90,0x30,0x90,0x2f,0x90,0x35,0x90,0x35,0x90,0x36,0x90,0x37,0x90,0x37,0x90,0x36,0x90,0x35,0xc1,0x3,0x52,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x90,0x38,0xd,0x90,0x39,0xe5,0x5e,0x90,0x2b,0x90,0x2c,0xc4,0xc4,0x90,0x3a,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x82,0x61,0xd3,0xdd,0x0,0x0,0x3b,0xe1,0x1,0xc7,0x18,0xe1,0x2,0xc7,0x5,0xe8,0x0,0xca,0x0,0xc6,0x8e,0x76,0xd3,0xe1,0x2,0xc7,0x1c,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8e,0x76,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xd3,0xd3,0xdd,0x0,0x0,0x55,0xe1,0x1,0xc7,0x18,0xe1,0x2,0xc9,0x0,0x9,0xe0,0x0,0xca,0x0,0xc6,0x8f,0x0,0xd3,0xc6,0x90,0x2a,0xd3,0xd3,0x0,0x2,0x69,0x66,0x6,0x66,0x69,0x6c,0x74,0x65,0x72,0xc1,0xa3,0xba,0xc1,0xa3,0xc8,0x25,0x90,0x3e,0x90,0x3e,0x90,0x3f,0x90,0x3f,0x90,0x3e,0xc1,0x3,0x5e,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x90,0x40,0xd,0x90,0x41,0xb5,0xc3,0x8e,0x56,0xc4,0xc4,0x90,0x42,0xe1,0x1,0xc7,0x18,0xe8,0x0,0xca,0x0,0xc6,0x81,0x49,0xd3,0xd3,0x0,0xc1,0xa4,0x26,0x22,0x90,0x44,0x90,0x44,0xc1,0x3,0x60,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x90,0x45,0xd,0x90,0x46,0xb0,0xc3,0x8e,0x56,0xc4,0xc4,0x90,0x47,0xe8,0x0,0xca,0x0,0xc6,0x81,0x49,0xd3,0x0,0x4,0x65,0x6c,0x73,0x65,0xc1,0xa4,0x9c,0xc1,0xa4,0x90,0xc1,0xa4,0xac,0xc1,0xa4,0xca,0xc1,0xa4,0xd4,0xc1,0xa4,0xf2,0xc1,0xa5,0x34,0xc1,0xa5,0x28,0xc1,0xa5,0x4c,0xc1,0xa5,0x86,0xc1,0xa5,0x7a,0xc1,0xa5,0xae,0xc1,0xa5,0xa8,0xc1,0xa5,0xa2,0xc1,0xa5,0xe2,0xc1,0xa5,0xf4,0xc1,0xa5,0xee,0xc1,0xa6,0x12,0xc1,0xa6,0x32,0xc1,0xa6,0x2c,0xe1,0x2f,0x90,0x4a,0x90,0x4a,0x90,0x4b,0x90,0x4b,0x90,0x4a,0x90,0x4c,0x90,0x4c,0x90,0x4d,0x90,0x4e,0x90,0x4e,0x90,0x4d,0x90,0x4c,0x90,0x4f,0x90,0x4f,0x90,0x4f,0x90,0x50,0x90,0x50,0x90,0x51,0x90,0x51,0x90,0x50,0x90,0x52,0x90,0x52,0x90,0x52,0x90,0x53,0x90,0x53,0x90,0x54,0x90,0x54,0x90,0x53,0x90,0x55,0x90,0x55,0x90,0x56,0x90,0x57,0x90,0x57,0x90,0x56,0x90,0x55,0x90,0x58,0x90,0x59,0x90,0x5a,0x90,0x5a,0x90,0x59,0x90,0x58,0x90,0x5b,0x90,0x5c,0x90,0x5d,0x90,0x5d,0x90,0x5c,0x90,0x5b,0xc1,0x3,0x64,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x90,0x5e,0xd,0x90,0x5f,0xe5,0x81,0x45,0xc3,0xc4,0xc4,0xc4,0x90,0x60,0xe1,0x2,0xc7,0x20,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x81,0x44,0xd3,0xc4,0x1,0xd3,0xdc,0x0,0x0,0x28,0xe1,0x1,0xc7,0x18,0xe1,0x1,0xc9,0x1,0xb,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x82,0x61,0xd3,0xd3,0xd3,0xdd,0x0,0x0,0x38,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc1,0xd3,0xdb,0x0,0x0,0x39,0xc2,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xc9,0x0,0x1,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x59,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc0,0xd3,0xdb,0x0,0x0,0x5a,0xc2,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xc9,0x0,0x1,0xc6,0x81,0x44,0xd3,0xc4,0x1,0xd3,0xdd,0x0,0x0,0x87,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xc6,0x81,0x49,0xd3,0xc6,0x90,0x49,0xd3,0xdd,0x0,0x0,0xbe,0xe1,0x1,0xc9,0x1,0xb,0xe0,0x0,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xc6,0x4a,0xd3,0xd3,0xdc,0x0,0x0,0xbe,0xe1,0x2,0xc9,0x1,0xc,0xc8,0x0,0x0,0xe0,0x0,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xc6,0x4a,0xd3,0xd3,0x0,0xc1,0xa6,0x6c,0xc1,0xa6,0x60,0xc1,0xa6,0x9e,0xc1,0xa6,0x92,0xc1,0xa6,0xd0,0xc1,0xa6,0xc4,0x2f,0x90,0x62,0x90,0x62,0x90,0x63,0x90,0x63,0x90,0x62,0x90,0x64,0x90,0x64,0x90,0x65,0x90,0x65,0x90,0x64,0x90,0x66,0x90,0x66,0x90,0x67,0x90,0x67,0x90,0x66,0xc1,0x3,0x6a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x90,0x68,0xd,0x90,0x69,0xe5,0x3f,0xc3,0xc4,0xc4,0xc4,0x90,0x6a,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xc9,0x0,0x1,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x24,0xe1,0x2,0xc7,0x6,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x81,0x44,0xd3,0xc4,0x2,0xd3,0xdd,0x0,0x0,0x38,0xe1,0x2,0xc7,0x7,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x81,0x44,0xd3,0xc4,0x3,0xd3,0x0,0x8,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x49,0x66,0x22,0x89,0x31,0x8f,0x4e,0xa,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x5,0x6e,0x61,0x6d,0x65,0x64,0x22,0x90,0x6e,0x90,0x6f,0xc1,0xa3,0x2,0xc1,0xa3,0x1c,0xc1,0xa3,0x52,0xc1,0xa3,0x9c,0xc1,0xa3,0x92,0xc1,0xa4,0x2,0xc1,0xa3,0xf8,0xc1,0xa4,0x4a,0x36,0x90,0x71,0x90,0x71,0x90,0x72,0x90,0x72,0x90,0x71,0x90,0x73,0x90,0x73,0x90,0x73,0x90,0x74,0x90,0x75,0x90,0x75,0x90,0x74,0x90,0x76,0x90,0x77,0x90,0x77,0x90,0x76,0x90,0x78,0x90,0x78,0xc0,0xc0,0xc0,0xc0,0xc1,0x3,0x5a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x90,0x79,0xd,0x90,0x7a,0xe5,0x6e,0x90,0x6c,0x90,0x6d,0x90,0x70,0x82,0x7a,0x90,0x7b,0xe1,0x1,0xc7,0x18,0xe1,0x3,0xc9,0x0,0xa,0xca,0x0,0xca,0x1,0xc6,0x90,0x3c,0xd3,0xd3,0xdd,0x0,0x0,0x22,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xc1,0xd3,0xdb,0x0,0x0,0x23,0xc2,0xf0,0x1,0x82,0x62,0xe0,0x0,0xca,0x1,0xc6,0x85,0x6,0xd3,0xc6,0x90,0x3d,0xd0,0x90,0x43,0xd3,0xd1,0x0,0xf0,0x1,0x82,0x62,0xe0,0x0,0xca,0x1,0xc6,0x85,0x6,0xd3,0xc6,0x90,0x3d,0xd0,0x90,0x48,0xd3,0xd1,0x1,0xe8,0x0,0xca,0x1,0xc6,0x82,0x61,0xd3,0xe3,0x0,0xd0,0x90,0x61,0xd3,0xc0,0xe3,0x0,0xd0,0x90,0x6b,0xd3,0xd4,0x0,0x5,0x77,0x68,0x69,0x6c,0x65,0xb,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x57,0x68,0x69,0x6c,0x65,0xc1,0xa9,0xb0,0xc1,0xa9,0xca,0xc1,0xaa,0x6,0xc1,0xaa,0x42,0xc1,0xaa,0x36,0xc1,0xaa,0x2c,0xc1,0xaa,0x54,0xc1,0xaa,0x74,0xc1,0xaa,0x6e,0xc1,0xaa,0x64,0xc1,0xaa,0x98,0xc1,0xaa,0xa2,0xc1,0xaa,0xba,0xc1,0xaa,0xd2,0xc1,0xaa,0xf6,0xc1,0xaa,0xea,0xe1,0x25,0x90,0x7f,0x90,0x7f,0x91,0x0,0x91,0x0,0x90,0x7f,0x91,0x1,0x91,0x1,0x91,0x1,0x91,0x2,0x91,0x2,0x91,0x3,0x91,0x4,0x91,0x4,0x91,0x3,0x91,0x2,0x91,0x5,0x91,0x5,0x91,0x6,0x91,0x7,0x91,0x8,0x91,0x8,0x91,0x7,0x91,0x6,0x91,0x5,0x91,0x9,0x91,0xa,0x91,0xa,0x91,0x9,0x91,0xb,0x91,0xb,0x91,0xc,0x91,0xd,0x91,0xe,0x91,0xe,0x91,0xd,0x91,0xc,0x91,0xb,0xc1,0x3,0x76,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x91,0xf,0xd,0x91,0x10,0xe5,0x81,0x11,0x90,0x7e,0x90,0x6d,0xc4,0xc4,0x91,0x11,0xe1,0x1,0xc7,0x18,0xe1,0x3,0xc9,0x0,0xa,0xca,0x0,0xca,0x1,0xc6,0x90,0x7d,0xd3,0xd3,0xdd,0x0,0x0,0x22,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xc1,0xd3,0xdb,0x0,0x0,0x23,0xc2,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x1,0xc6,0x85,0x6,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x1,0xd3,0xdd,0x0,0x0,0x57,0xe1,0x1,0xc7,0x18,0xe8,0x0,0xe0,0x1,0xe0,0x0,0xca,0x1,0xc6,0x85,0x6,0xd3,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xc6,0x81,0x49,0xd3,0xd3,0xdd,0x0,0x0,0x69,0xe1,0x1,0xc9,0x0,0xb,0xe8,0x0,0xca,0x1,0xc6,0x82,0x61,0xd3,0xd3,0xdd,0x0,0x0,0x88,0xe1,0x1,0xc7,0x18,0xe1,0x2,0xc9,0x0,0x10,0xca,0x0,0xe0,0x0,0xe0,0x0,0xca,0x1,0xc6,0x82,0x61,0xd3,0xc6,0x8f,0x0,0xd3,0xd3,0xd3,0x0,0xa,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x4c,0x6f,0x6f,0x70,0xc1,0xab,0x5c,0xc1,0xab,0x76,0xc1,0xab,0xb0,0xc1,0xab,0xec,0xc1,0xab,0xe0,0xc1,0xab,0xd6,0xc1,0xac,0x14,0xc1,0xac,0x1e,0xc1,0xac,0x36,0xc1,0xac,0x4e,0xc1,0xac,0x72,0xc1,0xac,0x66,0x3c,0x91,0x14,0x91,0x14,0x91,0x15,0x91,0x15,0x91,0x14,0x91,0x16,0x91,0x16,0x91,0x16,0x91,0x17,0x91,0x17,0x91,0x18,0x91,0x19,0x91,0x19,0x91,0x18,0x91,0x17,0x91,0x1a,0x91,0x1b,0x91,0x1b,0x91,0x1a,0x91,0x1c,0x91,0x1c,0x91,0x1d,0x91,0x1e,0x91,0x1f,0x91,0x1f,0x91,0x1e,0x91,0x1d,0x91,0x1c,0xc1,0x3,0x7e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x91,0x20,0xd,0x91,0x21,0xe5,0x72,0x91,0x13,0x90,0x6d,0xc4,0xc4,0x91,0x22,0xe1,0x1,0xc7,0x18,0xe1,0x3,0xc9,0x0,0xa,0xca,0x0,0xca,0x1,0xc6,0x83,0x52,0xd3,0xd3,0xdd,0x0,0x0,0x22,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xc1,0xd3,0xdb,0x0,0x0,0x23,0xc2,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x1,0xc6,0x85,0x6,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x4a,0xe1,0x1,0xc9,0x0,0xb,0xe8,0x0,0xca,0x1,0xc6,0x82,0x61,0xd3,0xd3,0xdd,0x0,0x0,0x69,0xe1,0x1,0xc7,0x18,0xe1,0x2,0xc9,0x0,0x10,0xca,0x0,0xe0,0x0,0xe0,0x0,0xca,0x1,0xc6,0x82,0x61,0xd3,0xc6,0x8f,0x0,0xd3,0xd3,0xd3,0x0,0xc1,0xad,0x7c,0x22,0x91,0x24,0x91,0x24,0xc1,0x3,0x8a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x91,0x25,0xd,0x91,0x26,0xb0,0xc3,0xc4,0xc4,0xc4,0x91,0x27,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8f,0x0,0xd3,0x0,0xc1,0x3,0x8c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x91,0x29,0xaa,0xc3,0xc4,0xc4,0xc4,0x91,0x2a,0xc8,0x0,0x0,0x0,0x7,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x64,0xc1,0xad,0x60,0x26,0x91,0x2d,0x91,0x2d,0xc0,0xc0,0xc0,0xc0,0xc1,0x3,0x88,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x91,0x2e,0xd,0x91,0x2f,0xbf,0x91,0x2c,0x90,0x2c,0xc4,0xc4,0x91,0x30,0xe1,0x1,0xc9,0x0,0xb,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x91,0x28,0xd3,0xc0,0xe3,0x0,0xd0,0x91,0x2b,0xd3,0xd4,0x0,0xc1,0xaf,0x52,0xc1,0xaf,0x76,0x25,0x91,0x32,0x91,0x32,0x91,0x33,0x91,0x33,0x91,0x33,0xc1,0x3,0x94,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x91,0x34,0xd,0x91,0x35,0xe5,0x24,0xc3,0x8f,0x67,0xc4,0xc4,0x91,0x36,0xe1,0x2,0xc9,0x2,0x10,0xc8,0x1,0x0,0xca,0x0,0xd3,0xdd,0x0,0x0,0x1b,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xc0,0xd3,0xdb,0x0,0x0,0x1c,0xc2,0x0,0xc1,0xaf,0x24,0x22,0x91,0x38,0x91,0x38,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x91,0x39,0xd,0x91,0x35,0xb5,0xc3,0xc4,0xc4,0xc4,0x91,0x3a,0xf0,0x1,0x82,0x62,0xc8,0x0,0x1,0xc6,0x82,0x63,0xd0,0x91,0x37,0xd3,0x0,0xc1,0xb2,0x4,0xc1,0xb2,0xc,0x24,0x91,0x3c,0x91,0x3d,0x91,0x3d,0x91,0x3c,0xc1,0x3,0x9e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x91,0x3e,0xd,0x91,0x3f,0xb5,0xc3,0x8e,0x56,0xc4,0xc4,0x91,0x40,0xe1,0x1,0xc9,0x2,0xf,0xe0,0x0,0xca,0x0,0xc6,0x4a,0xd3,0xd3,0x0,0xc1,0xb2,0xd0,0xc1,0xb2,0xec,0xc1,0xb2,0xe0,0xc1,0xb3,0x18,0x28,0x91,0x42,0x91,0x43,0x91,0x44,0x91,0x43,0x91,0x42,0x91,0x45,0x91,0x45,0x91,0x45,0xc1,0x3,0xa0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x91,0x46,0xd,0x91,0x47,0xe5,0x2f,0xc3,0x8f,0x76,0xc4,0xc4,0x91,0x48,0xe1,0x2,0xc9,0x2,0x10,0xc8,0x1,0x0,0xe0,0x2,0xc7,0x1e,0xc6,0x83,0x3d,0xc8,0x1,0x1,0xca,0x0,0xd3,0xd3,0xdd,0x0,0x0,0x26,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xc0,0xd3,0xdb,0x0,0x0,0x27,0xc2,0x0,0xc1,0xaf,0xe8,0xc1,0xb0,0x1c,0xc1,0xb0,0x48,0xc1,0xb0,0x6e,0xc1,0xb0,0x94,0xc1,0xb0,0xb8,0xc1,0xb0,0xf2,0xc1,0xb1,0x2a,0xc1,0xb1,0x60,0xc1,0xb1,0xaa,0xc1,0xb2,0x18,0xc1,0xb1,0xbc,0xc1,0xb1,0xde,0xc1,0xb1,0xd4,0xc1,0xb2,0x2e,0xc1,0xb2,0x4c,0xc1,0xb2,0x56,0xc1,0xb2,0xa2,0xc1,0xb2,0x8c,0xc1,0xb2,0x80,0xe1,0x2e,0x91,0x4a,0x91,0x4a,0x91,0x4b,0x91,0x4b,0x91,0x4b,0x91,0x4c,0x91,0x4c,0x91,0x4c,0x91,0x4d,0x91,0x4d,0x91,0x4d,0x91,0x4e,0x91,0x4e,0x91,0x4e,0x91,0x4f,0x91,0x4f,0x91,0x4f,0x91,0x50,0x91,0x50,0x91,0x51,0x91,0x51,0x91,0x52,0x91,0x52,0x91,0x53,0x91,0x53,0x91,0x54,0x91,0x54,0x91,0x55,0x91,0x56,0x91,0x57,0x91,0x57,0x91,0x56,0x91,0x55,0x91,0x58,0x91,0x59,0x91,0x5a,0x91,0x5a,0x91,0x59,0x91,0x58,0x91,0x54,0x91,0x53,0x91,0x5b,0x91,0x5c,0x91,0x5d,0x91,0x5c,0x91,0x5b,0xc1,0x3,0x98,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x91,0x5e,0xd,0x91,0x5f,0xe5,0x81,0x65,0xc3,0xc4,0x8b,0x73,0x88,0x3d,0x91,0x60,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8b,0x3d,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x8b,0x44,0xd3,0xdc,0x0,0x0,0x23,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x82,0x61,0xd3,0xdc,0x0,0x0,0x31,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x89,0x30,0xd3,0xdc,0x0,0x0,0x3f,0xe1,0x2,0xc7,0x0,0xcb,0x0,0xc6,0x8b,0x63,0xd3,0xdd,0x0,0x0,0x4f,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xc0,0xd3,0xdb,0x0,0x0,0x50,0xc2,0xe1,0x2,0xc9,0x1,0xc,0xc8,0x0,0x0,0xc8,0x0,0x1,0xd3,0xdc,0x0,0x0,0x6c,0xe1,0x2,0xc9,0x1,0xd,0xc8,0x0,0x0,0xc8,0x0,0x1,0xd3,0xdc,0x0,0x0,0x7c,0xe1,0x2,0xc9,0x1,0xe,0xc8,0x0,0x0,0xc8,0x0,0x1,0xd3,0xdd,0x0,0x0,0xc5,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x1f,0xe1,0x2,0xc9,0x1,0x10,0xc8,0x0,0x0,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x85,0x6,0xd3,0xc6,0x89,0x24,0xd0,0x91,0x41,0xd3,0xd3,0xe1,0x2,0xc9,0x1,0x10,0xc8,0x0,0x0,0xe1,0x1,0xc9,0x1,0xf,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x82,0x61,0xd3,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0xc6,0xc2,0xf0,0x1,0x82,0x62,0xe0,0x1,0xc7,0x1e,0xc6,0x8f,0x73,0xc8,0x0,0x1,0xd3,0xc6,0x82,0x63,0xd0,0x91,0x49,0xd3,0x0,0xc1,0x3,0xa2,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x91,0x62,0xa8,0xc3,0xc4,0xc4,0xc4,0x91,0x63,0xc2,0x0,0x8,0x63,0x61,0x70,0x74,0x75,0x72,0x65,0x73,0xc1,0xaf,0x4,0xc1,0xae,0xf8,0xc1,0xaf,0xa6,0xc1,0xaf,0x96,0x2c,0x91,0x66,0x91,0x67,0x91,0x66,0xc0,0xc0,0x91,0x68,0x91,0x69,0x91,0x68,0xc0,0xc0,0xc0,0xc0,0xc1,0x3,0x92,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x91,0x6a,0xd,0x91,0x6b,0xe5,0x2c,0x91,0x65,0x90,0x6d,0xc4,0xc4,0x91,0x6c,0xe1,0x1,0xc7,0x1d,0xca,0x1,0xd3,0xe3,0x0,0xd0,0x91,0x3b,0xd3,0xe1,0x1,0xc7,0x22,0xca,0x1,0xd3,0xe3,0x0,0xd0,0x91,0x61,0xd3,0xc0,0xe3,0x0,0xd0,0x91,0x64,0xd3,0xd4,0xc1,0x0,0x8,0x6c,0x6f,0x6f,0x70,0x4a,0x75,0x6d,0x70,0xc1,0xb4,0x8a,0xc1,0xb4,0xbc,0xc1,0xb4,0xa8,0xc1,0xb4,0x9c,0xc1,0xb4,0xe6,0xc1,0xb4,0xda,0xc1,0xb4,0xcc,0xc1,0xb5,0x8,0xc1,0xb5,0x4e,0xc1,0xb5,0x42,0xc1,0xb5,0x34,0xc1,0xb5,0x8e,0xc1,0xb5,0x82,0xc1,0xb5,0x74,0xc1,0xb5,0xb8,0xc1,0xb5,0xf4,0xc1,0xb5,0xe8,0xc1,0xb5,0xde,0xc1,0xb6,0x6,0xc1,0xb6,0x16,0xc1,0xb6,0x36,0xe1,0x34,0x91,0x6f,0x91,0x6f,0x91,0x70,0x91,0x70,0x91,0x71,0x91,0x71,0x91,0x72,0x91,0x72,0x91,0x71,0x91,0x73,0x91,0x73,0x91,0x74,0x91,0x75,0x91,0x75,0x91,0x74,0x91,0x73,0x91,0x70,0x91,0x6f,0x91,0x76,0x91,0x76,0x91,0x76,0x91,0x77,0x91,0x77,0x91,0x78,0x91,0x79,0x91,0x79,0x91,0x78,0x91,0x77,0x91,0x7a,0x91,0x7a,0x91,0x7b,0x91,0x7c,0x91,0x7c,0x91,0x7b,0x91,0x7a,0x91,0x7d,0x91,0x7d,0x91,0x7d,0x91,0x7e,0x91,0x7e,0x91,0x7f,0x92,0x0,0x92,0x0,0x91,0x7f,0x91,0x7e,0x92,0x1,0x92,0x1,0x92,0x2,0x92,0x2,0x92,0x1,0x92,0x3,0x92,0x3,0xc1,0x3,0xaa,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x92,0x4,0xd,0x92,0x5,0xe5,0x81,0x3d,0x91,0x6e,0x90,0x6d,0xc4,0xc4,0x92,0x6,0xe1,0x1,0xc7,0x18,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x90,0x18,0xd3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xe0,0x0,0xca,0x1,0xc6,0x90,0x19,0xd3,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x2e,0xd3,0xd3,0xd3,0xdd,0x0,0x0,0x40,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xc1,0xd3,0xdb,0x0,0x0,0x41,0xc2,0xe1,0x2,0xc7,0x20,0xe0,0x0,0xe0,0x0,0xca,0x1,0xc6,0x90,0x19,0xd3,0xc6,0x89,0xd,0xd3,0xc6,0x83,0x57,0xd3,0xdd,0x0,0x0,0x71,0xe1,0x2,0xc7,0x20,0xe0,0x0,0xe0,0x0,0xca,0x1,0xc6,0x90,0x19,0xd3,0xc6,0x89,0xd,0xd3,0xc6,0x8d,0x1d,0xd3,0xdd,0x0,0x0,0x81,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xc1,0xd3,0xdb,0x0,0x0,0x82,0xc2,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x1,0xc6,0x85,0x6,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0xa8,0xe1,0x1,0xc7,0x18,0xe8,0x0,0xca,0x1,0xc6,0x82,0x61,0xd3,0xd3,0xdd,0x0,0x0,0xb4,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x35,0xd3,0x0,0xc1,0xb7,0xbc,0x22,0x92,0x8,0x92,0x8,0xc1,0x3,0xba,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x92,0x9,0xd,0x92,0xa,0xb3,0xc3,0x8f,0x3,0xc4,0xc4,0x92,0xb,0xe1,0x2,0xc9,0x1,0x13,0xc9,0x0,0x0,0xca,0x0,0xd3,0x0,0x9,0x6c,0x65,0x78,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x23,0x89,0x31,0x8f,0x4e,0x8e,0x31,0x22,0x8c,0x46,0x8f,0x0,0xc1,0xb6,0xc2,0xc1,0xb6,0xb6,0xc1,0xb6,0xe6,0xc1,0xb6,0xe8,0xc1,0xb6,0xf6,0xc1,0xb7,0x4c,0xc1,0xb7,0x98,0xc1,0xb7,0x8e,0xc1,0xb7,0xf6,0x35,0x92,0x10,0x92,0x10,0x92,0x11,0x92,0x11,0x92,0x10,0x92,0x12,0x92,0x12,0x92,0x13,0x92,0x13,0x92,0x14,0x92,0x14,0x92,0x13,0x92,0x12,0x92,0x15,0x92,0x15,0x92,0x16,0x92,0x17,0x92,0x17,0x92,0x16,0x92,0x18,0x92,0x18,0xc1,0x3,0xb4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x92,0x19,0xd,0x92,0x1a,0xe5,0x65,0x92,0xd,0x92,0xe,0x92,0xf,0x82,0x7a,0x92,0x1b,0xe1,0x2,0xc7,0x20,0xe8,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x82,0x61,0xd3,0xdd,0x0,0x0,0x2e,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x1,0xc7,0x3,0xe1,0x2,0xc9,0x0,0x13,0xca,0x0,0xca,0x1,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0x2f,0xc2,0xe1,0x2,0xc9,0x0,0x6,0xca,0x0,0xca,0x2,0xd3,0xd1,0x0,0xf0,0x1,0x82,0x62,0xe0,0x0,0xca,0x1,0xc6,0x8f,0x0,0xd3,0xc6,0x89,0x24,0xd0,0x92,0xc,0xd3,0xd1,0x1,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x36,0xd3,0xcb,0x1,0x0,0xc1,0xb9,0x16,0xc1,0xb9,0x24,0x25,0x92,0x1d,0x92,0x1d,0x92,0x1e,0x92,0x1e,0x92,0x1d,0xc1,0x3,0xc6,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x92,0x1f,0xd,0x92,0x20,0xb5,0xc3,0x8e,0x56,0xc4,0xc4,0x92,0x21,0xe1,0x1,0xc7,0x18,0xe8,0x0,0xca,0x0,0xc6,0x81,0x49,0xd3,0xd3,0x0,0xc1,0xb9,0x48,0x22,0x92,0x23,0x92,0x23,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x92,0x24,0xd,0x92,0x20,0xaf,0xc3,0x8e,0x56,0xc4,0xc4,0x92,0x25,0xe0,0x0,0xca,0x0,0xc6,0x4a,0xd3,0x0,0xc1,0xba,0xfa,0x22,0x92,0x27,0x92,0x27,0xc1,0x3,0xce,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x92,0x28,0xd,0x92,0x29,0xb0,0xc3,0x8e,0x56,0xc4,0xc4,0x92,0x2a,0xe8,0x0,0xca,0x0,0xc6,0x81,0x49,0xd3,0x0,0xc1,0xba,0xb4,0xc1,0xbb,0x6,0xc1,0xbb,0x0,0xc1,0xba,0xd6,0xc1,0xba,0xcc,0x2a,0x92,0x2c,0x92,0x2d,0x92,0x2e,0x92,0x2f,0x92,0x30,0x92,0x30,0x92,0x2f,0x92,0x2e,0x92,0x2d,0x92,0x2c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x92,0x31,0xd,0x92,0x29,0xe5,0x31,0xc3,0xc4,0xc4,0xc4,0x92,0x32,0xe1,0x2,0xc9,0x3,0x12,0xc8,0x2,0x0,0xe0,0x0,0xe0,0x1,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x2,0x1,0xc6,0x85,0x6,0xd3,0xc6,0x90,0x3d,0xd0,0x92,0x2b,0xd3,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xc6,0x4a,0xd3,0xd3,0x0,0xc1,0x3,0xd0,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x92,0x34,0xa8,0xc3,0xc4,0xc4,0xc4,0x92,0x35,0xc2,0x0,0x4,0x63,0x6f,0x6e,0x64,0x65,0x81,0x32,0xc0,0x8f,0x65,0xc0,0x92,0x37,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x22,0x8f,0x65,0x81,0x32,0xc1,0xba,0x22,0xc1,0xba,0x3a,0xc1,0xba,0x94,0xc1,0xba,0x88,0xc1,0xba,0x7e,0xc1,0xbb,0xcc,0x34,0x92,0x3a,0x92,0x3b,0x92,0x3b,0x92,0x3a,0x92,0x3c,0x92,0x3c,0x92,0x3d,0x92,0x3e,0x92,0x3e,0x92,0x3d,0x92,0x3c,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x92,0x3f,0x92,0x3f,0xc0,0xc1,0x3,0xcc,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x92,0x40,0xd,0x92,0x41,0xe5,0x6b,0xc3,0xc4,0x92,0x39,0x82,0x7a,0x92,0x42,0xe1,0x2,0xc9,0x2,0x12,0xc8,0x1,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x82,0x61,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x1c,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x85,0x6,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x1,0xd3,0xe3,0x0,0xd0,0x92,0x33,0xd3,0xc0,0xe3,0x0,0xd0,0x92,0x36,0xd3,0xd4,0xd1,0x1,0xe1,0xb,0xc7,0x4,0xc6,0x92,0x38,0xc6,0x8b,0x3d,0xc6,0x90,0x3c,0xc6,0x92,0x37,0xc9,0x0,0x1,0xc6,0x8f,0x65,0xcb,0x0,0xc6,0x81,0x32,0xcb,0x1,0xc6,0x9,0xe8,0x0,0xc8,0x1,0x1,0xc6,0x9,0xd3,0xd3,0x0,0xc1,0xbc,0xba,0xc1,0xbc,0xc8,0xc1,0xbc,0xec,0x27,0x92,0x44,0x92,0x44,0x92,0x45,0x92,0x46,0x92,0x46,0x92,0x45,0x92,0x44,0xc1,0x3,0xd8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x92,0x47,0xd,0x92,0x48,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x92,0x49,0xe1,0x1,0xc7,0x3,0xe1,0x2,0xc9,0x3,0x13,0xc8,0x2,0x0,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x83,0x3d,0xc4,0x3,0xd3,0xd3,0xd3,0x0,0xc1,0x3,0xda,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x92,0x4b,0xa8,0xc3,0xc4,0xc4,0xc4,0x92,0x4c,0xc2,0x0,0xc1,0xbc,0x22,0xc1,0xbc,0x30,0xc1,0xbc,0x54,0xc1,0xbc,0xac,0xc1,0xbc,0xa0,0xc1,0xbd,0xb8,0x35,0x92,0x4e,0x92,0x4e,0x92,0x4f,0x92,0x50,0x92,0x50,0x92,0x4f,0x92,0x4e,0x92,0x51,0x92,0x51,0x92,0x52,0x92,0x52,0x92,0x51,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x92,0x53,0x92,0x53,0xc0,0xc1,0x3,0xd6,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x92,0x54,0xd,0x92,0x55,0xe5,0x6c,0xc3,0xc4,0x92,0x39,0x82,0x7a,0x92,0x56,0xe1,0x1,0xc7,0x3,0xe1,0x2,0xc9,0x2,0x13,0xc8,0x1,0x0,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x83,0x3d,0xc4,0x2,0xd3,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x1c,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x81,0x44,0xd3,0xc4,0x2,0xd3,0xe3,0x0,0xd0,0x92,0x4a,0xd3,0xc0,0xe3,0x0,0xd0,0x92,0x4d,0xd3,0xd4,0xd1,0x1,0xe1,0xb,0xc7,0x4,0xc6,0x92,0x38,0xc6,0x8b,0x3d,0xc6,0x90,0x3c,0xc6,0x92,0x37,0xc9,0x0,0x1,0xc6,0x8f,0x65,0xcb,0x0,0xc6,0x81,0x32,0xcb,0x1,0xc6,0x9,0xe8,0x0,0xc8,0x1,0x1,0xc6,0x9,0xd3,0xd3,0x0,0x22,0x90,0x6e,0x92,0x37,0xc1,0xb9,0x2a,0xc1,0xb8,0xf8,0xc1,0xb8,0xee,0xc1,0xb9,0x82,0xc1,0xb9,0xa6,0xc1,0xb9,0xd4,0x30,0x92,0x59,0x92,0x5a,0x92,0x5b,0x92,0x5b,0x92,0x5a,0x92,0x59,0x92,0x5c,0x92,0x5d,0x92,0x5d,0x92,0x5c,0x92,0x5e,0x92,0x5e,0xc0,0xc0,0xc0,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x92,0x5f,0xd,0x92,0x20,0xe5,0x56,0xc3,0xc4,0x92,0x58,0x82,0x7a,0x92,0x60,0xf0,0x1,0x82,0x62,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x85,0x6,0xd3,0xc6,0x90,0x3d,0xd0,0x92,0x22,0xd3,0xc6,0x89,0x24,0xd0,0x92,0x26,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x1,0x13,0xc8,0x0,0x0,0xe0,0x1,0xcb,0x0,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xd3,0xd1,0x1,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x82,0x61,0xd3,0xe3,0x0,0xd0,0x92,0x43,0xd3,0xc0,0xe3,0x0,0xd0,0x92,0x57,0xd3,0xd4,0x0,0x3,0x74,0x6f,0x70,0x62,0x92,0x62,0xc0,0x83,0x56,0xc0,0x65,0x8f,0x0,0xc0,0x92,0x37,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x83,0x52,0xc0,0x23,0x92,0x37,0x83,0x52,0x8f,0x0,0xc1,0xbe,0x42,0xc1,0xbe,0x6a,0xc1,0xbe,0x64,0xc1,0xbe,0x5a,0xc1,0xbe,0xb2,0xc1,0xbe,0xd0,0xc1,0xbf,0x10,0xc1,0xbf,0x28,0xc1,0xbf,0xaa,0x38,0x92,0x66,0x92,0x67,0x92,0x68,0x92,0x69,0x92,0x69,0x92,0x68,0x92,0x67,0x92,0x66,0xc0,0xc0,0x92,0x6a,0x92,0x6a,0x92,0x6b,0x92,0x6b,0xc0,0x92,0x6c,0x92,0x6d,0x92,0x6d,0x92,0x6c,0xc0,0xc0,0x92,0x6e,0x92,0x6e,0xc0,0xc1,0x3,0xe0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x92,0x6f,0xd,0x92,0x70,0xe5,0x81,0x3,0xc3,0xc4,0x92,0x65,0x81,0x4b,0x92,0x71,0xe1,0x2,0xc9,0x1,0x13,0xc8,0x0,0x0,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x85,0x6,0xd3,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xc6,0x4a,0xd3,0xd3,0xd1,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x92,0x63,0xc6,0x92,0x62,0xe1,0x0,0xc9,0x1,0x18,0xd3,0xc6,0x83,0x56,0xe1,0x0,0xc9,0x1,0x18,0xd3,0xd3,0xd1,0x1,0xe1,0x3,0xc9,0x1,0x12,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x82,0x61,0xd3,0xcb,0x1,0xd3,0xd1,0x2,0xe1,0xb,0xc7,0x4,0xc6,0x92,0x64,0xc6,0x8b,0x3d,0xc6,0x90,0x7d,0xc6,0x92,0x37,0xcb,0x0,0xc6,0x8f,0x0,0xcb,0x2,0xc6,0x83,0x52,0xcb,0x1,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0x64,0x8f,0x0,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x83,0x52,0xc0,0x22,0x83,0x52,0x8f,0x0,0xc1,0xc0,0x40,0xc1,0xc0,0x5e,0xc1,0xc0,0x9e,0xc1,0xc0,0xb6,0xc1,0xc1,0x2c,0x30,0xc0,0xc0,0x92,0x75,0x92,0x75,0x92,0x76,0x92,0x76,0xc0,0x92,0x77,0x92,0x78,0x92,0x78,0x92,0x77,0xc0,0xc0,0x92,0x79,0x92,0x79,0xc0,0xc1,0x3,0xea,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x92,0x7a,0xd,0x92,0x7b,0xe5,0x5d,0xc3,0xc4,0x92,0x74,0x82,0x7a,0x92,0x7c,0xe1,0x5,0xc7,0x4,0xc6,0x92,0x63,0xc6,0x92,0x62,0xe1,0x0,0xc9,0x1,0x18,0xd3,0xc6,0x83,0x56,0xe1,0x0,0xc9,0x1,0x18,0xd3,0xd3,0xd1,0x0,0xe1,0x3,0xc9,0x1,0x12,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x82,0x61,0xd3,0xcb,0x0,0xd3,0xd1,0x1,0xe1,0x9,0xc7,0x4,0xc6,0x92,0x73,0xc6,0x8b,0x3d,0xc6,0x83,0x52,0xc6,0x8f,0x0,0xcb,0x1,0xc6,0x83,0x52,0xcb,0x0,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0x62,0x86,0x5e,0xc0,0x8b,0x3d,0xc0,0xc1,0xc2,0x4c,0x25,0xc0,0xc0,0x92,0x7f,0x92,0x7f,0xc0,0xc1,0x3,0xf4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x93,0x0,0xd,0x93,0x1,0xe5,0x21,0xc3,0xc4,0xc4,0xc4,0x93,0x2,0xe1,0x5,0xc7,0x4,0xc6,0x92,0x7e,0xc6,0x8b,0x3d,0xc6,0x83,0x42,0xc6,0x86,0x5e,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x83,0x56,0xd3,0xd3,0x0,0xc1,0xc2,0xe0,0x25,0xc0,0xc0,0x93,0x4,0x93,0x4,0xc0,0xc1,0x3,0xf6,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x93,0x5,0xd,0x93,0x6,0xe5,0x21,0xc3,0xc4,0xc4,0xc4,0x93,0x7,0xe1,0x5,0xc7,0x4,0xc6,0x92,0x7e,0xc6,0x8b,0x3d,0xc6,0x83,0x42,0xc6,0x86,0x5e,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x92,0x62,0xd3,0xd3,0x0,0xc1,0xc1,0xae,0xc1,0xc2,0x2,0xc1,0xc1,0xf6,0xc1,0xc1,0xe8,0x2d,0x93,0x9,0x93,0x9,0x93,0xa,0x93,0xa,0x93,0xb,0x93,0xc,0x93,0xc,0x93,0xb,0x93,0xa,0xc0,0xc0,0xc0,0xc0,0xc1,0x3,0xf2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x93,0xd,0xd,0x93,0xe,0xe5,0x39,0xc3,0xc4,0x8e,0x31,0x88,0x3d,0x93,0xf,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x35,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x19,0xd3,0xc6,0x89,0xd,0xd3,0xc6,0x83,0x57,0xd3,0xe3,0x0,0xd0,0x93,0x3,0xd3,0xc0,0xe3,0x0,0xd0,0x93,0x8,0xd3,0xd4,0x0,0x3,0x6c,0x68,0x73,0x3,0x72,0x68,0x73,0x64,0x9,0xc0,0x8b,0x3d,0xc0,0x93,0x12,0xc0,0x93,0x11,0xc0,0x22,0x93,0x11,0x93,0x12,0xc1,0xc3,0xae,0xc1,0xc3,0xc6,0xc1,0xc4,0x2,0xc1,0xc4,0x1a,0xc1,0xc4,0x52,0xc1,0xc4,0x7e,0x2f,0x93,0x15,0x93,0x16,0x93,0x16,0x93,0x15,0x93,0x17,0x93,0x18,0x93,0x18,0x93,0x17,0xc0,0xc0,0x93,0x19,0x93,0x19,0x93,0x1a,0x93,0x1a,0xc0,0xc1,0x3,0xfa,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x93,0x1b,0xd,0x93,0x1c,0xe5,0x59,0xc3,0xc4,0x93,0x14,0x82,0x7a,0x93,0x1d,0xe1,0x2,0xc9,0x1,0x13,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x11,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x1,0x13,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x12,0xd3,0xd3,0xd1,0x1,0xe1,0x9,0xc7,0x4,0xc6,0x93,0x13,0xc6,0x8b,0x3d,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x83,0x43,0xd3,0xc6,0x93,0x11,0xcb,0x0,0xc6,0x93,0x12,0xcb,0x1,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0xc1,0xc4,0xaa,0x22,0x93,0x1f,0x93,0x1f,0xc1,0x4,0x0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x93,0x20,0xd,0x93,0x21,0xb9,0xc3,0xc4,0xc4,0xc4,0x93,0x22,0xe1,0x4,0xc9,0x1,0x14,0xc8,0x0,0x0,0xc8,0x0,0x1,0xc8,0x0,0x2,0xc8,0x0,0x3,0xd3,0x0,0x6,0x6c,0x65,0x78,0x73,0x74,0x6d,0x24,0x89,0x31,0x8f,0x4e,0x8b,0x46,0x8b,0x47,0xc1,0xb8,0x92,0xc1,0xbd,0xee,0xc1,0xbf,0xde,0xc1,0xc1,0x5c,0xc1,0xc3,0x24,0xc1,0xc3,0x14,0xc1,0xc3,0x8,0xc1,0xc3,0x50,0xc1,0xc3,0x3e,0xc1,0xc3,0x36,0xc1,0xc3,0x66,0xc1,0xc3,0x5e,0xe1,0x29,0x93,0x26,0x93,0x26,0xc0,0xc0,0x93,0x27,0x93,0x27,0xc0,0xc0,0x93,0x28,0x93,0x28,0xc0,0xc0,0x93,0x29,0x93,0x29,0xc0,0xc0,0x93,0x2a,0x93,0x2a,0x93,0x2b,0x93,0x2b,0x93,0x2c,0x93,0x2c,0x93,0x2b,0x93,0x2d,0x93,0x2d,0x93,0x2e,0x93,0x2e,0x93,0x2f,0x93,0x2f,0x93,0x2e,0x93,0x30,0x93,0x30,0x93,0x31,0x93,0x31,0x93,0x30,0x93,0x2d,0x93,0x2a,0xc0,0xc0,0xc0,0xc0,0xc1,0x3,0xc2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x93,0x32,0xd,0x93,0x33,0xe5,0x81,0x10,0x93,0x24,0x93,0x25,0xc4,0xc4,0x93,0x34,0xe1,0x2,0xc9,0x0,0xc,0xca,0x0,0xca,0x1,0xd3,0xe3,0x0,0xd0,0x92,0x61,0xd3,0xe1,0x2,0xc9,0x0,0xd,0xca,0x0,0xca,0x1,0xd3,0xe3,0x0,0xd0,0x92,0x72,0xd3,0xe1,0x2,0xc9,0x0,0xe,0xca,0x0,0xca,0x1,0xd3,0xe3,0x0,0xd0,0x92,0x7d,0xd3,0xe1,0x2,0xc9,0x0,0x11,0xca,0x0,0xca,0x1,0xd3,0xe3,0x0,0xd0,0x93,0x10,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x83,0x43,0xd3,0xe1,0x2,0xc7,0x1f,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x83,0x43,0xd3,0xc6,0x39,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x83,0x43,0xd3,0xc6,0x89,0x1f,0xd3,0xd3,0xd3,0xe3,0x0,0xd0,0x93,0x1e,0xd3,0xc0,0xe3,0x0,0xd0,0x93,0x23,0xd3,0xd4,0x0,0xc1,0x4,0x6,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x93,0x36,0xaa,0xc3,0xc4,0xc4,0xc4,0x93,0x37,0xc6,0x84,0x2d,0x0,0x6,0x69,0x73,0x43,0x68,0x61,0x72,0x64,0x90,0x19,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x85,0x6,0xc0,0x4,0x43,0x68,0x61,0x72,0x8,0x74,0x6f,0x4e,0x75,0x6d,0x62,0x65,0x72,0xc1,0xc6,0x40,0xc1,0xc6,0x56,0xc1,0xc6,0x60,0xc1,0xc6,0x88,0x2f,0xc0,0xc0,0xc0,0xc0,0x93,0x3d,0x93,0x3d,0xc0,0x93,0x3e,0x93,0x3e,0x93,0x3f,0x93,0x3f,0x93,0x3e,0x93,0x40,0x93,0x40,0xc0,0xc1,0x4,0x8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x93,0x41,0xd,0x93,0x42,0xe5,0x51,0xc3,0xc4,0xc4,0xc4,0x93,0x43,0xe1,0x9,0xc7,0x4,0xc6,0x93,0x3a,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x83,0x79,0xc6,0x89,0xd,0xc6,0x93,0x3b,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xc6,0x85,0x6,0xe1,0x1,0xc7,0x3,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x3c,0xd3,0xd3,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0xc1,0x4,0xa,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x93,0x45,0xaa,0xc3,0xc4,0xc4,0xc4,0x93,0x46,0xc8,0x0,0x1,0x0,0xc1,0x4,0xc,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x93,0x48,0xaa,0xc3,0xc4,0xc4,0xc4,0x93,0x49,0xc8,0x0,0x1,0x0,0xa,0x73,0x74,0x72,0x69,0x6e,0x67,0x6c,0x69,0x73,0x74,0x62,0x83,0x5f,0xc0,0x8b,0x3d,0xc0,0xc1,0x4,0x12,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x93,0x4d,0xba,0xc3,0xc4,0xc4,0xc4,0x93,0x4e,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x5d,0xc6,0x83,0x5f,0xc8,0x0,0x0,0xd3,0x0,0xc1,0xc8,0x96,0x22,0x93,0x50,0x93,0x50,0xc1,0x4,0x14,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x93,0x51,0xd,0x93,0x52,0xb3,0xc3,0xc4,0xc4,0xc4,0x93,0x53,0xe1,0x2,0xc9,0x3,0x14,0xc8,0x2,0x0,0xc8,0x0,0x0,0xd3,0x0,0xc1,0xc8,0x12,0xc1,0xc8,0x2,0x27,0x93,0x55,0x93,0x56,0x93,0x55,0xc0,0xc0,0xc0,0xc0,0xc1,0x4,0x10,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x93,0x57,0xd,0x93,0x58,0xbd,0xc3,0x82,0x4b,0xc4,0xc4,0x93,0x59,0xe1,0x1,0xc7,0x11,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x93,0x4f,0xd3,0xc0,0xe3,0x0,0xd0,0x93,0x54,0xd3,0xd4,0x0,0x21,0x83,0x5f,0xc1,0xc7,0xca,0xc1,0xc7,0xc0,0xc1,0xc9,0x5e,0xc1,0xc9,0x90,0x2e,0x93,0x5c,0x93,0x5d,0x93,0x5d,0x93,0x5c,0xc0,0xc0,0xc0,0xc0,0x93,0x5e,0x93,0x5e,0xc0,0x93,0x5f,0x93,0x5f,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x93,0x60,0xd,0x93,0x58,0xe5,0x5d,0xc3,0xc4,0x93,0x5b,0x88,0x3d,0x93,0x61,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x83,0x5f,0xd3,0xc6,0x89,0x24,0xd0,0x93,0x5a,0xd3,0xd1,0x0,0xe1,0x9,0xc7,0x4,0xc6,0x93,0x3a,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x83,0x79,0xc6,0x89,0xd,0xc6,0x88,0x2e,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xc6,0x85,0x6,0xcb,0x0,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0x62,0x90,0x19,0xc0,0x8b,0x3d,0xc0,0x62,0x8b,0x44,0xc0,0x8b,0x3d,0xc0,0x23,0x8b,0x44,0x8b,0x49,0x8b,0x42,0xc1,0xca,0x1a,0xc1,0xca,0x70,0x2d,0x93,0x66,0x93,0x66,0x93,0x67,0xc0,0xc0,0xc0,0x93,0x67,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc1,0x4,0x1c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x93,0x68,0xd,0x93,0x69,0xe5,0x5f,0xc3,0xc4,0x93,0x65,0x81,0x4b,0x93,0x6a,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xc8,0x0,0x1,0xd3,0xd1,0x0,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x3e,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0x41,0xc6,0x89,0xd,0xc6,0x1a,0xc6,0x8b,0x38,0xc1,0xc6,0x8b,0x44,0xcb,0x0,0xd3,0xd3,0xd2,0x0,0x1,0xd2,0x1,0x2,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x63,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x64,0xc6,0x8b,0x3d,0xc6,0x8b,0x44,0xc6,0x8b,0x44,0xcb,0x2,0xd3,0xd3,0x0,0xc1,0xcb,0xfa,0xc1,0xcc,0x4c,0xc1,0xcc,0x6e,0x2a,0x93,0x6c,0x93,0x6c,0x93,0x6d,0x93,0x6d,0x93,0x6d,0x93,0x6e,0x93,0x6e,0xc0,0xc0,0xc0,0xc1,0x4,0x24,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x93,0x6f,0xd,0x93,0x70,0xe5,0x49,0xc3,0xc4,0x8b,0x45,0x88,0x3d,0x93,0x71,0xe0,0x3,0xc8,0x0,0x0,0xc6,0x8b,0x2d,0xc8,0x0,0x1,0xc8,0x0,0x2,0xc8,0x0,0x3,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x18,0xc8,0x0,0x2,0xd3,0xdd,0x0,0x0,0x2c,0xe1,0x1,0xc9,0x1,0x3,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x2d,0xc2,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x64,0xc6,0x8b,0x3d,0xc6,0x8b,0x44,0xc6,0x8b,0x44,0xcb,0x0,0xd3,0x0,0x62,0x9,0xc0,0x89,0xd,0xc0,0xc1,0xce,0x4a,0xc1,0xce,0x60,0xc1,0xce,0x74,0xc1,0xce,0x90,0x28,0x93,0x74,0x93,0x75,0x93,0x75,0x93,0x76,0x93,0x76,0x93,0x74,0x93,0x77,0x93,0x77,0xc1,0x4,0x30,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x93,0x78,0xd,0x93,0x79,0xe5,0x28,0xc3,0x8e,0x77,0xc4,0xc4,0x93,0x7a,0xe0,0x2,0xc9,0x0,0x1,0xc6,0x8b,0x2f,0xe0,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x9,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x7,0xca,0x0,0xd3,0x0,0x5,0x66,0x69,0x65,0x6c,0x64,0x8,0x76,0x61,0x72,0x66,0x69,0x65,0x6c,0x64,0x9,0x5f,0x73,0x65,0x74,0x66,0x69,0x65,0x6c,0x64,0x5,0x76,0x61,0x6c,0x75,0x65,0x22,0x93,0x7c,0x93,0x7f,0xc1,0xd1,0xf2,0xc1,0xd1,0xe6,0xc1,0xd2,0x6c,0xc1,0xd2,0xb6,0xc1,0xd2,0xee,0xc1,0xd3,0xa,0xc1,0xd3,0xa8,0xc1,0xd3,0xf4,0xc1,0xd4,0x4a,0xc1,0xd4,0x82,0xc1,0xd4,0xee,0xe1,0x28,0x94,0x1,0x94,0x1,0x94,0x2,0x94,0x2,0x94,0x1,0x94,0x3,0x94,0x3,0x94,0x4,0xc0,0xc0,0x94,0x5,0x94,0x5,0x94,0x6,0x94,0x6,0xc0,0x94,0x4,0x94,0x7,0x94,0x7,0x94,0x8,0x94,0x8,0xc0,0xc0,0xc0,0xc0,0x94,0x9,0x94,0x9,0xc0,0x94,0xa,0x94,0xa,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x94,0xa,0x94,0xb,0x94,0xb,0xc0,0x94,0x8,0xc1,0x4,0x4c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x94,0xc,0xd,0x94,0xd,0xe5,0x81,0x56,0xc3,0xc4,0x94,0x0,0x82,0x7a,0x94,0xe,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x93,0x7d,0xd3,0xdd,0x0,0x0,0x1d,0xc0,0xd9,0x1,0x3,0xdb,0x0,0x0,0x1e,0xc2,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0xd,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x3,0x14,0xc9,0x1,0x1,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x8b,0x2e,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x89,0xd,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0xd,0xd3,0xd3,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x1,0x4,0xc6,0x3e,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x9,0xc7,0x4,0xc6,0x93,0x3a,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x83,0x79,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x89,0xd,0xc6,0x93,0x7e,0xd3,0xc6,0x85,0x6,0xe1,0x3,0xc7,0x3,0xe1,0x3,0xc7,0x4,0xc6,0x8d,0x37,0xc6,0x8b,0x3d,0xc6,0x85,0x1a,0xd3,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x83,0x5f,0xc6,0x83,0x5f,0xcb,0x0,0xd3,0xcb,0x1,0xd3,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd3,0x0,0xc1,0xd5,0x4c,0x26,0x94,0x10,0x94,0x10,0x94,0x10,0x94,0x10,0x94,0x10,0x94,0x10,0xc1,0x4,0x58,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x94,0x11,0xd,0x94,0x12,0xb5,0xc3,0xc4,0xc4,0xc4,0x94,0x13,0xe1,0x1,0xc7,0x24,0xe1,0x2,0xc7,0x3,0xc4,0x0,0xc4,0x2,0xd3,0xd3,0x0,0xc1,0xd1,0x78,0xc1,0xd1,0x62,0xc1,0xd1,0x56,0xc1,0xd1,0x90,0xc1,0xd1,0x84,0x31,0x94,0x15,0x94,0x15,0x94,0x16,0x94,0x16,0x94,0x17,0x94,0x17,0x94,0x16,0x94,0x18,0x94,0x18,0x94,0x19,0x94,0x19,0x94,0x18,0x94,0x15,0xc0,0xc0,0xc0,0xc0,0xc1,0x4,0x48,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x94,0x1a,0xd,0x94,0x1b,0xe5,0x3b,0xc3,0x8e,0x77,0xc4,0xc4,0x94,0x1c,0xe1,0x2,0xc7,0x1f,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x93,0x7c,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x93,0x7d,0xd3,0xd3,0xe3,0x0,0xd0,0x94,0xf,0xd3,0xc0,0xe3,0x0,0xd0,0x94,0x14,0xd3,0xd4,0x0,0x6,0x61,0x73,0x73,0x69,0x67,0x6e,0x2,0x74,0x6f,0x22,0x8b,0x49,0x8b,0x42,0xc1,0xd8,0x12,0xc1,0xd8,0x34,0xc1,0xd8,0x2e,0xc1,0xd8,0x52,0xc1,0xd8,0xbe,0xc1,0xd8,0xcc,0xc1,0xd8,0xc6,0xc1,0xd9,0xc,0x37,0x94,0x21,0xc0,0xc0,0x94,0x22,0x94,0x23,0x94,0x23,0x94,0x22,0x94,0x24,0x94,0x24,0xc0,0x94,0x21,0x94,0x25,0x94,0x26,0x94,0x27,0x94,0x27,0x94,0x26,0x94,0x25,0x94,0x28,0x94,0x28,0x94,0x28,0x94,0x28,0x94,0x28,0x94,0x28,0xc1,0x4,0x66,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x94,0x29,0xd,0x94,0x2a,0xe5,0x6b,0xc3,0xc4,0x94,0x20,0x82,0x7a,0x94,0x2b,0xe0,0x1,0xc9,0x3,0x1,0xc6,0x3e,0xe1,0x7,0xc7,0x4,0xc6,0x8b,0x39,0xc6,0x89,0xd,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xc6,0x8b,0x38,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x7f,0xd3,0xc6,0x89,0x30,0xc9,0x1,0x0,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe0,0x2,0xc9,0x1,0x5,0xc6,0x86,0x5f,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xcb,0x1,0xd3,0xe1,0x1,0xc7,0x24,0xe1,0x2,0xc7,0x3,0xc4,0x0,0xc4,0x2,0xd3,0xd3,0x0,0xc1,0xd9,0xec,0xc1,0xd9,0xe6,0xc1,0xda,0x36,0xc1,0xda,0x4c,0xc1,0xda,0xea,0xc1,0xdb,0x36,0xc1,0xdb,0x92,0xc1,0xdb,0x8c,0xc1,0xdb,0xca,0xc1,0xdc,0x3c,0xc1,0xdc,0x36,0xe1,0x24,0x94,0x2d,0x94,0x2e,0x94,0x2e,0x94,0x2d,0x94,0x2f,0x94,0x30,0x94,0x30,0x94,0x2f,0x94,0x31,0x94,0x31,0x94,0x32,0x94,0x32,0xc0,0xc0,0xc0,0xc0,0x94,0x33,0x94,0x34,0x94,0x34,0x94,0x33,0xc0,0x94,0x35,0x94,0x35,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x94,0x35,0x94,0x36,0x94,0x37,0x94,0x37,0x94,0x36,0xc0,0x94,0x32,0xc1,0x4,0x6e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x94,0x38,0xd,0x94,0x39,0xe5,0x81,0x2f,0xc3,0xc4,0x94,0x0,0x82,0x7a,0x94,0x3a,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x3,0x14,0xc9,0x1,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x7f,0xd3,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x1,0x4,0xc6,0x3e,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x9,0xc7,0x4,0xc6,0x93,0x3a,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x83,0x79,0xc6,0x9,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x94,0x1f,0xd3,0xc6,0x9,0xd3,0xc6,0x89,0xd,0xc6,0x93,0x7e,0xd3,0xc6,0x85,0x6,0xe1,0x3,0xc7,0x3,0xe1,0x3,0xc7,0x4,0xc6,0x8d,0x37,0xc6,0x8b,0x3d,0xc6,0x85,0x1a,0xd3,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x83,0x5f,0xc6,0x83,0x5f,0xcb,0x0,0xd3,0xcb,0x1,0xd3,0xc6,0x9,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x94,0x1f,0xd3,0xc6,0x9,0xd3,0xd3,0xd3,0x0,0x6,0x6e,0x65,0x77,0x76,0x61,0x72,0xc1,0xdd,0x5e,0xc1,0xdd,0x58,0xc1,0xdd,0xa8,0xc1,0xdd,0xbe,0xc1,0xde,0x5c,0xc1,0xde,0xa8,0xc1,0xdf,0x4,0xc1,0xde,0xfe,0xc1,0xdf,0x3c,0xc1,0xdf,0xae,0xc1,0xdf,0xa8,0xe1,0x24,0x94,0x3d,0x94,0x3e,0x94,0x3e,0x94,0x3d,0x94,0x3f,0x94,0x40,0x94,0x40,0x94,0x3f,0x94,0x41,0x94,0x41,0x94,0x42,0x94,0x42,0xc0,0xc0,0xc0,0xc0,0x94,0x43,0x94,0x44,0x94,0x44,0x94,0x43,0xc0,0x94,0x45,0x94,0x45,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x94,0x45,0x94,0x46,0x94,0x47,0x94,0x47,0x94,0x46,0xc0,0x94,0x42,0xc1,0x4,0x7a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x94,0x48,0xd,0x94,0x49,0xe5,0x81,0x33,0xc3,0xc4,0x94,0x0,0x82,0x7a,0x94,0x4a,0xc0,0xd9,0x1,0x3,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x3,0x14,0xc9,0x1,0x1,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x93,0x7f,0xd3,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x1,0x4,0xc6,0x3e,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x9,0xc7,0x4,0xc6,0x93,0x3a,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x83,0x79,0xc6,0x9,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x94,0x1f,0xd3,0xc6,0x9,0xd3,0xc6,0x89,0xd,0xc6,0x93,0x7e,0xd3,0xc6,0x85,0x6,0xe1,0x3,0xc7,0x3,0xe1,0x3,0xc7,0x4,0xc6,0x8d,0x37,0xc6,0x8b,0x3d,0xc6,0x85,0x1a,0xd3,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x83,0x5f,0xc6,0x83,0x5f,0xcb,0x0,0xd3,0xcb,0x1,0xd3,0xc6,0x9,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x94,0x1f,0xd3,0xc6,0x9,0xd3,0xd3,0xd3,0x0,0xe0,0x31,0x63,0x6c,0x61,0x73,0x73,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x72,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x61,0x20,0x27,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x76,0x61,0x6c,0x75,0x65,0x27,0x20,0x6f,0x6e,0x20,0x6c,0x69,0x6e,0x65,0x20,0x4,0x63,0x68,0x61,0x72,0x27,0xd,0x94,0x4d,0x93,0x7c,0x93,0x7f,0x8b,0x49,0x8b,0x42,0x93,0x7f,0x27,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xe0,0xcc,0xc1,0xe0,0xc0,0xc1,0xe0,0xb6,0xc1,0xe0,0xdc,0xc1,0xe0,0xfa,0xc1,0xe0,0xf4,0xc1,0xe0,0xea,0xc1,0xe1,0x62,0xc1,0xe1,0x6a,0xc1,0xe1,0xb0,0xc1,0xe1,0xa6,0xc1,0xe2,0x72,0xc1,0xe2,0x6c,0xc1,0xe2,0x62,0xc1,0xe2,0xc6,0xc1,0xe2,0xc0,0xc1,0xe2,0xb6,0xc1,0xe3,0x10,0xc1,0xe3,0x4,0xc1,0xe3,0x80,0xc1,0xe4,0x28,0xc1,0xe4,0xaa,0xc1,0xe4,0xfa,0xc1,0xe5,0x60,0xc1,0xe5,0xa8,0xe1,0x45,0x94,0x50,0x94,0x50,0x94,0x51,0x94,0x52,0x94,0x52,0x94,0x51,0x94,0x50,0x94,0x53,0x94,0x53,0x94,0x54,0x94,0x55,0x94,0x56,0x94,0x56,0x94,0x55,0x94,0x54,0x94,0x53,0x94,0x57,0x94,0x58,0x94,0x58,0x94,0x57,0x94,0x59,0x94,0x5a,0xc0,0xc0,0xc0,0x94,0x59,0x94,0x5b,0x94,0x5c,0x94,0x5d,0x94,0x5d,0x94,0x5c,0x94,0x5b,0x94,0x5e,0x94,0x5f,0x94,0x60,0x94,0x60,0x94,0x5f,0x94,0x5e,0x94,0x61,0x94,0x61,0x94,0x62,0x94,0x62,0x94,0x61,0x94,0x63,0xc0,0xc0,0xc0,0x94,0x63,0x94,0x64,0xc0,0xc0,0xc0,0x94,0x64,0x94,0x65,0x94,0x65,0x94,0x65,0x94,0x65,0x94,0x65,0x94,0x65,0x94,0x66,0x94,0x66,0x94,0x67,0x94,0x67,0x94,0x68,0x94,0x68,0x94,0x68,0x94,0x68,0x94,0x68,0x94,0x68,0xc1,0x4,0x88,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x94,0x69,0xd,0x94,0x6a,0xe5,0x82,0x2f,0xc3,0xc4,0x94,0x4e,0x94,0x4f,0x94,0x6b,0xe1,0x2,0xc7,0x20,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x6,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x1,0xd3,0xdc,0x0,0x0,0x36,0xe1,0x1,0xc7,0x18,0xe8,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x6,0xd3,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xc6,0x81,0x49,0xd3,0xd3,0xdd,0x0,0x0,0x61,0xe1,0x1,0xc9,0x3,0x1c,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x19,0xe1,0x2,0xc7,0x1a,0xc6,0x94,0x4c,0xcb,0x0,0xd3,0xd3,0xdb,0x0,0x0,0x62,0xc2,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x6,0xd3,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xc6,0x81,0x49,0xd3,0xd1,0x2,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x6,0xd3,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xc6,0x4a,0xd3,0xd1,0x3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x3,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x44,0xd3,0xdd,0x0,0x0,0xfd,0xe0,0x1,0xc9,0x3,0x1,0xc6,0x3e,0xe1,0x7,0xc7,0x4,0xc6,0x8b,0x39,0xc6,0x89,0xd,0xcb,0x2,0xc6,0x8b,0x38,0xcb,0x3,0xc6,0x89,0x30,0xc9,0x1,0x0,0xd3,0xd3,0xd2,0x0,0x4,0xd2,0x1,0x5,0xe0,0x2,0xc9,0x1,0x8,0xc6,0x86,0x5f,0xcb,0x2,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x64,0xc6,0x8b,0x3d,0xc6,0x8b,0x44,0xc6,0x8b,0x44,0xcb,0x5,0xd3,0xd3,0xe1,0x1,0xc7,0x24,0xe1,0x2,0xc7,0x3,0xc4,0x0,0xc4,0x2,0xd3,0xd3,0xdb,0x0,0x0,0xfe,0xc2,0xe1,0x2,0xc9,0x3,0x14,0xc9,0x1,0x0,0xcb,0x3,0xd3,0xd1,0x6,0xe0,0x2,0xc9,0x1,0x8,0xc6,0x86,0x5f,0xcb,0x2,0xcb,0x6,0xd3,0xe1,0x1,0xc7,0x24,0xe1,0x2,0xc7,0x3,0xc4,0x0,0xc4,0x2,0xd3,0xd3,0x0,0x6,0x65,0x78,0x74,0x65,0x6e,0x64,0xe0,0x21,0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,0x65,0x78,0x74,0x65,0x6e,0x64,0x20,0x73,0x70,0x65,0x63,0x69,0x66,0x69,0x65,0x72,0x20,0x6f,0x6e,0x20,0x6c,0x69,0x6e,0x65,0x20,0xc1,0xe8,0xb6,0xc1,0xe8,0xd2,0x24,0x94,0x6f,0x94,0x70,0x94,0x70,0x94,0x6f,0xc1,0x4,0xaa,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x94,0x71,0xd,0x94,0x72,0xb9,0xc3,0xc4,0xc4,0xc4,0x94,0x73,0xe1,0x2,0xc9,0x4,0x14,0xc9,0x2,0x0,0xe0,0x0,0xc9,0x0,0x2,0xc6,0x90,0x19,0xd3,0xd3,0x0,0xc1,0xe9,0x50,0x22,0x94,0x75,0x94,0x75,0xc1,0x4,0xac,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x94,0x76,0xd,0x94,0x77,0xb3,0xc3,0xc4,0xc4,0xc4,0x94,0x78,0xe1,0x2,0xc9,0x4,0x14,0xc9,0x2,0x0,0xc9,0x0,0x2,0xd3,0x0,0x22,0xd,0x94,0x4d,0xc1,0xea,0x6,0xc1,0xea,0xe,0xc1,0xea,0x8a,0xc1,0xea,0x80,0x2a,0x94,0x7b,0x94,0x7c,0x94,0x7c,0x94,0x7b,0x94,0x7d,0x94,0x7e,0xc0,0xc0,0xc0,0x94,0x7d,0xc1,0x4,0xae,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x94,0x7f,0xd,0x95,0x0,0xe5,0x2c,0xc3,0xc4,0x94,0x7a,0x82,0x7a,0x95,0x1,0xe1,0x1,0xc9,0x4,0x1c,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x9,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x19,0xe1,0x2,0xc7,0x1a,0xc6,0x94,0x6e,0xcb,0x0,0xd3,0xd3,0x0,0xc1,0xec,0xfe,0x22,0x95,0x3,0x95,0x3,0xc1,0x4,0xb8,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x95,0x4,0xd,0x95,0x5,0xb0,0xc3,0x8f,0x3,0xc4,0xc4,0x95,0x6,0xe8,0x0,0xca,0x0,0xc6,0x81,0x49,0xd3,0x0,0xc1,0xed,0x76,0xc1,0xed,0x8c,0x24,0x95,0x8,0x95,0x9,0x95,0x9,0x95,0x8,0xc1,0x4,0xba,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x95,0xa,0xd,0x95,0xb,0xb8,0xc3,0x8f,0x3,0xc4,0xc4,0x95,0xc,0xe1,0x2,0xc9,0x4,0x14,0xc9,0x2,0x1,0xe0,0x0,0xca,0x0,0xc6,0x4a,0xd3,0xd3,0x0,0x65,0x90,0x19,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x8b,0x41,0xc0,0x85,0x6,0xc0,0x7,0x5f,0x65,0x78,0x74,0x65,0x6e,0x64,0x3,0x63,0x6c,0x73,0x3,0x74,0x68,0x73,0x28,0xd,0x94,0x4d,0x8f,0x65,0x90,0x19,0x95,0x10,0x95,0x11,0x8b,0x41,0x85,0x6,0x28,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xe6,0xce,0xc1,0xe6,0xc2,0xc1,0xe6,0xb8,0xc1,0xe6,0xf4,0xc1,0xe6,0xee,0xc1,0xe6,0xe4,0xc1,0xe7,0x5c,0xc1,0xe7,0x64,0xc1,0xe7,0xaa,0xc1,0xe7,0xa0,0xc1,0xe8,0x44,0xc1,0xe8,0x3e,0xc1,0xe8,0x34,0xc1,0xe8,0x96,0xc1,0xe8,0x8a,0xc1,0xe9,0x30,0xc1,0xe9,0x24,0xc1,0xeb,0x14,0xc1,0xeb,0x68,0xc1,0xeb,0x9e,0xc1,0xec,0x0,0xc1,0xec,0x36,0xc1,0xec,0xde,0xc1,0xec,0xbc,0xc1,0xec,0x96,0xc1,0xec,0xd0,0xc1,0xec,0xc4,0xc1,0xec,0xd6,0xc1,0xed,0x56,0xc1,0xed,0x4a,0xc1,0xed,0x3e,0xc1,0xed,0x50,0xc1,0xed,0xc8,0xc1,0xee,0x1e,0xc1,0xee,0x88,0xc1,0xee,0x52,0xc1,0xee,0x7e,0xc1,0xee,0x72,0xc1,0xee,0xa4,0xe1,0x6f,0x95,0x14,0x95,0x14,0x95,0x15,0x95,0x16,0x95,0x16,0x95,0x15,0x95,0x14,0x95,0x17,0x95,0x18,0x95,0x19,0x95,0x19,0x95,0x18,0x95,0x17,0x95,0x1a,0x95,0x1b,0x95,0x1b,0x95,0x1a,0x95,0x1c,0x95,0x1d,0xc0,0xc0,0xc0,0x95,0x1c,0x95,0x1e,0x95,0x1f,0x95,0x20,0x95,0x20,0x95,0x1f,0x95,0x1e,0x95,0x21,0x95,0x21,0x95,0x22,0x95,0x22,0x95,0x21,0xc0,0xc0,0x95,0x23,0x95,0x23,0x95,0x24,0x95,0x24,0x95,0x23,0xc0,0xc0,0xc0,0xc0,0x95,0x25,0x95,0x25,0x95,0x26,0xc0,0xc0,0x95,0x27,0x95,0x27,0xc0,0x95,0x26,0x95,0x28,0xc0,0xc0,0x95,0x29,0x95,0x29,0xc0,0x95,0x28,0x95,0x2a,0x95,0x2b,0x95,0x2b,0x95,0x2c,0x95,0x2c,0x95,0x2c,0x95,0x2d,0x95,0x2d,0x95,0x2e,0x95,0x2e,0x95,0x2f,0x95,0x2f,0x95,0x2f,0x95,0x2d,0x95,0x2b,0x95,0x2a,0x95,0x30,0x95,0x31,0x95,0x31,0x95,0x32,0x95,0x32,0x95,0x33,0x95,0x33,0x95,0x33,0x95,0x31,0x95,0x30,0x95,0x34,0x95,0x34,0xc0,0xc0,0xc0,0xc0,0x95,0x35,0x95,0x35,0xc0,0x95,0x36,0x95,0x36,0x95,0x37,0x95,0x37,0x95,0x38,0x95,0x38,0x95,0x39,0x95,0x39,0x95,0x38,0x95,0x37,0x95,0x36,0x95,0x3a,0x95,0x3a,0xc0,0x95,0x34,0xc1,0x4,0xa2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x95,0x3b,0xd,0x95,0x3c,0xe5,0x83,0x43,0xc3,0xc4,0x95,0x12,0x95,0x13,0x95,0x3d,0xe1,0x2,0xc7,0x20,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x6,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x1,0xd3,0xdc,0x0,0x0,0x31,0xe8,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x6,0xd3,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xc6,0x81,0x49,0xd3,0xdd,0x0,0x0,0x5c,0xe1,0x1,0xc9,0x3,0x1c,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x19,0xe1,0x2,0xc7,0x1a,0xc6,0x94,0x6e,0xcb,0x0,0xd3,0xd3,0xdb,0x0,0x0,0x5d,0xc2,0xe0,0x0,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x85,0x6,0xd3,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xc6,0x4a,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x2,0xc6,0x8b,0x3d,0xd3,0xc6,0x90,0x18,0xd3,0xe3,0x0,0xd0,0x94,0x74,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x2,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x2e,0xd3,0xe3,0x0,0xd0,0x94,0x79,0xd3,0xc0,0xe3,0x0,0xd0,0x95,0x2,0xd3,0xd4,0xd1,0x3,0xe0,0x1,0xc9,0x1,0x7,0xc6,0x3e,0xcb,0x3,0xd3,0xe1,0x2,0xc9,0x3,0x14,0xc9,0x1,0x1,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x8b,0x2e,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x89,0xd,0xc6,0x8b,0x63,0xd3,0xd3,0xd1,0x4,0xe1,0x2,0xc9,0x3,0x14,0xc9,0x1,0x1,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x8b,0x2e,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x89,0xd,0xc6,0x85,0x1a,0xd3,0xd3,0xd1,0x5,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x9,0xe1,0x3,0xc7,0x3,0xc2,0xc2,0xc2,0xd3,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xcb,0x2,0xc6,0x85,0x6,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x95,0x7,0xd3,0xd1,0x6,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xcb,0x2,0xc6,0x85,0x6,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x95,0xd,0xd3,0xd1,0x7,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0xb,0xc7,0x4,0xc6,0x95,0xe,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x83,0x79,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x89,0xd,0xc6,0x95,0xf,0xd3,0xc6,0x85,0x6,0xe1,0x2,0xc7,0x9,0xe1,0x3,0xc7,0x3,0xcb,0x4,0xcb,0x5,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc9,0x1,0x7,0xc6,0x81,0x44,0xd3,0xc4,0x1,0xd3,0xd3,0xcb,0x7,0xd3,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x8b,0x41,0xcb,0x6,0xd3,0xd3,0x0,0xc1,0x4,0xbe,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x95,0x3f,0xa8,0xc3,0xc4,0xc4,0xc4,0x95,0x40,0xc2,0x0,0x22,0x8f,0x2,0x8e,0x43,0xc1,0xd7,0x80,0xc1,0xd7,0x68,0xc1,0xd7,0x5c,0xc1,0xd7,0xa6,0xc1,0xd7,0x9a,0xc1,0xd7,0x8e,0xc1,0xd9,0x6c,0xc1,0xd9,0x54,0xc1,0xd9,0x48,0xc1,0xd9,0x8c,0xc1,0xd9,0x80,0xc1,0xd9,0x7a,0xc1,0xdc,0x96,0xc1,0xdc,0x7e,0xc1,0xdc,0x72,0xc1,0xdc,0xb6,0xc1,0xdc,0xaa,0xc1,0xdc,0xa4,0xc1,0xe0,0x3e,0xc1,0xe0,0x4,0xc1,0xdf,0xf0,0xc1,0xdf,0xe4,0xc1,0xe0,0x2c,0xc1,0xe0,0x20,0xc1,0xe0,0x12,0xc1,0xe0,0x66,0xc1,0xe0,0x5a,0xc1,0xe0,0x4c,0xc1,0xe6,0x3e,0xc1,0xe6,0x4,0xc1,0xe5,0xf0,0xc1,0xe5,0xe4,0xc1,0xe6,0x2c,0xc1,0xe6,0x20,0xc1,0xe6,0x12,0xc1,0xe6,0x66,0xc1,0xe6,0x5a,0xc1,0xe6,0x4c,0xc1,0xef,0x96,0xe1,0x6d,0x95,0x43,0x95,0x43,0x95,0x44,0x95,0x44,0x95,0x45,0x95,0x45,0x95,0x44,0x95,0x46,0x95,0x46,0x95,0x47,0x95,0x48,0x95,0x48,0x95,0x47,0x95,0x46,0x95,0x43,0xc0,0xc0,0x95,0x49,0x95,0x49,0x95,0x4a,0x95,0x4a,0x95,0x4b,0x95,0x4b,0x95,0x4a,0x95,0x4c,0x95,0x4c,0x95,0x4d,0x95,0x4e,0x95,0x4e,0x95,0x4d,0x95,0x4c,0x95,0x49,0xc0,0xc0,0x95,0x4f,0x95,0x4f,0x95,0x50,0x95,0x50,0x95,0x51,0x95,0x51,0x95,0x50,0x95,0x52,0x95,0x52,0x95,0x53,0x95,0x54,0x95,0x54,0x95,0x53,0x95,0x52,0x95,0x4f,0xc0,0xc0,0x95,0x55,0x95,0x55,0x95,0x56,0x95,0x56,0x95,0x57,0x95,0x57,0x95,0x58,0x95,0x58,0x95,0x57,0x95,0x59,0x95,0x59,0x95,0x5a,0x95,0x5b,0x95,0x5b,0x95,0x5a,0x95,0x59,0x95,0x56,0x95,0x5c,0x95,0x5c,0x95,0x5d,0x95,0x5e,0x95,0x5e,0x95,0x5d,0x95,0x5c,0x95,0x55,0xc0,0xc0,0x95,0x5f,0x95,0x5f,0x95,0x60,0x95,0x60,0x95,0x61,0x95,0x61,0x95,0x62,0x95,0x62,0x95,0x61,0x95,0x63,0x95,0x63,0x95,0x64,0x95,0x65,0x95,0x65,0x95,0x64,0x95,0x63,0x95,0x60,0x95,0x66,0x95,0x66,0x95,0x67,0x95,0x68,0x95,0x68,0x95,0x67,0x95,0x66,0x95,0x5f,0xc0,0xc0,0xc0,0xc0,0x95,0x69,0x95,0x69,0xc1,0x4,0x5e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x95,0x6a,0xd,0x95,0x6b,0xe5,0x82,0x46,0xc3,0x95,0x42,0xc4,0xc4,0x95,0x6c,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x94,0x1e,0xd3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xe8,0x0,0xca,0x0,0xc6,0x93,0x7f,0xd3,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x44,0xd3,0xd3,0xe3,0x0,0xd0,0x94,0x2c,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x94,0x1e,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x94,0x1f,0xd3,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0x79,0xd3,0xd3,0xe3,0x0,0xd0,0x94,0x3b,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x94,0x1e,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x94,0x1f,0xd3,0xc6,0x8b,0x3d,0xd3,0xc6,0x94,0x3c,0xd3,0xd3,0xe3,0x0,0xd0,0x94,0x4b,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x90,0x18,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x90,0x19,0xd3,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x2e,0xd3,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x90,0x19,0xd3,0xc6,0x89,0xd,0xd3,0xc6,0x8b,0x63,0xd3,0xd3,0xe3,0x0,0xd0,0x94,0x6c,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x90,0x18,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x90,0x19,0xd3,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x2e,0xd3,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xca,0x0,0xc6,0x90,0x19,0xd3,0xc6,0x89,0xd,0xd3,0xc6,0x94,0x6d,0xd3,0xd3,0xe3,0x0,0xd0,0x95,0x3e,0xd3,0xc0,0xe3,0x0,0xd0,0x95,0x41,0xd3,0xd4,0xe1,0x2,0xc9,0x2,0x14,0xc9,0x0,0x1,0xca,0x0,0xd3,0x0,0xc,0x5f,0x63,0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,0xb,0x63,0x6c,0x61,0x73,0x73,0x66,0x69,0x65,0x6c,0x64,0x73,0x7,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x63,0x95,0x6f,0xc0,0x8b,0x36,0xc0,0x95,0x70,0xc0,0x5,0x74,0x6f,0x4d,0x61,0x70,0x22,0x8f,0x75,0x4b,0xc1,0xf6,0x2c,0x22,0x95,0x74,0x95,0x74,0xc1,0x4,0xe6,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x95,0x75,0xd,0x95,0x76,0xb0,0xc3,0x95,0x73,0xc4,0xc4,0x95,0x77,0xe8,0x0,0xca,0x1,0xc6,0x8b,0x44,0xd3,0x0,0xc1,0xf6,0xf0,0x22,0x95,0x79,0x95,0x79,0xc1,0x4,0xea,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x95,0x7a,0xd,0x95,0x7b,0xb0,0xc3,0x95,0x73,0xc4,0xc4,0x95,0x7c,0xe1,0x1,0xc9,0x3,0x3,0xca,0x1,0xd3,0x0,0xc1,0xf7,0x66,0x22,0x95,0x7e,0x95,0x7e,0xc1,0x4,0xec,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x95,0x7f,0xd,0x96,0x0,0xaf,0xc3,0x4c,0xc4,0xc4,0x96,0x1,0xe1,0x1,0xc9,0x3,0x3,0xca,0x0,0xd3,0x0,0xc1,0xf6,0xc6,0xc1,0xf6,0xb6,0xc1,0xf7,0x42,0xc1,0xf7,0x2a,0x28,0x96,0x3,0x96,0x4,0x96,0x4,0x96,0x3,0x96,0x5,0x96,0x6,0x96,0x6,0x96,0x5,0xc1,0x4,0xe8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x96,0x7,0xd,0x96,0x8,0xe5,0x2b,0xc3,0xc4,0xc4,0xc4,0x96,0x9,0xf0,0x1,0x82,0x62,0xe0,0x0,0xce,0xc6,0x95,0x70,0xd3,0xc6,0x82,0x63,0xd0,0x95,0x7d,0xd3,0xf0,0x1,0x82,0x62,0xe0,0x0,0xce,0xc6,0x95,0x6f,0xd3,0xc6,0x82,0x63,0xd0,0x96,0x2,0xd3,0x0,0xc1,0xf7,0xec,0x26,0x96,0xb,0x96,0xb,0xc0,0xc0,0xc0,0x96,0xb,0xc1,0x4,0xf2,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x96,0xc,0xd,0x96,0xd,0xe5,0x22,0xc3,0x95,0x73,0xc4,0xc4,0x96,0xe,0xe1,0x2,0xc7,0x3,0xca,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x64,0xc6,0x8b,0x3d,0xc6,0x8b,0x44,0xc6,0x8b,0x44,0xca,0x1,0xd3,0xd3,0x0,0xc1,0xf8,0x84,0x22,0x96,0x10,0x96,0x10,0xc1,0x4,0xf4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x96,0x11,0xd,0x96,0x12,0xb4,0xc3,0x95,0x73,0xc4,0xc4,0x96,0x13,0xe0,0x2,0xc9,0x0,0x5,0xc6,0x86,0x5f,0xca,0x0,0xc2,0xd3,0x0,0xc1,0xf8,0xf6,0x23,0x96,0x15,0x96,0x15,0x96,0x15,0xc1,0x4,0xf8,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x96,0x16,0xd,0x96,0x17,0xb1,0xc3,0x95,0x73,0xc4,0xc4,0x96,0x18,0xe1,0x2,0xc7,0x3,0xca,0x0,0xca,0x1,0xd3,0x0,0xc1,0xf9,0x66,0x22,0x96,0x1a,0x96,0x1a,0xc1,0x4,0xfa,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x96,0x1b,0xd,0x96,0x1c,0xb4,0xc3,0x95,0x73,0xc4,0xc4,0x96,0x1d,0xe0,0x2,0xc9,0x0,0x8,0xc6,0x86,0x5f,0xca,0x0,0xc2,0xd3,0x0,0x4,0x66,0x69,0x6c,0x6c,0x63,0x96,0x1f,0xc0,0x8b,0x3d,0xc0,0x89,0x24,0xc0,0x6,0x6f,0x62,0x6a,0x65,0x63,0x74,0x6,0x5f,0x63,0x6c,0x61,0x73,0x73,0x6,0x3c,0x41,0x6e,0x6f,0x6e,0x3e,0x4,0x6c,0x69,0x73,0x74,0xc1,0x5,0x10,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0x96,0x25,0xbb,0xc3,0x8e,0x44,0xc4,0xc4,0x96,0x26,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x83,0x5f,0xc6,0x83,0x5f,0xca,0x0,0xd3,0x0,0xa,0x6f,0x75,0x74,0x65,0x72,0x73,0x63,0x6f,0x70,0x65,0x7,0x6d,0x75,0x74,0x61,0x62,0x6c,0x65,0x6,0x66,0x69,0x65,0x6c,0x64,0x73,0xc,0x63,0x6c,0x61,0x73,0x73,0x6d,0x75,0x74,0x61,0x62,0x6c,0x65,0x7,0x65,0x78,0x74,0x65,0x6e,0x64,0x73,0xc,0x61,0x72,0x67,0x66,0x69,0x65,0x6c,0x64,0x69,0x6e,0x69,0x74,0xb,0x63,0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,0x5,0x6d,0x66,0x69,0x6c,0x6c,0x5,0x63,0x66,0x69,0x6c,0x6c,0x34,0x96,0x28,0x89,0x30,0x85,0x6,0x96,0x29,0x96,0x2a,0x95,0x70,0x96,0x2b,0x96,0x2c,0x95,0x6f,0x96,0x2d,0x8f,0x0,0x8f,0x0,0x96,0x2e,0x8b,0x49,0x8b,0x42,0x96,0x2e,0x96,0x2f,0x96,0x30,0x95,0x70,0x95,0x6f,0x34,0xc1,0xc1,0xc1,0xc2,0xc1,0xc1,0xc2,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xcd,0x8a,0xc1,0xce,0x22,0xc1,0xcd,0xfe,0xc1,0xcd,0xc2,0xc1,0xcd,0xf0,0xc1,0xce,0x14,0xc1,0xce,0xc,0xc1,0xce,0x1a,0xc1,0xcf,0x54,0xc1,0xcf,0x4a,0xc1,0xcf,0x98,0xc1,0xcf,0x8a,0xc1,0xd0,0x62,0xc1,0xd0,0x58,0xc1,0xd0,0xae,0xc1,0xd0,0xa0,0xc1,0xd1,0xe,0xc1,0xd1,0x2,0xc1,0xd0,0xfa,0xc1,0xd1,0x8,0xc1,0xef,0xca,0xc1,0xd5,0xb4,0xc1,0xd5,0xaa,0xc1,0xef,0xda,0xc1,0xf0,0x12,0xc1,0xf3,0x24,0xc1,0xf3,0xd2,0xc1,0xf3,0xc4,0xc1,0xf3,0xf2,0xc1,0xf4,0x38,0xc1,0xf5,0x4e,0xc1,0xf5,0xb0,0xc1,0xf6,0x40,0xc1,0xf6,0x10,0xc1,0xf7,0xd2,0xc1,0xf8,0x5a,0xc1,0xf8,0xdc,0xc1,0xf9,0x34,0xc1,0xf9,0xfa,0xc1,0xfa,0x94,0xc1,0xfb,0xaa,0xc1,0xfb,0xf0,0xc1,0xfc,0x22,0xc1,0xfc,0x7a,0xc1,0xfc,0xbe,0xc1,0xfc,0xb6,0xc1,0xfd,0x7a,0xc1,0xfd,0xdc,0xe1,0x81,0xb,0x96,0x33,0x96,0x33,0x96,0x34,0x96,0x35,0x96,0x35,0x96,0x36,0x96,0x36,0xc0,0xc0,0x96,0x37,0x96,0x37,0xc0,0x96,0x36,0x96,0x38,0x96,0x38,0x96,0x39,0x96,0x39,0x96,0x3a,0x96,0x3a,0x96,0x3a,0x96,0x38,0x96,0x35,0x96,0x34,0x96,0x3b,0x96,0x3c,0x96,0x3b,0x96,0x3d,0x96,0x3e,0x96,0x3d,0x96,0x3f,0x96,0x40,0x96,0x3f,0x96,0x41,0x96,0x42,0x96,0x41,0x96,0x43,0x96,0x44,0x96,0x44,0x96,0x45,0x96,0x45,0x96,0x46,0x96,0x46,0x96,0x46,0x96,0x44,0x96,0x43,0x96,0x47,0x96,0x48,0x96,0x49,0x96,0x49,0x96,0x48,0x96,0x4a,0xc0,0xc0,0x96,0x4b,0x96,0x4b,0xc0,0x96,0x4a,0x96,0x47,0x96,0x4c,0x96,0x4c,0x96,0x4c,0xc0,0xc0,0x96,0x4d,0x96,0x4e,0x96,0x4e,0x96,0x4d,0x96,0x4f,0x96,0x4f,0xc0,0x96,0x50,0xc0,0xc0,0xc0,0x96,0x50,0xc0,0xc0,0xc0,0x96,0x51,0xc0,0xc0,0x96,0x52,0x96,0x52,0x96,0x53,0x96,0x54,0x96,0x54,0x96,0x53,0xc0,0x96,0x51,0x96,0x55,0x96,0x55,0x96,0x56,0x96,0x56,0x96,0x57,0x96,0x57,0x96,0x58,0x96,0x58,0xc0,0xc0,0x96,0x59,0x96,0x59,0xc0,0xc0,0xc0,0x96,0x5a,0x96,0x5a,0xc0,0xc0,0xc0,0x96,0x5b,0x96,0x5b,0xc0,0xc0,0x96,0x5c,0x96,0x5c,0xc0,0x96,0x5d,0x96,0x5d,0xc0,0xc0,0x96,0x5e,0x96,0x5e,0x96,0x5e,0xc0,0x96,0x5f,0x96,0x60,0x96,0x5f,0xc0,0xc0,0x96,0x61,0x96,0x61,0xc0,0xc0,0xc0,0x96,0x62,0x96,0x62,0xc0,0x96,0x5d,0xc0,0xc1,0x4,0x2c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x96,0x63,0xd,0x96,0x64,0xe5,0x85,0x40,0xc3,0xc4,0x96,0x31,0x96,0x32,0x96,0x65,0xc8,0x0,0x0,0xd1,0x0,0xe1,0x1,0xc9,0x1,0x5,0xc8,0x0,0x0,0xd3,0xd1,0x1,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x73,0xc6,0x89,0xd,0xc6,0x8b,0x63,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xd3,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8e,0x76,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x93,0x7b,0xd3,0xd1,0x2,0xc1,0xd6,0x3,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xd1,0x4,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xd1,0x5,0xc1,0xd6,0x6,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xd1,0x7,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xd1,0x8,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8e,0x76,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x94,0x1d,0xd3,0xd1,0x9,0xe0,0x1,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x0,0xd3,0xc6,0x89,0x24,0xd0,0x95,0x6d,0xd3,0xc6,0x3e,0xe1,0x2,0xc9,0x1,0x14,0xcb,0x1,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x8b,0x2e,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xc6,0x89,0xd,0xc6,0x85,0x1a,0xd3,0xd3,0xd3,0xd1,0xa,0xe1,0x2,0xc7,0x9,0xcb,0x9,0xcb,0xa,0xd3,0xd1,0xb,0xe1,0xd,0xc7,0x4,0xc6,0x8f,0x9,0xc6,0x8b,0x3d,0xc6,0x8b,0x44,0xc6,0x89,0x30,0xcb,0x1,0xc6,0x85,0x6,0xcb,0x2,0xc6,0x8f,0x0,0xcb,0xb,0xc6,0x89,0xf,0xe0,0x0,0xe0,0x0,0xcb,0x1,0xc6,0x89,0xf,0xd3,0xc6,0x89,0x22,0xd3,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xd1,0xc,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x3e,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0x41,0xc6,0x89,0xd,0xc6,0x95,0x6e,0xc6,0x8b,0x38,0xc1,0xc6,0x8b,0x44,0xcb,0xc,0xd3,0xd3,0xd2,0x0,0xd,0xd2,0x1,0xe,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x64,0xc6,0x8b,0x3d,0xc6,0x8b,0x44,0xc6,0x8b,0x44,0xcb,0xe,0xd3,0xd1,0xf,0xe0,0x2,0xcb,0x0,0xc6,0x8b,0x2c,0xe1,0x7,0xc7,0x4,0xc6,0x95,0x71,0xc6,0x95,0x70,0xe0,0x0,0xcb,0x5,0xc6,0x95,0x72,0xd3,0xc6,0x95,0x6f,0xe0,0x0,0xf0,0x1,0x82,0x62,0xcb,0x8,0xc6,0x89,0x24,0xd0,0x95,0x78,0xd3,0xc6,0x90,0x3d,0xd3,0xc6,0x8b,0x36,0xd0,0x96,0xa,0xd3,0xc8,0x0,0x2,0xd3,0xf0,0x1,0x82,0x62,0xcb,0x5,0xc6,0x89,0x24,0xd0,0x96,0xf,0xd3,0xd1,0x10,0xf0,0x1,0x82,0x62,0xcb,0x5,0xc6,0x82,0x63,0xd0,0x96,0x14,0xd3,0xf0,0x1,0x82,0x62,0xcb,0x8,0xc6,0x89,0x24,0xd0,0x96,0x19,0xd3,0xd1,0x11,0xf0,0x1,0x82,0x62,0xcb,0x8,0xc6,0x82,0x63,0xd0,0x96,0x1e,0xd3,0xe1,0x7,0xc7,0x4,0xc6,0x96,0x20,0xc6,0x8b,0x3d,0xc6,0x96,0x21,0xc6,0x96,0x1f,0xcb,0x10,0xc6,0x89,0x24,0xe0,0x0,0xcb,0x5,0xc6,0x95,0x72,0xd3,0xd3,0xd1,0x12,0xe1,0x7,0xc7,0x4,0xc6,0x96,0x20,0xc6,0x8b,0x3d,0xc6,0x96,0x21,0xc6,0x96,0x1f,0xcb,0x11,0xc6,0x89,0x24,0xe0,0x0,0xcb,0x8,0xc6,0x95,0x72,0xd3,0xd3,0xd1,0x13,0xe1,0x9,0xc7,0x4,0xc6,0x93,0x3a,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xc6,0x90,0x19,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x83,0x79,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xc6,0x89,0xd,0xc6,0x96,0x22,0xd3,0xc6,0x85,0x6,0xe1,0x7,0xc7,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x5d,0xc6,0x83,0x5f,0xe1,0x2,0xc7,0x1f,0xc8,0x0,0x2,0xc6,0x96,0x23,0xd3,0xd3,0xe1,0x3,0xc7,0x10,0xcb,0x3,0xc6,0x84,0x20,0xc6,0x68,0xd3,0xcb,0xf,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x96,0x24,0xc6,0x83,0x5f,0xe0,0x0,0xcb,0x7,0xc6,0x89,0x22,0xd3,0xd3,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x96,0x24,0xc6,0x83,0x5f,0xf0,0x1,0x82,0x62,0xcb,0x4,0xc6,0x89,0x24,0xd0,0x96,0x27,0xd3,0xd3,0xcb,0x12,0xcb,0x13,0xd3,0xd3,0x0,0x65,0x90,0x19,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x93,0x7f,0xc0,0x89,0xd,0xc0,0x4,0x76,0x73,0x65,0x74,0x65,0x88,0x71,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x8b,0x3c,0xc0,0x89,0xd,0xc0,0x63,0x8b,0x3d,0xc0,0x93,0x7f,0xc0,0x94,0x1f,0xc0,0x26,0x93,0x7f,0x8b,0x2e,0x8b,0x3d,0x84,0x79,0x8b,0x3c,0x94,0x1f,0xc1,0xff,0x78,0xc1,0xff,0x90,0xc1,0xff,0xae,0xc1,0xff,0xa8,0xc1,0xff,0xca,0xc1,0xff,0xc4,0xc2,0x1,0x0,0xc,0xc2,0x1,0x0,0x24,0xc2,0x1,0x0,0x1e,0xc2,0x1,0x0,0x7c,0xc2,0x1,0x0,0x84,0xc2,0x1,0x0,0xc8,0xc2,0x1,0x0,0xbc,0xc2,0x1,0x0,0xf6,0xc2,0x1,0x0,0xe8,0xc2,0x1,0x1,0x3e,0xc2,0x1,0x1,0x98,0xc2,0x1,0x1,0x92,0xc2,0x1,0x1,0xba,0xc2,0x1,0x1,0xb4,0xc2,0x1,0x2,0x8,0xc2,0x1,0x2,0x20,0xc2,0x1,0x2,0x1a,0xc2,0x1,0x2,0x3c,0xc2,0x1,0x2,0x36,0xc2,0x1,0x2,0xa2,0xc2,0x1,0x2,0x9c,0xc2,0x1,0x2,0xc4,0xc2,0x1,0x2,0xbe,0xe1,0x46,0x96,0x6c,0x96,0x6d,0x96,0x6d,0x96,0x6e,0x96,0x6f,0x96,0x6f,0x96,0x6e,0x96,0x70,0x96,0x71,0x96,0x71,0x96,0x70,0x96,0x6c,0x96,0x72,0x96,0x73,0x96,0x74,0x96,0x74,0x96,0x73,0x96,0x72,0x96,0x75,0x96,0x76,0x96,0x76,0x96,0x75,0x96,0x77,0x96,0x77,0x96,0x78,0x96,0x78,0x96,0x77,0x96,0x79,0x96,0x79,0x96,0x7a,0x96,0x7a,0x96,0x79,0x96,0x7b,0x96,0x7b,0xc0,0xc0,0x96,0x7c,0x96,0x7d,0x96,0x7d,0x96,0x7c,0x96,0x7e,0x96,0x7f,0x96,0x7f,0x96,0x7e,0xc0,0x96,0x7b,0x97,0x0,0x97,0x1,0x97,0x2,0x97,0x2,0x97,0x1,0x97,0x3,0x97,0x4,0x97,0x4,0x97,0x3,0x97,0x0,0xc0,0xc0,0x97,0x5,0x97,0x6,0x97,0x6,0x97,0x5,0x97,0x7,0x97,0x8,0x97,0x8,0x97,0x7,0xc0,0xc0,0xc0,0xc0,0xc1,0x5,0x1c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x97,0x9,0xd,0x97,0xa,0xe5,0x82,0x57,0xc3,0xc4,0x96,0x6b,0x8b,0x76,0x97,0xb,0xe1,0x4,0xc9,0x2,0x13,0xc8,0x1,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x93,0x7f,0xd3,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x9,0xd3,0xd3,0xd1,0x0,0xf0,0x2,0x8b,0x3b,0xc8,0x1,0x0,0xc6,0x8b,0x2e,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xc0,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x2,0x2,0xc6,0x83,0x3d,0xe8,0x0,0xcb,0x1,0xc6,0x8b,0x3c,0xd3,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x2,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x3e,0xd3,0xdc,0x0,0x0,0x85,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x2,0xc6,0x8b,0x3f,0xd3,0xc6,0x8b,0x3e,0xd3,0xdd,0x0,0x0,0xce,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xe1,0xb,0xc7,0x4,0xc6,0x96,0x67,0xc6,0x8b,0x3d,0xc6,0x96,0x68,0xc6,0x90,0x19,0xcb,0x1,0xc6,0x93,0x7f,0xcb,0x0,0xc6,0x89,0xd,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xc6,0x9,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x9,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0xcf,0xc2,0xe0,0x2,0xc8,0x1,0x0,0xc6,0x3e,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x9,0xd3,0xd3,0xd2,0x0,0x3,0xd2,0x1,0x4,0xe1,0xb,0xc7,0x4,0xc6,0x96,0x69,0xc6,0x8b,0x3d,0xc6,0x84,0x79,0xc6,0x89,0xd,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xc6,0x9,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x9,0xd3,0xc6,0x88,0x71,0xcb,0x3,0xc6,0x8b,0x3c,0xcb,0x4,0xd3,0xd1,0x5,0xe1,0x7,0xc7,0x4,0xc6,0x96,0x6a,0xc6,0x8b,0x3d,0xc6,0x94,0x1e,0xc6,0x94,0x1f,0xcb,0x5,0xc6,0x93,0x7f,0xcb,0x0,0xd3,0x0,0x23,0x93,0x7f,0x84,0x79,0x8b,0x3c,0xc2,0x1,0x3,0xd2,0xc2,0x1,0x3,0xea,0xc2,0x1,0x4,0x3c,0xc2,0x1,0x4,0x54,0xc2,0x1,0x4,0x4e,0xc2,0x1,0x4,0x70,0xc2,0x1,0x4,0x6a,0xc2,0x1,0x4,0xe6,0xc2,0x1,0x4,0xfe,0xc2,0x1,0x4,0xf8,0xc2,0x1,0x5,0x34,0xc2,0x1,0x5,0x2e,0xc2,0x1,0x5,0x56,0xc2,0x1,0x5,0x50,0x3f,0x97,0xe,0x97,0xf,0x97,0xf,0x97,0xe,0x97,0x10,0x97,0x11,0x97,0x12,0x97,0x12,0x97,0x11,0x97,0x13,0x97,0x14,0x97,0x14,0x97,0x13,0x97,0x10,0xc0,0xc0,0x97,0x15,0x97,0x16,0x97,0x17,0x97,0x17,0x97,0x16,0x97,0x15,0x97,0x18,0x97,0x19,0x97,0x19,0x97,0x18,0x97,0x1a,0x97,0x1b,0x97,0x1b,0x97,0x1a,0xc0,0xc1,0x5,0x2e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x97,0x1c,0xd,0x97,0x1d,0xe5,0x81,0x1d,0xc3,0xc4,0x97,0xd,0x81,0x4b,0x97,0x1e,0xe1,0x2,0xc9,0x2,0x13,0xc8,0x1,0x0,0xe8,0x0,0xc8,0x1,0x1,0xc6,0x93,0x7f,0xd3,0xd3,0xd1,0x0,0xf0,0x3,0x8e,0x6c,0xc8,0x1,0x0,0xc6,0x3e,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x9,0xd3,0xc6,0x8b,0x3e,0xd3,0xd2,0x0,0x1,0xd2,0x1,0x2,0xe1,0xb,0xc7,0x4,0xc6,0x96,0x67,0xc6,0x8b,0x3d,0xc6,0x96,0x68,0xc6,0x90,0x19,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x8b,0x2e,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xd3,0xc6,0x93,0x7f,0xcb,0x0,0xc6,0x89,0xd,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xc6,0x9,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x9,0xd3,0xd3,0x0,0x6,0x6d,0x65,0x74,0x68,0x6f,0x64,0x65,0x90,0x19,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x97,0x20,0xc0,0x85,0x6,0xc0,0x4,0x5f,0x73,0x65,0x74,0x23,0x90,0x19,0x93,0x7f,0x89,0xd,0xc2,0x1,0x5,0xec,0xc2,0x1,0x6,0xa,0xc2,0x1,0x6,0x4,0xc2,0x1,0x6,0x52,0xc2,0x1,0x6,0x6a,0xc2,0x1,0x6,0xde,0xc2,0x1,0x6,0xd8,0xc2,0x1,0x7,0x6c,0xc2,0x1,0x7,0x9c,0xc2,0x1,0x7,0x96,0x3b,0x97,0x24,0x97,0x25,0x97,0x26,0x97,0x26,0x97,0x25,0x97,0x24,0x97,0x27,0x97,0x28,0x97,0x28,0x97,0x27,0xc0,0xc0,0x97,0x29,0x97,0x2a,0x97,0x2a,0x97,0x29,0xc0,0xc0,0xc0,0x97,0x2b,0x97,0x2b,0x97,0x2b,0x97,0x2c,0x97,0x2d,0x97,0x2d,0x97,0x2c,0xc0,0xc1,0x5,0x36,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x97,0x2e,0xd,0x97,0x2f,0xe5,0x81,0xd,0xc3,0xc4,0x97,0x23,0x81,0x4b,0x97,0x30,0xe1,0x2,0xc9,0x2,0x14,0xc8,0x1,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x90,0x19,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x2,0x14,0xc8,0x1,0x0,0xe8,0x0,0xc8,0x1,0x1,0xc6,0x93,0x7f,0xd3,0xd3,0xd1,0x1,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x5d,0xc6,0x83,0x5f,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x89,0xd,0xd3,0xd3,0xd1,0x2,0xe1,0xb,0xc7,0x4,0xc6,0x97,0x21,0xc6,0x8b,0x3d,0xc6,0x97,0x20,0xc6,0x90,0x19,0xcb,0x0,0xc6,0x97,0x20,0xc6,0x97,0x22,0xc6,0x85,0x6,0xe1,0x2,0xc7,0x3,0xcb,0x2,0xcb,0x1,0xd3,0xc6,0x9,0xe8,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x9,0xd3,0xd3,0x0,0xc1,0xff,0x20,0xc1,0xff,0x14,0xc1,0xff,0xe,0xc2,0x1,0x3,0x78,0xc2,0x1,0x3,0x6c,0xc2,0x1,0x3,0x66,0xc2,0x1,0x5,0x98,0xc2,0x1,0x5,0x8c,0xc2,0x1,0x5,0x86,0x3b,0x97,0x32,0x97,0x32,0x97,0x33,0x97,0x34,0x97,0x34,0x97,0x33,0x97,0x32,0xc0,0xc0,0x97,0x35,0x97,0x35,0x97,0x36,0x97,0x37,0x97,0x37,0x97,0x36,0x97,0x35,0xc0,0xc0,0x97,0x38,0x97,0x38,0x97,0x39,0x97,0x3a,0x97,0x3a,0x97,0x39,0x97,0x38,0xc0,0xc0,0xc1,0x5,0x1a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x97,0x3b,0xd,0x97,0x3c,0xe5,0x5f,0xc3,0xc4,0xc4,0xc4,0x97,0x3d,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0x79,0xd3,0xe3,0x0,0xd0,0x97,0xc,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x8b,0x3d,0xd3,0xc6,0x94,0x3c,0xd3,0xe3,0x0,0xd0,0x97,0x1f,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x94,0x1f,0xd3,0xc6,0x8b,0x3d,0xd3,0xc6,0x93,0x7c,0xd3,0xe3,0x0,0xd0,0x97,0x31,0xd3,0xd4,0x0,0xb,0x6d,0x75,0x6c,0x74,0x69,0x61,0x73,0x73,0x69,0x67,0x6e,0x5,0x6d,0x75,0x6c,0x74,0x69,0x22,0x8b,0x2e,0x8b,0x3d,0xc2,0x1,0x9,0xc0,0xc2,0x1,0x9,0xce,0xc2,0x1,0xa,0x2e,0xc2,0x1,0xa,0x36,0xc2,0x1,0xa,0x82,0xc2,0x1,0xa,0x76,0xc2,0x1,0xa,0xb0,0xc2,0x1,0xa,0xa2,0xc2,0x1,0xb,0x0,0xc2,0x1,0xb,0x3c,0xc2,0x1,0xb,0x4a,0xc2,0x1,0xb,0x5c,0x3b,0x97,0x42,0x97,0x43,0x97,0x43,0x97,0x42,0x97,0x44,0x97,0x45,0x97,0x45,0x97,0x44,0x97,0x46,0x97,0x46,0x97,0x47,0x97,0x47,0x97,0x46,0x97,0x48,0x97,0x48,0x97,0x49,0x97,0x49,0x97,0x48,0x97,0x4a,0x97,0x4a,0x97,0x4a,0x97,0x4b,0x97,0x4c,0x97,0x4c,0x97,0x4d,0x97,0x4d,0x97,0x4b,0xc1,0x5,0x48,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x97,0x4e,0xd,0x97,0x4f,0xe5,0x81,0x2,0xc3,0xc4,0x97,0x41,0x82,0x7a,0x97,0x50,0xf0,0x2,0x8b,0x3b,0xc8,0x2,0x0,0xc6,0x8b,0x2e,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0xd,0xd3,0xc0,0xd3,0xd1,0x0,0xe0,0x1,0xc9,0x3,0x2,0xc6,0x83,0x3d,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x3c,0xd3,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x3e,0xd3,0xdc,0x0,0x0,0x4e,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x1,0xc6,0x8b,0x3f,0xd3,0xc6,0x8b,0x3e,0xd3,0xdd,0x0,0x0,0x5f,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x60,0xc2,0xe0,0x2,0xc8,0x2,0x0,0xc6,0x3e,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0x0,0x12,0x74,0x79,0x70,0x65,0x3f,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x22,0x76,0x61,0x72,0x22,0xc2,0x1,0xb,0xec,0xc2,0x1,0xb,0xfa,0xc2,0x1,0xc,0xc,0xc2,0x1,0xc,0x6e,0xc2,0x1,0xc,0x7c,0xc2,0x1,0xc,0xdc,0xc2,0x1,0xc,0xe4,0xc2,0x1,0xd,0x24,0xc2,0x1,0xd,0x16,0xc2,0x1,0xd,0x38,0xc2,0x1,0xd,0x2c,0xc2,0x1,0xd,0x7e,0x39,0x97,0x53,0x97,0x54,0x97,0x54,0x97,0x55,0x97,0x55,0x97,0x53,0x97,0x56,0x97,0x57,0x97,0x57,0x97,0x56,0x97,0x58,0x97,0x59,0x97,0x59,0x97,0x58,0x97,0x5a,0x97,0x5b,0x97,0x5c,0x97,0x5c,0x97,0x5d,0x97,0x5d,0x97,0x5c,0x97,0x5a,0x97,0x5e,0x97,0x5e,0x97,0x5e,0xc1,0x5,0x54,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x97,0x5f,0xd,0x97,0x60,0xe5,0x73,0xc3,0xc4,0x97,0x41,0x82,0x7a,0x97,0x61,0xf0,0x3,0x8e,0x6c,0xc8,0x2,0x0,0xc6,0x3e,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x8b,0x3e,0xd3,0xf0,0x2,0x8b,0x3b,0xc8,0x2,0x0,0xc6,0x8b,0x2e,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0xd,0xd3,0xc0,0xd3,0xd1,0x0,0xe0,0x1,0xc9,0x3,0x2,0xc6,0x83,0x3d,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x3c,0xd3,0xd3,0xd1,0x1,0xf1,0x2,0x5e,0xc7,0xa,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x3e,0xd3,0xc6,0x97,0x52,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xcb,0x0,0xd3,0x0,0x1,0x2e,0xc2,0x1,0xe,0x22,0x22,0x97,0x64,0x97,0x64,0xc1,0x5,0x60,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x97,0x65,0xd,0x97,0x66,0xb0,0xc3,0xc4,0xc4,0xc4,0x97,0x67,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x89,0xd,0xd3,0x0,0xc2,0x1,0xe,0xc,0xc2,0x1,0xe,0x38,0x29,0x97,0x69,0xc0,0xc0,0xc0,0xc0,0xc0,0x97,0x6a,0x97,0x6a,0x97,0x69,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x97,0x6b,0xd,0x97,0x66,0xe5,0x25,0xc3,0xc4,0xc4,0xc4,0x97,0x6c,0xe0,0x2,0xc8,0x2,0x0,0xc6,0x3e,0xe1,0x2,0xc7,0x1a,0xc6,0x97,0x63,0xe1,0x0,0xd0,0x97,0x68,0xd3,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0x0,0xe,0x61,0x73,0x73,0x69,0x67,0x6e,0x69,0x6e,0x67,0x20,0x74,0x6f,0x20,0x27,0xc2,0x1,0xf,0x7e,0x22,0x97,0x6f,0x97,0x6f,0xc1,0x5,0x66,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x97,0x70,0xd,0x97,0x71,0xb0,0xc3,0xc4,0xc4,0xc4,0x97,0x72,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x89,0xd,0xd3,0x0,0x16,0x27,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x79,0x65,0x74,0x20,0x73,0x75,0x70,0x70,0x6f,0x72,0x74,0x65,0x64,0xc2,0x1,0xf,0x12,0xc2,0x1,0xf,0x18,0xc2,0x1,0xf,0x56,0xc2,0x1,0xf,0x4c,0x2c,0x97,0x75,0x97,0x76,0x97,0x76,0x97,0x75,0x97,0x77,0x97,0x78,0xc0,0xc0,0xc0,0xc0,0xc0,0x97,0x77,0xc1,0x5,0x64,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x97,0x79,0xd,0x97,0x7a,0xe5,0x33,0xc3,0xc4,0x94,0x7a,0x82,0x7a,0x97,0x7b,0xe1,0x1,0xc9,0x3,0x1c,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x19,0xe1,0x3,0xc7,0x1a,0xc6,0x97,0x6e,0xe1,0x0,0xd0,0x97,0x73,0xd3,0xc6,0x97,0x74,0xd3,0xd3,0x0,0x21,0x94,0x1f,0x21,0x97,0x7d,0xc2,0x1,0x9,0x66,0xc2,0x1,0x9,0x5a,0xc2,0x1,0xb,0x9c,0xc2,0x1,0xb,0x90,0xc2,0x1,0xd,0xbc,0xc2,0x1,0xd,0xb0,0x37,0x97,0x7f,0x97,0x7f,0x98,0x0,0x98,0x0,0x97,0x7f,0xc0,0xc0,0x98,0x1,0x98,0x1,0x98,0x2,0x98,0x2,0x98,0x1,0xc0,0xc0,0x98,0x3,0x98,0x3,0x98,0x4,0x98,0x4,0x98,0x3,0xc0,0xc0,0xc0,0xc0,0xc1,0x5,0x44,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x98,0x5,0xd,0x98,0x6,0xe5,0x52,0xc3,0x97,0x7e,0xc4,0xc4,0x98,0x7,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0x79,0xd3,0xe3,0x0,0xd0,0x97,0x51,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x94,0x3c,0xd3,0xe3,0x0,0xd0,0x97,0x62,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x93,0x7c,0xd3,0xe3,0x0,0xd0,0x97,0x6d,0xd3,0xc0,0xe3,0x0,0xd0,0x97,0x7c,0xd3,0xd4,0x0,0xc1,0x5,0x6e,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x98,0x9,0xa8,0xc3,0xc4,0xc4,0xc4,0x98,0xa,0xc2,0x0,0xc1,0x5,0x70,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x98,0xc,0xa8,0xc3,0xc4,0xc4,0xc4,0x98,0xd,0xc2,0x0,0x62,0x88,0x71,0xc0,0x8b,0x3d,0xc0,0xc2,0x1,0x11,0xb8,0xc2,0x1,0x11,0xcc,0xc2,0x1,0x12,0x46,0xc2,0x1,0x12,0xb2,0xc2,0x1,0x13,0x48,0xc2,0x1,0x13,0x6e,0x36,0x98,0x10,0x98,0x11,0x98,0x11,0x98,0x10,0xc0,0xc0,0x98,0x12,0x98,0x12,0xc0,0xc0,0xc0,0x98,0x13,0x98,0x13,0xc0,0xc0,0xc0,0x98,0x14,0x98,0x14,0x98,0x14,0x98,0x15,0x98,0x15,0xc0,0xc1,0x5,0x74,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x98,0x16,0xd,0x98,0x17,0xe5,0x81,0x6,0xc3,0xc4,0x97,0x23,0x81,0x4b,0x98,0x18,0xe1,0x2,0xc9,0x3,0x14,0xc8,0x2,0x0,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x90,0x19,0xd3,0xd3,0xd1,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x98,0xf,0xc6,0x8b,0x3d,0xc6,0x84,0x79,0xc6,0x88,0x71,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x83,0x3d,0xc8,0x0,0x1,0xd3,0xd3,0xd1,0x1,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x5d,0xc6,0x83,0x5f,0xe0,0x0,0xc9,0x0,0x0,0xc6,0x89,0xd,0xd3,0xd3,0xd1,0x2,0xe1,0xb,0xc7,0x4,0xc6,0x97,0x21,0xc6,0x8b,0x3d,0xc6,0x97,0x20,0xc6,0x90,0x19,0xcb,0x0,0xc6,0x97,0x20,0xc6,0x97,0x22,0xc6,0x85,0x6,0xe1,0x2,0xc7,0x3,0xcb,0x2,0xcb,0x1,0xd3,0xc6,0x9,0xe8,0x0,0xc9,0x0,0x0,0xc6,0x9,0xd3,0xd3,0x0,0xc2,0x1,0x13,0xda,0xc2,0x1,0x13,0xcc,0x23,0x98,0x1a,0x98,0x1b,0x98,0x1a,0xc1,0x5,0x7c,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x98,0x1c,0xd,0x98,0x1d,0xb0,0xc3,0xc4,0xc4,0xc4,0x98,0x1e,0xf1,0x2,0x5e,0xc7,0xa,0xc1,0xc6,0x68,0xd3,0x0,0x22,0x82,0x76,0x8e,0x43,0xc2,0x1,0x10,0x66,0xc2,0x1,0x10,0x5a,0xc2,0x1,0x10,0xa2,0xc2,0x1,0x10,0x96,0xc2,0x1,0x10,0xfe,0xc2,0x1,0x10,0xf2,0xc2,0x1,0x11,0x5a,0xc2,0x1,0x11,0x4e,0x3b,0x98,0x21,0x98,0x22,0x98,0x22,0x98,0x21,0x98,0x23,0x98,0x23,0x98,0x24,0x98,0x24,0x98,0x23,0xc0,0xc0,0x98,0x25,0x98,0x25,0x98,0x26,0x98,0x26,0x98,0x25,0xc0,0xc0,0x98,0x27,0x98,0x27,0x98,0x28,0x98,0x28,0x98,0x27,0xc0,0xc0,0xc0,0xc0,0xc1,0x5,0x6a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x98,0x29,0xd,0x98,0x2a,0xe5,0x67,0xc3,0x98,0x20,0x97,0x7d,0x88,0x3d,0x98,0x2b,0xe0,0x1,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x97,0x40,0xd3,0xc6,0x83,0x3d,0xca,0x1,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0x79,0xd3,0xe3,0x0,0xd0,0x98,0xb,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x94,0x3c,0xd3,0xe3,0x0,0xd0,0x98,0xe,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x93,0x7c,0xd3,0xe3,0x0,0xd0,0x98,0x19,0xd3,0xc0,0xe3,0x0,0xd0,0x98,0x1f,0xd3,0xd4,0x0,0x7,0x61,0x73,0x73,0x69,0x67,0x6e,0x73,0x64,0x98,0x2d,0xc0,0x8b,0x3d,0xc0,0x93,0x7f,0xc0,0x89,0xf,0xc0,0x23,0x93,0x7f,0x89,0xf,0x98,0x2d,0xc2,0x1,0x8,0xb6,0xc2,0x1,0x8,0xce,0xc2,0x1,0x9,0x1c,0xc2,0x1,0x9,0x10,0xc2,0x1,0x10,0xe,0x2d,0x98,0x30,0x98,0x31,0x98,0x31,0x98,0x30,0x98,0x32,0x98,0x33,0x98,0x33,0x98,0x32,0x98,0x34,0x98,0x34,0xc0,0xc0,0xc0,0xc1,0x5,0x42,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x98,0x35,0xd,0x98,0x36,0xe5,0x5f,0xc3,0xc4,0x98,0x2f,0x81,0x4b,0x98,0x37,0xe1,0x2,0xc9,0x1,0x13,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x7f,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x97,0x40,0xd3,0xc6,0x89,0x24,0xd0,0x98,0x8,0xd3,0xd1,0x1,0xf0,0x1,0x82,0x62,0xcb,0x1,0xc6,0x89,0x24,0xd0,0x98,0x2c,0xd3,0xd1,0x2,0xe1,0x9,0xc7,0x4,0xc6,0x98,0x2e,0xc6,0x8b,0x3d,0xc6,0x97,0x3f,0xc6,0x93,0x7f,0xcb,0x0,0xc6,0x89,0xf,0xcb,0x1,0xc6,0x98,0x2d,0xcb,0x2,0xd3,0x0,0xc2,0x1,0x15,0xb0,0x22,0x98,0x39,0x98,0x39,0xc1,0x5,0x86,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x98,0x3a,0xd,0x98,0x3b,0xb0,0xc3,0x8f,0x3,0xc4,0xc4,0x98,0x3c,0xe8,0x0,0xca,0x0,0xc6,0x81,0x49,0xd3,0x0,0xc2,0x1,0x16,0x1e,0xc2,0x1,0x16,0x34,0x24,0x98,0x3e,0x98,0x3f,0x98,0x3f,0x98,0x3e,0xc1,0x5,0x88,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x98,0x40,0xd,0x98,0x41,0xb8,0xc3,0x8f,0x3,0xc4,0xc4,0x98,0x42,0xe1,0x2,0xc9,0x2,0x14,0xc8,0x1,0x0,0xe0,0x0,0xca,0x0,0xc6,0x4a,0xd3,0xd3,0x0,0xc2,0x1,0x16,0x8a,0xc2,0x1,0x16,0xa2,0x24,0x98,0x44,0x98,0x45,0x98,0x45,0x98,0x44,0xc1,0x5,0x8a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x98,0x46,0xd,0x98,0x47,0xb9,0xc3,0xc4,0xc4,0xc4,0x98,0x48,0xe1,0x2,0xc9,0x2,0x14,0xc8,0x1,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x82,0x61,0xd3,0xd3,0x0,0xc1,0x5,0x8c,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x98,0x4a,0xa8,0xc3,0xc4,0xc4,0xc4,0x98,0x4b,0xc2,0x0,0x66,0x90,0x19,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x8b,0x41,0xc0,0x82,0x61,0xc0,0x85,0x6,0xc0,0x63,0x83,0x5f,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x27,0x90,0x19,0x8b,0x41,0x85,0x6,0x82,0x61,0x8f,0x65,0x8f,0x65,0x82,0x49,0xc2,0x1,0x15,0x1c,0xc2,0x1,0x15,0x34,0xc2,0x1,0x15,0x90,0xc2,0x1,0x15,0x84,0xc2,0x1,0x15,0x78,0xc2,0x1,0x15,0x8a,0xc2,0x1,0x15,0xfe,0xc2,0x1,0x15,0xf2,0xc2,0x1,0x15,0xe6,0xc2,0x1,0x15,0xf8,0xc2,0x1,0x16,0x70,0xc2,0x1,0x17,0x3a,0xc2,0x1,0x17,0x2e,0xc2,0x1,0x17,0x70,0xc2,0x1,0x17,0x64,0xc2,0x1,0x17,0xe2,0xc2,0x1,0x17,0xfe,0xc2,0x1,0x18,0x36,0xc2,0x1,0x18,0x8a,0xc2,0x1,0x18,0x6e,0xc2,0x1,0x18,0x7c,0xc2,0x1,0x18,0xae,0xc2,0x1,0x18,0xa2,0xc2,0x1,0x18,0xdc,0xc2,0x1,0x19,0x1e,0xc2,0x1,0x19,0x12,0xc2,0x1,0x19,0x52,0xc2,0x1,0x19,0x46,0xc2,0x1,0x19,0xcc,0xc2,0x1,0x19,0xea,0xc2,0x1,0x1a,0x24,0xc2,0x1,0x1a,0x64,0xc2,0x1,0x1a,0x84,0xc2,0x1,0x1a,0xbe,0xc2,0x1,0x1a,0xfc,0xc2,0x1,0x1a,0xf6,0xc2,0x1,0x1b,0x20,0xc2,0x1,0x1b,0x14,0xc2,0x1,0x1b,0x50,0xc2,0x1,0x1b,0xd2,0xe1,0x78,0x98,0x50,0x98,0x51,0x98,0x51,0x98,0x50,0x98,0x52,0x98,0x53,0x98,0x53,0x98,0x54,0x98,0x54,0x98,0x55,0x98,0x55,0x98,0x55,0x98,0x53,0x98,0x52,0x98,0x56,0x98,0x57,0x98,0x57,0x98,0x58,0x98,0x58,0x98,0x59,0x98,0x59,0x98,0x59,0x98,0x57,0x98,0x56,0x98,0x5a,0x98,0x5a,0xc0,0xc0,0xc0,0xc0,0x98,0x5b,0x98,0x5b,0x98,0x5c,0x98,0x5c,0x98,0x5b,0x98,0x5d,0x98,0x5d,0x98,0x5e,0x98,0x5e,0x98,0x5d,0xc0,0xc0,0x98,0x5f,0x98,0x5f,0x98,0x60,0x98,0x60,0xc0,0x98,0x61,0x98,0x61,0xc0,0xc0,0x98,0x62,0x98,0x62,0x98,0x63,0x98,0x63,0x98,0x64,0x98,0x64,0x98,0x63,0x98,0x62,0x98,0x65,0x98,0x65,0x98,0x66,0x98,0x66,0x98,0x66,0x98,0x65,0x98,0x67,0x98,0x67,0xc0,0x98,0x61,0x98,0x68,0x98,0x68,0x98,0x69,0x98,0x69,0x98,0x68,0x98,0x6a,0x98,0x6a,0x98,0x6b,0x98,0x6b,0x98,0x6a,0xc0,0xc0,0x98,0x6c,0x98,0x6c,0x98,0x6d,0x98,0x6d,0xc0,0x98,0x6e,0xc0,0xc0,0x98,0x6f,0x98,0x6f,0x98,0x70,0x98,0x70,0xc0,0x98,0x6e,0x98,0x71,0x98,0x71,0xc0,0xc0,0x98,0x72,0x98,0x72,0x98,0x73,0x98,0x73,0x98,0x73,0x98,0x72,0x98,0x74,0x98,0x74,0x98,0x75,0x98,0x75,0x98,0x75,0x98,0x74,0x98,0x76,0x98,0x76,0xc0,0x98,0x71,0xc0,0xc0,0x98,0x77,0x98,0x77,0xc0,0xc1,0x5,0x84,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x98,0x78,0xd,0x98,0x79,0xe5,0x84,0xd,0xc3,0xc4,0x98,0x4f,0x94,0x4f,0x98,0x7a,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x19,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x85,0x6,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x98,0x3d,0xd3,0xd1,0x1,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x85,0x6,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x98,0x43,0xd3,0xd1,0x2,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x82,0x61,0xd3,0xe3,0x0,0xd0,0x98,0x49,0xd3,0xc0,0xe3,0x0,0xd0,0x98,0x4c,0xd3,0xd4,0xd1,0x3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x1,0xd3,0xdc,0x0,0x0,0x90,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x8c,0x77,0xd3,0xdd,0x0,0x1,0xd,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x83,0x79,0xc6,0x89,0xd,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xd1,0x4,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0xd,0xc7,0x4,0xc6,0x98,0x4d,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xcb,0x4,0xc6,0x85,0x6,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0x3,0xe0,0x0,0xcb,0x0,0xc6,0x89,0x30,0xd3,0xd3,0xcb,0x2,0xd3,0xc6,0x8b,0x41,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0x3,0xc2,0xd3,0xcb,0x1,0xd3,0xc6,0x82,0x61,0xcb,0x3,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xd3,0xdb,0x0,0x1,0xe,0xc2,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x83,0x57,0xd3,0xdc,0x0,0x1,0x32,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x8d,0x1d,0xd3,0xdd,0x0,0x1,0xd7,0xe1,0x7,0xc7,0x4,0xc6,0x8d,0x3b,0xc6,0x8b,0x3d,0xc6,0x83,0x79,0xc6,0x89,0xd,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xd1,0x5,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x98,0x4e,0xc6,0x8b,0x3d,0xc6,0x96,0x24,0xc6,0x83,0x5f,0xe0,0x0,0xcb,0x0,0xc6,0x89,0x30,0xd3,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xd3,0xd1,0x6,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0xd,0xc7,0x4,0xc6,0x98,0x4d,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xcb,0x5,0xc6,0x85,0x6,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0x3,0xcb,0x6,0xd3,0xcb,0x2,0xd3,0xc6,0x8b,0x41,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc7,0x3,0xc2,0xd3,0xcb,0x1,0xd3,0xc6,0x82,0x61,0xcb,0x3,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xd3,0xdb,0x0,0x1,0xd8,0xc2,0xe1,0xd,0xc7,0x4,0xc6,0x98,0x4d,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xcb,0x0,0xc6,0x85,0x6,0xcb,0x2,0xc6,0x8b,0x41,0xcb,0x1,0xc6,0x82,0x61,0xcb,0x3,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0x5,0x73,0x75,0x70,0x65,0x72,0x63,0x90,0x19,0xc0,0x8b,0x3d,0xc0,0x85,0x6,0xc0,0x6,0x5f,0x73,0x75,0x70,0x65,0x72,0x61,0x4a,0xc0,0x4,0x41,0x72,0x67,0x73,0x62,0x81,0x49,0xc0,0x4a,0xc0,0x8,0x63,0x61,0x6c,0x6c,0x61,0x72,0x67,0x73,0x24,0x85,0x1a,0x90,0x19,0x99,0x2,0x85,0x6,0xc2,0x1,0x1d,0x4c,0xc2,0x1,0x1d,0x40,0xc2,0x1,0x1d,0x5e,0xc2,0x1,0x1d,0xf0,0xc2,0x1,0x1d,0xe4,0xc2,0x1,0x1e,0x2,0xc2,0x1,0x1e,0x44,0xc2,0x1,0x1e,0x8e,0xc2,0x1,0x1f,0xa,0xc2,0x1,0x1e,0xfe,0xc2,0x1,0x1f,0x1c,0xc2,0x1,0x1f,0x62,0xc2,0x1,0x1f,0x96,0xc2,0x1,0x1f,0xf2,0xc2,0x1,0x20,0x56,0xc2,0x1,0x20,0xb0,0xe1,0x3d,0x99,0x4,0x99,0x5,0x99,0x6,0x99,0x6,0x99,0x4,0xc0,0xc0,0x99,0x7,0x99,0x8,0x99,0x9,0x99,0x9,0x99,0x7,0x99,0xa,0x99,0xa,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x99,0xb,0x99,0xb,0xc0,0xc0,0x99,0xa,0xc0,0xc0,0xc0,0x99,0xc,0x99,0xd,0x99,0xe,0x99,0xe,0x99,0xc,0x99,0xf,0x99,0xf,0xc0,0x99,0x10,0x99,0x10,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x99,0x11,0x99,0x11,0xc0,0xc0,0xc0,0xc0,0xc0,0x99,0x10,0x99,0x12,0xc0,0xc0,0x99,0x13,0x99,0x13,0xc0,0x99,0x12,0xc1,0x5,0xa2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x99,0x14,0xd,0x99,0x15,0xe5,0x82,0x38,0xc3,0xc4,0x99,0x3,0x8c,0x56,0x99,0x16,0xe0,0x3,0xc7,0x1e,0xc6,0x86,0x5f,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x19,0xd3,0xc6,0x89,0xd,0xc6,0x85,0x1a,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x98,0x7d,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xe0,0x3,0xc7,0x1e,0xc6,0x86,0x5f,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x19,0xd3,0xc6,0x89,0xd,0xc6,0x98,0x7e,0xd3,0xc6,0x85,0x6,0xe1,0x2,0xc7,0x3,0xe1,0x3,0xc7,0x4,0xc6,0x98,0x7f,0xc6,0x4a,0xcb,0x0,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x98,0x7f,0xc6,0x4a,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x5d,0xc6,0x83,0x5f,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x97,0x20,0xd3,0xd3,0xd3,0xd3,0xd3,0xd1,0x1,0xe1,0x7,0xc7,0x4,0xc6,0x98,0x7d,0xc6,0x8b,0x3d,0xc6,0x90,0x18,0xc6,0x90,0x19,0xe0,0x3,0xc7,0x1e,0xc6,0x86,0x5f,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x19,0xd3,0xc6,0x89,0xd,0xc6,0x99,0x0,0xd3,0xc6,0x85,0x6,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x85,0x6,0xd3,0xd3,0xd1,0x2,0xe1,0x3,0xc7,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x99,0x1,0xc6,0x4a,0xcb,0x0,0xc6,0x81,0x49,0xc6,0x85,0x1a,0xd3,0xe1,0x5,0xc7,0x4,0xc6,0x99,0x1,0xc6,0x4a,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x5d,0xc6,0x83,0x5f,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x97,0x20,0xd3,0xd3,0xc6,0x81,0x49,0xc6,0x97,0x20,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x98,0x7f,0xc6,0x4a,0xcb,0x2,0xd3,0xd3,0xd1,0x3,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe1,0xb,0xc7,0x4,0xc6,0x97,0x21,0xc6,0x8b,0x3d,0xc6,0x97,0x20,0xc6,0x97,0x20,0xc6,0x90,0x18,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xc6,0x90,0x19,0xcb,0x1,0xc6,0x85,0x6,0xcb,0x3,0xd3,0xd3,0x0,0xa,0x73,0x61,0x66,0x65,0x6d,0x65,0x74,0x68,0x6f,0x64,0xc2,0x1,0x22,0x1e,0x22,0x99,0x19,0x99,0x19,0xc1,0x5,0xb0,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x99,0x1a,0xd,0x99,0x1b,0xb0,0xc3,0x8f,0x3,0xc4,0xc4,0x99,0x1c,0xe8,0x0,0xca,0x0,0xc6,0x81,0x49,0xd3,0x0,0xc2,0x1,0x22,0x8c,0xc2,0x1,0x22,0xa2,0x24,0x99,0x1e,0x99,0x1f,0x99,0x1f,0x99,0x1e,0xc1,0x5,0xb2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x99,0x20,0xd,0x99,0x21,0xb8,0xc3,0x8f,0x3,0xc4,0xc4,0x99,0x22,0xe1,0x2,0xc9,0x2,0x14,0xc8,0x1,0x0,0xe0,0x0,0xca,0x0,0xc6,0x4a,0xd3,0xd3,0x0,0xc2,0x1,0x22,0xf8,0xc2,0x1,0x23,0x10,0x24,0x99,0x24,0x99,0x25,0x99,0x25,0x99,0x24,0xc1,0x5,0xb4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x99,0x26,0xd,0x99,0x27,0xb9,0xc3,0xc4,0xc4,0xc4,0x99,0x28,0xe1,0x2,0xc9,0x2,0x14,0xc8,0x1,0x0,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x82,0x61,0xd3,0xd3,0x0,0xc1,0x5,0xb6,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0x99,0x2a,0xa8,0xc3,0xc4,0xc4,0xc4,0x99,0x2b,0xc2,0x0,0x67,0x90,0x19,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x8b,0x41,0xc0,0x97,0x20,0xc0,0x82,0x61,0xc0,0x85,0x6,0xc0,0x24,0x90,0x19,0x8b,0x41,0x85,0x6,0x82,0x61,0xc2,0x1,0x21,0x8a,0xc2,0x1,0x21,0xa2,0xc2,0x1,0x21,0xfe,0xc2,0x1,0x21,0xf2,0xc2,0x1,0x21,0xe6,0xc2,0x1,0x21,0xf8,0xc2,0x1,0x22,0x6c,0xc2,0x1,0x22,0x60,0xc2,0x1,0x22,0x54,0xc2,0x1,0x22,0x66,0xc2,0x1,0x22,0xde,0xc2,0x1,0x23,0x9e,0xc2,0x1,0x23,0xc0,0xc2,0x1,0x24,0x14,0xe1,0x27,0x99,0x2f,0x99,0x30,0x99,0x30,0x99,0x2f,0x99,0x31,0x99,0x32,0x99,0x32,0x99,0x33,0x99,0x33,0x99,0x34,0x99,0x34,0x99,0x34,0x99,0x32,0x99,0x31,0x99,0x35,0x99,0x36,0x99,0x36,0x99,0x37,0x99,0x37,0x99,0x38,0x99,0x38,0x99,0x38,0x99,0x36,0x99,0x35,0x99,0x39,0x99,0x39,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x99,0x3a,0x99,0x3a,0x99,0x3b,0x99,0x3b,0x99,0x3c,0x99,0x3c,0xc0,0xc1,0x5,0xae,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x99,0x3d,0xd,0x99,0x3e,0xe5,0x81,0x34,0xc3,0xc4,0x99,0x2e,0x8c,0x56,0x99,0x3f,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x19,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x85,0x6,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x99,0x1d,0xd3,0xd1,0x1,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x85,0x6,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x99,0x23,0xd3,0xd1,0x2,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x82,0x61,0xd3,0xe3,0x0,0xd0,0x99,0x29,0xd3,0xc0,0xe3,0x0,0xd0,0x99,0x2c,0xd3,0xd4,0xd1,0x3,0xe1,0xf,0xc7,0x4,0xc6,0x99,0x2d,0xc6,0x8b,0x3d,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x97,0x20,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x97,0x20,0xd3,0xc6,0x90,0x19,0xcb,0x0,0xc6,0x85,0x6,0xcb,0x2,0xc6,0x8b,0x41,0xcb,0x1,0xc6,0x82,0x61,0xcb,0x3,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0x5,0x61,0x73,0x79,0x6e,0x63,0xc2,0x1,0x24,0xb0,0x22,0x99,0x42,0x99,0x42,0xc1,0x5,0xbc,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x99,0x43,0xd,0x99,0x44,0xb0,0xc3,0xc4,0xc4,0xc4,0x99,0x45,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x8f,0x0,0xd3,0x0,0xc2,0x1,0x25,0x0,0xc2,0x1,0x25,0xa,0x25,0x99,0x47,0x99,0x47,0x99,0x48,0x99,0x48,0x99,0x47,0xc1,0x5,0xbe,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x99,0x49,0xd,0x99,0x4a,0xb5,0xc3,0xc4,0xc4,0xc4,0x99,0x4b,0xe1,0x1,0xc7,0x3,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x93,0x12,0xd3,0xd3,0x0,0x63,0x8f,0x0,0xc0,0x9,0xc0,0x8b,0x3d,0xc0,0x62,0x8f,0x0,0xc0,0x8b,0x3d,0xc0,0x24,0x8f,0x0,0x8b,0x44,0x8b,0x49,0x8b,0x42,0xc2,0x1,0x24,0x96,0xc2,0x1,0x25,0x50,0xc2,0x1,0x25,0x9a,0xc2,0x1,0x25,0xe2,0x38,0x99,0x50,0x99,0x50,0xc0,0xc0,0xc0,0xc0,0x99,0x51,0xc0,0xc0,0x99,0x52,0x99,0x52,0xc0,0x99,0x51,0x99,0x53,0xc0,0xc0,0xc0,0x99,0x53,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x99,0x54,0xd,0x99,0x44,0xe5,0x81,0x12,0xc3,0xc4,0x99,0x4f,0x8c,0x56,0x99,0x55,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x8f,0x0,0xd3,0xe3,0x0,0xd0,0x99,0x46,0xd3,0xc0,0xe3,0x0,0xd0,0x99,0x4c,0xd3,0xd4,0xd1,0x0,0xe1,0x2,0xc9,0x1,0x8,0xc8,0x0,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x99,0x4d,0xc6,0x8b,0x3d,0xc6,0x89,0x30,0xc6,0x8f,0x0,0xcb,0x0,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x3e,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0x41,0xc6,0x89,0xd,0xc6,0x1a,0xc6,0x8b,0x38,0xc1,0xc6,0x8b,0x44,0xcb,0x1,0xd3,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x99,0x4e,0xc6,0x8b,0x3d,0xc6,0x99,0x41,0xc6,0x8f,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x64,0xc6,0x8b,0x3d,0xc6,0x8b,0x44,0xc6,0x8b,0x44,0xcb,0x3,0xd3,0xd3,0x0,0x63,0x9,0xc0,0x8b,0x3d,0xc0,0x93,0x12,0xc0,0x21,0x93,0x12,0xc2,0x1,0x27,0x22,0xc2,0x1,0x27,0x3a,0xc2,0x1,0x27,0x96,0x29,0x99,0x59,0x99,0x5a,0x99,0x5a,0x99,0x59,0xc0,0xc0,0x99,0x5b,0x99,0x5b,0xc0,0xc1,0x5,0xc8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x99,0x5c,0xd,0x99,0x5d,0xe5,0x3a,0xc3,0xc4,0x99,0x58,0x88,0x3d,0x99,0x5e,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x12,0xd3,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x99,0x57,0xc6,0x8b,0x3d,0xc6,0x84,0xd,0xc6,0x93,0x12,0xcb,0x0,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0xc2,0x1,0x28,0x8,0xc2,0x1,0x28,0x20,0xc2,0x1,0x28,0x78,0x29,0x99,0x60,0x99,0x61,0x99,0x61,0x99,0x60,0xc0,0xc0,0x99,0x62,0x99,0x62,0xc0,0xc1,0x5,0xce,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x99,0x63,0xd,0x99,0x64,0xe5,0x3a,0xc3,0xc4,0x99,0x58,0x88,0x3d,0x99,0x65,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x12,0xd3,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x99,0x57,0xc6,0x8b,0x3d,0xc6,0x8a,0x31,0xc6,0x93,0x12,0xcb,0x0,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0xc2,0x1,0x28,0xea,0xc2,0x1,0x29,0x2,0xc2,0x1,0x29,0x5a,0x29,0x99,0x67,0x99,0x68,0x99,0x68,0x99,0x67,0xc0,0xc0,0x99,0x69,0x99,0x69,0xc0,0xc1,0x5,0xd4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x99,0x6a,0xd,0x99,0x6b,0xe5,0x3a,0xc3,0xc4,0x99,0x58,0x88,0x3d,0x99,0x6c,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x12,0xd3,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x99,0x57,0xc6,0x8b,0x3d,0xc6,0x8a,0x62,0xc6,0x93,0x12,0xcb,0x0,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0x65,0x9,0xc0,0x8b,0x3d,0xc0,0x83,0x43,0xc0,0x93,0x12,0xc0,0x93,0x11,0xc0,0xc2,0x1,0x29,0xd0,0xc2,0x1,0x29,0xe8,0xc2,0x1,0x2a,0x1e,0xc2,0x1,0x2a,0x36,0xc2,0x1,0x2a,0x80,0xc2,0x1,0x2a,0xb2,0x2f,0x99,0x6f,0x99,0x70,0x99,0x70,0x99,0x6f,0x99,0x71,0x99,0x72,0x99,0x72,0x99,0x71,0xc0,0xc0,0x99,0x73,0x99,0x73,0x99,0x74,0x99,0x74,0xc0,0xc1,0x5,0xda,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x99,0x75,0xd,0x99,0x76,0xe5,0x5f,0xc3,0xc4,0x93,0x14,0x82,0x7a,0x99,0x77,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x11,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x12,0xd3,0xd3,0xd1,0x1,0xe1,0xb,0xc7,0x4,0xc6,0x99,0x6e,0xc6,0x8b,0x3d,0xc6,0x83,0x43,0xc6,0x83,0x43,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x83,0x43,0xd3,0xc6,0x93,0x11,0xcb,0x0,0xc6,0x93,0x12,0xcb,0x1,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0x22,0xc0,0x9,0xc2,0x1,0x2b,0x22,0xc2,0x1,0x2b,0x2e,0xc2,0x1,0x2b,0x40,0xc2,0x1,0x2b,0x5e,0x29,0x99,0x7a,0x99,0x7a,0x99,0x7b,0x99,0x7c,0x99,0x7c,0x99,0x7d,0x99,0x7d,0x99,0x7b,0x99,0x7a,0xc1,0x5,0xe2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x99,0x7e,0xd,0x99,0x7f,0xe5,0x2a,0xc3,0xc4,0xc4,0xc4,0x9a,0x0,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xf0,0x2,0x99,0x79,0xc8,0x0,0x0,0xc6,0x8b,0x2e,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x89,0xd,0xd3,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xd3,0x0,0x6,0x76,0x61,0x72,0x72,0x65,0x66,0xc2,0x1,0x2b,0xd4,0xc2,0x1,0x2b,0xe0,0xc2,0x1,0x2b,0xf2,0x27,0x9a,0x3,0x9a,0x3,0x9a,0x4,0x9a,0x5,0x9a,0x5,0x9a,0x4,0x9a,0x3,0xc1,0x5,0xe6,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9a,0x6,0xd,0x9a,0x7,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x9a,0x8,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x8b,0x2e,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x89,0xd,0xd3,0xd3,0xd3,0x0,0xa,0x73,0x65,0x74,0x66,0x69,0x65,0x6c,0x64,0x6f,0x70,0x63,0x90,0x19,0xc0,0x8b,0x3d,0xc0,0x97,0x20,0xc0,0x64,0x8b,0x3d,0xc0,0x83,0x43,0xc0,0x93,0x12,0xc0,0x93,0x11,0xc0,0x24,0x90,0x19,0x93,0x11,0x93,0x12,0x83,0x43,0xc2,0x1,0x2c,0x7e,0xc2,0x1,0x2c,0x96,0xc2,0x1,0x2d,0x0,0xc2,0x1,0x2d,0x4c,0xc2,0x1,0x2d,0x6c,0xc2,0x1,0x2d,0x64,0xc2,0x1,0x2d,0xba,0xc2,0x1,0x2e,0x34,0xc2,0x1,0x2e,0x66,0xc2,0x1,0x2e,0x8e,0xe1,0x21,0x9a,0xe,0x9a,0xf,0x9a,0xf,0x9a,0xe,0xc0,0xc0,0x9a,0x10,0x9a,0x10,0xc0,0x9a,0x11,0x9a,0x12,0x9a,0x13,0x9a,0x13,0x9a,0x12,0x9a,0x11,0xc0,0xc0,0x9a,0x14,0x9a,0x14,0xc0,0xc0,0xc0,0x9a,0x15,0x9a,0x15,0xc0,0xc0,0x9a,0x16,0x9a,0x16,0xc0,0x9a,0x15,0x9a,0x17,0x9a,0x17,0xc0,0xc1,0x5,0xea,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9a,0x18,0xd,0x9a,0x19,0xe5,0x81,0x43,0xc3,0xc4,0x9a,0xd,0x8c,0x56,0x9a,0x1a,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x90,0x19,0xd3,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x9a,0xb,0xc6,0x8b,0x3d,0xc6,0x97,0x20,0xc6,0x97,0x20,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x7c,0xd3,0xc6,0x90,0x19,0xcb,0x0,0xd3,0xd1,0x1,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x12,0xd3,0xc6,0x4a,0xd3,0xd3,0xd1,0x2,0xe1,0x9,0xc7,0x4,0xc6,0x9a,0xc,0xc6,0x8b,0x3d,0xc6,0x83,0x43,0xc6,0x83,0x43,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x83,0x43,0xd3,0xc6,0x93,0x11,0xcb,0x1,0xc6,0x93,0x12,0xcb,0x2,0xd3,0xd1,0x3,0xe1,0xb,0xc7,0x4,0xc6,0x97,0x21,0xc6,0x8b,0x3d,0xc6,0x97,0x20,0xc6,0x97,0x20,0xc6,0x97,0x22,0xc6,0x85,0x6,0xe1,0x2,0xc7,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x4c,0xc6,0x8b,0x3d,0xc6,0x5d,0xc6,0x83,0x5f,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x7c,0xd3,0xd3,0xcb,0x3,0xd3,0xc6,0x9,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xc6,0x90,0x19,0xcb,0x0,0xd3,0x0,0x8,0x61,0x73,0x73,0x69,0x67,0x6e,0x6f,0x70,0x1,0x27,0xc2,0x1,0x30,0xbe,0x22,0x9a,0x1e,0x9a,0x1e,0xc1,0x5,0xfe,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9a,0x1f,0xd,0x9a,0x20,0xb0,0xc3,0xc4,0xc4,0xc4,0x9a,0x21,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x94,0x1f,0xd3,0x0,0xa,0x27,0x20,0x6f,0x6e,0x20,0x6c,0x69,0x6e,0x65,0x20,0x11,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x61,0x20,0x6d,0x75,0x74,0x61,0x62,0x6c,0x65,0x63,0x90,0x19,0xc0,0x8b,0x3d,0xc0,0x93,0x7f,0xc0,0x25,0x8b,0x2e,0xd,0x94,0x4d,0x93,0x12,0x93,0x7f,0x25,0xc1,0xc1,0xc1,0xc1,0xc1,0xc2,0x1,0x2f,0x24,0xc2,0x1,0x2f,0x36,0xc2,0x1,0x2f,0x70,0xc2,0x1,0x2f,0x64,0xc2,0x1,0x2f,0xa2,0xc2,0x1,0x2f,0x94,0xc2,0x1,0x30,0x6c,0xc2,0x1,0x30,0x76,0xc2,0x1,0x30,0xac,0xc2,0x1,0x30,0xa2,0xc2,0x1,0x31,0x34,0xc2,0x1,0x31,0x4c,0xc2,0x1,0x31,0xa8,0xe1,0x26,0x9a,0x28,0x9a,0x29,0x9a,0x29,0x9a,0x28,0x9a,0x2a,0x9a,0x2a,0x9a,0x2b,0x9a,0x2b,0x9a,0x2a,0x9a,0x2c,0x9a,0x2c,0x9a,0x2d,0x9a,0x2d,0x9a,0x2c,0x9a,0x2e,0x9a,0x2f,0x9a,0x2f,0x9a,0x2e,0x9a,0x30,0x9a,0x31,0xc0,0xc0,0xc0,0xc0,0xc0,0x9a,0x30,0x9a,0x32,0x9a,0x33,0x9a,0x33,0x9a,0x32,0xc0,0xc0,0x9a,0x34,0x9a,0x34,0xc0,0xc0,0xc0,0xc0,0xc1,0x5,0xf6,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9a,0x35,0xd,0x9a,0x36,0xe5,0x81,0x4b,0xc3,0xc4,0x9a,0x26,0x9a,0x27,0x9a,0x37,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x8b,0x2e,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x94,0x1f,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x83,0x79,0xd3,0xdc,0x0,0x0,0x38,0xe1,0x2,0xc7,0x20,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x3f,0xd3,0xc6,0x8b,0x3e,0xd3,0xdd,0x0,0x0,0x6f,0xe1,0x1,0xc9,0x1,0x1c,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0xd2,0x0,0x1,0xd2,0x1,0x2,0xe1,0x1,0xc7,0x19,0xe1,0x5,0xc7,0x1a,0xc6,0x9a,0x1d,0xe1,0x0,0xd0,0x9a,0x22,0xd3,0xc6,0x9a,0x23,0xcb,0x1,0xc6,0x9a,0x24,0xd3,0xd3,0xdb,0x0,0x0,0x70,0xc2,0xe1,0x2,0xc9,0x1,0x14,0xc8,0x0,0x0,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x93,0x7f,0xd3,0xd3,0xd1,0x3,0xe1,0x9,0xc7,0x4,0xc6,0x9a,0xc,0xc6,0x8b,0x3d,0xc6,0x83,0x43,0xc6,0x83,0x43,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x83,0x43,0xd3,0xc6,0x93,0x11,0xcb,0x0,0xc6,0x93,0x12,0xcb,0x3,0xd3,0xd1,0x4,0xe1,0x7,0xc7,0x4,0xc6,0x9a,0x25,0xc6,0x8b,0x3d,0xc6,0x96,0x68,0xc6,0x90,0x19,0xcb,0x0,0xc6,0x93,0x7f,0xcb,0x4,0xd3,0x0,0xc2,0x1,0x32,0xd2,0x22,0x9a,0x39,0x9a,0x39,0xc1,0x6,0x8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9a,0x3a,0xd,0x9a,0x3b,0xb3,0xc3,0x90,0x2c,0xc4,0xc4,0x9a,0x3c,0xe1,0x2,0xc9,0x2,0x14,0xc8,0x1,0x0,0xca,0x0,0xd3,0x0,0xc2,0x1,0x32,0xb2,0xc2,0x1,0x32,0xa6,0xc2,0x1,0x32,0x9a,0xc2,0x1,0x32,0xac,0xc2,0x1,0x33,0x42,0x2f,0x9a,0x3e,0x9a,0x3f,0x9a,0x3f,0x9a,0x40,0x9a,0x40,0x9a,0x41,0x9a,0x41,0x9a,0x41,0x9a,0x3f,0x9a,0x3e,0xc0,0xc0,0x9a,0x42,0x9a,0x42,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9a,0x43,0xd,0x9a,0x3b,0xe5,0x46,0xc3,0xc4,0x93,0x5b,0x88,0x3d,0x9a,0x44,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x83,0x5f,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x9a,0x3d,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x98,0x4e,0xc6,0x8b,0x3d,0xc6,0x96,0x24,0xc6,0x83,0x5f,0xcb,0x0,0xc6,0x9,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x9,0xd3,0xd3,0x0,0xc2,0x1,0x34,0xf8,0xc2,0x1,0x35,0x4,0xc2,0x1,0x35,0x4a,0xc2,0x1,0x35,0x54,0xc2,0x1,0x35,0x60,0xc2,0x1,0x35,0x6c,0xc2,0x1,0x35,0x86,0x2f,0x9a,0x46,0x9a,0x47,0x9a,0x47,0x9a,0x46,0x9a,0x48,0x9a,0x49,0x9a,0x49,0x9a,0x4a,0x9a,0x4a,0x9a,0x4b,0x9a,0x4c,0x9a,0x4c,0x9a,0x4b,0x9a,0x49,0x9a,0x48,0xc1,0x6,0x16,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9a,0x4d,0xd,0x9a,0x4e,0xe5,0x41,0xc3,0xc4,0xc4,0xc4,0x9a,0x4f,0xe0,0x2,0xc9,0x1,0x0,0xc6,0x86,0x5f,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x81,0x49,0xd3,0xc2,0xd3,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x3e,0xe1,0x2,0xc7,0x3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x81,0x49,0xd3,0xe1,0x2,0xc9,0x3,0x14,0xc8,0x2,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x4a,0xd3,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x36,0x5c,0xc2,0x1,0x36,0x66,0xc2,0x1,0x36,0xba,0xc2,0x1,0x36,0xc4,0xc2,0x1,0x36,0xce,0xc2,0x1,0x36,0xe2,0x2d,0x9a,0x51,0x9a,0x52,0x9a,0x52,0x9a,0x51,0x9a,0x53,0x9a,0x54,0x9a,0x54,0x9a,0x55,0x9a,0x55,0x9a,0x56,0x9a,0x56,0x9a,0x54,0x9a,0x53,0xc1,0x6,0x1c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9a,0x57,0xd,0x9a,0x58,0xe5,0x3a,0xc3,0x90,0x2c,0xc4,0xc4,0x9a,0x59,0xe0,0x2,0xc9,0x2,0x0,0xc6,0x86,0x5f,0xe0,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xc2,0xd3,0xe0,0x1,0xc9,0x2,0x1,0xc6,0x3e,0xe1,0x2,0xc7,0x3,0xe0,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xe1,0x2,0xc9,0x4,0x14,0xc8,0x3,0x0,0xca,0x0,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x36,0xa,0xc2,0x1,0x35,0xfe,0x24,0x9a,0x5b,0x9a,0x5c,0x9a,0x5c,0x9a,0x5b,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9a,0x5d,0xd,0x9a,0x58,0xbb,0xc3,0xc4,0xc4,0xc4,0x9a,0x5e,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x41,0xd3,0xc6,0x82,0x63,0xd0,0x9a,0x5a,0xd3,0x0,0x5,0x65,0x6e,0x74,0x72,0x79,0x21,0x9a,0x60,0x21,0x9a,0x61,0xc2,0x1,0x34,0xbe,0x26,0x9a,0x63,0x9a,0x63,0xc0,0xc0,0xc0,0xc0,0xc1,0x6,0x12,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9a,0x64,0xd,0x9a,0x65,0xbe,0xc3,0x9a,0x62,0xc4,0xc4,0x9a,0x66,0xe8,0x0,0xca,0x0,0xc6,0x81,0x49,0xd3,0xe3,0x0,0xd0,0x9a,0x50,0xd3,0xc0,0xe3,0x0,0xd0,0x9a,0x5f,0xd3,0xd4,0x0,0x22,0x89,0x24,0x96,0x1f,0xc2,0x1,0x33,0xf2,0xc2,0x1,0x33,0xe4,0xc2,0x1,0x34,0x2c,0xc2,0x1,0x34,0x22,0xc2,0x1,0x34,0x70,0xc2,0x1,0x34,0x64,0xc2,0x1,0x34,0x58,0xc2,0x1,0x34,0x6a,0xc2,0x1,0x37,0xf6,0xc2,0x1,0x38,0x22,0x37,0x9a,0x69,0x9a,0x6a,0x9a,0x69,0x9a,0x6b,0x9a,0x6c,0x9a,0x6b,0x9a,0x6d,0x9a,0x6e,0x9a,0x6e,0x9a,0x6f,0x9a,0x6f,0x9a,0x70,0x9a,0x70,0x9a,0x70,0x9a,0x6e,0x9a,0x6d,0xc0,0xc0,0x9a,0x71,0x9a,0x71,0x9a,0x72,0x9a,0x72,0xc0,0xc1,0x6,0xe,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9a,0x73,0xd,0x9a,0x74,0xe5,0x5f,0xc3,0xc4,0x9a,0x68,0x82,0x7a,0x9a,0x75,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xd1,0x0,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xd1,0x1,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x1,0xc6,0x83,0x5f,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x82,0x63,0xd0,0x9a,0x67,0xd3,0xe1,0x7,0xc7,0x4,0xc6,0x96,0x20,0xc6,0x8b,0x3d,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x96,0x1f,0xcb,0x1,0xc6,0x89,0x24,0xe0,0x0,0xcb,0x0,0xc6,0x95,0x72,0xd3,0xd3,0x0,0x6,0x67,0x75,0x61,0x72,0x64,0x73,0x62,0x92,0x37,0xc0,0x82,0x61,0xc0,0x5,0x67,0x75,0x61,0x72,0x64,0x21,0x9a,0x79,0x21,0x9a,0x7a,0x25,0x92,0x37,0x8b,0x44,0x8b,0x49,0x8b,0x42,0x82,0x61,0xc2,0x1,0x39,0x0,0xc2,0x1,0x39,0x28,0xc2,0x1,0x39,0x1c,0xc2,0x1,0x39,0x82,0xc2,0x1,0x39,0xc2,0xc2,0x1,0x39,0xe2,0xc2,0x1,0x3a,0x32,0x3b,0x9a,0x7d,0x9a,0x7e,0x9a,0x7e,0x9a,0x7f,0x9a,0x7f,0x9a,0x7e,0x9a,0x7d,0x9b,0x0,0xc0,0xc0,0x9b,0x1,0x9b,0x1,0x9b,0x2,0x9b,0x2,0xc0,0x9b,0x0,0x9b,0x3,0xc0,0xc0,0xc0,0x9b,0x3,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc1,0x6,0x2a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9b,0x4,0xd,0x9b,0x5,0xe5,0x81,0x1d,0xc3,0x9a,0x7b,0x9a,0x7c,0x9a,0x27,0x9b,0x6,0xe1,0x2,0xc9,0x2,0x14,0xc8,0x1,0x0,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xca,0x0,0xc6,0x92,0x37,0xd3,0xc6,0x84,0x20,0xd3,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x2,0x8,0xc8,0x1,0x0,0xe1,0x7,0xc7,0x4,0xc6,0x99,0x4d,0xc6,0x8b,0x3d,0xc6,0x82,0x61,0xc6,0x8f,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8f,0x0,0xd3,0xc6,0x9,0xe0,0x0,0xca,0x0,0xc6,0x9,0xd3,0xd3,0xd3,0xd1,0x1,0xe0,0x1,0xc9,0x2,0x1,0xc6,0x3e,0xe1,0x7,0xc7,0x4,0xc6,0x8e,0x41,0xc6,0x89,0xd,0xc6,0x1a,0xc6,0x8b,0x38,0xc1,0xc6,0x8b,0x44,0xcb,0x1,0xd3,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe1,0x5,0xc7,0x4,0xc6,0x93,0x64,0xc6,0x8b,0x3d,0xc6,0x8b,0x44,0xc6,0x8b,0x44,0xcb,0x3,0xd3,0xd1,0x4,0xe1,0x5,0xc7,0x4,0xc6,0x9a,0x78,0xc6,0x92,0x37,0xcb,0x0,0xc6,0x82,0x61,0xcb,0x4,0xd3,0x0,0x62,0x9a,0x77,0xc0,0x8b,0x3d,0xc0,0x2,0x67,0x73,0x21,0x9b,0x9,0xc2,0x1,0x38,0xb0,0xc2,0x1,0x38,0xa2,0x27,0x9b,0xb,0x9b,0xc,0x9b,0xc,0x9b,0xb,0xc0,0xc0,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9b,0xd,0xd,0x9b,0x5,0xe5,0x32,0xc3,0xc4,0x9b,0xa,0x88,0x3d,0x9b,0xe,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x1,0xc6,0x9a,0x77,0xd3,0xc6,0x89,0x24,0xd0,0x9b,0x7,0xd3,0xd1,0x0,0xe1,0x5,0xc7,0x4,0xc6,0x9b,0x8,0xc6,0x8b,0x3d,0xc6,0x9a,0x77,0xc6,0x9a,0x77,0xcb,0x0,0xd3,0x0,0x5,0x70,0x72,0x69,0x6e,0x74,0x5,0x45,0x52,0x52,0x4f,0x52,0xd,0x75,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x74,0x65,0x72,0x6d,0x20,0xc2,0x1,0x3c,0x74,0x22,0x9b,0x13,0x9b,0x13,0xc1,0x6,0x40,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9b,0x14,0xd,0x9b,0x15,0xb0,0xc3,0xc4,0xc4,0xc4,0x9b,0x16,0xe0,0x0,0xc8,0x1,0x1,0xc6,0x8b,0x3d,0xd3,0x0,0xc2,0x1,0x3b,0xdc,0xc2,0x1,0x3b,0xd2,0xc2,0x1,0x3c,0x10,0xc2,0x1,0x3c,0x6,0xc2,0x1,0x3c,0x1a,0xc2,0x1,0x3c,0x12,0xc2,0x1,0x3c,0x4a,0xc2,0x1,0x3c,0x40,0x31,0x9b,0x18,0x9b,0x19,0x9b,0x18,0x9b,0x1a,0x9b,0x1b,0x9b,0x1c,0x9b,0x1d,0x9b,0x1c,0x9b,0x1a,0x9b,0x1e,0x9b,0x1f,0xc0,0xc0,0xc0,0xc0,0xc0,0x9b,0x1e,0xc1,0x6,0x3c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9b,0x20,0xd,0x9b,0x21,0xe5,0x2f,0xc3,0xc4,0xc4,0xc4,0x9b,0x22,0xe1,0x1,0xc7,0x25,0xc6,0x9b,0x11,0xd3,0xe1,0x1,0xc7,0x25,0xe1,0x1,0xc7,0x1b,0xc8,0x0,0x1,0xd3,0xd3,0xe1,0x1,0xc7,0x19,0xe1,0x2,0xc7,0x1a,0xc6,0x9b,0x12,0xe1,0x0,0xd0,0x9b,0x17,0xd3,0xd3,0xd3,0x0,0x3,0x6c,0x65,0x78,0xc1,0xc5,0x44,0xc1,0xc5,0xa2,0xc1,0xc5,0x96,0xc1,0xc6,0xa8,0xc1,0xc6,0xb8,0xc1,0xc7,0x14,0xc1,0xc7,0x8,0xc1,0xc7,0x6c,0xc1,0xc7,0x60,0xc1,0xc9,0xc4,0xc1,0xc9,0xb8,0xc1,0xcb,0x8c,0xc1,0xcb,0x70,0xc1,0xcb,0x64,0xc1,0xcb,0xa6,0xc1,0xcb,0x9a,0xc1,0xcc,0xfe,0xc1,0xcc,0xf2,0xc1,0xfe,0xcc,0xc1,0xfe,0xc0,0xc2,0x1,0x7,0xd0,0xc2,0x1,0x7,0xc4,0xc2,0x1,0x14,0xd2,0xc2,0x1,0x14,0xc6,0xc2,0x1,0x1c,0x1e,0xc2,0x1,0x1c,0x6,0xc2,0x1,0x1b,0xfa,0xc2,0x1,0x1c,0x48,0xc2,0x1,0x1c,0x3c,0xc2,0x1,0x1c,0x2e,0xc2,0x1,0x21,0x1a,0xc2,0x1,0x21,0x2,0xc2,0x1,0x20,0xf6,0xc2,0x1,0x21,0x34,0xc2,0x1,0x21,0x28,0xc2,0x1,0x24,0x48,0xc2,0x1,0x24,0x3c,0xc2,0x1,0x26,0xe0,0xc2,0x1,0x26,0xd4,0xc2,0x1,0x27,0xca,0xc2,0x1,0x27,0xbe,0xc2,0x1,0x28,0xac,0xc2,0x1,0x28,0xa0,0xc2,0x1,0x29,0x8e,0xc2,0x1,0x29,0x82,0xc2,0x1,0x2a,0xe6,0xc2,0x1,0x2a,0xda,0xc2,0x1,0x2b,0x92,0xc2,0x1,0x2b,0x86,0xc2,0x1,0x2c,0x28,0xc2,0x1,0x2c,0x1c,0xc2,0x1,0x2e,0xd4,0xc2,0x1,0x2e,0xc8,0xc2,0x1,0x32,0x50,0xc2,0x1,0x32,0x44,0xc2,0x1,0x33,0x8e,0xc2,0x1,0x33,0x76,0xc2,0x1,0x33,0x6a,0xc2,0x1,0x33,0xa8,0xc2,0x1,0x33,0x9c,0xc2,0x1,0x38,0x5a,0xc2,0x1,0x38,0x4e,0xe1,0x81,0x4f,0x9b,0x25,0x9b,0x25,0x9b,0x25,0xc0,0xc0,0x9b,0x26,0x9b,0x27,0x9b,0x26,0xc0,0xc0,0x9b,0x28,0x9b,0x28,0x9b,0x29,0x9b,0x29,0x9b,0x28,0xc0,0xc0,0x9b,0x2a,0x9b,0x2a,0x9b,0x2b,0x9b,0x2b,0x9b,0x2a,0xc0,0xc0,0x9b,0x2c,0x9b,0x2c,0x9b,0x2d,0x9b,0x2d,0x9b,0x2c,0xc0,0xc0,0x9b,0x2e,0x9b,0x2e,0x9b,0x2f,0x9b,0x2f,0x9b,0x2e,0xc0,0xc0,0x9b,0x30,0x9b,0x30,0x9b,0x31,0x9b,0x31,0x9b,0x32,0x9b,0x32,0x9b,0x31,0x9b,0x33,0x9b,0x33,0x9b,0x34,0x9b,0x34,0x9b,0x33,0x9b,0x30,0xc0,0xc0,0x9b,0x35,0x9b,0x35,0x9b,0x36,0x9b,0x36,0x9b,0x35,0xc0,0xc0,0x9b,0x37,0x9b,0x37,0x9b,0x38,0x9b,0x38,0x9b,0x37,0xc0,0xc0,0x9b,0x39,0x9b,0x39,0x9b,0x3a,0x9b,0x3a,0x9b,0x39,0xc0,0xc0,0x9b,0x3b,0x9b,0x3b,0x9b,0x3c,0x9b,0x3c,0x9b,0x3b,0xc0,0xc0,0x9b,0x3d,0x9b,0x3d,0x9b,0x3e,0x9b,0x3e,0x9b,0x3f,0x9b,0x3f,0x9b,0x3e,0x9b,0x40,0x9b,0x40,0x9b,0x41,0x9b,0x42,0x9b,0x42,0x9b,0x41,0x9b,0x40,0x9b,0x3d,0xc0,0xc0,0x9b,0x43,0x9b,0x43,0x9b,0x44,0x9b,0x44,0x9b,0x45,0x9b,0x45,0x9b,0x44,0x9b,0x46,0x9b,0x46,0x9b,0x47,0x9b,0x47,0x9b,0x46,0x9b,0x43,0xc0,0xc0,0x9b,0x48,0x9b,0x48,0x9b,0x49,0x9b,0x49,0x9b,0x48,0xc0,0xc0,0x9b,0x4a,0x9b,0x4a,0x9b,0x4b,0x9b,0x4b,0x9b,0x4a,0xc0,0xc0,0x9b,0x4c,0x9b,0x4c,0x9b,0x4d,0x9b,0x4d,0x9b,0x4c,0xc0,0xc0,0x9b,0x4e,0x9b,0x4e,0x9b,0x4f,0x9b,0x4f,0x9b,0x4e,0xc0,0xc0,0x9b,0x50,0x9b,0x50,0x9b,0x51,0x9b,0x51,0x9b,0x50,0xc0,0xc0,0x9b,0x52,0x9b,0x52,0x9b,0x53,0x9b,0x53,0x9b,0x52,0xc0,0xc0,0x9b,0x54,0x9b,0x54,0x9b,0x55,0x9b,0x55,0x9b,0x54,0xc0,0xc0,0x9b,0x56,0x9b,0x56,0x9b,0x57,0x9b,0x57,0x9b,0x56,0xc0,0xc0,0x9b,0x58,0x9b,0x58,0x9b,0x59,0x9b,0x59,0x9b,0x58,0xc0,0xc0,0x9b,0x5a,0x9b,0x5a,0x9b,0x5b,0x9b,0x5b,0x9b,0x5a,0xc0,0xc0,0x9b,0x5c,0x9b,0x5c,0x9b,0x5d,0x9b,0x5d,0x9b,0x5e,0x9b,0x5e,0x9b,0x5d,0x9b,0x5f,0x9b,0x5f,0x9b,0x60,0x9b,0x60,0x9b,0x5f,0x9b,0x5c,0xc0,0xc0,0x9b,0x61,0x9b,0x61,0x9b,0x62,0x9b,0x62,0x9b,0x61,0xc0,0xc0,0xc0,0xc0,0xc1,0x4,0x4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9b,0x63,0xd,0x9b,0x64,0xe5,0x84,0x7c,0x9b,0x24,0x93,0x25,0xc4,0xc4,0x9b,0x65,0xe1,0x2,0xc7,0x0,0xca,0x1,0xc2,0xd3,0xe3,0x0,0xd0,0x93,0x38,0xd3,0xe1,0x1,0xc7,0x23,0xca,0x1,0xd3,0xe3,0x0,0xd0,0x93,0x44,0xd3,0xe1,0x1,0xc7,0x18,0xe8,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xd3,0xe3,0x0,0xd0,0x93,0x47,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x5d,0xd3,0xe3,0x0,0xd0,0x93,0x4a,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x93,0x4b,0xd3,0xe3,0x0,0xd0,0x93,0x62,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x89,0x30,0xd3,0xe3,0x0,0xd0,0x93,0x6b,0xd3,0xe1,0x2,0xc7,0x1f,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x44,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x82,0x61,0xd3,0xd3,0xe3,0x0,0xd0,0x93,0x72,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x63,0xd3,0xe3,0x0,0xd0,0x96,0x66,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x94,0x1e,0xd3,0xe3,0x0,0xd0,0x97,0x3e,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x97,0x3f,0xd3,0xe3,0x0,0xd0,0x98,0x38,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x90,0x18,0xd3,0xe3,0x0,0xd0,0x98,0x7b,0xd3,0xe1,0x2,0xc7,0x5,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x97,0x20,0xd3,0xe1,0x2,0xc7,0x0,0xe8,0x0,0xe0,0x0,0xca,0x1,0xc6,0x90,0x19,0xd3,0xc6,0x89,0xd,0xd3,0xc6,0x98,0x7c,0xd3,0xd3,0xe3,0x0,0xd0,0x99,0x17,0xd3,0xe1,0x2,0xc7,0x1f,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x97,0x20,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x99,0x18,0xd3,0xd3,0xe3,0x0,0xd0,0x99,0x40,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x99,0x41,0xd3,0xe3,0x0,0xd0,0x99,0x56,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0xd,0xd3,0xe3,0x0,0xd0,0x99,0x5f,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x8a,0x31,0xd3,0xe3,0x0,0xd0,0x99,0x66,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x8a,0x62,0xd3,0xe3,0x0,0xd0,0x99,0x6d,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x83,0x43,0xd3,0xe3,0x0,0xd0,0x99,0x78,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x2e,0xd3,0xe3,0x0,0xd0,0x9a,0x1,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x9a,0x2,0xd3,0xe3,0x0,0xd0,0x9a,0x9,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x9a,0xa,0xd3,0xe3,0x0,0xd0,0x9a,0x1b,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x9a,0x1c,0xd3,0xe3,0x0,0xd0,0x9a,0x38,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x96,0x24,0xd3,0xe3,0x0,0xd0,0x9a,0x45,0xd3,0xe1,0x2,0xc7,0x1f,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x96,0x21,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x89,0x24,0xd3,0xd3,0xe3,0x0,0xd0,0x9a,0x76,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x1,0xc6,0x8b,0x3d,0xd3,0xc6,0x9a,0x77,0xd3,0xe3,0x0,0xd0,0x9b,0xf,0xd3,0xc0,0xe3,0x0,0xd0,0x9b,0x23,0xd3,0xd4,0x0,0x9,0x75,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0xc2,0x1,0x3c,0xee,0x23,0x9b,0x68,0x9b,0x68,0x9b,0x68,0xc1,0x6,0x46,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9b,0x69,0xd,0x9b,0x6a,0xaf,0xc3,0xc4,0xc4,0xc4,0x9b,0x6b,0xe1,0x1,0xc7,0x3,0xc6,0x84,0x34,0xd3,0x0,0xc2,0x1,0x3d,0x44,0x23,0x9b,0x6d,0x9b,0x6d,0x9b,0x6d,0xc1,0x6,0x48,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9b,0x6e,0xd,0x9b,0x6f,0xaf,0xc3,0xc4,0xc4,0xc4,0x9b,0x70,0xe1,0x1,0xc7,0x3,0xc6,0x84,0x2d,0xd3,0x0,0xc2,0x1,0x3d,0x98,0x23,0x9b,0x72,0x9b,0x72,0x9b,0x72,0xc1,0x6,0x4a,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9b,0x73,0xd,0x9b,0x74,0xae,0xc3,0xc4,0xc4,0xc4,0x9b,0x75,0xe1,0x1,0xc7,0x3,0xc6,0x68,0xd3,0x0,0xc2,0x1,0x3d,0xee,0x23,0x9b,0x77,0x9b,0x77,0x9b,0x77,0xc1,0x6,0x4c,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9b,0x78,0xd,0x9b,0x79,0xaf,0xc3,0xc4,0xc4,0xc4,0x9b,0x7a,0xe1,0x1,0xc7,0x3,0xc6,0x84,0x20,0xd3,0x0,0x8,0x69,0x73,0x4e,0x75,0x6d,0x62,0x65,0x72,0x7,0x69,0x73,0x46,0x6c,0x6f,0x61,0x74,0xc2,0x1,0x3e,0x76,0x23,0x9b,0x7e,0x9b,0x7e,0x9b,0x7e,0xc1,0x6,0x50,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9b,0x7f,0xd,0x9c,0x0,0xb2,0xc3,0xc4,0xc4,0xc4,0x9c,0x1,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x5f,0xc8,0x1,0x0,0xd3,0x0,0xc2,0x1,0x3e,0xd2,0x23,0x9c,0x3,0x9c,0x3,0x9c,0x3,0xc1,0x6,0x52,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x4,0xd,0x9c,0x5,0xb2,0xc3,0xc4,0xc4,0xc4,0x9c,0x6,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x5f,0xc8,0x1,0x0,0xd3,0x0,0xc2,0x1,0x3f,0x2e,0x23,0x9c,0x8,0x9c,0x8,0x9c,0x8,0xc1,0x6,0x54,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x9,0xd,0x9c,0xa,0xb2,0xc3,0xc4,0xc4,0xc4,0x9c,0xb,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x5f,0xc8,0x1,0x0,0xd3,0x0,0xc2,0x1,0x3f,0x8a,0x23,0x9c,0xd,0x9c,0xd,0x9c,0xd,0xc1,0x6,0x56,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0xe,0xd,0x9c,0xf,0xb2,0xc3,0xc4,0xc4,0xc4,0x9c,0x10,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x3b,0xc8,0x1,0x0,0xd3,0x0,0xc2,0x1,0x3e,0x62,0xc2,0x1,0x3e,0x54,0xc2,0x1,0x3e,0xba,0xc2,0x1,0x3f,0x16,0xc2,0x1,0x3f,0x1e,0x34,0x9c,0x12,0x9c,0x13,0x9c,0x12,0xc0,0xc0,0x9c,0x14,0x9c,0x14,0x9c,0x14,0xc0,0xc0,0x9c,0x15,0x9c,0x15,0x9c,0x16,0x9c,0x16,0x9c,0x16,0x9c,0x15,0xc0,0xc0,0xc0,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9c,0x17,0xd,0x9c,0x0,0xe5,0x44,0xc3,0xc4,0xc4,0xc4,0x9c,0x18,0xe1,0x1,0xc7,0x27,0xc8,0x0,0x0,0xd3,0xe3,0x0,0xd0,0x9c,0x2,0xd3,0xe1,0x2,0xc7,0xb,0xc8,0x0,0x0,0xc4,0x0,0xd3,0xe3,0x0,0xd0,0x9c,0x7,0xd3,0xe1,0x2,0xc7,0x6,0xc8,0x0,0x0,0xe1,0x2,0xc7,0x28,0xc4,0x2,0xc4,0x19,0xd3,0xd3,0xe3,0x0,0xd0,0x9c,0xc,0xd3,0xc0,0xe3,0x0,0xd0,0x9c,0x11,0xd3,0xd4,0x0,0xc2,0x1,0x3f,0xf0,0xc2,0x1,0x40,0xa,0x25,0x9c,0x1a,0x9c,0x1a,0x9c,0x1b,0x9c,0x1b,0x9c,0x1a,0xc1,0x6,0x58,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x1c,0xd,0x9c,0x1d,0xb8,0xc3,0xc4,0xc4,0xc4,0x9c,0x1e,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x5f,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x83,0x5f,0xd3,0xd3,0x0,0xc2,0x1,0x40,0x62,0xc2,0x1,0x40,0x7c,0x25,0x9c,0x20,0x9c,0x20,0x9c,0x21,0x9c,0x21,0x9c,0x20,0xc1,0x6,0x5a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x22,0xd,0x9c,0x23,0xb8,0xc3,0xc4,0xc4,0xc4,0x9c,0x24,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x5f,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x83,0x5f,0xd3,0xd3,0x0,0xc2,0x1,0x40,0xd4,0xc2,0x1,0x40,0xee,0x25,0x9c,0x26,0x9c,0x26,0x9c,0x27,0x9c,0x27,0x9c,0x26,0xc1,0x6,0x5c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x28,0xd,0x9c,0x29,0xb8,0xc3,0xc4,0xc4,0xc4,0x9c,0x2a,0xe1,0x2,0xc7,0x3,0xc6,0x84,0xc,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x44,0xd3,0xd3,0x0,0xc2,0x1,0x41,0x4e,0xc2,0x1,0x41,0x6c,0x25,0x9c,0x2c,0x9c,0x2c,0x9c,0x2d,0x9c,0x2d,0x9c,0x2c,0xc1,0x6,0x5e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x2e,0xd,0x9c,0x2f,0xb8,0xc3,0xc4,0xc4,0xc4,0x9c,0x30,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x5e,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0xd,0xd3,0xd3,0x0,0xc2,0x1,0x41,0xe6,0xc2,0x1,0x41,0xcc,0xc2,0x1,0x41,0xd6,0xc2,0x1,0x41,0xea,0xc2,0x1,0x42,0x14,0xc2,0x1,0x42,0xc,0xc2,0x1,0x42,0x6,0x31,0x9c,0x32,0x9c,0x32,0x9c,0x33,0x9c,0x34,0x9c,0x34,0x9c,0x33,0x9c,0x35,0x9c,0x35,0x9c,0x36,0x9c,0x36,0x9c,0x37,0x9c,0x38,0x9c,0x38,0x9c,0x37,0x9c,0x36,0x9c,0x35,0x9c,0x32,0xc1,0x6,0x60,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x39,0xd,0x9c,0x3a,0xe5,0x39,0xc3,0xc4,0xc4,0xc4,0x9c,0x3b,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x7f,0xd3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x2e,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x94,0x1f,0xd3,0xc6,0x88,0x71,0xd3,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x42,0xe0,0xc2,0x1,0x42,0xc6,0xc2,0x1,0x42,0xd0,0xc2,0x1,0x42,0xe4,0xc2,0x1,0x43,0x1a,0xc2,0x1,0x43,0x12,0xc2,0x1,0x43,0x4,0xc2,0x1,0x43,0x42,0xc2,0x1,0x43,0x3a,0xc2,0x1,0x43,0x2c,0x38,0x9c,0x3d,0x9c,0x3d,0x9c,0x3e,0x9c,0x3f,0x9c,0x3f,0x9c,0x3e,0x9c,0x40,0x9c,0x40,0x9c,0x41,0x9c,0x41,0x9c,0x42,0x9c,0x43,0x9c,0x43,0x9c,0x42,0x9c,0x41,0x9c,0x44,0x9c,0x44,0x9c,0x45,0x9c,0x46,0x9c,0x46,0x9c,0x45,0x9c,0x44,0x9c,0x40,0x9c,0x3d,0xc1,0x6,0x64,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x47,0xd,0x9c,0x48,0xe5,0x4f,0xc3,0xc4,0xc4,0xc4,0x9c,0x49,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc9,0x2,0x15,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x93,0x7f,0xd3,0xd3,0xe1,0x3,0xc7,0x3,0xc6,0x86,0x1e,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x90,0x19,0xd3,0xc6,0x8d,0x33,0xd3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x90,0x19,0xd3,0xc6,0x88,0x71,0xd3,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x43,0xc4,0xc2,0x1,0x43,0xaa,0xc2,0x1,0x43,0xb4,0xc2,0x1,0x43,0xc8,0xc2,0x1,0x43,0xfc,0xc2,0x1,0x43,0xf4,0xc2,0x1,0x43,0xe6,0x31,0x9c,0x4b,0x9c,0x4b,0x9c,0x4c,0x9c,0x4d,0x9c,0x4d,0x9c,0x4c,0x9c,0x4e,0x9c,0x4e,0x9c,0x4f,0x9c,0x4f,0x9c,0x50,0x9c,0x51,0x9c,0x51,0x9c,0x50,0x9c,0x4f,0x9c,0x4e,0x9c,0x4b,0xc1,0x6,0x66,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x52,0xd,0x9c,0x53,0xe5,0x39,0xc3,0xc4,0xc4,0xc4,0x9c,0x54,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc9,0x2,0x15,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x93,0x7f,0xd3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x6d,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x90,0x19,0xd3,0xc6,0x88,0x71,0xd3,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x42,0xa6,0xc2,0x1,0x42,0x9a,0xc2,0x1,0x42,0x8c,0x2b,0x9c,0x56,0x9c,0x56,0x9c,0x57,0x9c,0x58,0x9c,0x58,0x9c,0x57,0x9c,0x56,0xc0,0xc0,0xc0,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9c,0x59,0xd,0x9c,0x48,0xe5,0x2c,0xc3,0xc4,0xc4,0xc4,0x9c,0x5a,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x19,0xd3,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0x5a,0xd3,0xe3,0x0,0xd0,0x9c,0x4a,0xd3,0xc0,0xe3,0x0,0xd0,0x9c,0x55,0xd3,0xd4,0x0,0xc2,0x1,0x45,0x34,0xc2,0x1,0x45,0x4e,0xc2,0x1,0x45,0x5c,0x29,0x9c,0x5c,0x9c,0x5c,0x9c,0x5d,0x9c,0x5d,0x9c,0x5d,0x9c,0x5e,0x9c,0x5e,0x9c,0x5e,0x9c,0x5c,0xc1,0x6,0x6e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x5f,0xd,0x9c,0x60,0xe5,0x23,0xc3,0xc4,0xc4,0xc4,0x9c,0x61,0xe1,0x3,0xc7,0x3,0xc6,0x85,0x3b,0xe1,0x2,0xc7,0x8,0xc8,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xc8,0x0,0x0,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x45,0xb0,0xc2,0x1,0x45,0xce,0xc2,0x1,0x45,0xe2,0xc2,0x1,0x45,0xda,0xc2,0x1,0x45,0xf6,0xc2,0x1,0x45,0xee,0x30,0x9c,0x63,0x9c,0x63,0x9c,0x64,0x9c,0x64,0x9c,0x64,0x9c,0x65,0x9c,0x65,0x9c,0x66,0x9c,0x66,0x9c,0x65,0x9c,0x67,0x9c,0x67,0x9c,0x68,0x9c,0x68,0x9c,0x67,0x9c,0x63,0xc1,0x6,0x70,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x69,0xd,0x9c,0x6a,0xe5,0x39,0xc3,0xc4,0xc4,0xc4,0x9c,0x6b,0xe1,0x4,0xc7,0x3,0xc6,0x86,0x30,0xe1,0x2,0xc7,0x8,0xc8,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8d,0x33,0xd3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x71,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x46,0x4a,0xc2,0x1,0x46,0x66,0xc2,0x1,0x46,0x7a,0xc2,0x1,0x46,0x72,0x2b,0x9c,0x6d,0x9c,0x6d,0x9c,0x6e,0x9c,0x6e,0x9c,0x6e,0x9c,0x6f,0x9c,0x6f,0x9c,0x70,0x9c,0x70,0x9c,0x6f,0x9c,0x6d,0xc1,0x6,0x72,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9c,0x71,0xd,0x9c,0x72,0xe5,0x29,0xc3,0xc4,0xc4,0xc4,0x9c,0x73,0xe1,0x3,0xc7,0x3,0xc6,0x85,0x7a,0xe1,0x2,0xc7,0x8,0xc8,0x0,0x1,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x71,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x45,0x1e,0xc2,0x1,0x45,0xe,0xc2,0x1,0x45,0x98,0xc2,0x1,0x45,0x8c,0x2e,0x9c,0x75,0x9c,0x76,0x9c,0x75,0xc0,0xc0,0x9c,0x77,0x9c,0x77,0x9c,0x78,0x9c,0x78,0x9c,0x77,0xc0,0xc0,0xc0,0xc0,0xc1,0x6,0x6c,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9c,0x79,0xd,0x9c,0x7a,0xe5,0x33,0xc3,0x98,0x20,0xc4,0xc4,0x9c,0x7b,0xe1,0x1,0xc7,0x26,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x9c,0x62,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0x5a,0xd3,0xe3,0x0,0xd0,0x9c,0x6c,0xd3,0xc0,0xe3,0x0,0xd0,0x9c,0x74,0xd3,0xd4,0x0,0x7,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x1,0x61,0x21,0x9c,0x7e,0x21,0x9c,0x7f,0xc2,0x1,0x47,0x14,0x22,0x9d,0x1,0x9d,0x1,0xc1,0x6,0x76,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9d,0x2,0xd,0x9d,0x3,0xb0,0xc3,0x9d,0x0,0xc4,0xc4,0x9d,0x4,0xe1,0x1,0xc9,0x2,0x15,0xca,0x0,0xd3,0x0,0x23,0x4a,0x8d,0x7,0x8e,0x76,0xc2,0x1,0x44,0x7e,0xc2,0x1,0x44,0x88,0xc2,0x1,0x46,0x9e,0xc2,0x1,0x44,0xd0,0xc2,0x1,0x44,0xc2,0xc2,0x1,0x47,0x1c,0xc2,0x1,0x46,0xf8,0xc2,0x1,0x46,0xea,0xc2,0x1,0x46,0xda,0xc2,0x1,0x47,0x54,0xc2,0x1,0x47,0x4a,0x38,0x9d,0x7,0x9d,0x8,0x9d,0x8,0x9d,0x7,0x9d,0x9,0x9d,0xa,0x9d,0xb,0x9d,0xb,0x9d,0xa,0x9d,0x9,0x9d,0xc,0x9d,0xd,0x9d,0xe,0x9d,0xf,0x9d,0xf,0x9d,0xe,0x9d,0xd,0x9d,0xc,0x9d,0x10,0x9d,0x10,0x9d,0x11,0x9d,0x11,0x9d,0x11,0x9d,0x10,0xc1,0x6,0x6a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9d,0x12,0xd,0x9d,0x13,0xe5,0x68,0xc3,0xc4,0x9d,0x6,0x81,0x4b,0x9d,0x14,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x7f,0xd3,0xd3,0xd1,0x0,0xe0,0x0,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0xf,0xd3,0xc6,0x89,0x24,0xd0,0x9c,0x7c,0xd3,0xc6,0x9c,0x7d,0xd3,0xd1,0x1,0xe0,0x0,0xf0,0x1,0x82,0x62,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x98,0x2d,0xd3,0xc6,0x90,0x3d,0xd3,0xc6,0x89,0x24,0xd0,0x9d,0x5,0xd3,0xc6,0x9c,0x7d,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xcb,0x0,0xcb,0x1,0xd3,0xcb,0x2,0xd3,0x0,0xc2,0x1,0x47,0xba,0xc2,0x1,0x47,0xd6,0xc2,0x1,0x48,0x10,0xc2,0x1,0x48,0x3a,0x29,0x9d,0x16,0x9d,0x16,0x9d,0x17,0x9d,0x17,0x9d,0x18,0x9d,0x18,0x9d,0x19,0x9d,0x19,0x9d,0x16,0xc1,0x6,0x7c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9d,0x1a,0xd,0x9d,0x1b,0xe5,0x33,0xc3,0xc4,0xc4,0xc4,0x9d,0x1c,0xe1,0x8,0xc7,0x3,0xc6,0x86,0x78,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc4,0x0,0xc6,0x85,0x1a,0xc6,0x83,0x5f,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0xd,0xd3,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0x0,0xc2,0x1,0x49,0x3e,0x22,0x9d,0x1e,0x9d,0x1e,0xc1,0x6,0x82,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9d,0x1f,0xd,0x9d,0x20,0xb0,0xc3,0x8e,0x56,0xc4,0xc4,0x9d,0x21,0xe1,0x1,0xc9,0x2,0x15,0xca,0x0,0xd3,0x0,0x61,0x87,0x55,0xc0,0x3,0x74,0x72,0x79,0x24,0x90,0x19,0x85,0x6,0x8b,0x41,0x85,0x6,0xc2,0x1,0x48,0xba,0xc2,0x1,0x48,0xc4,0xc2,0x1,0x49,0x1e,0xc2,0x1,0x49,0x12,0xc2,0x1,0x49,0x6,0xc2,0x1,0x49,0x18,0xc2,0x1,0x49,0x72,0xc2,0x1,0x49,0xc6,0xc2,0x1,0x49,0xba,0xc2,0x1,0x4a,0x18,0xc2,0x1,0x4a,0x2a,0xc2,0x1,0x4a,0x34,0xc2,0x1,0x4a,0x72,0xc2,0x1,0x4a,0xec,0xc2,0x1,0x4a,0xde,0xc2,0x1,0x4a,0xcc,0xc2,0x1,0x4a,0x74,0xc2,0x1,0x4a,0x92,0xc2,0x1,0x4a,0xa6,0xc2,0x1,0x4a,0xf0,0xc2,0x1,0x4b,0xe,0xc2,0x1,0x4b,0x3e,0xc2,0x1,0x4b,0x38,0xc2,0x1,0x4b,0x6e,0xc2,0x1,0x4b,0x62,0xc2,0x1,0x4b,0x54,0xc2,0x1,0x4b,0x48,0xc2,0x1,0x4b,0xa6,0xc2,0x1,0x4c,0x2a,0xc2,0x1,0x4c,0x1c,0xc2,0x1,0x4c,0xa,0xc2,0x1,0x4b,0xa8,0xc2,0x1,0x4b,0xc6,0xc2,0x1,0x4b,0xda,0xc2,0x1,0x4b,0xf8,0xc2,0x1,0x4c,0x2e,0xc2,0x1,0x4c,0x4c,0xc2,0x1,0x4c,0xce,0xc2,0x1,0x4c,0xc0,0xc2,0x1,0x4c,0xae,0xc2,0x1,0x4c,0x70,0xc2,0x1,0x4c,0x8c,0xc2,0x1,0x4c,0xa0,0xc2,0x1,0x4c,0xd2,0xc2,0x1,0x4c,0xf0,0xe1,0x73,0x9d,0x26,0x9d,0x27,0x9d,0x27,0x9d,0x26,0x9d,0x28,0x9d,0x29,0x9d,0x29,0x9d,0x2a,0x9d,0x2a,0x9d,0x2b,0x9d,0x2b,0x9d,0x2b,0x9d,0x29,0x9d,0x28,0x9d,0x2c,0x9d,0x2c,0x9d,0x2d,0x9d,0x2e,0x9d,0x2e,0x9d,0x2d,0x9d,0x2f,0x9d,0x30,0x9d,0x31,0x9d,0x31,0x9d,0x30,0x9d,0x2f,0x9d,0x32,0x9d,0x32,0x9d,0x33,0x9d,0x33,0x9d,0x34,0x9d,0x34,0x9d,0x35,0x9d,0x35,0x9d,0x36,0x9d,0x36,0x9d,0x37,0x9d,0x37,0x9d,0x38,0x9d,0x38,0xc0,0xc0,0xc0,0x9d,0x36,0x9d,0x35,0x9d,0x34,0x9d,0x39,0x9d,0x39,0x9d,0x3a,0x9d,0x3a,0x9d,0x39,0x9d,0x33,0x9d,0x32,0x9d,0x3b,0x9d,0x3c,0x9d,0x3d,0x9d,0x3d,0x9d,0x3e,0x9d,0x3f,0x9d,0x40,0x9d,0x40,0x9d,0x3f,0x9d,0x3e,0x9d,0x3d,0x9d,0x3b,0x9d,0x41,0x9d,0x41,0x9d,0x42,0x9d,0x42,0x9d,0x43,0x9d,0x43,0x9d,0x44,0x9d,0x44,0x9d,0x45,0x9d,0x45,0x9d,0x46,0x9d,0x46,0x9d,0x47,0x9d,0x47,0xc0,0xc0,0x9d,0x48,0x9d,0x48,0xc0,0x9d,0x45,0x9d,0x44,0x9d,0x43,0x9d,0x49,0x9d,0x49,0x9d,0x4a,0x9d,0x4a,0x9d,0x49,0x9d,0x42,0x9d,0x41,0x9d,0x4b,0x9d,0x4b,0x9d,0x4c,0x9d,0x4c,0x9d,0x4d,0x9d,0x4d,0x9d,0x4e,0x9d,0x4e,0x9d,0x4f,0x9d,0x4f,0x9d,0x50,0x9d,0x50,0x9d,0x4e,0x9d,0x4d,0x9d,0x4c,0x9d,0x51,0x9d,0x51,0x9d,0x52,0x9d,0x52,0x9d,0x51,0x9d,0x4b,0xc1,0x6,0x80,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9d,0x53,0xd,0x9d,0x54,0xe5,0x83,0x1,0xc3,0xc4,0x9d,0x25,0x8c,0x56,0x9d,0x55,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x19,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x85,0x6,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x9d,0x22,0xd3,0xd1,0x1,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x82,0x61,0xd3,0xdd,0x0,0x0,0xbc,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x41,0xd3,0xc6,0x3e,0xc6,0x82,0x61,0xd3,0xd1,0x2,0xe0,0x1,0xcb,0x1,0xc6,0x3e,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x82,0x61,0xd3,0xd3,0xd3,0xd1,0x3,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x4,0xc7,0x3,0xc6,0x87,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xe0,0x0,0xcb,0x3,0xc6,0x81,0x44,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x9d,0x23,0xc6,0x87,0x55,0xcb,0x2,0xd3,0xd3,0xcb,0x0,0xd3,0xcb,0x3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0xbd,0xc2,0xe1,0x1,0xc7,0x29,0xe1,0x2,0xc7,0x1c,0xe0,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x41,0xd3,0xc6,0x90,0x3d,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xd3,0xdd,0x0,0x1,0x3c,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x4,0xc7,0x3,0xc6,0x87,0x7f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x81,0x44,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x9d,0x23,0xc6,0x87,0x55,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x41,0xd3,0xd3,0xd3,0xcb,0x0,0xd3,0xcb,0x1,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x1,0x3d,0xc2,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x3,0xc7,0x3,0xc6,0x87,0x1b,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x81,0x44,0xd3,0xd3,0xcb,0x0,0xd3,0xcb,0x1,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x4e,0x32,0x22,0x9d,0x57,0x9d,0x57,0xc1,0x6,0x96,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9d,0x58,0xd,0x9d,0x59,0xb0,0xc3,0x8e,0x56,0xc4,0xc4,0x9d,0x5a,0xe1,0x1,0xc9,0x2,0x15,0xca,0x0,0xd3,0x0,0x25,0x90,0x19,0x85,0x6,0x82,0x49,0x8b,0x41,0x85,0x6,0xc2,0x1,0x4d,0xae,0xc2,0x1,0x4d,0xb8,0xc2,0x1,0x4e,0x12,0xc2,0x1,0x4e,0x6,0xc2,0x1,0x4d,0xfa,0xc2,0x1,0x4e,0xc,0xc2,0x1,0x4e,0x68,0xc2,0x1,0x4e,0x60,0xc2,0x1,0x4e,0x7e,0xc2,0x1,0x4e,0x72,0xc2,0x1,0x4e,0xd8,0xc2,0x1,0x4f,0x2c,0xc2,0x1,0x4f,0x20,0xc2,0x1,0x4f,0x7e,0xc2,0x1,0x4f,0x90,0xc2,0x1,0x4f,0x9a,0xc2,0x1,0x4f,0xd8,0xc2,0x1,0x50,0x86,0xc2,0x1,0x50,0x78,0xc2,0x1,0x50,0x48,0xc2,0x1,0x50,0x36,0xc2,0x1,0x4f,0xda,0xc2,0x1,0x4f,0xfc,0xc2,0x1,0x50,0x10,0xc2,0x1,0x50,0x4c,0xc2,0x1,0x50,0x66,0xc2,0x1,0x50,0x8a,0xc2,0x1,0x50,0xa8,0xc2,0x1,0x50,0xd8,0xc2,0x1,0x50,0xd2,0xc2,0x1,0x51,0x8,0xc2,0x1,0x50,0xfc,0xc2,0x1,0x50,0xee,0xc2,0x1,0x50,0xe2,0xc2,0x1,0x51,0x40,0xc2,0x1,0x51,0xf8,0xc2,0x1,0x51,0xea,0xc2,0x1,0x51,0xba,0xc2,0x1,0x51,0xa8,0xc2,0x1,0x51,0x42,0xc2,0x1,0x51,0x64,0xc2,0x1,0x51,0x78,0xc2,0x1,0x51,0x96,0xc2,0x1,0x51,0xbe,0xc2,0x1,0x51,0xd8,0xc2,0x1,0x51,0xfc,0xc2,0x1,0x52,0x1a,0xc2,0x1,0x52,0xd0,0xc2,0x1,0x52,0xc2,0xc2,0x1,0x52,0x92,0xc2,0x1,0x52,0x80,0xc2,0x1,0x52,0x3e,0xc2,0x1,0x52,0x5e,0xc2,0x1,0x52,0x72,0xc2,0x1,0x52,0x96,0xc2,0x1,0x52,0xb0,0xc2,0x1,0x52,0xd4,0xc2,0x1,0x52,0xf2,0xe1,0x81,0x1c,0x9d,0x5d,0x9d,0x5e,0x9d,0x5e,0x9d,0x5d,0x9d,0x5f,0x9d,0x60,0x9d,0x60,0x9d,0x61,0x9d,0x61,0x9d,0x62,0x9d,0x62,0x9d,0x62,0x9d,0x60,0x9d,0x5f,0x9d,0x63,0x9d,0x64,0x9d,0x65,0x9d,0x65,0x9d,0x66,0x9d,0x66,0x9d,0x65,0x9d,0x63,0x9d,0x67,0x9d,0x67,0x9d,0x68,0x9d,0x69,0x9d,0x69,0x9d,0x68,0x9d,0x6a,0x9d,0x6b,0x9d,0x6c,0x9d,0x6c,0x9d,0x6b,0x9d,0x6a,0x9d,0x6d,0x9d,0x6d,0x9d,0x6e,0x9d,0x6e,0x9d,0x6f,0x9d,0x6f,0x9d,0x70,0x9d,0x70,0x9d,0x71,0x9d,0x71,0x9d,0x72,0x9d,0x72,0xc0,0xc0,0xc0,0x9d,0x73,0x9d,0x73,0x9d,0x74,0x9d,0x74,0xc0,0xc0,0xc0,0x9d,0x72,0x9d,0x71,0x9d,0x75,0x9d,0x75,0x9d,0x76,0x9d,0x76,0x9d,0x75,0x9d,0x70,0x9d,0x6f,0x9d,0x77,0x9d,0x77,0x9d,0x78,0x9d,0x78,0x9d,0x77,0x9d,0x6e,0x9d,0x6d,0x9d,0x79,0x9d,0x7a,0x9d,0x7b,0x9d,0x7b,0x9d,0x7c,0x9d,0x7d,0x9d,0x7e,0x9d,0x7e,0x9d,0x7d,0x9d,0x7c,0x9d,0x7b,0x9d,0x79,0x9d,0x7f,0x9d,0x7f,0x9e,0x0,0x9e,0x0,0x9e,0x1,0x9e,0x1,0x9e,0x2,0x9e,0x2,0x9e,0x3,0x9e,0x3,0x9e,0x4,0x9e,0x4,0xc0,0xc0,0xc0,0x9e,0x5,0x9e,0x5,0x9e,0x6,0x9e,0x6,0xc0,0xc0,0x9e,0x7,0x9e,0x7,0xc0,0x9e,0x4,0x9e,0x3,0x9e,0x8,0x9e,0x8,0x9e,0x9,0x9e,0x9,0x9e,0x8,0x9e,0x2,0x9e,0x1,0x9e,0xa,0x9e,0xa,0x9e,0xb,0x9e,0xb,0x9e,0xa,0x9e,0x0,0x9d,0x7f,0x9e,0xc,0x9e,0xc,0x9e,0xd,0x9e,0xd,0x9e,0xe,0x9e,0xe,0x9e,0xf,0x9e,0xf,0x9e,0x10,0x9e,0x10,0xc0,0xc0,0xc0,0x9e,0x11,0x9e,0x11,0x9e,0x12,0x9e,0x12,0x9e,0x10,0x9e,0xf,0x9e,0x13,0x9e,0x13,0x9e,0x14,0x9e,0x14,0x9e,0x13,0x9e,0xe,0x9e,0xd,0x9e,0x15,0x9e,0x15,0x9e,0x16,0x9e,0x16,0x9e,0x15,0x9e,0xc,0xc1,0x6,0x94,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9e,0x17,0xd,0x9e,0x18,0xe5,0x83,0x75,0xc3,0xc4,0x9d,0x5c,0x9a,0x27,0x9e,0x19,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x19,0xd3,0xd3,0xd1,0x0,0xf0,0x1,0x82,0x62,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x85,0x6,0xd3,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xc6,0x89,0x24,0xd0,0x9d,0x5b,0xd3,0xd1,0x1,0xe1,0x3,0xc7,0x10,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x99,0x18,0xd3,0xc6,0x82,0x49,0xc6,0x1a,0xd3,0xd1,0x2,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x82,0x61,0xd3,0xdd,0x0,0x0,0xf6,0xe0,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x41,0xd3,0xc6,0x3e,0xc6,0x82,0x61,0xd3,0xd1,0x3,0xe0,0x1,0xcb,0x1,0xc6,0x3e,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x82,0x61,0xd3,0xd3,0xd3,0xd1,0x4,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x4,0xc7,0x3,0xe1,0x2,0xc7,0x1a,0xc6,0x87,0x4e,0xcb,0x2,0xd3,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xe0,0x0,0xcb,0x4,0xc6,0x81,0x44,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x9d,0x23,0xc6,0x87,0x55,0xcb,0x3,0xd3,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x5f,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x97,0x20,0xd3,0xd3,0xd3,0xcb,0x4,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0xf7,0xc2,0xe1,0x1,0xc7,0x29,0xe1,0x2,0xc7,0x1c,0xe0,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x41,0xd3,0xc6,0x90,0x3d,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xd3,0xdd,0x0,0x1,0x93,0xe1,0x2,0xc7,0x1,0xc4,0x1,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x4,0xc7,0x3,0xe1,0x2,0xc7,0x1a,0xc6,0x87,0x4e,0xcb,0x2,0xd3,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x81,0x44,0xd3,0xe1,0x3,0xc7,0x4,0xc6,0x9d,0x23,0xc6,0x87,0x55,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x41,0xd3,0xd3,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x5f,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x97,0x20,0xd3,0xd3,0xd3,0xcb,0x1,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd3,0xd3,0xdb,0x0,0x1,0x94,0xc2,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x3,0xc7,0x3,0xe1,0x2,0xc7,0x1a,0xc6,0x86,0x78,0xcb,0x2,0xd3,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x81,0x44,0xd3,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x5f,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x97,0x20,0xd3,0xd3,0xd3,0xcb,0x1,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd3,0x0,0x9,0x5f,0x54,0x61,0x73,0x6b,0x5f,0x6e,0x65,0x77,0x21,0x8f,0x0,0xc2,0x1,0x53,0x70,0xc2,0x1,0x53,0x7a,0xc2,0x1,0x53,0xa0,0xc2,0x1,0x53,0xbc,0xc2,0x1,0x53,0xea,0xc2,0x1,0x54,0x38,0x2d,0x9e,0x1d,0x9e,0x1e,0x9e,0x1e,0x9e,0x1d,0x9e,0x1f,0x9e,0x1f,0x9e,0x20,0x9e,0x20,0x9e,0x21,0x9e,0x21,0x9e,0x22,0x9e,0x22,0x9e,0x1f,0xc1,0x6,0xaa,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9e,0x23,0xd,0x9e,0x24,0xe5,0x47,0xc3,0xc4,0x9e,0x1c,0x88,0x3d,0x9e,0x25,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8f,0x0,0xd3,0xd3,0xd1,0x0,0xe1,0x9,0xc7,0x3,0xc6,0x87,0x1b,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc4,0x1,0xc6,0x83,0x79,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x9e,0x1b,0xcb,0x0,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0x0,0xc2,0x1,0x54,0xb0,0xc2,0x1,0x54,0xba,0xc2,0x1,0x54,0xde,0xc2,0x1,0x54,0xfa,0xc2,0x1,0x55,0x28,0xc2,0x1,0x55,0x68,0x2d,0x9e,0x27,0x9e,0x28,0x9e,0x28,0x9e,0x27,0x9e,0x29,0x9e,0x29,0x9e,0x2a,0x9e,0x2a,0x9e,0x2b,0x9e,0x2b,0x9e,0x2c,0x9e,0x2c,0x9e,0x29,0xc1,0x6,0xb0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9e,0x2d,0xd,0x9e,0x2e,0xe5,0x47,0xc3,0xc4,0x99,0x58,0x88,0x3d,0x9e,0x2f,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x12,0xd3,0xd3,0xd1,0x0,0xe1,0x9,0xc7,0x3,0xc6,0x87,0x1b,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc4,0x1,0xc6,0x83,0x79,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x84,0xd,0xcb,0x0,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0x0,0xc2,0x1,0x55,0xdc,0xc2,0x1,0x55,0xe6,0xc2,0x1,0x56,0xa,0xc2,0x1,0x56,0x26,0xc2,0x1,0x56,0x54,0xc2,0x1,0x56,0x96,0x2d,0x9e,0x31,0x9e,0x32,0x9e,0x32,0x9e,0x31,0x9e,0x33,0x9e,0x33,0x9e,0x34,0x9e,0x34,0x9e,0x35,0x9e,0x35,0x9e,0x36,0x9e,0x36,0x9e,0x33,0xc1,0x6,0xb6,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9e,0x37,0xd,0x9e,0x38,0xe5,0x47,0xc3,0xc4,0x99,0x58,0x88,0x3d,0x9e,0x39,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x12,0xd3,0xd3,0xd1,0x0,0xe1,0x9,0xc7,0x3,0xc6,0x87,0x1b,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc4,0x1,0xc6,0x83,0x79,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x8a,0x32,0xcb,0x0,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0x0,0x3,0x6e,0x65,0x67,0xc2,0x1,0x57,0xa,0xc2,0x1,0x57,0x14,0xc2,0x1,0x57,0x38,0xc2,0x1,0x57,0x54,0xc2,0x1,0x57,0x82,0xc2,0x1,0x57,0xc2,0x2d,0x9e,0x3c,0x9e,0x3d,0x9e,0x3d,0x9e,0x3c,0x9e,0x3e,0x9e,0x3e,0x9e,0x3f,0x9e,0x3f,0x9e,0x40,0x9e,0x40,0x9e,0x41,0x9e,0x41,0x9e,0x3e,0xc1,0x6,0xbc,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9e,0x42,0xd,0x9e,0x43,0xe5,0x47,0xc3,0xc4,0x99,0x58,0x88,0x3d,0x9e,0x44,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x12,0xd3,0xd3,0xd1,0x0,0xe1,0x9,0xc7,0x3,0xc6,0x87,0x1b,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc4,0x1,0xc6,0x83,0x79,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x9e,0x3b,0xcb,0x0,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0x0,0xc2,0x1,0x58,0x3a,0xc2,0x1,0x58,0x44,0xc2,0x1,0x58,0x7c,0xc2,0x1,0x58,0x86,0xc2,0x1,0x58,0xaa,0xc2,0x1,0x58,0xc6,0xc2,0x1,0x58,0xf4,0xc2,0x1,0x59,0xc,0xc2,0x1,0x59,0x16,0xc2,0x1,0x59,0x52,0x35,0x9e,0x46,0x9e,0x47,0x9e,0x47,0x9e,0x46,0x9e,0x48,0x9e,0x49,0x9e,0x49,0x9e,0x48,0x9e,0x4a,0x9e,0x4a,0x9e,0x4b,0x9e,0x4b,0x9e,0x4c,0x9e,0x4c,0x9e,0x4d,0x9e,0x4e,0x9e,0x4e,0x9e,0x4d,0x9e,0x4f,0x9e,0x4f,0x9e,0x4a,0xc1,0x6,0xc2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9e,0x50,0xd,0x9e,0x51,0xe5,0x66,0xc3,0xc4,0x93,0x14,0x82,0x7a,0x9e,0x52,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x11,0xd3,0xd3,0xd1,0x0,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x12,0xd3,0xd3,0xd1,0x1,0xe1,0xa,0xc7,0x3,0xc6,0x87,0x1b,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc4,0x2,0xc6,0x83,0x79,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xe1,0x1,0xc9,0x2,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x83,0x43,0xd3,0xd3,0xcb,0x0,0xcb,0x1,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0x0,0x22,0x81,0x32,0x83,0x56,0xc2,0x1,0x59,0xcc,0xc2,0x1,0x5a,0x6,0xc2,0x1,0x5a,0xe6,0xc2,0x1,0x5a,0xc0,0xc2,0x1,0x5a,0x88,0xc2,0x1,0x5a,0x62,0xc2,0x1,0x5a,0x44,0xc2,0x1,0x5a,0x2c,0xc2,0x1,0x5a,0x36,0xc2,0x1,0x5a,0x48,0xc2,0x1,0x5a,0x76,0xc2,0x1,0x5a,0x80,0xc2,0x1,0x5a,0x8c,0xc2,0x1,0x5a,0xd4,0xc2,0x1,0x5a,0xde,0xc2,0x1,0x5a,0xea,0xe1,0x28,0x9e,0x55,0x9e,0x55,0x9e,0x56,0x9e,0x56,0x9e,0x57,0x9e,0x57,0x9e,0x58,0x9e,0x58,0x9e,0x59,0x9e,0x59,0x9e,0x5a,0x9e,0x5a,0x9e,0x5b,0x9e,0x5b,0x9e,0x5c,0x9e,0x5d,0x9e,0x5d,0x9e,0x5c,0x9e,0x5e,0x9e,0x5e,0x9e,0x5e,0x9e,0x5b,0x9e,0x5f,0x9e,0x60,0x9e,0x60,0x9e,0x5f,0x9e,0x5a,0x9e,0x61,0x9e,0x61,0x9e,0x61,0x9e,0x59,0x9e,0x62,0x9e,0x63,0x9e,0x63,0x9e,0x62,0x9e,0x58,0x9e,0x64,0x9e,0x64,0x9e,0x64,0x9e,0x57,0xc1,0x6,0xca,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9e,0x65,0xd,0x9e,0x66,0xe5,0x81,0x2,0xc3,0xc4,0x9e,0x54,0x82,0x7a,0x9e,0x67,0xe1,0x0,0xc9,0x1,0x18,0xd3,0xd1,0x0,0xe1,0x0,0xc9,0x1,0x18,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x92,0x37,0xd3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x86,0x56,0xcb,0x0,0xd3,0xd3,0xe1,0x1,0xc9,0x1,0x16,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8f,0x65,0xd3,0xd3,0xd3,0xe1,0x4,0xc7,0x3,0xc6,0x83,0x42,0xcb,0x1,0xc6,0x86,0x5e,0xcb,0x0,0xd3,0xd3,0xe1,0x1,0xc9,0x1,0x16,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x81,0x32,0xd3,0xd3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x86,0x5e,0xcb,0x1,0xd3,0xd3,0x0,0x22,0x92,0x62,0x83,0x56,0xc2,0x1,0x5b,0x82,0xc2,0x1,0x5b,0x78,0xc2,0x1,0x5b,0xc2,0xc2,0x1,0x5b,0xb8,0xc2,0x1,0x5c,0x98,0xc2,0x1,0x5c,0x6c,0xc2,0x1,0x5c,0x4a,0xc2,0x1,0x5c,0x26,0xc2,0x1,0x5b,0xe4,0xc2,0x1,0x5c,0x32,0xc2,0x1,0x5c,0x3c,0xc2,0x1,0x5c,0x4e,0xc2,0x1,0x5c,0x80,0xc2,0x1,0x5c,0x8a,0xc2,0x1,0x5c,0x9c,0xe1,0x25,0x9e,0x6a,0x9e,0x6b,0x9e,0x6b,0x9e,0x6a,0x9e,0x6c,0x9e,0x6d,0x9e,0x6d,0x9e,0x6c,0x9e,0x6e,0x9e,0x6e,0x9e,0x6f,0x9e,0x6f,0x9e,0x70,0x9e,0x70,0x9e,0x71,0x9e,0x71,0x9e,0x72,0x9e,0x72,0x9e,0x72,0x9e,0x73,0x9e,0x74,0x9e,0x74,0x9e,0x73,0x9e,0x71,0x9e,0x75,0x9e,0x75,0x9e,0x75,0x9e,0x70,0x9e,0x76,0x9e,0x77,0x9e,0x77,0x9e,0x76,0x9e,0x6f,0x9e,0x78,0x9e,0x78,0x9e,0x78,0x9e,0x6e,0xc1,0x6,0xd2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9e,0x79,0xd,0x9e,0x7a,0xe5,0x81,0xa,0xc3,0xc4,0x9e,0x69,0x82,0x7a,0x9e,0x7b,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x83,0x52,0xd3,0xc6,0x92,0x62,0xd3,0xd1,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x83,0x52,0xd3,0xc6,0x83,0x56,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x5,0xc7,0x3,0xc6,0x83,0x52,0xcb,0x0,0xcb,0x1,0xc6,0x86,0x5e,0xcb,0x0,0xd3,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x92,0x37,0xd3,0xd3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x86,0x56,0xcb,0x1,0xd3,0xd3,0xe1,0x1,0xc9,0x1,0x16,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8f,0x0,0xd3,0xd3,0xd3,0xe1,0x5,0xc7,0x3,0xc6,0x83,0x42,0xcb,0x0,0xc6,0x86,0x5e,0xcb,0x1,0xc6,0x84,0x2d,0xd3,0xd3,0x0,0xc2,0x1,0x5d,0x5c,0xc2,0x1,0x5d,0x52,0xc2,0x1,0x5d,0x9c,0xc2,0x1,0x5d,0x92,0xc2,0x1,0x5e,0x2c,0xc2,0x1,0x5e,0x0,0xc2,0x1,0x5d,0xbe,0xc2,0x1,0x5e,0x14,0xc2,0x1,0x5e,0x1e,0xc2,0x1,0x5e,0x30,0x38,0x9e,0x7d,0x9e,0x7e,0x9e,0x7e,0x9e,0x7d,0x9e,0x7f,0x9f,0x0,0x9f,0x0,0x9e,0x7f,0x9f,0x1,0x9f,0x1,0x9f,0x2,0x9f,0x2,0x9f,0x3,0x9f,0x3,0x9f,0x3,0x9f,0x4,0x9f,0x5,0x9f,0x5,0x9f,0x4,0x9f,0x2,0x9f,0x6,0x9f,0x6,0x9f,0x6,0x9f,0x1,0xc1,0x6,0xda,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0x7,0xd,0x9f,0x8,0xe5,0x67,0xc3,0xc4,0x9e,0x69,0x82,0x7a,0x9f,0x9,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x83,0x52,0xd3,0xc6,0x92,0x62,0xd3,0xd1,0x0,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x83,0x52,0xd3,0xc6,0x83,0x56,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x5,0xc7,0x3,0xc6,0x83,0x52,0xcb,0x0,0xcb,0x1,0xc6,0x86,0x5e,0xcb,0x0,0xd3,0xe1,0x1,0xc9,0x1,0x16,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8f,0x0,0xd3,0xd3,0xd3,0xe1,0x5,0xc7,0x3,0xc6,0x83,0x42,0xcb,0x0,0xc6,0x86,0x5e,0xcb,0x1,0xc6,0x84,0x2d,0xd3,0xd3,0x0,0xc2,0x1,0x5e,0xba,0xc2,0x1,0x5e,0xd4,0x25,0x9f,0xb,0x9f,0xb,0x9f,0xc,0x9f,0xc,0x9f,0xb,0xc1,0x6,0xe0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0xd,0xd,0x9f,0xe,0xb8,0xc3,0xc4,0xc4,0xc4,0x9f,0xf,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x42,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x86,0x5e,0xd3,0xd3,0x0,0x21,0x83,0x56,0xc2,0x1,0x5f,0x58,0xc2,0x1,0x5f,0xd8,0xc2,0x1,0x5f,0xb6,0xc2,0x1,0x5f,0x94,0xc2,0x1,0x5f,0x7e,0xc2,0x1,0x5f,0x88,0xc2,0x1,0x5f,0x98,0xc2,0x1,0x5f,0xc2,0xc2,0x1,0x5f,0xcc,0xc2,0x1,0x5f,0xdc,0x39,0x9f,0x12,0x9f,0x12,0x9f,0x13,0x9f,0x13,0x9f,0x14,0x9f,0x14,0x9f,0x15,0x9f,0x15,0x9f,0x16,0x9f,0x17,0x9f,0x17,0x9f,0x16,0x9f,0x18,0x9f,0x18,0x9f,0x18,0x9f,0x15,0x9f,0x19,0x9f,0x1a,0x9f,0x1a,0x9f,0x19,0x9f,0x14,0x9f,0x1b,0x9f,0x1b,0x9f,0x1b,0x9f,0x13,0xc1,0x6,0xe4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0x1c,0xd,0x9f,0x1d,0xe5,0x52,0xc3,0xc4,0x9f,0x11,0x88,0x3d,0x9f,0x1e,0xe1,0x0,0xc9,0x1,0x18,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x11,0xd3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x86,0x56,0xcb,0x0,0xd3,0xd3,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x12,0xd3,0xd3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x86,0x5e,0xcb,0x0,0xd3,0xd3,0x0,0xc2,0x1,0x60,0x6c,0xc2,0x1,0x60,0xec,0xc2,0x1,0x60,0xca,0xc2,0x1,0x60,0xa8,0xc2,0x1,0x60,0x92,0xc2,0x1,0x60,0x9c,0xc2,0x1,0x60,0xac,0xc2,0x1,0x60,0xd6,0xc2,0x1,0x60,0xe0,0xc2,0x1,0x60,0xf0,0x39,0x9f,0x20,0x9f,0x20,0x9f,0x21,0x9f,0x21,0x9f,0x22,0x9f,0x22,0x9f,0x23,0x9f,0x23,0x9f,0x24,0x9f,0x25,0x9f,0x25,0x9f,0x24,0x9f,0x26,0x9f,0x26,0x9f,0x26,0x9f,0x23,0x9f,0x27,0x9f,0x28,0x9f,0x28,0x9f,0x27,0x9f,0x22,0x9f,0x29,0x9f,0x29,0x9f,0x29,0x9f,0x21,0xc1,0x6,0xea,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0x2a,0xd,0x9f,0x2b,0xe5,0x52,0xc3,0xc4,0x9f,0x11,0x88,0x3d,0x9f,0x2c,0xe1,0x0,0xc9,0x1,0x18,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x11,0xd3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x86,0x4e,0xcb,0x0,0xd3,0xd3,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x93,0x12,0xd3,0xd3,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x86,0x5e,0xcb,0x0,0xd3,0xd3,0x0,0xc2,0x1,0x61,0xbc,0xc2,0x1,0x61,0xc6,0xc2,0x1,0x61,0xd0,0xc2,0x1,0x61,0xfa,0xc2,0x1,0x62,0x14,0xc2,0x1,0x62,0x1e,0xc2,0x1,0x62,0x4c,0x2f,0x9f,0x2e,0x9f,0x2e,0x9f,0x2f,0x9f,0x30,0x9f,0x30,0x9f,0x2f,0x9f,0x31,0x9f,0x31,0x9f,0x32,0x9f,0x33,0x9f,0x33,0x9f,0x32,0x9f,0x34,0x9f,0x34,0x9f,0x2e,0xc1,0x6,0xf0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0x35,0xd,0x9f,0x36,0xe5,0x3f,0xc3,0x90,0x2c,0xc4,0xc4,0x9f,0x37,0xe1,0x7,0xc7,0x3,0xe1,0x1,0xc9,0x2,0x15,0xe0,0x0,0xca,0x0,0xc6,0x92,0x37,0xd3,0xd3,0xc6,0x87,0x3d,0xe8,0x0,0xca,0x0,0xc6,0x9,0xd3,0xc4,0x0,0xe1,0x1,0xc9,0x2,0x15,0xe0,0x0,0xca,0x0,0xc6,0x82,0x61,0xd3,0xd3,0xc6,0x85,0x4d,0xe8,0x0,0xca,0x0,0xc6,0x9,0xd3,0xd3,0x0,0xc2,0x1,0x62,0x84,0xc2,0x1,0x62,0x72,0xc2,0x1,0x61,0x82,0xc2,0x1,0x61,0x74,0xc2,0x1,0x62,0x88,0x2c,0x9f,0x39,0x9f,0x39,0x9f,0x3a,0x9f,0x3b,0x9f,0x3c,0x9f,0x3c,0x9f,0x3b,0x9f,0x3a,0x9f,0x3d,0x9f,0x3d,0x9f,0x3d,0x9f,0x39,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9f,0x3e,0xd,0x9f,0x36,0xe5,0x2e,0xc3,0xc4,0xc4,0xc4,0x9f,0x3f,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x9a,0x77,0xd3,0xc6,0x89,0x24,0xd0,0x9f,0x38,0xd3,0xc6,0x9c,0x7d,0xd3,0xe1,0x1,0xc7,0x3,0xc6,0x85,0x59,0xd3,0xd3,0x0,0xc2,0x1,0x63,0x14,0xc2,0x1,0x63,0x36,0xc2,0x1,0x63,0x2e,0x28,0x9f,0x41,0x9f,0x41,0x9f,0x42,0x9f,0x42,0x9f,0x43,0x9f,0x43,0x9f,0x42,0x9f,0x41,0xc1,0x6,0xf8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0x44,0xd,0x9f,0x45,0xbf,0xc3,0xc4,0xc4,0xc4,0x9f,0x46,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x60,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x88,0x71,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x63,0x74,0xc2,0x1,0x63,0x98,0xc2,0x1,0x63,0x90,0x28,0x9f,0x48,0x9f,0x48,0x9f,0x49,0x9f,0x49,0x9f,0x4a,0x9f,0x4a,0x9f,0x49,0x9f,0x48,0xc1,0x6,0xfa,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0x4b,0xd,0x9f,0x4c,0xbf,0xc3,0xc4,0xc4,0xc4,0x9f,0x4d,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x79,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x88,0x71,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x63,0x4,0x26,0x9f,0x4f,0x9f,0x4f,0xc0,0xc0,0xc0,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9f,0x50,0xd,0x9f,0x45,0xbe,0xc3,0xc4,0xc4,0xc4,0x9f,0x51,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x3e,0xd3,0xe3,0x0,0xd0,0x9f,0x47,0xd3,0xc0,0xe3,0x0,0xd0,0x9f,0x4e,0xd3,0xd4,0x0,0xc2,0x1,0x63,0xe8,0xc2,0x1,0x64,0x8,0xc2,0x1,0x64,0x0,0x28,0x9f,0x53,0x9f,0x53,0x9f,0x54,0x9f,0x54,0x9f,0x55,0x9f,0x55,0x9f,0x54,0x9f,0x53,0xc1,0x6,0xfc,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0x56,0xd,0x9f,0x57,0xbf,0xc3,0xc4,0xc4,0xc4,0x9f,0x58,0xe1,0x2,0xc7,0x3,0xc6,0x84,0x6c,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x71,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x64,0x8c,0xc2,0x1,0x64,0xb0,0xc2,0x1,0x64,0xa8,0xc2,0x1,0x64,0xca,0xc2,0x1,0x64,0xc2,0x2d,0x9f,0x5a,0x9f,0x5a,0x9f,0x5b,0x9f,0x5b,0x9f,0x5c,0x9f,0x5c,0x9f,0x5b,0x9f,0x5d,0x9f,0x5d,0x9f,0x5e,0x9f,0x5e,0x9f,0x5d,0x9f,0x5a,0xc1,0x7,0x0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0x5f,0xd,0x9f,0x60,0xe5,0x2f,0xc3,0xc4,0xc4,0xc4,0x9f,0x61,0xe1,0x3,0xc7,0x3,0xc6,0x86,0xc,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8d,0x33,0xd3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x88,0x71,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x65,0x8,0xc2,0x1,0x65,0x28,0xc2,0x1,0x65,0x20,0xc2,0x1,0x65,0x42,0xc2,0x1,0x65,0x3a,0x2d,0x9f,0x63,0x9f,0x63,0x9f,0x64,0x9f,0x64,0x9f,0x65,0x9f,0x65,0x9f,0x64,0x9f,0x66,0x9f,0x66,0x9f,0x67,0x9f,0x67,0x9f,0x66,0x9f,0x63,0xc1,0x7,0x2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0x68,0xd,0x9f,0x69,0xe5,0x2f,0xc3,0xc4,0xc4,0xc4,0x9f,0x6a,0xe1,0x3,0xc7,0x3,0xc6,0x84,0x5a,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x8d,0x33,0xd3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x1,0x0,0xc6,0x88,0x71,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x64,0x7c,0x26,0x9f,0x6c,0x9f,0x6c,0xc0,0xc0,0xc0,0xc0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x9f,0x6d,0xd,0x9f,0x60,0xbe,0xc3,0xc4,0xc4,0xc4,0x9f,0x6e,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x3e,0xd3,0xe3,0x0,0xd0,0x9f,0x62,0xd3,0xc0,0xe3,0x0,0xd0,0x9f,0x6b,0xd3,0xd4,0x0,0xc2,0x1,0x65,0x92,0xc2,0x1,0x65,0xb8,0xc2,0x1,0x65,0xb0,0xc2,0x1,0x65,0xd2,0xc2,0x1,0x65,0xca,0x2d,0x9f,0x70,0x9f,0x70,0x9f,0x71,0x9f,0x71,0x9f,0x72,0x9f,0x72,0x9f,0x71,0x9f,0x73,0x9f,0x73,0x9f,0x74,0x9f,0x74,0x9f,0x73,0x9f,0x70,0xc1,0x7,0x4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0x75,0xd,0x9f,0x76,0xe5,0x2f,0xc3,0xc4,0xc4,0xc4,0x9f,0x77,0xe1,0x3,0xc7,0x3,0xc6,0x84,0x48,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8d,0x33,0xd3,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x71,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x66,0x22,0xc2,0x1,0x66,0x40,0xc2,0x1,0x66,0x54,0x27,0x9f,0x79,0x9f,0x79,0x9f,0x7a,0x9f,0x7a,0x9f,0x7b,0x9f,0x7b,0x9f,0x79,0xc1,0x7,0x6,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x9f,0x7c,0xd,0x9f,0x7d,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x9f,0x7e,0xe1,0x3,0xc7,0x3,0xc6,0x83,0x79,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0xd,0xd3,0xd3,0x0,0xc2,0x1,0x66,0xa8,0x23,0xa0,0x0,0xa0,0x0,0xa0,0x0,0xc1,0x7,0x8,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa0,0x1,0xd,0xa0,0x2,0xaf,0xc3,0xc4,0xc4,0xc4,0xa0,0x3,0xe1,0x1,0xc7,0x3,0xc6,0x85,0x6,0xd3,0x0,0xc2,0x1,0x67,0x0,0xc2,0x1,0x67,0x28,0xc2,0x1,0x67,0x20,0x28,0xa0,0x5,0xa0,0x5,0xa0,0x6,0xa0,0x6,0xa0,0x7,0xa0,0x7,0xa0,0x6,0xa0,0x5,0xc1,0x7,0xa,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa0,0x8,0xd,0xa0,0x9,0xbf,0xc3,0xc4,0xc4,0xc4,0xa0,0xa,0xe1,0x2,0xc7,0x3,0xc6,0x85,0xd,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8d,0x33,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x67,0x78,0x23,0xa0,0xc,0xa0,0xc,0xa0,0xc,0xc1,0x7,0xc,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa0,0xd,0xd,0xa0,0xe,0xaf,0xc3,0xc4,0xc4,0xc4,0xa0,0xf,0xe1,0x1,0xc7,0x3,0xc6,0x85,0x1a,0xd3,0x0,0xc2,0x1,0x67,0xd0,0xc2,0x1,0x67,0xf8,0xc2,0x1,0x67,0xf0,0x28,0xa0,0x11,0xa0,0x11,0xa0,0x12,0xa0,0x12,0xa0,0x13,0xa0,0x13,0xa0,0x12,0xa0,0x11,0xc1,0x7,0xe,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa0,0x14,0xd,0xa0,0x15,0xbf,0xc3,0xc4,0xc4,0xc4,0xa0,0x16,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x21,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8d,0x33,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x68,0xa8,0x22,0xa0,0x18,0xa0,0x18,0xc1,0x7,0x12,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa0,0x19,0xd,0xa0,0x1a,0xb0,0xc3,0x9a,0x62,0xc4,0xc4,0xa0,0x1b,0xe1,0x1,0xc9,0x2,0x15,0xca,0x0,0xd3,0x0,0x8,0x65,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x73,0x21,0xa0,0x1d,0xc2,0x1,0x68,0x84,0xc2,0x1,0x68,0x7a,0xc2,0x1,0x69,0x6a,0xc2,0x1,0x69,0x54,0xc2,0x1,0x68,0xd2,0xc2,0x1,0x68,0xee,0xc2,0x1,0x69,0xa,0xc2,0x1,0x69,0x34,0xc2,0x1,0x69,0x6e,0xc2,0x1,0x69,0x8c,0x38,0xa0,0x1f,0xa0,0x20,0xa0,0x20,0xa0,0x1f,0xa0,0x21,0xa0,0x21,0xa0,0x22,0xa0,0x22,0xa0,0x23,0xa0,0x23,0xa0,0x24,0xa0,0x24,0xa0,0x25,0xa0,0x25,0xa0,0x26,0xa0,0x26,0xa0,0x23,0xa0,0x22,0xa0,0x27,0xa0,0x27,0xa0,0x28,0xa0,0x28,0xa0,0x27,0xa0,0x21,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa0,0x29,0xd,0xa0,0x1a,0xe5,0x60,0xc3,0xc4,0xa0,0x1e,0x88,0x3d,0xa0,0x2a,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x83,0x5f,0xd3,0xc6,0x89,0x24,0xd0,0xa0,0x1c,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x6,0xc7,0x3,0xc6,0x87,0x1b,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x44,0xd3,0xc6,0x83,0x79,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x20,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x6a,0x48,0xc2,0x1,0x6a,0x2a,0xc2,0x1,0x6a,0x3e,0xc2,0x1,0x6a,0x54,0xc2,0x1,0x6a,0x58,0x2c,0xa0,0x2c,0xa0,0x2c,0xa0,0x2d,0xa0,0x2d,0xa0,0x2e,0xa0,0x2e,0xa0,0x2d,0xa0,0x2f,0xa0,0x30,0xa0,0x30,0xa0,0x2f,0xa0,0x2c,0xc1,0x7,0x18,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa0,0x31,0xd,0xa0,0x32,0xe5,0x2f,0xc3,0x82,0x67,0xc4,0xc4,0xa0,0x33,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x5f,0xe0,0x1,0xca,0x0,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x15,0xe0,0x1,0xca,0x0,0xc6,0x83,0x3d,0xc4,0x2,0xd3,0xd3,0xd3,0x0,0x8,0x74,0x6f,0x4f,0x62,0x6a,0x65,0x63,0x74,0x21,0x96,0x1f,0xc2,0x1,0x6a,0x16,0xc2,0x1,0x6a,0xc,0xc2,0x1,0x6b,0x4e,0xc2,0x1,0x6b,0x40,0xc2,0x1,0x6a,0x7c,0xc2,0x1,0x6a,0x98,0xc2,0x1,0x6a,0xa8,0xc2,0x1,0x6a,0xc0,0xc2,0x1,0x6a,0xb4,0xc2,0x1,0x6a,0xe6,0xc2,0x1,0x6b,0x2a,0xc2,0x1,0x6b,0x22,0xc2,0x1,0x6b,0x52,0xc2,0x1,0x6b,0x70,0xe1,0x22,0xa0,0x37,0xa0,0x38,0xa0,0x38,0xa0,0x37,0xa0,0x39,0xa0,0x39,0xa0,0x3a,0xa0,0x3a,0xa0,0x3b,0xa0,0x3b,0xa0,0x3c,0xa0,0x3c,0xa0,0x3d,0xa0,0x3d,0xa0,0x3e,0xa0,0x3e,0xa0,0x3f,0xa0,0x3f,0xa0,0x3e,0xa0,0x3d,0xa0,0x40,0xa0,0x40,0xa0,0x41,0xa0,0x42,0xa0,0x42,0xa0,0x41,0xa0,0x3b,0xa0,0x3a,0xa0,0x43,0xa0,0x43,0xa0,0x44,0xa0,0x44,0xa0,0x43,0xa0,0x39,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa0,0x45,0xd,0xa0,0x32,0xe5,0x81,0x0,0xc3,0xc4,0xa0,0x36,0x88,0x3d,0xa0,0x46,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x96,0x1f,0xd3,0xc6,0x89,0x24,0xd0,0xa0,0x34,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x8,0xc7,0x3,0xc6,0x87,0x1b,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xe1,0x2,0xc7,0x9,0xc4,0x1,0xe1,0x2,0xc7,0x13,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x44,0xd3,0xc4,0x2,0xd3,0xd3,0xc6,0x83,0x79,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0x26,0xc6,0x83,0x5f,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0x24,0xd3,0xc6,0xa0,0x35,0xd3,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x6c,0x26,0xc2,0x1,0x6c,0x8,0xc2,0x1,0x6c,0x1c,0xc2,0x1,0x6c,0x32,0xc2,0x1,0x6c,0x36,0x2c,0xa0,0x48,0xa0,0x48,0xa0,0x49,0xa0,0x49,0xa0,0x4a,0xa0,0x4a,0xa0,0x49,0xa0,0x4b,0xa0,0x4c,0xa0,0x4c,0xa0,0x4b,0xa0,0x48,0xc1,0x7,0x1e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa0,0x4d,0xd,0xa0,0x4e,0xe5,0x2f,0xc3,0x82,0x67,0xc4,0xc4,0xa0,0x4f,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x3,0xc6,0x83,0x5f,0xe0,0x1,0xca,0x0,0xc6,0x83,0x3d,0xc4,0x1,0xd3,0xd3,0xe1,0x1,0xc9,0x2,0x15,0xe0,0x1,0xca,0x0,0xc6,0x83,0x3d,0xc4,0x2,0xd3,0xd3,0xd3,0x0,0x5,0x5f,0x5f,0x6d,0x61,0x70,0xc2,0x1,0x6b,0xf4,0xc2,0x1,0x6b,0xea,0xc2,0x1,0x6d,0x26,0xc2,0x1,0x6d,0x18,0xc2,0x1,0x6c,0x5a,0xc2,0x1,0x6c,0x76,0xc2,0x1,0x6c,0x86,0xc2,0x1,0x6c,0x9e,0xc2,0x1,0x6c,0x92,0xc2,0x1,0x6c,0xc4,0xc2,0x1,0x6d,0x2,0xc2,0x1,0x6c,0xfa,0xc2,0x1,0x6d,0x2a,0xc2,0x1,0x6d,0x48,0xe1,0x22,0xa0,0x52,0xa0,0x53,0xa0,0x53,0xa0,0x52,0xa0,0x54,0xa0,0x54,0xa0,0x55,0xa0,0x55,0xa0,0x56,0xa0,0x56,0xa0,0x57,0xa0,0x57,0xa0,0x58,0xa0,0x58,0xa0,0x59,0xa0,0x59,0xa0,0x5a,0xa0,0x5a,0xa0,0x59,0xa0,0x58,0xa0,0x5b,0xa0,0x5b,0xa0,0x5c,0xa0,0x5d,0xa0,0x5d,0xa0,0x5c,0xa0,0x56,0xa0,0x55,0xa0,0x5e,0xa0,0x5e,0xa0,0x5f,0xa0,0x5f,0xa0,0x5e,0xa0,0x54,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa0,0x60,0xd,0xa0,0x4e,0xe5,0x81,0x1,0xc3,0xc4,0xa0,0x36,0x88,0x3d,0xa0,0x61,0xf0,0x1,0x82,0x62,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x96,0x1f,0xd3,0xc6,0x89,0x24,0xd0,0xa0,0x50,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x9,0xe1,0x8,0xc7,0x3,0xc6,0x87,0x1b,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xe1,0x2,0xc7,0x9,0xc4,0x1,0xe1,0x2,0xc7,0x13,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x44,0xd3,0xc4,0x2,0xd3,0xd3,0xc6,0x83,0x79,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0xa0,0x51,0xc6,0x83,0x5f,0xe0,0x0,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0x24,0xd3,0xc6,0xa0,0x35,0xd3,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x3,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0xd3,0x0,0x6,0x5f,0x62,0x6c,0x65,0x73,0x73,0xc2,0x1,0x6d,0xb0,0xc2,0x1,0x6d,0xcc,0xc2,0x1,0x6d,0xfa,0xc2,0x1,0x6e,0x22,0xc2,0x1,0x6e,0x2c,0xc2,0x1,0x6e,0x4a,0xc2,0x1,0x6e,0x54,0xc2,0x1,0x6e,0x82,0x31,0xa0,0x64,0xa0,0x64,0xa0,0x65,0xa0,0x65,0xa0,0x66,0xa0,0x66,0xa0,0x67,0xa0,0x68,0xa0,0x68,0xa0,0x67,0xa0,0x69,0xa0,0x6a,0xa0,0x6a,0xa0,0x69,0xa0,0x6b,0xa0,0x6b,0xa0,0x64,0xc1,0x7,0x24,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa0,0x6c,0xd,0xa0,0x6d,0xe5,0x50,0xc3,0xc4,0xc4,0xc4,0xa0,0x6e,0xe1,0xa,0xc7,0x3,0xc6,0x87,0x1b,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc4,0x2,0xc6,0x83,0x79,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xc6,0xa0,0x63,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x95,0x70,0xd3,0xd3,0xe1,0x1,0xc9,0x1,0x15,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x63,0xd3,0xd3,0xc6,0x85,0x4d,0xe8,0x0,0xc8,0x0,0x0,0xc6,0x9,0xd3,0xd3,0x0,0xc2,0x1,0x6f,0x62,0x22,0xa0,0x70,0xa0,0x70,0xc1,0x7,0x2c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa0,0x71,0xd,0xa0,0x72,0xb0,0xc3,0xc4,0xc4,0xc4,0xa0,0x73,0xe8,0x0,0xc8,0x1,0x0,0xc6,0x8b,0x3d,0xd3,0x0,0x2,0x2c,0x20,0xc2,0x1,0x6f,0x7e,0xc2,0x1,0x6f,0x76,0x23,0xa0,0x76,0xa0,0x77,0xa0,0x76,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa0,0x78,0xd,0xa0,0x72,0xaf,0xc3,0xc4,0xc4,0xc4,0xa0,0x79,0xe1,0x1,0xc7,0x1b,0xc8,0x1,0x0,0xd3,0x0,0xc2,0x1,0x6e,0xca,0xc2,0x1,0x6e,0xc0,0xc2,0x1,0x6e,0xfe,0xc2,0x1,0x6e,0xf4,0xc2,0x1,0x6f,0x8,0xc2,0x1,0x6f,0x0,0xc2,0x1,0x6f,0x38,0xc2,0x1,0x6f,0x2e,0x33,0xa0,0x7b,0xa0,0x7c,0xa0,0x7b,0xa0,0x7d,0xa0,0x7e,0xa0,0x7f,0xa1,0x0,0xa0,0x7f,0xa0,0x7d,0xa1,0x1,0xa1,0x2,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xa1,0x1,0xc1,0x7,0x28,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa1,0x3,0xd,0xa1,0x4,0xe5,0x38,0xc3,0xc4,0xc4,0xc4,0xa1,0x5,0xe1,0x1,0xc7,0x25,0xc6,0x9b,0x11,0xd3,0xe1,0x1,0xc7,0x25,0xe1,0x1,0xc7,0x1b,0xc8,0x0,0x0,0xd3,0xd3,0xe1,0x1,0xc7,0x19,0xe1,0x4,0xc7,0x1a,0xc6,0x9b,0x12,0xe1,0x0,0xd0,0xa0,0x74,0xd3,0xc6,0xa0,0x75,0xe1,0x0,0xd0,0xa0,0x7a,0xd3,0xd3,0xd3,0x0,0x4,0x65,0x6d,0x69,0x74,0xc2,0x1,0x3c,0xca,0xc2,0x1,0x3d,0x20,0xc2,0x1,0x3d,0x74,0xc2,0x1,0x3d,0xca,0xc2,0x1,0x3e,0x24,0xc2,0x1,0x3e,0x14,0xc2,0x1,0x3f,0xce,0xc2,0x1,0x3f,0xc2,0xc2,0x1,0x40,0x40,0xc2,0x1,0x40,0x34,0xc2,0x1,0x40,0xb2,0xc2,0x1,0x40,0xa6,0xc2,0x1,0x41,0x2c,0xc2,0x1,0x41,0x20,0xc2,0x1,0x41,0xa2,0xc2,0x1,0x41,0x96,0xc2,0x1,0x42,0x46,0xc2,0x1,0x42,0x3a,0xc2,0x1,0x44,0x2e,0xc2,0x1,0x44,0x22,0xc2,0x1,0x47,0x86,0xc2,0x1,0x47,0x7a,0xc2,0x1,0x48,0x6e,0xc2,0x1,0x48,0x62,0xc2,0x1,0x4d,0x3c,0xc2,0x1,0x4d,0x24,0xc2,0x1,0x4d,0x18,0xc2,0x1,0x4d,0x56,0xc2,0x1,0x4d,0x4a,0xc2,0x1,0x53,0x26,0xc2,0x1,0x53,0x1a,0xc2,0x1,0x54,0x6c,0xc2,0x1,0x54,0x60,0xc2,0x1,0x55,0x9c,0xc2,0x1,0x55,0x90,0xc2,0x1,0x56,0xca,0xc2,0x1,0x56,0xbe,0xc2,0x1,0x57,0xf6,0xc2,0x1,0x57,0xea,0xc2,0x1,0x59,0x86,0xc2,0x1,0x59,0x7a,0xc2,0x1,0x5b,0x30,0xc2,0x1,0x5b,0x24,0xc2,0x1,0x5d,0xc,0xc2,0x1,0x5d,0x0,0xc2,0x1,0x5e,0xa0,0xc2,0x1,0x5e,0x94,0xc2,0x1,0x5f,0xc,0xc2,0x1,0x5f,0x0,0xc2,0x1,0x60,0x22,0xc2,0x1,0x60,0x16,0xc2,0x1,0x61,0x36,0xc2,0x1,0x61,0x2a,0xc2,0x1,0x62,0xc2,0xc2,0x1,0x62,0xb6,0xc2,0x1,0x63,0xca,0xc2,0x1,0x63,0xbe,0xc2,0x1,0x64,0x3a,0xc2,0x1,0x64,0x2e,0xc2,0x1,0x65,0x74,0xc2,0x1,0x65,0x68,0xc2,0x1,0x66,0x4,0xc2,0x1,0x65,0xf8,0xc2,0x1,0x66,0x8a,0xc2,0x1,0x66,0x7e,0xc2,0x1,0x66,0xe2,0xc2,0x1,0x66,0xd6,0xc2,0x1,0x67,0x5a,0xc2,0x1,0x67,0x4e,0xc2,0x1,0x67,0xb2,0xc2,0x1,0x67,0xa6,0xc2,0x1,0x68,0x2a,0xc2,0x1,0x68,0x1e,0xc2,0x1,0x69,0xc0,0xc2,0x1,0x69,0xb4,0xc2,0x1,0x6b,0xa4,0xc2,0x1,0x6b,0x98,0xc2,0x1,0x6d,0x7c,0xc2,0x1,0x6d,0x70,0xe1,0x82,0x18,0xa1,0x8,0xa1,0x8,0xa1,0x8,0xc0,0xc0,0xa1,0x9,0xa1,0x9,0xa1,0x9,0xc0,0xc0,0xa1,0xa,0xa1,0xa,0xa1,0xa,0xc0,0xc0,0xa1,0xb,0xa1,0xb,0xa1,0xb,0xc0,0xc0,0xa1,0xc,0xa1,0xd,0xa1,0xc,0xc0,0xc0,0xa1,0xe,0xa1,0xe,0xa1,0xf,0xa1,0xf,0xa1,0xe,0xc0,0xc0,0xa1,0x10,0xa1,0x10,0xa1,0x11,0xa1,0x11,0xa1,0x10,0xc0,0xc0,0xa1,0x12,0xa1,0x12,0xa1,0x13,0xa1,0x13,0xa1,0x12,0xc0,0xc0,0xa1,0x14,0xa1,0x14,0xa1,0x15,0xa1,0x15,0xa1,0x14,0xc0,0xc0,0xa1,0x16,0xa1,0x16,0xa1,0x17,0xa1,0x17,0xa1,0x16,0xc0,0xc0,0xa1,0x18,0xa1,0x18,0xa1,0x19,0xa1,0x19,0xa1,0x18,0xc0,0xc0,0xa1,0x1a,0xa1,0x1a,0xa1,0x1b,0xa1,0x1b,0xa1,0x1a,0xc0,0xc0,0xa1,0x1c,0xa1,0x1c,0xa1,0x1d,0xa1,0x1d,0xa1,0x1c,0xc0,0xc0,0xa1,0x1e,0xa1,0x1e,0xa1,0x1f,0xa1,0x1f,0xa1,0x1e,0xc0,0xc0,0xa1,0x20,0xa1,0x20,0xa1,0x21,0xa1,0x21,0xa1,0x22,0xa1,0x22,0xa1,0x21,0xa1,0x23,0xa1,0x23,0xa1,0x24,0xa1,0x24,0xa1,0x23,0xa1,0x20,0xc0,0xc0,0xa1,0x25,0xa1,0x25,0xa1,0x26,0xa1,0x26,0xa1,0x25,0xc0,0xc0,0xa1,0x27,0xa1,0x27,0xa1,0x28,0xa1,0x28,0xa1,0x27,0xc0,0xc0,0xa1,0x29,0xa1,0x29,0xa1,0x2a,0xa1,0x2a,0xa1,0x29,0xc0,0xc0,0xa1,0x2b,0xa1,0x2b,0xa1,0x2c,0xa1,0x2c,0xa1,0x2b,0xc0,0xc0,0xa1,0x2d,0xa1,0x2d,0xa1,0x2e,0xa1,0x2e,0xa1,0x2d,0xc0,0xc0,0xa1,0x2f,0xa1,0x2f,0xa1,0x30,0xa1,0x30,0xa1,0x2f,0xc0,0xc0,0xa1,0x31,0xa1,0x31,0xa1,0x32,0xa1,0x32,0xa1,0x31,0xc0,0xc0,0xa1,0x33,0xa1,0x33,0xa1,0x34,0xa1,0x34,0xa1,0x33,0xc0,0xc0,0xa1,0x35,0xa1,0x35,0xa1,0x36,0xa1,0x36,0xa1,0x35,0xc0,0xc0,0xa1,0x37,0xa1,0x37,0xa1,0x38,0xa1,0x38,0xa1,0x37,0xc0,0xc0,0xa1,0x39,0xa1,0x39,0xa1,0x3a,0xa1,0x3a,0xa1,0x39,0xc0,0xc0,0xa1,0x3b,0xa1,0x3b,0xa1,0x3c,0xa1,0x3c,0xa1,0x3b,0xc0,0xc0,0xa1,0x3d,0xa1,0x3d,0xa1,0x3e,0xa1,0x3e,0xa1,0x3d,0xc0,0xc0,0xa1,0x3f,0xa1,0x3f,0xa1,0x40,0xa1,0x40,0xa1,0x3f,0xc0,0xc0,0xa1,0x41,0xa1,0x41,0xa1,0x42,0xa1,0x42,0xa1,0x41,0xc0,0xc0,0xa1,0x43,0xa1,0x43,0xa1,0x44,0xa1,0x44,0xa1,0x43,0xc0,0xc0,0xa1,0x45,0xa1,0x45,0xa1,0x46,0xa1,0x46,0xa1,0x45,0xc0,0xc0,0xa1,0x47,0xa1,0x47,0xa1,0x48,0xa1,0x48,0xa1,0x47,0xc0,0xc0,0xa1,0x49,0xa1,0x49,0xa1,0x4a,0xa1,0x4a,0xa1,0x49,0xc0,0xc0,0xa1,0x4b,0xa1,0x4b,0xa1,0x4c,0xa1,0x4c,0xa1,0x4b,0xc0,0xc0,0xa1,0x4d,0xa1,0x4d,0xa1,0x4e,0xa1,0x4e,0xa1,0x4d,0xc0,0xc0,0xa1,0x4f,0xa1,0x4f,0xa1,0x50,0xa1,0x50,0xa1,0x4f,0xc0,0xc0,0xa1,0x51,0xa1,0x51,0xa1,0x52,0xa1,0x52,0xa1,0x51,0xc0,0xc0,0xa1,0x53,0xa1,0x53,0xa1,0x54,0xa1,0x54,0xa1,0x53,0xc0,0xc0,0xa1,0x55,0xa1,0x55,0xa1,0x56,0xa1,0x56,0xa1,0x55,0xc0,0xc0,0xc0,0xc0,0xc1,0x6,0x44,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa1,0x57,0xd,0xa1,0x58,0xe5,0x86,0x72,0xa1,0x7,0x90,0x2c,0xc4,0xc4,0xa1,0x59,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x9b,0x67,0xd3,0xe3,0x0,0xd0,0x9b,0x6c,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x84,0x2d,0xd3,0xe3,0x0,0xd0,0x9b,0x71,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x68,0xd3,0xe3,0x0,0xd0,0x9b,0x76,0xd3,0xe1,0x2,0xc7,0x0,0xca,0x0,0xc6,0x84,0x20,0xd3,0xe3,0x0,0xd0,0x9b,0x7b,0xd3,0xe1,0x1,0xc7,0x26,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x9c,0x19,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x5d,0xd3,0xe3,0x0,0xd0,0x9c,0x1f,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x83,0x5f,0xd3,0xe3,0x0,0xd0,0x9c,0x25,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x44,0xd3,0xe3,0x0,0xd0,0x9c,0x2b,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x83,0x5e,0xd3,0xe3,0x0,0xd0,0x9c,0x31,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x94,0x1e,0xd3,0xe3,0x0,0xd0,0x9c,0x3c,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x96,0x68,0xd3,0xe3,0x0,0xd0,0x9c,0x5b,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x97,0x3f,0xd3,0xe3,0x0,0xd0,0x9d,0x15,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x93,0x7c,0xd3,0xe3,0x0,0xd0,0x9d,0x1d,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x90,0x18,0xd3,0xe3,0x0,0xd0,0x9d,0x56,0xd3,0xe1,0x2,0xc7,0x1f,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x97,0x20,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x99,0x18,0xd3,0xd3,0xe3,0x0,0xd0,0x9e,0x1a,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x99,0x41,0xd3,0xe3,0x0,0xd0,0x9e,0x26,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0xd,0xd3,0xe3,0x0,0xd0,0x9e,0x30,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x8a,0x31,0xd3,0xe3,0x0,0xd0,0x9e,0x3a,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x8a,0x62,0xd3,0xe3,0x0,0xd0,0x9e,0x45,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x83,0x43,0xd3,0xe3,0x0,0xd0,0x9e,0x53,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x90,0x3c,0xd3,0xe3,0x0,0xd0,0x9e,0x68,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x90,0x7d,0xd3,0xe3,0x0,0xd0,0x9e,0x7c,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x83,0x52,0xd3,0xe3,0x0,0xd0,0x9f,0xa,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x83,0x42,0xd3,0xe3,0x0,0xd0,0x9f,0x10,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x39,0xd3,0xe3,0x0,0xd0,0x9f,0x1f,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x89,0x1f,0xd3,0xe3,0x0,0xd0,0x9f,0x2d,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x9a,0x77,0xd3,0xe3,0x0,0xd0,0x9f,0x40,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0x79,0xd3,0xe3,0x0,0xd0,0x9f,0x52,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0x6c,0xd3,0xe3,0x0,0xd0,0x9f,0x59,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0x5a,0xd3,0xe3,0x0,0xd0,0x9f,0x6f,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x84,0x48,0xd3,0xe3,0x0,0xd0,0x9f,0x78,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x83,0x79,0xd3,0xe3,0x0,0xd0,0x9f,0x7f,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x85,0x6,0xd3,0xe3,0x0,0xd0,0xa0,0x4,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x85,0xd,0xd3,0xe3,0x0,0xd0,0xa0,0xb,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x85,0x1a,0xd3,0xe3,0x0,0xd0,0xa0,0x10,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x85,0x21,0xd3,0xe3,0x0,0xd0,0xa0,0x17,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x96,0x24,0xd3,0xe3,0x0,0xd0,0xa0,0x2b,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x96,0x21,0xd3,0xe3,0x0,0xd0,0xa0,0x47,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x89,0x24,0xd3,0xe3,0x0,0xd0,0xa0,0x62,0xd3,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x3d,0xd3,0xc6,0x8b,0x63,0xd3,0xe3,0x0,0xd0,0xa0,0x6f,0xd3,0xc0,0xe3,0x0,0xd0,0xa1,0x6,0xd3,0xd4,0x0,0xc2,0x1,0x70,0xbc,0x22,0xa1,0x5b,0xa1,0x5b,0xc1,0x7,0x34,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa1,0x5c,0xd,0xa1,0x5d,0xb0,0xc3,0x90,0x2c,0xc4,0xc4,0xa1,0x5e,0xe1,0x1,0xc9,0x2,0x15,0xca,0x0,0xd3,0x0,0xc2,0x1,0x70,0x9a,0x22,0xa1,0x60,0xa1,0x60,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa1,0x61,0xd,0xa1,0x5d,0xb5,0xc3,0xc4,0xc4,0xc4,0xa1,0x62,0xf0,0x1,0x82,0x62,0xc8,0x0,0x0,0xc6,0x89,0x24,0xd0,0xa1,0x5f,0xd3,0x0,0xc2,0x1,0x71,0x14,0x23,0xa1,0x64,0xa1,0x64,0xa1,0x64,0xc1,0x7,0x36,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa1,0x65,0xd,0xa1,0x66,0xaf,0xc3,0xc4,0xc4,0xc4,0xa1,0x67,0xe1,0x1,0xc7,0x3,0xc6,0x84,0x2d,0xd3,0x0,0x8,0x65,0x6d,0x69,0x74,0x62,0x6f,0x64,0x79,0x21,0x9e,0x1c,0xc2,0x1,0x70,0x68,0xc2,0x1,0x70,0x84,0xc2,0x1,0x70,0x78,0x2c,0xa1,0x6b,0xa1,0x6b,0xa1,0x6c,0xa1,0x6c,0xa1,0x6d,0xa1,0x6d,0xa1,0x6c,0xa1,0x6b,0xc0,0xc0,0xc0,0xc0,0xc1,0x7,0x32,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa1,0x6e,0xd,0xa1,0x6f,0xe5,0x2d,0xa1,0x69,0xa1,0x6a,0xc4,0xc4,0xa1,0x70,0xe1,0x2,0xc7,0x5,0xca,0x0,0xe1,0x2,0xc7,0x1c,0xe0,0x0,0xca,0x0,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xd3,0xe3,0x0,0xd0,0xa1,0x63,0xd3,0xc0,0xe3,0x0,0xd0,0xa1,0x68,0xd3,0xd4,0x0,0x8,0x6e,0x65,0x77,0x6c,0x61,0x62,0x65,0x6c,0xc1,0x7,0x3c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0x83,0x3e,0xd,0xa1,0x73,0xb5,0xa1,0x72,0xc4,0xc4,0xc4,0xa1,0x74,0xe1,0x2,0xc7,0x9,0xc9,0x0,0x17,0xc4,0x1,0xd3,0xd9,0x0,0x17,0x0,0xc2,0x1,0x72,0x12,0x22,0xa1,0x76,0xa1,0x76,0xc1,0x7,0x42,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa1,0x77,0xd,0xa1,0x78,0xb0,0xc3,0x90,0x2c,0xc4,0xc4,0xa1,0x79,0xe1,0x1,0xc9,0x1,0x15,0xca,0x0,0xd3,0x0,0x66,0x89,0x30,0xc0,0x83,0x3c,0xc0,0x9,0xc0,0x89,0xf,0xc0,0x89,0xd,0xc0,0x85,0x6,0xc0,0x7,0x65,0x6d,0x69,0x74,0x74,0x6f,0x70,0x21,0x8b,0x42,0x22,0xa1,0x7d,0x8b,0x46,0x21,0x83,0x3c,0xc2,0x1,0x72,0x20,0xc2,0x1,0x71,0xf0,0xc2,0x1,0x71,0xe6,0xc2,0x1,0x72,0x7e,0xc2,0x1,0x72,0x6e,0xc2,0x1,0x72,0x62,0xc2,0x1,0x72,0x9e,0xc2,0x1,0x72,0xbc,0xc2,0x1,0x72,0xd4,0xc2,0x1,0x72,0xee,0x39,0xa2,0x0,0xa2,0x1,0xa2,0x2,0xa2,0x2,0xa2,0x1,0xa2,0x0,0xc0,0xc0,0xa2,0x3,0xa2,0x3,0xa2,0x4,0xa2,0x4,0xa2,0x5,0xa2,0x5,0xa2,0x4,0xa2,0x3,0xa2,0x6,0xa2,0x6,0xa2,0x7,0xa2,0x7,0xa2,0x8,0xa2,0x8,0xa2,0x9,0xa2,0x9,0xc0,0xc1,0x7,0x40,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa2,0xa,0xd,0xa2,0xb,0xe5,0x76,0xa1,0x7c,0xa1,0x7e,0xa1,0x7f,0x88,0x3d,0xa2,0xc,0xe0,0x0,0xf0,0x1,0x82,0x62,0xe0,0x0,0xca,0x0,0xc6,0x8f,0x0,0xd3,0xc6,0x89,0x24,0xd0,0xa1,0x7a,0xd3,0xc6,0x9c,0x7d,0xd3,0xd1,0x0,0xe1,0xd,0xc7,0x4,0xc6,0xa1,0x7b,0xc6,0x83,0x3c,0xcb,0x0,0xc6,0x89,0xd,0xe1,0x2,0xc7,0x1f,0xe1,0x2,0xc7,0x1f,0xe8,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xca,0x1,0xd3,0xc6,0x1a,0xd3,0xc6,0x89,0xf,0xe0,0x0,0xca,0x0,0xc6,0x89,0xf,0xd3,0xc6,0x85,0x6,0xe0,0x0,0xca,0x0,0xc6,0x85,0x6,0xd3,0xc6,0x9,0xe0,0x0,0xca,0x0,0xc6,0x9,0xd3,0xc6,0x89,0x30,0xe8,0x0,0xca,0x0,0xc6,0x89,0x30,0xd3,0xd3,0x0,0xc1,0x7,0x4a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0xa2,0xe,0xaa,0xc3,0xc4,0xc4,0xc4,0xa2,0xf,0xc8,0x0,0x1,0x0,0x5,0x70,0x61,0x72,0x73,0x65,0xc2,0x1,0x73,0xbe,0xc2,0x1,0x73,0xb4,0x23,0xa2,0x12,0xa2,0x13,0xa2,0x12,0xc1,0x7,0x4c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa2,0x14,0xd,0xa2,0x15,0xaf,0xc3,0xc4,0xc4,0xc4,0xa2,0x16,0xe1,0x1,0xc7,0x2a,0xc8,0x0,0x0,0xd3,0x0,0x22,0xa1,0x7d,0x8e,0x43,0xc2,0x1,0x75,0x2a,0xc2,0x1,0x75,0x46,0x24,0xa2,0x19,0xa2,0x19,0xa2,0x1a,0xa2,0x1a,0xc1,0x7,0x52,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa2,0x1b,0xd,0xa2,0x1c,0xe5,0x21,0xc3,0xa2,0x18,0xc4,0xc4,0xa2,0x1d,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x38,0xd3,0xdd,0x0,0x0,0x18,0xe1,0x1,0xc9,0x1,0x3,0xca,0x1,0xd3,0xdb,0x0,0x0,0x19,0xc2,0x0,0xc2,0x1,0x75,0x9a,0xc2,0x1,0x75,0xb6,0x24,0xa2,0x1f,0xa2,0x1f,0xa2,0x20,0xa2,0x20,0xc1,0x7,0x54,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa2,0x21,0xd,0xa2,0x22,0xe5,0x21,0xc3,0xa2,0x18,0xc4,0xc4,0xa2,0x23,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x38,0xd3,0xdd,0x0,0x0,0x18,0xe1,0x1,0xc9,0x1,0x3,0xca,0x1,0xd3,0xdb,0x0,0x0,0x19,0xc2,0x0,0xc2,0x1,0x76,0xa,0xc2,0x1,0x76,0x26,0x24,0xa2,0x25,0xa2,0x25,0xa2,0x26,0xa2,0x26,0xc1,0x7,0x56,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa2,0x27,0xd,0xa2,0x28,0xe5,0x21,0xc3,0xa2,0x18,0xc4,0xc4,0xa2,0x29,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x38,0xd3,0xdd,0x0,0x0,0x18,0xe1,0x1,0xc9,0x1,0x3,0xca,0x1,0xd3,0xdb,0x0,0x0,0x19,0xc2,0x0,0xc2,0x1,0x77,0x3c,0xc2,0x1,0x77,0x56,0xc2,0x1,0x77,0x5c,0xc2,0x1,0x77,0x76,0x28,0xa2,0x2b,0xa2,0x2c,0xa2,0x2d,0xa2,0x2d,0xa2,0x2e,0xa2,0x2e,0xa2,0x2c,0xa2,0x2b,0xc1,0x7,0x5c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa2,0x2f,0xd,0xa2,0x30,0xe5,0x29,0xc3,0xa2,0x18,0xc4,0xc4,0xa2,0x31,0xe0,0x2,0xc9,0x1,0x1,0xc6,0x86,0x5f,0xca,0x1,0xe1,0x2,0xc9,0x1,0x19,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x44,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xd3,0xd3,0x0,0x6,0x3c,0x6d,0x61,0x69,0x6e,0x3e,0x9,0x70,0x61,0x72,0x73,0x65,0x65,0x6d,0x69,0x74,0x21,0x5,0x3,0x61,0x73,0x74,0x21,0xa2,0x36,0x23,0xa2,0x35,0xa2,0x37,0x8f,0x50,0x4,0x6d,0x61,0x69,0x6e,0x23,0xa2,0x36,0xa2,0x36,0xa2,0x39,0xc2,0x1,0x73,0xf4,0xc2,0x1,0x74,0x0,0xc2,0x1,0x75,0x0,0xc2,0x1,0x75,0x70,0xc2,0x1,0x75,0xe0,0xc2,0x1,0x77,0xa,0xc2,0x1,0x77,0xb0,0xc2,0x1,0x77,0xec,0x35,0xc0,0xc0,0xc0,0xc0,0xa2,0x3b,0xa2,0x3c,0xa2,0x3c,0xa2,0x3b,0xa2,0x3d,0xa2,0x3d,0xa2,0x3e,0xa2,0x3e,0xa2,0x3f,0xa2,0x3f,0xa2,0x40,0xa2,0x40,0xa2,0x41,0xa2,0x41,0xa2,0x42,0xa2,0x42,0xa2,0x42,0xc1,0x7,0x48,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa2,0x43,0xd,0xa2,0x44,0xe5,0x81,0x1,0xa2,0x34,0xa2,0x38,0xa2,0x3a,0x81,0x4b,0xa2,0x45,0xca,0x1,0xe3,0x0,0xd0,0xa2,0x10,0xd3,0xc0,0xe3,0x0,0xd0,0xa2,0x17,0xd3,0xd4,0xd1,0x0,0xe1,0x3,0xc9,0x0,0x8,0xe1,0x1,0xc9,0x0,0x5,0xc2,0xd3,0xcb,0x0,0xca,0x2,0xd3,0xd1,0x1,0xf0,0x1,0x82,0x62,0xc9,0x0,0x1,0xc6,0x82,0x63,0xd0,0xa2,0x1e,0xd3,0xf0,0x1,0x82,0x62,0xc9,0x0,0x1,0xc6,0x82,0x63,0xd0,0xa2,0x24,0xd3,0xf0,0x1,0x82,0x62,0xc9,0x0,0x1,0xc6,0x82,0x63,0xd0,0xa2,0x2a,0xd3,0xf0,0x1,0x82,0x62,0xc9,0x0,0x1,0xc6,0x82,0x63,0xd0,0xa2,0x32,0xd3,0xe1,0x2,0xc9,0x0,0x19,0xcb,0x1,0xc6,0xa2,0x33,0xd3,0xd1,0x2,0xe1,0x3,0xc7,0x1,0xc4,0x0,0xcb,0x2,0xc9,0x0,0x1,0xd3,0x0,0x4,0x66,0x69,0x6e,0x64,0x5,0x6c,0x69,0x6e,0x65,0x73,0x22,0x8f,0x52,0xa2,0x48,0x22,0xc2,0xc1,0xc0,0xca,0x22,0xd6,0xa2,0x4b,0xc2,0x1,0x78,0xfa,0xc2,0x1,0x78,0xf0,0xc2,0x1,0x79,0x4c,0xc2,0x1,0x79,0x6c,0xc2,0x1,0x79,0x94,0xc2,0x1,0x79,0xd0,0xc2,0x1,0x79,0xe2,0xc2,0x1,0x7a,0x4e,0xc2,0x1,0x7a,0x7c,0x36,0xa2,0x4d,0xa2,0x4e,0xa2,0x4d,0xa2,0x4f,0xc0,0xc0,0xc0,0xa2,0x50,0xa2,0x50,0xa2,0x50,0xa2,0x4f,0xa2,0x51,0xa2,0x51,0xa2,0x51,0xa2,0x52,0xa2,0x53,0xa2,0x53,0xa2,0x52,0xa2,0x54,0xa2,0x54,0xa2,0x55,0xa2,0x55,0xc1,0x7,0x68,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xa2,0x4c,0x9,0xa2,0x56,0xd,0xa2,0x57,0xe5,0x77,0xc3,0xc4,0xa2,0x49,0xa2,0x4a,0xa2,0x58,0xc4,0x0,0xd6,0x0,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xd1,0x1,0xe0,0x2,0xc8,0x0,0x0,0xc6,0xa2,0x47,0xe1,0x1,0xc7,0x2b,0xc4,0xa,0xd3,0xe1,0x2,0xc7,0x9,0xcb,0x0,0xc4,0x1,0xd3,0xd3,0xd6,0x0,0xe1,0x1,0xc7,0x18,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x4c,0xe0,0x1,0xcb,0x1,0xc6,0x3e,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x81,0x44,0xd3,0xd3,0xdb,0x0,0x0,0x65,0xdb,0x0,0x0,0x4d,0xc2,0xcb,0x0,0xdd,0x0,0x0,0x60,0xe0,0x1,0xcb,0x1,0xc6,0x3e,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x61,0xc2,0xdb,0x0,0x0,0xe,0xc2,0xe0,0x0,0xcb,0x1,0xc6,0x89,0x22,0xd3,0x0,0xc2,0x1,0x7c,0xc,0x23,0xa2,0x5a,0xa2,0x5a,0xa2,0x5a,0xc1,0x7,0x88,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa2,0x5b,0xd,0xa2,0x5c,0xb4,0xc3,0xc4,0xc4,0xc4,0xa2,0x5d,0xe1,0x2,0xc7,0x9,0xc9,0x0,0x2,0xc4,0x1,0xd3,0xd9,0x0,0x0,0x0,0xc1,0x7,0x8a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0xa2,0x5f,0xad,0xc3,0xc4,0xc4,0xc4,0xa2,0x60,0xc9,0x0,0x2,0xd9,0x0,0x1,0x0,0xb,0x6c,0x69,0x6e,0x65,0x46,0x72,0x6f,0x6d,0x50,0x6f,0x73,0x21,0x8b,0x47,0x4,0x24,0x6d,0x69,0x6e,0x4,0x24,0x6d,0x61,0x78,0x3,0x6d,0x69,0x64,0x23,0xa2,0x64,0xa2,0x65,0xa2,0x66,0x23,0xc2,0xc2,0xc1,0xc0,0xa4,0x22,0xd7,0xa2,0x69,0xc2,0x1,0x7b,0x26,0xc2,0x1,0x7b,0x58,0xc2,0x1,0x7b,0xa8,0xc2,0x1,0x7b,0x98,0xc2,0x1,0x7b,0xe4,0xc2,0x1,0x7b,0xd8,0xc2,0x1,0x7c,0x8a,0xc2,0x1,0x7c,0xa0,0x3a,0xa2,0x6b,0xa2,0x6b,0xa2,0x6c,0xa2,0x6c,0xa2,0x6c,0xa2,0x6d,0xa2,0x6d,0xa2,0x6e,0xa2,0x6e,0xa2,0x6e,0xa2,0x6d,0xa2,0x6f,0xa2,0x6f,0xa2,0x70,0xa2,0x70,0xa2,0x6f,0xc0,0xc0,0xc0,0xc0,0xa2,0x71,0xa2,0x71,0xa2,0x72,0xa2,0x72,0xa2,0x72,0xa2,0x71,0xc1,0x7,0x7e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xa2,0x6a,0x9,0xa2,0x73,0xd,0xa2,0x74,0xe5,0x70,0xa2,0x62,0xa2,0x63,0xa2,0x67,0xa2,0x68,0xa2,0x75,0xc4,0x1,0xd6,0x0,0xe0,0x0,0xc9,0x0,0x1b,0xc6,0x81,0x44,0xd3,0xd6,0x1,0xe1,0x2,0xc7,0xb,0xcb,0x0,0xcb,0x1,0xd3,0xdd,0x0,0x0,0x52,0xe1,0x2,0xc7,0x2c,0xe1,0x2,0xc7,0x9,0xcb,0x0,0xcb,0x1,0xd3,0xc4,0x2,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0xb,0xe0,0x1,0xc9,0x0,0x1b,0xc6,0x83,0x3d,0xcb,0x2,0xd3,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa2,0x5e,0xd3,0xc0,0xe3,0x0,0xd0,0xa2,0x61,0xd3,0xd4,0xdb,0x0,0x0,0xf,0xc2,0xe1,0x3,0xc7,0x1,0xc4,0x0,0xcb,0x0,0xe1,0x2,0xc7,0x8,0xca,0x0,0xcb,0x0,0xd3,0xd3,0x0,0x9,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0x5,0x64,0x61,0x74,0x61,0x73,0x9,0x64,0x61,0x74,0x61,0x49,0x6e,0x64,0x65,0x78,0xc,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x49,0x6e,0x64,0x65,0x78,0x6,0x63,0x72,0x65,0x61,0x74,0x65,0x7,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x6b,0xa2,0x77,0xc0,0xa2,0x78,0xc0,0xa2,0x79,0xc0,0xa2,0x7a,0xc0,0xa2,0x7b,0xc0,0xa2,0x7c,0xc0,0x8b,0x44,0xc0,0x83,0x79,0xc0,0x83,0x5f,0xc0,0x83,0x3c,0xc0,0x4,0xc0,0xc2,0x1,0x80,0x58,0x22,0xa2,0x7e,0xa2,0x7e,0xc1,0x7,0xaa,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa2,0x7f,0xd,0xa3,0x0,0xb0,0xc3,0x4c,0xc4,0xc4,0xa3,0x1,0xe0,0x1,0xce,0xc6,0x83,0x5f,0xca,0x0,0xd3,0x0,0xc2,0x1,0x80,0x38,0xc2,0x1,0x80,0x3c,0x24,0xa3,0x3,0xa3,0x4,0xa3,0x4,0xa3,0x3,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa3,0x5,0xd,0xa3,0x0,0xbb,0xc3,0xc4,0xc4,0xc4,0xa3,0x6,0xe1,0x1,0xc9,0x3,0x5,0xf0,0x1,0x82,0x62,0xc8,0x0,0x0,0xc6,0x89,0x24,0xd0,0xa3,0x2,0xd3,0xd3,0x0,0xc2,0x1,0x80,0xf6,0xc2,0x1,0x81,0x0,0xc2,0x1,0x81,0x1c,0x27,0xa3,0x8,0xa3,0x8,0xa3,0x9,0xa3,0x9,0xa3,0xa,0xa3,0xa,0xa3,0x8,0xc1,0x7,0xac,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa3,0xb,0xd,0xa3,0xc,0xbf,0xc3,0x95,0x73,0xc4,0xc4,0xa3,0xd,0xe1,0x2,0xc7,0x3,0xe0,0x1,0xce,0xc6,0x83,0x5f,0xca,0x0,0xd3,0xe0,0x1,0xce,0xc6,0x83,0x5f,0xca,0x1,0xd3,0xd3,0x0,0xc2,0x1,0x80,0xc6,0xc2,0x1,0x81,0x32,0xc2,0x1,0x80,0xd4,0xc2,0x1,0x80,0xc8,0x27,0xa3,0xf,0xa3,0x10,0xa3,0x11,0xa3,0x12,0xa3,0x11,0xa3,0x10,0xa3,0xf,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa3,0x13,0xd,0xa3,0xc,0xe5,0x21,0xc3,0xc4,0xc4,0xc4,0xa3,0x14,0xe1,0x1,0xc9,0x3,0x6,0xe0,0x0,0xe0,0x2,0xc7,0x1e,0xc6,0x89,0x24,0xc8,0x0,0x0,0xd0,0xa3,0xe,0xd3,0xc6,0x9c,0x7d,0xd3,0xd3,0x0,0xc2,0x1,0x81,0xa4,0x22,0xa3,0x16,0xa3,0x16,0xc1,0x7,0xae,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa3,0x17,0xd,0xa3,0x18,0xb0,0xc3,0xc4,0xc4,0xc4,0xa3,0x19,0xe1,0x1,0xc9,0x3,0x4,0xc8,0x0,0x0,0xd3,0x0,0xc2,0x1,0x82,0x8,0x22,0xa3,0x1b,0xa3,0x1b,0xc1,0x7,0xb0,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa3,0x1c,0xd,0xa3,0x1d,0xb0,0xc3,0xc4,0xc4,0xc4,0xa3,0x1e,0xe1,0x1,0xc9,0x3,0x2,0xc8,0x0,0x0,0xd3,0x0,0xc2,0x1,0x82,0x6e,0x22,0xa3,0x20,0xa3,0x20,0xc1,0x7,0xb2,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa3,0x21,0xd,0xa3,0x22,0xb0,0xc3,0xc4,0xc4,0xc4,0xa3,0x23,0xe1,0x1,0xc9,0x3,0x3,0xc8,0x0,0x0,0xd3,0x0,0x5,0x45,0x72,0x72,0x6f,0x72,0x1a,0x64,0x6f,0x6e,0x27,0x74,0x20,0x6b,0x6e,0x6f,0x77,0x20,0x68,0x6f,0x77,0x20,0x74,0x6f,0x20,0x65,0x6e,0x63,0x6f,0x64,0x65,0x3a,0x20,0xc2,0x1,0x83,0xa,0xc2,0x1,0x83,0x2,0x23,0xa3,0x27,0xa3,0x28,0xa3,0x27,0xc1,0x7,0xb4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa3,0x29,0xd,0xa3,0x2a,0xaf,0xc3,0xc4,0xc4,0xc4,0xa3,0x2b,0xe1,0x1,0xc7,0x1b,0xc8,0x1,0x0,0xd3,0x0,0xc2,0x1,0x83,0x16,0xc2,0x1,0x82,0xc6,0xc2,0x1,0x82,0xbc,0x2a,0xa3,0x2d,0xa3,0x2e,0xa3,0x2f,0xc0,0xc0,0xc0,0xc0,0xc0,0xa3,0x2e,0xa3,0x2d,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa3,0x30,0xd,0xa3,0x2a,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0xa3,0x31,0xe0,0x0,0xe1,0x1,0xc7,0x2d,0xe1,0x2,0xc7,0x1a,0xc6,0xa3,0x26,0xe1,0x0,0xd0,0xa3,0x2c,0xd3,0xd3,0xd3,0xc6,0x88,0x2d,0xd3,0x0,0x22,0x4b,0xa1,0x7f,0x3,0x62,0x69,0x6e,0x25,0x8b,0x2e,0x8b,0x2e,0xa3,0x34,0x8b,0x49,0x88,0x71,0xc2,0x1,0x7e,0xb2,0xc2,0x1,0x7f,0xc,0xc2,0x1,0x7f,0x4e,0xc2,0x1,0x7f,0x98,0xc2,0x1,0x7f,0x84,0xc2,0x1,0x7f,0xd4,0xc2,0x1,0x80,0x12,0xc2,0x1,0x80,0x6,0xc2,0x1,0x80,0xa6,0xc2,0x1,0x80,0x96,0xc2,0x1,0x81,0x7e,0xc2,0x1,0x81,0x6e,0xc2,0x1,0x81,0xe2,0xc2,0x1,0x81,0xd4,0xc2,0x1,0x82,0x48,0xc2,0x1,0x82,0x38,0xc2,0x1,0x83,0x60,0xc2,0x1,0x83,0x54,0xc2,0x1,0x83,0xf6,0xc2,0x1,0x83,0xe2,0xc2,0x1,0x84,0x14,0xc2,0x1,0x84,0x1c,0xe1,0x37,0xa3,0x36,0xa3,0x36,0xa3,0x36,0xa3,0x37,0xa3,0x37,0xa3,0x38,0xa3,0x38,0xa3,0x38,0xa3,0x39,0xa3,0x3a,0xa3,0x3a,0xa3,0x39,0xa3,0x3b,0xa3,0x3b,0xa3,0x3b,0xa3,0x3c,0xa3,0x3d,0xa3,0x3c,0xc0,0xc0,0xa3,0x3e,0xa3,0x3f,0xa3,0x3e,0xc0,0xc0,0xa3,0x40,0xa3,0x41,0xa3,0x40,0xc0,0xc0,0xa3,0x42,0xa3,0x43,0xa3,0x42,0xc0,0xc0,0xa3,0x44,0xa3,0x45,0xa3,0x44,0xc0,0xc0,0xc0,0xc0,0xa3,0x46,0xa3,0x47,0xa3,0x47,0xa3,0x46,0xa3,0x48,0xa3,0x49,0xa3,0x49,0xa3,0x4a,0xa3,0x4b,0xa3,0x4b,0xa3,0x4b,0xa3,0x4a,0xa3,0x48,0xc1,0x7,0x9e,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa3,0x4c,0xd,0xa3,0x4d,0xe5,0x81,0x5a,0xc3,0xa3,0x33,0xa3,0x35,0x9a,0x27,0xa3,0x4e,0xe1,0x1,0xc7,0x18,0xca,0x1,0xd3,0xdd,0x0,0x0,0x2d,0xe1,0x1,0xc9,0x2,0x0,0xca,0x0,0xd3,0xd1,0x0,0xcb,0x0,0xdd,0x0,0x0,0x28,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x29,0xc2,0xdb,0x0,0x0,0x2e,0xc2,0xe0,0x1,0xe0,0x0,0xce,0xc6,0xa2,0x79,0xd3,0xc6,0x83,0x3d,0xca,0x0,0xd3,0xd1,0x1,0xcb,0x1,0xdd,0x0,0x0,0x52,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x1,0xd3,0xdb,0x0,0x0,0x53,0xc2,0xe1,0x1,0xc7,0x1d,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa3,0x7,0xd3,0xe1,0x1,0xc7,0x22,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa3,0x15,0xd3,0xe1,0x1,0xc7,0x11,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa3,0x1a,0xd3,0xe1,0x1,0xc7,0x27,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa3,0x1f,0xd3,0xe1,0x1,0xc7,0x26,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa3,0x24,0xd3,0xc0,0xe3,0x0,0xd0,0xa3,0x32,0xd3,0xd4,0xd1,0x2,0xe0,0x1,0xe0,0x0,0xce,0xc6,0xa2,0x78,0xd3,0xc6,0x3e,0xcb,0x2,0xd3,0xd2,0x0,0x3,0xd2,0x1,0x4,0xe0,0x2,0xe0,0x0,0xce,0xc6,0xa2,0x79,0xd3,0xc6,0x86,0x5f,0xca,0x0,0xe1,0x1,0xc9,0x2,0x1,0xe1,0x2,0xc7,0x8,0xcb,0x4,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0xb,0x69,0x73,0x53,0x74,0x72,0x69,0x6e,0x67,0x28,0x76,0x29,0x24,0x8b,0x2e,0x8b,0x2e,0x8b,0x49,0x88,0x71,0xc2,0x1,0x84,0x78,0xc2,0x1,0x84,0x6a,0xc2,0x1,0x84,0x88,0xc2,0x1,0x84,0xd6,0xc2,0x1,0x84,0xbc,0xc2,0x1,0x85,0x12,0xc2,0x1,0x85,0x48,0xc2,0x1,0x85,0x9a,0xc2,0x1,0x85,0x8a,0xc2,0x1,0x85,0xe8,0xc2,0x1,0x85,0xce,0xc2,0x1,0x86,0x6,0xc2,0x1,0x86,0xe,0x3c,0xa3,0x52,0xa3,0x53,0xa3,0x54,0xa3,0x52,0xa3,0x54,0xa3,0x52,0xa3,0x55,0xa3,0x56,0xa3,0x56,0xa3,0x55,0xa3,0x57,0xa3,0x57,0xa3,0x57,0xa3,0x58,0xa3,0x58,0xa3,0x59,0xa3,0x5a,0xa3,0x5a,0xa3,0x59,0xa3,0x5b,0xa3,0x5c,0xa3,0x5c,0xa3,0x5d,0xa3,0x5e,0xa3,0x5e,0xa3,0x5e,0xa3,0x5d,0xa3,0x5b,0xc1,0x7,0xbc,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa3,0x5f,0xd,0xa3,0x60,0xe5,0x7b,0xc3,0x4c,0xa3,0x51,0x8c,0x56,0xa3,0x61,0xf1,0x2,0x5e,0xc7,0xa,0xe1,0x1,0xc7,0x11,0xca,0x0,0xd3,0xc6,0xa3,0x50,0xd3,0xe0,0x1,0xe0,0x0,0xce,0xc6,0xa2,0x7a,0xd3,0xc6,0x83,0x3d,0xca,0x0,0xd3,0xd1,0x0,0xcb,0x0,0xdd,0x0,0x0,0x34,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x35,0xc2,0xe0,0x1,0xce,0xc6,0x83,0x5f,0xca,0x0,0xd3,0xd1,0x1,0xe0,0x1,0xe0,0x0,0xce,0xc6,0xa2,0x7c,0xd3,0xc6,0x3e,0xcb,0x1,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe0,0x2,0xe0,0x0,0xce,0xc6,0xa2,0x7a,0xd3,0xc6,0x86,0x5f,0xca,0x0,0xe1,0x1,0xc9,0x2,0x1,0xe1,0x2,0xc7,0x8,0xcb,0x3,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0x65,0x89,0x20,0xc0,0x89,0xe,0xc0,0x83,0x3c,0xc0,0x89,0xf,0xc0,0x89,0xd,0xc0,0x21,0x89,0xf,0x21,0x89,0xe,0x21,0x89,0x20,0x26,0x8b,0x46,0xa1,0x7f,0xa3,0x64,0xa3,0x65,0xa3,0x66,0x89,0x31,0x24,0x83,0x3c,0xa3,0x34,0x8b,0x49,0x88,0x71,0xc2,0x1,0x86,0xd0,0xc2,0x1,0x87,0xa2,0xc2,0x1,0x88,0x54,0xc2,0x1,0x88,0x48,0xc2,0x1,0x88,0xec,0xc2,0x1,0x88,0xd8,0xc2,0x1,0x89,0x10,0xc2,0x1,0x89,0x18,0x34,0xa3,0x69,0xa3,0x69,0xa3,0x6a,0xc0,0xc0,0xc0,0xa3,0x6a,0xa3,0x6b,0xa3,0x6c,0xa3,0x6c,0xa3,0x6b,0xa3,0x6d,0xa3,0x6e,0xa3,0x6e,0xa3,0x6f,0xa3,0x70,0xa3,0x70,0xa3,0x70,0xa3,0x6f,0xa3,0x6d,0xc1,0x7,0xca,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa3,0x71,0xd,0xa3,0x72,0xe5,0x74,0xc3,0xa3,0x67,0xa3,0x68,0x8c,0x56,0xa3,0x73,0xe0,0x1,0xca,0x1,0xc6,0x3e,0xc6,0x83,0x56,0xd3,0xd1,0x0,0xe1,0x3,0xc9,0x2,0x7,0xce,0xe1,0xb,0xc7,0x4,0xc6,0xa3,0x63,0xc6,0x89,0xd,0xca,0x0,0xc6,0x89,0xf,0xca,0x2,0xc6,0x89,0xe,0xca,0x3,0xc6,0x83,0x3c,0xcb,0x0,0xc6,0x89,0x20,0xca,0x4,0xd3,0xca,0x5,0xd3,0xd1,0x1,0xe0,0x1,0xe0,0x0,0xce,0xc6,0xa2,0x78,0xd3,0xc6,0x3e,0xcb,0x1,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xe0,0x2,0xe0,0x0,0xce,0xc6,0xa2,0x77,0xd3,0xc6,0x86,0x5f,0xca,0x0,0xe1,0x1,0xc9,0x2,0x1,0xe1,0x2,0xc7,0x8,0xcb,0x3,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0xc2,0x1,0x89,0x94,0xc2,0x1,0x89,0x8e,0xc2,0x1,0x89,0xf2,0xc2,0x1,0x89,0xe6,0xc2,0x1,0x89,0xda,0x2b,0xa3,0x75,0xa3,0x76,0xa3,0x76,0xa3,0x75,0xa3,0x77,0xa3,0x77,0xa3,0x78,0xa3,0x79,0xa3,0x79,0xa3,0x78,0xa3,0x77,0xc1,0x7,0xd8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa3,0x7a,0xd,0xa3,0x7b,0xe5,0x3c,0xc3,0x4c,0x89,0x31,0x88,0x3d,0xa3,0x7c,0xe8,0x0,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x83,0x3d,0xca,0x0,0xd3,0xc6,0x89,0x30,0xd3,0xd1,0x0,0xcb,0x0,0xdd,0x0,0x0,0x2e,0xe1,0x2,0xc7,0x0,0xe0,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x89,0x23,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xdc,0x0,0x0,0x33,0xc1,0x0,0x64,0x5,0xc0,0x6,0xc0,0x9,0xc0,0xd,0xc0,0xc2,0x1,0x8a,0x6c,0xc2,0x1,0x8a,0x98,0xc2,0x1,0x8a,0xa2,0xc2,0x1,0x8a,0xba,0xc2,0x1,0x8a,0xcc,0xc2,0x1,0x8a,0xde,0xc2,0x1,0x8a,0xf4,0xc2,0x1,0x8b,0x24,0xc2,0x1,0x8b,0x2a,0xc2,0x1,0x8b,0x60,0xc2,0x1,0x8b,0x6e,0x3b,0xa3,0x7f,0xa3,0x7f,0xa4,0x0,0xa4,0x0,0xa4,0x1,0xa4,0x2,0xa4,0x2,0xa4,0x3,0xa4,0x3,0xa4,0x4,0xa4,0x4,0xa4,0x5,0xa4,0x5,0xc0,0xc0,0xa4,0x6,0xa4,0x7,0xa4,0x7,0xa4,0x6,0xa4,0x8,0xa4,0x8,0xa4,0x8,0xc0,0xa4,0x9,0xa4,0x9,0xa4,0x1,0xa4,0x0,0xc1,0x7,0xde,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa4,0xa,0xd,0xa4,0xb,0xe5,0x72,0xc3,0x4c,0xa1,0x7d,0x88,0x3d,0xa4,0xc,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x83,0x3d,0xca,0x0,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x6,0xce,0xc6,0x8b,0x44,0xe0,0x0,0xcb,0x0,0xc6,0x89,0xd,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x83,0x3c,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x89,0xf,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x85,0x6,0xd3,0xe1,0x9,0xc7,0x4,0xc6,0xa3,0x7e,0xc6,0xd,0xe1,0x1,0xc9,0x1,0x1c,0xe0,0x0,0xcb,0x0,0xc6,0x9,0xd3,0xd3,0xc6,0x5,0xc6,0x1a,0xc6,0x6,0xc4,0x0,0xc6,0x9,0xe1,0x0,0xc7,0x3,0xd3,0xd3,0xe8,0x0,0xcb,0x0,0xc6,0x89,0x30,0xd3,0xd3,0xd3,0x0,0x4,0x74,0x6c,0x30,0x31,0x5,0x73,0x6c,0x69,0x63,0x65,0xc2,0x1,0x8c,0xdc,0x22,0xa4,0x10,0xa4,0x10,0xc1,0x7,0xec,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa4,0x11,0xd,0xa4,0x12,0xb2,0xc3,0x4c,0xc4,0xc4,0xa4,0x13,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x82,0x64,0xca,0x0,0xd3,0x0,0x21,0x82,0x78,0xc2,0x1,0x8b,0xd6,0xc2,0x1,0x8b,0xca,0xc2,0x1,0x8b,0xfe,0xc2,0x1,0x8c,0x3a,0xc2,0x1,0x8c,0x5a,0xc2,0x1,0x8c,0x7c,0xc2,0x1,0x8c,0x70,0xc2,0x1,0x8c,0x64,0xc2,0x1,0x8c,0xbe,0xc2,0x1,0x8c,0xb4,0xc2,0x1,0x8c,0xa8,0xc2,0x1,0x8d,0xe,0xc2,0x1,0x8d,0x30,0xc2,0x1,0x8d,0x3a,0xc2,0x1,0x8d,0x8c,0xc2,0x1,0x8d,0xae,0xc2,0x1,0x8d,0xa2,0xc2,0x1,0x8d,0xf6,0xe1,0x25,0xa4,0x16,0xa4,0x17,0xa4,0x16,0xa4,0x18,0xa4,0x18,0xa4,0x19,0xa4,0x1a,0xa4,0x1b,0xa4,0x1b,0xa4,0x1c,0xa4,0x1d,0xa4,0x1d,0xa4,0x1c,0xa4,0x1b,0xa4,0x1a,0xa4,0x19,0xa4,0x1e,0xa4,0x1f,0xa4,0x20,0xa4,0x20,0xa4,0x1f,0xa4,0x1e,0xa4,0x21,0xa4,0x22,0xa4,0x23,0xa4,0x23,0xa4,0x22,0xa4,0x21,0xa4,0x24,0xa4,0x25,0xa4,0x26,0xa4,0x26,0xa4,0x25,0xa4,0x24,0xa4,0x27,0xa4,0x27,0xa4,0x27,0xc1,0x7,0xe4,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa4,0x28,0xd,0xa4,0x29,0xe5,0x81,0x10,0xc3,0xc4,0xa4,0x15,0x88,0x3d,0xa4,0x2a,0xe0,0x0,0xc7,0x12,0xc6,0x82,0x60,0xd3,0xd1,0x0,0xe0,0x1,0xcb,0x0,0xc6,0x82,0x64,0xc6,0xa4,0xe,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x1,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xe0,0x0,0xce,0xc6,0xa2,0x78,0xd3,0xc6,0x81,0x44,0xd3,0xc4,0x1,0xd3,0xd3,0xd3,0xf0,0x1,0x82,0x62,0xe0,0x2,0xe0,0x0,0xce,0xc6,0xa2,0x78,0xd3,0xc6,0xa4,0xf,0xc2,0xc6,0x2d,0xd3,0xc6,0x82,0x63,0xd0,0xa4,0x14,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x82,0x64,0xe1,0x1,0xc9,0x2,0x5,0xe0,0x0,0xce,0xc6,0xa2,0x7c,0xd3,0xd3,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x82,0x64,0xe0,0x1,0xe0,0x0,0xce,0xc6,0xa2,0x78,0xd3,0xc6,0x83,0x3d,0xc6,0x33,0xd3,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x0,0xd3,0x0,0xb,0x62,0x75,0x69,0x6c,0x64,0x65,0x72,0x5f,0x6e,0x65,0x77,0x21,0xa2,0x77,0x21,0xa4,0x2d,0xc2,0x1,0x7d,0x58,0xc2,0x1,0x7d,0x4e,0xc2,0x1,0x7d,0x98,0xc2,0x1,0x7d,0x8a,0xc2,0x1,0x7d,0xd0,0xc2,0x1,0x7d,0xc6,0xc2,0x1,0x7e,0x16,0xc2,0x1,0x7e,0x8,0xc2,0x1,0x7e,0x56,0xc2,0x1,0x7e,0x48,0x32,0xc0,0xc0,0xa4,0x2f,0xa4,0x30,0xa4,0x2f,0xa4,0x31,0xa4,0x32,0xa4,0x31,0xa4,0x33,0xa4,0x34,0xa4,0x33,0xa4,0x35,0xa4,0x36,0xa4,0x35,0xa4,0x37,0xa4,0x38,0xa4,0x37,0xc0,0xc1,0x7,0x90,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa4,0x39,0xd,0xa4,0x3a,0xe5,0x70,0xa4,0x2c,0xa4,0x2e,0xc4,0xc4,0xa4,0x3b,0xe1,0x19,0xc7,0x4,0xc6,0xa2,0x7d,0xc6,0xa2,0x77,0xca,0x0,0xc6,0xa2,0x78,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xc6,0xa2,0x79,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xc6,0xa2,0x7c,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xc6,0xa2,0x7a,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xc6,0xa2,0x77,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xc6,0x83,0x5f,0xd0,0xa3,0x4f,0xc6,0x83,0x79,0xd0,0xa3,0x62,0xc6,0x8b,0x44,0xd0,0xa3,0x74,0xc6,0x4,0xd0,0xa3,0x7d,0xc6,0x83,0x3c,0xd0,0xa4,0xd,0xc6,0xa2,0x7b,0xd0,0xa4,0x2b,0xd3,0x0,0x65,0xa2,0x48,0xc0,0x5,0xc0,0x6,0xc0,0x9,0xc0,0xd,0xc0,0xb,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x6d,0x61,0x69,0x6e,0x21,0xa2,0x39,0x22,0xa4,0x3f,0x8b,0x45,0x7,0x62,0x75,0x69,0x6c,0x64,0x65,0x72,0x26,0x89,0xd,0x89,0xf,0x8e,0x54,0x5,0x9,0xa4,0x41,0xc2,0x1,0x8e,0x7c,0xc2,0x1,0x8e,0xca,0xc2,0x1,0x8e,0xe0,0xc2,0x1,0x8f,0x12,0xc2,0x1,0x8f,0x24,0xc2,0x1,0x8f,0x50,0xc2,0x1,0x8f,0x8c,0xc2,0x1,0x8f,0x9c,0xc2,0x1,0x8f,0xde,0xc2,0x1,0x90,0x14,0xc2,0x1,0x90,0x3c,0xc2,0x1,0x90,0x8e,0xc2,0x1,0x90,0x98,0xc2,0x1,0x90,0xd2,0xc2,0x1,0x90,0xfc,0xc2,0x1,0x91,0x2a,0xe1,0x27,0xa4,0x43,0xa4,0x43,0xa4,0x44,0xa4,0x44,0xa4,0x45,0xa4,0x45,0xa4,0x45,0xa4,0x46,0xa4,0x46,0xa4,0x47,0xa4,0x47,0xa4,0x47,0xa4,0x48,0xa4,0x48,0xa4,0x49,0xa4,0x49,0xa4,0x4a,0xa4,0x4a,0xa4,0x4a,0xa4,0x4b,0xa4,0x4b,0xa4,0x4c,0xa4,0x4d,0xa4,0x4d,0xc0,0xc0,0xa4,0x4e,0xa4,0x4f,0xa4,0x4f,0xa4,0x4e,0xa4,0x50,0xa4,0x50,0xa4,0x50,0xc0,0xa4,0x51,0xa4,0x51,0xa4,0x4c,0xa4,0x52,0xa4,0x52,0xc1,0x7,0xf8,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa4,0x53,0xd,0xa4,0x54,0xe5,0x81,0x40,0xa4,0x3e,0xa4,0x40,0xa4,0x42,0x8b,0x76,0xa4,0x55,0xe8,0x0,0xca,0x0,0xc6,0x89,0xd,0xd3,0xdc,0x0,0x0,0xf,0xc6,0xa2,0x33,0xd1,0x0,0xe8,0x0,0xca,0x0,0xc6,0x89,0xf,0xd3,0xdc,0x0,0x0,0x22,0xe1,0x0,0xc7,0x3,0xd3,0xd1,0x1,0xe8,0x0,0xca,0x0,0xc6,0x85,0x6,0xd3,0xdc,0x0,0x0,0x35,0xe1,0x0,0xc7,0x3,0xd3,0xd1,0x2,0xe8,0x0,0xca,0x0,0xc6,0x5,0xd3,0xdc,0x0,0x0,0x44,0xc6,0x1a,0xd1,0x3,0xe8,0x0,0xca,0x0,0xc6,0x9,0xd3,0xdc,0x0,0x0,0x56,0xe1,0x0,0xc7,0x3,0xd3,0xd1,0x4,0xe1,0x1,0xc9,0x0,0x1d,0xc9,0x0,0x1,0xd3,0xd1,0x5,0xe0,0x6,0xcb,0x5,0xc6,0x8b,0x44,0xcb,0x0,0xe0,0x0,0xca,0x0,0xc6,0x83,0x3c,0xd3,0xcb,0x1,0xcb,0x2,0xe1,0xb,0xc7,0x4,0xc6,0xa4,0x3d,0xc6,0xd,0xe1,0x1,0xc9,0x0,0x1c,0xe0,0x0,0xca,0x0,0xc6,0x9,0xd3,0xd3,0xc6,0x5,0xcb,0x3,0xc6,0x6,0xc4,0x0,0xc6,0x9,0xe1,0x0,0xc7,0x3,0xd3,0xc6,0xa2,0x48,0xc9,0x0,0x1b,0xd3,0xe8,0x0,0xca,0x0,0xc6,0x89,0x30,0xd3,0xd3,0xe0,0x0,0xcb,0x5,0xc6,0xa2,0x7b,0xd3,0x0,0x4,0x6c,0x69,0x6e,0x6b,0x6,0x62,0x75,0x66,0x66,0x65,0x72,0x7,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x22,0xa2,0x35,0xa2,0x37,0x3,0x69,0x64,0x73,0xa,0x53,0x63,0x6f,0x70,0x65,0x43,0x6c,0x61,0x73,0x73,0x7,0x24,0x6c,0x61,0x62,0x65,0x6c,0x73,0xa,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x73,0x32,0xe1,0x22,0xa2,0x7c,0xa2,0x77,0xa4,0x5b,0x8e,0x42,0xa4,0x5c,0x8e,0x18,0x8e,0x30,0x8e,0x54,0x8f,0x4c,0x90,0xe,0x90,0x1a,0x90,0x2b,0x90,0x6c,0x90,0x7e,0x91,0x13,0x91,0x2c,0x91,0x65,0x91,0x6e,0x92,0xd,0x93,0x24,0x9b,0x24,0xa1,0x7,0xa1,0x69,0xa4,0x5d,0xa1,0x72,0xa1,0x7c,0xa2,0x34,0xa2,0x48,0xa2,0x62,0xa4,0x2c,0xa4,0x3e,0xa2,0x39,0xa4,0x5e,0x82,0x78,0xe1,0x22,0xc1,0xc1,0xc1,0xc2,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc2,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0x5f,0xe8,0xc1,0x5f,0xda,0xc1,0x60,0x1c,0xc1,0x60,0x12,0xc1,0x60,0x44,0xc1,0x60,0x3a,0xc2,0x1,0x91,0x7c,0xc2,0x1,0x91,0x9c,0xc2,0x1,0x91,0xda,0xc2,0x1,0x92,0x16,0xc2,0x1,0x92,0x3a,0xc2,0x1,0x92,0x58,0xc2,0x1,0x92,0x60,0x3e,0xa4,0x61,0xa4,0x62,0xa4,0x61,0xa4,0x63,0xa4,0x64,0xa4,0x63,0xa4,0x65,0xa4,0x66,0xa4,0x65,0xc0,0xc0,0xc0,0xc0,0xc0,0xa4,0x67,0xa4,0x68,0xa4,0x68,0xa4,0x67,0xa4,0x69,0xa4,0x69,0xa4,0x6a,0xa4,0x6a,0xa4,0x6b,0xa4,0x6b,0xa4,0x6b,0xa4,0x6c,0xa4,0x6c,0xa4,0x6d,0xa4,0x6d,0xa4,0x6c,0xc1,0x1,0xda,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa4,0x6e,0xd,0xa4,0x6f,0xe5,0x82,0x5b,0xa4,0x59,0xa4,0x5a,0xa4,0x5f,0xa4,0x60,0xa4,0x70,0xe0,0x0,0xc7,0x15,0xc6,0x82,0x60,0xd3,0xd1,0x0,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xd1,0x1,0xe0,0x0,0xc7,0x14,0xc6,0x82,0x60,0xd3,0xd1,0x2,0xc2,0xd6,0x3,0xe1,0x1b,0xc7,0x4,0xc6,0x8b,0x37,0xc6,0x8b,0x2d,0xd0,0x8b,0x62,0xc6,0x8b,0x2c,0xd0,0x8b,0x70,0xc6,0x3e,0xd0,0x8c,0x11,0xc6,0x8b,0x36,0xd0,0x8c,0x2b,0xc6,0x89,0x10,0xd0,0x8c,0x38,0xc6,0x8b,0x34,0xd0,0x8c,0x45,0xc6,0x8b,0x35,0xd0,0x8c,0x51,0xc6,0x8b,0x2f,0xd0,0x8c,0x63,0xc6,0x8b,0x30,0xd0,0x8c,0x76,0xc6,0x8b,0x31,0xd0,0x8d,0x6,0xc6,0x8b,0x32,0xd0,0x8d,0x1c,0xc6,0x8b,0x33,0xd0,0x8d,0x30,0xc6,0x8b,0x2e,0xd0,0x8e,0x15,0xd3,0xd1,0x4,0xd0,0x8e,0x2e,0xd1,0x5,0xd0,0x8e,0x3f,0xd1,0x6,0xd0,0x8e,0x51,0xd6,0x3,0xd0,0x8e,0x67,0xd1,0x7,0xd0,0x8f,0x64,0xd1,0x8,0xd0,0x90,0x17,0xd1,0x9,0xd0,0x90,0x29,0xd1,0xa,0xd0,0x90,0x3b,0xd1,0xb,0xd0,0x90,0x7c,0xd1,0xc,0xd0,0x91,0x12,0xd1,0xd,0xd0,0x91,0x23,0xd1,0xe,0xd0,0x91,0x31,0xd1,0xf,0xd0,0x91,0x6d,0xd1,0x10,0xd0,0x92,0x7,0xd1,0x11,0xd0,0x92,0x1c,0xd1,0x12,0xd0,0x93,0x35,0xd1,0x13,0xd0,0x9b,0x66,0xd1,0x14,0xd0,0xa1,0x5a,0xd1,0x15,0xd0,0xa1,0x71,0xd1,0x16,0xc4,0x0,0xd6,0x17,0xd0,0xa1,0x75,0xd1,0x18,0xd0,0xa2,0xd,0xd1,0x19,0xd0,0xa2,0x46,0xd1,0x1a,0xe1,0x0,0xd0,0xa2,0x59,0xd3,0xd1,0x1b,0xd0,0xa2,0x76,0xd1,0x1c,0xd0,0xa4,0x3c,0xd1,0x1d,0xd0,0xa4,0x56,0xd1,0x1e,0xe1,0x3,0xcb,0x1a,0xca,0x0,0xca,0x1,0xe0,0x1,0xcc,0xc6,0x83,0x3d,0xc6,0xa4,0x57,0xd3,0xd3,0xd2,0x0,0x1f,0xd2,0x1,0x20,0xe1,0x2,0xcb,0x1e,0xcb,0x1f,0xcb,0x20,0xd3,0xd1,0x21,0xe0,0x1,0xcc,0xc6,0x83,0x3d,0xc6,0xa4,0x58,0xd3,0xdd,0x0,0x1,0x40,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xcb,0x21,0xd3,0xdb,0x0,0x1,0x41,0xc2,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe0,0x0,0xcb,0x21,0xc6,0x82,0x6d,0xd3,0xd3,0x0,0x8,0x62,0x61,0x63,0x6b,0x77,0x61,0x72,0x64,0x23,0xc0,0xc0,0xa4,0x72,0x1,0xa,0x5,0x74,0x69,0x6d,0x65,0x73,0x2,0x5e,0xa,0x9,0x70,0x72,0x69,0x6e,0x74,0x5f,0x70,0x6f,0x73,0x8,0x64,0x65,0x62,0x75,0x67,0x67,0x65,0x72,0x21,0xa4,0x78,0x6,0x73,0x74,0x72,0x65,0x61,0x6d,0x21,0xa4,0x7a,0x22,0xa4,0x79,0xa4,0x7b,0x5,0x62,0x65,0x67,0x69,0x6e,0x24,0x9,0x5,0xa4,0x7d,0x83,0x56,0xc2,0x1,0x92,0xe2,0xc2,0x1,0x92,0xfa,0xc2,0x1,0x93,0xc,0xc2,0x1,0x93,0x8a,0xc2,0x1,0x93,0x7c,0xc2,0x1,0x93,0x3c,0xc2,0x1,0x93,0xf6,0xc2,0x1,0x93,0xd2,0xc2,0x1,0x93,0xb0,0xc2,0x1,0x93,0xec,0xc2,0x1,0x93,0xe0,0xc2,0x1,0x94,0x12,0xc2,0x1,0x94,0x4c,0xc2,0x1,0x94,0x80,0xc2,0x1,0x94,0x60,0xc2,0x1,0x94,0x76,0xe1,0x2f,0xa4,0x7f,0xa4,0x7f,0xa5,0x0,0xa5,0x0,0xa5,0x0,0xa5,0x1,0xa5,0x1,0xa5,0x1,0xa5,0x2,0xa5,0x2,0xa5,0x3,0xa5,0x3,0xa5,0x4,0xc0,0xc0,0xc0,0xa5,0x4,0xa5,0x3,0xa5,0x2,0xa5,0x5,0xa5,0x5,0xa5,0x6,0xa5,0x6,0xa5,0x7,0xc0,0xc0,0xc0,0xa5,0x7,0xa5,0x8,0xa5,0x8,0xa5,0x9,0xa5,0x9,0xa5,0x8,0xa5,0x6,0xa5,0x5,0xa5,0xa,0xa5,0xa,0xa5,0xb,0xa5,0xc,0xa5,0xc,0xa5,0xd,0xa5,0xe,0xa5,0xe,0xa5,0xe,0xa5,0xd,0xa5,0xc,0xa5,0xb,0xc1,0x8,0x1a,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa5,0xf,0xd,0xa5,0x10,0xe5,0x81,0x30,0xa4,0x77,0xa4,0x7c,0xa4,0x7e,0x8c,0x56,0xa5,0x11,0xe0,0x0,0xca,0x0,0xc6,0x9,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x18,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x23,0xe1,0x1,0xc7,0x1,0xc4,0x0,0xd3,0xdb,0x0,0x0,0x24,0xc2,0xe1,0x2,0xc7,0x9,0xe1,0x2,0xc7,0x1f,0xf0,0x3,0xa4,0x73,0xcb,0x1,0xc6,0xa2,0x47,0xe1,0x1,0xc7,0x2b,0xc4,0xa,0xd3,0xcb,0x0,0xc0,0xd3,0xc6,0x33,0xd3,0xc4,0x1,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x8,0xe1,0x2,0xc7,0x1f,0xe0,0x2,0xcb,0x1,0xc6,0xa2,0x47,0xe1,0x1,0xc7,0x2b,0xc4,0xa,0xd3,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x9,0xe0,0x0,0xcb,0x1,0xc6,0x81,0x44,0xd3,0xc4,0x1,0xd3,0xd3,0xc4,0x1,0xd3,0xd1,0x3,0xe0,0x2,0xca,0x1,0xc6,0x82,0x64,0xcb,0x1,0xc6,0xa4,0x74,0xd3,0xe0,0x1,0xca,0x1,0xc6,0x82,0x64,0xe1,0x2,0xc7,0x9,0xe0,0x1,0xc6,0x88,0x30,0xc6,0xa4,0x75,0xe1,0x2,0xc7,0x8,0xcb,0x0,0xc4,0x1,0xd3,0xd3,0xc6,0xa4,0x76,0xd3,0xd3,0x0,0x7,0x49,0x4e,0x50,0x55,0x54,0x3e,0xa,0xa,0x72,0x65,0x61,0x64,0x53,0x74,0x72,0x69,0x6e,0x67,0x4,0x74,0x72,0x69,0x6d,0xc2,0x1,0x96,0x7a,0xc2,0x1,0x96,0x90,0xc2,0x1,0x96,0x88,0xc2,0x1,0x96,0xa2,0x27,0xa5,0x16,0xa5,0x17,0xa5,0x18,0xa5,0x19,0xa5,0x19,0xa5,0x17,0xa5,0x16,0xc1,0x8,0x38,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa5,0x1a,0xd,0xa5,0x1b,0xe5,0x21,0xc3,0xc4,0xc4,0xc4,0xa5,0x1c,0xe0,0x2,0xc8,0x0,0x1,0xc6,0x82,0x64,0xe1,0x1,0xc7,0x1b,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x90,0x18,0xd3,0xd3,0xc6,0xa4,0x74,0xd3,0x0,0xc2,0x1,0x97,0x1c,0xc2,0x1,0x97,0x32,0xc2,0x1,0x97,0x2a,0xc2,0x1,0x97,0x44,0x27,0xa5,0x1e,0xa5,0x1f,0xa5,0x20,0xa5,0x21,0xa5,0x21,0xa5,0x1f,0xa5,0x1e,0xc1,0x8,0x3c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa5,0x22,0xd,0xa5,0x23,0xe5,0x21,0xc3,0xc4,0xc4,0xc4,0xa5,0x24,0xe0,0x2,0xc8,0x0,0x1,0xc6,0x82,0x64,0xe1,0x1,0xc7,0x1b,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x89,0xf,0xd3,0xd3,0xc6,0xa4,0x74,0xd3,0x0,0xc2,0x1,0x97,0xde,0xc2,0x1,0x97,0xfe,0x24,0xa5,0x26,0xa5,0x27,0xa5,0x27,0xa5,0x26,0xc1,0x8,0x40,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa5,0x28,0xd,0xa5,0x29,0xbf,0xc3,0xc4,0xc4,0xc4,0xa5,0x2a,0xe0,0x2,0xc8,0x0,0x1,0xc6,0x82,0x64,0xe1,0x2,0xc9,0x1,0xa,0xc8,0x0,0x0,0xc8,0x0,0x1,0xd3,0xc6,0xa4,0x74,0xd3,0x0,0x4,0x73,0x74,0x65,0x70,0xc2,0x1,0x98,0xaa,0xc2,0x1,0x98,0xe0,0x24,0xa5,0x2d,0xa5,0x2d,0xa5,0x2e,0xa5,0x2e,0xc1,0x8,0x44,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa5,0x2f,0xd,0xa5,0x30,0xbc,0xc3,0xc4,0xc4,0xc4,0xa5,0x31,0xe0,0x0,0xc8,0x0,0x0,0xc6,0xa5,0x2c,0xd3,0xe1,0x2,0xc9,0x1,0xa,0xc8,0x0,0x0,0xc8,0x0,0x1,0xd3,0x0,0x4,0x73,0x74,0x6f,0x70,0x6,0x64,0x65,0x74,0x61,0x63,0x68,0x7,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0xc2,0x1,0x99,0x64,0xc2,0x1,0x99,0x84,0xc2,0x1,0x99,0xc0,0xc2,0x1,0x99,0xec,0x2c,0xa5,0x36,0xa5,0x37,0xa5,0x37,0xa5,0x36,0xa5,0x38,0xa5,0x38,0xa5,0x39,0xa5,0x39,0xa5,0x39,0xa5,0x39,0xa5,0x39,0xa5,0x39,0xc1,0x8,0x4a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa5,0x3a,0xd,0xa5,0x3b,0xe5,0x2e,0xc3,0xc4,0xc4,0xc4,0xa5,0x3c,0xe0,0x1,0xc8,0x0,0x0,0xc6,0xa5,0x34,0xe0,0x0,0xc8,0x0,0x0,0xc6,0xa5,0x35,0xd3,0xd3,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8d,0x1d,0xd3,0xe1,0x1,0xc7,0x17,0xe1,0x1,0xc7,0x3,0xc4,0x0,0xd3,0xd3,0x0,0xe,0x53,0x69,0x6d,0x70,0x6c,0x65,0x44,0x65,0x62,0x75,0x67,0x67,0x65,0x72,0x3,0x63,0x6d,0x64,0x22,0x88,0x71,0xa5,0x3f,0x22,0xc8,0x85,0x4e,0xc2,0x1,0x95,0x6a,0xc2,0x1,0x95,0xb6,0xc2,0x1,0x96,0x14,0xc2,0x1,0x95,0xf6,0xc2,0x1,0x96,0x3c,0xc2,0x1,0x96,0xda,0xc2,0x1,0x97,0x94,0xc2,0x1,0x97,0x80,0xc2,0x1,0x97,0xa2,0xc2,0x1,0x98,0x62,0xc2,0x1,0x98,0x4e,0xc2,0x1,0x98,0x70,0xc2,0x1,0x99,0x22,0xe1,0x2d,0xa5,0x42,0xa5,0x42,0xa5,0x43,0xa5,0x43,0xa5,0x44,0xa5,0x45,0xa5,0x45,0xa5,0x44,0xa5,0x46,0xa5,0x46,0xa5,0x46,0xc0,0xc0,0xa5,0x47,0xa5,0x47,0xa5,0x47,0xc0,0xc0,0xa5,0x48,0xa5,0x48,0xa5,0x49,0xa5,0x49,0xa5,0x49,0xa5,0x4a,0xa5,0x4a,0xa5,0x4a,0xa5,0x48,0xc0,0xc0,0xa5,0x4b,0xa5,0x4b,0xa5,0x4c,0xa5,0x4c,0xa5,0x4c,0xa5,0x4d,0xa5,0x4d,0xa5,0x4d,0xa5,0x4b,0xc0,0xc0,0xa5,0x4e,0xa5,0x4e,0xa5,0x4e,0xc0,0xc0,0xc1,0x8,0x2a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xa5,0x41,0x9,0xa5,0x4f,0xd,0xa5,0x50,0xe5,0x81,0x27,0xa5,0x3e,0xa4,0x7c,0xa5,0x40,0x82,0x7a,0xa5,0x51,0xe0,0x1,0xca,0x1,0xc6,0x82,0x64,0xc6,0xa5,0x13,0xd3,0xe0,0x1,0xca,0x1,0xc6,0xa2,0x47,0xc6,0xa4,0x74,0xd3,0xd1,0x0,0xe0,0x0,0xe0,0x1,0xca,0x1,0xc6,0xa5,0x14,0xcb,0x0,0xd3,0xc6,0xa5,0x15,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0x90,0x18,0xd3,0xe3,0x0,0xd0,0xa5,0x1d,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0x89,0xf,0xd3,0xe3,0x0,0xd0,0xa5,0x25,0xd3,0xe1,0x2,0xc7,0x1f,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0x96,0x24,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0x9,0xd3,0xd3,0xe3,0x0,0xd0,0xa5,0x2b,0xd3,0xe1,0x2,0xc7,0x1f,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0xa5,0x2c,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0x1a,0xd3,0xd3,0xe3,0x0,0xd0,0xa5,0x32,0xd3,0xe1,0x2,0xc7,0x0,0xcb,0x1,0xc6,0xa5,0x33,0xd3,0xe3,0x0,0xd0,0xa5,0x3d,0xd3,0xd4,0xdb,0x0,0x0,0x0,0xc2,0x0,0x5,0x64,0x65,0x62,0x75,0x67,0x5,0x66,0x72,0x61,0x6d,0x65,0x5,0x6c,0x69,0x6e,0x6b,0x73,0x3,0x72,0x75,0x6e,0x65,0xa5,0x53,0xc0,0xa4,0x57,0xc0,0xa5,0x54,0xc0,0xa5,0x55,0xc0,0xa5,0x56,0xc0,0xd,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x6b,0x73,0xc2,0x1,0x9a,0x5a,0xc2,0x1,0x9a,0x40,0x23,0xa5,0x59,0xa5,0x5a,0xa5,0x59,0xc1,0x8,0x54,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa5,0x5b,0xd,0xa5,0x5c,0xaf,0xc3,0xc4,0xc4,0xc4,0xa5,0x5d,0xe1,0x1,0xc7,0x2e,0xc8,0x0,0x0,0xd3,0x0,0xc,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x6b,0x21,0x8d,0x8,0xc2,0x1,0x9a,0x98,0xc2,0x1,0x9a,0xb2,0xc2,0x1,0x9a,0x9a,0x25,0xa5,0x61,0xa5,0x62,0xa5,0x63,0xa5,0x62,0xa5,0x61,0xc1,0x8,0x56,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa5,0x64,0xd,0xa5,0x65,0xb8,0xc3,0xa5,0x60,0xc4,0xc4,0xa5,0x66,0xe1,0x1,0xc9,0x1,0xc,0xe1,0x2,0xc7,0x2f,0xc8,0x0,0x0,0xca,0x0,0xd3,0xd3,0x0,0xd,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x66,0x72,0x61,0x6d,0x65,0x21,0x8e,0x76,0x21,0xa5,0x69,0xc2,0x1,0x9b,0x22,0xc2,0x1,0x9b,0x8,0xc2,0x1,0x9b,0x3a,0x25,0xa5,0x6b,0xa5,0x6c,0xa5,0x6d,0xa5,0x6d,0xa5,0x6b,0xc1,0x8,0x58,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa5,0x6e,0xd,0xa5,0x6f,0xbc,0xc3,0xa5,0x6a,0xc4,0xc4,0xa5,0x70,0xe1,0x3,0xc7,0x30,0xc8,0x0,0x0,0xca,0x0,0xe0,0x1,0xcc,0xc6,0x83,0x3d,0xc6,0xa4,0x57,0xd3,0xd3,0x0,0xb,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x72,0x75,0x6e,0x4,0x74,0x61,0x73,0x6b,0x21,0xa5,0x73,0x21,0xa5,0x54,0x23,0xa5,0x69,0xa5,0x74,0xa5,0x75,0xc2,0x1,0x9b,0xbe,0xc2,0x1,0x9b,0xa8,0x23,0xa5,0x77,0xa5,0x78,0xa5,0x77,0xc1,0x8,0x5c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa5,0x79,0xd,0xa5,0x7a,0xb6,0xc3,0xa5,0x76,0xc4,0xc4,0xa5,0x7b,0xe1,0x4,0xc7,0x31,0xc8,0x0,0x0,0xca,0x0,0xca,0x1,0xca,0x2,0xd3,0x0,0x8,0x44,0x65,0x62,0x75,0x67,0x67,0x65,0x72,0x4,0x54,0x61,0x73,0x6b,0x6,0x61,0x74,0x74,0x61,0x63,0x68,0x23,0xa4,0x7b,0xa5,0x69,0xa5,0x75,0x22,0xa4,0x78,0xa5,0x73,0xc2,0x1,0x9c,0x70,0xc2,0x1,0x9c,0x60,0xc2,0x1,0x9c,0xa8,0xc2,0x1,0x9c,0xa0,0xc2,0x1,0x9c,0xda,0xc2,0x1,0x9d,0x24,0xc2,0x1,0x9d,0xe,0xc2,0x1,0x9d,0x72,0xc2,0x1,0x9d,0x90,0x30,0xa6,0x2,0xa6,0x3,0xa6,0x2,0xa6,0x4,0xa6,0x5,0xa6,0x4,0xa6,0x6,0xa6,0x6,0xa6,0x7,0xa6,0x8,0xa6,0x7,0xa6,0x9,0xa6,0x9,0xa6,0xa,0xa6,0xa,0xa6,0x9,0xc1,0x8,0x60,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa6,0xb,0xd,0xa6,0xc,0xe5,0x47,0xc3,0xa6,0x0,0xa6,0x1,0x82,0x7a,0xa6,0xd,0xe0,0x0,0xc7,0x32,0xc6,0x82,0x60,0xd3,0xd1,0x0,0xe0,0x0,0xc7,0x33,0xc6,0x82,0x60,0xd3,0xd1,0x1,0xe0,0x1,0xcb,0x0,0xc6,0xa5,0x7f,0xcb,0x1,0xd3,0xe1,0x4,0xc7,0x31,0xc8,0x0,0x0,0xca,0x1,0xcb,0x1,0xca,0x2,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x2,0xc9,0x1,0xb,0xcb,0x0,0xca,0x0,0xd3,0xd3,0x0,0x6,0x4d,0x6f,0x64,0x75,0x6c,0x65,0xc1,0x8,0x52,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x83,0x3e,0xd,0xa6,0x10,0xe5,0x2f,0xa6,0xf,0x83,0x20,0xc4,0xc4,0xa6,0x11,0xe1,0xb,0xc7,0x4,0xc6,0xa5,0x57,0xc6,0xa5,0x55,0xd0,0xa5,0x5e,0xc6,0xa4,0x57,0xd0,0xa5,0x67,0xc6,0xa5,0x54,0xd0,0xa5,0x71,0xc6,0xa5,0x56,0xd0,0xa5,0x7c,0xc6,0xa5,0x53,0xd0,0xa6,0xe,0xd3,0x0,0x1d,0x63,0x61,0x6e,0x6e,0x6f,0x74,0x20,0x6c,0x69,0x6e,0x6b,0x20,0x75,0x73,0x69,0x6e,0x67,0x20,0x61,0x20,0x53,0x74,0x72,0x69,0x6e,0x67,0x3a,0x20,0x27,0xc2,0x1,0x9e,0xb4,0xc2,0x1,0x9e,0x68,0xc2,0x1,0x9e,0x5e,0x28,0xa6,0x14,0xa6,0x15,0xa6,0x16,0xc0,0xc0,0xc0,0xa6,0x15,0xa6,0x14,0xc1,0x8,0x74,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa6,0x17,0xd,0xa6,0x18,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0xa6,0x19,0xe0,0x0,0xe1,0x1,0xc7,0x2d,0xe1,0x3,0xc7,0x1a,0xc6,0xa6,0x13,0xc8,0x0,0x0,0xc6,0x9a,0x1d,0xd3,0xd3,0xc6,0x88,0x2d,0xd3,0x0,0x9,0x69,0x73,0x44,0x65,0x66,0x69,0x6e,0x65,0x64,0x1,0x78,0x21,0xa6,0x1c,0xc2,0x1,0x9f,0x10,0xc2,0x1,0x9f,0x4,0xc2,0x1,0x9f,0x4a,0xc2,0x1,0x9f,0x38,0xc2,0x1,0x9f,0x60,0x29,0xa6,0x1e,0xa6,0x1f,0xa6,0x1e,0xa6,0x20,0xa6,0x21,0xa6,0x20,0xa6,0x22,0xa6,0x22,0xa6,0x22,0xc1,0x8,0x76,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa6,0x23,0xd,0xa6,0x24,0xe5,0x32,0xc3,0xc4,0xa6,0x1d,0x88,0x3d,0xa6,0x25,0xe0,0x2,0xc7,0x1e,0xc6,0x83,0x3d,0xc8,0x0,0x0,0xc8,0x1,0x1,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x34,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x28,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x29,0xc2,0x0,0xa,0x69,0x73,0x46,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0xc2,0x1,0x9f,0xae,0xc2,0x1,0x9f,0xd6,0xc2,0x1,0x9f,0xc4,0xc2,0x1,0x9f,0xec,0x28,0xa6,0x28,0xa6,0x28,0xa6,0x29,0xa6,0x2a,0xa6,0x29,0xa6,0x2b,0xa6,0x2b,0xa6,0x2b,0xc1,0x8,0x78,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa6,0x2c,0xd,0xa6,0x2d,0xe5,0x2d,0xc3,0xc4,0xa6,0x1d,0x88,0x3d,0xa6,0x2e,0xe1,0x1,0xc8,0x0,0x0,0xc8,0x1,0x1,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x34,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x23,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x24,0xc2,0x0,0xc2,0x1,0xa0,0x3a,0xc2,0x1,0xa0,0x62,0xc2,0x1,0xa0,0x50,0xc2,0x1,0xa0,0x78,0x28,0xa6,0x30,0xa6,0x30,0xa6,0x31,0xa6,0x32,0xa6,0x31,0xa6,0x33,0xa6,0x33,0xa6,0x33,0xc1,0x8,0x7a,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa6,0x34,0xd,0xa6,0x35,0xe5,0x30,0xc3,0xc4,0xa6,0x1d,0x88,0x3d,0xa6,0x36,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x83,0x3d,0xc8,0x1,0x1,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x34,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x26,0xe1,0x2,0xc7,0x1,0xc4,0x2,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x27,0xc2,0x0,0x21,0x84,0x5a,0x21,0xa6,0x38,0xc2,0x1,0x9e,0x48,0xc2,0x1,0x9e,0x38,0xc2,0x1,0x9e,0xe6,0xc2,0x1,0x9e,0xd6,0xc2,0x1,0x9f,0x8e,0xc2,0x1,0x9f,0x7a,0x31,0xa6,0x3a,0xa6,0x3b,0xa6,0x3a,0xc0,0xc0,0xa6,0x3c,0xa6,0x3d,0xa6,0x3c,0xc0,0xc0,0xa6,0x3e,0xa6,0x3f,0xa6,0x3e,0xc0,0xc0,0xc0,0xc0,0xc1,0x8,0x72,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa6,0x40,0xd,0xa6,0x41,0xe5,0x38,0xc3,0xa6,0x39,0xc4,0xc4,0xa6,0x42,0xe1,0x1,0xc7,0x11,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa6,0x1a,0xd3,0xe1,0x1,0xc7,0x22,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa6,0x26,0xd3,0xe1,0x1,0xc7,0x35,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa6,0x2f,0xd3,0xca,0x0,0xe3,0x0,0xd0,0xa6,0x37,0xd3,0xd4,0x0,0x8,0x5f,0x75,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x9,0x6e,0x61,0x6d,0x65,0x5f,0x66,0x72,0x6f,0x6d,0x4,0x65,0x6e,0x76,0x73,0x21,0xa6,0x46,0x22,0xa6,0x47,0x8b,0x46,0xc2,0x1,0x9e,0x8,0xc2,0x1,0xa0,0x92,0xc2,0x1,0xa0,0xa4,0xc2,0x1,0xa0,0x94,0x28,0xa6,0x49,0xa6,0x49,0xa6,0x4a,0xa6,0x4a,0xa6,0x4b,0xa6,0x4c,0xa6,0x4b,0xa6,0x4a,0xc1,0x8,0x70,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa6,0x4d,0xd,0xa6,0x4e,0xe5,0x22,0xa6,0x45,0xa6,0x48,0xc4,0xc4,0xa6,0x4f,0xf0,0x1,0x82,0x62,0xca,0x0,0xc6,0x82,0x63,0xd0,0xa6,0x43,0xd3,0xe1,0x2,0xc7,0x1,0xc4,0x0,0xe1,0x0,0xc7,0x36,0xd3,0xd3,0x0,0x4,0x74,0x69,0x6d,0x65,0x5,0x69,0x73,0x42,0x69,0x6e,0xc2,0x1,0xa1,0x40,0xc2,0x1,0xa1,0x34,0x23,0xa6,0x53,0xa6,0x54,0xa6,0x53,0xc1,0x8,0x84,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa6,0x55,0xd,0xa6,0x56,0xb2,0xc3,0xc4,0xc4,0xc4,0xa6,0x57,0xe0,0x1,0xc7,0x12,0xc6,0x82,0x60,0xc8,0x0,0x0,0xd3,0x0,0x8,0x69,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0xc1,0x8,0x86,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0xa6,0x5a,0xaa,0xc3,0xc4,0xc4,0xc4,0xa6,0x5b,0xc8,0x0,0x0,0x0,0x24,0xc0,0xc0,0xa4,0x58,0xa4,0x57,0x22,0xa2,0x36,0x82,0x78,0xc2,0x1,0xa1,0xfe,0xc2,0x1,0xa1,0xf4,0xc2,0x1,0xa3,0xa,0xc2,0x1,0xa3,0x50,0x27,0xa6,0x5f,0xa6,0x60,0xa6,0x5f,0xa6,0x61,0xa6,0x62,0xa6,0x62,0xa6,0x61,0xc1,0x8,0x88,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa6,0x63,0xd,0xa6,0x64,0xe5,0x30,0xc3,0xc4,0xa6,0x5e,0x82,0x7a,0xa6,0x65,0xe1,0x1,0xc7,0x2a,0xc8,0x0,0x0,0xd3,0xd1,0x0,0xf1,0x4,0xa6,0x5d,0xc9,0x1,0x9,0xc8,0x0,0x0,0xcb,0x0,0xc0,0xe0,0x1,0xcd,0x0,0xc6,0x83,0x3d,0xc6,0xa4,0x57,0xd3,0xd3,0xd1,0x1,0xcb,0x1,0x0,0xb,0x5f,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6e,0x65,0x77,0xc2,0x1,0xa5,0x6e,0x22,0xa6,0x68,0xa6,0x68,0xc1,0x8,0x98,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa6,0x69,0xd,0xa6,0x6a,0xb3,0xc3,0x8c,0x3a,0xc4,0xc4,0xa6,0x6b,0xe1,0x2,0xc9,0x2,0xd,0xc9,0x1,0x3,0xca,0x0,0xd3,0x0,0x21,0xa5,0x55,0xc2,0x1,0xa5,0x42,0xc2,0x1,0xa5,0x3c,0xc2,0x1,0xa5,0x22,0xc2,0x1,0xa5,0xd8,0xc2,0x1,0xa5,0xc0,0x28,0xa6,0x6e,0xa6,0x6f,0xa6,0x70,0xa6,0x6f,0xa6,0x6e,0xa6,0x71,0xa6,0x72,0xa6,0x71,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa6,0x73,0xd,0xa6,0x6a,0xe5,0x28,0xc3,0xc4,0xa6,0x6d,0x88,0x3d,0xa6,0x74,0xf0,0x1,0x82,0x62,0xe1,0x1,0xc7,0x2e,0xc9,0x0,0x2,0xd3,0xc6,0x89,0x24,0xd0,0xa6,0x6c,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x2f,0xc9,0x0,0x2,0xcb,0x0,0xd3,0x0,0xc1,0x8,0x9c,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xc4,0xd,0xa6,0x76,0xaa,0xc3,0xc4,0xc4,0xc4,0xa6,0x77,0xc9,0x0,0x2,0x0,0x4,0x6c,0x6f,0x61,0x64,0x21,0x81,0x30,0x21,0xa6,0x7a,0x5,0x73,0x74,0x61,0x72,0x74,0x25,0xa6,0x7c,0x81,0x30,0x83,0x1e,0xa6,0x46,0x83,0x1e,0xc2,0x1,0xa0,0xec,0xc2,0x1,0xa0,0xe4,0xc2,0x1,0xa1,0x18,0xc2,0x1,0xa1,0xe,0xc2,0x1,0xa1,0x84,0xc2,0x1,0xa1,0x74,0xc2,0x1,0xa4,0x7a,0xc2,0x1,0xa4,0x64,0xc2,0x1,0xa4,0xa4,0xc2,0x1,0xa4,0x92,0xc2,0x1,0xa4,0xd2,0xc2,0x1,0xa5,0x4,0xc2,0x1,0xa4,0xf8,0xc2,0x1,0xa6,0xd8,0xe1,0x24,0xa6,0x7e,0xa6,0x7f,0xa6,0x7e,0xa7,0x0,0xa7,0x1,0xa7,0x0,0xc0,0xc0,0xa7,0x2,0xa7,0x3,0xa7,0x2,0xc0,0xc0,0xc0,0xc0,0xa7,0x4,0xa7,0x5,0xa7,0x6,0xa7,0x6,0xa7,0x7,0xa7,0x7,0xa7,0x6,0xa7,0x4,0xa7,0x8,0xa7,0x8,0xa7,0x9,0xa7,0x9,0xa7,0xa,0xa7,0xa,0xa7,0x9,0xc0,0xc0,0xc0,0xc0,0xa7,0xb,0xa7,0xb,0xc1,0x8,0x80,0x67,0x4,0xc1,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0xa7,0xc,0xd,0xa7,0xd,0xe5,0x81,0x3,0xa6,0x79,0xa6,0x7b,0xa6,0x7d,0x9a,0x27,0xa7,0xe,0xe1,0x0,0xc7,0x37,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x38,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa6,0x58,0xd3,0xe1,0x1,0xc7,0x39,0xca,0x0,0xd3,0xe3,0x0,0xd0,0xa6,0x5c,0xd3,0xc0,0xe3,0x0,0xd0,0xa6,0x66,0xd3,0xd4,0xd1,0x1,0xe1,0x2,0xc7,0x3a,0xcb,0x1,0xe1,0x2,0xc7,0x1f,0xe0,0x1,0xcc,0xc6,0x83,0x3d,0xc6,0x89,0xd,0xd3,0xc6,0x1a,0xd3,0xd3,0xd1,0x2,0xe0,0x2,0xcc,0xc6,0xa4,0xf,0xc4,0x2,0xc2,0xd3,0xd1,0x3,0xe1,0x2,0xc7,0x1c,0xe0,0x0,0xcb,0x3,0xc6,0x81,0x44,0xd3,0xc4,0x0,0xd3,0xe3,0x0,0xd0,0xa6,0x75,0xd3,0xc0,0xe3,0x0,0xd0,0xa6,0x78,0xd3,0xd4,0xd1,0x4,0xe1,0x1,0xc9,0x0,0xc,0xcb,0x4,0xd3,0x0,0x6,0x5f,0x70,0x61,0x72,0x73,0x65,0x21,0xa2,0x35,0xc2,0x1,0xa7,0xe,0xc2,0x1,0xa7,0x4,0x23,0xa7,0x12,0xa7,0x13,0xa7,0x12,0xc1,0x8,0xa6,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa7,0x14,0xd,0xa7,0x15,0xb0,0xa7,0x10,0xa7,0x11,0xc4,0xc4,0xa7,0x16,0xe1,0x1,0xc7,0x2a,0xca,0x0,0xd3,0x0,0x7,0x75,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x64,0xa7,0x18,0xc0,0xa4,0x59,0xc0,0xa6,0x79,0xc0,0xa2,0x11,0xc0,0xc2,0x1,0xa7,0x90,0xc2,0x1,0xa7,0x80,0x23,0xa7,0x1a,0xa7,0x1b,0xa7,0x1a,0xc1,0x8,0xaa,0x67,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc2,0x8,0xc4,0x9,0xa7,0x1c,0xd,0xa7,0x1d,0xac,0xc3,0xc4,0xc4,0xc4,0xa7,0x1e,0xe1,0x0,0xc7,0x36,0xd3,0x0,0x30,0x49,0x69,0x81,0x31,0x81,0x45,0x82,0x48,0x82,0x74,0x83,0x1d,0x89,0x2b,0x8b,0xd,0xa4,0x59,0xa4,0x77,0xa5,0x3e,0xa6,0xf,0xa6,0x45,0xa6,0x79,0xa7,0x10,0x30,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc0,0x80,0xc0,0xde,0xc1,0x2,0xa4,0xc1,0x2,0xa6,0xc1,0x3,0x36,0xc1,0x4,0x1e,0xc1,0x4,0x92,0xc1,0x5,0xa4,0xc1,0x5,0xa6,0xc1,0x6,0x84,0xc1,0x6,0xec,0xc1,0x7,0xbe,0xc1,0x8,0x36,0xc1,0x8,0x7e,0xc1,0x8,0xc6,0xc1,0x9,0x16,0xc1,0x9,0x78,0xc1,0x9,0xda,0xc1,0xa,0x54,0xc1,0xa,0x56,0xc1,0xa,0xfa,0xc1,0xb,0xb0,0xc1,0xc,0x2c,0xc1,0xc,0x8a,0xc1,0xc,0xea,0xc1,0xd,0x4a,0xc1,0xd,0xaa,0xc1,0xe,0x6e,0xc1,0xf,0x24,0xc1,0xf,0xcc,0xc1,0xf,0xce,0xc1,0xf,0xf8,0xc1,0x10,0x4e,0xc1,0x10,0xa4,0xc1,0x10,0xfa,0xc1,0x11,0x50,0xc1,0x11,0xa6,0xc1,0x11,0xfc,0xc1,0x12,0x52,0xc1,0x12,0xa8,0xc1,0x13,0x34,0xc1,0x13,0x74,0xc1,0x13,0x76,0xc1,0x13,0x98,0xc1,0x13,0xbc,0xc1,0x14,0x0,0xc1,0x14,0x96,0xc1,0x15,0x7a,0xc1,0x16,0x3e,0xc1,0x16,0xf4,0xc1,0x17,0xb8,0xc1,0x18,0xbc,0xc1,0x18,0xde,0xc1,0x18,0xe0,0xc1,0x19,0x6,0xc1,0x19,0x44,0xc1,0x19,0x46,0xc1,0x19,0x72,0xc1,0x19,0x98,0xc1,0x19,0xb8,0xc1,0x1a,0x7e,0xc1,0x1b,0x44,0xc1,0x1c,0xa,0xc1,0x1c,0xd0,0xc1,0x1c,0xd2,0xc1,0x1d,0xe0,0xc1,0x1e,0xee,0xc1,0x1f,0xfc,0xc1,0x21,0xa,0xc1,0x21,0xc,0xc1,0x21,0x38,0xc1,0x21,0xac,0xc1,0x21,0xae,0xc1,0x21,0xd6,0xc1,0x22,0x2,0xc1,0x22,0x76,0xc1,0x22,0xdc,0xc1,0x22,0xde,0xc1,0x23,0x2,0xc1,0x23,0x2a,0xc1,0x23,0x88,0xc1,0x23,0xcc,0xc1,0x23,0xfc,0xc1,0x24,0x66,0xc1,0x24,0xa2,0xc1,0x24,0xca,0xc1,0x24,0xcc,0xc1,0x24,0xee,0xc1,0x25,0x1c,0xc1,0x25,0x58,0xc1,0x25,0x7c,0xc1,0x25,0xd6,0xc1,0x26,0x1a,0xc1,0x26,0x4a,0xc1,0x26,0xb0,0xc1,0x26,0xec,0xc1,0x27,0x14,0xc1,0x27,0x16,0xc1,0x27,0x50,0xc1,0x27,0x7a,0xc1,0x27,0x9a,0xc1,0x28,0x54,0xc1,0x28,0x80,0xc1,0x29,0x36,0xc1,0x29,0x62,0xc1,0x29,0x94,0xc1,0x29,0xc0,0xc1,0x29,0xe4,0xc1,0x2a,0x6,0xc1,0x2a,0x42,0xc1,0x2a,0x7a,0xc1,0x2a,0xd2,0xc1,0x2a,0xe6,0xc1,0x2b,0x26,0xc1,0x2b,0x6a,0xc1,0x2b,0x9c,0xc1,0x2b,0xc0,0xc1,0x2c,0x3e,0xc1,0x2c,0x8c,0xc1,0x2c,0xf4,0xc1,0x2d,0x60,0xc1,0x2d,0xae,0xc1,0x2e,0x22,0xc1,0x2e,0xb2,0xc1,0x2f,0x6,0xc1,0x2f,0x54,0xc1,0x2f,0xc0,0xc1,0x30,0x88,0xc1,0x31,0xe,0xc1,0x31,0x5e,0xc1,0x31,0xc6,0xc1,0x32,0x34,0xc1,0x32,0xa2,0xc1,0x33,0x10,0xc1,0x33,0x7e,0xc1,0x34,0x40,0xc1,0x35,0x56,0xc1,0x36,0x6c,0xc1,0x37,0x30,0xc1,0x37,0xf4,0xc1,0x38,0x64,0xc1,0x39,0x28,0xc1,0x39,0x98,0xc1,0x3a,0x5c,0xc1,0x3a,0x5e,0xc1,0x3b,0x22,0xc1,0x3c,0x3a,0xc1,0x3c,0xe8,0xc1,0x3d,0x58,0xc1,0x3d,0x5a,0xc1,0x3e,0x20,0xc1,0x3e,0xe6,0xc1,0x40,0x0,0xc1,0x41,0x1a,0xc1,0x42,0x34,0xc1,0x43,0xa2,0xc1,0x43,0xa4,0xc1,0x44,0xc,0xc1,0x44,0x74,0xc1,0x44,0xdc,0xc1,0x45,0x72,0xc1,0x46,0x52,0xc1,0x46,0x54,0xc1,0x47,0x54,0xc1,0x48,0x54,0xc1,0x49,0x54,0xc1,0x4a,0x54,0xc1,0x4b,0x54,0xc1,0x4c,0xac,0xc1,0x4e,0x4,0xc1,0x4f,0x5c,0xc1,0x50,0xb4,0xc1,0x50,0xb6,0xc1,0x51,0x36,0xc1,0x51,0x38,0xc1,0x51,0x66,0xc1,0x51,0x9e,0xc1,0x51,0xd6,0xc1,0x52,0x12,0xc1,0x52,0x5c,0xc1,0x52,0xe8,0xc1,0x53,0x44,0xc1,0x53,0x46,0xc1,0x53,0x72,0xc1,0x53,0xb4,0xc1,0x54,0xac,0xc1,0x54,0xf2,0xc1,0x55,0x10,0xc1,0x55,0xc8,0xc1,0x55,0xe6,0xc1,0x56,0x2c,0xc1,0x57,0x86,0xc1,0x57,0xce,0xc1,0x57,0xd0,0xc1,0x58,0x8c,0xc1,0x59,0x1c,0xc1,0x59,0x1e,0xc1,0x59,0x3c,0xc1,0x59,0x6c,0xc1,0x59,0x9c,0xc1,0x59,0xcc,0xc1,0x59,0xfc,0xc1,0x5a,0x2c,0xc1,0x5a,0x2e,0xc1,0x5a,0x6e,0xc1,0x5a,0xb0,0xc1,0x5a,0xb2,0xc1,0x5a,0xf0,0xc1,0x5b,0x32,0xc1,0x5b,0x70,0xc1,0x5b,0xb2,0xc1,0x5b,0xb4,0xc1,0x5b,0xf6,0xc1,0x5c,0x38,0xc1,0x5c,0x78,0xc1,0x5c,0xba,0xc1,0x5c,0xfc,0xc1,0x5d,0x3e,0xc1,0x5d,0x84,0xc1,0x5d,0x86,0xc1,0x5d,0xc6,0xc1,0x5e,0x6,0xc1,0x5e,0x46,0xc1,0x5e,0x86,0xc1,0x5e,0xc8,0xc1,0x5f,0xa,0xc1,0x5f,0x4a,0xc1,0x5f,0x8c,0xc1,0x5f,0x8e,0xc1,0x5f,0xbe,0xc1,0x5f,0xf2,0xc1,0x60,0x26,0xc1,0x60,0x4e,0xc1,0x60,0x50,0xc1,0x60,0x70,0xc1,0x60,0x96,0xc1,0x61,0x64,0xc1,0x61,0xb6,0xc1,0x62,0x52,0xc1,0x62,0x7c,0xc1,0x62,0xe8,0xc1,0x63,0x48,0xc1,0x63,0x8e,0xc1,0x64,0x1e,0xc1,0x64,0x20,0xc1,0x64,0x80,0xc1,0x64,0xbe,0xc1,0x65,0x44,0xc1,0x65,0xa0,0xc1,0x66,0x1e,0xc1,0x66,0x4a,0xc1,0x66,0x96,0xc1,0x67,0x2,0xc1,0x67,0x4a,0xc1,0x67,0x8c,0xc1,0x67,0xd2,0xc1,0x68,0x52,0xc1,0x68,0xa0,0xc1,0x68,0xec,0xc1,0x69,0x6a,0xc1,0x69,0xbe,0xc1,0x6a,0x2e,0xc1,0x6a,0x94,0xc1,0x6a,0xc8,0xc1,0x6a,0xee,0xc1,0x6b,0x40,0xc1,0x6b,0xb6,0xc1,0x6b,0xd2,0xc1,0x6c,0x3c,0xc1,0x6c,0x6a,0xc1,0x6c,0xea,0xc1,0x6d,0x1e,0xc1,0x6d,0x78,0xc1,0x6d,0xf2,0xc1,0x6e,0x16,0xc1,0x6e,0x44,0xc1,0x6e,0x9a,0xc1,0x6f,0xc,0xc1,0x6f,0x30,0xc1,0x6f,0x6c,0xc1,0x6f,0xe0,0xc1,0x70,0x30,0xc1,0x70,0x94,0xc1,0x70,0xc0,0xc1,0x71,0x0,0xc1,0x71,0x86,0xc1,0x71,0xbc,0xc1,0x72,0x14,0xc1,0x72,0x8a,0xc1,0x72,0xec,0xc1,0x73,0x28,0xc1,0x73,0xaa,0xc1,0x73,0xe0,0xc1,0x74,0x34,0xc1,0x74,0xa6,0xc1,0x75,0x4,0xc1,0x75,0x4a,0xc1,0x75,0xd6,0xc1,0x76,0x7e,0xc1,0x77,0x12,0xc1,0x77,0x6c,0xc1,0x77,0xb8,0xc1,0x78,0x4a,0xc1,0x78,0xf8,0xc1,0x79,0x92,0xc1,0x79,0xf2,0xc1,0x7a,0x36,0xc1,0x7a,0xb0,0xc1,0x7b,0x22,0xc1,0x7b,0xa0,0xc1,0x7c,0x2a,0xc1,0x7c,0x70,0xc1,0x7c,0xc8,0xc1,0x7d,0x3e,0xc1,0x7d,0xb8,0xc1,0x7e,0xc,0xc1,0x7e,0x34,0xc1,0x7e,0x6c,0xc1,0x7f,0x0,0xc1,0x7f,0x90,0xc1,0x80,0x3e,0xc1,0x80,0xde,0xc1,0x81,0x6a,0xc1,0x81,0xd0,0xc1,0x82,0x32,0xc1,0x82,0xbe,0xc1,0x83,0x5e,0xc1,0x83,0x9a,0xc1,0x83,0xf6,0xc1,0x84,0x48,0xc1,0x84,0xaa,0xc1,0x84,0xe2,0xc1,0x85,0x74,0xc1,0x85,0xfa,0xc1,0x86,0xd2,0xc1,0x87,0x8,0xc1,0x87,0x4a,0xc1,0x87,0xa6,0xc1,0x87,0xb2,0xc1,0x87,0xf0,0xc1,0x88,0x26,0xc1,0x88,0x56,0xc1,0x88,0xb6,0xc1,0x88,0xf4,0xc1,0x89,0x22,0xc1,0x89,0x4c,0xc1,0x89,0x84,0xc1,0x8a,0x52,0xc1,0x8a,0x88,0xc1,0x8a,0xbe,0xc1,0x8a,0xf4,0xc1,0x8b,0x26,0xc1,0x8b,0x32,0xc1,0x8b,0xfc,0xc1,0x8c,0xa2,0xc1,0x8c,0xea,0xc1,0x8d,0x20,0xc1,0x8d,0x42,0xc1,0x8d,0x9c,0xc1,0x8d,0xc8,0xc1,0x8d,0xf4,0xc1,0x8e,0x2e,0xc1,0x8e,0x66,0xc1,0x8e,0x9c,0xc1,0x8e,0xda,0xc1,0x8f,0x10,0xc1,0x8f,0x46,0xc1,0x8f,0x52,0xc1,0x8f,0x54,0xc1,0x8f,0x7a,0xc1,0x8f,0xb0,0xc1,0x90,0x14,0xc1,0x90,0x66,0xc1,0x90,0xe2,0xc1,0x90,0xe4,0xc1,0x91,0xe,0xc1,0x91,0x8a,0xc1,0x91,0xe0,0xc1,0x92,0x6,0xc1,0x92,0x8,0xc1,0x92,0x56,0xc1,0x92,0xc2,0xc1,0x93,0x0,0xc1,0x93,0x30,0xc1,0x93,0x54,0xc1,0x93,0xd2,0xc1,0x94,0x18,0xc1,0x94,0x78,0xc1,0x94,0xc2,0xc1,0x95,0x82,0xc1,0x95,0xfa,0xc1,0x96,0x2a,0xc1,0x96,0xda,0xc1,0x97,0x1e,0xc1,0x97,0xde,0xc1,0x98,0x56,0xc1,0x98,0x86,0xc1,0x99,0x30,0xc1,0x99,0x74,0xc1,0x9a,0x34,0xc1,0x9a,0xac,0xc1,0x9a,0xdc,0xc1,0x9b,0x86,0xc1,0x9b,0x88,0xc1,0x9c,0x52,0xc1,0x9d,0x20,0xc1,0x9d,0x5a,0xc1,0x9d,0xf6,0xc1,0x9e,0x2e,0xc1,0x9e,0xb8,0xc1,0x9f,0x72,0xc1,0x9f,0xb4,0xc1,0x9f,0xd0,0xc1,0x9f,0xd2,0xc1,0xa0,0x1c,0xc1,0xa1,0x2,0xc1,0xa1,0x4,0xc1,0xa1,0x38,0xc1,0xa2,0xa,0xc1,0xa2,0xc,0xc1,0xa2,0xb0,0xc1,0xa2,0xec,0xc1,0xa3,0x60,0xc1,0xa3,0xd0,0xc1,0xa4,0x2e,0xc1,0xa4,0x5e,0xc1,0xa5,0x0,0xc1,0xa5,0x58,0xc1,0xa6,0x3c,0xc1,0xa6,0xda,0xc1,0xa6,0xdc,0xc1,0xa7,0x2e,0xc1,0xa8,0x18,0xc1,0xa8,0xf6,0xc1,0xa9,0x58,0xc1,0xa9,0x9a,0xc1,0xaa,0x14,0xc1,0xab,0x4,0xc1,0xab,0x6,0xc1,0xab,0x46,0xc1,0xab,0xbe,0xc1,0xac,0x80,0xc1,0xac,0x82,0xc1,0xad,0xa,0xc1,0xad,0x36,0xc1,0xad,0x88,0xc1,0xad,0xd0,0xc1,0xad,0xd2,0xc1,0xae,0xa8,0xc1,0xae,0xe4,0xc1,0xaf,0x82,0xc1,0xaf,0xba,0xc1,0xaf,0xf4,0xc1,0xb0,0xc4,0xc1,0xb1,0x7e,0xc1,0xb2,0x68,0xc1,0xb3,0x24,0xc1,0xb3,0x66,0xc1,0xb3,0x82,0xc1,0xb3,0x84,0xc1,0xb4,0x38,0xc1,0xb4,0x74,0xc1,0xb5,0x16,0xc1,0xb5,0xc6,0xc1,0xb6,0x4c,0xc1,0xb6,0x4e,0xc1,0xb6,0x98,0xc1,0xb7,0x14,0xc1,0xb7,0x68,0xc1,0xb7,0xda,0xc1,0xb8,0x4,0xc1,0xb8,0x1e,0xc1,0xb8,0x20,0xc1,0xb8,0x6e,0xc1,0xb8,0xb4,0xc1,0xb9,0x50,0xc1,0xb9,0xb0,0xc1,0xb9,0xe8,0xc1,0xba,0x4a,0xc1,0xbb,0xe,0xc1,0xbb,0x70,0xc1,0xbb,0xd8,0xc1,0xbb,0xfa,0xc1,0xbc,0x60,0xc1,0xbc,0xf8,0xc1,0xbd,0x5c,0xc1,0xbd,0xc4,0xc1,0xbe,0x10,0xc1,0xbe,0x72,0xc1,0xbe,0xd8,0xc1,0xbf,0x44,0xc1,0xbf,0xb6,0xc1,0xc0,0x0,0xc1,0xc0,0x66,0xc1,0xc0,0xd2,0xc1,0xc1,0x38,0xc1,0xc1,0x7e,0xc1,0xc1,0xc4,0xc1,0xc2,0x58,0xc1,0xc2,0xec,0xc1,0xc3,0x7e,0xc1,0xc3,0xd2,0xc1,0xc4,0x26,0xc1,0xc4,0x8a,0xc1,0xc4,0xdc,0xc1,0xc4,0xde,0xc1,0xc5,0x26,0xc1,0xc5,0x82,0xc1,0xc6,0x94,0xc1,0xc6,0xec,0xc1,0xc7,0x44,0xc1,0xc7,0x92,0xc1,0xc7,0xde,0xc1,0xc8,0x4e,0xc1,0xc8,0xac,0xc1,0xc8,0xc8,0xc1,0xc9,0x9c,0xc1,0xc9,0xe0,0xc1,0xca,0x36,0xc1,0xca,0xca,0xc1,0xcb,0x48,0xc1,0xcb,0xc2,0xc1,0xcc,0x2e,0xc1,0xcc,0x84,0xc1,0xcc,0xd6,0xc1,0xcd,0x1a,0xc1,0xcd,0x58,0xc1,0xcd,0x9a,0xc1,0xce,0x9e,0xc1,0xce,0xa0,0xc1,0xce,0xe0,0xc1,0xcf,0x20,0xc1,0xcf,0x5e,0xc1,0xcf,0xa2,0xc1,0xcf,0xa4,0xc1,0xcf,0xe2,0xc1,0xd0,0x2c,0xc1,0xd0,0x6c,0xc1,0xd0,0xb8,0xc1,0xd0,0xba,0xc1,0xd1,0x2c,0xc1,0xd1,0xb2,0xc1,0xd2,0x2e,0xc1,0xd2,0x78,0xc1,0xd3,0x1a,0xc1,0xd3,0x74,0xc1,0xd3,0xc0,0xc1,0xd4,0xfa,0xc1,0xd5,0x5e,0xc1,0xd5,0x7a,0xc1,0xd5,0x7c,0xc1,0xd5,0xd2,0xc1,0xd6,0x9c,0xc1,0xd7,0x32,0xc1,0xd7,0xc8,0xc1,0xd8,0x88,0xc1,0xd8,0xe4,0xc1,0xd9,0x1e,0xc1,0xd9,0xa8,0xc1,0xd9,0xf8,0xc1,0xda,0x5c,0xc1,0xda,0xb6,0xc1,0xdb,0x2,0xc1,0xdc,0x48,0xc1,0xdc,0xd4,0xc1,0xdd,0x1a,0xc1,0xdd,0x6a,0xc1,0xdd,0xce,0xc1,0xde,0x28,0xc1,0xde,0x74,0xc1,0xdf,0xba,0xc1,0xe0,0x82,0xc1,0xe1,0x2,0xc1,0xe1,0x76,0xc1,0xe2,0x24,0xc1,0xe2,0x78,0xc1,0xe2,0xcc,0xc1,0xe3,0x2e,0xc1,0xe3,0xe2,0xc1,0xe4,0x7a,0xc1,0xe4,0xbc,0xc1,0xe5,0x22,0xc1,0xe5,0x80,0xc1,0xe5,0xba,0xc1,0xe6,0x84,0xc1,0xe6,0xfc,0xc1,0xe7,0x70,0xc1,0xe7,0xfe,0xc1,0xe8,0x4a,0xc1,0xe8,0xe4,0xc1,0xe9,0x70,0xc1,0xea,0x1a,0xc1,0xea,0xde,0xc1,0xeb,0x2e,0xc1,0xeb,0xc6,0xc1,0xec,0x5c,0xc1,0xed,0x4,0xc1,0xed,0x94,0xc1,0xee,0xc8,0xc1,0xee,0xfc,0xc1,0xee,0xfe,0xc1,0xef,0x70,0xc1,0xef,0xb0,0xc1,0xf0,0x3a,0xc1,0xf0,0x5a,0xc1,0xf0,0xc6,0xc1,0xf1,0x30,0xc1,0xf1,0x94,0xc1,0xf1,0xfc,0xc1,0xf2,0x64,0xc1,0xf2,0xdc,0xc1,0xf2,0xe4,0xc1,0xf3,0x32,0xc1,0xf3,0xfe,0xc1,0xf4,0xb0,0xc1,0xf5,0x20,0xc1,0xf5,0x22,0xc1,0xf5,0x6e,0xc1,0xf5,0xbe,0xc1,0xf6,0x50,0xc1,0xf6,0x86,0xc1,0xf6,0xfa,0xc1,0xf7,0x70,0xc1,0xf7,0x9a,0xc1,0xf7,0x9c,0xc1,0xf8,0x34,0xc1,0xf8,0x9c,0xc1,0xf8,0x9e,0xc1,0xf9,0x6,0xc1,0xf9,0x7e,0xc1,0xf9,0x80,0xc1,0xfa,0xa,0xc1,0xfa,0xa4,0xc1,0xfa,0xa6,0xc1,0xfb,0x68,0xc1,0xfc,0x26,0xc1,0xfc,0x96,0xc1,0xfc,0xf0,0xc1,0xfd,0x28,0xc1,0xfd,0x8c,0xc1,0xfe,0x1e,0xc1,0xfe,0x4e,0xc1,0xfe,0x86,0xc1,0xfe,0xa4,0xc1,0xfe,0xea,0xc1,0xff,0x3c,0xc1,0xff,0xd6,0xc2,0x1,0x0,0x48,0xc2,0x1,0x0,0x8e,0xc2,0x1,0x1,0xa,0xc2,0x1,0x1,0xc6,0xc2,0x1,0x2,0x48,0xc2,0x1,0x2,0xec,0xc2,0x1,0x3,0x42,0xc2,0x1,0x3,0x96,0xc2,0x1,0x3,0xfa,0xc2,0x1,0x4,0x94,0xc2,0x1,0x5,0x62,0xc2,0x1,0x5,0xb4,0xc2,0x1,0x6,0x1c,0xc2,0x1,0x6,0x7a,0xc2,0x1,0x6,0xec,0xc2,0x1,0x7,0xa8,0xc2,0x1,0x7,0xf8,0xc2,0x1,0x8,0x82,0xc2,0x1,0x8,0xde,0xc2,0x1,0x9,0x32,0xc2,0x1,0x9,0x82,0xc2,0x1,0x9,0xf2,0xc2,0x1,0xa,0x40,0xc2,0x1,0xa,0xc4,0xc2,0x1,0xb,0xa,0xc2,0x1,0xb,0x68,0xc2,0x1,0xb,0xba,0xc2,0x1,0xc,0x30,0xc2,0x1,0xc,0xa0,0xc2,0x1,0xc,0xee,0xc2,0x1,0xd,0x4a,0xc2,0x1,0xd,0x88,0xc2,0x1,0xd,0xda,0xc2,0x1,0xe,0x68,0xc2,0x1,0xe,0xba,0xc2,0x1,0xf,0x24,0xc2,0x1,0xf,0xba,0xc2,0x1,0xf,0xd6,0xc2,0x1,0x10,0x28,0xc2,0x1,0x10,0x6e,0xc2,0x1,0x10,0xca,0xc2,0x1,0x11,0x26,0xc2,0x1,0x11,0x78,0xc2,0x1,0x11,0xde,0xc2,0x1,0x12,0x50,0xc2,0x1,0x12,0xc0,0xc2,0x1,0x13,0x7a,0xc2,0x1,0x14,0x1e,0xc2,0x1,0x14,0x3a,0xc2,0x1,0x14,0xaa,0xc2,0x1,0x14,0xec,0xc2,0x1,0x15,0x46,0xc2,0x1,0x15,0xb6,0xc2,0x1,0x16,0x3c,0xc2,0x1,0x16,0xb2,0xc2,0x1,0x17,0x4,0xc2,0x1,0x17,0x86,0xc2,0x1,0x18,0xa,0xc2,0x1,0x18,0xe8,0xc2,0x1,0x19,0x70,0xc2,0x1,0x19,0xf6,0xc2,0x1,0x1a,0x92,0xc2,0x1,0x1b,0x5c,0xc2,0x1,0x1b,0xde,0xc2,0x1,0x1c,0x64,0xc2,0x1,0x1d,0x1a,0xc2,0x1,0x1d,0x90,0xc2,0x1,0x1e,0xa6,0xc2,0x1,0x1f,0x70,0xc2,0x1,0x20,0x38,0xc2,0x1,0x20,0xda,0xc2,0x1,0x21,0x5a,0xc2,0x1,0x21,0xb4,0xc2,0x1,0x22,0x24,0xc2,0x1,0x22,0xaa,0xc2,0x1,0x23,0x20,0xc2,0x1,0x23,0x72,0xc2,0x1,0x24,0x20,0xc2,0x1,0x24,0x64,0xc2,0x1,0x24,0xbc,0xc2,0x1,0x25,0x16,0xc2,0x1,0x25,0xa8,0xc2,0x1,0x26,0x3c,0xc2,0x1,0x26,0xb8,0xc2,0x1,0x26,0xf8,0xc2,0x1,0x27,0x46,0xc2,0x1,0x27,0xa2,0xc2,0x1,0x27,0xde,0xc2,0x1,0x28,0x2c,0xc2,0x1,0x28,0x84,0xc2,0x1,0x28,0xc0,0xc2,0x1,0x29,0xe,0xc2,0x1,0x29,0x66,0xc2,0x1,0x29,0xa6,0xc2,0x1,0x29,0xf4,0xc2,0x1,0x2a,0x42,0xc2,0x1,0x2a,0xbe,0xc2,0x1,0x2a,0xfe,0xc2,0x1,0x2b,0x6a,0xc2,0x1,0x2b,0xb0,0xc2,0x1,0x2c,0x0,0xc2,0x1,0x2c,0x4e,0xc2,0x1,0x2c,0xa8,0xc2,0x1,0x2d,0x22,0xc2,0x1,0x2d,0x74,0xc2,0x1,0x2d,0xd8,0xc2,0x1,0x2e,0xac,0xc2,0x1,0x2e,0xf6,0xc2,0x1,0x2f,0x40,0xc2,0x1,0x2f,0xb6,0xc2,0x1,0x30,0x1c,0xc2,0x1,0x30,0x82,0xc2,0x1,0x31,0xa,0xc2,0x1,0x31,0x5c,0xc2,0x1,0x31,0xce,0xc2,0x1,0x32,0x28,0xc2,0x1,0x32,0x6a,0xc2,0x1,0x32,0xf0,0xc2,0x1,0x33,0x4e,0xc2,0x1,0x33,0xc0,0xc2,0x1,0x33,0xfc,0xc2,0x1,0x34,0x36,0xc2,0x1,0x34,0x90,0xc2,0x1,0x34,0xca,0xc2,0x1,0x35,0x1a,0xc2,0x1,0x35,0x92,0xc2,0x1,0x35,0xcc,0xc2,0x1,0x36,0x26,0xc2,0x1,0x36,0x82,0xc2,0x1,0x37,0x2,0xc2,0x1,0x37,0x2e,0xc2,0x1,0x37,0xca,0xc2,0x1,0x38,0x32,0xc2,0x1,0x38,0x78,0xc2,0x1,0x38,0xcc,0xc2,0x1,0x39,0x40,0xc2,0x1,0x39,0xf0,0xc2,0x1,0x3a,0x8c,0xc2,0x1,0x3a,0xf8,0xc2,0x1,0x3b,0x38,0xc2,0x1,0x3b,0x54,0xc2,0x1,0x3b,0xa0,0xc2,0x1,0x3b,0xba,0xc2,0x1,0x3b,0xee,0xc2,0x1,0x3c,0x28,0xc2,0x1,0x3c,0x84,0xc2,0x1,0x3c,0x86,0xc2,0x1,0x3c,0xac,0xc2,0x1,0x3d,0x2,0xc2,0x1,0x3d,0x56,0xc2,0x1,0x3d,0xac,0xc2,0x1,0x3e,0x0,0xc2,0x1,0x3e,0x38,0xc2,0x1,0x3e,0x94,0xc2,0x1,0x3e,0xf0,0xc2,0x1,0x3f,0x4c,0xc2,0x1,0x3f,0xa6,0xc2,0x1,0x40,0x18,0xc2,0x1,0x40,0x8a,0xc2,0x1,0x41,0x4,0xc2,0x1,0x41,0x7a,0xc2,0x1,0x42,0x1e,0xc2,0x1,0x42,0x68,0xc2,0x1,0x43,0x4c,0xc2,0x1,0x44,0x6,0xc2,0x1,0x44,0x56,0xc2,0x1,0x44,0x98,0xc2,0x1,0x44,0xea,0xc2,0x1,0x45,0x66,0xc2,0x1,0x46,0x0,0xc2,0x1,0x46,0x84,0xc2,0x1,0x46,0xb0,0xc2,0x1,0x47,0x2e,0xc2,0x1,0x47,0x5e,0xc2,0x1,0x47,0xa2,0xc2,0x1,0x48,0x46,0xc2,0x1,0x48,0x88,0xc2,0x1,0x48,0xd6,0xc2,0x1,0x49,0x4c,0xc2,0x1,0x49,0x82,0xc2,0x1,0x49,0xe2,0xc2,0x1,0x4a,0x46,0xc2,0x1,0x4b,0x1a,0xc2,0x1,0x4b,0x7a,0xc2,0x1,0x4c,0x58,0xc2,0x1,0x4c,0xfc,0xc2,0x1,0x4d,0x7c,0xc2,0x1,0x4d,0xca,0xc2,0x1,0x4e,0x40,0xc2,0x1,0x4e,0xb2,0xc2,0x1,0x4e,0xe8,0xc2,0x1,0x4f,0x48,0xc2,0x1,0x4f,0xac,0xc2,0x1,0x50,0xb4,0xc2,0x1,0x51,0x14,0xc2,0x1,0x52,0x26,0xc2,0x1,0x52,0xfe,0xc2,0x1,0x53,0x42,0xc2,0x1,0x53,0x88,0xc2,0x1,0x54,0x44,0xc2,0x1,0x54,0x84,0xc2,0x1,0x54,0xc6,0xc2,0x1,0x55,0x74,0xc2,0x1,0x55,0xb0,0xc2,0x1,0x55,0xf2,0xc2,0x1,0x56,0xa2,0xc2,0x1,0x56,0xde,0xc2,0x1,0x57,0x20,0xc2,0x1,0x57,0xce,0xc2,0x1,0x58,0xe,0xc2,0x1,0x58,0x50,0xc2,0x1,0x58,0x92,0xc2,0x1,0x59,0x5e,0xc2,0x1,0x59,0x9c,0xc2,0x1,0x59,0xd2,0xc2,0x1,0x5a,0xc,0xc2,0x1,0x5b,0x8,0xc2,0x1,0x5b,0x4c,0xc2,0x1,0x5b,0x8c,0xc2,0x1,0x5b,0xcc,0xc2,0x1,0x5c,0xe4,0xc2,0x1,0x5d,0x26,0xc2,0x1,0x5d,0x66,0xc2,0x1,0x5d,0xa6,0xc2,0x1,0x5e,0x78,0xc2,0x1,0x5e,0xe4,0xc2,0x1,0x5f,0x24,0xc2,0x1,0x5f,0x5e,0xc2,0x1,0x5f,0xfa,0xc2,0x1,0x60,0x38,0xc2,0x1,0x60,0x72,0xc2,0x1,0x61,0xe,0xc2,0x1,0x61,0x54,0xc2,0x1,0x61,0x9c,0xc2,0x1,0x62,0x58,0xc2,0x1,0x62,0x9a,0xc2,0x1,0x62,0xe0,0xc2,0x1,0x63,0x40,0xc2,0x1,0x63,0xa2,0xc2,0x1,0x64,0x12,0xc2,0x1,0x64,0x58,0xc2,0x1,0x64,0xd4,0xc2,0x1,0x65,0x4c,0xc2,0x1,0x65,0xdc,0xc2,0x1,0x66,0x62,0xc2,0x1,0x66,0xba,0xc2,0x1,0x67,0x32,0xc2,0x1,0x67,0x8a,0xc2,0x1,0x68,0x2,0xc2,0x1,0x68,0x44,0xc2,0x1,0x68,0xba,0xc2,0x1,0x69,0x98,0xc2,0x1,0x69,0xde,0xc2,0x1,0x6a,0x64,0xc2,0x1,0x6b,0x7c,0xc2,0x1,0x6b,0xbc,0xc2,0x1,0x6c,0x42,0xc2,0x1,0x6d,0x54,0xc2,0x1,0x6d,0x98,0xc2,0x1,0x6e,0x8e,0xc2,0x1,0x6e,0xa8,0xc2,0x1,0x6e,0xdc,0xc2,0x1,0x6f,0x16,0xc2,0x1,0x6f,0x8e,0xc2,0x1,0x6f,0x90,0xc2,0x1,0x70,0x1c,0xc2,0x1,0x70,0x4a,0xc2,0x1,0x70,0xcc,0xc2,0x1,0x71,0x26,0xc2,0x1,0x71,0x28,0xc2,0x1,0x71,0x50,0xc2,0x1,0x71,0x8e,0xc2,0x1,0x71,0x90,0xc2,0x1,0x71,0xc4,0xc2,0x1,0x72,0x32,0xc2,0x1,0x72,0xfe,0xc2,0x1,0x73,0x0,0xc2,0x1,0x73,0x50,0xc2,0x1,0x73,0x86,0xc2,0x1,0x73,0xcc,0xc2,0x1,0x74,0x30,0xc2,0x1,0x74,0xde,0xc2,0x1,0x75,0x4e,0xc2,0x1,0x75,0xbe,0xc2,0x1,0x76,0x2e,0xc2,0x1,0x76,0xa4,0xc2,0x1,0x76,0xe8,0xc2,0x1,0x77,0x84,0xc2,0x1,0x77,0xd0,0xc2,0x1,0x78,0xe,0xc2,0x1,0x78,0x10,0xc2,0x1,0x78,0x8c,0xc2,0x1,0x78,0xa8,0xc2,0x1,0x78,0xd0,0xc2,0x1,0x79,0x4,0xc2,0x1,0x79,0x20,0xc2,0x1,0x79,0x76,0xc2,0x1,0x79,0xa6,0xc2,0x1,0x79,0xf0,0xc2,0x1,0x7a,0x1c,0xc2,0x1,0x7a,0x62,0xc2,0x1,0x7a,0x8c,0xc2,0x1,0x7a,0x98,0xc2,0x1,0x7a,0x9a,0xc2,0x1,0x7a,0xcc,0xc2,0x1,0x7a,0xf6,0xc2,0x1,0x7b,0x32,0xc2,0x1,0x7b,0x68,0xc2,0x1,0x7b,0xb2,0xc2,0x1,0x7c,0x14,0xc2,0x1,0x7c,0x6e,0xc2,0x1,0x7c,0xae,0xc2,0x1,0x7c,0xb0,0xc2,0x1,0x7c,0xf2,0xc2,0x1,0x7d,0x2e,0xc2,0x1,0x7d,0x62,0xc2,0x1,0x7d,0xa2,0xc2,0x1,0x7d,0xda,0xc2,0x1,0x7e,0x20,0xc2,0x1,0x7e,0x60,0xc2,0x1,0x7e,0x94,0xc2,0x1,0x7e,0xc6,0xc2,0x1,0x7f,0x12,0xc2,0x1,0x7f,0x58,0xc2,0x1,0x7f,0xa0,0xc2,0x1,0x7f,0xde,0xc2,0x1,0x80,0x6e,0xc2,0x1,0x81,0x46,0xc2,0x1,0x81,0xac,0xc2,0x1,0x82,0x10,0xc2,0x1,0x82,0x76,0xc2,0x1,0x83,0x24,0xc2,0x1,0x83,0x74,0xc2,0x1,0x83,0xc2,0xc2,0x1,0x84,0x26,0xc2,0x1,0x84,0x52,0xc2,0x1,0x84,0x90,0xc2,0x1,0x84,0xde,0xc2,0x1,0x85,0x1c,0xc2,0x1,0x85,0x5a,0xc2,0x1,0x85,0xae,0xc2,0x1,0x86,0x18,0xc2,0x1,0x86,0xa2,0xc2,0x1,0x86,0xe8,0xc2,0x1,0x87,0x6c,0xc2,0x1,0x88,0x18,0xc2,0x1,0x88,0x68,0xc2,0x1,0x88,0xb8,0xc2,0x1,0x89,0x22,0xc2,0x1,0x89,0x54,0xc2,0x1,0x89,0xa2,0xc2,0x1,0x8a,0x10,0xc2,0x1,0x8a,0x38,0xc2,0x1,0x8a,0x74,0xc2,0x1,0x8b,0x7e,0xc2,0x1,0x8b,0xa6,0xc2,0x1,0x8b,0xe0,0xc2,0x1,0x8c,0x1c,0xc2,0x1,0x8c,0x88,0xc2,0x1,0x8c,0xf0,0xc2,0x1,0x8d,0x6e,0xc2,0x1,0x8d,0xd2,0xc2,0x1,0x8e,0x0,0xc2,0x1,0x8e,0xc,0xc2,0x1,0x8e,0xe,0xc2,0x1,0x8e,0x56,0xc2,0x1,0x8e,0xa0,0xc2,0x1,0x8e,0xe6,0xc2,0x1,0x8f,0x2a,0xc2,0x1,0x8f,0x68,0xc2,0x1,0x8f,0xa2,0xc2,0x1,0x8f,0xa4,0xc2,0x1,0x8f,0xf6,0xc2,0x1,0x91,0xc,0xc2,0x1,0x91,0x3a,0xc2,0x1,0x91,0x3c,0xc2,0x1,0x91,0xb0,0xc2,0x1,0x92,0x0,0xc2,0x1,0x92,0x44,0xc2,0x1,0x92,0x6c,0xc2,0x1,0x92,0x70,0xc2,0x1,0x92,0x72,0xc2,0x1,0x92,0xb2,0xc2,0x1,0x92,0xec,0xc2,0x1,0x93,0x1a,0xc2,0x1,0x93,0x92,0xc2,0x1,0x93,0xfe,0xc2,0x1,0x94,0x38,0xc2,0x1,0x94,0x92,0xc2,0x1,0x94,0x94,0xc2,0x1,0x94,0xde,0xc2,0x1,0x94,0xf2,0xc2,0x1,0x95,0x4e,0xc2,0x1,0x95,0x90,0xc2,0x1,0x95,0xce,0xc2,0x1,0x96,0x20,0xc2,0x1,0x96,0x56,0xc2,0x1,0x96,0xbe,0xc2,0x1,0x96,0xf8,0xc2,0x1,0x97,0x64,0xc2,0x1,0x97,0xba,0xc2,0x1,0x98,0x32,0xc2,0x1,0x98,0x82,0xc2,0x1,0x98,0xb6,0xc2,0x1,0x99,0x6,0xc2,0x1,0x99,0x3c,0xc2,0x1,0x99,0x98,0xc2,0x1,0x99,0xd4,0xc2,0x1,0x99,0xf8,0xc2,0x1,0x99,0xfa,0xc2,0x1,0x9a,0x1a,0xc2,0x1,0x9a,0x62,0xc2,0x1,0x9a,0xc4,0xc2,0x1,0x9a,0xf0,0xc2,0x1,0x9b,0x4e,0xc2,0x1,0x9b,0x90,0xc2,0x1,0x9b,0xe8,0xc2,0x1,0x9c,0x32,0xc2,0x1,0x9c,0x7a,0xc2,0x1,0x9c,0xb2,0xc2,0x1,0x9c,0xf6,0xc2,0x1,0x9d,0x4e,0xc2,0x1,0x9d,0xb6,0xc2,0x1,0x9d,0xc2,0xc2,0x1,0x9d,0xc4,0xc2,0x1,0x9d,0xf8,0xc2,0x1,0x9e,0x24,0xc2,0x1,0x9e,0xc2,0xc2,0x1,0x9f,0x66,0xc2,0x1,0x9f,0xf2,0xc2,0x1,0xa0,0x7e,0xc2,0x1,0xa0,0xaa,0xc2,0x1,0xa0,0xac,0xc2,0x1,0xa0,0xcc,0xc2,0x1,0xa0,0xf2,0xc2,0x1,0xa1,0x58,0xc2,0x1,0xa1,0xa6,0xc2,0x1,0xa2,0xe,0xc2,0x1,0xa2,0xae,0xc2,0x1,0xa3,0x64,0xc2,0x1,0xa4,0xa,0xc2,0x1,0xa4,0x54,0xc2,0x1,0xa4,0xb2,0xc2,0x1,0xa4,0xb4,0xc2,0x1,0xa4,0xdc,0xc2,0x1,0xa5,0x8a,0xc2,0x1,0xa5,0xee,0xc2,0x1,0xa6,0x28,0xc2,0x1,0xa6,0x2a,0xc2,0x1,0xa6,0xc4,0xc2,0x1,0xa6,0xe0,0xc2,0x1,0xa6,0xe2,0xc2,0x1,0xa7,0x1c,0xc2,0x1,0xa7,0x1e,0xc2,0x1,0xa7,0x9a,0xc2,0x1,0xa7,0x9c,0xe1,0x88,0x57,0xd9,0xa7,0x22,0xa7,0x23,0x85,0x22,0x8c,0x29,0xa7,0x24,0xa7,0x25,0xa7,0x26,0x92,0x5,0xa7,0x27,0xa7,0x28,0x97,0xa,0xa7,0x29,0xa7,0x2a,0x9a,0x58,0xa7,0x2b,0xa7,0x2c,0xa3,0x60,0xa7,0x2d,0xa7,0x2e,0xa7,0x2f,0xa7,0x30,0xa7,0x31,0xa7,0x32,0xa7,0x33,0xa7,0x34,0xa7,0x35,0xa7,0x36,0xa7,0x37,0xa7,0x38,0xa7,0x39,0xa7,0x3a,0xa7,0x3b,0xa7,0x3c,0xa7,0x3d,0xa7,0x3e,0xa7,0x3f,0xa7,0x40,0xa7,0x41,0xa7,0x42,0xa7,0x43,0xa7,0x44,0xa7,0x45,0xa7,0x46,0xa7,0x47,0xa7,0x48,0xa7,0x49,0xa7,0x4a,0xa7,0x4b,0xa7,0x4c,0xa7,0x4d,0xa7,0x4e,0xa7,0x4f,0xa7,0x50,0xa7,0x51,0xa7,0x52,0xa7,0x53,0xa7,0x54,0xa7,0x55,0xa7,0x56,0xa7,0x57,0xa7,0x58,0xa7,0x59,0xa7,0x5a,0xa7,0x5b,0xa7,0x5c,0xa7,0x5d,0xa7,0x5e,0xa7,0x5f,0xa7,0x60,0xa7,0x61,0xa7,0x62,0xa7,0x63,0xa7,0x64,0xa7,0x65,0xa7,0x66,0xa7,0x67,0xa7,0x68,0xa7,0x69,0xa7,0x6a,0xa7,0x6b,0xa7,0x6c,0xa7,0x6d,0xa7,0x6e,0xa7,0x6f,0xa7,0x70,0xa7,0x71,0xa7,0x72,0xa7,0x73,0xa7,0x74,0xa7,0x75,0xa7,0x76,0xa7,0x77,0xa7,0x78,0xa7,0x79,0xa7,0x7a,0xa7,0x7b,0xa7,0x7c,0xa7,0x7d,0xa7,0x7e,0xa7,0x7f,0xa8,0x0,0xa8,0x1,0xa8,0x2,0xa8,0x3,0xa8,0x4,0xa8,0x5,0xa8,0x6,0xa8,0x7,0xa8,0x8,0xa8,0x9,0xa8,0xa,0xa8,0xb,0xa8,0xc,0xa8,0xd,0xa8,0xe,0xa8,0xf,0xa8,0x10,0xa8,0x11,0xa8,0x12,0xa8,0x13,0xa8,0x14,0xa8,0x15,0xa8,0x16,0xa8,0x17,0xa8,0x18,0xa8,0x19,0xa8,0x1a,0xa8,0x1b,0xa8,0x1c,0xa8,0x1d,0xa8,0x1e,0xa8,0x1f,0xa8,0x20,0xa8,0x21,0xa8,0x22,0xa8,0x23,0xa8,0x24,0xa8,0x25,0xa8,0x26,0xa8,0x27,0xa8,0x28,0xa8,0x29,0xa8,0x2a,0xa8,0x2b,0xa8,0x2c,0xa8,0x2d,0xa8,0x2e,0xa8,0x2f,0xa8,0x30,0xa8,0x31,0xa8,0x32,0xa8,0x33,0xa8,0x34,0xa8,0x35,0xa8,0x36,0xa8,0x37,0xa8,0x38,0xa8,0x39,0xa8,0x3a,0xa8,0x3b,0xa8,0x3c,0xa8,0x3d,0xa8,0x3e,0xa8,0x3f,0xa8,0x40,0xa8,0x41,0xa8,0x42,0xa8,0x43,0xa8,0x44,0xa8,0x45,0xa8,0x46,0xa8,0x47,0xa8,0x48,0xa8,0x49,0xa8,0x4a,0xa8,0x4b,0xa8,0x4c,0xa8,0x4d,0xa8,0x4e,0xa8,0x4f,0xa8,0x50,0xa8,0x51,0xa8,0x52,0xa8,0x53,0xa8,0x54,0xa8,0x55,0xa8,0x56,0xa8,0x57,0xa8,0x58,0xa8,0x59,0xa8,0x5a,0xa8,0x5b,0xa8,0x5c,0xa8,0x5d,0xa8,0x5e,0xa8,0x5f,0xa8,0x60,0xa8,0x61,0xa8,0x62,0xa8,0x63,0xa8,0x64,0xa8,0x65,0xa8,0x66,0xa8,0x67,0xa8,0x68,0xa8,0x69,0xa8,0x6a,0xa8,0x6b,0xa8,0x6c,0xa8,0x6d,0xa8,0x6e,0xa8,0x6f,0xa8,0x70,0xa8,0x71,0xa8,0x72,0xa8,0x73,0xa8,0x74,0xa8,0x75,0xa8,0x76,0xa8,0x77,0xa8,0x78,0xa8,0x79,0xa8,0x7a,0xa8,0x7b,0xa8,0x7c,0xa8,0x7d,0xa8,0x7e,0xa8,0x7f,0xa9,0x0,0xa9,0x1,0xa9,0x2,0xa9,0x3,0xa9,0x4,0xa9,0x5,0xa9,0x6,0xa9,0x7,0xa9,0x8,0xa9,0x9,0xa9,0xa,0xa9,0xb,0xa9,0xc,0xa9,0xd,0xa9,0xe,0xa9,0xf,0xa9,0x10,0xa9,0x11,0xa9,0x12,0xa9,0x13,0xa9,0x14,0xa9,0x15,0xa9,0x16,0xa9,0x17,0xa9,0x18,0xa9,0x19,0xa9,0x1a,0xa9,0x1b,0xa9,0x1c,0xa9,0x1d,0xa9,0x1e,0xa9,0x1f,0xa9,0x20,0xa9,0x21,0xa9,0x22,0xa9,0x23,0xa9,0x24,0xa9,0x25,0xa9,0x26,0xa9,0x27,0xa9,0x28,0xa9,0x29,0xa9,0x2a,0xa9,0x2b,0xa9,0x2c,0xa9,0x2d,0xa9,0x2e,0xa9,0x2f,0xa9,0x30,0xa9,0x31,0xa9,0x32,0xa9,0x33,0xa9,0x34,0xa9,0x35,0xa9,0x36,0xa9,0x37,0xa9,0x38,0xa9,0x39,0xa9,0x3a,0xa9,0x3b,0xa9,0x3c,0xa9,0x3d,0xa9,0x3e,0xa9,0x3f,0xa9,0x40,0xa9,0x41,0xa9,0x42,0xa9,0x43,0xa9,0x44,0xa9,0x45,0xa9,0x46,0xa9,0x47,0xa9,0x48,0xa9,0x49,0xa9,0x4a,0xa9,0x4b,0xa9,0x4c,0xa9,0x4d,0xa9,0x4e,0xa9,0x4f,0xa9,0x50,0xa9,0x51,0xa9,0x52,0xa9,0x53,0xa9,0x54,0xa9,0x55,0xa9,0x56,0xa9,0x57,0xa9,0x58,0xa9,0x59,0xa9,0x5a,0xa9,0x5b,0xa9,0x5c,0xa9,0x5d,0xa9,0x5e,0xa9,0x5f,0xa9,0x60,0xa9,0x61,0xa9,0x62,0xa9,0x63,0xa9,0x64,0xa9,0x65,0xa9,0x66,0xa9,0x67,0xa9,0x68,0xa9,0x69,0xa9,0x6a,0xa9,0x6b,0xa9,0x6c,0xa9,0x6d,0xa9,0x6e,0xa9,0x6f,0xa9,0x70,0xa9,0x71,0xa9,0x72,0xa9,0x73,0xa9,0x74,0xa9,0x75,0xa9,0x76,0xa9,0x77,0xa9,0x78,0xa9,0x79,0xa9,0x7a,0xa9,0x7b,0xa9,0x7c,0xa9,0x7d,0xa9,0x7e,0xa9,0x7f,0xaa,0x0,0xaa,0x1,0xaa,0x2,0xaa,0x3,0xaa,0x4,0xaa,0x5,0xaa,0x6,0xaa,0x7,0xaa,0x8,0xaa,0x9,0xaa,0xa,0xaa,0xb,0xaa,0xc,0xaa,0xd,0xaa,0xe,0xaa,0xf,0xaa,0x10,0xaa,0x11,0xaa,0x12,0xaa,0x13,0xaa,0x14,0xaa,0x15,0xaa,0x16,0xaa,0x17,0xaa,0x18,0xaa,0x19,0xaa,0x1a,0xaa,0x1b,0xaa,0x1c,0xaa,0x1d,0xaa,0x1e,0xaa,0x1f,0xaa,0x20,0xaa,0x21,0xaa,0x22,0xaa,0x23,0xaa,0x24,0xaa,0x25,0xaa,0x26,0xaa,0x27,0xaa,0x28,0xaa,0x29,0xaa,0x2a,0xaa,0x2b,0xaa,0x2c,0xaa,0x2d,0xaa,0x2e,0xaa,0x2f,0xaa,0x30,0xaa,0x31,0xaa,0x32,0xaa,0x33,0xaa,0x34,0xaa,0x35,0xaa,0x36,0xaa,0x37,0xaa,0x38,0xaa,0x39,0xaa,0x3a,0xaa,0x3b,0xaa,0x3c,0xaa,0x3d,0xaa,0x3e,0xaa,0x3f,0xaa,0x40,0xaa,0x41,0xaa,0x42,0xaa,0x43,0xaa,0x44,0xaa,0x45,0xaa,0x46,0xaa,0x47,0xaa,0x48,0xaa,0x49,0xaa,0x4a,0xaa,0x4b,0xaa,0x4c,0xaa,0x4d,0xaa,0x4e,0xaa,0x4f,0xaa,0x50,0xaa,0x51,0xaa,0x52,0xaa,0x53,0xaa,0x54,0xaa,0x55,0xaa,0x56,0xaa,0x57,0xaa,0x58,0xaa,0x59,0xaa,0x5a,0xaa,0x5b,0xaa,0x5c,0xaa,0x5d,0xaa,0x5e,0xaa,0x5f,0xaa,0x60,0xaa,0x61,0xaa,0x62,0xaa,0x63,0xaa,0x64,0xaa,0x65,0xaa,0x66,0xaa,0x67,0xaa,0x68,0xaa,0x69,0xaa,0x6a,0xaa,0x6b,0xaa,0x6c,0xaa,0x6d,0xaa,0x6e,0xaa,0x6f,0xaa,0x70,0xaa,0x71,0xaa,0x72,0xaa,0x73,0xaa,0x74,0xaa,0x75,0xaa,0x76,0xaa,0x77,0xaa,0x78,0xaa,0x79,0xaa,0x7a,0xaa,0x7b,0xaa,0x7c,0xaa,0x7d,0xaa,0x7e,0xaa,0x7f,0xab,0x0,0xab,0x1,0xab,0x2,0xab,0x3,0xab,0x4,0xab,0x5,0xab,0x6,0xab,0x7,0xab,0x8,0xab,0x9,0xab,0xa,0xab,0xb,0xab,0xc,0xab,0xd,0xab,0xe,0xab,0xf,0xab,0x10,0xab,0x11,0xab,0x12,0xab,0x13,0xab,0x14,0xab,0x15,0xab,0x16,0xab,0x17,0xab,0x18,0xab,0x19,0xab,0x1a,0xab,0x1b,0xab,0x1c,0xab,0x1d,0xab,0x1e,0xab,0x1f,0xab,0x20,0xab,0x21,0xab,0x22,0xab,0x23,0xab,0x24,0xab,0x25,0xab,0x26,0xab,0x27,0xab,0x28,0xab,0x29,0xab,0x2a,0xab,0x2b,0xab,0x2c,0xab,0x2d,0xab,0x2e,0xab,0x2f,0xab,0x30,0xab,0x31,0xab,0x32,0xab,0x33,0xab,0x34,0xab,0x35,0xab,0x36,0xab,0x37,0xab,0x38,0xab,0x39,0xab,0x3a,0xab,0x3b,0xab,0x3c,0xab,0x3d,0xab,0x3e,0xab,0x3f,0xab,0x40,0xab,0x41,0xab,0x42,0xab,0x43,0xab,0x44,0xab,0x45,0xab,0x46,0xab,0x47,0xab,0x48,0xab,0x49,0xab,0x4a,0xab,0x4b,0xab,0x4c,0xab,0x4d,0xab,0x4e,0xab,0x4f,0xab,0x50,0xab,0x51,0xab,0x52,0xab,0x53,0xab,0x54,0xab,0x55,0xab,0x56,0xab,0x57,0xab,0x58,0xab,0x59,0xab,0x5a,0xab,0x5b,0xab,0x5c,0xab,0x5d,0xab,0x5e,0xab,0x5f,0xab,0x60,0xab,0x61,0xab,0x62,0xab,0x63,0xab,0x64,0xab,0x65,0xab,0x66,0xab,0x67,0xab,0x68,0xab,0x69,0xab,0x6a,0xab,0x6b,0xab,0x6c,0xab,0x6d,0xab,0x6e,0xab,0x6f,0xab,0x70,0xab,0x71,0xab,0x72,0xab,0x73,0xab,0x74,0xab,0x75,0xab,0x76,0xab,0x77,0xab,0x78,0xab,0x79,0xab,0x7a,0xab,0x7b,0xab,0x7c,0xab,0x7d,0xab,0x7e,0xab,0x7f,0xac,0x0,0xac,0x1,0xac,0x2,0xac,0x3,0xac,0x4,0xac,0x5,0xac,0x6,0xac,0x7,0xac,0x8,0xac,0x9,0xac,0xa,0xac,0xb,0xac,0xc,0xac,0xd,0xac,0xe,0xac,0xf,0xac,0x10,0xac,0x11,0xac,0x12,0xac,0x13,0xac,0x14,0xac,0x15,0xac,0x16,0xac,0x17,0xac,0x18,0xac,0x19,0xac,0x1a,0xac,0x1b,0xac,0x1c,0xac,0x1d,0xac,0x1e,0xac,0x1f,0xac,0x20,0xac,0x21,0xac,0x22,0xac,0x23,0xac,0x24,0xac,0x25,0xac,0x26,0xac,0x27,0xac,0x28,0xac,0x29,0xac,0x2a,0xac,0x2b,0xac,0x2c,0xac,0x2d,0xac,0x2e,0xac,0x2f,0xac,0x30,0xac,0x31,0xac,0x32,0xac,0x33,0xac,0x34,0xac,0x35,0xac,0x36,0xac,0x37,0xac,0x38,0xac,0x39,0xac,0x3a,0xac,0x3b,0xac,0x3c,0xac,0x3d,0xac,0x3e,0xac,0x3f,0xac,0x40,0xac,0x41,0xac,0x42,0xac,0x43,0xac,0x44,0xac,0x45,0xac,0x46,0xac,0x47,0xac,0x48,0xac,0x49,0xac,0x4a,0xac,0x4b,0xac,0x4c,0xac,0x4d,0xac,0x4e,0xac,0x4f,0xac,0x50,0xac,0x51,0xac,0x52,0xac,0x53,0xac,0x54,0xac,0x55,0xac,0x56,0xac,0x57,0xac,0x58,0xac,0x59,0xac,0x5a,0xac,0x5b,0xac,0x5c,0xac,0x5d,0xac,0x5e,0xac,0x5f,0xac,0x60,0xac,0x61,0xac,0x62,0xac,0x63,0xac,0x64,0xac,0x65,0xac,0x66,0xac,0x67,0xac,0x68,0xac,0x69,0xac,0x6a,0xac,0x6b,0xac,0x6c,0xac,0x6d,0xac,0x6e,0xac,0x6f,0xac,0x70,0xac,0x71,0xac,0x72,0xac,0x73,0xac,0x74,0xac,0x75,0xac,0x76,0xac,0x77,0xac,0x78,0xac,0x79,0xac,0x7a,0xac,0x7b,0xac,0x7c,0xac,0x7d,0xac,0x7e,0xac,0x7f,0xad,0x0,0xad,0x1,0xad,0x2,0xad,0x3,0xad,0x4,0xad,0x5,0xad,0x6,0xad,0x7,0xad,0x8,0xad,0x9,0xad,0xa,0xad,0xb,0xad,0xc,0xad,0xd,0xad,0xe,0xad,0xf,0xad,0x10,0xad,0x11,0xad,0x12,0xad,0x13,0xad,0x14,0xad,0x15,0xad,0x16,0xad,0x17,0xad,0x18,0xad,0x19,0xad,0x1a,0xad,0x1b,0xad,0x1c,0xad,0x1d,0xad,0x1e,0xad,0x1f,0xad,0x20,0xad,0x21,0xad,0x22,0xad,0x23,0xad,0x24,0xad,0x25,0xad,0x26,0xad,0x27,0xad,0x28,0xad,0x29,0xad,0x2a,0xad,0x2b,0xad,0x2c,0xad,0x2d,0xad,0x2e,0xad,0x2f,0xad,0x30,0xad,0x31,0xad,0x32,0xad,0x33,0xad,0x34,0xad,0x35,0xad,0x36,0xad,0x37,0xad,0x38,0xad,0x39,0xad,0x3a,0xad,0x3b,0xad,0x3c,0xad,0x3d,0xad,0x3e,0xad,0x3f,0xad,0x40,0xad,0x41,0xad,0x42,0xad,0x43,0xad,0x44,0xad,0x45,0xad,0x46,0xad,0x47,0xad,0x48,0xad,0x49,0xad,0x4a,0xad,0x4b,0xad,0x4c,0xad,0x4d,0xad,0x4e,0xad,0x4f,0xad,0x50,0xad,0x51,0xad,0x52,0xad,0x53,0xad,0x54,0xad,0x55,0xad,0x56,0xad,0x57,0xad,0x58,0xad,0x59,0xad,0x5a,0xad,0x5b,0xad,0x5c,0xad,0x5d,0xad,0x5e,0xad,0x5f,0xad,0x60,0xad,0x61,0xad,0x62,0xad,0x63,0xad,0x64,0xad,0x65,0xad,0x66,0xad,0x67,0xad,0x68,0xad,0x69,0xad,0x6a,0xad,0x6b,0xad,0x6c,0xad,0x6d,0xad,0x6e,0xad,0x6f,0xad,0x70,0xad,0x71,0xad,0x72,0xad,0x73,0xad,0x74,0xad,0x75,0xad,0x76,0xad,0x77,0xad,0x78,0xad,0x79,0xad,0x7a,0xad,0x7b,0xad,0x7c,0xad,0x7d,0xad,0x7e,0xad,0x7f,0xae,0x0,0xae,0x1,0xae,0x2,0xae,0x3,0xae,0x4,0xae,0x5,0xae,0x6,0xae,0x7,0xae,0x8,0xae,0x9,0xae,0xa,0xae,0xb,0xae,0xc,0xae,0xd,0xae,0xe,0xae,0xf,0xae,0x10,0xae,0x11,0xae,0x12,0xae,0x13,0xae,0x14,0xae,0x15,0xae,0x16,0xae,0x17,0xae,0x18,0xae,0x19,0xae,0x1a,0xae,0x1b,0xae,0x1c,0xae,0x1d,0xae,0x1e,0xae,0x1f,0xae,0x20,0xae,0x21,0xae,0x22,0xae,0x23,0xae,0x24,0xae,0x25,0xae,0x26,0xae,0x27,0xae,0x28,0xae,0x29,0xae,0x2a,0xae,0x2b,0xae,0x2c,0xae,0x2d,0xae,0x2e,0xae,0x2f,0xae,0x30,0xae,0x31,0xae,0x32,0xae,0x33,0xae,0x34,0xae,0x35,0xae,0x36,0xae,0x37,0xae,0x38,0xae,0x39,0xae,0x3a,0xae,0x3b,0xae,0x3c,0xae,0x3d,0xae,0x3e,0xae,0x3f,0xae,0x40,0xae,0x41,0xae,0x42,0xae,0x43,0xae,0x44,0xae,0x45,0xae,0x46,0xae,0x47,0xae,0x48,0xae,0x49,0xae,0x4a,0xae,0x4b,0xae,0x4c,0xae,0x4d,0xae,0x4e,0xae,0x4f,0xae,0x50,0xae,0x51,0xae,0x52,0xae,0x53,0xae,0x54,0xae,0x55,0xae,0x56,0xae,0x57,0xae,0x58,0xae,0x59,0xae,0x5a,0xae,0x5b,0xae,0x5c,0xae,0x5d,0xae,0x5e,0xae,0x5f,0xae,0x60,0xae,0x61,0xae,0x62,0xae,0x63,0xae,0x64,0xae,0x65,0xae,0x66,0xae,0x67,0xae,0x68,0xae,0x69,0xae,0x6a,0xae,0x6b,0xae,0x6c,0xae,0x6d,0xae,0x6e,0xae,0x6f,0xae,0x70,0xae,0x71,0xae,0x72,0xae,0x73,0xae,0x74,0xae,0x75,0xae,0x76,0xae,0x77,0xae,0x78,0xae,0x79,0xae,0x7a,0xae,0x7b,0xae,0x7c,0xae,0x7d,0xae,0x7e,0xae,0x7f,0xaf,0x0,0xaf,0x1,0xaf,0x2,0xaf,0x3,0xaf,0x4,0xaf,0x5,0xaf,0x6,0xaf,0x7,0xaf,0x8,0xaf,0x9,0xaf,0xa,0xaf,0xb,0xaf,0xc,0xaf,0xd,0xaf,0xe,0xaf,0xf,0xaf,0x10,0xaf,0x11,0xaf,0x12,0xaf,0x13,0xaf,0x14,0xaf,0x15,0xaf,0x16,0xaf,0x17,0xaf,0x18,0xaf,0x19,0xaf,0x1a,0xaf,0x1b,0xaf,0x1c,0xaf,0x1d,0xaf,0x1e,0xaf,0x1f,0xaf,0x20,0xaf,0x21,0xaf,0x22,0xaf,0x23,0xaf,0x24,0xaf,0x25,0xaf,0x26,0xaf,0x27,0xaf,0x28,0xaf,0x29,0xaf,0x2a,0xaf,0x2b,0xaf,0x2c,0xaf,0x2d,0xaf,0x2e,0xaf,0x2f,0xaf,0x30,0xaf,0x31,0xaf,0x32,0xaf,0x33,0xaf,0x34,0xaf,0x35,0xaf,0x36,0xaf,0x37,0xaf,0x38,0xaf,0x39,0xaf,0x3a,0xaf,0x3b,0xaf,0x3c,0xaf,0x3d,0xaf,0x3e,0xaf,0x3f,0xaf,0x40,0xaf,0x41,0xaf,0x42,0xaf,0x43,0xaf,0x44,0xaf,0x45,0xaf,0x46,0xaf,0x47,0xaf,0x48,0xaf,0x49,0xaf,0x4a,0xaf,0x4b,0xaf,0x4c,0xaf,0x4d,0xaf,0x4e,0xaf,0x4f,0xaf,0x50,0xaf,0x51,0xaf,0x52,0xaf,0x53,0xaf,0x54,0xaf,0x55,0xaf,0x56,0xaf,0x57,0xaf,0x58,0xaf,0x59,0xaf,0x5a,0xaf,0x5b,0xaf,0x5c,0xaf,0x5d,0xaf,0x5e,0xaf,0x5f,0xaf,0x60,0xaf,0x61,0xaf,0x62,0xaf,0x63,0xaf,0x64,0xaf,0x65,0xaf,0x66,0xaf,0x67,0xaf,0x68,0xaf,0x69,0xaf,0x6a,0xaf,0x6b,0xaf,0x6c,0xaf,0x6d,0xaf,0x6e,0xaf,0x6f,0xaf,0x70,0xaf,0x70,0x68,0xa2,0x48,0xaf,0x71,0x4,0xc2,0x5,0xc3,0x6,0xc8,0x7,0xc1,0x8,0xc4,0x9,0x83,0x3e,0xd,0xee,0xe1,0x3b,0x0,0x1,0x2,0x20,0x26,0x39,0x3a,0x3b,0x3c,0x3e,0x5f,0x61,0x62,0x63,0x64,0x66,0x81,0x3e,0x82,0x44,0x82,0x5f,0x83,0xf,0x83,0x3a,0x83,0x3b,0x83,0x52,0x83,0x57,0x84,0xd,0x88,0x2d,0x88,0x2e,0x88,0x31,0x88,0x6e,0x88,0x6f,0x89,0x1e,0x89,0x1f,0x8a,0x13,0x8e,0x68,0x8f,0x72,0x93,0x39,0x8d,0x1d,0x9b,0x10,0x9b,0x7c,0x9b,0x7d,0x8a,0x45,0x9d,0x24,0xa2,0x11,0x93,0x3b,0x8a,0x74,0xa3,0x25,0xa5,0x58,0xa5,0x5f,0xa5,0x68,0xa5,0x72,0xa5,0x7d,0xa5,0x7e,0xa6,0x1b,0xa6,0x27,0xa6,0x44,0xa6,0x51,0xa6,0x52,0xa6,0x59,0xa6,0x67,0xe5,0x76,0xa2,0x33,0xc4,0xa7,0x20,0xa7,0x21,0xaf,0x72,0xd0,0x5c,0xd1,0x0,0xd0,0x81,0x2e,0xd1,0x1,0xd0,0x81,0x3c,0xd1,0x2,0xd0,0x82,0x43,0xd1,0x3,0xd0,0x82,0x5e,0xd1,0x4,0xd0,0x83,0xe,0xd1,0x5,0xd0,0x83,0x39,0xd1,0x6,0xd0,0x89,0x7a,0xd1,0x7,0xd0,0x8b,0x2b,0xd1,0x8,0xd0,0xa4,0x71,0xd1,0x9,0xd0,0xa5,0x12,0xd1,0xa,0xd0,0xa5,0x52,0xd1,0xb,0xd0,0xa6,0x12,0xd1,0xc,0xd0,0xa6,0x50,0xd1,0xd,0xd0,0xa7,0xf,0xd1,0xe,0xd0,0xa7,0x17,0xd1,0xf,0xe1,0x9,0xc7,0x4,0xc6,0xa7,0x19,0xc6,0xa2,0x11,0xcb,0xf,0xc6,0xa4,0x59,0xcb,0x9,0xc6,0xa6,0x79,0xcb,0xe,0xc6,0xa7,0x18,0xd0,0xa7,0x1f,0xd3,0x0,};
+const int modules_compiler_len = 75832;
@@ -1,2 +1,2 @@
-const char modules_init[] = {0x74,0x6c,0x30,0x31,0x99,0x9,0x5,0x62,0x6c,0x6f,0x63,0x6b,0x21,0x0,0x5,0x63,0x61,0x74,0x63,0x68,0x5,0x70,0x72,0x69,0x6e,0x74,0xb,0x5f,0x53,0x74,0x72,0x69,0x6e,0x67,0x5f,0x63,0x61,0x74,0x10,0x69,0x6e,0x69,0x74,0x20,0x65,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x8,0x74,0x6f,0x53,0x74,0x72,0x69,0x6e,0x67,0x6,0x6f,0x66,0x66,0x73,0x65,0x74,0x4,0x74,0x65,0x78,0x74,0x3,0x70,0x6f,0x73,0xc1,0x1,0xc0,0x22,0xa,0xa,0x4,0x6c,0x69,0x6e,0x65,0x64,0x7,0xc8,0x8,0xc3,0x9,0xb,0xc,0xce,0xae,0xc3,0xc4,0xc4,0xc4,0xd,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0x0,0x1,0x65,0x21,0xf,0x21,0x10,0xc1,0x1,0x96,0xc1,0x1,0x8c,0x28,0x12,0x13,0xc0,0xc0,0xc0,0xc0,0xc0,0x12,0x64,0x7,0xc8,0x8,0xc3,0x9,0x14,0xc,0xce,0xb7,0xc3,0x11,0xc4,0xc4,0x15,0xe1,0x1,0xc7,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x5,0xe1,0x0,0xd0,0xe,0xd3,0xd3,0xd3,0x0,0x4,0x62,0x6f,0x6f,0x6c,0x3,0x67,0x65,0x74,0x4,0x65,0x6c,0x73,0x65,0x2,0x69,0x66,0x4,0x63,0x6f,0x6e,0x64,0x21,0x1b,0x1,0x74,0x23,0x1d,0xc0,0xc2,0x1,0x66,0x23,0x1f,0xc0,0xc2,0x23,0x1c,0x1e,0x20,0xc1,0x2,0xb0,0xc1,0x2,0x4e,0xc1,0x2,0x46,0xc1,0x2,0x64,0xc1,0x2,0x90,0x29,0x22,0x23,0x24,0x25,0x25,0x26,0x26,0x23,0x22,0x64,0x7,0xc8,0x8,0xc3,0x9,0x27,0xc,0xd1,0xe5,0x24,0x1a,0x21,0xc4,0xc4,0x28,0xe1,0x0,0xe1,0x3,0xc7,0x3,0xca,0x0,0xe0,0x2,0xcc,0xc6,0x18,0xc6,0x0,0xca,0x1,0xd3,0xe0,0x2,0xcc,0xc6,0x18,0xc6,0x19,0xca,0x2,0xd3,0xd3,0xd3,0x0,0x22,0xc0,0x0,0x3,0x6e,0x6f,0x74,0x6,0x72,0x65,0x74,0x75,0x72,0x6e,0xc1,0x3,0x12,0xc1,0x3,0x1e,0x25,0x2d,0x2d,0x2e,0x2e,0x2d,0x64,0x7,0xc8,0x8,0xc3,0x9,0x2f,0xc,0xd4,0xb3,0xc3,0xc4,0xc4,0xc4,0x30,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe1,0x0,0xc8,0x0,0x1,0xd3,0xd3,0x0,0x3,0x5f,0x6f,0x72,0x4,0x6c,0x65,0x66,0x74,0x21,0x33,0x5,0x72,0x69,0x67,0x68,0x74,0x23,0x35,0xc0,0xc2,0x22,0x34,0x36,0xc1,0x2,0xf2,0xc1,0x3,0x38,0x28,0xc0,0x38,0x38,0x38,0xc0,0x39,0x39,0x39,0x64,0x7,0xc8,0x8,0xc3,0x9,0x3a,0xc,0xd3,0xbf,0x32,0x37,0xc4,0xc4,0x3b,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xca,0x0,0xd3,0xd0,0x31,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xca,0x0,0xd3,0x0,0xf,0x5f,0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x2,0x6f,0x72,0xc1,0x3,0xd0,0xc1,0x3,0xdc,0x25,0x3f,0x3f,0x40,0x40,0x3f,0x64,0x7,0xc8,0x8,0xc3,0x9,0x41,0xc,0xd9,0xb3,0xc3,0xc4,0xc4,0xc4,0x42,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe1,0x0,0xc8,0x0,0x1,0xd3,0xd3,0x0,0x4,0x5f,0x61,0x6e,0x64,0xc1,0x3,0xf6,0x25,0xc0,0xc0,0x45,0x45,0x45,0x64,0x7,0xc8,0x8,0xc3,0x9,0x46,0xc,0xd8,0xba,0x44,0x37,0xc4,0xc4,0x47,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xca,0x0,0xd0,0x43,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xca,0x0,0xd3,0x0,0x3,0x61,0x6e,0x64,0x5,0x74,0x68,0x72,0x6f,0x77,0x15,0x77,0x68,0x69,0x6c,0x65,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0xc1,0x4,0xb6,0xc1,0x4,0xac,0x23,0x4c,0x4d,0x4c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x4e,0xc,0xde,0xad,0xc3,0xc4,0xc4,0xc4,0x4f,0xe1,0x1,0xc7,0x7,0xc6,0x4b,0xd3,0x0,0x4,0x6c,0x6f,0x6f,0x70,0x5,0x62,0x72,0x65,0x61,0x6b,0x6,0x5f,0x5f,0x6c,0x69,0x73,0x74,0xc1,0x5,0x2a,0x26,0x54,0x54,0x54,0x54,0x54,0x54,0x64,0x7,0xc8,0x8,0xc3,0x9,0x55,0xc,0xe0,0xb4,0xc3,0xc4,0xc4,0xc4,0x56,0xe1,0x1,0xc7,0x9,0xe1,0x2,0xc7,0xa,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0x0,0xc1,0x5,0x12,0xc1,0x5,0x22,0xc1,0x5,0x50,0x29,0xc0,0x58,0x58,0x59,0x59,0x58,0xc0,0x5a,0x5a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x5b,0xc,0xdf,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x5c,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x1,0xc7,0x4,0xe1,0x0,0xc8,0x0,0x0,0xd3,0xd3,0xd0,0x57,0xd3,0xe1,0x0,0xc9,0x0,0x0,0xd3,0x0,0x5,0x77,0x68,0x69,0x6c,0x65,0x23,0x1b,0xc0,0xc2,0x21,0x5f,0x21,0xc1,0xc1,0x4,0x80,0xc1,0x4,0x96,0xc1,0x4,0xf0,0x2a,0x62,0x62,0xc0,0x63,0x63,0x63,0xc0,0x64,0x64,0x64,0x64,0x7,0xc8,0x8,0xc3,0x9,0x65,0xc,0xdd,0xe5,0x26,0x5e,0x60,0x1,0x61,0x66,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x50,0xd3,0xf1,0x1,0x1,0xc7,0x8,0xd0,0x5d,0xd3,0x0,0xc1,0x6,0x24,0xc1,0x6,0x38,0x25,0x68,0x68,0x69,0x69,0x68,0x64,0x7,0xc8,0x8,0xc3,0x9,0x6a,0xc,0xe5,0xb3,0xc3,0xc4,0xc4,0xc4,0x6b,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe1,0x0,0xc8,0x0,0x1,0xd3,0xd3,0x0,0x4,0x63,0x61,0x6c,0x6c,0xc1,0x6,0x70,0xc1,0x6,0x86,0xc1,0x6,0x7a,0x27,0x6e,0x6e,0x6f,0x70,0x70,0x6f,0x6e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x71,0xc,0xe6,0xb9,0xc3,0xc4,0xc4,0xc4,0x72,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x0,0xe0,0x0,0xcd,0x0,0xc6,0x0,0xd3,0xc6,0x6d,0xd3,0xd3,0x0,0x3,0x74,0x72,0x79,0x4,0x74,0x65,0x73,0x74,0x23,0x75,0xc0,0xc2,0x9,0x6f,0x74,0x68,0x65,0x72,0x77,0x69,0x73,0x65,0x23,0x77,0xc0,0xc2,0x22,0x76,0x78,0xc1,0x6,0xa,0xc1,0x6,0x54,0xc1,0x6,0xa2,0x29,0x7a,0x7a,0x7a,0xc0,0x7b,0x7b,0xc0,0x7c,0x7c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x7d,0xc,0xe4,0xe5,0x22,0x74,0x79,0xc4,0xc4,0x7e,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x6c,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd0,0x73,0xd3,0xe1,0x0,0xca,0x0,0xd3,0x0,0x6,0x61,0x73,0x42,0x6f,0x6f,0x6c,0x1,0x76,0x21,0x81,0x1,0x21,0x81,0x2,0xc1,0x6,0xce,0xc1,0x6,0xc6,0x23,0x81,0x4,0x81,0x5,0x81,0x4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x6,0xc,0xe9,0xb2,0x81,0x0,0x81,0x3,0xc4,0xc4,0x81,0x7,0xe1,0x3,0xc7,0x3,0xca,0x0,0xc0,0xc1,0xd3,0x0,0x9,0x61,0x73,0x42,0x6f,0x6f,0x6c,0x49,0x6e,0x76,0xc1,0x7,0x1a,0xc1,0x7,0x12,0x23,0x81,0xa,0x81,0xb,0x81,0xa,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0xc,0xc,0xea,0xb2,0x81,0x9,0x81,0x3,0xc4,0xc4,0x81,0xd,0xe1,0x3,0xc7,0x3,0xca,0x0,0xc1,0xc0,0xd3,0x0,0x2,0x65,0x71,0x7,0x63,0x6f,0x6d,0x70,0x61,0x72,0x65,0xc0,0x3,0x9,0x69,0x73,0x53,0x6d,0x61,0x6c,0x6c,0x65,0x72,0x1,0x6c,0x21,0x81,0x13,0x1,0x72,0x21,0x81,0x15,0x22,0x81,0x14,0x81,0x16,0xc1,0x7,0x70,0xc1,0x7,0x8e,0xc1,0x7,0x80,0xc1,0x7,0x72,0x29,0x81,0x18,0x81,0x18,0x81,0x19,0x81,0x19,0x81,0x1a,0x81,0x1b,0x81,0x1a,0x81,0x19,0x81,0x18,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x1c,0xc,0xeb,0xe5,0x21,0x81,0x12,0x81,0x17,0xc4,0xc4,0x81,0x1d,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe1,0x2,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xca,0x0,0xca,0x1,0xd3,0xc6,0x81,0x11,0xd3,0xd3,0x0,0x3,0x6c,0x74,0x65,0xc1,0x7,0xe2,0x23,0x81,0x20,0x81,0x20,0x81,0x20,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x21,0xc,0xee,0xb1,0xc3,0xc4,0xc4,0xc4,0x81,0x22,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc8,0x0,0x0,0xd3,0x0,0x3,0x6d,0x69,0x6e,0xc1,0x7,0xca,0xc1,0x7,0xfc,0x28,0xc0,0x81,0x25,0x81,0x25,0x81,0x25,0xc0,0x81,0x26,0x81,0x26,0x81,0x26,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x27,0xc,0xed,0xe5,0x25,0x81,0x24,0x81,0x17,0xc4,0xc4,0x81,0x28,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xd,0xca,0x0,0xca,0x1,0xd3,0xd0,0x81,0x23,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xca,0x1,0xd3,0x0,0x3,0x67,0x74,0x65,0xc1,0x8,0x4a,0x23,0x81,0x2b,0x81,0x2b,0x81,0x2b,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x2c,0xc,0xf2,0xb1,0xc3,0xc4,0xc4,0xc4,0x81,0x2d,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc8,0x0,0x0,0xd3,0x0,0x3,0x6d,0x61,0x78,0xc1,0x8,0x32,0xc1,0x8,0x64,0x28,0xc0,0x81,0x30,0x81,0x30,0x81,0x30,0xc0,0x81,0x31,0x81,0x31,0x81,0x31,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x32,0xc,0xf1,0xe5,0x25,0x81,0x2f,0x81,0x17,0xc4,0xc4,0x81,0x33,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xe,0xca,0x0,0xca,0x1,0xd3,0xd0,0x81,0x2e,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xca,0x1,0xd3,0x0,0x3,0x61,0x64,0x64,0x6,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x4,0x73,0x69,0x7a,0x65,0xb,0x5f,0x67,0x65,0x74,0x5f,0x72,0x61,0x6e,0x64,0x6f,0x6d,0xc1,0x9,0x6,0xc1,0x9,0x14,0xc1,0x9,0x24,0xc1,0x9,0x18,0xc1,0x9,0x2e,0x2a,0x81,0x39,0x81,0x3a,0x81,0x3a,0x81,0x3b,0x81,0x3c,0x81,0x3d,0x81,0x3d,0x81,0x3b,0x81,0x3a,0x81,0x39,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x3e,0xc,0xf6,0xe5,0x21,0x81,0x38,0xc4,0xc4,0xc4,0x81,0x3f,0xe0,0x1,0xce,0xc6,0x18,0xe1,0x2,0xc7,0xf,0xc4,0x1,0xe1,0x1,0xc7,0x10,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xd3,0xd3,0xd3,0x0,0x1a,0x65,0x61,0x63,0x68,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0xc1,0xc,0x5c,0xc1,0xc,0x52,0x23,0x81,0x42,0x81,0x43,0x81,0x42,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x44,0xc,0xfe,0xaf,0xc3,0xc4,0xc4,0xc4,0x81,0x45,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x41,0xd3,0x0,0x2,0x6c,0x74,0xc1,0xd,0x5c,0xc1,0xd,0x66,0x24,0x81,0x48,0x81,0x49,0x81,0x49,0x81,0x48,0xc0,0x78,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x4a,0xc,0x81,0x4b,0xba,0xc3,0xc4,0xc4,0xc4,0x81,0x4c,0xe1,0x2,0xc9,0x1,0x0,0xe0,0x1,0xcf,0x1,0xc6,0x18,0xc9,0x1,0x2,0xd3,0xc9,0x1,0x2,0xd3,0x0,0xc1,0xd,0xa4,0xc1,0xd,0xae,0x24,0x81,0x4e,0x81,0x4f,0x81,0x4f,0x81,0x4e,0xc0,0x7a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x50,0xc,0x81,0x51,0xb7,0xc3,0xc4,0xc4,0xc4,0x81,0x52,0xe1,0x1,0xc8,0x1,0x0,0xe0,0x1,0xcf,0x1,0xc6,0x18,0xc9,0x1,0x2,0xd3,0xd3,0x0,0x27,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x74,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x54,0xc,0x81,0x55,0xe5,0x25,0xc3,0xc4,0xc4,0xc4,0x81,0x56,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x2,0xc4,0x1,0xd3,0xd9,0x0,0x2,0xc9,0x0,0x0,0xe3,0x0,0xd0,0x81,0x4d,0xd3,0xc0,0xe3,0x0,0xd0,0x81,0x53,0xd3,0xd4,0x0,0x5,0x5f,0x65,0x61,0x63,0x68,0x2,0x66,0x6e,0x21,0x81,0x59,0x21,0x81,0x5a,0x2,0x61,0x74,0x23,0x0,0x81,0x37,0x81,0x5c,0x23,0xc1,0xc1,0xc2,0xc1,0xc,0x10,0xc1,0xc,0x2c,0xc1,0xc,0x42,0xc1,0xc,0xb8,0xc1,0xc,0xf4,0xc1,0xc,0xfc,0x31,0x81,0x5f,0x81,0x5f,0xc0,0x81,0x60,0x81,0x60,0x81,0x61,0x81,0x61,0x81,0x61,0x81,0x60,0xc0,0x81,0x62,0x81,0x62,0x81,0x63,0x81,0x64,0x81,0x64,0x81,0x64,0x81,0x63,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x65,0xc,0xfc,0xe5,0x4b,0x81,0x58,0x81,0x5b,0x81,0x5d,0x81,0x5e,0x81,0x66,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xe1,0x2,0xc7,0x11,0xcb,0x0,0xca,0x0,0xd3,0xd3,0xd0,0x81,0x46,0xd3,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xd1,0x1,0xc4,0x0,0xd6,0x2,0xf1,0x2,0x2a,0xc9,0x0,0x3,0xe1,0x2,0xc7,0x12,0xcb,0x2,0xcb,0x1,0xd3,0xd0,0x81,0x57,0xd3,0x0,0x19,0x6d,0x61,0x70,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0xc1,0x10,0x86,0xc1,0x10,0x7c,0x23,0x81,0x69,0x81,0x6a,0x81,0x69,0xc0,0x8a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x6b,0xc,0x81,0x6c,0xaf,0xc3,0xc4,0xc4,0xc4,0x81,0x6d,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x68,0xd3,0x0,0x5,0x41,0x72,0x72,0x61,0x79,0x3,0x6e,0x65,0x77,0xc1,0x11,0xb6,0xc1,0x11,0xc0,0x24,0x81,0x71,0x81,0x72,0x81,0x72,0x81,0x71,0xc0,0x9a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x73,0xc,0x81,0x74,0xba,0xc3,0xc4,0xc4,0xc4,0x81,0x75,0xe1,0x2,0xc9,0x1,0x0,0xe0,0x1,0xcf,0x1,0xc6,0x18,0xc9,0x1,0x2,0xd3,0xc9,0x1,0x2,0xd3,0x0,0xc1,0x12,0x6,0xc1,0x12,0x10,0x24,0x81,0x77,0x81,0x78,0x81,0x78,0x81,0x77,0xc0,0x9c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x79,0xc,0x81,0x7a,0xb7,0xc3,0xc4,0xc4,0xc4,0x81,0x7b,0xe1,0x1,0xc8,0x1,0x0,0xe0,0x1,0xcf,0x1,0xc6,0x18,0xc9,0x1,0x2,0xd3,0xd3,0x0,0xc1,0x12,0x32,0x29,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x81,0x7d,0x81,0x7d,0xc0,0x96,0x64,0x7,0xc8,0x8,0xc3,0x9,0x81,0x7e,0xc,0x81,0x7f,0xe5,0x32,0xc3,0xc4,0x10,0x61,0x82,0x0,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x2,0xc4,0x1,0xd3,0xd9,0x0,0x2,0xc9,0x0,0x0,0xe3,0x0,0xd0,0x81,0x76,0xd3,0xc0,0xe3,0x0,0xd0,0x81,0x7c,0xd3,0xd4,0xd1,0x0,0xe0,0x1,0xc9,0x0,0x3,0xc6,0x81,0x35,0xcb,0x0,0xd3,0x0,0x6,0x74,0x6f,0x4c,0x69,0x73,0x74,0x4,0x5f,0x6d,0x61,0x70,0x3,0x72,0x65,0x73,0x24,0x0,0x81,0x37,0x81,0x5c,0x82,0x4,0x24,0xc1,0xc1,0xc2,0xc1,0xc1,0x10,0x3a,0xc1,0x10,0x56,0xc1,0x10,0x6c,0xc1,0x10,0xe0,0xc1,0x11,0x2a,0xc1,0x11,0x20,0xc1,0x11,0x46,0xc1,0x11,0x4e,0xc1,0x12,0x56,0xc1,0x12,0x5e,0x39,0x82,0x7,0x82,0x7,0xc0,0x82,0x8,0x82,0x8,0x82,0x9,0x82,0x9,0x82,0x9,0x82,0x8,0xc0,0x82,0xa,0x82,0xa,0x82,0xb,0x82,0xc,0x82,0xb,0x82,0xd,0x82,0xe,0x82,0xe,0x82,0xe,0x82,0xd,0x82,0xf,0x82,0xf,0x82,0x10,0x82,0x10,0x82,0xf,0xc0,0x86,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x11,0xc,0x82,0x12,0xe5,0x64,0x82,0x3,0x81,0x5b,0x82,0x5,0x82,0x6,0x82,0x13,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xe1,0x2,0xc7,0x11,0xcb,0x0,0xca,0x0,0xd3,0xd3,0xd0,0x81,0x6e,0xd3,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xd1,0x1,0xc4,0x0,0xd6,0x2,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x70,0xd3,0xd1,0x3,0xf1,0x2,0x2a,0xc9,0x0,0x3,0xe1,0x2,0xc7,0x12,0xcb,0x2,0xcb,0x1,0xd3,0xd0,0x82,0x1,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe0,0x0,0xcb,0x3,0xc6,0x82,0x2,0xd3,0xd3,0x0,0xc1,0x15,0xfa,0x23,0x82,0x15,0x82,0x15,0x82,0x15,0xc0,0xb4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x16,0xc,0x82,0x17,0xae,0xc3,0xc4,0xc4,0xc4,0x82,0x18,0xe1,0x1,0xc7,0x5,0xc4,0x1,0xd3,0x0,0x4,0x66,0x72,0x6f,0x6d,0xc1,0x16,0x86,0xc1,0x16,0x7e,0x26,0x82,0x1b,0x82,0x1b,0x82,0x1c,0x82,0x1c,0x82,0x1c,0x82,0x1b,0xc0,0xb8,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x1d,0xc,0x82,0x1e,0xbc,0xc3,0xc4,0xc4,0xc4,0x82,0x1f,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x0,0xc4,0x1,0xd3,0xc9,0x0,0x1,0xd3,0xd9,0x0,0x1,0x0,0xc0,0xba,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x82,0x21,0xac,0xc3,0xc4,0xc4,0xc4,0x82,0x22,0xc4,0x1,0xd9,0x0,0x1,0x0,0xe0,0x22,0x66,0x69,0x6e,0x64,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x6e,0x20,0x65,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x20,0x6f,0x72,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0xc1,0x17,0x94,0xc1,0x17,0x8a,0x23,0x82,0x25,0x82,0x26,0x82,0x25,0xc0,0xc2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x27,0xc,0x82,0x28,0xaf,0xc3,0xc4,0xc4,0xc4,0x82,0x29,0xe1,0x1,0xc7,0x7,0xc6,0x82,0x24,0xd3,0x0,0xc1,0x18,0x9c,0x23,0x82,0x2b,0x82,0x2b,0x82,0x2b,0xc0,0xc8,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x2c,0xc,0x82,0x2d,0xb4,0xc3,0xc4,0xc4,0xc4,0x82,0x2e,0xe1,0x3,0xc7,0x5,0xc4,0x3,0xc9,0x2,0x1,0xc9,0x0,0x0,0xd3,0x0,0xc1,0x18,0x48,0xc1,0x18,0x7c,0x29,0x82,0x30,0x82,0x30,0xc0,0x82,0x31,0x82,0x31,0xc0,0xc0,0xc0,0xc0,0xc0,0xc4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x32,0xc,0x82,0x33,0xe5,0x35,0xc3,0xc4,0x10,0x61,0x82,0x34,0xe0,0x1,0xcf,0x1,0xc6,0x18,0xc9,0x1,0x1,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x2,0x0,0xe1,0x2,0xc9,0x0,0x0,0xcb,0x0,0xc9,0x1,0x1,0xd3,0xd0,0x82,0x2f,0xd3,0xe1,0x2,0xc7,0xf,0xc9,0x1,0x1,0xc4,0x1,0xd3,0xd9,0x1,0x1,0x0,0xc1,0x17,0x50,0xc1,0x17,0x74,0xc1,0x17,0xfa,0xc1,0x18,0x4,0xc1,0x18,0x12,0xc1,0x18,0xe6,0x31,0x82,0x36,0x82,0x36,0xc0,0x82,0x37,0x82,0x37,0x82,0x37,0xc0,0x82,0x38,0x82,0x39,0x82,0x39,0x82,0x3a,0x82,0x3a,0x82,0x39,0x82,0x38,0x82,0x3b,0x82,0x3b,0x82,0x3b,0xc0,0xbc,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x3c,0xc,0x82,0x3d,0xe5,0x42,0xc3,0xc4,0x1,0x61,0x82,0x3e,0xe0,0x0,0xcd,0x0,0xc6,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x82,0x2a,0xd3,0xf1,0x2,0x2a,0xc9,0x1,0x3,0xe1,0x2,0xc7,0xd,0xc9,0x0,0x1,0xe0,0x0,0xcf,0x0,0xc6,0x81,0x37,0xd3,0xd3,0xd0,0x82,0x35,0xd3,0xe1,0x1,0xc7,0x5,0xc4,0x1,0xd3,0x0,0xc1,0x19,0xb0,0x23,0x82,0x40,0x82,0x40,0x82,0x40,0xc0,0xd2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x41,0xc,0x82,0x42,0xb4,0xc3,0xc4,0xc4,0xc4,0x82,0x43,0xe1,0x3,0xc7,0x5,0xc4,0x2,0xc9,0x1,0x1,0xc8,0x1,0x0,0xd3,0x0,0xc1,0x19,0x8c,0xc1,0x19,0x80,0x2a,0xc0,0x82,0x45,0x82,0x45,0x82,0x46,0x82,0x46,0x82,0x45,0xc0,0xc0,0xc0,0xc0,0xc0,0xd0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x47,0xc,0x82,0x48,0xe5,0x30,0xc3,0xc4,0xc4,0xc4,0x82,0x49,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x1,0xcf,0x0,0xc6,0x18,0xc9,0x0,0x1,0xd3,0xc8,0x0,0x0,0xd3,0xd0,0x82,0x44,0xd3,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xd9,0x0,0x1,0x0,0x5,0x5f,0x66,0x69,0x6e,0x64,0x7,0x65,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x21,0x82,0x4c,0x21,0x82,0x4d,0x3,0x24,0x61,0x74,0x22,0x81,0x37,0x82,0x4f,0x22,0xc1,0xc2,0xc1,0x15,0xca,0xc1,0x15,0xee,0xc1,0x16,0x3e,0xc1,0x16,0x2c,0xc1,0x16,0x5e,0xc1,0x16,0xa8,0xc1,0x16,0xe4,0xc1,0x16,0xd8,0xc1,0x19,0x3c,0xc1,0x19,0x46,0xc1,0x19,0x54,0xc1,0x19,0xf6,0xe1,0x27,0x82,0x52,0x82,0x52,0xc0,0x82,0x53,0x82,0x53,0x82,0x53,0xc0,0x82,0x54,0x82,0x54,0x82,0x55,0x82,0x55,0x82,0x54,0xc0,0x82,0x56,0x82,0x56,0x82,0x56,0xc0,0xc0,0x82,0x57,0x82,0x57,0x82,0x57,0xc0,0xc0,0x82,0x58,0x82,0x58,0x82,0x59,0x82,0x59,0x82,0x58,0xc0,0x82,0x5a,0x82,0x5b,0x82,0x5b,0x82,0x5c,0x82,0x5c,0x82,0x5b,0x82,0x5a,0x82,0x5d,0x82,0x5d,0x82,0x5d,0xc0,0xb0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x5e,0xc,0x82,0x5f,0xe5,0x81,0x16,0x82,0x4b,0x82,0x4e,0x82,0x50,0x82,0x51,0x82,0x60,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xcb,0x0,0xc4,0x0,0xd3,0xd0,0x82,0x19,0xd3,0xe1,0x2,0xc7,0x11,0xe0,0x1,0xcc,0xc6,0x18,0xc6,0x82,0x1a,0xd3,0xc4,0x1,0xd3,0xd6,0x1,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0x12,0xcb,0x1,0xc4,0x0,0xd3,0xd0,0x82,0x20,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0x12,0xcb,0x1,0xc4,0x1,0xd3,0xd0,0x82,0x23,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xcc,0xc6,0x81,0x37,0xd3,0xc4,0x0,0xd3,0xd0,0x82,0x3f,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x3,0xe1,0x2,0xc7,0xd,0xcb,0x1,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xd3,0xd0,0x82,0x4a,0xd3,0xe1,0x1,0xc7,0x5,0xc4,0x0,0xd3,0x0,0xc1,0x1d,0x42,0xc1,0x1d,0x44,0x26,0x82,0x62,0x82,0x62,0x82,0x63,0x82,0x63,0x82,0x63,0x82,0x62,0xc0,0xee,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x64,0xc,0x82,0x65,0xb3,0xc3,0xc4,0xc4,0xc4,0x82,0x66,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe1,0x0,0xc7,0xa,0xd3,0xd3,0x0,0x2,0x67,0x74,0xc1,0x1d,0xfc,0xc1,0x1e,0x4,0x25,0x82,0x69,0x82,0x69,0x82,0x6a,0x82,0x6a,0x82,0x69,0xc0,0xfa,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x6b,0xc,0x82,0x6c,0xb7,0xc3,0xc4,0xc4,0xc4,0x82,0x6d,0xe1,0x2,0xc7,0x5,0xc4,0x2,0xe0,0x0,0xc9,0x1,0x3,0xc6,0x82,0x2,0xd3,0xd3,0x0,0xc1,0x1e,0x76,0x22,0x82,0x6f,0x82,0x6f,0xc0,0xfe,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x70,0xc,0x82,0x71,0xb3,0xc3,0xc4,0xc4,0xc4,0x82,0x72,0xe1,0x2,0xc9,0x1,0x0,0xc9,0x0,0x0,0xc9,0x1,0x4,0xd3,0x0,0xc1,0x1e,0xb8,0x22,0x82,0x74,0x82,0x74,0xc1,0x1,0x0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x75,0xc,0x82,0x76,0xb0,0xc3,0xc4,0xc4,0xc4,0x82,0x77,0xe1,0x1,0xc9,0x1,0x1,0xc9,0x0,0x0,0xd3,0x0,0xc1,0x1e,0xe2,0x22,0x82,0x79,0x82,0x79,0xc1,0x1,0x2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x82,0x7a,0xc,0x82,0x7b,0xb3,0xc3,0xc4,0xc4,0xc4,0x82,0x7c,0xe0,0x1,0xc9,0x1,0x3,0xc6,0x81,0x35,0xc9,0x0,0x0,0xd3,0x0,0x1,0x63,0x22,0xf,0x82,0x7e,0x22,0xc1,0xc1,0xc1,0x1d,0xe2,0xc1,0x1e,0x34,0x30,0xc0,0xc0,0xc0,0xc0,0x83,0x1,0x83,0x1,0x83,0x1,0xc0,0x83,0x2,0x83,0x2,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xf6,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x3,0xc,0x83,0x4,0xe5,0x56,0xc3,0xc4,0x82,0x7f,0x83,0x0,0x83,0x5,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x4,0xc4,0x1,0xd3,0xd9,0x0,0x4,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0x14,0xc9,0x0,0x4,0xc9,0x0,0x2,0xd3,0xd0,0x82,0x6e,0xd3,0xe0,0x1,0xcf,0x0,0xc6,0x18,0xc9,0x0,0x4,0xd3,0xd1,0x0,0xc9,0x0,0x0,0xe3,0x0,0xd0,0x82,0x73,0xd3,0xc0,0xe3,0x0,0xd0,0x82,0x78,0xd3,0xd4,0xd1,0x1,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xcb,0x1,0xd0,0x82,0x7d,0xd3,0x0,0x7,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,0x9,0x70,0x72,0x65,0x64,0x69,0x63,0x61,0x74,0x65,0x21,0x83,0x8,0x21,0x83,0x9,0x3,0x6c,0x65,0x6e,0x3,0x61,0x72,0x72,0x25,0x0,0x81,0x59,0x83,0xb,0x83,0xc,0x81,0x5c,0x25,0xc1,0xc1,0xc1,0xc1,0xc2,0xc1,0x1c,0xa2,0xc1,0x1c,0xd6,0xc1,0x1d,0x8,0xc1,0x1d,0x2a,0xc1,0x1d,0x6a,0xc1,0x1d,0x60,0xc1,0x1d,0x9a,0x32,0x83,0xf,0x83,0xf,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x11,0x83,0x11,0xc0,0x83,0x12,0x83,0x12,0x83,0x12,0xc0,0x83,0x13,0x83,0x14,0x83,0x13,0x83,0x15,0x83,0x15,0x83,0x15,0xc0,0xe4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x16,0xc,0x83,0x17,0xe5,0x52,0x83,0x7,0x83,0xa,0x83,0xd,0x83,0xe,0x83,0x18,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x11,0xca,0x0,0xc9,0x0,0x5,0xd3,0xd1,0x1,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xd1,0x2,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xcb,0x2,0xc4,0x0,0xd3,0xd0,0x82,0x67,0xd3,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x70,0xd3,0xd1,0x3,0xc4,0x0,0xd6,0x4,0xf1,0x1,0x1,0xc7,0x8,0xd0,0x83,0x6,0xd3,0x0,0x1c,0x72,0x65,0x64,0x75,0x63,0x65,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0xc1,0x23,0xba,0xc1,0x23,0xb0,0x23,0x83,0x1b,0x83,0x1c,0x83,0x1b,0xc1,0x1,0x1c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x1d,0xc,0x83,0x1e,0xaf,0xc3,0xc4,0xc4,0xc4,0x83,0x1f,0xe1,0x1,0xc7,0x7,0xc6,0x83,0x1a,0xd3,0x0,0x3,0x68,0x61,0x73,0x7,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0xc1,0x24,0x92,0x22,0x83,0x23,0x83,0x23,0xc1,0x1,0x24,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x24,0xc,0x83,0x25,0xb4,0xc3,0xc4,0xc4,0xc4,0x83,0x26,0xe0,0x1,0xcd,0x0,0xc6,0x18,0xc6,0x83,0x22,0xd3,0xd9,0x0,0x2,0x0,0xc1,0x24,0xfa,0x22,0x83,0x28,0x83,0x28,0xc1,0x1,0x26,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x29,0xc,0x83,0x2a,0xb8,0xc3,0xc4,0xc4,0xc4,0x83,0x2b,0xe0,0x1,0xcf,0x0,0xc6,0x18,0xc4,0x1,0xd3,0xd9,0x0,0x2,0xc4,0x2,0xd9,0x0,0x1,0x0,0xc1,0x25,0x72,0xc1,0x25,0x88,0x27,0x83,0x2d,0x83,0x2e,0x83,0x2e,0x83,0x2d,0xc0,0xc0,0xc0,0xc1,0x1,0x2a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x2f,0xc,0x83,0x30,0xe5,0x2a,0xc3,0xc4,0xc4,0xc4,0x83,0x31,0xe1,0x2,0xc9,0x0,0x0,0xc9,0x0,0x2,0xe0,0x1,0xcf,0x0,0xc6,0x18,0xc9,0x0,0x1,0xd3,0xd3,0xd9,0x0,0x2,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xd9,0x0,0x1,0x0,0x7,0x5f,0x72,0x65,0x64,0x75,0x63,0x65,0x2,0x24,0x69,0x4,0x24,0x72,0x65,0x73,0x23,0x0,0x83,0x34,0x83,0x35,0x23,0xc1,0xc2,0xc2,0xc1,0x23,0x80,0xc1,0x23,0x72,0xc1,0x23,0x9a,0xc1,0x24,0x56,0xc1,0x25,0x26,0xc1,0x25,0x2e,0xc1,0x25,0x3c,0xc1,0x25,0xd0,0x3a,0x83,0x38,0x83,0x38,0x83,0x39,0x83,0x39,0x83,0x38,0xc0,0x83,0x3a,0x83,0x3a,0x83,0x3a,0xc0,0x83,0x3b,0x83,0x3b,0xc0,0xc0,0xc0,0xc0,0x83,0x3c,0x83,0x3d,0x83,0x3d,0x83,0x3e,0x83,0x3e,0x83,0x3d,0x83,0x3c,0x83,0x3f,0x83,0x3f,0x83,0x3f,0xc1,0x1,0x18,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x40,0xc,0x83,0x41,0xe5,0x6b,0x83,0x33,0x81,0x5b,0x83,0x36,0x83,0x37,0x83,0x42,0xe1,0x2,0xc7,0x11,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x83,0x20,0xd3,0xc4,0x1,0xd6,0x1,0xc2,0xd6,0x2,0xe0,0x1,0xcc,0xc6,0x83,0x21,0xc6,0x83,0x22,0xd3,0xe3,0x0,0xd0,0x83,0x27,0xd3,0xc0,0xe3,0x0,0xd0,0x83,0x2c,0xd3,0xd4,0xf1,0x2,0x2a,0xc9,0x0,0x3,0xe1,0x2,0xc7,0xd,0xcb,0x1,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xd3,0xd0,0x83,0x32,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xcb,0x2,0xd3,0x0,0x4,0x65,0x61,0x63,0x68,0x23,0xc0,0xc0,0xc0,0xc1,0x1,0x3a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x45,0xc,0x83,0x46,0xb4,0xc3,0x11,0xc4,0xc4,0x83,0x47,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x0,0xca,0x0,0xd3,0xd9,0x0,0x0,0x0,0x4,0x5f,0x73,0x75,0x6d,0x4,0x24,0x73,0x75,0x6d,0x21,0x83,0x4a,0x21,0xc2,0xc1,0x26,0x9a,0xc1,0x26,0xda,0x25,0x83,0x4d,0x83,0x4d,0x83,0x4e,0x83,0x4e,0x83,0x4e,0xc1,0x1,0x36,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x4f,0xc,0x83,0x50,0xe5,0x22,0x83,0x49,0xc4,0x83,0x4b,0x83,0x4c,0x83,0x51,0xc4,0x0,0xd6,0x0,0xf0,0x1,0x1,0xce,0xc6,0x83,0x44,0xd0,0x83,0x48,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xcb,0x0,0xd3,0x0,0xc1,0x27,0x98,0xc1,0x27,0xa2,0x25,0x83,0x53,0x83,0x53,0x83,0x54,0x83,0x54,0x83,0x53,0xc1,0x1,0x44,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x55,0xc,0x83,0x56,0xb7,0xc3,0xc4,0xc4,0xc4,0x83,0x57,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x1,0xcd,0x0,0xc6,0x18,0xc4,0x1,0xd3,0xd3,0x0,0xc1,0x27,0xe4,0xc1,0x27,0xee,0x25,0x83,0x59,0x83,0x59,0x83,0x5a,0x83,0x5a,0x83,0x59,0xc1,0x1,0x46,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x5b,0xc,0x83,0x5c,0xb7,0xc3,0xc4,0xc4,0xc4,0x83,0x5d,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x1,0xcf,0x0,0xc6,0x18,0xc4,0x1,0xd3,0xd3,0x0,0xc1,0x1,0x4a,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x83,0x5f,0xad,0xc3,0xc4,0xc4,0xc4,0x83,0x60,0xc8,0x0,0x0,0xd9,0x1,0x0,0x0,0xc1,0x28,0x74,0xc1,0x28,0x60,0xc1,0x28,0x52,0x28,0xc0,0x83,0x62,0x83,0x62,0x83,0x63,0x83,0x64,0x83,0x63,0x83,0x62,0xc0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x65,0xc,0x83,0x5f,0xe5,0x23,0xc3,0x11,0xc4,0xc4,0x83,0x66,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc9,0x0,0x0,0xd3,0xc6,0x81,0x11,0xd3,0xd0,0x83,0x61,0xd3,0x0,0x4,0x5f,0x6d,0x69,0x6e,0x7,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x21,0x83,0x69,0x21,0x83,0x6a,0x4,0x24,0x6d,0x69,0x6e,0x21,0x83,0x6c,0xc1,0x27,0x80,0xc1,0x27,0x74,0xc1,0x27,0xcc,0xc1,0x27,0xc0,0xc1,0x28,0x1c,0xc1,0x28,0x34,0xc1,0x28,0xa8,0x35,0xc0,0x83,0x6e,0x83,0x6e,0x83,0x6f,0x83,0x6f,0x83,0x6e,0xc0,0xc0,0x83,0x70,0x83,0x70,0x83,0x71,0x83,0x71,0x83,0x70,0xc0,0x83,0x72,0x83,0x72,0x83,0x73,0x83,0x73,0x83,0x74,0x83,0x74,0x83,0x74,0xc1,0x1,0x42,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x75,0xc,0x83,0x76,0xe5,0x59,0x83,0x68,0x83,0x6b,0x83,0x6d,0x83,0x4c,0x83,0x77,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xc4,0x0,0xd3,0xd0,0x83,0x58,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xc4,0x1,0xd3,0xd0,0x83,0x5e,0xd3,0xe0,0x1,0xce,0xc6,0x18,0xc4,0x1,0xd3,0xd6,0x0,0xf0,0x1,0x1,0xce,0xc6,0x83,0x44,0xd0,0x83,0x67,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xcb,0x0,0xd3,0x0,0xc1,0x29,0x64,0xc1,0x29,0x6e,0x25,0x83,0x79,0x83,0x79,0x83,0x7a,0x83,0x7a,0x83,0x79,0xc1,0x1,0x54,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x7b,0xc,0x83,0x7c,0xb7,0xc3,0xc4,0xc4,0xc4,0x83,0x7d,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x1,0xcd,0x0,0xc6,0x18,0xc4,0x1,0xd3,0xd3,0x0,0xc1,0x29,0xb0,0xc1,0x29,0xba,0x25,0x83,0x7f,0x83,0x7f,0x84,0x0,0x84,0x0,0x83,0x7f,0xc1,0x1,0x56,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x1,0xc,0x84,0x2,0xb7,0xc3,0xc4,0xc4,0xc4,0x84,0x3,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x1,0xcf,0x0,0xc6,0x18,0xc4,0x1,0xd3,0xd3,0x0,0xc1,0x1,0x5a,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x84,0x5,0xad,0xc3,0xc4,0xc4,0xc4,0x84,0x6,0xc8,0x0,0x0,0xd9,0x1,0x0,0x0,0xc1,0x2a,0x40,0xc1,0x2a,0x2c,0xc1,0x2a,0x1e,0x28,0xc0,0x84,0x8,0x84,0x8,0x84,0x9,0x84,0xa,0x84,0x9,0x84,0x8,0xc0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0xb,0xc,0x84,0x5,0xe5,0x22,0xc3,0x11,0xc4,0xc4,0x84,0xc,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0xb,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc9,0x0,0x0,0xd3,0xc4,0x1,0xd3,0xd0,0x84,0x7,0xd3,0x0,0x4,0x5f,0x6d,0x61,0x78,0x4,0x24,0x6d,0x61,0x78,0x21,0x84,0xf,0xc1,0x29,0x4c,0xc1,0x29,0x40,0xc1,0x29,0x98,0xc1,0x29,0x8c,0xc1,0x29,0xe8,0xc1,0x2a,0x0,0xc1,0x2a,0x72,0x35,0xc0,0x84,0x11,0x84,0x11,0x84,0x12,0x84,0x12,0x84,0x11,0xc0,0xc0,0x84,0x13,0x84,0x13,0x84,0x14,0x84,0x14,0x84,0x13,0xc0,0x84,0x15,0x84,0x15,0x84,0x16,0x84,0x16,0x84,0x17,0x84,0x17,0x84,0x17,0xc1,0x1,0x52,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x18,0xc,0x84,0x19,0xe5,0x59,0x84,0xe,0x83,0x6b,0x84,0x10,0x83,0x4c,0x84,0x1a,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xc4,0x0,0xd3,0xd0,0x83,0x7e,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xc4,0x1,0xd3,0xd0,0x84,0x4,0xd3,0xe0,0x1,0xce,0xc6,0x18,0xc4,0x1,0xd3,0xd6,0x0,0xf0,0x1,0x1,0xce,0xc6,0x83,0x44,0xd0,0x84,0xd,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xcb,0x0,0xd3,0x0,0xc1,0x2b,0x56,0xc1,0x2b,0x60,0x25,0x84,0x1c,0x84,0x1c,0x84,0x1d,0x84,0x1d,0x84,0x1c,0xc1,0x1,0x64,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x1e,0xc,0x84,0x1f,0xb7,0xc3,0xc4,0xc4,0xc4,0x84,0x20,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x1,0xcd,0x0,0xc6,0x18,0xc4,0x1,0xd3,0xd3,0x0,0x3,0x64,0x69,0x76,0x3,0x73,0x75,0x6d,0x5,0x5f,0x6d,0x65,0x61,0x6e,0xc1,0x2b,0x3e,0xc1,0x2b,0x32,0xc1,0x2b,0x82,0xc1,0x2b,0x78,0xc1,0x2b,0x8e,0x2e,0xc0,0x84,0x25,0x84,0x25,0x84,0x26,0x84,0x26,0x84,0x25,0xc0,0x84,0x27,0x84,0x27,0x84,0x28,0x84,0x28,0x84,0x29,0x84,0x29,0x84,0x27,0xc1,0x1,0x62,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x2a,0xc,0x84,0x2b,0xe5,0x34,0x84,0x24,0x83,0x6b,0xc4,0xc4,0x84,0x2c,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xc4,0x0,0xd3,0xd0,0x84,0x21,0xd3,0xe1,0x2,0xc7,0x15,0xe0,0x0,0xce,0xc6,0x84,0x23,0xd3,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xd3,0x0,0xc1,0x2c,0x54,0xc1,0x2c,0x5e,0x25,0x84,0x2e,0x84,0x2e,0x84,0x2f,0x84,0x2f,0x84,0x2e,0xc1,0x1,0x6e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x30,0xc,0x84,0x31,0xb7,0xc3,0xc4,0xc4,0xc4,0x84,0x32,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x1,0xcd,0x0,0xc6,0x18,0xc4,0x1,0xd3,0xd3,0x0,0xc1,0x2c,0xa0,0xc1,0x2c,0xaa,0x25,0x84,0x34,0x84,0x34,0x84,0x35,0x84,0x35,0x84,0x34,0xc1,0x1,0x70,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x36,0xc,0x84,0x37,0xb7,0xc3,0xc4,0xc4,0xc4,0x84,0x38,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x1,0xcf,0x0,0xc6,0x18,0xc4,0x1,0xd3,0xd3,0x0,0x4,0x73,0x6f,0x72,0x74,0x5,0x66,0x6c,0x6f,0x6f,0x72,0xc1,0x2d,0x54,0xc1,0x2d,0x62,0x25,0x84,0x3c,0x84,0x3c,0x84,0x3d,0x84,0x3d,0x84,0x3c,0xc1,0x1,0x76,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x3e,0xc,0x84,0x3f,0xb9,0xc3,0xc4,0xc4,0xc4,0x84,0x40,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x18,0xc9,0x0,0x1,0xd3,0xd3,0x0,0x4,0x63,0x65,0x69,0x6c,0x7,0x5f,0x6d,0x65,0x64,0x69,0x61,0x6e,0x6,0x73,0x6f,0x72,0x74,0x65,0x64,0x4,0x68,0x61,0x6c,0x66,0x22,0x84,0x44,0x84,0x45,0xc1,0x2c,0x3c,0xc1,0x2c,0x30,0xc1,0x2c,0x88,0xc1,0x2c,0x7c,0xc1,0x2c,0xd4,0xc1,0x2d,0xa,0xc1,0x2c,0xfe,0xc1,0x2d,0x36,0xc1,0x2d,0x28,0xc1,0x2d,0xca,0xc1,0x2d,0xa0,0xc1,0x2d,0x86,0xc1,0x2d,0x90,0xc1,0x2d,0xb0,0xc1,0x2d,0xba,0xe1,0x2a,0xc0,0x84,0x47,0x84,0x47,0x84,0x48,0x84,0x48,0x84,0x47,0xc0,0xc0,0x84,0x49,0x84,0x49,0x84,0x4a,0x84,0x4a,0x84,0x49,0xc0,0x84,0x4b,0x84,0x4b,0x84,0x4c,0x84,0x4c,0x84,0x4d,0x84,0x4d,0x84,0x4c,0xc0,0x84,0x4e,0x84,0x4e,0x84,0x4f,0x84,0x4f,0x84,0x4e,0xc0,0x84,0x50,0x84,0x50,0x84,0x51,0x84,0x51,0x84,0x52,0x84,0x53,0x84,0x53,0x84,0x52,0x84,0x54,0x84,0x55,0x84,0x55,0x84,0x54,0x84,0x51,0x84,0x50,0xc1,0x1,0x6c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x56,0xc,0x84,0x57,0xe5,0x81,0x17,0x84,0x43,0x83,0x6b,0x84,0x46,0x83,0x0,0x84,0x58,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xc4,0x0,0xd3,0xd0,0x84,0x33,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xc4,0x1,0xd3,0xd0,0x84,0x39,0xd3,0xe0,0x0,0xce,0xc6,0x84,0x3a,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x15,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xc4,0x2,0xd3,0xd1,0x1,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xcb,0x1,0xc6,0x84,0x3b,0xd3,0xcb,0x1,0xd3,0xd0,0x84,0x41,0xd3,0xe1,0x2,0xc7,0x15,0xe1,0x2,0xc7,0xf,0xe0,0x1,0xcb,0x0,0xc6,0x18,0xe0,0x0,0xcb,0x1,0xc6,0x84,0x3b,0xd3,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x18,0xe0,0x0,0xcb,0x1,0xc6,0x84,0x42,0xd3,0xd3,0xd3,0xc4,0x2,0xd3,0x0,0x3,0x73,0x75,0x62,0xc1,0x2e,0x44,0x23,0x84,0x5b,0x84,0x5b,0x84,0x5b,0xc1,0x1,0x7e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x5c,0xc,0x84,0x5d,0xae,0xc3,0xc4,0xc4,0xc4,0x84,0x5e,0xe1,0x1,0xc7,0x5,0xc4,0x1,0xd3,0x0,0x3,0x73,0x65,0x74,0xc1,0x2f,0x78,0xc1,0x2f,0x82,0x28,0x84,0x61,0x84,0x62,0x84,0x62,0x84,0x62,0x84,0x61,0xc0,0xc0,0xc0,0xc1,0x1,0x8a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x63,0xc,0x84,0x64,0xe5,0x2a,0xc3,0xc4,0xc4,0xc4,0x84,0x65,0xe0,0x2,0xc8,0x1,0x0,0xc6,0x84,0x60,0xe1,0x2,0xc7,0x16,0xc9,0x1,0x1,0xc4,0x1,0xd3,0xc9,0x0,0x0,0xd3,0xe1,0x2,0xc7,0xf,0xc9,0x1,0x1,0xc4,0x1,0xd3,0xd9,0x1,0x1,0x0,0xc1,0x30,0x2,0xc1,0x30,0x1a,0xc1,0x30,0x32,0x29,0x84,0x67,0x84,0x68,0x84,0x68,0x84,0x67,0x84,0x69,0x84,0x69,0xc0,0xc0,0xc0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x6a,0xc,0x13,0xe5,0x3a,0xc3,0xc4,0xc4,0xc4,0x84,0x6b,0xe0,0x2,0xc8,0x1,0x0,0xc6,0x84,0x60,0xc9,0x1,0x1,0xe0,0x1,0xc8,0x1,0x0,0xc6,0x18,0xc9,0x1,0x2,0xd3,0xd3,0xe0,0x2,0xc8,0x1,0x0,0xc6,0x84,0x60,0xc9,0x1,0x2,0xc9,0x0,0x0,0xd3,0xe1,0x2,0xc7,0x16,0xc9,0x1,0x2,0xc4,0x1,0xd3,0xd9,0x1,0x2,0x0,0x5,0x63,0x68,0x65,0x63,0x6b,0x21,0x84,0x6d,0xc1,0x2f,0x1a,0xc1,0x2f,0x4c,0x28,0x84,0x6f,0x84,0x6f,0x84,0x70,0x84,0x70,0xc0,0xc0,0xc0,0xc0,0xc1,0x1,0x86,0x64,0x7,0xc8,0x8,0xc3,0x9,0x84,0x71,0xc,0x84,0x72,0xe5,0x2e,0xc3,0xc4,0x84,0x6e,0x61,0x84,0x73,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x18,0xc9,0x0,0x1,0xd3,0xd1,0x0,0xe1,0x2,0xc8,0x0,0x1,0xcb,0x0,0xc9,0x0,0x0,0xd3,0xe3,0x0,0xd0,0x84,0x66,0xd3,0xc0,0xe3,0x0,0xd0,0x84,0x6c,0xd3,0xd4,0x0,0xa,0x69,0x6e,0x6e,0x65,0x72,0x71,0x73,0x6f,0x72,0x74,0x4,0x6c,0x69,0x73,0x74,0x21,0x84,0x76,0x9,0x73,0x6d,0x61,0x6c,0x6c,0x65,0x72,0x66,0x6e,0x21,0x84,0x78,0x1,0x62,0x21,0x84,0x7a,0x24,0x84,0x77,0x84,0x79,0x84,0x7b,0x10,0x5,0x70,0x69,0x76,0x6f,0x74,0x4,0x24,0x65,0x6e,0x64,0x23,0x84,0x7d,0x82,0x4f,0x84,0x7e,0xc1,0x2e,0x3a,0xc1,0x2e,0x32,0xc1,0x2e,0x72,0xc1,0x2e,0x9a,0xc1,0x2e,0xd6,0xc1,0x2e,0xe0,0xc1,0x30,0x76,0xc1,0x30,0xb0,0xc1,0x30,0xe4,0xc1,0x31,0xa,0xc1,0x31,0x38,0x3e,0xc0,0x85,0x0,0x85,0x0,0x85,0x1,0x85,0x1,0x85,0x1,0x85,0x0,0xc0,0x85,0x2,0x85,0x2,0x85,0x3,0x85,0x3,0x85,0x3,0x85,0x4,0x85,0x5,0x85,0x5,0x85,0x5,0x85,0x4,0x85,0x6,0x85,0x6,0x85,0x7,0x85,0x8,0x85,0x8,0x85,0x8,0x85,0x7,0x85,0x9,0x85,0xa,0x85,0xa,0x85,0xa,0x85,0x9,0xc1,0x1,0x7c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x85,0xb,0xc,0x85,0xc,0xe5,0x81,0x8,0x84,0x75,0x84,0x7c,0x84,0x7f,0x83,0x37,0x85,0xd,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0x12,0xe1,0x2,0xc7,0x16,0xca,0x3,0xca,0x2,0xd3,0xc4,0x1,0xd3,0xd0,0x84,0x5f,0xd3,0xe0,0x1,0xca,0x0,0xc6,0x18,0xca,0x2,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0xf,0xca,0x2,0xc4,0x1,0xd3,0xd6,0x1,0xca,0x3,0xd6,0x2,0xf1,0x2,0x2a,0xc9,0x0,0x3,0xe1,0x2,0xc7,0xd,0xcb,0x1,0xcb,0x2,0xd3,0xd0,0x84,0x74,0xd3,0xe0,0x2,0xca,0x0,0xc6,0x84,0x60,0xcb,0x2,0xcb,0x0,0xd3,0xe1,0x4,0xc9,0x0,0x15,0xca,0x0,0xca,0x1,0xca,0x2,0xe1,0x2,0xc7,0x16,0xcb,0x2,0xc4,0x1,0xd3,0xd3,0xe1,0x4,0xc9,0x0,0x15,0xca,0x0,0xca,0x1,0xe1,0x2,0xc7,0xf,0xcb,0x2,0xc4,0x1,0xd3,0xca,0x3,0xd3,0x0,0x7,0x69,0x73,0x41,0x72,0x72,0x61,0x79,0xc1,0x31,0xd0,0xc1,0x32,0x2,0xc1,0x32,0x2c,0x27,0x85,0x10,0x85,0x11,0x85,0x11,0x85,0x10,0x85,0x12,0x85,0x12,0x85,0x12,0xc1,0x1,0x98,0x64,0x7,0xc8,0x8,0xc3,0x9,0x85,0x13,0xc,0x85,0x14,0xe5,0x28,0xc3,0xc4,0xc4,0xc4,0x85,0x15,0xe1,0x4,0xc9,0x1,0x15,0xc8,0x0,0x0,0xc8,0x0,0x1,0xc4,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x81,0x37,0xd3,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc8,0x0,0x0,0xd3,0x0,0x5,0x71,0x73,0x6f,0x72,0x74,0x22,0x84,0x77,0x84,0x79,0xc1,0x31,0x9c,0xc1,0x31,0x8e,0xc1,0x32,0x58,0xc1,0x32,0x4e,0xc1,0x32,0x8a,0xc1,0x32,0xbc,0xc1,0x32,0xde,0xc1,0x32,0xe8,0x31,0xc0,0x85,0x19,0x85,0x1a,0x85,0x19,0xc0,0x85,0x1b,0x85,0x1c,0x85,0x1b,0x85,0x1d,0x85,0x1e,0x85,0x1e,0x85,0x1d,0x85,0x1f,0x85,0x1f,0x85,0x20,0x85,0x20,0x85,0x1f,0x64,0x7,0xc8,0x8,0xc3,0x9,0x85,0x21,0xc,0x12,0xe5,0x4a,0x85,0x17,0x85,0x18,0x84,0x77,0x61,0x85,0x22,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x17,0xca,0x0,0xd3,0xd0,0x85,0x16,0xd3,0xe0,0x1,0xc7,0x13,0xc6,0x81,0x70,0xca,0x0,0xd3,0xd1,0x0,0xe1,0x4,0xc9,0x0,0x15,0xcb,0x0,0xca,0x1,0xc4,0x1,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x37,0xd3,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x82,0x2,0xd3,0xd3,0x0,0x5,0x5f,0x73,0x6f,0x72,0x74,0xc1,0x34,0x10,0xc1,0x34,0x40,0xc1,0x34,0x34,0xc1,0x34,0x26,0x2a,0x85,0x25,0x85,0x26,0x85,0x26,0x85,0x27,0x85,0x27,0x85,0x28,0x85,0x28,0x85,0x27,0x85,0x26,0x85,0x25,0xc1,0x1,0xaa,0x64,0x7,0xc8,0x8,0xc3,0x9,0x85,0x29,0xc,0x85,0x2a,0xe5,0x25,0x85,0x24,0x81,0x5b,0xc4,0xc4,0x85,0x2b,0xe1,0x2,0xc9,0x0,0x16,0xce,0xe1,0x2,0xc7,0x11,0xe1,0x2,0xc7,0x11,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x0,0xd3,0xc9,0x0,0x7,0xd3,0xd3,0x0,0x5,0x74,0x69,0x6d,0x65,0x73,0x6,0x73,0x74,0x72,0x69,0x6e,0x67,0x22,0xc0,0x85,0x2e,0x6,0x61,0x73,0x73,0x65,0x72,0x74,0x18,0x72,0x6e,0x64,0x20,0x3e,0x3d,0x20,0x6e,0x20,0x61,0x6e,0x64,0x20,0x72,0x6e,0x64,0x20,0x3c,0x3d,0x20,0x73,0x69,0x7a,0x65,0x1,0x6e,0x21,0x85,0x32,0x21,0x85,0x33,0x3,0x72,0x6e,0x64,0x3,0x74,0x6d,0x70,0x22,0x85,0x35,0x85,0x36,0xc1,0x35,0x14,0xc1,0x35,0x24,0xc1,0x35,0x18,0xc1,0x35,0x38,0xc1,0x35,0x30,0xc1,0x35,0x60,0xc1,0x35,0x52,0xc1,0x35,0x72,0xc1,0x35,0x68,0xc1,0x35,0x82,0xc1,0x35,0xb6,0xc1,0x35,0xd8,0xc1,0x35,0xee,0xc1,0x36,0xc,0xe1,0x20,0x85,0x38,0x85,0x38,0x85,0x39,0x85,0x3a,0x85,0x3b,0x85,0x3b,0x85,0x3c,0x85,0x3c,0x85,0x3c,0x85,0x3b,0x85,0x39,0x85,0x38,0x85,0x3d,0x85,0x3e,0x85,0x3f,0x85,0x3f,0x85,0x40,0x85,0x40,0x85,0x40,0x85,0x41,0x85,0x41,0x85,0x41,0x85,0x3f,0x85,0x3d,0x85,0x42,0x85,0x42,0x85,0x43,0x85,0x44,0x85,0x44,0x85,0x43,0x85,0x45,0x85,0x45,0xc1,0x1,0xb4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x85,0x46,0xc,0x85,0x47,0xe5,0x79,0xc3,0x85,0x34,0x85,0x37,0x83,0x0,0x85,0x48,0xe1,0x2,0xc7,0xf,0xca,0x0,0xe1,0x1,0xc7,0x10,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0x16,0xc9,0x0,0x0,0xca,0x0,0xd3,0xc4,0x1,0xd3,0xd3,0xd3,0xd1,0x0,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0x19,0xe1,0x2,0xc7,0xe,0xcb,0x0,0xca,0x0,0xd3,0xe1,0x2,0xc7,0xd,0xcb,0x0,0xc9,0x0,0x0,0xd3,0xd3,0xc6,0x85,0x31,0xd3,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x18,0xcb,0x0,0xd3,0xd1,0x1,0xe0,0x2,0xc8,0x0,0x0,0xc6,0x84,0x60,0xcb,0x0,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x18,0xca,0x0,0xd3,0xd3,0xe0,0x2,0xc8,0x0,0x0,0xc6,0x84,0x60,0xca,0x0,0xcb,0x1,0xd3,0x0,0x9,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x69,0x7a,0x65,0x21,0x83,0xc,0x21,0x85,0x4b,0x22,0x81,0x37,0x81,0x5c,0xc1,0x34,0xa0,0xc1,0x34,0xda,0x24,0x85,0x4e,0x85,0x4e,0x85,0x4f,0x85,0x4f,0xc1,0x1,0xae,0x64,0x7,0xc8,0x8,0xc3,0x9,0x85,0x50,0xc,0x85,0x51,0xe5,0x27,0x85,0x4a,0x85,0x4c,0x85,0x4d,0x82,0x51,0x85,0x52,0xe0,0x0,0xca,0x0,0xc6,0x81,0x37,0xd3,0xd1,0x0,0xc4,0x1,0xd6,0x1,0xf0,0x1,0x1,0xcb,0x0,0xc6,0x85,0x2d,0xd0,0x85,0x49,0xd3,0xca,0x0,0x0,0xa,0x5f,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x69,0x7a,0x65,0xc1,0x37,0x4,0xc1,0x36,0xe2,0xc1,0x36,0xee,0xc1,0x36,0xe4,0x27,0x85,0x55,0x85,0x56,0x85,0x57,0x85,0x58,0x85,0x57,0x85,0x56,0x85,0x55,0xc1,0x1,0xc6,0x64,0x7,0xc8,0x8,0xc3,0x9,0x85,0x59,0xc,0x85,0x5a,0xbd,0x85,0x54,0xc4,0xc4,0xc4,0x85,0x5b,0xe0,0x0,0xe1,0x1,0xc9,0x0,0x18,0xe0,0x1,0xc7,0x13,0xc6,0x81,0x70,0xce,0xd3,0xd3,0xc6,0x82,0x2,0xd3,0x0,0x8,0x69,0x73,0x4e,0x75,0x6d,0x62,0x65,0x72,0xc1,0x38,0x72,0x23,0x85,0x5e,0x85,0x5e,0x85,0x5e,0xc1,0x1,0xd2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x85,0x5f,0xc,0x85,0x60,0xb1,0xc3,0xc4,0xc4,0xc4,0x85,0x61,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc8,0x0,0x0,0xd3,0x0,0xb,0x5f,0x6a,0x73,0x6f,0x6e,0x5f,0x70,0x61,0x72,0x73,0x65,0xc1,0x39,0x32,0x23,0x85,0x64,0x85,0x64,0x85,0x64,0xc1,0x1,0xd8,0x64,0x7,0xc8,0x8,0xc3,0x9,0x85,0x65,0xc,0x85,0x66,0xb1,0xc3,0xc4,0xc4,0xc4,0x85,0x67,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc9,0x0,0x0,0xd3,0x0,0x6,0x4e,0x75,0x6d,0x62,0x65,0x72,0x1,0x73,0x21,0x85,0x6a,0x21,0x85,0x6b,0xc1,0x38,0x5c,0xc1,0x38,0x4c,0xc1,0x38,0xca,0xc1,0x38,0xe2,0xc1,0x38,0xcc,0xc1,0x38,0xe6,0xc1,0x39,0x1c,0xc1,0x39,0xc,0xc1,0x39,0x4c,0x34,0xc0,0x85,0x6d,0x85,0x6e,0x85,0x6d,0xc0,0x85,0x6f,0x85,0x70,0x85,0x71,0x85,0x72,0x85,0x72,0x85,0x70,0x85,0x6f,0xc0,0x85,0x73,0x85,0x74,0x85,0x73,0xc0,0x85,0x75,0x85,0x75,0x85,0x75,0xc1,0x1,0xd0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x85,0x76,0xc,0x85,0x77,0xe5,0x48,0x85,0x69,0x85,0x6c,0x81,0x2,0x61,0x85,0x78,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x1a,0xca,0x0,0xd3,0xd0,0x85,0x62,0xd3,0xe1,0x1,0xc9,0x0,0x4,0xe1,0x1,0xc7,0x1b,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x1a,0xcb,0x0,0xd3,0xd0,0x85,0x68,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xc2,0xd3,0x0,0x6,0x69,0x73,0x4c,0x69,0x73,0x74,0xc1,0x3a,0x42,0xc1,0x3a,0x56,0x25,0x85,0x7b,0x85,0x7b,0x85,0x7c,0x85,0x7c,0x85,0x7c,0xc1,0x1,0xe4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x85,0x7d,0xc,0x85,0x7e,0xba,0xc3,0xc4,0xc4,0xc4,0x85,0x7f,0xe1,0x2,0xc9,0x2,0x1b,0xc8,0x0,0x0,0xc8,0x1,0x1,0xd3,0xe1,0x1,0xc7,0x5,0xc4,0x1,0xd3,0x0,0xc1,0x3a,0xa4,0xc1,0x3a,0xb8,0x25,0x86,0x1,0x86,0x1,0x86,0x2,0x86,0x2,0x86,0x2,0xc1,0x1,0xe6,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x3,0xc,0x86,0x4,0xba,0xc3,0xc4,0xc4,0xc4,0x86,0x5,0xe1,0x2,0xc9,0x2,0x1b,0xc8,0x0,0x0,0xc8,0x1,0x1,0xd3,0xe1,0x1,0xc7,0x5,0xc4,0x1,0xd3,0x0,0xc1,0x3a,0x26,0xc1,0x3a,0x1a,0xc1,0x3a,0x88,0xc1,0x3a,0x7a,0xc1,0x3a,0xdc,0x2c,0xc0,0x86,0x7,0x86,0x8,0x86,0x7,0xc0,0xc0,0x86,0x9,0x86,0xa,0x86,0x9,0xc0,0x86,0xb,0x86,0xb,0xc1,0x1,0xe2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0xc,0xc,0x86,0xd,0xe5,0x34,0xc3,0x11,0xc4,0xc4,0x86,0xe,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x1,0xc7,0x1c,0xca,0x0,0xd3,0xd0,0x86,0x0,0xd3,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x1,0xc7,0x17,0xca,0x0,0xd3,0xd0,0x86,0x6,0xd3,0xe0,0x1,0xc8,0x0,0x1,0xc6,0x81,0x35,0xca,0x0,0xd3,0x0,0x9,0x5f,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x32,0x2,0x6c,0x73,0x21,0x86,0x11,0x22,0x86,0x12,0x85,0x4b,0xc1,0x39,0xee,0x22,0x86,0x14,0x86,0x14,0xc1,0x1,0xe0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x15,0xc,0x86,0x16,0xb5,0x86,0x10,0x86,0x13,0xc4,0xc4,0x86,0x17,0xf0,0x1,0x1,0xca,0x0,0xc6,0x83,0x44,0xd0,0x86,0xf,0xd3,0x0,0x8,0x5f,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0xc1,0x3c,0xf8,0xc1,0x3c,0xee,0xc1,0x3d,0x1c,0xc1,0x3d,0x48,0xc1,0x3d,0x50,0x2a,0x86,0x1a,0x86,0x1b,0x86,0x1a,0x86,0x1c,0x86,0x1c,0x86,0x1d,0x86,0x1d,0x86,0x1e,0x86,0x1e,0x86,0x1d,0xc1,0x1,0xf4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x1f,0xc,0x86,0x20,0xe5,0x2b,0x86,0x19,0xc4,0x85,0x4b,0x61,0x86,0x21,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x70,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x0,0x1b,0xce,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x82,0x2,0xd3,0xd3,0x0,0x0,0xc1,0x3e,0x92,0x23,0x86,0x24,0x86,0x24,0x86,0x24,0xc1,0x2,0x4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x25,0xc,0x86,0x26,0xb1,0xc3,0xc4,0xc4,0xc4,0x86,0x27,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc6,0x86,0x23,0xd3,0x0,0x3,0x63,0x61,0x74,0xc1,0x3f,0x92,0xc1,0x3f,0x80,0xc1,0x3f,0xac,0xc1,0x3f,0xb6,0x2b,0x86,0x2a,0x86,0x2b,0x86,0x2b,0x86,0x2c,0x86,0x2d,0x86,0x2d,0x86,0x2c,0x86,0x2a,0xc0,0xc0,0xc0,0xc1,0x2,0xe,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x2e,0xc,0x86,0x2f,0xe5,0x39,0xc3,0xc4,0xc4,0xc4,0x86,0x30,0xe0,0x1,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x86,0x29,0xc9,0x0,0x0,0xd3,0xc6,0x86,0x29,0xe1,0x1,0xc9,0x1,0x23,0xe0,0x1,0xcf,0x0,0xc6,0x18,0xc9,0x0,0x2,0xd3,0xd3,0xd3,0xd9,0x0,0x1,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x2,0xc4,0x1,0xd3,0xd9,0x0,0x2,0x0,0x5,0x5f,0x6a,0x6f,0x69,0x6e,0x3,0x73,0x65,0x70,0x21,0x86,0x33,0x21,0x86,0x34,0x23,0x86,0x33,0x83,0x35,0x83,0x34,0xc1,0x3e,0x7a,0xc1,0x3e,0x6e,0xc1,0x3e,0xb6,0xc1,0x3e,0xf2,0xc1,0x3e,0xfc,0xc1,0x3f,0x36,0xc1,0x3f,0x3e,0xc1,0x3f,0x4c,0xc1,0x3f,0xf8,0x38,0xc0,0x86,0x37,0x86,0x37,0x86,0x38,0x86,0x38,0x86,0x37,0xc0,0x86,0x39,0x86,0x39,0x86,0x39,0x86,0x3a,0x86,0x3b,0x86,0x3b,0x86,0x3a,0x86,0x3c,0x86,0x3d,0x86,0x3d,0x86,0x3e,0x86,0x3e,0x86,0x3d,0x86,0x3c,0x86,0x3f,0x86,0x3f,0x86,0x3f,0xc1,0x2,0x2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x40,0xc,0x86,0x41,0xe5,0x64,0x86,0x32,0x86,0x35,0x86,0x36,0x83,0x37,0x86,0x42,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xc4,0x0,0xd3,0xd0,0x86,0x28,0xd3,0xe1,0x2,0xc7,0x11,0xca,0x0,0xc6,0x86,0x23,0xd3,0xd1,0x0,0xe1,0x1,0xc9,0x0,0x23,0xe0,0x1,0xce,0xc6,0x18,0xc4,0x1,0xd3,0xd3,0xd6,0x1,0xc4,0x2,0xd6,0x2,0xf1,0x2,0x2a,0xc9,0x0,0x3,0xe1,0x2,0xc7,0xd,0xcb,0x2,0xe0,0x0,0xce,0xc6,0x81,0x37,0xd3,0xd3,0xd0,0x86,0x31,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xcb,0x1,0xd3,0x0,0xc1,0x40,0x48,0x22,0x86,0x44,0x86,0x44,0xc1,0x2,0x18,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x45,0xc,0x86,0x46,0xb0,0xc3,0x11,0xc4,0xc4,0x86,0x47,0xe0,0x1,0xce,0xc6,0x81,0x35,0xca,0x0,0xd3,0x0,0x7,0x5f,0x61,0x64,0x64,0x41,0x6c,0x6c,0x21,0x86,0x12,0xc1,0x40,0x2a,0x22,0x86,0x4b,0x86,0x4b,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x4c,0xc,0x86,0x46,0xb5,0x86,0x49,0x86,0x4a,0xc4,0xc4,0x86,0x4d,0xf0,0x1,0x1,0xca,0x0,0xc6,0x83,0x44,0xd0,0x86,0x48,0xd3,0x0,0x1,0x20,0x9,0x6b,0x65,0x65,0x70,0x65,0x6d,0x70,0x74,0x79,0x4,0x74,0x72,0x69,0x6d,0x5,0x6c,0x69,0x6d,0x69,0x74,0x7,0x69,0x73,0x52,0x65,0x67,0x65,0x78,0x4,0x66,0x69,0x6e,0x64,0xc1,0x46,0x90,0x23,0x86,0x55,0x86,0x55,0x86,0x55,0xc1,0x2,0x42,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x56,0xc,0x86,0x57,0xae,0xc3,0xc4,0xc4,0xc4,0x86,0x58,0xe1,0x1,0xc7,0x5,0xc4,0x2,0xd3,0x0,0x22,0x84,0x7a,0xf,0xc1,0x46,0x24,0xc1,0x46,0x82,0xc1,0x46,0xdc,0xc1,0x46,0xf0,0xc1,0x46,0xe8,0x30,0x86,0x5b,0x86,0x5b,0xc0,0x86,0x5c,0x86,0x5c,0x86,0x5c,0xc0,0x86,0x5d,0x86,0x5d,0x86,0x5e,0x86,0x5e,0x86,0x5f,0x86,0x5f,0x86,0x5f,0x86,0x5e,0x86,0x5d,0xc1,0x2,0x40,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x60,0xc,0x86,0x61,0xe5,0x47,0xc3,0xc4,0x86,0x5a,0x83,0x0,0x86,0x62,0xe0,0x2,0xc9,0x1,0x0,0xc6,0x86,0x54,0xcf,0x0,0xc8,0x0,0x0,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xf1,0x2,0x2a,0xc9,0x2,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x86,0x59,0xd3,0xe1,0x3,0xc7,0x5,0xc4,0x1,0xcb,0x0,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0x16,0xcb,0x1,0xcb,0x0,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc1,0x47,0x36,0xc1,0x47,0x40,0xc1,0x47,0x68,0x27,0x86,0x64,0x86,0x64,0x86,0x65,0x86,0x65,0x86,0x66,0x86,0x66,0x86,0x64,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x67,0xc,0x24,0xe5,0x25,0xc3,0xc4,0xc4,0xc4,0x86,0x68,0xe1,0x3,0xc7,0x5,0xc4,0x1,0xe0,0x2,0xcf,0x0,0xc6,0x86,0x54,0xc9,0x1,0x0,0xc8,0x0,0x0,0xd3,0xe0,0x0,0xc9,0x1,0x0,0xc6,0x81,0x37,0xd3,0xd3,0x0,0x5,0x73,0x74,0x61,0x72,0x74,0x21,0x86,0x6a,0x21,0x86,0x6b,0xc1,0x46,0x2,0xc1,0x45,0xf4,0x27,0x86,0x6d,0x86,0x6e,0x86,0x6d,0xc0,0xc0,0xc0,0xc0,0xc1,0x2,0x3e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x6f,0xc,0x86,0x70,0xbf,0x86,0x54,0x86,0x6c,0xc4,0xc4,0x86,0x71,0xe1,0x1,0xc7,0x1d,0xc9,0x0,0x0,0xd3,0xe3,0x0,0xd0,0x86,0x63,0xd3,0xc0,0xe3,0x0,0xd0,0x86,0x69,0xd3,0xd4,0x0,0x8,0x69,0x73,0x53,0x74,0x72,0x69,0x6e,0x67,0xc1,0x48,0x0,0x22,0x86,0x74,0x86,0x74,0xc1,0x2,0x4c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x75,0xc,0x86,0x76,0xb3,0xc3,0xc4,0xc4,0xc4,0x86,0x77,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x86,0x51,0xc9,0x1,0x2,0xd3,0x0,0xc1,0x48,0x7c,0x22,0x86,0x79,0x86,0x79,0x64,0x7,0xc8,0x8,0xc3,0x9,0x86,0x7a,0xc,0x23,0xb0,0xc3,0xc4,0xc4,0xc4,0x86,0x7b,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x86,0x51,0xd3,0x0,0xc1,0x2,0x50,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x86,0x7d,0xaa,0xc3,0xc4,0xc4,0xc4,0x86,0x7e,0xc8,0x0,0x0,0x0,0xc1,0x49,0x3a,0x23,0x87,0x0,0x87,0x0,0x87,0x0,0xc1,0x2,0x52,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x1,0xc,0x87,0x2,0xae,0xc3,0xc4,0xc4,0xc4,0x87,0x3,0xe1,0x1,0xc7,0x5,0xc4,0x1,0xd3,0x0,0x7,0x70,0x72,0x6f,0x63,0x65,0x73,0x73,0xc1,0x47,0xd6,0xc1,0x47,0xc8,0xc1,0x47,0xb8,0xc1,0x47,0xea,0xc1,0x47,0xdc,0xc1,0x49,0x18,0xc1,0x49,0x4,0xc1,0x49,0x2e,0xc1,0x49,0x22,0xc1,0x49,0x5e,0x3e,0x87,0x6,0x87,0x6,0x87,0x7,0x87,0x8,0x87,0x7,0x87,0x9,0x87,0xa,0x87,0x9,0x87,0x6,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x87,0xb,0x87,0xb,0x87,0xc,0x87,0xc,0x87,0xc,0x87,0xd,0x87,0xd,0x87,0xe,0x87,0xe,0x87,0xd,0x87,0xb,0xc0,0x87,0xf,0x87,0xf,0xc1,0x2,0x4a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x10,0xc,0x87,0x11,0xe5,0x69,0x87,0x5,0x85,0x6c,0x85,0x6b,0x61,0x87,0x12,0xe1,0x2,0xc7,0x11,0xe1,0x1,0xc7,0x1e,0xc9,0x0,0x2,0xd3,0xe1,0x1,0xc7,0x1d,0xc9,0x0,0x2,0xd3,0xd3,0xe3,0x0,0xd0,0x86,0x78,0xd3,0xc9,0x0,0x2,0xe3,0x0,0xd0,0x86,0x7c,0xd3,0xc0,0xe3,0x0,0xd0,0x86,0x7f,0xd3,0xd4,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0x19,0xe1,0x1,0xc7,0x4,0xc9,0x0,0x1,0xd3,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x37,0xd3,0xc4,0x0,0xd3,0xd3,0xd0,0x87,0x4,0xd3,0xe0,0x1,0xc9,0x0,0x4,0xc6,0x81,0x35,0xcb,0x0,0xd3,0x0,0xc1,0x49,0xb0,0xc1,0x49,0xda,0xc1,0x49,0xe2,0x27,0x87,0x14,0x87,0x14,0x87,0x15,0x87,0x15,0x87,0x16,0x87,0x16,0x87,0x15,0xc1,0x2,0x58,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x17,0xc,0x87,0x18,0xbf,0xc3,0xc4,0xc4,0xc4,0x87,0x19,0xe1,0x1,0xc9,0x0,0x6,0xcf,0x0,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x0,0xc9,0x0,0x4,0xc6,0x82,0x2,0xd3,0xd3,0x0,0x5,0x73,0x6c,0x69,0x63,0x65,0xc1,0x4a,0xa8,0xc1,0x4a,0xb2,0xc1,0x4a,0xde,0x27,0x87,0x1c,0x87,0x1d,0x87,0x1d,0x87,0x1c,0x87,0x1e,0x87,0x1e,0x87,0x1e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x1f,0xc,0x25,0xe5,0x20,0xc3,0xc4,0xc4,0xc4,0x87,0x20,0xe1,0x1,0xc9,0x1,0x6,0xe0,0x2,0xcf,0x0,0xc6,0x87,0x1b,0xc8,0x0,0x0,0xc2,0xd3,0xd3,0xe1,0x1,0xc7,0x5,0xc4,0x1,0xd3,0x0,0xc1,0x4b,0xfe,0xc1,0x4c,0x8,0xc1,0x4c,0x12,0xc1,0x4c,0x44,0x2a,0x87,0x22,0x87,0x23,0x87,0x24,0x87,0x24,0x87,0x24,0x87,0x23,0x87,0x22,0x87,0x25,0x87,0x25,0x87,0x25,0xc1,0x2,0x6e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x26,0xc,0x87,0x27,0xe5,0x28,0xc3,0xc4,0xc4,0xc4,0x87,0x28,0xe1,0x1,0xc9,0x2,0x6,0xe0,0x2,0xcf,0x1,0xc6,0x87,0x1b,0xe1,0x2,0xc7,0xf,0xc9,0x1,0x0,0xc9,0x1,0x1,0xd3,0xc2,0xd3,0xd3,0xe1,0x1,0xc7,0x5,0xc4,0x2,0xd3,0x0,0x4,0x67,0x6f,0x74,0x6f,0xc1,0x4b,0x44,0xc1,0x4b,0x4e,0xc1,0x4b,0x64,0xc1,0x4b,0x9a,0xc1,0x4b,0xb4,0xc1,0x4b,0xa8,0xc1,0x4b,0xc6,0xc1,0x4c,0x72,0xc1,0x4c,0x7c,0xc1,0x4c,0x86,0x3c,0x87,0x2b,0x87,0x2c,0x87,0x2d,0x87,0x2d,0x87,0x2d,0x87,0x2c,0x87,0x2b,0xc0,0x87,0x2e,0x87,0x2e,0x87,0x2f,0x87,0x2f,0x87,0x30,0x87,0x30,0x87,0x31,0x87,0x31,0x87,0x31,0x87,0x2f,0x87,0x2e,0xc0,0x87,0x32,0x87,0x32,0x87,0x33,0x87,0x34,0x87,0x34,0x87,0x34,0x87,0x33,0x87,0x32,0xc1,0x2,0x6a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x35,0xc,0x87,0x36,0xe5,0x64,0xc3,0xc4,0xc4,0xc4,0x87,0x37,0xe1,0x1,0xc9,0x1,0x6,0xe0,0x2,0xcf,0x0,0xc6,0x87,0x1b,0xc8,0x0,0x0,0xe1,0x2,0xc7,0x16,0xc9,0x0,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xf1,0x2,0x2a,0xc9,0x2,0x0,0xe1,0x2,0xc7,0x19,0xc9,0x1,0x3,0xe1,0x2,0xc7,0xe,0xe0,0x0,0xc9,0x1,0x4,0xc6,0x81,0x37,0xd3,0xe1,0x2,0xc7,0x16,0xc9,0x1,0x3,0xc4,0x1,0xd3,0xd3,0xd3,0xd0,0x87,0x29,0xd3,0xe1,0x2,0xc7,0x1f,0xc4,0x1,0xe1,0x1,0xc9,0x1,0x7,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x0,0xc9,0x0,0x1,0xd3,0xd3,0xd3,0x0,0x3,0x65,0x6e,0x64,0x22,0x87,0x39,0x83,0xb,0xc1,0x4a,0x4a,0xc1,0x4a,0x70,0xc1,0x4b,0xa,0x2c,0x87,0x3b,0x87,0x3b,0xc0,0x87,0x3c,0x87,0x3c,0x87,0x3c,0xc0,0xc0,0x87,0x3d,0x87,0x3d,0x87,0x3d,0xc0,0xc1,0x2,0x60,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x3e,0xc,0x87,0x3f,0xe5,0x3c,0x51,0x86,0x6c,0x87,0x3a,0x83,0x0,0x87,0x40,0xe1,0x1,0xc9,0x0,0x5,0xca,0x0,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x87,0x21,0xd3,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0xe,0xcb,0x0,0xca,0x0,0xd3,0xd0,0x87,0x38,0xd3,0x0,0x6,0x5f,0x73,0x70,0x6c,0x69,0x74,0x2,0x6f,0x6e,0x21,0x87,0x43,0x21,0x87,0x44,0x5,0x65,0x6d,0x70,0x74,0x79,0x28,0x87,0x43,0x87,0x46,0x86,0x51,0x86,0x52,0x82,0x4,0x86,0x54,0x87,0x5,0x51,0x28,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0x44,0x6c,0xc1,0x44,0xc4,0xc1,0x44,0xbc,0xc1,0x44,0xce,0xc1,0x44,0xfe,0xc1,0x45,0x46,0xc1,0x45,0x78,0xc1,0x45,0xac,0xc1,0x45,0xa2,0xc1,0x49,0x84,0xc1,0x4c,0xa4,0xc1,0x4c,0xc0,0xc1,0x4c,0xc8,0x3d,0x87,0x49,0x87,0x49,0x87,0x49,0x87,0x4a,0x87,0x4b,0x87,0x4c,0x87,0x4c,0x87,0x4d,0x87,0x4d,0x87,0x4a,0x87,0x4e,0x87,0x4e,0x87,0x4f,0x87,0x4f,0x87,0x50,0x87,0x51,0x87,0x50,0xc0,0x87,0x52,0x87,0x52,0x87,0x52,0xc0,0x87,0x53,0x87,0x53,0x87,0x54,0x87,0x54,0x87,0x55,0x87,0x55,0x87,0x54,0xc1,0x2,0x2c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x56,0xc,0x87,0x57,0xe5,0x81,0xb,0x87,0x42,0x87,0x45,0x87,0x47,0x87,0x48,0x87,0x58,0xe1,0x2,0xc7,0x11,0xca,0x0,0xc6,0x86,0x4f,0xd3,0xd1,0x0,0xe1,0x3,0xc7,0x3,0xe0,0x1,0xcc,0xc6,0x83,0x21,0xc6,0x86,0x50,0xd3,0xe0,0x1,0xcc,0xc6,0x18,0xc6,0x86,0x50,0xd3,0xc0,0xd3,0xd1,0x1,0xe0,0x1,0xcc,0xc6,0x18,0xc6,0x86,0x51,0xd3,0xd1,0x2,0xe0,0x1,0xcc,0xc6,0x18,0xc6,0x86,0x52,0xd3,0xd1,0x3,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x70,0xd3,0xd1,0x4,0xd0,0x86,0x72,0xd1,0x5,0xd0,0x87,0x13,0xd1,0x6,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xcb,0x0,0xc6,0x86,0x23,0xd3,0xd0,0x87,0x1a,0xd3,0xd0,0x87,0x41,0xd1,0x7,0xe1,0x1,0xcb,0x7,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe0,0x0,0xcb,0x4,0xc6,0x82,0x2,0xd3,0xd3,0x0,0xc1,0x4e,0x4,0x23,0x87,0x5a,0x87,0x5a,0x87,0x5a,0xc1,0x2,0x82,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x5b,0xc,0x87,0x5c,0xae,0xc3,0xc4,0xc4,0xc4,0x87,0x5d,0xe1,0x1,0xc7,0x5,0xc4,0x1,0xd3,0x0,0x1b,0x74,0x69,0x6d,0x65,0x73,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0xc1,0x4e,0x7a,0xc1,0x4e,0x70,0x23,0x87,0x60,0x87,0x61,0x87,0x60,0xc1,0x2,0x86,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x62,0xc,0x87,0x63,0xaf,0xc3,0xc4,0xc4,0xc4,0x87,0x64,0xe1,0x1,0xc7,0x7,0xc6,0x87,0x5f,0xd3,0x0,0xc1,0x4f,0x1e,0x23,0x87,0x66,0x87,0x66,0x87,0x66,0xc1,0x2,0x8e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x67,0xc,0x87,0x68,0xae,0xc3,0xc4,0xc4,0xc4,0x87,0x69,0xe1,0x1,0xc7,0x5,0xc4,0x2,0xd3,0x0,0xc1,0x4f,0xc,0xc1,0x4f,0x68,0x2a,0xc0,0x87,0x6b,0x87,0x6b,0x87,0x6b,0xc0,0xc0,0xc0,0xc0,0x87,0x6c,0x87,0x6c,0xc1,0x2,0x8c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x6d,0xc,0x87,0x6e,0xe5,0x31,0xc3,0xc4,0xc4,0xc4,0x87,0x6f,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0xe,0xc9,0x0,0x1,0xcf,0x0,0xd3,0xd0,0x87,0x6a,0xd3,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xd9,0x0,0x1,0xe1,0x1,0xc9,0x0,0x0,0xc9,0x0,0x1,0xd3,0x0,0x6,0x5f,0x74,0x69,0x6d,0x65,0x73,0x22,0x0,0x82,0x4f,0xc1,0x4d,0xf8,0xc1,0x4e,0x40,0xc1,0x4e,0x32,0xc1,0x4e,0x5a,0xc1,0x4e,0xe2,0x32,0xc0,0x87,0x73,0x87,0x73,0x87,0x73,0xc0,0x87,0x74,0x87,0x74,0x87,0x75,0x87,0x75,0x87,0x74,0xc0,0x87,0x76,0x87,0x76,0x87,0x76,0xc0,0x87,0x77,0x87,0x77,0x87,0x77,0xc1,0x2,0x80,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x78,0xc,0x87,0x79,0xe5,0x4a,0x87,0x71,0x81,0x5b,0x87,0x72,0x82,0x51,0x87,0x7a,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xd,0xce,0xc4,0x0,0xd3,0xd0,0x87,0x5e,0xd3,0xe1,0x2,0xc7,0x11,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x87,0x65,0xd3,0xc4,0x0,0xd6,0x1,0xf1,0x1,0x1,0xc7,0x8,0xd0,0x87,0x70,0xd3,0x0,0x13,0x74,0x6f,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0xc1,0x50,0xc6,0xc1,0x50,0xbc,0x23,0x87,0x7d,0x87,0x7e,0x87,0x7d,0xc1,0x2,0x9c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x87,0x7f,0xc,0x88,0x0,0xaf,0xc3,0xc4,0xc4,0xc4,0x88,0x1,0xe1,0x1,0xc7,0x7,0xc6,0x87,0x7c,0xd3,0x0,0x18,0x74,0x6f,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0xc1,0x51,0x5c,0xc1,0x51,0x52,0x23,0x88,0x4,0x88,0x5,0x88,0x4,0xc1,0x2,0xa0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x6,0xc,0x88,0x7,0xaf,0xc3,0xc4,0xc4,0xc4,0x88,0x8,0xe1,0x1,0xc7,0x7,0xc6,0x88,0x3,0xd3,0x0,0x5,0x6d,0x75,0x6c,0x74,0x69,0xc1,0x51,0xde,0xc1,0x51,0xd4,0xc1,0x51,0xea,0x26,0x88,0xb,0x88,0xc,0x88,0xd,0x88,0xd,0x88,0xd,0x88,0xb,0xc1,0x2,0xa4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0xe,0xc,0x88,0xf,0xb8,0xc3,0xc4,0xc4,0xc4,0x88,0x10,0xe1,0x2,0xc7,0x20,0xe1,0x2,0xc7,0x16,0xcf,0x0,0xc4,0x1,0xd3,0xc8,0x0,0x0,0xd3,0x0,0xc1,0x52,0x44,0xc1,0x52,0x3a,0xc1,0x52,0x4c,0x26,0x88,0x12,0x88,0x13,0x88,0x14,0x88,0x14,0x88,0x14,0x88,0x12,0xc1,0x2,0xa6,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x15,0xc,0x88,0x16,0xb8,0xc3,0xc4,0xc4,0xc4,0x88,0x17,0xe1,0x2,0xc7,0x20,0xe1,0x2,0xc7,0x16,0xc8,0x0,0x0,0xc4,0x1,0xd3,0xcf,0x0,0xd3,0x0,0xc1,0x52,0xca,0x23,0x88,0x19,0x88,0x19,0x88,0x19,0xc1,0x2,0xae,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x1a,0xc,0x88,0x1b,0xae,0xc3,0xc4,0xc4,0xc4,0x88,0x1c,0xe1,0x1,0xc7,0x5,0xc4,0x2,0xd3,0x0,0xc1,0x52,0xbc,0xc1,0x53,0x14,0x2a,0xc0,0x88,0x1e,0x88,0x1e,0x88,0x1e,0xc0,0xc0,0xc0,0xc0,0x88,0x1f,0x88,0x1f,0xc1,0x2,0xac,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x20,0xc,0x88,0x21,0xe5,0x32,0xc3,0xc4,0xc4,0xc4,0x88,0x22,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0xe,0xc9,0x0,0x3,0xc9,0x0,0x2,0xd3,0xd0,0x88,0x1d,0xd3,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x3,0xc4,0x1,0xd3,0xd9,0x0,0x3,0xe1,0x1,0xc9,0x0,0x0,0xc9,0x0,0x3,0xd3,0x0,0x3,0x5f,0x74,0x6f,0x2,0x74,0x6f,0x21,0x88,0x25,0x22,0x88,0x26,0x81,0x5a,0x24,0x0,0x82,0x1a,0x88,0x25,0x82,0x4f,0x24,0xc1,0xc1,0xc1,0xc2,0xc1,0x50,0x98,0xc1,0x50,0xb0,0xc1,0x50,0xa0,0xc1,0x51,0x22,0xc1,0x51,0x14,0xc1,0x51,0x3c,0xc1,0x51,0xc2,0xc1,0x52,0x92,0x3c,0xc0,0x88,0x2a,0x88,0x2a,0x88,0x2b,0x88,0x2c,0x88,0x2b,0x88,0x2a,0xc0,0x88,0x2d,0x88,0x2d,0x88,0x2e,0x88,0x2e,0x88,0x2d,0xc0,0x88,0x2f,0x88,0x2f,0x88,0x2f,0xc0,0x88,0x30,0x88,0x30,0x88,0x30,0xc0,0xc0,0xc0,0xc0,0x88,0x31,0x88,0x31,0x88,0x31,0xc1,0x2,0x9a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x32,0xc,0x88,0x33,0xe5,0x6a,0x88,0x24,0x88,0x27,0x88,0x28,0x88,0x29,0x88,0x34,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xe1,0x1,0xc7,0x1a,0xca,0x0,0xd3,0xd3,0xd0,0x88,0x2,0xd3,0xe1,0x2,0xc7,0x11,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x1,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x88,0x9,0xd3,0xe1,0x2,0xc7,0xd,0xce,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x88,0x11,0xd3,0xc0,0xe3,0x0,0xd0,0x88,0x18,0xd3,0xd4,0xd2,0x0,0x1,0xd2,0x1,0x2,0xcb,0x1,0xd6,0x3,0xf1,0x1,0x1,0xc7,0x8,0xd0,0x88,0x23,0xd3,0x0,0x8,0x5f,0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x3,0x49,0x6e,0x74,0x8,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0xc1,0x54,0x4,0x23,0x88,0x39,0x88,0x39,0x88,0x39,0xc1,0x2,0xbe,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x3a,0xc,0x88,0x3b,0xb1,0xc3,0xc4,0xc4,0xc4,0x88,0x3c,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc8,0x0,0x0,0xd3,0x0,0x5,0x69,0x73,0x42,0x69,0x6e,0xc1,0x54,0x38,0xc1,0x54,0x3c,0x25,0x88,0x3f,0x88,0x3f,0x88,0x40,0x88,0x40,0x88,0x3f,0xc1,0x2,0xc0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x41,0xc,0x88,0x42,0xb6,0xc3,0xc4,0xc4,0xc4,0x88,0x43,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0x8,0x69,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0xa,0x72,0x65,0x61,0x64,0x53,0x74,0x72,0x69,0x6e,0x67,0xc1,0x54,0x84,0xc1,0x54,0x88,0x25,0x88,0x47,0x88,0x47,0x88,0x48,0x88,0x48,0x88,0x47,0xc1,0x2,0xc2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x49,0xc,0x88,0x4a,0xb7,0xc3,0xc4,0xc4,0xc4,0x88,0x4b,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x88,0x46,0xd3,0xd3,0x0,0x6,0x69,0x73,0x43,0x68,0x61,0x72,0xc1,0x54,0xd0,0xc1,0x54,0xd4,0x25,0x88,0x4e,0x88,0x4e,0x88,0x4f,0x88,0x4f,0x88,0x4e,0xc1,0x2,0xc4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x50,0xc,0x88,0x51,0xb6,0xc3,0xc4,0xc4,0xc4,0x88,0x52,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0xd3,0x0,0x4,0x43,0x68,0x61,0x72,0xc1,0x55,0x1c,0xc1,0x55,0x2c,0xc1,0x55,0x26,0xc1,0x55,0x1e,0x28,0x88,0x55,0x88,0x55,0x88,0x56,0x88,0x57,0x88,0x58,0x88,0x57,0x88,0x56,0x88,0x55,0xc1,0x2,0xc6,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x59,0xc,0x88,0x5a,0xbb,0xc3,0xc4,0xc4,0xc4,0x88,0x5b,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x0,0xe1,0x1,0xc7,0x26,0xc8,0x0,0x0,0xd3,0xc6,0x6,0xd3,0xd3,0x0,0x7,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x3,0x6d,0x61,0x70,0x4,0x6a,0x6f,0x69,0x6e,0xc1,0x55,0x8c,0xc1,0x55,0xc0,0xc1,0x55,0xac,0xc1,0x55,0x90,0x29,0x88,0x60,0x88,0x60,0x88,0x61,0x88,0x62,0x88,0x63,0x88,0x63,0x88,0x62,0x88,0x61,0x88,0x60,0xc1,0x2,0xc8,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x64,0xc,0x88,0x65,0xe5,0x27,0xc3,0xc4,0xc4,0xc4,0x88,0x66,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x0,0xe0,0x1,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x88,0x5d,0xc0,0xd3,0xc6,0x88,0x5e,0xc9,0x1,0x22,0xd3,0xc6,0x88,0x5f,0xd3,0xd3,0x0,0x4,0x5f,0x73,0x74,0x72,0x1,0x6f,0x21,0x88,0x69,0x21,0x88,0x6a,0xc1,0x53,0xee,0xc1,0x53,0xde,0xc1,0x54,0x22,0xc1,0x54,0x18,0xc1,0x54,0x6e,0xc1,0x54,0x5e,0xc1,0x54,0xba,0xc1,0x54,0xae,0xc1,0x55,0x6,0xc1,0x54,0xf6,0xc1,0x55,0x62,0xc1,0x55,0x5a,0xc1,0x55,0x4e,0xc1,0x55,0x76,0xc1,0x55,0x68,0xc1,0x55,0xe0,0xe1,0x2a,0xc0,0x88,0x6c,0x88,0x6d,0x88,0x6c,0xc0,0xc0,0x88,0x6e,0x88,0x6f,0x88,0x6e,0xc0,0xc0,0x88,0x70,0x88,0x71,0x88,0x70,0xc0,0xc0,0x88,0x72,0x88,0x73,0x88,0x72,0xc0,0xc0,0x88,0x74,0x88,0x75,0x88,0x74,0xc0,0xc0,0x88,0x76,0x88,0x76,0x88,0x77,0x88,0x78,0x88,0x77,0x88,0x79,0x88,0x7a,0x88,0x79,0x88,0x76,0xc0,0x88,0x7b,0x88,0x7b,0xc0,0xc0,0xc0,0x88,0x7b,0xc1,0x2,0xbc,0x64,0x7,0xc8,0x8,0xc3,0x9,0x88,0x7c,0xc,0x88,0x7d,0xe5,0x81,0x9,0x88,0x68,0x88,0x6b,0xc4,0xc4,0x88,0x7e,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x1e,0xca,0x0,0xd3,0xd0,0x88,0x3d,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x23,0xca,0x0,0xd3,0xd0,0x88,0x44,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x24,0xca,0x0,0xd3,0xd0,0x88,0x4c,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x25,0xca,0x0,0xd3,0xd0,0x88,0x53,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x1a,0xca,0x0,0xd3,0xd0,0x88,0x5c,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0x11,0xe1,0x1,0xc7,0x1c,0xca,0x0,0xd3,0xe1,0x1,0xc7,0x17,0xca,0x0,0xd3,0xd3,0xd0,0x88,0x67,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe1,0x1,0xc7,0x2,0xca,0x0,0xd3,0xd3,0x0,0xc1,0x56,0x54,0x23,0x89,0x0,0x89,0x0,0x89,0x0,0xc1,0x2,0xd2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x1,0xc,0x89,0x2,0xb1,0xc3,0xc4,0xc4,0xc4,0x89,0x3,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc9,0x0,0x0,0xd3,0x0,0x4,0x72,0x65,0x70,0x72,0xc1,0x56,0x20,0xc1,0x56,0x6a,0xc1,0x56,0x62,0x27,0x89,0x6,0x89,0x6,0xc0,0xc0,0x89,0x7,0x89,0x8,0x89,0x7,0xc1,0x2,0xce,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x9,0xc,0x89,0xa,0xe5,0x25,0x6,0x88,0x6b,0x85,0x6b,0x61,0x89,0xb,0xe8,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xcb,0x0,0xd0,0x89,0x4,0xd3,0xe1,0x1,0xc7,0x27,0xca,0x0,0xd3,0x0,0x14,0x5f,0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x5f,0x63,0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,0x6,0x53,0x74,0x72,0x69,0x6e,0x67,0xc1,0x58,0xd8,0x23,0x89,0xf,0x89,0xf,0x89,0xf,0xc1,0x2,0xe2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x10,0xc,0x89,0x11,0xb1,0xc3,0xc4,0xc4,0xc4,0x89,0x12,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc6,0x86,0x23,0xd3,0x0,0xc1,0x59,0x1a,0xc1,0x59,0x24,0xc1,0x59,0x2e,0x27,0x89,0x14,0x89,0x14,0x89,0x15,0x89,0x16,0x89,0x16,0x89,0x15,0x89,0x14,0xc1,0x2,0xe4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x17,0xc,0x89,0x18,0xbd,0xc3,0xc4,0xc4,0xc4,0x89,0x19,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe1,0x1,0xc9,0x2,0x22,0xe0,0x1,0xcd,0x0,0xc6,0x18,0xc4,0x1,0xd3,0xd3,0xd3,0x0,0x1,0x61,0x21,0x89,0x1b,0x21,0x89,0x1c,0xc1,0x59,0x8e,0xc1,0x59,0xa0,0x24,0x89,0x1e,0x89,0x1f,0x89,0x1f,0x89,0x1e,0xc1,0x2,0xe8,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x20,0xc,0x89,0x21,0xb9,0xc3,0x89,0x1d,0xc4,0xc4,0x89,0x22,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x81,0x35,0xe1,0x1,0xc9,0x2,0x22,0xca,0x0,0xd3,0xd3,0x0,0xc1,0x58,0xc0,0xc1,0x58,0xb4,0xc1,0x59,0x2,0xc1,0x58,0xf6,0xc1,0x59,0x56,0xc1,0x59,0x4c,0xc1,0x59,0x70,0xc1,0x59,0xb8,0x35,0xc0,0x89,0x24,0x89,0x24,0x89,0x25,0x89,0x25,0x89,0x24,0xc0,0xc0,0x89,0x26,0x89,0x26,0x89,0x27,0x89,0x27,0x89,0x26,0xc0,0x89,0x28,0x89,0x29,0x89,0x28,0x89,0x2a,0x89,0x2a,0x89,0x2b,0x89,0x2b,0xc1,0x2,0xe0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x2c,0xc,0x89,0x2d,0xe5,0x56,0x89,0xe,0xc4,0x85,0x4b,0x61,0x89,0x2e,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xcc,0xc6,0x81,0x37,0xd3,0xc4,0x0,0xd3,0xd0,0x89,0x13,0xd3,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xcc,0xc6,0x81,0x37,0xd3,0xc4,0x1,0xd3,0xd0,0x89,0x1a,0xd3,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x70,0xd3,0xd1,0x0,0xf0,0x1,0x1,0xcc,0xc6,0x83,0x44,0xd0,0x89,0x23,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x5f,0xd3,0x0,0x21,0x89,0xe,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x89,0x2d,0xad,0xc3,0xc4,0x89,0x30,0x61,0x89,0x31,0xd0,0x89,0x2f,0xd1,0x0,0x0,0xf,0x5f,0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0xc1,0x5b,0x76,0x22,0x89,0x34,0x89,0x34,0xc1,0x2,0xf8,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x35,0xc,0x89,0x36,0xb2,0xc3,0xc4,0xc4,0xc4,0x89,0x37,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x81,0x35,0xcf,0x0,0xd3,0x0,0xc1,0x5b,0x4c,0xc1,0x5b,0x42,0xc1,0x5b,0x60,0xc1,0x5b,0x9a,0x27,0x89,0x39,0x89,0x3a,0x89,0x39,0x89,0x3b,0x89,0x3b,0x89,0x3c,0x89,0x3c,0xc1,0x2,0xf4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x3d,0xc,0x89,0x3e,0xe5,0x2b,0x85,0x2d,0x85,0x34,0x85,0x4b,0x61,0x89,0x3f,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x70,0xd3,0xd1,0x0,0xf0,0x1,0x1,0xca,0x0,0xc6,0x85,0x2d,0xd0,0x89,0x38,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x88,0x5f,0xc6,0x86,0x23,0xd3,0x0,0x21,0x85,0x2d,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x89,0x3e,0xad,0xc3,0xc4,0x89,0x41,0x61,0x89,0x42,0xd0,0x89,0x40,0xd1,0x0,0x0,0x3,0x42,0x69,0x6e,0x5,0x73,0x70,0x6c,0x69,0x74,0x7,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0xc1,0x60,0x5e,0x23,0x89,0x47,0x89,0x47,0x89,0x47,0xc1,0x3,0x18,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x48,0xc,0x89,0x49,0xb0,0xc3,0xc4,0xc4,0xc4,0x89,0x4a,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xcf,0x0,0xd3,0x0,0xc1,0x60,0xae,0x23,0x89,0x4c,0x89,0x4c,0x89,0x4c,0xc1,0x3,0x1a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x4d,0xc,0x89,0x4e,0xb0,0xc3,0xc4,0xc4,0xc4,0x89,0x4f,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xcf,0x0,0xd3,0x0,0x21,0x82,0x1a,0x22,0x89,0x51,0x88,0x26,0xc1,0x60,0x46,0xc1,0x60,0x3a,0xc1,0x60,0x78,0xc1,0x60,0x88,0xc1,0x60,0xce,0xc1,0x60,0xf0,0xc1,0x60,0xd8,0x35,0xc0,0x89,0x53,0x89,0x53,0x89,0x54,0x89,0x54,0x89,0x53,0xc0,0xc0,0x89,0x55,0x89,0x55,0x89,0x56,0x89,0x56,0x89,0x55,0xc0,0x89,0x57,0x89,0x57,0x89,0x58,0x89,0x59,0x89,0x59,0x89,0x58,0x89,0x57,0xc1,0x3,0x16,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x5a,0xc,0x89,0x5b,0xe5,0x52,0x89,0x46,0x89,0x52,0xc4,0xc4,0x89,0x5c,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xca,0x0,0xc6,0x81,0x37,0xd3,0xc4,0x0,0xd3,0xd0,0x89,0x4b,0xd3,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x1,0xc7,0x4,0xe0,0x1,0xce,0xc6,0x86,0x54,0xca,0x0,0xd3,0xd3,0xd0,0x89,0x50,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe0,0x1,0xe0,0x1,0xce,0xc6,0x89,0x45,0xca,0x0,0xd3,0xc6,0x88,0x5f,0xca,0x1,0xd3,0xd3,0x0,0x21,0x89,0x46,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x89,0x5b,0xad,0xc3,0xc4,0x89,0x5e,0x61,0x89,0x5f,0xd0,0x89,0x5d,0xd1,0x0,0x0,0x4,0x41,0x72,0x67,0x73,0x6,0x72,0x65,0x64,0x75,0x63,0x65,0x6,0x66,0x69,0x6c,0x74,0x65,0x72,0x3,0x53,0x65,0x74,0x4,0x4c,0x69,0x73,0x74,0x4,0x6d,0x65,0x61,0x6e,0x6,0x6d,0x65,0x64,0x69,0x61,0x6e,0x3,0x4d,0x61,0x70,0xc1,0x69,0x6e,0xc1,0x69,0x64,0x23,0x89,0x69,0x89,0x6a,0x89,0x69,0xc1,0x3,0x5c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x6b,0xc,0x89,0x6c,0xaf,0xc3,0xc4,0xc4,0xc4,0x89,0x6d,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x41,0xd3,0x0,0x4,0x6b,0x65,0x79,0x73,0x1,0x6b,0x21,0x89,0x70,0x22,0x89,0x71,0x85,0x33,0xc1,0x69,0xec,0xc1,0x69,0xfc,0x24,0x89,0x73,0x89,0x74,0x89,0x74,0x89,0x73,0xc1,0x3,0x5e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x75,0xc,0x89,0x76,0xbb,0xc3,0x89,0x72,0xc4,0xc4,0x89,0x77,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xe0,0x1,0xcf,0x0,0xc6,0x18,0xca,0x0,0xd3,0xca,0x1,0xd3,0x0,0xc1,0x69,0x34,0xc1,0x69,0x26,0xc1,0x69,0x4e,0xc1,0x69,0xc4,0xc1,0x69,0xba,0x2e,0x89,0x79,0x89,0x79,0x89,0x7a,0x89,0x7a,0x89,0x79,0xc0,0x89,0x7b,0x89,0x7b,0x89,0x7b,0xc0,0x89,0x7c,0x89,0x7d,0x89,0x7d,0x89,0x7c,0xc1,0x3,0x58,0x64,0x7,0xc8,0x8,0xc3,0x9,0x89,0x7e,0xc,0x89,0x7f,0xe5,0x3a,0x83,0x44,0x81,0x5b,0x1,0x61,0x8a,0x0,0xe1,0x2,0xc7,0x11,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x89,0x6e,0xd3,0xf0,0x1,0x1,0xe0,0x0,0xce,0xc6,0x89,0x6f,0xd3,0xc6,0x83,0x44,0xd0,0x89,0x78,0xd3,0x0,0x21,0x83,0x44,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x89,0x7f,0xad,0xc3,0xc4,0x8a,0x2,0x61,0x8a,0x3,0xd0,0x8a,0x1,0xd1,0x0,0x0,0xc1,0x6a,0xd0,0xc1,0x6a,0xc6,0x23,0x8a,0x5,0x8a,0x6,0x8a,0x5,0xc1,0x3,0x66,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x7,0xc,0x8a,0x8,0xaf,0xc3,0xc4,0xc4,0xc4,0x8a,0x9,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x68,0xd3,0x0,0xc1,0x6b,0x4a,0xc1,0x6b,0x5a,0x24,0x8a,0xb,0x8a,0xc,0x8a,0xc,0x8a,0xb,0xc1,0x3,0x68,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0xd,0xc,0x8a,0xe,0xbb,0xc3,0x89,0x72,0xc4,0xc4,0x8a,0xf,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xe0,0x1,0xcf,0x0,0xc6,0x18,0xca,0x0,0xd3,0xca,0x1,0xd3,0x0,0xc1,0x6a,0x96,0xc1,0x6a,0x88,0xc1,0x6a,0xb0,0xc1,0x6b,0x24,0xc1,0x6b,0x1a,0x2e,0x8a,0x11,0x8a,0x11,0x8a,0x12,0x8a,0x12,0x8a,0x11,0xc0,0x8a,0x13,0x8a,0x13,0x8a,0x13,0xc0,0x8a,0x14,0x8a,0x15,0x8a,0x15,0x8a,0x14,0xc1,0x3,0x62,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x16,0xc,0x8a,0x17,0xe5,0x3a,0x88,0x5e,0x81,0x5b,0x1,0x61,0x8a,0x18,0xe1,0x2,0xc7,0x11,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x8a,0xa,0xd3,0xf0,0x1,0x1,0xe0,0x0,0xce,0xc6,0x89,0x6f,0xd3,0xc6,0x88,0x5e,0xd0,0x8a,0x10,0xd3,0x0,0x21,0x88,0x5e,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x8a,0x17,0xad,0xc3,0xc4,0x8a,0x1a,0x61,0x8a,0x1b,0xd0,0x8a,0x19,0xd1,0x0,0x0,0xc1,0x6c,0xc,0xc1,0x6c,0x2,0x23,0x8a,0x1d,0x8a,0x1e,0x8a,0x1d,0xc1,0x3,0x70,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x1f,0xc,0x8a,0x20,0xaf,0xc3,0xc4,0xc4,0xc4,0x8a,0x21,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x41,0xd3,0x0,0x6,0x4f,0x62,0x6a,0x65,0x63,0x74,0xc1,0x6c,0xb4,0xc1,0x6c,0xc8,0xc1,0x6c,0xbc,0x25,0x8a,0x24,0x8a,0x25,0x8a,0x26,0x8a,0x25,0x8a,0x24,0xc1,0x3,0x74,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x27,0xc,0x8a,0x28,0xbe,0xc3,0x89,0x72,0xc4,0xc4,0x8a,0x29,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xe0,0x2,0xc7,0x30,0xc6,0x18,0xc8,0x0,0x0,0xca,0x0,0xd3,0xca,0x1,0xd3,0x0,0xc,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x5f,0x65,0x61,0x63,0x68,0x1,0x6d,0x21,0x8a,0x2c,0x22,0x8a,0x2d,0x81,0x5a,0x22,0x0,0x89,0x6f,0xc1,0x6b,0xd2,0xc1,0x6b,0xc4,0xc1,0x6b,0xec,0xc1,0x6c,0x6a,0xc1,0x6c,0x5e,0xc1,0x6c,0x8c,0x2f,0x8a,0x30,0x8a,0x30,0x8a,0x31,0x8a,0x31,0x8a,0x30,0xc0,0x8a,0x32,0x8a,0x32,0x8a,0x32,0xc0,0x8a,0x33,0x8a,0x34,0x8a,0x33,0x8a,0x35,0x8a,0x35,0xc1,0x3,0x6c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x36,0xc,0x8a,0x37,0xe5,0x43,0x8a,0x2b,0x8a,0x2e,0x8a,0x2f,0x83,0x0,0x8a,0x38,0xe1,0x2,0xc7,0x11,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x1,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x8a,0x22,0xd3,0xe0,0x1,0xc7,0x30,0xc6,0x89,0x6f,0xca,0x0,0xd3,0xd1,0x1,0xf0,0x1,0x1,0xcb,0x1,0xc6,0x83,0x44,0xd0,0x8a,0x2a,0xd3,0x0,0xc1,0x6d,0x82,0xc1,0x6d,0x78,0x23,0x8a,0x3a,0x8a,0x3b,0x8a,0x3a,0xc1,0x3,0x7c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x3c,0xc,0x8a,0x3d,0xaf,0xc3,0xc4,0xc4,0xc4,0x8a,0x3e,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x68,0xd3,0x0,0xc1,0x6e,0x26,0xc1,0x6e,0x3a,0xc1,0x6e,0x2e,0x25,0x8a,0x40,0x8a,0x41,0x8a,0x42,0x8a,0x41,0x8a,0x40,0xc1,0x3,0x80,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x43,0xc,0x8a,0x44,0xbe,0xc3,0x89,0x72,0xc4,0xc4,0x8a,0x45,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xe0,0x2,0xc7,0x30,0xc6,0x18,0xc8,0x0,0x0,0xca,0x0,0xd3,0xca,0x1,0xd3,0x0,0xb,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x5f,0x6d,0x61,0x70,0xc1,0x6d,0x48,0xc1,0x6d,0x3a,0xc1,0x6d,0x62,0xc1,0x6d,0xde,0xc1,0x6d,0xd2,0xc1,0x6e,0x0,0x2f,0x8a,0x48,0x8a,0x48,0x8a,0x49,0x8a,0x49,0x8a,0x48,0xc0,0x8a,0x4a,0x8a,0x4a,0x8a,0x4a,0xc0,0x8a,0x4b,0x8a,0x4c,0x8a,0x4b,0x8a,0x4d,0x8a,0x4d,0xc1,0x3,0x78,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x4e,0xc,0x8a,0x4f,0xe5,0x43,0x8a,0x47,0x8a,0x2e,0x8a,0x2f,0x83,0x0,0x8a,0x50,0xe1,0x2,0xc7,0x11,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x1,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x8a,0x3f,0xd3,0xe0,0x1,0xc7,0x30,0xc6,0x89,0x6f,0xca,0x0,0xd3,0xd1,0x1,0xf0,0x1,0x1,0xcb,0x1,0xc6,0x88,0x5e,0xd0,0x8a,0x46,0xd3,0x0,0x1c,0x66,0x69,0x6c,0x74,0x65,0x72,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0xc1,0x6e,0xfa,0xc1,0x6e,0xf0,0x23,0x8a,0x53,0x8a,0x54,0x8a,0x53,0xc1,0x3,0x88,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x55,0xc,0x8a,0x56,0xaf,0xc3,0xc4,0xc4,0xc4,0x8a,0x57,0xe1,0x1,0xc7,0x7,0xc6,0x8a,0x52,0xd3,0x0,0x7,0x48,0x61,0x73,0x68,0x4d,0x61,0x70,0x8,0x74,0x6f,0x4f,0x62,0x6a,0x65,0x63,0x74,0xe,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,0xc1,0x6e,0xc0,0xc1,0x6e,0xb2,0xc1,0x6e,0xda,0xc1,0x6f,0x74,0xc1,0x6f,0x5e,0xc1,0x6f,0x50,0xc1,0x6f,0x42,0x31,0x8a,0x5c,0x8a,0x5c,0x8a,0x5d,0x8a,0x5d,0x8a,0x5c,0xc0,0x8a,0x5e,0x8a,0x5e,0x8a,0x5e,0xc0,0x8a,0x5f,0x8a,0x60,0x8a,0x61,0x8a,0x62,0x8a,0x61,0x8a,0x60,0x8a,0x5f,0xc1,0x3,0x84,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x63,0xc,0x8a,0x64,0xe5,0x41,0x8a,0x5b,0x8a,0x2e,0x1,0x61,0x8a,0x65,0xe1,0x2,0xc7,0x11,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x1,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x8a,0x58,0xd3,0xe0,0x0,0xe0,0x1,0xe0,0x1,0xc7,0x31,0xc6,0x81,0x70,0xca,0x0,0xd3,0xc6,0x89,0x63,0xca,0x1,0xd3,0xc6,0x8a,0x5a,0xd3,0x0,0xc1,0x71,0xce,0xc1,0x71,0xc4,0x23,0x8a,0x67,0x8a,0x68,0x8a,0x67,0xc1,0x3,0x9c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x69,0xc,0x8a,0x6a,0xaf,0xc3,0xc4,0xc4,0xc4,0x8a,0x6b,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x68,0xd3,0x0,0x23,0x89,0x71,0x81,0x2,0x85,0x33,0xc1,0x72,0x68,0xc1,0x72,0x7c,0x24,0x8a,0x6e,0x8a,0x6f,0x8a,0x6f,0x8a,0x6e,0xc1,0x3,0xa0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x70,0xc,0x8a,0x71,0xbd,0xc3,0x8a,0x6d,0xc4,0xc4,0x8a,0x72,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x81,0x35,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xca,0x1,0xca,0x2,0xd3,0xd3,0x0,0xc,0x5f,0x68,0x61,0x73,0x68,0x6d,0x61,0x70,0x5f,0x6d,0x61,0x70,0x22,0x0,0x82,0x4,0xc1,0x71,0x94,0xc1,0x71,0x86,0xc1,0x71,0xae,0xc1,0x72,0x26,0xc1,0x72,0x1c,0xc1,0x72,0x40,0xc1,0x72,0xa2,0x31,0x8a,0x76,0x8a,0x76,0x8a,0x77,0x8a,0x77,0x8a,0x76,0xc0,0x8a,0x78,0x8a,0x78,0x8a,0x78,0xc0,0x8a,0x79,0x8a,0x7a,0x8a,0x79,0x8a,0x7b,0x8a,0x7b,0x8a,0x7c,0x8a,0x7c,0xc1,0x3,0x98,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8a,0x7d,0xc,0x8a,0x7e,0xe5,0x48,0x8a,0x74,0x81,0x5b,0x8a,0x75,0x83,0x0,0x8a,0x7f,0xe1,0x2,0xc7,0x11,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x8a,0x6c,0xd3,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x70,0xd3,0xd1,0x1,0xf0,0x1,0x1,0xce,0xc6,0x83,0x44,0xd0,0x8a,0x73,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x82,0x2,0xd3,0x0,0xc1,0x74,0x16,0xc1,0x74,0xc,0x23,0x8b,0x1,0x8b,0x2,0x8b,0x1,0xc1,0x3,0xae,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x3,0xc,0x8b,0x4,0xaf,0xc3,0xc4,0xc4,0xc4,0x8b,0x5,0xe1,0x1,0xc7,0x7,0xc6,0x8a,0x52,0xd3,0x0,0x3,0x64,0x65,0x6c,0xc1,0x74,0xbe,0x22,0x8b,0x8,0x8b,0x8,0xc1,0x3,0xb0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x9,0xc,0x8b,0xa,0xb2,0xc3,0xc4,0xc4,0xc4,0x8b,0xb,0xe0,0x1,0xcf,0x0,0xc6,0x8b,0x7,0xc8,0x0,0x0,0xd3,0x0,0xc1,0x74,0x8e,0xc1,0x74,0xa0,0x27,0xc0,0x8b,0xd,0x8b,0xd,0x8b,0xe,0x8b,0xe,0x8b,0xd,0xc0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0xf,0xc,0x8b,0xa,0xe5,0x23,0xc3,0x8a,0x6d,0xc4,0xc4,0x8b,0x10,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x1,0xc7,0x4,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xca,0x1,0xca,0x2,0xd3,0xd3,0xd0,0x8b,0xc,0xd3,0x0,0xf,0x5f,0x68,0x61,0x73,0x68,0x6d,0x61,0x70,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,0xc1,0x73,0xdc,0xc1,0x73,0xce,0xc1,0x73,0xf6,0xc1,0x74,0x66,0xc1,0x74,0xe4,0x2f,0x8b,0x13,0x8b,0x13,0x8b,0x14,0x8b,0x14,0x8b,0x13,0xc0,0x8b,0x15,0x8b,0x15,0x8b,0x15,0xc0,0x8b,0x16,0x8b,0x16,0x8b,0x17,0x8b,0x17,0x8b,0x17,0xc1,0x3,0xaa,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x18,0xc,0x8b,0x19,0xe5,0x3c,0x8b,0x12,0x81,0x5b,0x1,0x61,0x8b,0x1a,0xe1,0x2,0xc7,0x11,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x8b,0x6,0xd3,0xf0,0x1,0x1,0xce,0xc6,0x83,0x44,0xd0,0x8b,0x11,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xce,0xd3,0x0,0x6,0x61,0x64,0x64,0x41,0x6c,0x6c,0xc1,0x7a,0x7e,0x22,0x8b,0x1d,0x8b,0x1d,0xc1,0x3,0xda,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x1e,0xc,0x8b,0x1f,0xae,0xc3,0xc4,0xc4,0xc4,0x8b,0x20,0xe1,0x1,0xc9,0x0,0x18,0xce,0xd3,0x0,0xb,0x49,0x64,0x65,0x6e,0x74,0x69,0x74,0x79,0x53,0x65,0x74,0x4,0x54,0x61,0x73,0x6b,0xa,0x73,0x74,0x61,0x63,0x6b,0x74,0x72,0x61,0x63,0x65,0x8,0x6e,0x61,0x6d,0x65,0x73,0x6d,0x61,0x70,0x5,0x73,0x74,0x61,0x63,0x6b,0x3,0x6d,0x73,0x67,0x5,0x63,0x6c,0x61,0x73,0x73,0x11,0x5f,0x65,0x72,0x72,0x6f,0x72,0x43,0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,0x21,0x8b,0x27,0x21,0x8b,0x2a,0x21,0x8b,0x26,0xc1,0x7c,0x9a,0xc1,0x7c,0x92,0xc1,0x7d,0x54,0xc1,0x7d,0x22,0xc1,0x7d,0x2,0xc1,0x7c,0xda,0xc1,0x7c,0xc8,0xc1,0x7d,0x46,0x2f,0x8b,0x2d,0x8b,0x2e,0x8b,0x2d,0x8b,0x2f,0x8b,0x30,0x8b,0x31,0x8b,0x32,0x8b,0x33,0x8b,0x33,0x8b,0x32,0x8b,0x31,0x8b,0x34,0x8b,0x34,0x8b,0x30,0x8b,0x2f,0xc1,0x3,0xea,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x35,0xc,0x8b,0x36,0xe5,0x49,0x8b,0x29,0x8b,0x2b,0x8b,0x2c,0x61,0x8b,0x37,0xe0,0x1,0xc7,0x33,0xc6,0x8b,0x24,0xc4,0x1,0xd3,0xd1,0x0,0xe0,0x0,0xe0,0x2,0xe0,0x2,0xe0,0x2,0xe0,0x0,0xcc,0xc6,0x8b,0x25,0xd3,0xc6,0x84,0x60,0xc6,0x8b,0x26,0xcb,0x0,0xd3,0xc6,0x84,0x60,0xc6,0x8b,0x27,0xca,0x0,0xd3,0xc6,0x84,0x60,0xc6,0x8b,0x28,0xe0,0x0,0xce,0xc6,0x8b,0x28,0xd3,0xd3,0xc6,0x8a,0x5a,0xd3,0x0,0x5,0x45,0x72,0x72,0x6f,0x72,0xd,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0xe,0x55,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x45,0x72,0x72,0x6f,0x72,0x8,0x5f,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x62,0x4a,0xc0,0x6,0xc0,0xc1,0x7e,0xec,0xc1,0x7e,0xe2,0x23,0x8b,0x3e,0x8b,0x3f,0x8b,0x3e,0xc1,0x3,0xfa,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x40,0xc,0x8b,0x41,0xad,0xc3,0xc4,0xc4,0xc4,0x8b,0x42,0xe1,0x1,0xc7,0x7,0xce,0xd3,0x0,0x7,0x45,0x72,0x72,0x6f,0x72,0x3a,0x20,0x1,0xa,0x7,0x73,0x74,0x61,0x63,0x6b,0x3a,0x20,0x4,0x74,0x61,0x73,0x6b,0xc1,0x80,0xd4,0x26,0x8b,0x48,0x8b,0x48,0x8b,0x48,0x8b,0x48,0x8b,0x48,0x8b,0x48,0xc1,0x4,0xa,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x49,0xc,0x8b,0x4a,0xb5,0xc3,0xc4,0xc4,0xc4,0x8b,0x4b,0xe1,0x1,0xc7,0x9,0xe1,0x2,0xc7,0xa,0xc4,0x0,0xc4,0x1,0xd3,0xd3,0x0,0x5,0x20,0x20,0x61,0x74,0x20,0x1,0x3a,0x4,0x66,0x69,0x6c,0x65,0x23,0x8b,0x4f,0x81,0x59,0xc,0x23,0xc1,0xc1,0xc1,0xc1,0x80,0x90,0xc1,0x80,0x84,0xc1,0x80,0xc0,0xc1,0x80,0xfc,0x2e,0x8b,0x52,0x8b,0x53,0x8b,0x53,0x8b,0x52,0xc0,0x8b,0x54,0x8b,0x54,0x8b,0x54,0xc0,0x8b,0x55,0x8b,0x55,0xc0,0xc0,0xc0,0xc1,0x4,0x6,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x56,0xc,0x8b,0x57,0xe5,0x5b,0xc3,0xc4,0x8b,0x50,0x8b,0x51,0x8b,0x58,0xe0,0x1,0xe0,0x0,0xcf,0x0,0xc6,0x8b,0x26,0xd3,0xc6,0x18,0xc9,0x0,0x1,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xd2,0x2,0x2,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x8b,0x4c,0xd3,0xe0,0x7,0xc9,0x0,0x0,0xc6,0x81,0x35,0xc6,0x8b,0x4d,0xcb,0x0,0xc6,0x8b,0x4e,0xcb,0x2,0xc6,0x86,0x4f,0xcb,0x1,0xc6,0x8b,0x45,0xd3,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xd9,0x0,0x1,0x0,0x2,0x24,0x78,0x22,0x86,0x11,0x8b,0x5a,0xc1,0x7f,0x40,0xc1,0x7f,0x36,0xc1,0x7f,0x5e,0xc1,0x7f,0x86,0xc1,0x7f,0xb2,0xc1,0x7f,0xe6,0xc1,0x7f,0xda,0xc1,0x80,0x36,0xc1,0x81,0x9c,0xc1,0x81,0xa2,0x35,0x8b,0x5c,0x8b,0x5d,0x8b,0x5c,0x8b,0x5e,0x8b,0x5f,0x8b,0x5f,0x8b,0x5e,0x8b,0x60,0x8b,0x61,0x8b,0x62,0x8b,0x62,0x8b,0x61,0x8b,0x60,0x8b,0x63,0x8b,0x63,0x8b,0x63,0x8b,0x64,0x8b,0x64,0x8b,0x65,0x8b,0x65,0x8b,0x64,0xc1,0x3,0xfc,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x66,0xc,0x8b,0x67,0xe5,0x5f,0xc3,0xc4,0x8b,0x5b,0x82,0x51,0x8b,0x68,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x70,0xd3,0xd1,0x0,0xe0,0x3,0xcb,0x0,0xc6,0x81,0x35,0xc6,0x8b,0x44,0xe0,0x0,0xce,0xc6,0x8b,0x27,0xd3,0xc6,0x8b,0x45,0xd3,0xe0,0x3,0xcb,0x0,0xc6,0x81,0x35,0xc6,0x8b,0x46,0xe0,0x0,0xe0,0x0,0xce,0xc6,0x8b,0x26,0xd3,0xc6,0x8b,0x47,0xd3,0xc6,0x8b,0x45,0xd3,0xc4,0x1,0xd6,0x1,0xf1,0x1,0x1,0xc7,0x8,0xd0,0x8b,0x59,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x5f,0xd3,0xd3,0x0,0xd,0x44,0x65,0x61,0x64,0x6c,0x6f,0x63,0x6b,0x45,0x72,0x72,0x6f,0x72,0xc1,0x82,0x22,0xc1,0x82,0x18,0x23,0x8b,0x6b,0x8b,0x6c,0x8b,0x6b,0xc1,0x4,0x16,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x6d,0xc,0x8b,0x6e,0xad,0xc3,0xc4,0xc4,0xc4,0x8b,0x6f,0xe1,0x1,0xc7,0x7,0xce,0xd3,0x0,0x6,0x73,0x74,0x61,0x63,0x6b,0x73,0xc1,0x84,0x7a,0x26,0x8b,0x72,0x8b,0x72,0x8b,0x72,0x8b,0x72,0x8b,0x72,0x8b,0x72,0xc1,0x4,0x28,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x73,0xc,0x8b,0x74,0xb7,0xc3,0xc4,0xc4,0xc4,0x8b,0x75,0xe1,0x1,0xc7,0x9,0xe1,0x3,0xc7,0xa,0xc4,0x0,0xc4,0x1,0xc4,0x2,0xd3,0xd3,0x0,0xc1,0x84,0x2e,0xc1,0x84,0x66,0xc1,0x84,0xaa,0x2c,0x8b,0x77,0x8b,0x77,0xc0,0x8b,0x78,0x8b,0x78,0x8b,0x78,0xc0,0x8b,0x79,0x8b,0x79,0xc0,0xc0,0xc0,0xc1,0x4,0x24,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8b,0x7a,0xc,0x8b,0x7b,0xe5,0x56,0xc3,0xc4,0x8b,0x50,0x8b,0x51,0x8b,0x7c,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x18,0xc9,0x0,0x0,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xd2,0x2,0x2,0xf1,0x2,0x2a,0xc9,0x2,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x8b,0x76,0xd3,0xe0,0x7,0xc9,0x1,0x0,0xc6,0x81,0x35,0xc6,0x8b,0x4d,0xcb,0x0,0xc6,0x8b,0x4e,0xcb,0x2,0xc6,0x86,0x4f,0xcb,0x1,0xc6,0x8b,0x45,0xd3,0xe1,0x2,0xc7,0xf,0xc9,0x0,0x0,0xc4,0x1,0xd3,0xd9,0x0,0x0,0x0,0x22,0x8b,0x2c,0x85,0x33,0x21,0x8b,0x5a,0xc1,0x83,0x3c,0xc1,0x83,0x76,0xc1,0x83,0xd6,0x27,0x8c,0x0,0x8c,0x1,0x8c,0x1,0x8c,0x0,0x8c,0x2,0x8c,0x2,0x8c,0x2,0xc1,0x4,0x1e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8c,0x3,0xc,0x8c,0x4,0xe5,0x33,0xc3,0x8b,0x7e,0x8b,0x7f,0x83,0x4c,0x8c,0x5,0xe0,0x5,0xc9,0x0,0x0,0xc6,0x81,0x35,0xc6,0x8b,0x46,0xca,0x1,0xc6,0x86,0x4f,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x47,0xd3,0xc6,0x8b,0x45,0xd3,0xc4,0x1,0xd6,0x0,0xf1,0x1,0x1,0xc7,0x8,0xd0,0x8b,0x7d,0xd3,0x0,0xc1,0x82,0x76,0xc1,0x82,0x6c,0xc1,0x82,0x94,0xc1,0x82,0xbc,0xc1,0x82,0xfa,0xc1,0x82,0xec,0xc1,0x85,0x52,0xc1,0x85,0x58,0x30,0x8c,0x7,0x8c,0x8,0x8c,0x7,0x8c,0x9,0x8c,0xa,0x8c,0xa,0x8c,0x9,0x8c,0xb,0x8c,0xc,0x8c,0xc,0x8c,0xb,0x8c,0xd,0x8c,0xd,0x8c,0xe,0x8c,0xe,0x8c,0xd,0xc1,0x4,0x18,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8c,0xf,0xc,0x8c,0x10,0xe5,0x47,0xc3,0xc4,0x86,0x12,0x61,0x8c,0x11,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x70,0xd3,0xd1,0x0,0xe0,0x3,0xcb,0x0,0xc6,0x81,0x35,0xc6,0x8b,0x44,0xe0,0x0,0xce,0xc6,0x8b,0x27,0xd3,0xc6,0x8b,0x45,0xd3,0xf0,0x1,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x71,0xd3,0xc6,0x83,0x44,0xd0,0x8c,0x6,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x5f,0xd3,0xd3,0x0,0xb,0x69,0x73,0x55,0x73,0x65,0x72,0x43,0x6c,0x61,0x73,0x73,0x4,0x5f,0x69,0x73,0x61,0xc1,0x85,0xd2,0xc1,0x85,0xdc,0xc1,0x85,0xd4,0x26,0x8c,0x15,0x8c,0x15,0x8c,0x16,0x8c,0x17,0x8c,0x16,0x8c,0x15,0xc1,0x4,0x36,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8c,0x18,0xc,0x8c,0x19,0xb9,0xc3,0xc4,0xc4,0xc4,0x8c,0x1a,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe1,0x2,0xc7,0x3a,0xc8,0x0,0x1,0xc8,0x0,0x0,0xd3,0xd3,0x0,0xc1,0x86,0x80,0x23,0x8c,0x1c,0x8c,0x1c,0x8c,0x1c,0xc1,0x4,0x3c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8c,0x1d,0xc,0x8c,0x1e,0xaf,0xc3,0xc4,0xc4,0xc4,0x8c,0x1f,0xe1,0x2,0xc7,0x5,0xc4,0x2,0xc0,0xd3,0x0,0x5,0x73,0x75,0x70,0x65,0x72,0xc1,0x86,0x60,0xc1,0x86,0xb2,0x27,0xc0,0x8c,0x22,0x8c,0x22,0x8c,0x22,0xc0,0x8c,0x23,0x8c,0x23,0xc1,0x4,0x3a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8c,0x24,0xc,0x8c,0x25,0xe5,0x28,0xc3,0xc4,0xc4,0xc4,0x8c,0x26,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0xb,0xc9,0x0,0x0,0xc8,0x0,0x1,0xd3,0xd0,0x8c,0x20,0xd3,0xe8,0x0,0xc9,0x0,0x0,0xc6,0x8c,0x21,0xd3,0xd9,0x0,0x0,0x0,0x3,0x69,0x73,0x61,0x21,0x8b,0x28,0x22,0x88,0x6a,0x8c,0x29,0x4,0x24,0x63,0x6c,0x73,0x21,0x8c,0x2b,0xc1,0x85,0xb4,0xc1,0x85,0x9e,0xc1,0x86,0x12,0xc1,0x86,0x32,0xc1,0x86,0xd4,0x2c,0xc0,0x8c,0x2d,0x8c,0x2e,0x8c,0x2d,0xc0,0x8c,0x2f,0x8c,0x2f,0x8c,0x30,0x8c,0x30,0x8c,0x31,0x8c,0x31,0x8c,0x31,0xc1,0x4,0x34,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8c,0x32,0xc,0x8c,0x33,0xe5,0x3a,0x8c,0x28,0x8c,0x2a,0x8c,0x2c,0x83,0x4c,0x8c,0x34,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x39,0xca,0x1,0xd3,0xd0,0x8c,0x1b,0xd3,0xe0,0x0,0xca,0x0,0xc6,0x8b,0x28,0xd3,0xd6,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x3,0xcb,0x0,0xd0,0x8c,0x27,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xc1,0xd3,0x0,0x5,0x68,0x65,0x6c,0x6c,0x6f,0xe0,0x2e,0x5b,0x31,0x2c,0x5b,0x32,0x2c,0x5b,0x5d,0x5d,0x2c,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x22,0x2c,0x5b,0x5d,0x5d,0x2e,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x5b,0x31,0x2c,0x32,0x2c,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x22,0x5d,0x8,0x62,0x61,0x63,0x6b,0x77,0x61,0x72,0x64,0x22,0xc0,0x8c,0x38,0x1,0x2f,0x1,0x2e,0xc1,0x87,0xee,0x23,0x8c,0x3c,0x8c,0x3c,0x8c,0x3c,0xc1,0x4,0x4c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8c,0x3d,0xc,0x8c,0x3e,0xb1,0xc3,0xc4,0xc4,0xc4,0x8c,0x3f,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc6,0x8c,0x3b,0xd3,0x0,0xc1,0x88,0x24,0x23,0x8c,0x41,0x8c,0x41,0x8c,0x41,0xc1,0x4,0x4e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8c,0x42,0xc,0x8c,0x43,0xb1,0xc3,0xc4,0xc4,0xc4,0x8c,0x44,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc6,0x8c,0x3a,0xd3,0x0,0xc0,0x5e,0xc1,0x4,0x52,0x64,0x7,0xc8,0x8,0xc3,0x9,0x83,0x45,0xc,0x8c,0x47,0xb4,0xc3,0xc4,0xc4,0xc4,0x8c,0x48,0xe1,0x2,0xc7,0x16,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xd9,0x0,0x1,0x0,0x7,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x21,0x8b,0x4f,0x21,0x8c,0x4b,0x6,0x24,0x73,0x6c,0x61,0x73,0x68,0x22,0x81,0x5c,0x8c,0x4d,0xc1,0x87,0x90,0xc1,0x87,0xd2,0xc1,0x88,0xc,0xc1,0x88,0x56,0xc1,0x88,0x70,0xc1,0x88,0x8c,0xc1,0x88,0x7a,0xc1,0x88,0xc8,0xc1,0x88,0xd2,0x3e,0x8c,0x4f,0x8c,0x4f,0xc0,0x8c,0x50,0x8c,0x50,0x8c,0x50,0xc0,0xc0,0x8c,0x51,0x8c,0x51,0x8c,0x51,0xc0,0x8c,0x52,0x8c,0x52,0x8c,0x52,0x8c,0x53,0x8c,0x54,0x8c,0x54,0x8c,0x55,0x8c,0x55,0xc0,0xc0,0xc0,0x8c,0x54,0x8c,0x53,0x8c,0x56,0x8c,0x56,0x8c,0x57,0x8c,0x57,0x8c,0x56,0xc1,0x4,0x48,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8c,0x58,0xc,0x8c,0x59,0xe5,0x7c,0x8c,0x4a,0x8c,0x4c,0x8c,0x4e,0x82,0x51,0x8c,0x5a,0xf0,0x2,0x8c,0x39,0xca,0x0,0xc6,0x86,0x54,0xc6,0x8c,0x3a,0xc0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x8c,0x40,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xcb,0x0,0xc4,0x1,0xd3,0xd0,0x8c,0x45,0xd3,0xe1,0x2,0xc7,0x16,0xcb,0x0,0xc4,0x1,0xd3,0xd6,0x1,0xf1,0x2,0x2a,0xc9,0x0,0x3,0xe1,0x2,0xc7,0xb,0xe0,0x1,0xca,0x0,0xc6,0x18,0xcb,0x1,0xd3,0xe1,0x1,0xc7,0x26,0xc6,0x8c,0x46,0xd3,0xd3,0xd0,0x8c,0x49,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe0,0x2,0xca,0x0,0xc6,0x87,0x1b,0xc2,0xcb,0x1,0xd3,0xd3,0x0,0xa,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x1c,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2e,0x22,0xb,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x1d,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2f,0x22,0xc,0x2e,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x1e,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2e,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2e,0x22,0xd,0x2e,0x2e,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x2,0x2e,0x2e,0xe0,0x20,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2e,0x2e,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2e,0x2e,0x22,0x16,0x2e,0x2e,0x2f,0x66,0x6f,0x6f,0x2f,0x74,0x65,0x73,0x74,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0xb,0x2e,0x2e,0x2f,0x66,0x6f,0x6f,0x2f,0x74,0x65,0x73,0x74,0xe0,0x32,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2e,0x2e,0x2f,0x66,0x6f,0x6f,0x2f,0x74,0x65,0x73,0x74,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2e,0x2e,0x2f,0x66,0x6f,0x6f,0x2f,0x74,0x65,0x73,0x74,0x22,0x1e,0x2f,0x2f,0x66,0x6f,0x6f,0x2f,0x2e,0x2e,0x2f,0x2f,0x2e,0x2e,0x2f,0x74,0x65,0x73,0x74,0x2f,0x2f,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x11,0x2f,0x2f,0x66,0x6f,0x6f,0x2f,0x2e,0x2e,0x2f,0x2f,0x2e,0x2e,0x2f,0x74,0x65,0x73,0x74,0xe0,0x40,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2f,0x2f,0x66,0x6f,0x6f,0x2f,0x2e,0x2e,0x2f,0x2f,0x2e,0x2e,0x2f,0x74,0x65,0x73,0x74,0x2f,0x2f,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2f,0x2f,0x66,0x6f,0x6f,0x2f,0x2e,0x2e,0x2f,0x2f,0x2e,0x2e,0x2f,0x74,0x65,0x73,0x74,0x22,0xc1,0x8b,0xba,0x23,0x8c,0x6b,0x8c,0x6b,0x8c,0x6b,0xc1,0x4,0x6a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8c,0x6c,0xc,0x8c,0x6d,0xb1,0xc3,0xc4,0xc4,0xc4,0x8c,0x6e,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc8,0x0,0x0,0xd3,0x0,0x8,0x66,0x69,0x6c,0x65,0x6e,0x61,0x6d,0x65,0x21,0x81,0x5c,0xc1,0x8b,0x5c,0xc1,0x8b,0x9e,0xc1,0x8b,0xda,0xc1,0x8b,0xe4,0xc1,0x8b,0xec,0x2f,0x8c,0x72,0x8c,0x72,0xc0,0x8c,0x73,0x8c,0x73,0x8c,0x73,0xc0,0x8c,0x74,0x8c,0x74,0x8c,0x75,0x8c,0x76,0x8c,0x76,0x8c,0x76,0x8c,0x75,0x8c,0x74,0xc1,0x4,0x66,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8c,0x77,0xc,0x8c,0x78,0xe5,0x44,0x8c,0x70,0x8c,0x4c,0x8c,0x71,0x61,0x8c,0x79,0xf0,0x2,0x8c,0x39,0xca,0x0,0xc6,0x86,0x54,0xc6,0x8c,0x3a,0xc0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x4,0xcb,0x0,0xd3,0xd0,0x8c,0x6f,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe0,0x2,0xca,0x0,0xc6,0x87,0x1b,0xe1,0x2,0xc7,0xf,0xcb,0x0,0xc4,0x1,0xd3,0xc2,0xd3,0xd3,0x0,0xe0,0x26,0x66,0x69,0x6c,0x65,0x6e,0x61,0x6d,0x65,0x28,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0xe0,0x27,0x66,0x69,0x6c,0x65,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0xe0,0x28,0x66,0x69,0x6c,0x65,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2e,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0xe0,0x32,0x66,0x69,0x6c,0x65,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2e,0x2e,0x2f,0x66,0x6f,0x6f,0x2f,0x74,0x65,0x73,0x74,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x4,0x77,0x61,0x69,0x74,0x5,0x73,0x6c,0x65,0x65,0x70,0xc1,0x8d,0xa8,0x22,0x8d,0x1,0x8d,0x1,0xc1,0x4,0x7a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x2,0xc,0x8d,0x3,0xb4,0x8d,0x0,0x85,0x6c,0xc4,0xc4,0x8d,0x4,0xe0,0x1,0xc9,0x0,0x3a,0xc6,0x8c,0x7f,0xca,0x0,0xd3,0x0,0xc1,0x8d,0xd8,0x22,0x8d,0x6,0x8d,0x6,0xc1,0x4,0x7c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x7,0xc,0x8d,0x8,0xb4,0x8c,0x7f,0x85,0x6c,0xc4,0xc4,0x8d,0x9,0xe0,0x1,0xc9,0x0,0x3a,0xc6,0x8c,0x7f,0xca,0x0,0xd3,0x0,0xc,0x54,0x45,0x53,0x54,0x20,0x46,0x41,0x49,0x4c,0x45,0x44,0x3a,0xc1,0x8e,0x2a,0xc1,0x8e,0x20,0xc1,0x8e,0x60,0xc1,0x8e,0x54,0xc1,0x8e,0x82,0xc1,0x8e,0x78,0xc1,0x8e,0x94,0x2c,0x8d,0xc,0x8d,0xd,0x8d,0xe,0x8d,0xf,0x8d,0xf,0x8d,0xe,0x8d,0xc,0x8d,0x10,0x8d,0x11,0x8d,0x12,0x8d,0x12,0x8d,0x10,0xc1,0x4,0x82,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x13,0xc,0x8d,0x14,0xe5,0x2d,0xc3,0x11,0xc4,0xc4,0x8d,0x15,0xe1,0x2,0xc7,0x1,0xc6,0x8d,0xb,0xe0,0x1,0xe0,0x0,0xcd,0x0,0xc6,0x87,0x1b,0xd3,0xc6,0x88,0x5f,0xc6,0x86,0x4f,0xd3,0xd3,0xe1,0x1,0xc7,0x1,0xe1,0x1,0xc9,0x1,0x23,0xca,0x0,0xd3,0xd3,0x0,0xc1,0x8e,0x8,0xc1,0x8e,0xb8,0xc1,0x8e,0xac,0x27,0x8d,0x17,0x8d,0x17,0x8d,0x17,0x8d,0x18,0x8d,0x19,0x8d,0x19,0x8d,0x18,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x1a,0xc,0x62,0xbb,0x75,0xc4,0xc4,0xc4,0x8d,0x1b,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8d,0x16,0xd3,0xe0,0x0,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xc6,0x6d,0xd3,0x0,0x61,0x81,0x70,0xc0,0x4,0x5f,0x67,0x65,0x74,0x4,0x5f,0x73,0x65,0x74,0x63,0x6d,0xc0,0x8d,0x1e,0xc0,0x8d,0x1f,0xc0,0xc1,0x93,0x8,0x22,0x8d,0x21,0x8d,0x21,0xc1,0x4,0xa0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x22,0xc,0x8d,0x23,0xb3,0xc3,0xc4,0xc4,0xc4,0x8d,0x24,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x81,0x35,0xc6,0x6d,0xd3,0xc2,0x0,0xc1,0x93,0x62,0xc1,0x93,0x74,0x24,0x8d,0x26,0x8d,0x27,0x8d,0x27,0x8d,0x26,0xc1,0x4,0xa2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x28,0xc,0x8d,0x29,0xb8,0xc3,0xc4,0xc4,0xc4,0x8d,0x2a,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x81,0x35,0xe0,0x0,0xcc,0xc6,0x8b,0x27,0xd3,0xd3,0xc2,0x0,0x5,0x76,0x61,0x6c,0x75,0x65,0x21,0x8d,0x2c,0x22,0x8b,0x2a,0x8d,0x2d,0xc1,0x93,0xd6,0x22,0x8d,0x2f,0x8d,0x2f,0xc1,0x4,0xa4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x30,0xc,0x8d,0x31,0xb5,0xc3,0x8d,0x2e,0xc4,0xc4,0x8d,0x32,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x81,0x35,0xca,0x0,0xd3,0xca,0x1,0x0,0x6,0x65,0x78,0x70,0x65,0x63,0x74,0x8,0x6f,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x62,0x8d,0x34,0xc0,0x8d,0x35,0xc0,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x4d,0xaa,0xc3,0xc4,0xc4,0xc4,0x8d,0x37,0xc9,0x0,0x1,0x0,0x13,0x45,0x78,0x70,0x65,0x63,0x74,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,0x2c,0x20,0x6e,0x6f,0x20,0x27,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x4c,0xaa,0xc3,0xc4,0xc4,0xc4,0x8d,0x3a,0xc8,0x2,0x0,0x0,0xa,0x27,0x20,0x6f,0x62,0x73,0x65,0x72,0x76,0x65,0x64,0xc1,0x97,0x52,0xc1,0x97,0x2,0xc1,0x96,0xf8,0x2a,0x8d,0x3d,0x8d,0x3e,0x8d,0x3f,0xc0,0xc0,0xc0,0xc0,0xc0,0x8d,0x3e,0x8d,0x3d,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x40,0xc,0x4c,0xe5,0x22,0xc3,0xc4,0xc4,0xc4,0x8d,0x41,0xe0,0x0,0xe1,0x1,0xc7,0x34,0xe1,0x3,0xc7,0x2,0xc6,0x8d,0x39,0xe1,0x0,0xd0,0x8d,0x3b,0xd3,0xc6,0x8d,0x3c,0xd3,0xd3,0xc6,0x4a,0xd3,0x0,0x6,0x72,0x65,0x6d,0x6f,0x76,0x65,0xc1,0x97,0xca,0x23,0x8d,0x44,0x8d,0x44,0x8d,0x44,0xc1,0x4,0xb8,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x45,0xc,0x8d,0x46,0xaf,0xc3,0xc4,0xc4,0xc4,0x8d,0x47,0xe1,0x2,0xc7,0x5,0xc4,0x2,0xc0,0xd3,0x0,0xc1,0x96,0xec,0xc1,0x96,0xe0,0xc1,0x97,0xac,0xc1,0x97,0x96,0x2e,0xc0,0x8d,0x49,0x8d,0x49,0x8d,0x4a,0x8d,0x4a,0x8d,0x49,0xc0,0xc0,0x8d,0x4b,0x8d,0x4b,0x8d,0x4c,0x8d,0x4c,0x8d,0x4b,0xc0,0xc1,0x4,0xb4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x4d,0xc,0x8d,0x4e,0xe5,0x3e,0xc3,0xc4,0xc4,0xc4,0x8d,0x4f,0xf1,0x2,0x2a,0xc9,0x2,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xc9,0x1,0x0,0xc6,0x81,0x37,0xd3,0xc4,0x0,0xd3,0xd0,0x8d,0x42,0xd3,0xf1,0x2,0x2a,0xc9,0x2,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x8d,0x43,0xc4,0x1,0xd3,0xc8,0x0,0x0,0xd3,0xd0,0x8d,0x48,0xd3,0x0,0x4,0x6e,0x61,0x6d,0x65,0x21,0x8d,0x51,0x21,0x8d,0x52,0xc1,0x96,0x9e,0x23,0x8d,0x54,0x8d,0x54,0x8d,0x54,0xc1,0x4,0xb2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x55,0xc,0x8d,0x56,0xb1,0xc3,0x8d,0x53,0xc4,0xc4,0x8d,0x57,0xf1,0x1,0x1,0xc7,0x8,0xd0,0x8d,0x50,0xd3,0x0,0x4,0x73,0x65,0x65,0x6e,0x22,0x8d,0x59,0x8d,0x35,0xc1,0x92,0x38,0xc1,0x92,0x2e,0x29,0x8d,0x5b,0x8d,0x5c,0x8d,0x5b,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc1,0x4,0x9a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x5d,0xc,0x8d,0x5e,0xe5,0x42,0xc3,0xc4,0x8d,0x5a,0x83,0x0,0x8d,0x5f,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x70,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x37,0xc6,0x8d,0x20,0xc6,0x6d,0xd0,0x8d,0x25,0xc6,0x8d,0x1e,0xd0,0x8d,0x2b,0xc6,0x8d,0x1f,0xd0,0x8d,0x33,0xd3,0xd1,0x1,0xe1,0x5,0xc7,0x37,0xc6,0x8d,0x36,0xc6,0x8d,0x35,0xd0,0x8d,0x38,0xc6,0x8d,0x34,0xd0,0x8d,0x58,0xd3,0x0,0xb,0x68,0x65,0x6c,0x6c,0x6f,0x20,0x77,0x6f,0x72,0x6c,0x64,0x24,0xc0,0xc0,0xc0,0x85,0x2e,0x5,0x77,0x6f,0x72,0x6c,0x64,0xe0,0x30,0x73,0x70,0x2e,0x73,0x69,0x7a,0x65,0x20,0x3d,0x3d,0x20,0x32,0x2c,0x20,0x73,0x70,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x22,0x2c,0x20,0x73,0x70,0x5b,0x32,0x5d,0x20,0x3d,0x3d,0x20,0x22,0x77,0x6f,0x72,0x6c,0x64,0x22,0x2,0x73,0x70,0x21,0x8d,0x65,0xc1,0x98,0x4e,0xc1,0x98,0x72,0xc1,0x98,0x64,0xc1,0x98,0x82,0xc1,0x98,0x76,0xc1,0x98,0x9a,0xc1,0x98,0x92,0xc1,0x98,0xbe,0xc1,0x98,0xb6,0x34,0x8d,0x67,0x8d,0x67,0x8d,0x68,0x8d,0x69,0x8d,0x6a,0x8d,0x6a,0x8d,0x6b,0x8d,0x6b,0x8d,0x6a,0x8d,0x6c,0x8d,0x6c,0x8d,0x6d,0x8d,0x6d,0x8d,0x6c,0x8d,0x6e,0x8d,0x6e,0x8d,0x6f,0x8d,0x6f,0x8d,0x6e,0x8d,0x68,0xc1,0x4,0xc4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8d,0x70,0xc,0x8d,0x71,0xe5,0x4e,0xc3,0xc4,0x8d,0x66,0x61,0x8d,0x72,0xe0,0x0,0xc6,0x8d,0x61,0xc6,0x89,0x45,0xd3,0xd1,0x0,0xf1,0x4,0x8d,0x62,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x37,0xd3,0xc4,0x2,0xd3,0xe1,0x2,0xc7,0xb,0xe0,0x1,0xcb,0x0,0xc6,0x18,0xc4,0x1,0xd3,0xc6,0x8c,0x36,0xd3,0xe1,0x2,0xc7,0xb,0xe0,0x1,0xcb,0x0,0xc6,0x18,0xc4,0x2,0xd3,0xc6,0x8d,0x63,0xd3,0xc6,0x8d,0x64,0xd3,0x0,0x11,0x4d,0x6f,0x63,0x6b,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x77,0x6f,0x72,0x6b,0x73,0xa,0x6d,0x2e,0x6f,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x18,0x6d,0x2e,0x6f,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x20,0x3d,0x3d,0x20,0x6d,0x2e,0x6f,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x6,0x66,0x6f,0x6f,0x62,0x61,0x72,0x6,0x6e,0x6f,0x2d,0x77,0x61,0x79,0xe0,0x2b,0x74,0x72,0x79,0x28,0x6d,0x2e,0x65,0x78,0x70,0x65,0x63,0x74,0x28,0x22,0x63,0x61,0x6c,0x6c,0x22,0x29,0x2c,0x20,0x22,0x6e,0x6f,0x2d,0x77,0x61,0x79,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x6e,0x6f,0x2d,0x77,0x61,0x79,0x22,0x3,0x68,0x6d,0x6d,0xe0,0x2a,0x74,0x72,0x79,0x28,0x6d,0x2e,0x65,0x78,0x70,0x65,0x63,0x74,0x28,0x22,0x68,0x6d,0x6d,0x22,0x29,0x2c,0x20,0x22,0x6e,0x6f,0x2d,0x77,0x61,0x79,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x6e,0x6f,0x2d,0x77,0x61,0x79,0x22,0x22,0x8a,0x2c,0x81,0x59,0xc1,0x99,0x22,0xc1,0x99,0x42,0xc1,0x99,0x34,0xc1,0x99,0x44,0xc1,0x99,0x6e,0xc1,0x99,0x60,0xc1,0x99,0x84,0xc1,0x99,0x70,0xc1,0x99,0x8c,0xc1,0x99,0xd2,0xc1,0x99,0xc0,0xc1,0x99,0xec,0xc1,0x9a,0x24,0xc1,0x9a,0x44,0xc1,0x9a,0x62,0xc1,0x9a,0x98,0xc1,0x9a,0x8a,0xc1,0x9a,0xd8,0xc1,0x9a,0x9e,0xc1,0x9a,0xa2,0xc1,0x9b,0x6,0xc1,0x9a,0xf8,0xc1,0x9b,0x44,0xc1,0x9b,0xc,0xc1,0x9b,0x10,0xe1,0x31,0x8d,0x7d,0x8d,0x7d,0x8d,0x7e,0x8d,0x7f,0x8e,0x0,0x8e,0x0,0x8d,0x7e,0x8e,0x1,0x8e,0x2,0x8e,0x3,0x8e,0x3,0x8e,0x4,0x8e,0x4,0x8e,0x5,0x8e,0x5,0x8e,0x3,0x8e,0x1,0x8e,0x6,0x8e,0x7,0x8e,0x7,0x8e,0x6,0x8e,0x8,0x8e,0x8,0x8e,0x9,0x8e,0x9,0x8e,0xa,0x8e,0xa,0x8e,0xb,0x8e,0xb,0x8e,0xc,0x8e,0xd,0x8e,0xe,0x8e,0xe,0x8e,0xf,0x8e,0x10,0x8e,0x10,0x8e,0xf,0x8e,0xe,0x8e,0xc,0x8e,0x11,0x8e,0x12,0x8e,0x13,0x8e,0x13,0x8e,0x14,0x8e,0x15,0x8e,0x15,0x8e,0x14,0x8e,0x13,0x8e,0x11,0xc1,0x4,0xcc,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8e,0x16,0xc,0x8e,0x17,0xe5,0x81,0x45,0xc3,0xc4,0x8d,0x7c,0x83,0x0,0x8e,0x18,0xe0,0x0,0xc9,0x0,0x30,0xc6,0x81,0x70,0xd3,0xd1,0x0,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe0,0x0,0xcb,0x0,0xc6,0x8d,0x35,0xd3,0xc6,0x8d,0x75,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xcb,0x0,0xc6,0x8d,0x35,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x8d,0x35,0xd3,0xd3,0xc6,0x8d,0x76,0xd3,0xe0,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8d,0x35,0xd3,0xc6,0x8d,0x77,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x8d,0x34,0xc6,0x8d,0x77,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x8d,0x35,0xd3,0xd1,0x1,0xe1,0x1,0xcb,0x1,0xc6,0x8c,0x36,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x8d,0x34,0xc6,0x6d,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x2,0xc9,0x0,0x4,0xe0,0x1,0xcb,0x0,0xc6,0x8d,0x34,0xc6,0x6d,0xd3,0xc6,0x8d,0x78,0xd3,0xc6,0x8d,0x78,0xd3,0xc6,0x8d,0x79,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x2,0xc9,0x0,0x4,0xe0,0x1,0xcb,0x0,0xc6,0x8d,0x34,0xc6,0x8d,0x7a,0xd3,0xc6,0x8d,0x78,0xd3,0xc6,0x8d,0x78,0xd3,0xc6,0x8d,0x7b,0xd3,0x0,0xa,0x5f,0x69,0x6f,0x5f,0x67,0x65,0x74,0x65,0x6e,0x76,0xe,0x54,0x4c,0x5f,0x4d,0x4f,0x44,0x55,0x4c,0x45,0x5f,0x50,0x41,0x54,0x48,0x6,0x73,0x79,0x73,0x74,0x65,0x6d,0x6,0x70,0x72,0x65,0x66,0x69,0x78,0xc1,0x9c,0x4c,0xc1,0x9c,0x40,0x23,0x8e,0x1e,0x8e,0x1f,0x8e,0x1e,0xc1,0x4,0xee,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8e,0x20,0xc,0x8e,0x21,0xaf,0xc3,0xc4,0xc4,0xc4,0x8e,0x22,0xe0,0x0,0xc7,0x3c,0xc6,0x8e,0x1d,0xd3,0x0,0x7,0x2f,0x6c,0x69,0x62,0x2f,0x74,0x6c,0x1,0x70,0x21,0x8e,0x25,0x21,0x8e,0x26,0xc1,0x9c,0xb4,0x22,0x8e,0x28,0x8e,0x28,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8e,0x29,0xc,0x8e,0x21,0xb3,0xc3,0x8e,0x27,0xc4,0xc4,0x8e,0x2a,0xe0,0x1,0xc9,0x0,0x31,0xc6,0x81,0x35,0xca,0x0,0xd3,0x0,0xa,0x5f,0x50,0x61,0x74,0x68,0x5f,0x73,0x74,0x61,0x74,0x3,0x6e,0x65,0x71,0x3,0x69,0x6e,0x6f,0xc1,0x9e,0xb6,0x23,0x8e,0x2f,0x8e,0x2f,0x8e,0x2f,0xc1,0x5,0x0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8e,0x30,0xc,0x8e,0x31,0xb4,0xc3,0xc4,0xc4,0xc4,0x8e,0x32,0xe1,0x3,0xc7,0x5,0xc4,0x2,0xc9,0x0,0x0,0xc9,0x0,0x1,0xd3,0x0,0x4,0x73,0x74,0x61,0x74,0x22,0x8b,0x4f,0x8e,0x34,0xc1,0x9e,0x76,0xc1,0x9e,0x62,0xc1,0x9e,0x9e,0xc1,0x9e,0x94,0x2d,0xc0,0xc0,0xc0,0x8e,0x36,0x8e,0x37,0x8e,0x36,0xc0,0x8e,0x38,0x8e,0x38,0x8e,0x39,0x8e,0x39,0x8e,0x38,0xc0,0xc1,0x4,0xfc,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8e,0x3a,0xc,0x8e,0x3b,0xe5,0x3b,0xc3,0xc4,0x8e,0x35,0x83,0x0,0x8e,0x3c,0xe1,0x3,0xc7,0x2,0xc8,0x0,0x1,0xc6,0x8c,0x3a,0xc8,0x0,0x0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x3d,0xcb,0x0,0xd3,0xd1,0x1,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0x3e,0xe0,0x0,0xcb,0x1,0xc6,0x8e,0x2e,0xd3,0xc4,0x0,0xd3,0xd0,0x8e,0x33,0xd3,0x0,0xc1,0x9f,0xae,0x23,0x8e,0x3e,0x8e,0x3e,0x8e,0x3e,0xc1,0x5,0x6,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8e,0x3f,0xc,0x8e,0x40,0xb4,0xc3,0xc4,0xc4,0xc4,0x8e,0x41,0xe1,0x3,0xc7,0x5,0xc4,0x2,0xc9,0x0,0x0,0xc9,0x0,0x1,0xd3,0x0,0xc1,0x9f,0x6e,0xc1,0x9f,0x5a,0xc1,0x9f,0x96,0xc1,0x9f,0x8c,0x2d,0xc0,0xc0,0xc0,0x8e,0x43,0x8e,0x44,0x8e,0x43,0xc0,0x8e,0x45,0x8e,0x45,0x8e,0x46,0x8e,0x46,0x8e,0x45,0xc0,0xc1,0x5,0x2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8e,0x47,0xc,0x8e,0x48,0xe5,0x3b,0xc3,0x8e,0x27,0x8e,0x35,0x83,0x0,0x8e,0x49,0xe1,0x3,0xc7,0x2,0xca,0x0,0xc6,0x8c,0x3a,0xc8,0x0,0x0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x3d,0xcb,0x0,0xd3,0xd1,0x1,0xf1,0x2,0x2a,0xc9,0x1,0x0,0xe1,0x2,0xc7,0x3e,0xe0,0x0,0xcb,0x1,0xc6,0x8e,0x2e,0xd3,0xc4,0x0,0xd3,0xd0,0x8e,0x42,0xd3,0x0,0x12,0x66,0x69,0x6c,0x65,0x46,0x72,0x6f,0x6d,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x50,0x61,0x74,0x68,0x4,0x70,0x61,0x74,0x68,0x21,0x8e,0x4c,0x22,0x8d,0x52,0x8e,0x4d,0xc1,0x9e,0xf0,0xc1,0x9f,0xda,0x27,0xc0,0xc0,0x8e,0x4f,0x8e,0x4f,0x8e,0x50,0x8e,0x50,0x8e,0x50,0xc1,0x4,0xfa,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8e,0x51,0xc,0x8e,0x52,0xe5,0x2a,0x8e,0x4b,0x8e,0x4e,0xc4,0xc4,0x8e,0x53,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xca,0x1,0xd0,0x8e,0x3d,0xd3,0xf0,0x1,0x1,0xc9,0x0,0x31,0xc6,0x83,0x44,0xd0,0x8e,0x4a,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xc2,0xd3,0x0,0xc1,0x17,0x70,0xc0,0xc6,0xe0,0x20,0x5b,0x33,0x30,0x30,0x30,0x2c,0x20,0x31,0x39,0x2c,0x20,0x31,0x30,0x2c,0x20,0x39,0x39,0x5d,0x2e,0x73,0x6f,0x72,0x74,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x31,0x30,0xc,0x5f,0x65,0x6e,0x76,0x5f,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0xd,0x5f,0x65,0x6e,0x76,0x5b,0x22,0x41,0x72,0x72,0x61,0x79,0x22,0x5d,0x4,0x41,0x72,0x72,0x61,0x1,0x79,0x12,0x5f,0x65,0x6e,0x76,0x5b,0x22,0x41,0x72,0x72,0x61,0x22,0x20,0x2b,0x20,0x22,0x79,0x22,0x5d,0x10,0x5f,0x76,0x6d,0x5f,0x67,0x65,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0xb,0x5f,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6e,0x65,0x77,0xa,0x3c,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x3e,0xd,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x6b,0x73,0xc1,0xa2,0xb8,0x22,0x8e,0x61,0x8e,0x61,0xc1,0x5,0x20,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8e,0x62,0xc,0x8e,0x63,0xb2,0xc3,0x8d,0x53,0xc4,0xc4,0x8e,0x64,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x18,0xca,0x0,0xd3,0x0,0xb,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x72,0x75,0x6e,0xc,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x6b,0x4,0x5f,0x65,0x6e,0x76,0x5,0x62,0x63,0x6f,0x64,0x65,0x4,0x5f,0x6d,0x6f,0x64,0x5,0x6c,0x69,0x6e,0x6b,0x73,0x6,0x6c,0x69,0x6e,0x6b,0x65,0x64,0x8,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x26,0x8e,0x68,0x8e,0x69,0x8e,0x6a,0x8e,0x6b,0x8e,0x6c,0x8e,0x6d,0x26,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xa0,0x82,0xc1,0xa0,0x6a,0xc1,0xa0,0x9e,0xc1,0xa0,0x90,0xc1,0xa0,0xa6,0xc1,0xa0,0xd0,0xc1,0xa0,0xc2,0xc1,0xa0,0xd8,0xc1,0xa0,0xe8,0xc1,0xa1,0x2e,0xc1,0xa1,0xe,0xc1,0xa2,0x6,0xc1,0xa1,0xf0,0xc1,0xa2,0x64,0xc1,0xa2,0x4a,0xc1,0xa2,0x96,0xc1,0xa2,0xfc,0xc1,0xa2,0xe6,0xc1,0xa3,0x16,0xc1,0xa2,0xfe,0xe1,0x21,0x8e,0x70,0x8e,0x71,0x8e,0x70,0x8e,0x72,0x8e,0x73,0x8e,0x74,0x8e,0x74,0x8e,0x72,0x8e,0x75,0x8e,0x76,0x8e,0x77,0x8e,0x78,0x8e,0x78,0x8e,0x78,0x8e,0x77,0x8e,0x75,0x8e,0x79,0x8e,0x7a,0x8e,0x79,0x8e,0x7b,0x8e,0x7c,0x8e,0x7b,0x8e,0x7d,0x8e,0x7e,0x8e,0x7d,0x8e,0x7f,0x8e,0x7f,0x8f,0x0,0x8f,0x1,0x8f,0x2,0x8f,0x3,0x8f,0x2,0x8f,0x0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x4,0xc,0x58,0xe5,0x7a,0xc3,0xc4,0x8e,0x6e,0x8e,0x6f,0x8f,0x5,0xe1,0x0,0xc7,0x3f,0xd3,0xd1,0x0,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe0,0x1,0xcb,0x0,0xc6,0x18,0xc6,0x81,0x6f,0xd3,0xc6,0x8e,0x59,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe0,0x1,0xcb,0x0,0xc6,0x18,0xe1,0x2,0xc7,0xf,0xc6,0x8e,0x5a,0xc6,0x8e,0x5b,0xd3,0xd3,0xc6,0x8e,0x5c,0xd3,0xe1,0x0,0xc7,0x40,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x41,0xcb,0x1,0xc6,0x8e,0x5f,0xd3,0xd1,0x2,0xe1,0x1,0xc7,0x42,0xcb,0x2,0xd3,0xd1,0x3,0xf0,0x1,0x1,0xcb,0x3,0xc6,0x88,0x5e,0xd0,0x8e,0x65,0xd3,0xd1,0x4,0xe1,0x1,0xc7,0x43,0xe1,0x2,0xc7,0x44,0xcb,0x2,0xcb,0x4,0xd3,0xd3,0xd1,0x5,0x0,0x6,0x67,0x6f,0x74,0x20,0x69,0x74,0xc1,0x5,0x3a,0x64,0x7,0xc8,0x8,0xc3,0x9,0xc4,0xc,0x8f,0x8,0xaa,0xc3,0x11,0xc4,0xc4,0x8f,0x9,0xc6,0x8f,0x7,0x0,0x5,0x66,0x61,0x6c,0x73,0x65,0xc1,0xa4,0xd6,0xc1,0xa5,0x12,0xc1,0xa5,0x30,0xc1,0xa5,0x22,0x29,0x8f,0xc,0x8f,0xc,0x8f,0xc,0x8f,0xd,0x8f,0xd,0x8f,0xd,0x8f,0xe,0x8f,0xf,0x8f,0xe,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x10,0xc,0x8f,0x8,0xe5,0x23,0xc3,0xc4,0xc4,0xc4,0x8f,0x11,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8f,0xa,0xd3,0xe1,0x2,0xc7,0x16,0xc2,0xc4,0x1,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xc1,0xc6,0x8f,0xb,0xd3,0x0,0xe,0x5f,0x78,0x20,0x3d,0x3d,0x20,0x22,0x67,0x6f,0x74,0x20,0x69,0x74,0x22,0x9,0x69,0x73,0x44,0x65,0x66,0x69,0x6e,0x65,0x64,0xc1,0xa6,0xa,0x23,0x8f,0x15,0x8f,0x15,0x8f,0x15,0xc1,0x5,0x4a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x16,0xc,0x8f,0x17,0xb1,0xc3,0xc4,0xc4,0xc4,0x8f,0x18,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc9,0x0,0x0,0xd3,0x0,0x17,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x72,0x65,0x61,0x64,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x27,0x3,0x27,0x3a,0x20,0xc1,0xa6,0xe6,0x22,0x8f,0x1c,0x8f,0x1c,0xc1,0x5,0x4e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x1d,0xc,0x8f,0x1e,0xb0,0xc3,0xc4,0xc4,0xc4,0x8f,0x1f,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x27,0xd3,0x0,0xc1,0xa6,0x92,0x28,0x8f,0x21,0x8f,0x21,0xc0,0xc0,0xc0,0xc0,0xc0,0x8f,0x21,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x22,0xc,0x8f,0x1e,0xe5,0x23,0xc3,0x11,0xc4,0xc4,0x8f,0x23,0xe1,0x3,0xc7,0x5,0xc4,0x1,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8f,0x1a,0xc8,0x0,0x0,0xc6,0x8f,0x1b,0xe1,0x0,0xd0,0x8f,0x20,0xd3,0xd3,0xd3,0x0,0x4,0x2e,0x74,0x6c,0x62,0xc0,0x5,0x5,0x6d,0x74,0x69,0x6d,0x65,0x17,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x6c,0x6f,0x61,0x64,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x27,0xc1,0xa9,0x14,0x22,0x8f,0x29,0x8f,0x29,0xc1,0x5,0x56,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x2a,0xc,0x8f,0x2b,0xaf,0xc3,0xc4,0xc4,0xc4,0x8f,0x2c,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0x0,0xc1,0xa8,0xc0,0x28,0x8f,0x2e,0x8f,0x2e,0xc0,0xc0,0xc0,0xc0,0xc0,0x8f,0x2e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x2f,0xc,0x8f,0x2b,0xe5,0x23,0xc3,0x11,0xc4,0xc4,0x8f,0x30,0xe1,0x3,0xc7,0x5,0xc4,0x2,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8f,0x28,0xc8,0x1,0x0,0xc6,0x8f,0x1b,0xe1,0x0,0xd0,0x8f,0x2d,0xd3,0xd3,0xd3,0x0,0x24,0xc0,0x8d,0x51,0xc0,0xc0,0x4,0x6c,0x6f,0x61,0x64,0xf,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x46,0x72,0x6f,0x6d,0x46,0x69,0x6c,0x65,0xc1,0xaa,0x18,0x22,0x8f,0x35,0x8f,0x35,0xc1,0x5,0x5a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x36,0xc,0x8f,0x37,0xb3,0xc3,0x8d,0x53,0xc4,0xc4,0x8f,0x38,0xe1,0x2,0xc9,0x2,0x39,0xca,0x0,0xc9,0x0,0x0,0xd3,0x0,0x16,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x72,0x75,0x6e,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x27,0xc1,0xaa,0xbc,0x22,0x8f,0x3b,0x8f,0x3b,0xc1,0x5,0x5c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x3c,0xc,0x8f,0x3d,0xb0,0xc3,0xc4,0xc4,0xc4,0x8f,0x3e,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x27,0xd3,0x0,0xc1,0xaa,0x6a,0x28,0x8f,0x40,0x8f,0x40,0xc0,0xc0,0xc0,0xc0,0xc0,0x8f,0x40,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x41,0xc,0x8f,0x3d,0xe5,0x23,0xc3,0x11,0xc4,0xc4,0x8f,0x42,0xe1,0x3,0xc7,0x5,0xc4,0x2,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8f,0x3a,0xc8,0x1,0x0,0xc6,0x8f,0x1b,0xe1,0x0,0xd0,0x8f,0x3f,0xd3,0xd3,0xd3,0x0,0x3,0x72,0x75,0x6e,0x3,0x6d,0x6f,0x64,0x23,0x8e,0x4c,0x8f,0x45,0x82,0x4,0xc1,0xa8,0x9c,0xc1,0xa9,0x58,0xc1,0xa9,0x92,0xc1,0xa9,0xbc,0xc1,0xa9,0x9e,0xc1,0xa9,0xde,0xc1,0xaa,0x46,0xc1,0xaa,0xec,0xc1,0xab,0x16,0xc1,0xab,0x28,0x36,0x8f,0x47,0x8f,0x47,0x8f,0x47,0x8f,0x48,0x8f,0x48,0x8f,0x49,0x8f,0x4a,0x8f,0x4b,0x8f,0x4a,0x8f,0x4c,0x8f,0x4c,0x8f,0x49,0x8f,0x4d,0x8f,0x4d,0x8f,0x4d,0x8f,0x4e,0x8f,0x4e,0x8f,0x4f,0x8f,0x4f,0x8f,0x50,0x8f,0x50,0x8f,0x4f,0xc1,0x5,0x52,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x51,0xc,0x8f,0x52,0xe5,0x6d,0xc3,0xc4,0x8f,0x46,0x8b,0x51,0x8f,0x53,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8f,0x31,0xd3,0xe1,0x1,0xc9,0x1,0x2b,0xc9,0x0,0x1,0xd3,0xd1,0x0,0xf0,0x4,0x8f,0x32,0xc9,0x1,0x34,0xc6,0x8f,0x33,0xe1,0x1,0xc7,0x46,0xc9,0x0,0x1,0xd3,0xe0,0x2,0xc9,0x0,0x1,0xc6,0x87,0x1b,0xc2,0xc6,0x8f,0x26,0xd3,0xc9,0x1,0x36,0xd0,0x8f,0x39,0xd3,0xd1,0x1,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8f,0x43,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x8f,0x44,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x2,0xc9,0x1,0x32,0xc6,0x84,0x60,0xc8,0x0,0x0,0xcb,0x2,0xd3,0xd3,0x0,0x3,0x2e,0x74,0x6c,0x1a,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x27,0xc1,0xac,0x9e,0x22,0x8f,0x57,0x8f,0x57,0xc1,0x5,0x68,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x58,0xc,0x8f,0x59,0xaf,0xc3,0xc4,0xc4,0xc4,0x8f,0x5a,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0x0,0xc1,0xac,0x44,0x28,0x8f,0x5c,0x8f,0x5c,0xc0,0xc0,0xc0,0xc0,0xc0,0x8f,0x5c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x5d,0xc,0x8f,0x59,0xe5,0x23,0xc3,0x11,0xc4,0xc4,0x8f,0x5e,0xe1,0x3,0xc7,0x5,0xc4,0x2,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8f,0x56,0xc8,0x1,0x0,0xc6,0x8f,0x1b,0xe1,0x0,0xd0,0x8f,0x5b,0xd3,0xd3,0xd3,0x0,0xf,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x46,0x72,0x6f,0x6d,0x46,0x69,0x6c,0x65,0xc1,0xad,0x98,0x22,0x8f,0x61,0x8f,0x61,0xc1,0x5,0x6c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x62,0xc,0x8f,0x63,0xb3,0xc3,0x8d,0x53,0xc4,0xc4,0x8f,0x64,0xe1,0x2,0xc9,0x2,0x39,0xca,0x0,0xc9,0x0,0x0,0xd3,0x0,0xc1,0xae,0x3c,0x22,0x8f,0x66,0x8f,0x66,0xc1,0x5,0x6e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x67,0xc,0x8f,0x68,0xb0,0xc3,0xc4,0xc4,0xc4,0x8f,0x69,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x27,0xd3,0x0,0xc1,0xad,0xea,0x28,0x8f,0x6b,0x8f,0x6b,0xc0,0xc0,0xc0,0xc0,0xc0,0x8f,0x6b,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x6c,0xc,0x8f,0x68,0xe5,0x23,0xc3,0x11,0xc4,0xc4,0x8f,0x6d,0xe1,0x3,0xc7,0x5,0xc4,0x2,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8f,0x3a,0xc8,0x1,0x0,0xc6,0x8f,0x1b,0xe1,0x0,0xd0,0x8f,0x6a,0xd3,0xd3,0xd3,0x0,0xc1,0xac,0x20,0xc1,0xac,0xe2,0xc1,0xad,0x1c,0xc1,0xad,0x46,0xc1,0xad,0x28,0xc1,0xad,0xc6,0xc1,0xae,0x6c,0xc1,0xae,0x96,0xc1,0xae,0xa8,0x34,0x8f,0x6f,0x8f,0x6f,0x8f,0x6f,0x8f,0x70,0x8f,0x70,0x8f,0x71,0x8f,0x72,0x8f,0x73,0x8f,0x72,0x8f,0x71,0x8f,0x74,0x8f,0x74,0x8f,0x74,0x8f,0x75,0x8f,0x75,0x8f,0x76,0x8f,0x76,0x8f,0x77,0x8f,0x77,0x8f,0x76,0xc1,0x5,0x64,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x78,0xc,0x8f,0x79,0xe5,0x63,0xc3,0xc4,0x8f,0x46,0x8b,0x51,0x8f,0x7a,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8f,0x5f,0xd3,0xe1,0x1,0xc9,0x1,0x2b,0xc9,0x0,0x3,0xd3,0xd1,0x0,0xf0,0x4,0x8f,0x32,0xc9,0x1,0x34,0xc6,0x8f,0x33,0xe1,0x1,0xc7,0x47,0xc9,0x0,0x3,0xd3,0xc9,0x0,0x3,0xc9,0x1,0x36,0xd0,0x8f,0x65,0xd3,0xd1,0x1,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8f,0x6e,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x8f,0x44,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x2,0xc9,0x1,0x32,0xc6,0x84,0x60,0xc8,0x0,0x0,0xcb,0x2,0xd3,0xd3,0x0,0x4,0x2e,0x6d,0x6f,0x64,0xe0,0x20,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x6c,0x6f,0x61,0x64,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x64,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x27,0xc1,0xb0,0x3a,0x22,0x8f,0x7e,0x8f,0x7e,0xc1,0x5,0x7a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x8f,0x7f,0xc,0x90,0x0,0xb0,0xc3,0xc4,0xc4,0xc4,0x90,0x1,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8b,0x27,0xd3,0x0,0xc1,0xaf,0xd4,0x28,0x90,0x3,0x90,0x3,0xc0,0xc0,0xc0,0xc0,0xc0,0x90,0x3,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x4,0xc,0x90,0x0,0xe5,0x23,0xc3,0x11,0xc4,0xc4,0x90,0x5,0xe1,0x3,0xc7,0x5,0xc4,0x2,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8f,0x7d,0xc8,0x1,0x0,0xc6,0x8f,0x1b,0xe1,0x0,0xd0,0x90,0x2,0xd3,0xd3,0xd3,0x0,0x6,0x64,0x6c,0x6f,0x70,0x65,0x6e,0x21,0x82,0x4,0xc1,0xaf,0xb0,0xc1,0xb0,0x70,0xc1,0xb0,0x64,0xc1,0xb0,0x9a,0xc1,0xb0,0xac,0x2b,0x90,0x9,0x90,0x9,0x90,0x9,0x90,0xa,0x90,0xb,0x90,0xa,0x90,0xc,0x90,0xc,0x90,0xd,0x90,0xd,0x90,0xc,0xc1,0x5,0x76,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0xe,0xc,0x90,0xf,0xe5,0x30,0xc3,0xc4,0x90,0x8,0x61,0x90,0x10,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x90,0x6,0xd3,0xe1,0x1,0xc7,0x48,0xc9,0x0,0x4,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe0,0x2,0xc9,0x1,0x32,0xc6,0x84,0x60,0xc8,0x0,0x0,0xcb,0x0,0xd3,0xd3,0x0,0x12,0x27,0x3a,0x20,0x6e,0x6f,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x66,0x6f,0x75,0x6e,0x64,0x8,0x72,0x65,0x73,0x6f,0x6c,0x76,0x65,0x32,0x25,0x82,0x4,0x8b,0x4f,0x8e,0x34,0x8b,0x4f,0x8b,0x4f,0x25,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xa5,0xc4,0xc1,0xa5,0xde,0xc1,0xa5,0xf2,0xc1,0xa5,0xe0,0xc1,0xa6,0x6e,0xc1,0xa7,0x3a,0xc1,0xa7,0x7a,0xc1,0xa7,0xba,0xc1,0xa7,0xac,0xc1,0xa7,0x96,0xc1,0xa7,0x82,0xc1,0xa7,0xa0,0xc1,0xa7,0xc8,0xc1,0xab,0x82,0xc1,0xaf,0x2,0xc1,0xb0,0xe0,0xc1,0xb1,0x0,0xe1,0x37,0x90,0x16,0x90,0x16,0x90,0x17,0x90,0x18,0x90,0x19,0x90,0x18,0x90,0x17,0x90,0x1a,0x90,0x1a,0x90,0x1a,0x90,0x1b,0xc0,0xc0,0xc0,0x90,0x1b,0xc0,0x90,0x1c,0x90,0x1c,0x90,0x1d,0x90,0x1d,0x90,0x1e,0x90,0x1f,0x90,0x20,0x90,0x21,0x90,0x21,0x90,0x1f,0x90,0x1e,0x90,0x22,0x90,0x22,0x90,0x1d,0x90,0x1c,0xc0,0x90,0x23,0xc0,0xc0,0xc0,0x90,0x23,0xc0,0xc0,0x90,0x24,0xc0,0xc0,0xc0,0x90,0x24,0xc0,0xc0,0x90,0x25,0x90,0x25,0x90,0x25,0x90,0x26,0x90,0x26,0xc0,0xc0,0xc0,0x90,0x26,0xc1,0x5,0x46,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x27,0xc,0x90,0x28,0xe5,0x81,0x5b,0x90,0x13,0x8e,0x4e,0x90,0x14,0x90,0x15,0x90,0x29,0xe0,0x1,0xc9,0x0,0x32,0xc6,0x18,0xca,0x0,0xd3,0xd1,0x0,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x1,0xc7,0x45,0xcb,0x0,0xd3,0xd0,0x8f,0x19,0xd3,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8f,0x24,0xd3,0xe1,0x2,0xc9,0x0,0x33,0xe1,0x2,0xc7,0x2,0xca,0x0,0xc6,0x8f,0x25,0xd3,0xca,0x1,0xd3,0xd2,0x0,0x1,0xd2,0x1,0x2,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0x19,0xcb,0x1,0xe1,0x2,0xc7,0xd,0xe0,0x0,0xe1,0x1,0xc7,0x3d,0xe0,0x2,0xcb,0x1,0xc6,0x87,0x1b,0xc2,0xc6,0x8f,0x26,0xd3,0xd3,0xc6,0x8f,0x27,0xd3,0xe0,0x0,0xcb,0x2,0xc6,0x8f,0x27,0xd3,0xd3,0xd3,0xd0,0x8f,0x54,0xd3,0xe1,0x2,0xc9,0x0,0x33,0xe1,0x2,0xc7,0x2,0xca,0x0,0xc6,0x8f,0x55,0xd3,0xca,0x1,0xd3,0xd1,0x3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xcb,0x3,0xd0,0x8f,0x7b,0xd3,0xe1,0x2,0xc9,0x0,0x33,0xe1,0x2,0xc7,0x2,0xca,0x0,0xc6,0x8f,0x7c,0xd3,0xca,0x1,0xd3,0xd1,0x4,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xcb,0x4,0xd0,0x90,0x11,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xc2,0xd3,0xe1,0x3,0xc7,0x5,0xc4,0x0,0xc2,0xe1,0x3,0xc7,0x2,0xc6,0x8f,0x1a,0xca,0x0,0xc6,0x90,0x12,0xd3,0xd3,0x0,0xc1,0xb2,0x10,0x23,0x90,0x2b,0x90,0x2b,0x90,0x2b,0xc1,0x5,0x8a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x2c,0xc,0x90,0x2d,0xb1,0xc3,0xc4,0xc4,0xc4,0x90,0x2e,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xc9,0x0,0x0,0xd3,0x0,0xc1,0xb2,0x3e,0xc1,0xb2,0x34,0xc1,0xb2,0x4a,0xc1,0xb2,0x40,0x26,0x90,0x30,0x90,0x31,0x90,0x32,0x90,0x33,0x90,0x32,0x90,0x30,0xc1,0x5,0x8c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x34,0xc,0x90,0x35,0xb4,0xc3,0xc4,0xc4,0xc4,0x90,0x36,0xe1,0x1,0xc7,0x7,0xe1,0x1,0xc7,0x34,0xc9,0x0,0x1,0xd3,0xd3,0x0,0x7,0x72,0x65,0x73,0x6f,0x6c,0x76,0x65,0x4,0x66,0x61,0x69,0x6c,0x22,0x82,0x4,0x90,0x39,0xc1,0xb1,0xd2,0xc1,0xb2,0x6c,0x29,0x90,0x3b,0x90,0x3b,0xc0,0xc0,0xc0,0xc0,0x90,0x3c,0x90,0x3c,0x90,0x3c,0xc1,0x5,0x86,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x3d,0xc,0x90,0x3e,0xe5,0x3b,0x90,0x38,0x8e,0x4e,0x90,0x3a,0x83,0x0,0x90,0x3f,0xe1,0x2,0xc9,0x0,0x38,0xca,0x0,0xca,0x1,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xcb,0x0,0xd0,0x90,0x2f,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xcb,0x1,0xd0,0x90,0x37,0xd3,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xc3,0xd3,0x0,0x2,0x69,0x6f,0x5,0x66,0x72,0x61,0x6d,0x65,0x4,0x6c,0x69,0x6e,0x6b,0x21,0x90,0x43,0x26,0xc0,0x8d,0x51,0x90,0x43,0xc0,0xc0,0xc0,0x6,0x3c,0x65,0x76,0x61,0x6c,0x3e,0xc1,0xb4,0x56,0x22,0x90,0x47,0x90,0x47,0xc1,0x5,0x9c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x48,0xc,0x90,0x49,0xb0,0xc3,0x8d,0x53,0xc4,0xc4,0x90,0x4a,0xe1,0x1,0xc9,0x2,0x39,0xca,0x0,0xd3,0x0,0xc1,0xb4,0x66,0xc1,0xb3,0xc2,0xc1,0xb4,0xa,0xc1,0xb4,0x86,0x28,0x90,0x4c,0x90,0x4d,0x90,0x4e,0x90,0x4e,0x90,0x4d,0x90,0x4f,0x90,0x4f,0x90,0x4c,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x50,0xc,0x90,0x49,0xe5,0x3c,0xc3,0xc4,0xc4,0xc4,0x90,0x51,0xf0,0x1,0x90,0x44,0xf0,0x6,0x90,0x45,0xc9,0x1,0x34,0xc6,0x8f,0x33,0xcf,0x0,0xc6,0x90,0x46,0xe0,0x1,0xcd,0x0,0xc6,0x18,0xc6,0x90,0x42,0xd3,0xc8,0x0,0x0,0xc9,0x1,0x36,0xd0,0x90,0x4b,0xd3,0xc6,0x90,0x42,0xe0,0x1,0xcd,0x0,0xc6,0x18,0xc6,0x90,0x42,0xd3,0xd3,0x0,0x25,0xc0,0x8d,0x51,0x90,0x43,0xc0,0xc0,0xc1,0xb5,0x74,0x22,0x90,0x54,0x90,0x54,0xc1,0x5,0x9e,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x55,0xc,0x90,0x56,0xb0,0xc3,0x8d,0x53,0xc4,0xc4,0x90,0x57,0xe1,0x1,0xc9,0x2,0x39,0xca,0x0,0xd3,0x0,0xc1,0xb5,0x84,0xc1,0xb4,0xea,0xc1,0xb5,0x32,0xc1,0xb5,0xa4,0x28,0x90,0x59,0x90,0x5a,0x90,0x5b,0x90,0x5b,0x90,0x5a,0x90,0x5c,0x90,0x5c,0x90,0x59,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x5d,0xc,0x90,0x56,0xe5,0x39,0xc3,0xc4,0xc4,0xc4,0x90,0x5e,0xf0,0x1,0x90,0x44,0xf0,0x5,0x90,0x53,0xc9,0x1,0x34,0xc6,0x8f,0x33,0xcf,0x0,0xc6,0x90,0x46,0xe0,0x1,0xcd,0x0,0xc6,0x18,0xc6,0x90,0x42,0xd3,0xc9,0x1,0x36,0xd0,0x90,0x58,0xd3,0xc6,0x90,0x42,0xe0,0x1,0xcd,0x0,0xc6,0x18,0xc6,0x90,0x42,0xd3,0xd3,0x0,0x25,0xc0,0x8d,0x51,0xc0,0xc0,0xc0,0xc1,0xb6,0x74,0x22,0x90,0x61,0x90,0x61,0xc1,0x5,0xa0,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x62,0xc,0x90,0x63,0xb0,0xc3,0x8d,0x53,0xc4,0xc4,0x90,0x64,0xe1,0x1,0xc9,0x2,0x39,0xca,0x0,0xd3,0x0,0xc1,0xb6,0x84,0xc1,0xb6,0x8,0x24,0x90,0x66,0x90,0x67,0x90,0x67,0x90,0x66,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x68,0xc,0x90,0x63,0xe5,0x26,0xc3,0xc4,0xc4,0xc4,0x90,0x69,0xe0,0x0,0xf0,0x5,0x90,0x60,0xc9,0x1,0x34,0xc6,0x8f,0x33,0xcf,0x0,0xc6,0x90,0x46,0xc8,0x0,0x0,0xc9,0x1,0x36,0xd0,0x90,0x65,0xd3,0xc6,0x8f,0x44,0xd3,0x0,0xc1,0xb7,0x42,0x22,0x90,0x6b,0x90,0x6b,0xc1,0x5,0xa2,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x6c,0xc,0x90,0x6d,0xb0,0xc3,0x8d,0x53,0xc4,0xc4,0x90,0x6e,0xe1,0x1,0xc9,0x2,0x39,0xca,0x0,0xd3,0x0,0xc1,0xb7,0x52,0xc1,0xb6,0xe0,0x24,0x90,0x70,0x90,0x71,0x90,0x71,0x90,0x70,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x72,0xc,0x90,0x6d,0xe5,0x23,0xc3,0xc4,0xc4,0xc4,0x90,0x73,0xe0,0x0,0xf0,0x4,0x8f,0x32,0xc9,0x1,0x34,0xc6,0x8f,0x33,0xcf,0x0,0xc6,0x90,0x46,0xc9,0x1,0x36,0xd0,0x90,0x6f,0xd3,0xc6,0x8f,0x44,0xd3,0x0,0x5,0x5f,0x65,0x76,0x61,0x6c,0x3,0x65,0x6e,0x76,0x21,0x90,0x76,0x21,0x90,0x77,0xc1,0xb3,0x9c,0xc1,0xb3,0x88,0xc1,0xb4,0xb0,0x2f,0x90,0x79,0x90,0x79,0x90,0x7a,0x90,0x7a,0x90,0x79,0xc0,0xc0,0x90,0x7b,0x90,0x7b,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc1,0x5,0x9a,0x64,0x7,0xc8,0x8,0xc3,0x9,0x90,0x7c,0xc,0x90,0x7d,0xe5,0x3e,0x90,0x75,0x90,0x78,0xc4,0xc4,0x90,0x7e,0xe1,0x2,0xc7,0x19,0xe0,0x1,0xcc,0xc6,0x18,0xc6,0x90,0x42,0xd3,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x90,0x52,0xd3,0xe0,0x1,0xcc,0xc6,0x18,0xc6,0x90,0x42,0xd3,0xe3,0x0,0xd0,0x90,0x5f,0xd3,0xca,0x0,0xe3,0x0,0xd0,0x90,0x6a,0xd3,0xc0,0xe3,0x0,0xd0,0x90,0x74,0xd3,0xd4,0x0,0x4,0x65,0x76,0x61,0x6c,0xf,0x78,0x20,0x3d,0x20,0x34,0x32,0xa,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0xc0,0x54,0xc1,0xb8,0xd8,0xc1,0xb8,0xcc,0x25,0x91,0x3,0x91,0x3,0x91,0x4,0x91,0x4,0x91,0x3,0xc1,0x5,0xac,0x64,0x7,0xc8,0x8,0xc3,0x9,0x91,0x5,0xc,0x91,0x6,0xb8,0xc3,0xc4,0xc4,0xc4,0x91,0x7,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xc6,0x91,0x1,0xc6,0x91,0x0,0xd3,0xc6,0x91,0x2,0xd3,0x0,0xf,0x75,0x6e,0x63,0x61,0x75,0x67,0x68,0x74,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0xd,0x5f,0x73,0x65,0x74,0x5f,0x65,0x78,0x69,0x74,0x63,0x6f,0x64,0x65,0xc1,0xb9,0x84,0xc1,0xb9,0x7a,0xc1,0xb9,0xbc,0xc1,0xb9,0xe0,0xc1,0xb9,0xc6,0x28,0x91,0xb,0x91,0xc,0x91,0xd,0x91,0xd,0x91,0xb,0x91,0xe,0x91,0xf,0x91,0xe,0xc1,0x5,0xb6,0x64,0x7,0xc8,0x8,0xc3,0x9,0x91,0x10,0xc,0x91,0x11,0xbe,0xc3,0x11,0xc4,0xc4,0x91,0x12,0xe1,0x2,0xc7,0x1,0xc6,0x91,0x9,0xe1,0x1,0xc9,0x1,0x23,0xca,0x0,0xd3,0xd3,0xe1,0x1,0xc7,0x49,0xc4,0x1,0xd3,0x0,0xb,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x6c,0x69,0x6e,0x65,0xc1,0xba,0x20,0xc1,0xba,0x4e,0xc1,0xba,0x30,0x27,0x91,0x15,0x91,0x15,0x91,0x16,0x91,0x17,0x91,0x17,0x91,0x16,0x91,0x15,0xc1,0x5,0xba,0x64,0x7,0xc8,0x8,0xc3,0x9,0x91,0x18,0xc,0x91,0x19,0xba,0xc3,0xc4,0xc4,0xc4,0x91,0x1a,0xe1,0x2,0xc7,0x5,0xc4,0x1,0xe1,0x0,0xe1,0x1,0xc9,0x1,0x39,0xc6,0x91,0x14,0xd3,0xd3,0xd3,0x0,0x8,0x72,0x65,0x61,0x64,0x6c,0x69,0x6e,0x6b,0xc1,0xbb,0xd4,0x22,0x91,0x1d,0x91,0x1d,0xc1,0x5,0xc4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x91,0x1e,0xc,0x91,0x1f,0xb3,0xc3,0x8d,0x53,0xc4,0xc4,0x91,0x20,0xe1,0x2,0xc9,0x1,0x39,0xca,0x0,0xc9,0x0,0x1,0xd3,0x0,0x7,0x72,0x75,0x6e,0x6d,0x61,0x69,0x6e,0x2,0x61,0x73,0x21,0x91,0x23,0x21,0x91,0x24,0x22,0x8b,0x4f,0x8e,0x4c,0xc1,0xb9,0x62,0xc1,0xba,0x8,0xc1,0xb9,0xfc,0xc1,0xba,0xd2,0xc1,0xba,0xfe,0xc1,0xbb,0x4,0xc1,0xbb,0x46,0xc1,0xbb,0xf0,0xc1,0xbb,0x58,0xc1,0xbb,0x82,0xc1,0xbb,0x64,0xc1,0xbb,0xfe,0x3c,0x91,0x27,0x91,0x27,0x91,0x27,0xc0,0x91,0x28,0x91,0x28,0x91,0x29,0x91,0x29,0x91,0x28,0xc0,0x91,0x2a,0x91,0x2a,0x91,0x2b,0x91,0x2c,0x91,0x2c,0x91,0x2b,0x91,0x2d,0x91,0x2d,0x91,0x2e,0x91,0x2f,0x91,0x30,0x91,0x31,0x91,0x30,0x91,0x2f,0x91,0x32,0x91,0x32,0x91,0x2e,0x91,0x2d,0xc1,0x5,0xb4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x91,0x33,0xc,0x91,0x34,0xe5,0x7f,0x91,0x22,0x91,0x25,0x91,0x26,0x83,0x0,0x91,0x35,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x91,0x13,0xd3,0xf1,0x2,0x2a,0xc9,0x0,0x0,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xca,0x0,0xc6,0x81,0x37,0xd3,0xc4,0x0,0xd3,0xd0,0x91,0x1b,0xd3,0xe0,0x1,0xca,0x0,0xc6,0x18,0xc4,0x1,0xd3,0xd1,0x0,0xe1,0x1,0xc9,0x0,0x2b,0xe0,0x2,0xc9,0x0,0x3a,0xc6,0x91,0x1c,0xcb,0x0,0xcb,0x0,0xd3,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x5,0xc4,0x0,0xe0,0x1,0xf0,0x4,0x8f,0x32,0xc9,0x0,0x34,0xc6,0x8f,0x33,0xe1,0x1,0xc7,0x47,0xcb,0x0,0xd3,0xcb,0x0,0xc9,0x0,0x36,0xd0,0x91,0x21,0xd3,0xc6,0x8f,0x44,0xe0,0x2,0xca,0x0,0xc6,0x87,0x1b,0xc4,0x2,0xc2,0xd3,0xd3,0xd3,0x0,0x9,0x5f,0x54,0x61,0x73,0x6b,0x5f,0x6e,0x65,0x77,0xc1,0xbc,0x2a,0x22,0x91,0x38,0x91,0x38,0xc1,0x5,0xc8,0x64,0x7,0xc8,0x8,0xc3,0x9,0x91,0x39,0xc,0x91,0x3a,0xaf,0xc3,0xc4,0xc4,0xc4,0x91,0x3b,0xe1,0x1,0xc9,0x0,0x3c,0xcd,0x0,0xd3,0x0,0x6,0x69,0x6f,0x6c,0x6f,0x6f,0x70,0xc1,0xbd,0x82,0xc1,0xbd,0x78,0xc1,0xbd,0x94,0xc1,0xbd,0x9e,0x27,0x91,0x3e,0x91,0x3f,0x91,0x40,0x91,0x41,0x91,0x41,0x91,0x40,0x91,0x3e,0xc1,0x5,0xd4,0x64,0x7,0xc8,0x8,0xc3,0x9,0x91,0x42,0xc,0x91,0x43,0xbb,0xc3,0xc4,0xc4,0xc4,0x91,0x44,0xe1,0x1,0xc7,0x1,0xe1,0x1,0xc9,0x0,0x23,0xe0,0x0,0xc9,0x0,0x3d,0xc6,0x8d,0x2c,0xd3,0xd3,0xd3,0x0,0x6,0x3c,0x6d,0x61,0x69,0x6e,0x3e,0x4,0x4d,0x6f,0x63,0x6b,0xd,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x70,0x61,0x74,0x68,0x73,0x8,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x73,0x2,0x5f,0x78,0x4,0x6d,0x61,0x69,0x6e,0xe1,0x3e,0x1a,0x32,0x44,0x5e,0x74,0x81,0x0,0x81,0x9,0x81,0x12,0x81,0x24,0x81,0x2f,0x81,0x38,0x81,0x58,0x82,0x3,0x82,0x4b,0x83,0x7,0x83,0x33,0x83,0x49,0x83,0x68,0x84,0xe,0x84,0x24,0x84,0x43,0x84,0x75,0x85,0x17,0x85,0x24,0x85,0x4a,0x85,0x54,0x85,0x69,0x86,0x10,0x86,0x19,0x86,0x32,0x86,0x49,0x87,0x42,0x87,0x71,0x88,0x24,0x88,0x68,0x6,0x8a,0x2b,0x8a,0x47,0x8a,0x5b,0x8a,0x74,0x8b,0x12,0x8b,0x29,0x8c,0x28,0x8c,0x4a,0x8c,0x70,0x8d,0x0,0x8c,0x7f,0x75,0x91,0x47,0x91,0x48,0x91,0x49,0x8e,0x4b,0x8e,0x6d,0x8e,0x68,0x8e,0x68,0x91,0x4a,0x90,0x13,0x90,0x38,0x90,0x41,0x90,0x75,0x91,0x22,0x91,0x4b,0xe1,0x3e,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0x5,0x6c,0x69,0x6e,0x65,0x73,0xc1,0x1,0x72,0xc1,0x1,0x74,0xc1,0x1,0xda,0xc1,0x2,0x1c,0xc1,0x2,0xb6,0xc1,0x2,0xb8,0xc1,0x3,0x24,0xc1,0x3,0x44,0xc1,0x3,0x7a,0xc1,0x3,0xe2,0xc1,0x4,0x2,0xc1,0x4,0x3e,0xc1,0x4,0x60,0xc1,0x4,0xe8,0xc1,0x5,0x36,0xc1,0x5,0x58,0xc1,0x5,0xcc,0xc1,0x6,0x2,0xc1,0x6,0x3e,0xc1,0x6,0x92,0xc1,0x6,0xa8,0xc1,0x6,0xaa,0xc1,0x6,0xf0,0xc1,0x7,0x3c,0xc1,0x7,0x9a,0xc1,0x7,0x9c,0xc1,0x7,0xb8,0xc1,0x7,0xe8,0xc1,0x8,0x2,0xc1,0x8,0x4,0xc1,0x8,0x20,0xc1,0x8,0x50,0xc1,0x8,0x6a,0xc1,0x8,0x6c,0xc1,0x8,0xdc,0xc1,0x9,0x3e,0xc1,0x9,0x40,0xc1,0x9,0xcc,0xc1,0xa,0x86,0xc1,0xb,0x24,0xc1,0xb,0xd4,0xc1,0xb,0xf0,0xc1,0xc,0x1e,0xc1,0xc,0x98,0xc1,0xc,0x9a,0xc1,0xc,0xc4,0xc1,0xc,0xe2,0xc1,0xd,0xc,0xc1,0xd,0x2c,0xc1,0xd,0x7a,0xc1,0xd,0xba,0xc1,0xd,0xbc,0xc1,0xe,0x60,0xc1,0xf,0x12,0xc1,0xf,0xb0,0xc1,0x10,0x0,0xc1,0x10,0x1a,0xc1,0x10,0x48,0xc1,0x10,0xc0,0xc1,0x10,0xc2,0xc1,0x10,0xec,0xc1,0x11,0xa,0xc1,0x11,0xc,0xc1,0x11,0x34,0xc1,0x11,0x5e,0xc1,0x11,0x7e,0xc1,0x11,0xd4,0xc1,0x12,0x1c,0xc1,0x12,0x42,0xc1,0x12,0x6e,0xc1,0x12,0x70,0xc1,0x13,0x26,0xc1,0x13,0x7e,0xc1,0x14,0x4c,0xc1,0x14,0x84,0xc1,0x14,0xce,0xc1,0x15,0x58,0xc1,0x15,0xac,0xc1,0x15,0xd6,0xc1,0x16,0x8,0xc1,0x16,0x48,0xc1,0x16,0x92,0xc1,0x16,0xc2,0xc1,0x16,0xf0,0xc1,0x17,0x28,0xc1,0x17,0x5e,0xc1,0x17,0xe0,0xc1,0x18,0x20,0xc1,0x18,0x54,0xc1,0x18,0xac,0xc1,0x18,0xd6,0xc1,0x18,0xf4,0xc1,0x19,0x2a,0xc1,0x19,0x62,0xc1,0x19,0xcc,0xc1,0x19,0xee,0xc1,0x1a,0x4,0xc1,0x1a,0x6,0xc1,0x1a,0xc8,0xc1,0x1a,0xfa,0xc1,0x1b,0x9c,0xc1,0x1c,0x4,0xc1,0x1c,0x54,0xc1,0x1c,0x82,0xc1,0x1c,0xb0,0xc1,0x1c,0xea,0xc1,0x1c,0xec,0xc1,0x1d,0x14,0xc1,0x1d,0x4a,0xc1,0x1d,0x4c,0xc1,0x1d,0x74,0xc1,0x1d,0x92,0xc1,0x1d,0xa6,0xc1,0x1d,0xc6,0xc1,0x1e,0x14,0xc1,0x1e,0x3e,0xc1,0x1e,0x86,0xc1,0x1e,0xc0,0xc1,0x1e,0xf2,0xc1,0x1e,0xf4,0xc1,0x1f,0x82,0xc1,0x1f,0xe8,0xc1,0x20,0x72,0xc1,0x21,0x28,0xc1,0x21,0x9c,0xc1,0x21,0xfe,0xc1,0x22,0x7a,0xc1,0x22,0xde,0xc1,0x23,0x32,0xc1,0x23,0x52,0xc1,0x23,0x8c,0xc1,0x23,0xfa,0xc1,0x23,0xfc,0xc1,0x24,0x1a,0xc1,0x24,0x42,0xc1,0x24,0xaa,0xc1,0x25,0x12,0xc1,0x25,0x14,0xc1,0x25,0x4a,0xc1,0x25,0x9c,0xc1,0x25,0xbc,0xc1,0x25,0xdc,0xc1,0x25,0xde,0xc1,0x26,0x54,0xc1,0x26,0x68,0xc1,0x26,0x8a,0xc1,0x26,0xc6,0xc1,0x26,0xe6,0xc1,0x26,0xe8,0xc1,0x27,0x3a,0xc1,0x27,0x5e,0xc1,0x27,0xaa,0xc1,0x27,0xf6,0xc1,0x28,0x24,0xc1,0x28,0x94,0xc1,0x28,0xb4,0xc1,0x28,0xb6,0xc1,0x29,0x6,0xc1,0x29,0x2a,0xc1,0x29,0x76,0xc1,0x29,0xc2,0xc1,0x29,0xf0,0xc1,0x2a,0x5e,0xc1,0x2a,0x7e,0xc1,0x2a,0x80,0xc1,0x2a,0xf6,0xc1,0x2b,0x1c,0xc1,0x2b,0x68,0xc1,0x2b,0x9a,0xc1,0x2b,0x9c,0xc1,0x2b,0xf0,0xc1,0x2c,0x1a,0xc1,0x2c,0x66,0xc1,0x2c,0xb2,0xc1,0x2c,0xe0,0xc1,0x2d,0x12,0xc1,0x2d,0x70,0xc1,0x2d,0xd2,0xc1,0x2d,0xd4,0xc1,0x2e,0x20,0xc1,0x2e,0x52,0xc1,0x2e,0x7a,0xc1,0x2e,0xa2,0xc1,0x2e,0xc4,0xc1,0x2e,0xf2,0xc1,0x2f,0x26,0xc1,0x2f,0xb0,0xc1,0x30,0x66,0xc1,0x30,0x94,0xc1,0x30,0xee,0xc1,0x31,0x48,0xc1,0x31,0x4a,0xc1,0x31,0x80,0xc1,0x31,0xac,0xc1,0x32,0x10,0xc1,0x32,0x38,0xc1,0x32,0x6e,0xc1,0x32,0xca,0xc1,0x32,0xf8,0xc1,0x32,0xfa,0xc1,0x33,0x40,0xc1,0x33,0xea,0xc1,0x34,0x5c,0xc1,0x34,0x5e,0xc1,0x34,0x84,0xc1,0x34,0xac,0xc1,0x34,0xca,0xc1,0x34,0xf4,0xc1,0x35,0x42,0xc1,0x35,0x94,0xc1,0x35,0xc2,0xc1,0x35,0xf6,0xc1,0x36,0x20,0xc1,0x36,0x30,0xc1,0x36,0x32,0xc1,0x36,0xb0,0xc1,0x37,0x14,0xc1,0x37,0x16,0xc1,0x37,0x9e,0xc1,0x37,0xee,0xc1,0x38,0x22,0xc1,0x38,0x3e,0xc1,0x38,0x78,0xc1,0x38,0xb4,0xc1,0x38,0xfe,0xc1,0x39,0x38,0xc1,0x39,0x58,0xc1,0x39,0x5a,0xc1,0x39,0xb4,0xc1,0x39,0xe2,0xc1,0x3a,0x4,0xc1,0x3a,0x64,0xc1,0x3a,0xc6,0xc1,0x3a,0xec,0xc1,0x3a,0xf8,0xc1,0x3a,0xfa,0xc1,0x3b,0xc2,0xc1,0x3c,0x66,0xc1,0x3c,0xbe,0xc1,0x3c,0xda,0xc1,0x3d,0x2,0xc1,0x3d,0x34,0xc1,0x3d,0x60,0xc1,0x3d,0x62,0xc1,0x3d,0xd4,0xc1,0x3e,0x3a,0xc1,0x3e,0x58,0xc1,0x3e,0x9a,0xc1,0x3e,0xc2,0xc1,0x3e,0xc4,0xc1,0x3f,0x6,0xc1,0x3f,0x24,0xc1,0x3f,0x5a,0xc1,0x3f,0xc4,0xc1,0x3f,0xe4,0xc1,0x40,0x4,0xc1,0x40,0x6,0xc1,0x40,0x5a,0xc1,0x40,0x5c,0xc1,0x41,0xe,0xc1,0x41,0x66,0xc1,0x41,0x9c,0xc1,0x42,0xa,0xc1,0x42,0x66,0xc1,0x42,0xe8,0xc1,0x43,0x24,0xc1,0x43,0xa6,0xc1,0x43,0xc4,0xc1,0x44,0x54,0xc1,0x44,0xa4,0xc1,0x45,0x28,0xc1,0x45,0x58,0xc1,0x45,0x8c,0xc1,0x45,0x8e,0xc1,0x45,0xb6,0xc1,0x45,0xb8,0xc1,0x45,0xe0,0xc1,0x46,0x4a,0xc1,0x46,0x9e,0xc1,0x46,0xf8,0xc1,0x47,0x74,0xc1,0x47,0x76,0xc1,0x47,0x9c,0xc1,0x48,0x18,0xc1,0x48,0x88,0xc1,0x48,0xee,0xc1,0x49,0x48,0xc1,0x49,0x6e,0xc1,0x49,0x70,0xc1,0x49,0x92,0xc1,0x49,0xbe,0xc1,0x49,0xf2,0xc1,0x49,0xf4,0xc1,0x4a,0x1c,0xc1,0x4a,0x5a,0xc1,0x4a,0x82,0xc1,0x4a,0xc6,0xc1,0x4a,0xec,0xc1,0x4b,0x1e,0xc1,0x4b,0x70,0xc1,0x4b,0xd0,0xc1,0x4c,0x24,0xc1,0x4c,0x52,0xc1,0x4c,0x94,0xc1,0x4c,0xac,0xc1,0x4c,0xd8,0xc1,0x4c,0xda,0xc1,0x4d,0x4c,0xc1,0x4d,0xc2,0xc1,0x4d,0xe0,0xc1,0x4e,0x12,0xc1,0x4e,0x4c,0xc1,0x4e,0xb8,0xc1,0x4e,0xba,0xc1,0x4e,0xda,0xc1,0x4e,0xee,0xc1,0x4f,0x2c,0xc1,0x4f,0x4e,0xc1,0x4f,0x74,0xc1,0x4f,0x76,0xc1,0x4f,0xf8,0xc1,0x50,0x6a,0xc1,0x50,0x8a,0xc1,0x50,0xf4,0xc1,0x51,0x2e,0xc1,0x51,0x94,0xc1,0x51,0x96,0xc1,0x51,0xfc,0xc1,0x52,0x62,0xc1,0x52,0x64,0xc1,0x52,0x8a,0xc1,0x52,0x9e,0xc1,0x52,0xd8,0xc1,0x52,0xfa,0xc1,0x53,0x20,0xc1,0x53,0x22,0xc1,0x53,0x72,0xc1,0x53,0xb6,0xc1,0x53,0xb8,0xc1,0x53,0xd0,0xc1,0x54,0xa,0xc1,0x54,0x50,0xc1,0x54,0xa0,0xc1,0x54,0xe8,0xc1,0x55,0x40,0xc1,0x55,0xcc,0xc1,0x55,0xec,0xc1,0x55,0xee,0xc1,0x56,0xe,0xc1,0x56,0x34,0xc1,0x56,0x5a,0xc1,0x56,0x72,0xc1,0x56,0x74,0xc1,0x56,0x8e,0xc1,0x57,0x12,0xc1,0x57,0x96,0xc1,0x58,0x48,0xc1,0x58,0x9e,0xc1,0x58,0xe0,0xc1,0x59,0x38,0xc1,0x59,0x60,0xc1,0x59,0xaa,0xc1,0x59,0xc4,0xc1,0x59,0xcc,0xc1,0x59,0xce,0xc1,0x5a,0x50,0xc1,0x5a,0xce,0xc1,0x5b,0x2e,0xc1,0x5b,0x56,0xc1,0x5b,0x8c,0xc1,0x5b,0xae,0xc1,0x5b,0xb6,0xc1,0x5c,0x4,0xc1,0x5c,0x4e,0xc1,0x5c,0xac,0xc1,0x5c,0xae,0xc1,0x5c,0xfa,0xc1,0x5d,0x46,0xc1,0x5d,0x8e,0xc1,0x5d,0xea,0xc1,0x5d,0xec,0xc1,0x5e,0xa8,0xc1,0x5e,0xfa,0xc1,0x5f,0xae,0xc1,0x60,0x24,0xc1,0x60,0x6a,0xc1,0x60,0xba,0xc1,0x61,0x4,0xc1,0x61,0xc,0xc1,0x61,0xe,0xc1,0x61,0x58,0xc1,0x61,0x9e,0xc1,0x61,0xe8,0xc1,0x62,0x3a,0xc1,0x62,0x8c,0xc1,0x62,0xe2,0xc1,0x63,0x2c,0xc1,0x63,0x2e,0xc1,0x63,0x8a,0xc1,0x63,0xd6,0xc1,0x64,0x1e,0xc1,0x64,0x78,0xc1,0x64,0xc2,0xc1,0x65,0x8,0xc1,0x65,0x52,0xc1,0x65,0xa4,0xc1,0x65,0xf6,0xc1,0x66,0x3c,0xc1,0x66,0x82,0xc1,0x66,0xc8,0xc1,0x67,0x12,0xc1,0x67,0x64,0xc1,0x67,0xae,0xc1,0x68,0xc,0xc1,0x68,0x62,0xc1,0x68,0xac,0xc1,0x68,0xae,0xc1,0x69,0x6,0xc1,0x69,0x40,0xc1,0x69,0xaa,0xc1,0x6a,0xc,0xc1,0x6a,0x14,0xc1,0x6a,0x68,0xc1,0x6a,0xa2,0xc1,0x6b,0xa,0xc1,0x6b,0x6a,0xc1,0x6b,0x72,0xc1,0x6b,0xa4,0xc1,0x6b,0xde,0xc1,0x6c,0x48,0xc1,0x6c,0x7c,0xc1,0x6c,0xe6,0xc1,0x6c,0xea,0xc1,0x6d,0x1a,0xc1,0x6d,0x54,0xc1,0x6d,0xbc,0xc1,0x6d,0xf0,0xc1,0x6e,0x58,0xc1,0x6e,0x5c,0xc1,0x6e,0x92,0xc1,0x6e,0xcc,0xc1,0x6f,0x3a,0xc1,0x6f,0x88,0xc1,0x6f,0x8c,0xc1,0x6f,0xda,0xc1,0x70,0x24,0xc1,0x70,0x7a,0xc1,0x70,0x7c,0xc1,0x71,0x3a,0xc1,0x71,0x66,0xc1,0x71,0xa0,0xc1,0x72,0x8,0xc1,0x72,0x30,0xc1,0x72,0x94,0xc1,0x72,0xb2,0xc1,0x72,0xb6,0xc1,0x72,0xb8,0xc1,0x73,0x7c,0xc1,0x73,0xae,0xc1,0x73,0xe8,0xc1,0x74,0x56,0xc1,0x74,0xd0,0xc1,0x74,0xf0,0xc1,0x74,0xf4,0xc1,0x74,0xf6,0xc1,0x75,0x52,0xc1,0x75,0xba,0xc1,0x75,0xbc,0xc1,0x76,0x20,0xc1,0x76,0x74,0xc1,0x76,0xd0,0xc1,0x77,0x1c,0xc1,0x77,0x64,0xc1,0x77,0xb0,0xc1,0x78,0x4,0xc1,0x78,0x58,0xc1,0x78,0xa0,0xc1,0x78,0xe8,0xc1,0x79,0x30,0xc1,0x79,0x7c,0xc1,0x79,0xd0,0xc1,0x7a,0x1c,0xc1,0x7a,0x90,0xc1,0x7a,0xe8,0xc1,0x7b,0x34,0xc1,0x7b,0x36,0xc1,0x7b,0x8e,0xc1,0x7b,0xe2,0xc1,0x7c,0x42,0xc1,0x7c,0x44,0xc1,0x7c,0x7a,0xc1,0x7c,0xb8,0xc1,0x7d,0x68,0xc1,0x7d,0x6a,0xc1,0x7d,0xc0,0xc1,0x7e,0x26,0xc1,0x7e,0x8e,0xc1,0x7e,0xc4,0xc1,0x7e,0xf8,0xc1,0x7f,0x1c,0xc1,0x7f,0x4a,0xc1,0x7f,0x9e,0xc1,0x80,0x0,0xc1,0x80,0x26,0xc1,0x80,0x42,0xc1,0x80,0xa2,0xc1,0x80,0xe0,0xc1,0x81,0x58,0xc1,0x81,0x80,0xc1,0x81,0xae,0xc1,0x81,0xb4,0xc1,0x81,0xfa,0xc1,0x82,0x2e,0xc1,0x82,0x52,0xc1,0x82,0x80,0xc1,0x82,0xd4,0xc1,0x83,0x20,0xc1,0x83,0x90,0xc1,0x83,0xbe,0xc1,0x83,0xe2,0xc1,0x84,0x40,0xc1,0x84,0x86,0xc1,0x85,0x6,0xc1,0x85,0x36,0xc1,0x85,0x64,0xc1,0x85,0x6a,0xc1,0x85,0x6c,0xc1,0x85,0x90,0xc1,0x85,0xf2,0xc1,0x86,0x20,0xc1,0x86,0x40,0xc1,0x86,0x8c,0xc1,0x86,0xc0,0xc1,0x86,0xe2,0xc1,0x86,0xe4,0xc1,0x87,0x50,0xc1,0x87,0x52,0xc1,0x87,0x76,0xc1,0x87,0xc4,0xc1,0x87,0xf8,0xc1,0x88,0x2e,0xc1,0x88,0x5e,0xc1,0x88,0xb4,0xc1,0x88,0xe6,0xc1,0x88,0xe8,0xc1,0x89,0x30,0xc1,0x89,0x7a,0xc1,0x89,0xc6,0xc1,0x8a,0x16,0xc1,0x8a,0x8a,0xc1,0x8b,0x1a,0xc1,0x8b,0x1c,0xc1,0x8b,0x42,0xc1,0x8b,0x90,0xc1,0x8b,0xc6,0xc1,0x8b,0xf8,0xc1,0x8b,0xfa,0xc1,0x8c,0x56,0xc1,0x8c,0xb4,0xc1,0x8d,0x14,0xc1,0x8d,0x88,0xc1,0x8d,0x8a,0xc1,0x8d,0xba,0xc1,0x8d,0xea,0xc1,0x8d,0xec,0xc1,0x8e,0x0,0xc1,0x8e,0x9c,0xc1,0x8e,0xc4,0xc1,0x8e,0xc6,0xc1,0x8f,0x22,0xc1,0x8f,0xf0,0xc1,0x90,0xb0,0xc1,0x90,0xd4,0xc1,0x91,0x30,0xc1,0x91,0x6c,0xc1,0x91,0xa2,0xc1,0x91,0xb4,0xc1,0x91,0xf6,0xc1,0x92,0x10,0xc1,0x92,0x42,0xc1,0x92,0xd4,0xc1,0x93,0x2e,0xc1,0x93,0x8c,0xc1,0x93,0xf8,0xc1,0x94,0xc,0xc1,0x94,0x20,0xc1,0x94,0x8c,0xc1,0x94,0xd2,0xc1,0x95,0xac,0xc1,0x96,0x44,0xc1,0x96,0x7e,0xc1,0x96,0xaa,0xc1,0x97,0x60,0xc1,0x97,0xd6,0xc1,0x97,0xea,0xc1,0x97,0xee,0xc1,0x97,0xf0,0xc1,0x98,0x4,0xc1,0x98,0x6,0xc1,0x98,0x22,0xc1,0x98,0x5c,0xc1,0x98,0xd4,0xc1,0x98,0xd6,0xc1,0x99,0xa,0xc1,0x99,0x2c,0xc1,0x99,0x58,0xc1,0x99,0xb6,0xc1,0x99,0xe2,0xc1,0x9a,0x10,0xc1,0x9a,0x38,0xc1,0x9a,0x58,0xc1,0x9a,0x82,0xc1,0x9a,0xf0,0xc1,0x9b,0x5c,0xc1,0x9b,0x5e,0xc1,0x9b,0x60,0xc1,0x9b,0x96,0xc1,0x9b,0xca,0xc1,0x9b,0xcc,0xc1,0x9b,0xf8,0xc1,0x9c,0xc6,0xc1,0x9c,0xc8,0xc1,0x9d,0x12,0xc1,0x9d,0x40,0xc1,0x9d,0x42,0xc1,0x9d,0xaa,0xc1,0x9d,0xf0,0xc1,0x9e,0xa,0xc1,0x9e,0x44,0xc1,0x9e,0xce,0xc1,0x9f,0x8,0xc1,0x9f,0x3c,0xc1,0x9f,0xc6,0xc1,0x9f,0xe6,0xc1,0x9f,0xe8,0xc1,0xa0,0x38,0xc1,0xa0,0x3a,0xc1,0xa0,0x54,0xc1,0xa0,0x88,0xc1,0xa0,0xba,0xc1,0xa0,0xf6,0xc1,0xa1,0x34,0xc1,0xa1,0xda,0xc1,0xa2,0x32,0xc1,0xa2,0x72,0xc1,0xa2,0xc8,0xc1,0xa3,0x36,0xc1,0xa3,0x3a,0xc1,0xa3,0x3c,0xc1,0xa3,0x62,0xc1,0xa3,0x8e,0xc1,0xa3,0xba,0xc1,0xa3,0xbc,0xc1,0xa4,0x20,0xc1,0xa4,0x84,0xc1,0xa4,0xbe,0xc1,0xa4,0xc0,0xc1,0xa4,0xce,0xc1,0xa5,0x0,0xc1,0xa5,0x1a,0xc1,0xa5,0x3c,0xc1,0xa5,0x40,0xc1,0xa5,0x6c,0xc1,0xa5,0x6e,0xc1,0xa5,0xa0,0xc1,0xa5,0xd2,0xc1,0xa6,0x14,0xc1,0xa6,0x66,0xc1,0xa6,0xf4,0xc1,0xa7,0x62,0xc1,0xa8,0x30,0xc1,0xa8,0x8c,0xc1,0xa9,0x2c,0xc1,0xa9,0x66,0xc1,0xaa,0x36,0xc1,0xaa,0xca,0xc1,0xaa,0xfa,0xc1,0xab,0x48,0xc1,0xab,0xa8,0xc1,0xab,0xc2,0xc1,0xac,0x10,0xc1,0xac,0xb6,0xc1,0xac,0xf0,0xc1,0xad,0xb6,0xc1,0xae,0x4a,0xc1,0xae,0x7a,0xc1,0xae,0xc8,0xc1,0xaf,0x2a,0xc1,0xaf,0x44,0xc1,0xaf,0xa0,0xc1,0xb0,0x48,0xc1,0xb0,0x7e,0xc1,0xb0,0xcc,0xc1,0xb0,0xec,0xc1,0xb1,0x70,0xc1,0xb1,0x72,0xc1,0xb1,0xa2,0xc1,0xb1,0xec,0xc1,0xb2,0x1a,0xc1,0xb2,0x58,0xc1,0xb2,0x82,0xc1,0xb2,0x84,0xc1,0xb2,0x86,0xc1,0xb2,0xac,0xc1,0xb2,0xae,0xc1,0xb3,0x46,0xc1,0xb3,0x74,0xc1,0xb4,0x9c,0xc1,0xb5,0xba,0xc1,0xb6,0x92,0xc1,0xb7,0x60,0xc1,0xb7,0x62,0xc1,0xb8,0x36,0xc1,0xb8,0x84,0xc1,0xb8,0x86,0xc1,0xb8,0xa0,0xc1,0xb8,0xe4,0xc1,0xb8,0xe6,0xc1,0xb9,0x3a,0xc1,0xb9,0x5a,0xc1,0xb9,0xe8,0xc1,0xb9,0xea,0xc1,0xba,0x54,0xc1,0xba,0xb6,0xc1,0xba,0xb8,0xc1,0xba,0xda,0xc1,0xbb,0x32,0xc1,0xbc,0xa,0xc1,0xbc,0xc,0xc1,0xbc,0x38,0xc1,0xbc,0x3a,0xc1,0xbc,0xb2,0xc1,0xbc,0xc6,0xc1,0xbc,0xc8,0xc1,0xbd,0x5a,0xc1,0xbd,0xae,0xc1,0xbd,0xb8,0xe1,0x85,0x6c,0xd2,0x81,0x74,0x83,0x4,0x91,0x4f,0x91,0x50,0x85,0x66,0x91,0x51,0x91,0x52,0x91,0x53,0x91,0x54,0x89,0x18,0x91,0x55,0x91,0x56,0x91,0x57,0x8a,0x3d,0x8b,0x19,0x91,0x58,0x91,0x59,0x8c,0x1e,0x91,0x5a,0x91,0x5b,0x91,0x5c,0x8e,0x3b,0x91,0x5d,0x8f,0x2b,0x91,0x5e,0x91,0x5f,0x91,0x60,0x91,0x61,0x91,0x62,0x91,0x63,0x91,0x64,0x91,0x65,0x91,0x66,0x91,0x67,0x91,0x68,0x91,0x69,0x91,0x6a,0x91,0x6b,0x91,0x6c,0x91,0x6d,0x91,0x6e,0x91,0x6f,0x91,0x70,0x91,0x71,0x91,0x72,0x91,0x73,0x91,0x74,0x91,0x75,0x91,0x76,0x91,0x77,0x91,0x78,0x91,0x79,0x91,0x7a,0x91,0x7b,0x91,0x7c,0x91,0x7d,0x91,0x7e,0x91,0x7f,0x92,0x0,0x92,0x1,0x92,0x2,0x92,0x3,0x92,0x4,0x92,0x5,0x92,0x6,0x92,0x7,0x92,0x8,0x92,0x9,0x92,0xa,0x92,0xb,0x92,0xc,0x92,0xd,0x92,0xe,0x92,0xf,0x92,0x10,0x92,0x11,0x92,0x12,0x92,0x13,0x92,0x14,0x92,0x15,0x92,0x16,0x92,0x17,0x92,0x18,0x92,0x19,0x92,0x1a,0x92,0x1b,0x92,0x1c,0x92,0x1d,0x92,0x1e,0x92,0x1f,0x92,0x20,0x92,0x21,0x92,0x22,0x92,0x23,0x92,0x24,0x92,0x25,0x92,0x26,0x92,0x27,0x92,0x28,0x92,0x29,0x92,0x2a,0x92,0x2b,0x92,0x2c,0x92,0x2d,0x92,0x2e,0x92,0x2f,0x92,0x30,0x92,0x31,0x92,0x32,0x92,0x33,0x92,0x34,0x92,0x35,0x92,0x36,0x92,0x37,0x92,0x38,0x92,0x39,0x92,0x3a,0x92,0x3b,0x92,0x3c,0x92,0x3d,0x92,0x3e,0x92,0x3f,0x92,0x40,0x92,0x41,0x92,0x42,0x92,0x43,0x92,0x44,0x92,0x45,0x92,0x46,0x92,0x47,0x92,0x48,0x92,0x49,0x92,0x4a,0x92,0x4b,0x92,0x4c,0x92,0x4d,0x92,0x4e,0x92,0x4f,0x92,0x50,0x92,0x51,0x92,0x52,0x92,0x53,0x92,0x54,0x92,0x55,0x92,0x56,0x92,0x57,0x92,0x58,0x92,0x59,0x92,0x5a,0x92,0x5b,0x92,0x5c,0x92,0x5d,0x92,0x5e,0x92,0x5f,0x92,0x60,0x92,0x61,0x92,0x62,0x92,0x63,0x92,0x64,0x92,0x65,0x92,0x66,0x92,0x67,0x92,0x68,0x92,0x69,0x92,0x6a,0x92,0x6b,0x92,0x6c,0x92,0x6d,0x92,0x6e,0x92,0x6f,0x92,0x70,0x92,0x71,0x92,0x72,0x92,0x73,0x92,0x74,0x92,0x75,0x92,0x76,0x92,0x77,0x92,0x78,0x92,0x79,0x92,0x7a,0x92,0x7b,0x92,0x7c,0x92,0x7d,0x92,0x7e,0x92,0x7f,0x93,0x0,0x93,0x1,0x93,0x2,0x93,0x3,0x93,0x4,0x93,0x5,0x93,0x6,0x93,0x7,0x93,0x8,0x93,0x9,0x93,0xa,0x93,0xb,0x93,0xc,0x93,0xd,0x93,0xe,0x93,0xf,0x93,0x10,0x93,0x11,0x93,0x12,0x93,0x13,0x93,0x14,0x93,0x15,0x93,0x16,0x93,0x17,0x93,0x18,0x93,0x19,0x93,0x1a,0x93,0x1b,0x93,0x1c,0x93,0x1d,0x93,0x1e,0x93,0x1f,0x93,0x20,0x93,0x21,0x93,0x22,0x93,0x23,0x93,0x24,0x93,0x25,0x93,0x26,0x93,0x27,0x93,0x28,0x93,0x29,0x93,0x2a,0x93,0x2b,0x93,0x2c,0x93,0x2d,0x93,0x2e,0x93,0x2f,0x93,0x30,0x93,0x31,0x93,0x32,0x93,0x33,0x93,0x34,0x93,0x35,0x93,0x36,0x93,0x37,0x93,0x38,0x93,0x39,0x93,0x3a,0x93,0x3b,0x93,0x3c,0x93,0x3d,0x93,0x3e,0x93,0x3f,0x93,0x40,0x93,0x41,0x93,0x42,0x93,0x43,0x93,0x44,0x93,0x45,0x93,0x46,0x93,0x47,0x93,0x48,0x93,0x49,0x93,0x4a,0x93,0x4b,0x93,0x4c,0x93,0x4d,0x93,0x4e,0x93,0x4f,0x93,0x50,0x93,0x51,0x93,0x52,0x93,0x53,0x93,0x54,0x93,0x55,0x93,0x56,0x93,0x57,0x93,0x58,0x93,0x59,0x93,0x5a,0x93,0x5b,0x93,0x5c,0x93,0x5d,0x93,0x5e,0x93,0x5f,0x93,0x60,0x93,0x61,0x93,0x62,0x93,0x63,0x93,0x64,0x93,0x65,0x93,0x66,0x93,0x67,0x93,0x68,0x93,0x69,0x93,0x6a,0x93,0x6b,0x93,0x6c,0x93,0x6d,0x93,0x6e,0x93,0x6f,0x93,0x70,0x93,0x71,0x93,0x72,0x93,0x73,0x93,0x74,0x93,0x75,0x93,0x76,0x93,0x77,0x93,0x78,0x93,0x79,0x93,0x7a,0x93,0x7b,0x93,0x7c,0x93,0x7d,0x93,0x7e,0x93,0x7f,0x94,0x0,0x94,0x1,0x94,0x2,0x94,0x3,0x94,0x4,0x94,0x5,0x94,0x6,0x94,0x7,0x94,0x8,0x94,0x9,0x94,0xa,0x94,0xb,0x94,0xc,0x94,0xd,0x94,0xe,0x94,0xf,0x94,0x10,0x94,0x11,0x94,0x12,0x94,0x13,0x94,0x14,0x94,0x15,0x94,0x16,0x94,0x17,0x94,0x18,0x94,0x19,0x94,0x1a,0x94,0x1b,0x94,0x1c,0x94,0x1d,0x94,0x1e,0x94,0x1f,0x94,0x20,0x94,0x21,0x94,0x22,0x94,0x23,0x94,0x24,0x94,0x25,0x94,0x26,0x94,0x27,0x94,0x28,0x94,0x29,0x94,0x2a,0x94,0x2b,0x94,0x2c,0x94,0x2d,0x94,0x2e,0x94,0x2f,0x94,0x30,0x94,0x31,0x94,0x32,0x94,0x33,0x94,0x34,0x94,0x35,0x94,0x36,0x94,0x37,0x94,0x38,0x94,0x39,0x94,0x3a,0x94,0x3b,0x94,0x3c,0x94,0x3d,0x94,0x3e,0x94,0x3f,0x94,0x40,0x94,0x41,0x94,0x42,0x94,0x43,0x94,0x44,0x94,0x45,0x94,0x46,0x94,0x47,0x94,0x48,0x94,0x49,0x94,0x4a,0x94,0x4b,0x94,0x4c,0x94,0x4d,0x94,0x4e,0x94,0x4f,0x94,0x50,0x94,0x51,0x94,0x52,0x94,0x53,0x94,0x54,0x94,0x55,0x94,0x56,0x94,0x57,0x94,0x58,0x94,0x59,0x94,0x5a,0x94,0x5b,0x94,0x5c,0x94,0x5d,0x94,0x5e,0x94,0x5f,0x94,0x60,0x94,0x61,0x94,0x62,0x94,0x63,0x94,0x64,0x94,0x65,0x94,0x66,0x94,0x67,0x94,0x68,0x94,0x69,0x94,0x6a,0x94,0x6b,0x94,0x6c,0x94,0x6d,0x94,0x6e,0x94,0x6f,0x94,0x70,0x94,0x71,0x94,0x72,0x94,0x73,0x94,0x74,0x94,0x75,0x94,0x76,0x94,0x77,0x94,0x78,0x94,0x79,0x94,0x7a,0x94,0x7b,0x94,0x7c,0x94,0x7d,0x94,0x7e,0x94,0x7f,0x95,0x0,0x95,0x1,0x95,0x2,0x95,0x3,0x95,0x4,0x95,0x5,0x95,0x6,0x95,0x7,0x95,0x8,0x95,0x9,0x95,0xa,0x95,0xb,0x95,0xc,0x95,0xd,0x95,0xe,0x95,0xf,0x95,0x10,0x95,0x11,0x95,0x12,0x95,0x13,0x95,0x14,0x95,0x15,0x95,0x16,0x95,0x17,0x95,0x18,0x95,0x19,0x95,0x1a,0x95,0x1b,0x95,0x1c,0x95,0x1d,0x95,0x1e,0x95,0x1f,0x95,0x20,0x95,0x21,0x95,0x22,0x95,0x23,0x95,0x24,0x95,0x25,0x95,0x26,0x95,0x27,0x95,0x28,0x95,0x29,0x95,0x2a,0x95,0x2b,0x95,0x2c,0x95,0x2d,0x95,0x2e,0x95,0x2f,0x95,0x30,0x95,0x31,0x95,0x32,0x95,0x33,0x95,0x34,0x95,0x35,0x95,0x36,0x95,0x37,0x95,0x38,0x95,0x39,0x95,0x3a,0x95,0x3b,0x95,0x3c,0x95,0x3d,0x95,0x3e,0x95,0x3f,0x95,0x40,0x95,0x41,0x95,0x42,0x95,0x43,0x95,0x44,0x95,0x45,0x95,0x46,0x95,0x47,0x95,0x48,0x95,0x49,0x95,0x4a,0x95,0x4b,0x95,0x4c,0x95,0x4d,0x95,0x4e,0x95,0x4f,0x95,0x50,0x95,0x51,0x95,0x52,0x95,0x53,0x95,0x54,0x95,0x55,0x95,0x56,0x95,0x57,0x95,0x58,0x95,0x59,0x95,0x5a,0x95,0x5b,0x95,0x5c,0x95,0x5d,0x95,0x5e,0x95,0x5f,0x95,0x60,0x95,0x61,0x95,0x62,0x95,0x63,0x95,0x64,0x95,0x65,0x95,0x66,0x95,0x67,0x95,0x68,0x95,0x69,0x95,0x6a,0x95,0x6b,0x95,0x6c,0x95,0x6d,0x95,0x6e,0x95,0x6f,0x95,0x70,0x95,0x71,0x95,0x72,0x95,0x73,0x95,0x74,0x95,0x75,0x95,0x76,0x95,0x77,0x95,0x78,0x95,0x79,0x95,0x7a,0x95,0x7b,0x95,0x7c,0x95,0x7d,0x95,0x7e,0x95,0x7f,0x96,0x0,0x96,0x1,0x96,0x2,0x96,0x3,0x96,0x4,0x96,0x5,0x96,0x6,0x96,0x7,0x96,0x8,0x96,0x9,0x96,0xa,0x96,0xb,0x96,0xc,0x96,0xd,0x96,0xe,0x96,0xf,0x96,0x10,0x96,0x11,0x96,0x12,0x96,0x13,0x96,0x14,0x96,0x15,0x96,0x16,0x96,0x17,0x96,0x18,0x96,0x19,0x96,0x1a,0x96,0x1b,0x96,0x1c,0x96,0x1d,0x96,0x1e,0x96,0x1f,0x96,0x20,0x96,0x21,0x96,0x22,0x96,0x23,0x96,0x24,0x96,0x25,0x96,0x26,0x96,0x27,0x96,0x28,0x96,0x29,0x96,0x2a,0x96,0x2b,0x96,0x2c,0x96,0x2d,0x96,0x2e,0x96,0x2f,0x96,0x30,0x96,0x31,0x96,0x32,0x96,0x33,0x96,0x34,0x96,0x35,0x96,0x36,0x96,0x37,0x96,0x38,0x96,0x39,0x96,0x3a,0x96,0x3b,0x96,0x3c,0x96,0x3d,0x96,0x3e,0x96,0x3f,0x96,0x40,0x96,0x41,0x96,0x42,0x96,0x43,0x96,0x44,0x96,0x45,0x96,0x46,0x96,0x47,0x96,0x48,0x96,0x49,0x96,0x4a,0x96,0x4b,0x96,0x4c,0x96,0x4d,0x96,0x4e,0x96,0x4f,0x96,0x50,0x96,0x51,0x96,0x52,0x96,0x53,0x96,0x54,0x96,0x55,0x96,0x56,0x96,0x57,0x96,0x58,0x96,0x59,0x96,0x5a,0x96,0x5b,0x96,0x5c,0x96,0x5d,0x96,0x5e,0x96,0x5f,0x96,0x60,0x96,0x61,0x96,0x62,0x96,0x63,0x96,0x64,0x96,0x65,0x96,0x66,0x96,0x67,0x96,0x68,0x96,0x69,0x96,0x6a,0x96,0x6b,0x96,0x6c,0x96,0x6d,0x96,0x6e,0x96,0x6f,0x96,0x70,0x96,0x71,0x96,0x72,0x96,0x73,0x96,0x74,0x96,0x75,0x96,0x76,0x96,0x77,0x96,0x78,0x96,0x79,0x96,0x7a,0x96,0x7b,0x96,0x7c,0x96,0x7d,0x96,0x7e,0x96,0x7f,0x97,0x0,0x97,0x1,0x97,0x2,0x97,0x3,0x97,0x4,0x97,0x5,0x97,0x6,0x97,0x7,0x97,0x8,0x97,0x9,0x97,0xa,0x97,0xb,0x97,0xc,0x97,0xd,0x97,0xe,0x97,0xf,0x97,0x10,0x97,0x11,0x97,0x12,0x97,0x13,0x97,0x14,0x97,0x15,0x97,0x16,0x97,0x17,0x97,0x18,0x97,0x19,0x97,0x1a,0x97,0x1b,0x97,0x1c,0x97,0x1d,0x97,0x1e,0x97,0x1f,0x97,0x20,0x97,0x21,0x97,0x22,0x97,0x23,0x97,0x24,0x97,0x25,0x97,0x26,0x97,0x27,0x97,0x28,0x97,0x29,0x97,0x2a,0x97,0x2b,0x97,0x2c,0x97,0x2d,0x97,0x2e,0x97,0x2f,0x97,0x2f,0xc1,0x4,0x20,0xc1,0x53,0x32,0xc1,0x53,0x3a,0xc1,0x53,0x34,0xc1,0x53,0x82,0xc1,0x53,0x8a,0xc1,0x53,0x84,0xc1,0x58,0x70,0xc1,0x58,0x72,0xc1,0x5a,0xec,0xc1,0x5a,0xee,0xc1,0x5b,0xd4,0xc1,0x5b,0xd6,0xc1,0x5c,0x22,0xc1,0x5c,0x24,0xc1,0x5c,0x6c,0xc1,0x5c,0x6e,0xc1,0x5c,0xbe,0xc1,0x5c,0xc6,0xc1,0x5c,0xc0,0xc1,0x5d,0xa,0xc1,0x5d,0x12,0xc1,0x5d,0xc,0xc1,0x5d,0x56,0xc1,0x5d,0x5e,0xc1,0x5d,0x58,0xc1,0x5d,0x9e,0xc1,0x5d,0xa6,0xc1,0x5d,0xa0,0xc1,0x5e,0xc6,0xc1,0x5e,0xc8,0xc1,0x5f,0xcc,0xc1,0x5f,0xce,0xc1,0x61,0x2c,0xc1,0x61,0x2e,0xc1,0x61,0x76,0xc1,0x61,0x78,0xc1,0x61,0xbc,0xc1,0x61,0xbe,0xc1,0x62,0x6,0xc1,0x62,0x8,0xc1,0x62,0x58,0xc1,0x62,0x5a,0xc1,0x62,0xaa,0xc1,0x62,0xac,0xc1,0x63,0x0,0xc1,0x63,0x2,0xc1,0x63,0x3e,0xc1,0x63,0x46,0xc1,0x63,0x40,0xc1,0x63,0x9a,0xc1,0x63,0xa2,0xc1,0x63,0x9c,0xc1,0x63,0xe6,0xc1,0x63,0xee,0xc1,0x63,0xe8,0xc1,0x64,0x3c,0xc1,0x64,0x3e,0xc1,0x64,0x96,0xc1,0x64,0x98,0xc1,0x64,0xe0,0xc1,0x64,0xe2,0xc1,0x65,0x26,0xc1,0x65,0x28,0xc1,0x65,0x70,0xc1,0x65,0x72,0xc1,0x65,0xc2,0xc1,0x65,0xc4,0xc1,0x66,0x14,0xc1,0x66,0x16,0xc1,0x66,0x5a,0xc1,0x66,0x5c,0xc1,0x66,0xa0,0xc1,0x66,0xa2,0xc1,0x66,0xe6,0xc1,0x66,0xe8,0xc1,0x67,0x30,0xc1,0x67,0x32,0xc1,0x67,0x82,0xc1,0x67,0x84,0xc1,0x67,0xcc,0xc1,0x67,0xce,0xc1,0x68,0x2a,0xc1,0x68,0x2c,0xc1,0x68,0x80,0xc1,0x68,0x82,0xc1,0x68,0xcc,0xc1,0x68,0xce,0xc1,0x6a,0x32,0xc1,0x6a,0x34,0xc1,0x6f,0x9c,0xc1,0x6f,0x9e,0xc1,0x6f,0xea,0xc1,0x6f,0xec,0xc1,0x70,0x34,0xc1,0x70,0x36,0xc1,0x75,0x14,0xc1,0x75,0x16,0xc1,0x75,0x70,0xc1,0x75,0x72,0xc1,0x76,0x3e,0xc1,0x76,0x40,0xc1,0x76,0x92,0xc1,0x76,0x94,0xc1,0x76,0xee,0xc1,0x76,0xf0,0xc1,0x77,0x3a,0xc1,0x77,0x3c,0xc1,0x77,0x82,0xc1,0x77,0x84,0xc1,0x77,0xce,0xc1,0x77,0xd0,0xc1,0x78,0x22,0xc1,0x78,0x24,0xc1,0x78,0x76,0xc1,0x78,0x78,0xc1,0x78,0xbe,0xc1,0x78,0xc0,0xc1,0x79,0x6,0xc1,0x79,0x8,0xc1,0x79,0x4e,0xc1,0x79,0x50,0xc1,0x79,0x9a,0xc1,0x79,0x9c,0xc1,0x79,0xee,0xc1,0x79,0xf0,0xc1,0x7a,0x3a,0xc1,0x7a,0x3c,0xc1,0x7a,0xae,0xc1,0x7a,0xb0,0xc1,0x7b,0x6,0xc1,0x7b,0x8,0xc1,0x7b,0x54,0xc1,0x7b,0x56,0xc1,0x7b,0xac,0xc1,0x7b,0xae,0xc1,0x7c,0x0,0xc1,0x7c,0x2,0xc1,0x7d,0x7a,0xc1,0x7d,0x7c,0xc1,0x7d,0xd0,0xc1,0x7d,0xd2,0xc1,0x7e,0x36,0xc1,0x7e,0x38,0xc1,0x7e,0x9e,0xc1,0x7e,0xa0,0xc1,0x81,0xc4,0xc1,0x81,0xc6,0xc1,0x86,0xf2,0xc1,0x87,0x2e,0xc1,0x87,0x1c,0xc1,0x86,0xf8,0xc1,0x86,0xfe,0xc1,0x87,0x16,0xc1,0x87,0x34,0xc1,0x88,0xf6,0xc1,0x89,0x22,0xc1,0x89,0x4,0xc1,0x89,0x3e,0xc1,0x89,0x6c,0xc1,0x89,0x4c,0xc1,0x89,0x88,0xc1,0x89,0xb8,0xc1,0x89,0x96,0xc1,0x89,0xd4,0xc1,0x8a,0x6,0xc1,0x89,0xe2,0xc1,0x8a,0x24,0xc1,0x8a,0x68,0xc1,0x8a,0x32,0xc1,0x8a,0x98,0xc1,0x8a,0xec,0xc1,0x8a,0xa6,0xc1,0x8c,0x8,0xc1,0x8c,0x36,0xc1,0x8c,0x18,0xc1,0x8c,0x64,0xc1,0x8c,0x94,0xc1,0x8c,0x74,0xc1,0x8c,0xc2,0xc1,0x8c,0xf4,0xc1,0x8c,0xd2,0xc1,0x8d,0x22,0xc1,0x8d,0x68,0xc1,0x8d,0x32,0xc1,0x98,0xe,0xc1,0x98,0xde,0xc1,0x9b,0xc0,0xc1,0x9b,0xb6,0xc1,0x9c,0x84,0xc1,0x9c,0x6e,0xc1,0x9c,0x34,0xc1,0x9c,0xe,0xc1,0x9b,0xfa,0xc1,0x9d,0x36,0xc1,0x9d,0x28,0xc1,0x9f,0xf6,0xc1,0xa0,0x2c,0xc1,0xa0,0x24,0xc1,0xa0,0x1a,0xc1,0xa3,0x88,0xc1,0xa3,0x70,0xc1,0xa3,0xb4,0xc1,0xa3,0x9c,0xc1,0xa5,0x4e,0xc1,0xa5,0x54,0xc1,0xb2,0x9e,0xc1,0xb8,0x54,0xc1,0xb8,0x56,0xc1,0xb8,0x8e,0xc1,0xbc,0xb6,0xc1,0xbd,0x68,0xe1,0x83,0x70,0x91,0x50,0x91,0x50,0x91,0x50,0x8a,0x17,0x91,0x56,0x8a,0x17,0x97,0x31,0x91,0x59,0x97,0x31,0x97,0x32,0x94,0x1e,0x97,0x33,0x97,0x34,0x97,0x33,0x97,0x32,0x97,0x35,0x94,0x1f,0x97,0x36,0x97,0x37,0x97,0x36,0x97,0x35,0x97,0x38,0x94,0x33,0x97,0x39,0xc0,0xc0,0x97,0x38,0x97,0x3a,0x94,0x3d,0x97,0x3b,0xc0,0xc0,0x97,0x3a,0x97,0x3c,0x94,0x42,0x97,0x3d,0x97,0x3c,0x97,0x3e,0x94,0x43,0x97,0x3f,0x97,0x3e,0x97,0x40,0x94,0x44,0x97,0x41,0x97,0x40,0x97,0x42,0x94,0x46,0x97,0x43,0x97,0x44,0x97,0x43,0x97,0x42,0x97,0x45,0x94,0x47,0x97,0x46,0x97,0x47,0x97,0x46,0x97,0x45,0x97,0x48,0x94,0x48,0x97,0x49,0x97,0x4a,0x97,0x49,0x97,0x48,0x97,0x4b,0x94,0x49,0x97,0x4c,0x97,0x4d,0x97,0x4c,0x97,0x4b,0x97,0x4e,0x94,0x4c,0x97,0x4f,0x97,0x4e,0x97,0x50,0x94,0x4e,0x97,0x51,0xc0,0xc0,0x97,0x50,0x97,0x52,0x94,0x54,0x97,0x53,0x97,0x52,0x97,0x54,0x94,0x55,0x97,0x55,0x97,0x54,0x97,0x56,0x94,0x56,0x97,0x57,0x97,0x56,0x97,0x58,0x94,0x57,0x97,0x59,0x97,0x58,0x97,0x5a,0x94,0x58,0x97,0x5b,0x97,0x5a,0x97,0x5c,0x94,0x59,0x97,0x5d,0x97,0x5c,0x97,0x5e,0x94,0x5a,0x97,0x5f,0x97,0x5e,0x97,0x60,0x94,0x5c,0x97,0x61,0x97,0x62,0x97,0x61,0x97,0x60,0x97,0x63,0x94,0x5d,0x97,0x64,0x97,0x65,0x97,0x64,0x97,0x63,0x97,0x66,0x94,0x5e,0x97,0x67,0x97,0x68,0x97,0x67,0x97,0x66,0x97,0x69,0x94,0x5f,0x97,0x6a,0x97,0x69,0x97,0x6b,0x94,0x60,0x97,0x6c,0x97,0x6b,0x97,0x6d,0x94,0x61,0x97,0x6e,0x97,0x6d,0x97,0x6f,0x94,0x62,0x97,0x70,0x97,0x6f,0x97,0x71,0x94,0x63,0x97,0x72,0x97,0x71,0x97,0x73,0x94,0x64,0x97,0x74,0x97,0x73,0x97,0x75,0x94,0x65,0x97,0x76,0x97,0x75,0x97,0x77,0x94,0x66,0x97,0x78,0x97,0x77,0x97,0x79,0x94,0x67,0x97,0x7a,0x97,0x79,0x97,0x7b,0x94,0x68,0x97,0x7c,0x97,0x7b,0x97,0x7d,0x94,0x69,0x97,0x7e,0x97,0x7d,0x97,0x7f,0x94,0x6a,0x98,0x0,0x97,0x7f,0x98,0x1,0x94,0x6b,0x98,0x2,0x98,0x1,0x98,0x3,0x94,0x6c,0x98,0x4,0x98,0x3,0x98,0x5,0x94,0x6d,0x98,0x6,0x98,0x5,0x98,0x7,0x94,0x6f,0x98,0x8,0xc0,0xc0,0x98,0x7,0x98,0x9,0x94,0x74,0x98,0xa,0xc0,0xc0,0x98,0x9,0x98,0xb,0x95,0xa,0x98,0xc,0x98,0xb,0x98,0xd,0x95,0xb,0x98,0xe,0x98,0xd,0x98,0xf,0x95,0xc,0x98,0x10,0x98,0xf,0x98,0x11,0x95,0x1f,0x98,0x12,0x98,0x11,0x98,0x13,0x95,0x20,0x98,0x14,0x98,0x13,0x98,0x15,0x95,0x23,0x98,0x16,0x98,0x15,0x98,0x17,0x95,0x24,0x98,0x18,0x98,0x17,0x98,0x19,0x95,0x25,0x98,0x1a,0x98,0x19,0x98,0x1b,0x95,0x26,0x98,0x1c,0x98,0x1b,0x98,0x1d,0x95,0x27,0x98,0x1e,0x98,0x1d,0x98,0x1f,0x95,0x28,0x98,0x20,0x98,0x1f,0x98,0x21,0x95,0x29,0x98,0x22,0x98,0x21,0x98,0x23,0x95,0x2a,0x98,0x24,0x98,0x23,0x98,0x25,0x95,0x2b,0x98,0x26,0x98,0x25,0x98,0x27,0x95,0x2c,0x98,0x28,0x98,0x27,0x98,0x29,0x95,0x2d,0x98,0x2a,0x98,0x29,0x98,0x2b,0x95,0x2e,0x98,0x2c,0x98,0x2b,0x98,0x2d,0x95,0x2f,0x98,0x2e,0x98,0x2d,0x98,0x2f,0x95,0x30,0x98,0x30,0x98,0x2f,0x98,0x31,0x95,0x31,0x98,0x32,0x98,0x31,0x98,0x33,0x95,0x32,0x98,0x34,0x98,0x33,0x98,0x35,0x95,0x34,0x98,0x36,0x98,0x35,0x98,0x37,0x95,0x35,0x98,0x38,0x98,0x37,0x98,0x39,0x95,0x36,0x98,0x3a,0x98,0x39,0x98,0x3b,0x95,0x3c,0x98,0x3c,0x98,0x3b,0x98,0x3d,0x95,0x3d,0x98,0x3e,0x98,0x3d,0x98,0x3f,0x95,0x3e,0x98,0x40,0x98,0x3f,0x98,0x41,0x95,0x3f,0x98,0x42,0xc0,0xc0,0xc0,0x98,0x41,0x98,0x43,0x95,0x4d,0x98,0x44,0xc0,0xc0,0xc0,0x98,0x43,0x98,0x45,0x95,0x65,0x98,0x46,0x98,0x46,0x98,0x47,0x98,0x45,0x98,0x45,0x98,0x48,0x98,0x48,0x98,0x49,0x98,0x49,0x98,0x49,0x98,0x48,0x98,0x4a,0x98,0x4a,0x98,0x4a,0x98,0x45,0x98,0x47,0x98,0x4b,0x98,0x4b,0x98,0x4b,0x98,0x46,0x98,0x45,0x98,0x4c,0x95,0x6f,0x98,0x4d,0x98,0x4d,0x98,0x4e,0x98,0x4e,0x98,0x4d,0x98,0x4c,0x98,0x4f,0x95,0x70,0x98,0x50,0x98,0x50,0x98,0x51,0x98,0x51,0x98,0x50,0x98,0x4f,0x98,0x52,0x95,0x71,0x98,0x53,0x98,0x53,0x98,0x54,0x98,0x54,0x98,0x53,0x98,0x52,0x98,0x55,0x95,0x72,0x98,0x56,0x98,0x56,0x98,0x57,0x98,0x57,0x98,0x56,0x98,0x55,0x98,0x58,0x95,0x73,0x98,0x59,0x98,0x59,0x98,0x5a,0x98,0x5a,0x98,0x59,0x98,0x58,0x98,0x5b,0x95,0x74,0x98,0x5c,0x98,0x5c,0x98,0x5d,0x98,0x5d,0x98,0x5c,0x98,0x5b,0x98,0x5e,0x95,0x7b,0x98,0x5f,0x98,0x5f,0x98,0x60,0x98,0x60,0x98,0x5f,0x98,0x5e,0x98,0x61,0x95,0x7c,0x98,0x62,0x98,0x62,0x98,0x63,0x98,0x63,0x98,0x62,0x98,0x61,0x98,0x64,0x95,0x7d,0x98,0x65,0x98,0x65,0x98,0x66,0x98,0x66,0x98,0x65,0x98,0x64,0x98,0x67,0x95,0x7e,0x98,0x68,0x98,0x68,0x98,0x69,0x98,0x69,0x98,0x68,0x98,0x67,0xc0,0xc0,0xc0,0x98,0x6a,0x98,0x6a,0x98,0x6b,0x98,0x6b,0x98,0x6c,0x98,0x6d,0x98,0x6c,0x98,0x6e,0x98,0x6f,0x98,0x70,0x98,0x70,0x98,0x71,0x98,0x72,0x98,0x71,0xc0,0xc0,0xc0,0xc0,0xc0,0x98,0x70,0x98,0x6f,0x98,0x6e,0x98,0x73,0x98,0x74,0x98,0x73,0x98,0x75,0x96,0x49,0x98,0x76,0x98,0x76,0x98,0x77,0x98,0x78,0x98,0x75,0x98,0x75,0x98,0x75,0x98,0x78,0x98,0x77,0x98,0x76,0x98,0x75,0xc0,0xc0,0x98,0x79,0x98,0x7a,0x98,0x79,0x98,0x7b,0x98,0x7c,0x98,0x7b,0xc0,0xc0,0x98,0x7d,0x96,0x64,0x98,0x7e,0x98,0x7e,0x98,0x7e,0x98,0x7d,0x98,0x7f,0x98,0x7f,0x99,0x0,0x97,0x17,0x99,0x1,0x99,0x0,0x99,0x2,0x99,0x2,0xc0,0xc0,0xc0,0x99,0x3,0x99,0x3,0xc0,0x99,0x4,0x99,0x4,0xc0,0x65,0x7,0xc8,0x8,0xc3,0x91,0x4e,0x97,0x30,0x9,0x99,0x5,0xc,0xcd,0xe1,0x4b,0x2,0x3,0x4,0x17,0x2b,0x2c,0x3d,0x4a,0x51,0x52,0x53,0x81,0xf,0x81,0x10,0x81,0x1f,0x81,0x2a,0x81,0x35,0x81,0x36,0x3e,0x81,0x47,0x81,0x6f,0x82,0x68,0x84,0x22,0x84,0x5a,0x85,0xf,0x85,0x30,0x49,0x85,0x5d,0x85,0x63,0x85,0x7a,0x86,0x53,0x86,0x73,0x87,0x2a,0x88,0xa,0x88,0x36,0x88,0x37,0x88,0x3e,0x88,0x45,0x88,0x4d,0x88,0x54,0x89,0x5,0x89,0xd,0x89,0xe,0x89,0x33,0x89,0x44,0x89,0x61,0x89,0x64,0x89,0x65,0x89,0x68,0x8a,0x23,0x8a,0x59,0x8b,0x22,0x8b,0x23,0x8b,0x39,0x8b,0x3a,0x8b,0x3b,0x8b,0x3c,0x8b,0x6a,0x8c,0x13,0x8c,0x14,0x8e,0x1a,0x8e,0x1c,0x8e,0x2c,0x8e,0x2d,0x8e,0x58,0x8e,0x5d,0x8e,0x5e,0x8e,0x60,0x8e,0x66,0x8e,0x67,0x8f,0x14,0x8f,0x34,0x8f,0x60,0x90,0x7,0x91,0xa,0x91,0x37,0xe5,0x8e,0x18,0x91,0x46,0xc4,0x91,0x4c,0x91,0x4d,0x99,0x6,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x16,0xd3,0xd0,0x29,0xd1,0x0,0xd0,0x3c,0xd1,0x1,0xe1,0x2,0xc7,0x6,0xc6,0x3e,0xcb,0x1,0xd3,0xd0,0x48,0xd1,0x2,0xe1,0x2,0xc7,0x6,0xc6,0x49,0xcb,0x2,0xd3,0xd0,0x67,0xd1,0x3,0xd0,0x7f,0xd1,0x4,0xd0,0x81,0x8,0xd1,0x5,0xd0,0x81,0xe,0xd1,0x6,0xd0,0x81,0x1e,0xd1,0x7,0xd0,0x81,0x29,0xd1,0x8,0xd0,0x81,0x34,0xd1,0x9,0xd0,0x81,0x40,0xd1,0xa,0xd0,0x81,0x67,0xd1,0xb,0xd0,0x82,0x14,0xd1,0xc,0xd0,0x82,0x61,0xd1,0xd,0xd0,0x83,0x19,0xd1,0xe,0xd0,0x83,0x43,0xd1,0xf,0xd0,0x83,0x52,0xd1,0x10,0xd0,0x83,0x78,0xd1,0x11,0xd0,0x84,0x1b,0xd1,0x12,0xd0,0x84,0x2d,0xd1,0x13,0xd0,0x84,0x59,0xd1,0x14,0xd0,0x85,0xe,0xd1,0x15,0xd0,0x85,0x23,0xd1,0x16,0xd0,0x85,0x2c,0xd1,0x17,0xd0,0x85,0x53,0xd1,0x18,0xd0,0x85,0x5c,0xd1,0x19,0xd0,0x85,0x79,0xd1,0x1a,0xd0,0x86,0x18,0xd1,0x1b,0xd0,0x86,0x22,0xd1,0x1c,0xd0,0x86,0x43,0xd1,0x1d,0xd0,0x86,0x4e,0xd1,0x1e,0xd0,0x87,0x59,0xd1,0x1f,0xd0,0x87,0x7b,0xd1,0x20,0xd0,0x88,0x35,0xd1,0x21,0xe1,0x3,0xc7,0x21,0xe0,0x0,0xc7,0x22,0xc6,0x88,0x38,0xd3,0xc6,0x85,0x2d,0xcb,0x20,0xd3,0xe1,0x3,0xc7,0x21,0xe0,0x0,0xc7,0x22,0xc6,0x88,0x38,0xd3,0xc6,0x88,0x25,0xcb,0x21,0xd3,0xd0,0x88,0x7f,0xd1,0x22,0xd0,0x89,0xc,0xd1,0x23,0xe1,0x2,0xc7,0x28,0xc7,0x29,0xe1,0x0,0xd0,0x89,0x32,0xd3,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x29,0xc6,0x85,0x2d,0xe1,0x0,0xd0,0x89,0x43,0xd3,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x29,0xc6,0x83,0x44,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x29,0xc6,0x88,0x5e,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x29,0xc6,0x81,0x36,0xcb,0xa,0xd3,0xe1,0x3,0xc7,0x21,0xe0,0x0,0xc7,0x2b,0xc6,0x88,0x38,0xd3,0xc6,0x86,0x54,0xcb,0xd,0xd3,0xe1,0x3,0xc7,0x21,0xe0,0x0,0xc7,0x2b,0xc6,0x88,0x38,0xd3,0xc6,0x83,0x44,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x21,0xe0,0x0,0xc7,0x2b,0xc6,0x88,0x38,0xd3,0xc6,0x88,0x5e,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x21,0xe0,0x0,0xc7,0x2b,0xc6,0x88,0x38,0xd3,0xc6,0x81,0x36,0xcb,0xa,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x29,0xc6,0x89,0x45,0xcb,0x1f,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x29,0xc6,0x89,0x46,0xe1,0x0,0xd0,0x89,0x60,0xd3,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2c,0xc6,0x83,0x44,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2c,0xc6,0x88,0x5e,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2c,0xc6,0x86,0x54,0xcb,0xd,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2c,0xc6,0x89,0x62,0xcb,0xf,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2c,0xc6,0x89,0x63,0xcb,0xe,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2c,0xc6,0x88,0x5d,0xcb,0x1c,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2c,0xc6,0x88,0x5f,0xcb,0x1d,0xd3,0xe1,0x3,0xc7,0x21,0xe0,0x0,0xc7,0x2d,0xc6,0x88,0x38,0xd3,0xc6,0x81,0x36,0xcb,0xa,0xd3,0xe1,0x3,0xc7,0x21,0xe0,0x0,0xc7,0x2d,0xc6,0x88,0x38,0xd3,0xc6,0x83,0x44,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x21,0xe0,0x0,0xc7,0x2d,0xc6,0x88,0x38,0xd3,0xc6,0x88,0x5e,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x81,0x36,0xcb,0xa,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x83,0x44,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x88,0x5e,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x86,0x54,0xcb,0xd,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x89,0x63,0xcb,0xe,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x89,0x62,0xcb,0xf,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x81,0x24,0xcb,0x11,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x81,0x2f,0xcb,0x12,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x84,0x23,0xcb,0x10,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x89,0x66,0xcb,0x13,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x89,0x67,0xcb,0x14,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x84,0x3a,0xcb,0x17,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x85,0x4a,0xcb,0x19,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x88,0x5d,0xcb,0x1c,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2e,0xc6,0x88,0x5f,0xcb,0x1d,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2f,0xc6,0x83,0x44,0xe1,0x0,0xd0,0x8a,0x4,0xd3,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x2f,0xc6,0x88,0x5e,0xe1,0x0,0xd0,0x8a,0x1c,0xd3,0xd3,0xd0,0x8a,0x39,0xd1,0x24,0xd0,0x8a,0x51,0xd1,0x25,0xd0,0x8a,0x66,0xd1,0x26,0xe1,0x3,0xc7,0x21,0xc7,0x30,0xc6,0x83,0x44,0xcb,0x24,0xd3,0xe1,0x3,0xc7,0x21,0xc7,0x30,0xc6,0x88,0x5e,0xcb,0x25,0xd3,0xe1,0x3,0xc7,0x21,0xc7,0x30,0xc6,0x89,0x63,0xcb,0x26,0xd3,0xd0,0x8b,0x0,0xd1,0x27,0xd0,0x8b,0x1b,0xd1,0x28,0xe1,0x3,0xc7,0x2a,0xc7,0x31,0xc6,0x88,0x5e,0xcb,0x27,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x31,0xc6,0x89,0x63,0xcb,0x28,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x8b,0x1c,0xcb,0x1e,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x81,0x36,0xcb,0xa,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x83,0x44,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x88,0x5e,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x86,0x54,0xcb,0xd,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x89,0x63,0xcb,0xe,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x89,0x62,0xcb,0xf,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x81,0x24,0xcb,0x11,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x81,0x2f,0xcb,0x12,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x84,0x23,0xcb,0x10,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x89,0x66,0xcb,0x13,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x89,0x67,0xcb,0x14,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x84,0x3a,0xcb,0x17,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x85,0x4a,0xd0,0x8b,0x21,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x88,0x5d,0xcb,0x1c,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x13,0xc6,0x88,0x5f,0xcb,0x1d,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x32,0xc6,0x83,0x44,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x32,0xc6,0x88,0x5e,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2a,0xc7,0x32,0xc6,0x89,0x62,0xcb,0xf,0xd3,0xd0,0x8b,0x38,0xd1,0x29,0xe1,0x3,0xc7,0x21,0xc7,0x34,0xc6,0x6d,0xcb,0x29,0xd3,0xe1,0x3,0xc7,0x21,0xc7,0x35,0xc6,0x6d,0xcb,0x29,0xd3,0xe1,0x3,0xc7,0x21,0xc7,0x36,0xc6,0x6d,0xcb,0x29,0xd3,0xe1,0x3,0xc7,0x21,0xc7,0x34,0xc6,0x8b,0x28,0xe1,0x5,0xc7,0x37,0xc6,0x8b,0x3d,0xc6,0x4a,0xd0,0x8b,0x43,0xc6,0x6,0xd0,0x8b,0x69,0xd3,0xd3,0xe1,0x3,0xc7,0x21,0xc7,0x38,0xc6,0x8b,0x28,0xe1,0x5,0xc7,0x37,0xc6,0x8b,0x3d,0xc6,0x4a,0xd0,0x8b,0x70,0xc6,0x6,0xd0,0x8c,0x12,0xd3,0xd3,0xd0,0x8c,0x35,0xd1,0x2a,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xe1,0x4,0xc7,0xa,0xc4,0x1,0xe1,0x2,0xc7,0xa,0xc4,0x2,0xe1,0x0,0xc7,0xa,0xd3,0xd3,0xc6,0x8c,0x36,0xe1,0x0,0xc7,0xa,0xd3,0xd3,0xc6,0x88,0x5d,0xd3,0xe1,0x3,0xc7,0xa,0xc4,0x1,0xc4,0x2,0xc6,0x8c,0x36,0xd3,0xd3,0xc6,0x8c,0x37,0xd3,0xd0,0x8c,0x5b,0xd1,0x2b,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x1,0xcb,0x2b,0xc6,0x8c,0x5c,0xd3,0xc6,0x8c,0x3b,0xd3,0xc6,0x8c,0x5d,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x1,0xcb,0x2b,0xc6,0x8c,0x5e,0xd3,0xc6,0x8c,0x3a,0xd3,0xc6,0x8c,0x5f,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x1,0xcb,0x2b,0xc6,0x8c,0x60,0xd3,0xc6,0x8c,0x3b,0xd3,0xc6,0x8c,0x61,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x1,0xcb,0x2b,0xc6,0x8c,0x62,0xd3,0xc6,0x8c,0x63,0xd3,0xc6,0x8c,0x64,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x1,0xcb,0x2b,0xc6,0x8c,0x65,0xd3,0xc6,0x8c,0x66,0xd3,0xc6,0x8c,0x67,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x1,0xcb,0x2b,0xc6,0x8c,0x68,0xd3,0xc6,0x8c,0x69,0xd3,0xc6,0x8c,0x6a,0xd3,0xd0,0x8c,0x7a,0xd1,0x2c,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x1,0xcb,0x2c,0xc6,0x8c,0x5c,0xd3,0xc6,0x8c,0x5c,0xd3,0xc6,0x8c,0x7b,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x1,0xcb,0x2c,0xc6,0x8c,0x5e,0xd3,0xc6,0x8c,0x5c,0xd3,0xc6,0x8c,0x7c,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x1,0xcb,0x2c,0xc6,0x8c,0x60,0xd3,0xc6,0x8c,0x5c,0xd3,0xc6,0x8c,0x7d,0xd3,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe1,0x1,0xcb,0x2c,0xc6,0x8c,0x65,0xd3,0xc6,0x8c,0x5c,0xd3,0xc6,0x8c,0x7e,0xd3,0xd0,0x8d,0x5,0xd1,0x2d,0xd0,0x8d,0xa,0xd1,0x2e,0xd0,0x8d,0x1c,0xd1,0x2f,0xe1,0x3,0xc7,0x37,0xc6,0x8d,0x1d,0xc6,0x81,0x70,0xd0,0x8d,0x60,0xd3,0xd1,0x30,0xf1,0x2,0x2a,0xcb,0x2f,0xc6,0x89,0x45,0xd0,0x8d,0x73,0xd3,0xf1,0x2,0x2a,0xcb,0x2f,0xc6,0x8d,0x74,0xd0,0x8e,0x19,0xd3,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x70,0xd3,0xd1,0x31,0xf0,0x1,0x1,0xe0,0x1,0xe1,0x2,0xc7,0x11,0xe1,0x1,0xc7,0x3b,0xc6,0x8e,0x1b,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x0,0xd0,0x8e,0x23,0xd3,0xc6,0x8e,0x24,0xd3,0xd3,0xc6,0x89,0x45,0xc6,0x8b,0x4e,0xd3,0xc6,0x83,0x44,0xd0,0x8e,0x2b,0xd3,0xe0,0x0,0xc7,0x31,0xc6,0x81,0x70,0xd3,0xd1,0x32,0xd0,0x8e,0x54,0xd1,0x33,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xe0,0x1,0xe0,0x0,0xe1,0x4,0xc7,0xa,0xc6,0x8e,0x55,0xc4,0x13,0xc4,0xa,0xc6,0x8e,0x56,0xd3,0xc6,0x84,0x3a,0xd3,0xc6,0x18,0xc4,0x1,0xd3,0xc4,0xa,0xd3,0xc6,0x8e,0x57,0xd3,0xe1,0x0,0xd0,0x8f,0x6,0xd3,0xd1,0x34,0xe1,0x0,0xc7,0x3f,0xd3,0xd1,0x35,0xe1,0x0,0xc7,0x3f,0xd3,0xd1,0x36,0xe1,0x0,0xd0,0x8f,0x12,0xd3,0xd1,0x37,0xf1,0x2,0x85,0x2f,0xc7,0x18,0xe1,0x2,0xc7,0xb,0xcb,0x37,0xc6,0x8f,0x7,0xd3,0xc6,0x8f,0x13,0xd3,0xd0,0x90,0x2a,0xd1,0x38,0xd0,0x90,0x40,0xd1,0x39,0xe1,0x1,0xcb,0x39,0xc6,0x90,0x41,0xd3,0xd1,0x3a,0xd0,0x90,0x7f,0xd1,0x3b,0xe1,0x3,0xc7,0x2a,0xc7,0x29,0xc6,0x91,0x0,0xcb,0x3b,0xd3,0xf1,0x2,0x2a,0xcb,0x2f,0xc6,0x91,0x0,0xd0,0x91,0x8,0xd3,0xd0,0x91,0x36,0xd1,0x3c,0xe1,0x1,0xc7,0x4a,0xd0,0x91,0x3c,0xd3,0xd1,0x3d,0xe0,0x0,0xcb,0x3a,0xc6,0x91,0x3d,0xd3,0xf1,0x2,0x2a,0xcb,0x0,0xe0,0x0,0xcb,0x3d,0xc6,0x8d,0x2c,0xd3,0xd0,0x91,0x45,0xd3,0xc2,0x0,};
-const int modules_init_len = 31422;
+const char modules_init[] = {0x74,0x6c,0x30,0x31,0x99,0xb,0x5,0x62,0x6c,0x6f,0x63,0x6b,0x21,0x0,0x5,0x63,0x61,0x74,0x63,0x68,0x5,0x70,0x72,0x69,0x6e,0x74,0xb,0x5f,0x53,0x74,0x72,0x69,0x6e,0x67,0x5f,0x63,0x61,0x74,0x10,0x69,0x6e,0x69,0x74,0x20,0x65,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x8,0x74,0x6f,0x53,0x74,0x72,0x69,0x6e,0x67,0x5,0x6c,0x6f,0x6f,0x70,0x73,0x8,0x6e,0x6f,0x65,0x73,0x63,0x61,0x70,0x65,0x6,0x6f,0x66,0x66,0x73,0x65,0x74,0x4,0x74,0x65,0x78,0x74,0x9,0x6e,0x6f,0x63,0x61,0x70,0x74,0x75,0x72,0x65,0x3,0x70,0x6f,0x73,0xc1,0x1,0xc0,0x22,0xd,0xd,0x4,0x6c,0x69,0x6e,0x65,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0xe,0xf,0xce,0xae,0xc3,0xc4,0xc4,0xc4,0x10,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0x0,0x1,0x65,0x21,0x12,0x21,0x13,0xc1,0x1,0x96,0xc1,0x1,0x8c,0x28,0x15,0x16,0xc0,0xc0,0xc0,0xc0,0xc0,0x15,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x17,0xf,0xce,0xb7,0xc3,0x14,0xc4,0xc4,0x18,0xe1,0x1,0xc7,0x1,0xe1,0x2,0xc7,0x2,0xc6,0x5,0xe1,0x0,0xd0,0x11,0xd3,0xd3,0xd3,0x0,0x4,0x62,0x6f,0x6f,0x6c,0x3,0x67,0x65,0x74,0x4,0x65,0x6c,0x73,0x65,0x3,0x5f,0x69,0x66,0x4,0x63,0x6f,0x6e,0x64,0x21,0x1e,0x1,0x74,0x23,0x20,0xc0,0xc2,0x1,0x66,0x23,0x22,0xc0,0xc2,0x23,0x1f,0x21,0x23,0xc1,0x3,0x62,0xc1,0x3,0x0,0xc1,0x2,0xf8,0xc1,0x3,0x16,0xc1,0x3,0x42,0x29,0x25,0x26,0x27,0x28,0x28,0x29,0x29,0x26,0x25,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x2a,0xf,0xd2,0xe5,0x24,0x1d,0x24,0xc4,0xc4,0x2b,0xe1,0x0,0xe1,0x3,0xc7,0x3,0xca,0x0,0xe0,0x2,0xcc,0xc6,0x1b,0xc6,0x0,0xca,0x1,0xd3,0xe0,0x2,0xcc,0xc6,0x1b,0xc6,0x1c,0xca,0x2,0xd3,0xd3,0xd3,0x0,0xf,0x5f,0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x2,0x69,0x66,0x3,0x6e,0x6f,0x74,0x6,0x72,0x65,0x74,0x75,0x72,0x6e,0x3,0x5f,0x6f,0x72,0x4,0x6c,0x65,0x66,0x74,0x21,0x32,0x5,0x72,0x69,0x67,0x68,0x74,0x23,0x34,0xc0,0xc2,0x22,0x33,0x35,0xc1,0x3,0xda,0xc1,0x3,0xfa,0xc1,0x4,0x6,0xc1,0x4,0x20,0x2b,0x37,0x37,0x37,0x38,0x38,0x39,0x39,0x38,0x3a,0x3a,0x3a,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x3b,0xf,0xd5,0xe5,0x2b,0x31,0x36,0xc4,0xc4,0x3c,0xe1,0x1,0xc7,0x5,0xca,0x0,0xd3,0xdd,0x0,0x0,0x1b,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe1,0x0,0xca,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x1c,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xca,0x0,0xd3,0x0,0x2,0x6f,0x72,0x4,0x5f,0x61,0x6e,0x64,0xc1,0x4,0xb8,0xc1,0x4,0xc4,0xc1,0x4,0xde,0x28,0x40,0x40,0x41,0x41,0x40,0x42,0x42,0x42,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x43,0xf,0xda,0xe5,0x26,0x3f,0x36,0xc4,0xc4,0x44,0xca,0x0,0xdd,0x0,0x0,0x16,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe1,0x0,0xca,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x17,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xca,0x0,0xd3,0x0,0x3,0x61,0x6e,0x64,0x5,0x74,0x68,0x72,0x6f,0x77,0x15,0x77,0x68,0x69,0x6c,0x65,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x6,0x5f,0x77,0x68,0x69,0x6c,0x65,0x23,0x1e,0xc0,0xc2,0x21,0x4a,0x21,0xc1,0xc0,0x7e,0x22,0xe7,0x4d,0xc1,0x5,0x6a,0xc1,0x5,0x80,0xc1,0x5,0xa0,0xc1,0x5,0x96,0xc1,0x5,0xfc,0xc1,0x6,0xc,0xc1,0x6,0x3a,0x2f,0x4f,0x4f,0x50,0x50,0x50,0x51,0x52,0x51,0x53,0x53,0x54,0x54,0x53,0x55,0x55,0x67,0x7,0x4e,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x56,0xf,0xdf,0xe5,0x46,0x49,0x4b,0x1,0x4c,0x57,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x1e,0xe1,0x1,0xc7,0x7,0xc6,0x48,0xd3,0xdb,0x0,0x0,0x1f,0xc2,0xe1,0x1,0xc7,0x5,0xe1,0x0,0xca,0x0,0xd3,0xd3,0xdd,0x0,0x0,0x35,0xdb,0x0,0x0,0x3f,0xdb,0x0,0x0,0x36,0xc2,0xe1,0x0,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x1f,0xc2,0x0,0x5,0x77,0x68,0x69,0x6c,0x65,0xc1,0x7,0x50,0xc1,0x7,0x64,0x25,0x5a,0x5a,0x5b,0x5b,0x5a,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x5c,0xf,0xe8,0xb3,0xc3,0xc4,0xc4,0xc4,0x5d,0xe1,0x2,0xc7,0x6,0xc4,0x1,0xe1,0x0,0xc8,0x0,0x1,0xd3,0xd3,0x0,0x4,0x63,0x61,0x6c,0x6c,0x3,0x74,0x72,0x79,0x4,0x74,0x65,0x73,0x74,0x23,0x61,0xc0,0xc2,0x9,0x6f,0x74,0x68,0x65,0x72,0x77,0x69,0x73,0x65,0x23,0x63,0xc0,0xc2,0x22,0x62,0x64,0xc1,0x7,0x36,0xc1,0x7,0x80,0xc1,0x7,0x9c,0xc1,0x7,0xb2,0xc1,0x7,0xa6,0xc1,0x7,0xce,0x2e,0x66,0x66,0x66,0x67,0x67,0x68,0x68,0x69,0x6a,0x6a,0x69,0x68,0x6b,0x6b,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x6c,0xf,0xe7,0xe5,0x34,0x60,0x65,0xc4,0xc4,0x6d,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x5e,0xd3,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdd,0x0,0x0,0x28,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xc6,0x5f,0xd3,0xd3,0xdb,0x0,0x0,0x29,0xc2,0xe1,0x0,0xca,0x0,0xd3,0x0,0x6,0x61,0x73,0x42,0x6f,0x6f,0x6c,0x1,0x76,0x21,0x70,0x21,0x71,0xc1,0x7,0xfa,0xc1,0x7,0xf2,0x23,0x73,0x74,0x73,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x75,0xf,0xec,0xaf,0x6f,0x72,0xc4,0xc4,0x76,0xe1,0x3,0xc7,0x3,0xca,0x0,0xc0,0xc1,0xd3,0x0,0x9,0x61,0x73,0x42,0x6f,0x6f,0x6c,0x49,0x6e,0x76,0xc1,0x8,0x46,0xc1,0x8,0x3e,0x23,0x79,0x7a,0x79,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x7b,0xf,0xed,0xaf,0x78,0x72,0xc4,0xc4,0x7c,0xe1,0x3,0xc7,0x3,0xca,0x0,0xc1,0xc0,0xd3,0x0,0x2,0x65,0x71,0x7,0x63,0x6f,0x6d,0x70,0x61,0x72,0x65,0xc0,0x3,0x9,0x69,0x73,0x53,0x6d,0x61,0x6c,0x6c,0x65,0x72,0x1,0x6c,0x21,0x81,0x2,0x1,0x72,0x21,0x81,0x4,0x22,0x81,0x3,0x81,0x5,0xc1,0x8,0x9c,0xc1,0x8,0xba,0xc1,0x8,0xac,0xc1,0x8,0x9e,0x29,0x81,0x7,0x81,0x7,0x81,0x8,0x81,0x8,0x81,0x9,0x81,0xa,0x81,0x9,0x81,0x8,0x81,0x7,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x81,0xb,0xf,0xee,0xe5,0x21,0x81,0x1,0x81,0x6,0xc4,0xc4,0x81,0xc,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe1,0x2,0xc7,0x8,0xe1,0x2,0xc7,0x9,0xca,0x0,0xca,0x1,0xd3,0xc6,0x81,0x0,0xd3,0xd3,0x0,0x3,0x6c,0x74,0x65,0x3,0x6d,0x69,0x6e,0xc1,0x8,0xf6,0xc1,0x9,0xe,0xc1,0x9,0x28,0x29,0x81,0x10,0x81,0x10,0x81,0x10,0x81,0x11,0x81,0x11,0x81,0x11,0x81,0x12,0x81,0x12,0x81,0x12,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x81,0x13,0xf,0xf0,0xe5,0x2d,0x81,0xf,0x81,0x6,0xc4,0xc4,0x81,0x14,0xe1,0x2,0xc7,0xa,0xca,0x0,0xca,0x1,0xd3,0xdd,0x0,0x0,0x1a,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xca,0x0,0xd3,0xdb,0x0,0x0,0x1b,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xca,0x1,0xd3,0x0,0x3,0x67,0x74,0x65,0x3,0x6d,0x61,0x78,0xc1,0x9,0x5e,0xc1,0x9,0x76,0xc1,0x9,0x90,0x29,0x81,0x18,0x81,0x18,0x81,0x18,0x81,0x19,0x81,0x19,0x81,0x19,0x81,0x1a,0x81,0x1a,0x81,0x1a,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x81,0x1b,0xf,0xf4,0xe5,0x2d,0x81,0x17,0x81,0x6,0xc4,0xc4,0x81,0x1c,0xe1,0x2,0xc7,0xb,0xca,0x0,0xca,0x1,0xd3,0xdd,0x0,0x0,0x1a,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xca,0x0,0xd3,0xdb,0x0,0x0,0x1b,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xca,0x1,0xd3,0x0,0x3,0x61,0x64,0x64,0x6,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x4,0x73,0x69,0x7a,0x65,0xb,0x5f,0x67,0x65,0x74,0x5f,0x72,0x61,0x6e,0x64,0x6f,0x6d,0xc1,0xa,0x32,0xc1,0xa,0x40,0xc1,0xa,0x50,0xc1,0xa,0x44,0xc1,0xa,0x5a,0x2a,0x81,0x22,0x81,0x23,0x81,0x23,0x81,0x24,0x81,0x25,0x81,0x26,0x81,0x26,0x81,0x24,0x81,0x23,0x81,0x22,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x81,0x27,0xf,0xf9,0xe5,0x21,0x81,0x21,0xc4,0xc4,0xc4,0x81,0x28,0xe0,0x1,0xce,0xc6,0x1b,0xe1,0x2,0xc7,0xc,0xc4,0x1,0xe1,0x1,0xc7,0xd,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xd3,0xd3,0xd3,0x0,0x1a,0x65,0x61,0x63,0x68,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0x2,0x6c,0x74,0xc1,0xe,0x88,0xc1,0xe,0x92,0x24,0x81,0x2c,0x81,0x2d,0x81,0x2d,0x81,0x2c,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x81,0x2e,0xf,0x4d,0xba,0xc3,0xc4,0xc4,0xc4,0x81,0x2f,0xe1,0x2,0xc9,0x0,0x0,0xe0,0x1,0xcf,0x0,0xc6,0x1b,0xc9,0x0,0x2,0xd3,0xc9,0x0,0x2,0xd3,0x0,0xc1,0xe,0xd0,0xc1,0xe,0xda,0x24,0x81,0x31,0x81,0x32,0x81,0x32,0x81,0x31,0xc0,0x80,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x81,0x33,0xf,0x81,0x34,0xb7,0xc3,0xc4,0xc4,0xc4,0x81,0x35,0xe1,0x1,0xc8,0x0,0x0,0xe0,0x1,0xcf,0x0,0xc6,0x1b,0xc9,0x0,0x2,0xd3,0xd3,0x0,0x5,0x5f,0x65,0x61,0x63,0x68,0x2,0x66,0x6e,0x21,0x81,0x38,0x21,0x81,0x39,0x2,0x61,0x74,0x23,0x0,0x81,0x20,0x81,0x3b,0x23,0xc1,0xc1,0xc2,0xc0,0xc0,0x22,0xfc,0x81,0x3e,0xc1,0xd,0x3c,0xc1,0xd,0x58,0xc1,0xd,0x6e,0xc1,0xd,0x88,0xc1,0xd,0x7e,0xc1,0xd,0xe4,0xc1,0xe,0x28,0x37,0x81,0x40,0x81,0x40,0x81,0x41,0x81,0x41,0x81,0x42,0x81,0x42,0x81,0x42,0x81,0x41,0x81,0x43,0x81,0x44,0x81,0x43,0x81,0x45,0x81,0x45,0x81,0x46,0x81,0x46,0x81,0x46,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x67,0x7,0x81,0x3f,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x81,0x47,0xf,0xff,0xe5,0x6c,0x81,0x37,0x81,0x3a,0x81,0x3c,0x81,0x3d,0x81,0x48,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xe1,0x2,0xc7,0xe,0xcb,0x0,0xca,0x0,0xd3,0xd3,0xdd,0x0,0x0,0x26,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x2a,0xd3,0xdb,0x0,0x0,0x27,0xc2,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xd1,0x1,0xc4,0x0,0xd6,0x2,0xe1,0x2,0xc7,0xf,0xcb,0x2,0xcb,0x1,0xd3,0xdd,0x0,0x0,0x60,0xe1,0x2,0xc7,0xc,0xcb,0x2,0xc4,0x1,0xd3,0xd6,0x2,0xcb,0x0,0xe3,0x0,0xd0,0x81,0x30,0xd3,0xc0,0xe3,0x0,0xd0,0x81,0x36,0xd3,0xd4,0xdb,0x0,0x0,0x34,0xc2,0x0,0x19,0x6d,0x61,0x70,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0x5,0x41,0x72,0x72,0x61,0x79,0x3,0x6e,0x65,0x77,0xc1,0x12,0xe2,0xc1,0x12,0xec,0x24,0x81,0x4d,0x81,0x4e,0x81,0x4e,0x81,0x4d,0xc0,0xa0,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x81,0x4f,0xf,0x81,0x50,0xba,0xc3,0xc4,0xc4,0xc4,0x81,0x51,0xe1,0x2,0xc9,0x0,0x0,0xe0,0x1,0xcf,0x0,0xc6,0x1b,0xc9,0x0,0x2,0xd3,0xc9,0x0,0x2,0xd3,0x0,0xc1,0x13,0x32,0xc1,0x13,0x3c,0x24,0x81,0x53,0x81,0x54,0x81,0x54,0x81,0x53,0xc0,0xa2,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x81,0x55,0xf,0x81,0x56,0xb7,0xc3,0xc4,0xc4,0xc4,0x81,0x57,0xe1,0x1,0xc8,0x0,0x0,0xe0,0x1,0xcf,0x0,0xc6,0x1b,0xc9,0x0,0x2,0xd3,0xd3,0x0,0x6,0x74,0x6f,0x4c,0x69,0x73,0x74,0x4,0x5f,0x6d,0x61,0x70,0x3,0x72,0x65,0x73,0x25,0x0,0x81,0x20,0x81,0x3b,0x81,0x5b,0x12,0x25,0xc1,0xc1,0xc2,0xc1,0xc1,0xc0,0x7c,0xc0,0xec,0x22,0x81,0x5e,0x81,0x5f,0xc1,0x11,0x66,0xc1,0x11,0x82,0xc1,0x11,0x98,0xc1,0x11,0xb2,0xc1,0x11,0xa8,0xc1,0x12,0xc,0xc1,0x12,0x56,0xc1,0x12,0x4c,0xc1,0x12,0x7a,0xc1,0x13,0x5e,0xc1,0x13,0x82,0xc1,0x13,0x8a,0xe1,0x21,0x81,0x61,0x81,0x61,0x81,0x62,0x81,0x62,0x81,0x63,0x81,0x63,0x81,0x63,0x81,0x62,0x81,0x64,0x81,0x65,0x81,0x64,0x81,0x66,0x81,0x66,0x81,0x67,0x81,0x68,0x81,0x67,0x81,0x69,0x81,0x69,0x81,0x69,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x81,0x6a,0x81,0x6a,0x81,0x6b,0x81,0x6b,0x81,0x6c,0x81,0x6c,0x81,0x6b,0xc0,0x8c,0x67,0x7,0x81,0x60,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x81,0x6d,0xf,0x81,0x6e,0xe5,0x81,0x11,0x81,0x5a,0x81,0x3a,0x81,0x5c,0x81,0x5d,0x81,0x6f,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xe1,0x2,0xc7,0xe,0xcb,0x0,0xca,0x0,0xd3,0xd3,0xdd,0x0,0x0,0x26,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x4a,0xd3,0xdb,0x0,0x0,0x27,0xc2,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xd1,0x1,0xc4,0x0,0xd6,0x2,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x3,0xe1,0x2,0xc7,0xf,0xcb,0x2,0xcb,0x1,0xd3,0xdd,0x0,0x0,0x76,0xe1,0x2,0xc7,0xc,0xcb,0x2,0xc4,0x1,0xd3,0xd6,0x2,0xcb,0x0,0xe3,0x0,0xd0,0x81,0x52,0xd3,0xc0,0xe3,0x0,0xd0,0x81,0x58,0xd3,0xd4,0xd1,0x4,0xe0,0x1,0xcb,0x3,0xc6,0x81,0x1e,0xcb,0x4,0xd3,0xdb,0x0,0x0,0x3e,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xcb,0x3,0xc6,0x81,0x59,0xd3,0xd3,0x0,0x4,0x66,0x72,0x6f,0x6d,0xe0,0x22,0x66,0x69,0x6e,0x64,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x6e,0x20,0x65,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x20,0x6f,0x72,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x5,0x5f,0x66,0x69,0x6e,0x64,0x7,0x65,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x21,0x81,0x74,0x21,0x81,0x75,0x3,0x24,0x61,0x74,0x24,0x81,0x20,0x81,0x77,0x0,0x12,0x24,0xc1,0xc2,0xc1,0xc1,0xc1,0x1,0x3e,0xc1,0x1,0xce,0xc1,0x1,0xe8,0xc1,0x2,0x70,0x24,0x81,0x7a,0x81,0x7b,0x81,0x7c,0x81,0x7d,0xc1,0x16,0xf6,0xc1,0x17,0x1a,0xc1,0x17,0x26,0xc1,0x17,0x58,0xc1,0x17,0x8a,0xc1,0x17,0xb2,0xc1,0x17,0xaa,0xc1,0x17,0xd4,0xc1,0x18,0x10,0xc1,0x18,0x4,0xc1,0x18,0x7c,0xc1,0x18,0xa0,0xc1,0x18,0xc0,0xc1,0x18,0xb6,0xc1,0x19,0x30,0xc1,0x19,0x3e,0xc1,0x19,0x74,0xc1,0x19,0xa8,0xc1,0x19,0xc8,0xc1,0x1a,0x12,0xc1,0x1a,0x72,0xc1,0x1a,0x80,0xc1,0x1a,0xb8,0xc1,0x1a,0xac,0xc1,0x1a,0xdc,0xc1,0x1b,0x22,0xe1,0x48,0x81,0x7f,0x81,0x7f,0x82,0x0,0x82,0x0,0x82,0x0,0x82,0x1,0x82,0x1,0x82,0x1,0x82,0x2,0x82,0x2,0x82,0x3,0x82,0x3,0x82,0x3,0x82,0x4,0x82,0x4,0x82,0x5,0x82,0x5,0x82,0x5,0x82,0x4,0x82,0x6,0x82,0x6,0x82,0x6,0x82,0x7,0x82,0x7,0x82,0x8,0x82,0x8,0x82,0x7,0x82,0x9,0x82,0x9,0x82,0xa,0x82,0xa,0x82,0xa,0x82,0xb,0x82,0xc,0x82,0xb,0x82,0xd,0x82,0xd,0x82,0xe,0x82,0xe,0x82,0xd,0x82,0xf,0x82,0xf,0x82,0x10,0x82,0x10,0x82,0x11,0x82,0x11,0x82,0x11,0xc0,0xc0,0xc0,0x82,0x12,0x82,0x12,0x82,0x12,0x82,0x13,0x82,0x13,0x82,0x14,0x82,0x14,0x82,0x13,0x82,0x15,0x82,0x15,0x82,0x16,0x82,0x16,0x82,0x15,0x82,0x17,0x82,0x17,0x82,0x17,0xc0,0xc0,0xc0,0x82,0x18,0x82,0x18,0x82,0x18,0xc0,0xb6,0x67,0x7,0x81,0x7e,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x82,0x19,0xf,0x82,0x1a,0xe5,0x82,0x4b,0x81,0x73,0x81,0x76,0x81,0x78,0x81,0x79,0x82,0x1b,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x8,0xcb,0x0,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x21,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0xdb,0x0,0x0,0x22,0xc2,0xe0,0x1,0xcc,0xc6,0x1b,0xc6,0x81,0x71,0xd3,0xdc,0x0,0x0,0x31,0xc4,0x1,0xd6,0x1,0xe1,0x2,0xc7,0xf,0xcb,0x1,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x56,0xe1,0x2,0xc7,0xc,0xe1,0x2,0xc7,0xc,0xcb,0x0,0xc4,0x1,0xd3,0xcb,0x1,0xd3,0xd6,0x1,0xdb,0x0,0x0,0x57,0xc2,0xe1,0x2,0xc7,0xf,0xcb,0x1,0xc4,0x1,0xd3,0xdd,0x0,0x0,0x6c,0xc4,0x1,0xd6,0x1,0xdb,0x0,0x0,0x6d,0xc2,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xcc,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0xf3,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x2,0xe1,0x1,0xc7,0x5,0xcb,0x2,0xd3,0xdd,0x0,0x0,0x9e,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x72,0xd3,0xdb,0x0,0x0,0x9f,0xc2,0xe1,0x2,0xc7,0xa,0xcb,0x1,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xd3,0xdd,0x0,0x0,0xe7,0xe0,0x1,0xce,0xc6,0x1b,0xcb,0x1,0xd3,0xd1,0x3,0xe1,0x2,0xcb,0x2,0xcb,0x3,0xcb,0x1,0xd3,0xdd,0x0,0x0,0xd7,0xe1,0x3,0xc7,0x6,0xc4,0x0,0xcb,0x1,0xcb,0x3,0xd3,0xdb,0x0,0x0,0xd8,0xc2,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x1,0xd3,0xd6,0x1,0xdb,0x0,0x0,0x9f,0xc2,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0xdb,0x0,0x0,0xf4,0xc2,0xe1,0x2,0xc7,0xa,0xcb,0x1,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xd3,0xdd,0x0,0x1,0x38,0xe1,0x2,0xc7,0x8,0xe0,0x1,0xce,0xc6,0x1b,0xcb,0x1,0xd3,0xca,0x0,0xd3,0xdd,0x0,0x1,0x28,0xe1,0x3,0xc7,0x6,0xc4,0x0,0xcb,0x1,0xca,0x0,0xd3,0xdb,0x0,0x1,0x29,0xc2,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x1,0xd3,0xd6,0x1,0xdb,0x0,0x0,0xf4,0xc2,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0x0,0x6,0x5f,0x5f,0x6c,0x69,0x73,0x74,0x2,0x67,0x74,0xc1,0x1f,0xa2,0x22,0x82,0x1f,0x82,0x1f,0xc1,0x1,0x4,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x82,0x20,0xf,0x82,0x21,0xb3,0xc3,0xc4,0xc4,0xc4,0x82,0x22,0xe1,0x2,0xc9,0x0,0x0,0xc9,0x0,0x5,0xc9,0x0,0x4,0xd3,0x0,0xc1,0x1f,0xe4,0x22,0x82,0x24,0x82,0x24,0xc1,0x1,0x6,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x82,0x25,0xf,0x82,0x26,0xb0,0xc3,0xc4,0xc4,0xc4,0x82,0x27,0xe1,0x1,0xc9,0x0,0x1,0xc9,0x0,0x5,0xd3,0x0,0x7,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,0x9,0x70,0x72,0x65,0x64,0x69,0x63,0x61,0x74,0x65,0x21,0x82,0x2a,0x21,0x82,0x2b,0x3,0x6c,0x65,0x6e,0x3,0x61,0x72,0x72,0x1,0x63,0x27,0x0,0x81,0x38,0x82,0x2d,0x82,0x2e,0x81,0x3b,0x12,0x82,0x2f,0x27,0xc1,0xc1,0xc1,0xc1,0xc2,0xc1,0xc1,0xc0,0x90,0xc1,0x1,0x52,0x22,0x82,0x32,0x82,0x33,0xc1,0x1d,0xce,0xc1,0x1e,0x34,0xc1,0x1e,0x56,0xc1,0x1e,0x6e,0xc1,0x1e,0x70,0xc1,0x1e,0x96,0xc1,0x1e,0x8c,0xc1,0x1f,0xe,0xc1,0x1f,0x28,0xc1,0x1f,0x30,0xc1,0x1f,0x60,0xc1,0x20,0xe,0xe1,0x23,0x82,0x35,0x82,0x35,0x82,0x36,0x82,0x36,0x82,0x37,0x82,0x37,0x82,0x37,0x82,0x38,0x82,0x38,0x82,0x39,0x82,0x39,0x82,0x39,0x82,0x38,0x82,0x3a,0x82,0x3b,0x82,0x3a,0xc0,0xc0,0xc0,0x82,0x3c,0x82,0x3c,0x82,0x3c,0x82,0x3d,0x82,0x3d,0x82,0x3e,0x82,0x3e,0x82,0x3d,0x82,0x3f,0x82,0x3f,0xc0,0xc0,0xc0,0xc0,0x82,0x40,0x82,0x40,0xc0,0xea,0x67,0x7,0x82,0x34,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x82,0x41,0xf,0x82,0x42,0xe5,0x81,0x35,0x82,0x29,0x82,0x2c,0x82,0x30,0x82,0x31,0x82,0x43,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x0,0xca,0x0,0xdc,0x0,0x0,0x11,0xc9,0x0,0x5,0xd1,0x1,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x8,0xcb,0x2,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x39,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe1,0x0,0xc7,0x11,0xd3,0xd3,0xdb,0x0,0x0,0x3a,0xc2,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x3,0xc4,0x0,0xd6,0x4,0xe1,0x2,0xc7,0xc,0xcb,0x4,0xc4,0x1,0xd3,0xd6,0x4,0xe1,0x2,0xc7,0x12,0xcb,0x4,0xcb,0x2,0xd3,0xdd,0x0,0x0,0x73,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xcb,0x3,0xc6,0x81,0x59,0xd3,0xd3,0xdb,0x0,0x0,0x74,0xc2,0xe0,0x1,0xce,0xc6,0x1b,0xcb,0x4,0xd3,0xd1,0x5,0xcb,0x0,0xe3,0x0,0xd0,0x82,0x23,0xd3,0xc0,0xe3,0x0,0xd0,0x82,0x28,0xd3,0xd4,0xd1,0x6,0xcb,0x6,0xdd,0x0,0x0,0xa4,0xe0,0x1,0xcb,0x3,0xc6,0x81,0x1e,0xcb,0x5,0xd3,0xdb,0x0,0x0,0xa5,0xc2,0xdb,0x0,0x0,0x48,0xc2,0x0,0x1c,0x72,0x65,0x64,0x75,0x63,0x65,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0x3,0x68,0x61,0x73,0x7,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0xc1,0x25,0xbe,0x22,0x82,0x48,0x82,0x48,0xc1,0x1,0x2a,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x82,0x49,0xf,0x82,0x4a,0xb4,0xc3,0xc4,0xc4,0xc4,0x82,0x4b,0xe0,0x1,0xcd,0x0,0xc6,0x1b,0xc6,0x82,0x47,0xd3,0xd9,0x0,0x2,0x0,0xc1,0x26,0x26,0x22,0x82,0x4d,0x82,0x4d,0xc1,0x1,0x2c,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x82,0x4e,0xf,0x82,0x4f,0xb8,0xc3,0xc4,0xc4,0xc4,0x82,0x50,0xe0,0x1,0xcf,0x0,0xc6,0x1b,0xc4,0x1,0xd3,0xd9,0x0,0x2,0xc4,0x2,0xd9,0x0,0x1,0x0,0x7,0x5f,0x72,0x65,0x64,0x75,0x63,0x65,0x2,0x24,0x69,0x4,0x24,0x72,0x65,0x73,0x23,0x0,0x82,0x53,0x82,0x54,0x23,0xc1,0xc2,0xc2,0xc0,0x8a,0xc0,0xee,0x22,0x82,0x57,0x82,0x58,0xc1,0x24,0x9e,0xc1,0x24,0xc6,0xc1,0x24,0xe6,0xc1,0x24,0xdc,0xc1,0x25,0x82,0xc1,0x26,0x5a,0xc1,0x26,0x68,0xc1,0x26,0x9e,0xc1,0x26,0xb4,0xc1,0x26,0xfc,0x3d,0x82,0x5a,0x82,0x5a,0x82,0x5b,0x82,0x5b,0x82,0x5b,0x82,0x5c,0x82,0x5d,0x82,0x5c,0x82,0x5e,0x82,0x5e,0xc0,0xc0,0xc0,0xc0,0x82,0x5f,0x82,0x5f,0x82,0x60,0x82,0x60,0x82,0x5f,0x82,0x61,0x82,0x62,0x82,0x62,0x82,0x61,0xc0,0xc0,0xc0,0x82,0x63,0x82,0x63,0x82,0x63,0xc1,0x1,0x1e,0x67,0x7,0x82,0x59,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x82,0x64,0xf,0x82,0x65,0xe5,0x81,0xc,0x82,0x52,0x81,0x3a,0x82,0x55,0x82,0x56,0x82,0x66,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdc,0x0,0x0,0xc,0xca,0x0,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x1,0xc7,0x7,0xc6,0x82,0x45,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xc4,0x1,0xd6,0x1,0xc2,0xd6,0x2,0xe0,0x1,0xcc,0xc6,0x82,0x46,0xc6,0x82,0x47,0xd3,0xe3,0x0,0xd0,0x82,0x4c,0xd3,0xc0,0xe3,0x0,0xd0,0x82,0x51,0xd3,0xd4,0xe1,0x2,0xc7,0xa,0xcb,0x1,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xd3,0xdd,0x0,0x0,0x77,0xe1,0x2,0xcb,0x0,0xcb,0x2,0xe0,0x1,0xce,0xc6,0x1b,0xcb,0x1,0xd3,0xd3,0xd6,0x2,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x1,0xd3,0xd6,0x1,0xdb,0x0,0x0,0x45,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xcb,0x2,0xd3,0x0,0x4,0x65,0x61,0x63,0x68,0x23,0xc0,0xc0,0xc0,0xc1,0x1,0x40,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x82,0x69,0xf,0x82,0x6a,0xb4,0xc3,0x14,0xc4,0xc4,0x82,0x6b,0xe1,0x2,0xc7,0xc,0xc9,0x0,0x0,0xca,0x0,0xd3,0xd9,0x0,0x0,0x0,0x4,0x5f,0x73,0x75,0x6d,0x4,0x24,0x73,0x75,0x6d,0x21,0x82,0x6e,0x21,0xc2,0xc1,0x27,0xc6,0xc1,0x28,0x6,0x25,0x82,0x71,0x82,0x71,0x82,0x72,0x82,0x72,0x82,0x72,0xc1,0x1,0x3c,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x82,0x73,0xf,0x82,0x74,0xe5,0x22,0x82,0x6d,0xc4,0x82,0x6f,0x82,0x70,0x82,0x75,0xc4,0x0,0xd6,0x0,0xf0,0x1,0x1,0xce,0xc6,0x82,0x68,0xd0,0x82,0x6c,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xcb,0x0,0xd3,0x0,0x4,0x54,0x61,0x73,0x6b,0x7,0x77,0x6f,0x72,0x6b,0x65,0x72,0x73,0x3,0x6d,0x75,0x6c,0x5,0x74,0x69,0x6d,0x65,0x73,0x4,0x69,0x64,0x69,0x76,0x3,0x72,0x75,0x6e,0xc1,0x2c,0x42,0x22,0x82,0x7d,0x82,0x7d,0xc1,0x1,0x5e,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x82,0x7e,0xf,0x82,0x7f,0xb3,0xc3,0xc4,0xc4,0xc4,0x83,0x0,0xe1,0x2,0xc8,0x1,0x1,0xc9,0x0,0x0,0xc9,0x0,0x1,0xd3,0x0,0x1,0x6e,0x21,0x83,0x2,0x21,0x83,0x3,0x4,0x75,0x70,0x74,0x6f,0x4,0x74,0x61,0x73,0x6b,0x23,0x81,0x71,0x83,0x5,0x83,0x6,0x23,0xc1,0xc1,0xc1,0xc1,0x2b,0xee,0xc1,0x2b,0xe0,0xc1,0x2c,0x2e,0xc1,0x2c,0x26,0xc1,0x2c,0x1e,0xc1,0x2c,0x76,0xc1,0x2c,0xb6,0x30,0x83,0x9,0x83,0x9,0x83,0xa,0x83,0xa,0x83,0xa,0x83,0x9,0x83,0xb,0x83,0xc,0x83,0xd,0x83,0xc,0x83,0xb,0x83,0xe,0x83,0xe,0x83,0xf,0x83,0xf,0x83,0xf,0xc1,0x1,0x58,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x83,0x10,0xf,0x83,0x11,0xe5,0x4e,0xc3,0x83,0x4,0x83,0x7,0x83,0x8,0x83,0x12,0xc9,0x0,0x3,0xd1,0x0,0xe1,0x2,0xc7,0x15,0xe1,0x2,0xc7,0x14,0xca,0x0,0xc8,0x0,0x0,0xd3,0xc9,0x0,0x1,0xd3,0xd1,0x1,0xf0,0x1,0x1,0xe0,0x0,0xc7,0x13,0xc6,0x81,0x4c,0xd3,0xc6,0x82,0x7c,0xd0,0x83,0x1,0xd3,0xd1,0x2,0xe0,0x1,0xc9,0x0,0x2,0xc6,0x81,0x1e,0xcb,0x2,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x1,0xd3,0xd9,0x0,0x3,0x0,0x3,0x6d,0x61,0x70,0x4,0x77,0x61,0x69,0x74,0x21,0x20,0x21,0x83,0x16,0xc1,0x2c,0xe8,0x22,0x83,0x18,0x83,0x18,0xc1,0x1,0x64,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x83,0x19,0xf,0x83,0x1a,0xb0,0xc3,0x83,0x17,0xc4,0xc4,0x83,0x1b,0xe0,0x0,0xca,0x0,0xc6,0x83,0x15,0xd3,0x0,0x8,0x5f,0x70,0x63,0x68,0x75,0x6e,0x6b,0x73,0x21,0x81,0x20,0x4,0x77,0x6f,0x72,0x6b,0x21,0x83,0x1f,0x22,0x83,0x1e,0x83,0x20,0x5,0x63,0x6f,0x75,0x6e,0x74,0x5,0x74,0x61,0x73,0x6b,0x73,0x5,0x24,0x66,0x72,0x6f,0x6d,0x24,0x82,0x78,0x83,0x22,0x83,0x23,0x83,0x24,0x24,0xc1,0xc1,0xc1,0xc2,0xc1,0x29,0xc8,0xc1,0x29,0xc0,0xc1,0x29,0xf8,0xc1,0x2a,0x12,0xc1,0x2a,0x2a,0xc1,0x2a,0x2c,0xc1,0x2a,0x36,0xc1,0x2a,0xf0,0xc1,0x2b,0xe,0xc1,0x2b,0x3a,0xc1,0x2b,0x30,0xc1,0x2b,0x7a,0xc1,0x2c,0xd0,0x3d,0x83,0x27,0x83,0x28,0x83,0x27,0x83,0x29,0x83,0x29,0x83,0x29,0x83,0x2a,0x83,0x2a,0x83,0x2a,0x83,0x2b,0x83,0x2b,0x83,0x2c,0x83,0x2c,0x83,0x2d,0x83,0x2d,0x83,0x2c,0x83,0x2b,0x83,0x2e,0x83,0x2f,0x83,0x2f,0x83,0x2f,0x83,0x2e,0x83,0x30,0x83,0x31,0x83,0x30,0x83,0x32,0x83,0x32,0x83,0x33,0x83,0x33,0xc1,0x1,0x4a,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x83,0x34,0xf,0x83,0x35,0xe5,0x81,0x2,0x83,0x1d,0x83,0x21,0x83,0x25,0x83,0x26,0x83,0x36,0xe0,0x0,0xc7,0x13,0xc6,0x82,0x78,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0xa,0xcb,0x0,0xc4,0x1,0xd3,0xdc,0x0,0x0,0x20,0xe1,0x2,0xc7,0xa,0xca,0x0,0xc4,0x1,0xd3,0xdd,0x0,0x0,0x3d,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe1,0x1,0xc7,0x11,0xe1,0x2,0xca,0x1,0xc4,0x1,0xca,0x0,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0x3e,0xc2,0xe1,0x2,0xc9,0x0,0x8,0xca,0x0,0xe1,0x2,0xc7,0x14,0xcb,0x0,0xc4,0x4,0xd3,0xd3,0xd1,0x1,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x2,0xc4,0x1,0xd6,0x3,0xf0,0x1,0x1,0xcb,0x1,0xc6,0x82,0x7a,0xd0,0x83,0x13,0xd3,0xf0,0x1,0x1,0xcb,0x2,0xc6,0x83,0x14,0xd0,0x83,0x1c,0xd3,0x0,0x6,0x72,0x65,0x64,0x75,0x63,0x65,0x3,0x63,0x61,0x74,0xc1,0x2d,0x48,0x22,0x83,0x3a,0x83,0x3a,0xc1,0x1,0x68,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x83,0x3b,0xf,0x83,0x3c,0xb2,0xc3,0x81,0x6,0xc4,0xc4,0x83,0x3d,0xe0,0x1,0xca,0x0,0xc6,0x83,0x39,0xca,0x1,0xd3,0x0,0x5,0x5f,0x70,0x63,0x61,0x74,0x6,0x63,0x68,0x75,0x6e,0x6b,0x73,0x21,0x83,0x40,0x21,0x83,0x41,0xc1,0x2d,0x26,0x22,0x83,0x43,0x83,0x43,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x83,0x44,0xf,0x83,0x3c,0xb5,0x83,0x3f,0x83,0x42,0xc4,0xc4,0x83,0x45,0xf0,0x1,0x1,0xca,0x0,0xc6,0x83,0x38,0xd0,0x83,0x3e,0xd3,0x0,0x1b,0x70,0x65,0x61,0x63,0x68,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0xc1,0x30,0xb8,0xc1,0x30,0xc2,0x24,0x83,0x48,0x83,0x49,0x83,0x49,0x83,0x48,0xc1,0x1,0x7e,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x83,0x4a,0xf,0x83,0x4b,0xbb,0xc3,0xc4,0xc4,0xc4,0x83,0x4c,0xe1,0x2,0xc9,0x1,0x0,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x1b,0xc9,0x0,0x0,0xd3,0xc9,0x0,0x0,0xd3,0x0,0xc1,0x31,0x8,0xc1,0x31,0x12,0x24,0x83,0x4e,0x83,0x4f,0x83,0x4f,0x83,0x4e,0xc1,0x1,0x80,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x83,0x50,0xf,0x83,0x51,0xb8,0xc3,0xc4,0xc4,0xc4,0x83,0x52,0xe1,0x1,0xc8,0x1,0x0,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x1b,0xc9,0x0,0x0,0xd3,0xd3,0x0,0x21,0x81,0x71,0x21,0x83,0x5,0x22,0x83,0x54,0x83,0x55,0x21,0x81,0x3b,0x22,0xcc,0xf9,0xc1,0x30,0x6e,0x2a,0x83,0x59,0x83,0x59,0x83,0x59,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc1,0x1,0x78,0x67,0x7,0x83,0x58,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x83,0x5a,0xf,0x83,0x5b,0xe5,0x3c,0xc3,0x83,0x56,0x83,0x57,0x82,0x70,0x83,0x5c,0xca,0x0,0xd6,0x0,0xe1,0x2,0xc7,0xa,0xcb,0x0,0xca,0x1,0xd3,0xdd,0x0,0x0,0x31,0xc9,0x0,0x0,0xe3,0x0,0xd0,0x83,0x4d,0xd3,0xc0,0xe3,0x0,0xd0,0x83,0x53,0xd3,0xd4,0xe1,0x2,0xc7,0xc,0xcb,0x0,0xc4,0x1,0xd3,0xd6,0x0,0xdb,0x0,0x0,0x4,0xc2,0x0,0x6,0x5f,0x70,0x65,0x61,0x63,0x68,0x4,0x6c,0x69,0x73,0x74,0x22,0x0,0x83,0x5f,0x22,0xc1,0xc1,0xc1,0x2f,0x1c,0xc1,0x2f,0x38,0xc1,0x2f,0x4e,0xc1,0x2f,0x68,0xc1,0x2f,0x5e,0xc1,0x2f,0xc4,0xc1,0x2f,0xec,0xc1,0x2f,0xf6,0xc1,0x31,0x5a,0x34,0x83,0x62,0x83,0x62,0x83,0x63,0x83,0x63,0x83,0x64,0x83,0x64,0x83,0x64,0x83,0x63,0x83,0x65,0x83,0x66,0x83,0x65,0x83,0x67,0x83,0x67,0x83,0x68,0x83,0x69,0x83,0x69,0x83,0x68,0x83,0x6a,0x83,0x6a,0x83,0x6a,0xc1,0x1,0x70,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x83,0x6b,0xf,0x83,0x6c,0xe5,0x53,0x83,0x5e,0x81,0x3a,0x83,0x60,0x83,0x61,0x83,0x6d,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xe1,0x2,0xc7,0xe,0xcb,0x0,0xca,0x0,0xd3,0xd3,0xdd,0x0,0x0,0x26,0xe1,0x1,0xc7,0x7,0xc6,0x83,0x47,0xd3,0xdb,0x0,0x0,0x27,0xc2,0xe0,0x0,0xce,0xc6,0x81,0x59,0xd3,0xd1,0x1,0xe1,0x2,0xc9,0x0,0x11,0xe0,0x0,0xcb,0x1,0xc6,0x81,0x20,0xd3,0xd0,0x83,0x5d,0xd3,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0x0,0x1a,0x70,0x6d,0x61,0x70,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0xc1,0x35,0x8e,0xc1,0x35,0x98,0x24,0x83,0x70,0x83,0x71,0x83,0x71,0x83,0x70,0xc1,0x1,0xa2,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x83,0x72,0xf,0x83,0x73,0xbb,0xc3,0xc4,0xc4,0xc4,0x83,0x74,0xe1,0x2,0xc9,0x1,0x0,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x1b,0xc9,0x0,0x1,0xd3,0xc9,0x0,0x1,0xd3,0x0,0xc1,0x35,0xe6,0xc1,0x35,0xf0,0x24,0x83,0x76,0x83,0x77,0x83,0x77,0x83,0x76,0xc1,0x1,0xa4,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x83,0x78,0xf,0x83,0x79,0xb8,0xc3,0xc4,0xc4,0xc4,0x83,0x7a,0xe1,0x1,0xc8,0x1,0x0,0xe0,0x1,0xc9,0x1,0x1,0xc6,0x1b,0xc9,0x0,0x1,0xd3,0xd3,0x0,0x23,0x81,0x5b,0x81,0x3b,0x12,0x23,0xc1,0xc2,0xc1,0xc0,0x8e,0x22,0xd6,0x83,0x7e,0xc1,0x34,0xe4,0xc1,0x34,0xda,0xc1,0x35,0x3c,0xc1,0x36,0x1a,0xc1,0x36,0x68,0x31,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x2,0x84,0x2,0x84,0x2,0xc0,0xc0,0xc0,0xc0,0x84,0x3,0x84,0x3,0xc0,0xc0,0xc0,0x84,0x4,0x84,0x4,0xc1,0x1,0x9a,0x67,0x7,0x83,0x7f,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x84,0x5,0xf,0x84,0x6,0xe5,0x5a,0xc3,0x83,0x56,0x83,0x7c,0x83,0x7d,0x84,0x7,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x0,0xca,0x0,0xd6,0x1,0xe1,0x2,0xc7,0xa,0xcb,0x1,0xca,0x1,0xd3,0xdd,0x0,0x0,0x47,0xc9,0x0,0x0,0xe3,0x0,0xd0,0x83,0x75,0xd3,0xc0,0xe3,0x0,0xd0,0x83,0x7b,0xd3,0xd4,0xd1,0x2,0xe0,0x1,0xcb,0x0,0xc6,0x81,0x1e,0xcb,0x2,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x1,0xd3,0xd6,0x1,0xdb,0x0,0x0,0xe,0xc2,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x59,0xd3,0x0,0x5,0x5f,0x70,0x6d,0x61,0x70,0xc1,0x33,0x6e,0xc1,0x33,0x8a,0xc1,0x33,0xa0,0xc1,0x33,0xba,0xc1,0x33,0xb0,0xc1,0x34,0x14,0xc1,0x34,0x46,0xc1,0x34,0x3a,0xc1,0x34,0x5e,0xc1,0x34,0x60,0xc1,0x34,0x78,0xc1,0x34,0x8a,0xc1,0x34,0x94,0x3e,0x84,0xa,0x84,0xa,0x84,0xb,0x84,0xb,0x84,0xc,0x84,0xc,0x84,0xc,0x84,0xb,0x84,0xd,0x84,0xe,0x84,0xd,0x84,0xf,0x84,0xf,0x84,0x10,0x84,0x10,0x84,0x11,0x84,0x11,0x84,0x10,0x84,0x12,0x84,0x12,0x84,0x13,0x84,0x13,0x84,0x13,0x84,0x12,0x84,0x14,0x84,0x15,0x84,0x16,0x84,0x16,0x84,0x15,0x84,0x14,0xc1,0x1,0x90,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x84,0x17,0xf,0x84,0x18,0xe5,0x76,0x84,0x9,0x81,0x3a,0x83,0x60,0x83,0x61,0x84,0x19,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xe1,0x2,0xc7,0xe,0xcb,0x0,0xca,0x0,0xd3,0xd3,0xdd,0x0,0x0,0x26,0xe1,0x1,0xc7,0x7,0xc6,0x83,0x6f,0xd3,0xdb,0x0,0x0,0x27,0xc2,0xe0,0x0,0xce,0xc6,0x81,0x59,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xcb,0x1,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x53,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe1,0x0,0xc7,0x11,0xd3,0xd3,0xdb,0x0,0x0,0x54,0xc2,0xe1,0x1,0xc9,0x0,0x12,0xe1,0x2,0xc9,0x0,0x11,0xe0,0x0,0xcb,0x1,0xc6,0x81,0x20,0xd3,0xd0,0x84,0x8,0xd3,0xd3,0x0,0xc1,0x3a,0x4,0x22,0x84,0x1b,0x84,0x1b,0xc1,0x1,0xc8,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x84,0x1c,0xf,0x84,0x1d,0xb3,0xc3,0xc4,0xc4,0xc4,0x84,0x1e,0xe1,0x2,0xc9,0x1,0x0,0xc9,0x0,0x2,0xc9,0x0,0x1,0xd3,0x0,0xc1,0x3a,0x4e,0x22,0x84,0x20,0x84,0x20,0xc1,0x1,0xca,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x84,0x21,0xf,0x84,0x22,0xb0,0xc3,0xc4,0xc4,0xc4,0x84,0x23,0xe1,0x1,0xc9,0x1,0x1,0xc9,0x0,0x2,0xd3,0x0,0x24,0x81,0x5b,0x81,0x3b,0x12,0x82,0x2f,0xc0,0xbc,0x22,0xd6,0x84,0x26,0xc1,0x39,0x28,0xc1,0x39,0x1e,0xc1,0x39,0x80,0xc1,0x39,0xba,0xc1,0x3a,0x80,0xc1,0x3a,0xce,0x33,0x84,0x28,0x84,0x29,0x84,0x28,0x84,0x2a,0x84,0x2a,0x84,0x2a,0x84,0x2b,0x84,0x2b,0xc0,0xc0,0xc0,0xc0,0x84,0x2c,0x84,0x2c,0xc0,0xc0,0xc0,0x84,0x2d,0x84,0x2d,0xc1,0x1,0xbe,0x67,0x7,0x84,0x27,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x84,0x2e,0xf,0x84,0x2f,0xe5,0x71,0xc3,0x83,0x56,0x84,0x25,0x81,0x79,0x84,0x30,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x0,0xca,0x0,0xd6,0x1,0xe1,0x2,0xc7,0xa,0xcb,0x1,0xca,0x1,0xd3,0xdd,0x0,0x0,0x5e,0xe0,0x1,0xc9,0x0,0x2,0xc6,0x1b,0xcb,0x1,0xd3,0xd1,0x2,0xc9,0x0,0x0,0xe3,0x0,0xd0,0x84,0x1f,0xd3,0xc0,0xe3,0x0,0xd0,0x84,0x24,0xd3,0xd4,0xd1,0x3,0xcb,0x3,0xdd,0x0,0x0,0x4e,0xe0,0x1,0xcb,0x0,0xc6,0x81,0x1e,0xcb,0x2,0xd3,0xdb,0x0,0x0,0x4f,0xc2,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x1,0xd3,0xd6,0x1,0xdb,0x0,0x0,0xe,0xc2,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x59,0xd3,0x0,0x8,0x5f,0x70,0x66,0x69,0x6c,0x74,0x65,0x72,0x23,0x0,0x81,0x38,0x83,0x5f,0xc1,0x37,0xf2,0xc1,0x38,0x58,0xc1,0x38,0x8a,0xc1,0x38,0x7e,0xc1,0x38,0xa2,0xc1,0x38,0xa4,0xc1,0x38,0xbc,0xc1,0x38,0xce,0xc1,0x38,0xd8,0x35,0x84,0x34,0x84,0x34,0x84,0x35,0x84,0x35,0x84,0x36,0x84,0x36,0x84,0x37,0x84,0x37,0x84,0x36,0x84,0x38,0x84,0x38,0x84,0x39,0x84,0x39,0x84,0x39,0x84,0x38,0x84,0x3a,0x84,0x3b,0x84,0x3c,0x84,0x3c,0x84,0x3b,0x84,0x3a,0xc1,0x1,0xb4,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x84,0x3d,0xf,0x84,0x3e,0xe5,0x62,0x84,0x32,0x82,0x2c,0x84,0x33,0x83,0x8,0x84,0x3f,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xd1,0x0,0xca,0x0,0xdc,0x0,0x0,0x11,0xc9,0x0,0x5,0xd1,0x1,0xe0,0x0,0xce,0xc6,0x81,0x59,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xcb,0x2,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x3f,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe1,0x0,0xc7,0x11,0xd3,0xd3,0xdb,0x0,0x0,0x40,0xc2,0xe1,0x1,0xc9,0x0,0x12,0xe1,0x2,0xc9,0x0,0x11,0xe0,0x0,0xcb,0x2,0xc6,0x81,0x20,0xd3,0xd0,0x84,0x31,0xd3,0xd3,0x0,0x1d,0x70,0x72,0x65,0x64,0x75,0x63,0x65,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0x22,0x82,0x54,0x82,0x53,0x22,0xc2,0xc2,0x22,0xdf,0x83,0x7e,0xc1,0x3f,0x4c,0xc1,0x3f,0x86,0xc1,0x3f,0xb0,0xc1,0x3f,0xf2,0xc1,0x40,0x8,0x2f,0x84,0x45,0x84,0x45,0x84,0x46,0x84,0x46,0x84,0x46,0x84,0x47,0x84,0x47,0x84,0x47,0x84,0x48,0x84,0x49,0x84,0x49,0x84,0x48,0xc0,0xc0,0xc0,0xc1,0x1,0xec,0x67,0x7,0x84,0x44,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x84,0x4a,0xf,0x84,0x4b,0xe5,0x54,0xc3,0x83,0x56,0x84,0x42,0x84,0x43,0x84,0x4c,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x1b,0xca,0x0,0xd3,0xd6,0x0,0xe1,0x2,0xc7,0xc,0xca,0x0,0xc4,0x1,0xd3,0xd6,0x1,0xe1,0x2,0xc7,0xa,0xcb,0x1,0xca,0x1,0xd3,0xdd,0x0,0x0,0x47,0xe1,0x2,0xc9,0x0,0x0,0xcb,0x0,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x1b,0xcb,0x1,0xd3,0xd3,0xd6,0x0,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x1,0xd3,0xd6,0x1,0xdb,0x0,0x0,0x17,0xc2,0xcb,0x0,0x0,0xc1,0x40,0xa8,0xc1,0x40,0xde,0xc1,0x40,0xcc,0xc1,0x40,0xaa,0xc1,0x40,0xb4,0x2c,0x84,0x4e,0x84,0x4e,0x84,0x4f,0x84,0x50,0x84,0x51,0x84,0x51,0x84,0x52,0x84,0x52,0x84,0x51,0x84,0x50,0x84,0x4f,0x84,0x4e,0xc1,0x1,0xfc,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x84,0x53,0xf,0x84,0x54,0xe5,0x2f,0xc3,0xc4,0xc4,0xc4,0x84,0x55,0xe1,0x2,0xc7,0x6,0xc4,0x1,0xe0,0x1,0xe0,0x1,0xe1,0x1,0xc7,0x11,0xe0,0x1,0xcd,0x0,0xc6,0x1b,0xc6,0x82,0x47,0xd3,0xd3,0xc6,0x83,0x39,0xc9,0x0,0x2,0xd3,0xc6,0x83,0x38,0xc9,0x0,0x0,0xd3,0xd3,0x0,0xc1,0x41,0x42,0xc1,0x41,0x4a,0x25,0x84,0x57,0x84,0x57,0x84,0x58,0x84,0x58,0x84,0x57,0xc1,0x1,0xfe,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x84,0x59,0xf,0x84,0x5a,0xba,0xc3,0xc4,0xc4,0xc4,0x84,0x5b,0xe1,0x2,0xc7,0x6,0xc4,0x1,0xe0,0x1,0xc9,0x0,0x2,0xc6,0x83,0x38,0xc9,0x0,0x0,0xd3,0xd3,0x0,0x8,0x5f,0x70,0x72,0x65,0x64,0x75,0x63,0x65,0x23,0x0,0x83,0x5f,0x81,0x5b,0xc1,0x3d,0x4a,0xc1,0x3d,0x72,0xc1,0x3d,0x92,0xc1,0x3d,0x88,0xc1,0x3d,0xf2,0xc1,0x3e,0x24,0xc1,0x3e,0x18,0xc1,0x3e,0x4e,0xc1,0x3e,0x7c,0xc1,0x3e,0x86,0xc1,0x3e,0xba,0xc1,0x3e,0xea,0xc1,0x3e,0xf4,0xc1,0x40,0x76,0xe1,0x23,0x84,0x5f,0x84,0x5f,0x84,0x60,0x84,0x60,0x84,0x60,0x84,0x61,0x84,0x62,0x84,0x61,0x84,0x63,0x84,0x63,0x84,0x64,0x84,0x64,0x84,0x65,0x84,0x65,0x84,0x64,0x84,0x66,0x84,0x66,0x84,0x67,0x84,0x67,0x84,0x68,0x84,0x68,0x84,0x67,0x84,0x69,0x84,0x69,0x84,0x69,0x84,0x6a,0x84,0x6b,0x84,0x6b,0x84,0x6a,0x84,0x6c,0x84,0x6c,0xc0,0xc0,0xc0,0xc0,0xc1,0x1,0xde,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x84,0x6d,0xf,0x84,0x6e,0xe5,0x81,0x28,0x84,0x5d,0x81,0x3a,0x84,0x5e,0x83,0x8,0x84,0x6f,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdc,0x0,0x0,0xc,0xca,0x0,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x1,0xc7,0x7,0xc6,0x84,0x41,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xe0,0x0,0xce,0xc6,0x81,0x59,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xcb,0x1,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x71,0xe0,0x1,0xcc,0xc6,0x82,0x46,0xc6,0x82,0x47,0xd3,0xdd,0x0,0x0,0x64,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x1,0xcc,0xc6,0x1b,0xc6,0x82,0x47,0xd3,0xd3,0xdb,0x0,0x0,0x65,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xc2,0xd3,0xdb,0x0,0x0,0x72,0xc2,0xe1,0x2,0xc9,0x0,0x11,0xe0,0x0,0xcb,0x1,0xc6,0x81,0x20,0xd3,0xd0,0x84,0x4d,0xd3,0xd1,0x2,0xe0,0x1,0xcc,0xc6,0x82,0x46,0xc6,0x82,0x47,0xd3,0xe3,0x0,0xd0,0x84,0x56,0xd3,0xc0,0xe3,0x0,0xd0,0x84,0x5c,0xd3,0xd4,0x0,0xc1,0x42,0xf6,0xc1,0x42,0xe2,0xc1,0x42,0xd4,0x26,0x84,0x71,0x84,0x71,0x84,0x72,0x84,0x73,0x84,0x72,0x84,0x71,0xc1,0x2,0xc,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x84,0x74,0xf,0x84,0x75,0xe5,0x27,0xc3,0x14,0xc4,0xc4,0x84,0x76,0xe1,0x2,0xc7,0x8,0xe1,0x2,0xc7,0x9,0xca,0x0,0xc9,0x0,0x0,0xd3,0xc6,0x81,0x0,0xd3,0xdd,0x0,0x0,0x1f,0xca,0x0,0xd9,0x0,0x0,0xdb,0x0,0x0,0x20,0xc2,0x0,0x4,0x5f,0x6d,0x69,0x6e,0x7,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x21,0x84,0x79,0x21,0x84,0x7a,0x4,0x24,0x6d,0x69,0x6e,0x21,0x84,0x7c,0xc1,0x42,0x2,0xc1,0x41,0xf6,0xc1,0x42,0x1a,0xc1,0x42,0x24,0xc1,0x42,0x4e,0xc1,0x42,0x42,0xc1,0x42,0x66,0xc1,0x42,0x70,0xc1,0x42,0x9e,0xc1,0x42,0xb6,0xc1,0x43,0x2a,0x3b,0x84,0x7e,0x84,0x7e,0x84,0x7f,0x84,0x7f,0x84,0x7e,0x85,0x0,0x85,0x0,0x85,0x1,0x85,0x1,0x85,0x0,0x85,0x2,0x85,0x2,0x85,0x3,0x85,0x3,0x85,0x2,0x85,0x4,0x85,0x4,0x85,0x5,0x85,0x5,0x85,0x4,0x85,0x6,0x85,0x6,0x85,0x7,0x85,0x7,0x85,0x8,0x85,0x8,0x85,0x8,0xc1,0x2,0x4,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x85,0x9,0xf,0x85,0xa,0xe5,0x75,0x84,0x78,0x84,0x7b,0x84,0x7d,0x82,0x70,0x85,0xb,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x1,0xcc,0xc6,0x1b,0xc4,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xc4,0x1,0xd3,0xdd,0x0,0x0,0x4b,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x1,0xce,0xc6,0x1b,0xc4,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x4c,0xc2,0xe0,0x1,0xce,0xc6,0x1b,0xc4,0x1,0xd3,0xd6,0x0,0xf0,0x1,0x1,0xce,0xc6,0x82,0x68,0xd0,0x84,0x77,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xcb,0x0,0xd3,0x0,0xc1,0x44,0xc2,0xc1,0x44,0xae,0xc1,0x44,0xa0,0x26,0x85,0xd,0x85,0xd,0x85,0xe,0x85,0xf,0x85,0xe,0x85,0xd,0xc1,0x2,0x1c,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x85,0x10,0xf,0x85,0x11,0xe5,0x26,0xc3,0x14,0xc4,0xc4,0x85,0x12,0xe1,0x2,0xc7,0x8,0xe1,0x2,0xc7,0x9,0xca,0x0,0xc9,0x0,0x0,0xd3,0xc4,0x1,0xd3,0xdd,0x0,0x0,0x1e,0xca,0x0,0xd9,0x0,0x0,0xdb,0x0,0x0,0x1f,0xc2,0x0,0x4,0x5f,0x6d,0x61,0x78,0x4,0x24,0x6d,0x61,0x78,0x21,0x85,0x15,0xc1,0x43,0xce,0xc1,0x43,0xc2,0xc1,0x43,0xe6,0xc1,0x43,0xf0,0xc1,0x44,0x1a,0xc1,0x44,0xe,0xc1,0x44,0x32,0xc1,0x44,0x3c,0xc1,0x44,0x6a,0xc1,0x44,0x82,0xc1,0x44,0xf4,0x3b,0x85,0x17,0x85,0x17,0x85,0x18,0x85,0x18,0x85,0x17,0x85,0x19,0x85,0x19,0x85,0x1a,0x85,0x1a,0x85,0x19,0x85,0x1b,0x85,0x1b,0x85,0x1c,0x85,0x1c,0x85,0x1b,0x85,0x1d,0x85,0x1d,0x85,0x1e,0x85,0x1e,0x85,0x1d,0x85,0x1f,0x85,0x1f,0x85,0x20,0x85,0x20,0x85,0x21,0x85,0x21,0x85,0x21,0xc1,0x2,0x14,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x85,0x22,0xf,0x85,0x23,0xe5,0x75,0x85,0x14,0x84,0x7b,0x85,0x16,0x82,0x70,0x85,0x24,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x1,0xcc,0xc6,0x1b,0xc4,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xc4,0x1,0xd3,0xdd,0x0,0x0,0x4b,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x1,0xce,0xc6,0x1b,0xc4,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x4c,0xc2,0xe0,0x1,0xce,0xc6,0x1b,0xc4,0x1,0xd3,0xd6,0x0,0xf0,0x1,0x1,0xce,0xc6,0x82,0x68,0xd0,0x85,0x13,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xcb,0x0,0xd3,0x0,0x3,0x64,0x69,0x76,0x3,0x73,0x75,0x6d,0x5,0x5f,0x6d,0x65,0x61,0x6e,0xc1,0x45,0xc0,0xc1,0x45,0xb4,0xc1,0x45,0xd8,0xc1,0x45,0xe2,0xc1,0x46,0x4,0xc1,0x45,0xfa,0xc1,0x46,0x10,0x31,0x85,0x29,0x85,0x29,0x85,0x2a,0x85,0x2a,0x85,0x29,0x85,0x2b,0x85,0x2b,0x85,0x2c,0x85,0x2c,0x85,0x2b,0x85,0x2d,0x85,0x2d,0x85,0x2e,0x85,0x2e,0x85,0x2f,0x85,0x2f,0x85,0x2d,0xc1,0x2,0x24,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x85,0x30,0xf,0x85,0x31,0xe5,0x42,0x85,0x28,0x84,0x7b,0xc4,0xc4,0x85,0x32,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x1,0xcc,0xc6,0x1b,0xc4,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xe1,0x2,0xc7,0x16,0xe0,0x0,0xce,0xc6,0x85,0x27,0xd3,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xd3,0x0,0x4,0x73,0x6f,0x72,0x74,0x5,0x66,0x6c,0x6f,0x6f,0x72,0x4,0x63,0x65,0x69,0x6c,0x7,0x5f,0x6d,0x65,0x64,0x69,0x61,0x6e,0x6,0x73,0x6f,0x72,0x74,0x65,0x64,0x4,0x68,0x61,0x6c,0x66,0x22,0x85,0x38,0x85,0x39,0xc1,0x46,0xbe,0xc1,0x46,0xb2,0xc1,0x46,0xd6,0xc1,0x46,0xe0,0xc1,0x47,0xa,0xc1,0x46,0xfe,0xc1,0x47,0x22,0xc1,0x47,0x2c,0xc1,0x47,0x56,0xc1,0x47,0x8c,0xc1,0x47,0x80,0xc1,0x47,0xb8,0xc1,0x47,0xaa,0xc1,0x47,0xd6,0xc1,0x47,0xe4,0xc1,0x48,0x4c,0xc1,0x48,0x22,0xc1,0x48,0x8,0xc1,0x48,0x12,0xc1,0x48,0x32,0xc1,0x48,0x3c,0xe1,0x33,0x85,0x3b,0x85,0x3b,0x85,0x3c,0x85,0x3c,0x85,0x3b,0x85,0x3d,0x85,0x3d,0x85,0x3e,0x85,0x3e,0x85,0x3d,0x85,0x3f,0x85,0x3f,0x85,0x40,0x85,0x40,0x85,0x3f,0x85,0x41,0x85,0x41,0x85,0x42,0x85,0x42,0x85,0x41,0x85,0x43,0x85,0x43,0x85,0x44,0x85,0x44,0x85,0x45,0x85,0x45,0x85,0x44,0x85,0x46,0x85,0x46,0x85,0x47,0x85,0x47,0x85,0x46,0x85,0x48,0x85,0x48,0x85,0x49,0x85,0x49,0x85,0x48,0x85,0x4a,0x85,0x4a,0x85,0x4b,0x85,0x4b,0x85,0x4c,0x85,0x4d,0x85,0x4d,0x85,0x4c,0x85,0x4e,0x85,0x4f,0x85,0x4f,0x85,0x4e,0x85,0x4b,0x85,0x4a,0xc1,0x2,0x2e,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x85,0x50,0xf,0x85,0x51,0xe5,0x81,0x42,0x85,0x37,0x84,0x7b,0x85,0x3a,0x83,0x61,0x85,0x52,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x1,0xcc,0xc6,0x1b,0xc4,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xc4,0x1,0xd3,0xdd,0x0,0x0,0x4b,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x1,0xce,0xc6,0x1b,0xc4,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x4c,0xc2,0xe0,0x0,0xce,0xc6,0x85,0x34,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x16,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xc4,0x2,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xcb,0x1,0xc6,0x85,0x35,0xd3,0xcb,0x1,0xd3,0xdd,0x0,0x0,0x8c,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x1,0xcb,0x0,0xc6,0x1b,0xcb,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x8d,0xc2,0xe1,0x2,0xc7,0x16,0xe1,0x2,0xc7,0xc,0xe0,0x1,0xcb,0x0,0xc6,0x1b,0xe0,0x0,0xcb,0x1,0xc6,0x85,0x35,0xd3,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x1b,0xe0,0x0,0xcb,0x1,0xc6,0x85,0x36,0xd3,0xd3,0xd3,0xc4,0x2,0xd3,0x0,0x3,0x73,0x75,0x62,0x3,0x73,0x65,0x74,0xc1,0x49,0xfa,0xc1,0x4a,0x4,0x28,0x85,0x56,0x85,0x57,0x85,0x57,0x85,0x57,0x85,0x56,0xc0,0xc0,0xc0,0xc1,0x2,0x4c,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x85,0x58,0xf,0x85,0x59,0xe5,0x2a,0xc3,0xc4,0xc4,0xc4,0x85,0x5a,0xe0,0x2,0xc8,0x0,0x0,0xc6,0x85,0x55,0xe1,0x2,0xc7,0x17,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xc9,0x0,0x3,0xd3,0xe1,0x2,0xc7,0xc,0xc9,0x0,0x1,0xc4,0x1,0xd3,0xd9,0x0,0x1,0x0,0xc1,0x4a,0x84,0xc1,0x4a,0x9c,0xc1,0x4a,0xb4,0x29,0x85,0x5c,0x85,0x5d,0x85,0x5d,0x85,0x5c,0x85,0x5e,0x85,0x5e,0xc0,0xc0,0xc0,0xc1,0x2,0x4e,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x85,0x5f,0xf,0x85,0x60,0xe5,0x3a,0xc3,0xc4,0xc4,0xc4,0x85,0x61,0xe0,0x2,0xc8,0x0,0x0,0xc6,0x85,0x55,0xc9,0x0,0x1,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x1b,0xc9,0x0,0x2,0xd3,0xd3,0xe0,0x2,0xc8,0x0,0x0,0xc6,0x85,0x55,0xc9,0x0,0x2,0xc9,0x0,0x3,0xd3,0xe1,0x2,0xc7,0x17,0xc9,0x0,0x2,0xc4,0x1,0xd3,0xd9,0x0,0x2,0x0,0xa,0x69,0x6e,0x6e,0x65,0x72,0x71,0x73,0x6f,0x72,0x74,0x21,0x83,0x5f,0x9,0x73,0x6d,0x61,0x6c,0x6c,0x65,0x72,0x66,0x6e,0x21,0x85,0x65,0x1,0x62,0x21,0x85,0x67,0x24,0x85,0x64,0x85,0x66,0x85,0x68,0x13,0x5,0x70,0x69,0x76,0x6f,0x74,0x4,0x24,0x65,0x6e,0x64,0x5,0x63,0x68,0x65,0x63,0x6b,0x24,0x85,0x6a,0x81,0x77,0x85,0x6b,0x85,0x6c,0x24,0xc1,0xc2,0xc2,0xc1,0xc0,0x74,0xc0,0xda,0x22,0x85,0x6f,0x85,0x70,0xc1,0x48,0xbc,0xc1,0x48,0xb4,0xc1,0x48,0xc6,0xc1,0x48,0xf4,0xc1,0x49,0x1c,0xc1,0x49,0x62,0xc1,0x49,0x9c,0xc1,0x49,0xce,0xc1,0x4a,0xf8,0xc1,0x4b,0x32,0xc1,0x4b,0x66,0xc1,0x4b,0x8c,0xc1,0x4b,0xba,0xe1,0x25,0x85,0x72,0x85,0x72,0x85,0x73,0x85,0x73,0x85,0x73,0x85,0x72,0x85,0x74,0x85,0x74,0x85,0x74,0x85,0x75,0x85,0x75,0x85,0x76,0x85,0x76,0x85,0x76,0x85,0x77,0x85,0x77,0x85,0x77,0x85,0x78,0x85,0x78,0x85,0x79,0x85,0x79,0xc0,0xc0,0xc0,0xc0,0x85,0x7a,0x85,0x7a,0x85,0x7b,0x85,0x7c,0x85,0x7c,0x85,0x7c,0x85,0x7b,0x85,0x7d,0x85,0x7e,0x85,0x7e,0x85,0x7e,0x85,0x7d,0xc1,0x2,0x3e,0x67,0x7,0x85,0x71,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x85,0x7f,0xf,0x86,0x0,0xe5,0x81,0x2f,0x85,0x63,0x85,0x69,0x85,0x6d,0x85,0x6e,0x86,0x1,0xe1,0x2,0xc7,0xf,0xe1,0x2,0xc7,0x17,0xca,0x3,0xca,0x2,0xd3,0xc4,0x1,0xd3,0xdd,0x0,0x0,0x1f,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0xdb,0x0,0x0,0x20,0xc2,0xe0,0x1,0xca,0x0,0xc6,0x1b,0xca,0x2,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0xc,0xca,0x2,0xc4,0x1,0xd3,0xd6,0x1,0xca,0x3,0xd6,0x2,0xe1,0x2,0xc7,0xa,0xcb,0x1,0xcb,0x2,0xd3,0xdd,0x0,0x0,0x6d,0xe0,0x1,0xca,0x0,0xc6,0x1b,0xcb,0x1,0xd3,0xd1,0x3,0xe1,0x2,0xca,0x1,0xcb,0x3,0xcb,0x0,0xd3,0xe3,0x0,0xd0,0x85,0x5b,0xd3,0xc0,0xe3,0x0,0xd0,0x85,0x62,0xd3,0xd4,0xdb,0x0,0x0,0x3a,0xc2,0xe0,0x2,0xca,0x0,0xc6,0x85,0x55,0xcb,0x2,0xcb,0x0,0xd3,0xe1,0x4,0xc9,0x0,0x1b,0xca,0x0,0xca,0x1,0xca,0x2,0xe1,0x2,0xc7,0x17,0xcb,0x2,0xc4,0x1,0xd3,0xd3,0xe1,0x4,0xc9,0x0,0x1b,0xca,0x0,0xca,0x1,0xe1,0x2,0xc7,0xc,0xcb,0x2,0xc4,0x1,0xd3,0xca,0x3,0xd3,0x0,0x7,0x69,0x73,0x41,0x72,0x72,0x61,0x79,0x5,0x71,0x73,0x6f,0x72,0x74,0x22,0x85,0x64,0x85,0x66,0xc1,0x4c,0x1e,0xc1,0x4c,0x10,0xc1,0x4c,0x52,0xc1,0x4c,0x84,0xc1,0x4c,0xae,0xc1,0x4c,0xda,0xc1,0x4c,0xd0,0xc1,0x4d,0xc,0xc1,0x4d,0x3e,0xc1,0x4d,0x60,0xc1,0x4d,0x6a,0x36,0x86,0x6,0x86,0x7,0x86,0x6,0x86,0x8,0x86,0x9,0x86,0x9,0x86,0x8,0x86,0xa,0x86,0xa,0x86,0xa,0x86,0xb,0x86,0xc,0x86,0xb,0x86,0xd,0x86,0xe,0x86,0xe,0x86,0xd,0x86,0xf,0x86,0xf,0x86,0x10,0x86,0x10,0x86,0xf,0xc1,0x2,0x58,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x86,0x11,0xf,0x86,0x12,0xe5,0x66,0x86,0x4,0x86,0x5,0x85,0x64,0x4c,0x86,0x13,0xe1,0x1,0xc7,0x18,0xca,0x0,0xd3,0xdd,0x0,0x0,0x2c,0xe1,0x4,0xc9,0x0,0x1b,0xca,0x0,0xca,0x1,0xc4,0x1,0xe0,0x0,0xca,0x0,0xc6,0x81,0x20,0xd3,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xca,0x0,0xd3,0xdb,0x0,0x0,0x2d,0xc2,0xe0,0x1,0xc7,0x10,0xc6,0x81,0x4c,0xca,0x0,0xd3,0xd1,0x0,0xe1,0x4,0xc9,0x0,0x1b,0xcb,0x0,0xca,0x1,0xc4,0x1,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x20,0xd3,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x59,0xd3,0xd3,0x0,0x5,0x5f,0x73,0x6f,0x72,0x74,0xc1,0x4e,0x92,0xc1,0x4e,0xc2,0xc1,0x4e,0xb6,0xc1,0x4e,0xa8,0x2a,0x86,0x16,0x86,0x17,0x86,0x17,0x86,0x18,0x86,0x18,0x86,0x19,0x86,0x19,0x86,0x18,0x86,0x17,0x86,0x16,0xc1,0x2,0x6c,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x86,0x1a,0xf,0x86,0x1b,0xe5,0x25,0x86,0x15,0x81,0x3a,0xc4,0xc4,0x86,0x1c,0xe1,0x2,0xc9,0x0,0x1c,0xce,0xe1,0x2,0xc7,0xe,0xe1,0x2,0xc7,0xe,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xca,0x0,0xd3,0xc9,0x0,0x7,0xd3,0xd3,0x0,0x6,0x73,0x74,0x72,0x69,0x6e,0x67,0x22,0xc0,0x86,0x1e,0x6,0x61,0x73,0x73,0x65,0x72,0x74,0x18,0x72,0x6e,0x64,0x20,0x3e,0x3d,0x20,0x6e,0x20,0x61,0x6e,0x64,0x20,0x72,0x6e,0x64,0x20,0x3c,0x3d,0x20,0x73,0x69,0x7a,0x65,0x3,0x72,0x6e,0x64,0x3,0x74,0x6d,0x70,0x22,0x86,0x22,0x86,0x23,0xc1,0x4f,0x96,0xc1,0x4f,0xa6,0xc1,0x4f,0x9a,0xc1,0x4f,0xba,0xc1,0x4f,0xb2,0xc1,0x4f,0xe2,0xc1,0x4f,0xd4,0xc1,0x4f,0xf4,0xc1,0x4f,0xea,0xc1,0x50,0x4,0xc1,0x50,0x38,0xc1,0x50,0x5a,0xc1,0x50,0x70,0xc1,0x50,0x8e,0xe1,0x20,0x86,0x25,0x86,0x25,0x86,0x26,0x86,0x27,0x86,0x28,0x86,0x28,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x28,0x86,0x26,0x86,0x25,0x86,0x2a,0x86,0x2b,0x86,0x2c,0x86,0x2c,0x86,0x2d,0x86,0x2d,0x86,0x2d,0x86,0x2e,0x86,0x2e,0x86,0x2e,0x86,0x2c,0x86,0x2a,0x86,0x2f,0x86,0x2f,0x86,0x30,0x86,0x31,0x86,0x31,0x86,0x30,0x86,0x32,0x86,0x32,0xc1,0x2,0x76,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x86,0x33,0xf,0x86,0x34,0xe5,0x79,0xc3,0x83,0x4,0x86,0x24,0x83,0x61,0x86,0x35,0xe1,0x2,0xc7,0xc,0xca,0x0,0xe1,0x1,0xc7,0xd,0xe1,0x2,0xc7,0xc,0xe1,0x2,0xc7,0x17,0xc9,0x0,0x0,0xca,0x0,0xd3,0xc4,0x1,0xd3,0xd3,0xd3,0xd1,0x0,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x1a,0xe1,0x2,0xc7,0xb,0xcb,0x0,0xca,0x0,0xd3,0xe1,0x2,0xc7,0xa,0xcb,0x0,0xc9,0x0,0x0,0xd3,0xd3,0xc6,0x86,0x21,0xd3,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x1b,0xcb,0x0,0xd3,0xd1,0x1,0xe0,0x2,0xc8,0x0,0x0,0xc6,0x85,0x55,0xcb,0x0,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x1b,0xca,0x0,0xd3,0xd3,0xe0,0x2,0xc8,0x0,0x0,0xc6,0x85,0x55,0xca,0x0,0xcb,0x1,0xd3,0x0,0x9,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x69,0x7a,0x65,0x21,0x82,0x2e,0x21,0x86,0x38,0x22,0x81,0x20,0x81,0x3b,0x22,0xc1,0xc2,0xc1,0x4f,0x22,0xc1,0x4f,0x5c,0x24,0x86,0x3c,0x86,0x3c,0x86,0x3d,0x86,0x3d,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x86,0x3e,0xf,0x81,0x7d,0xe5,0x27,0x86,0x37,0x86,0x39,0x86,0x3a,0x86,0x3b,0x86,0x3f,0xe0,0x0,0xca,0x0,0xc6,0x81,0x20,0xd3,0xd1,0x0,0xc4,0x1,0xd6,0x1,0xf0,0x1,0x1,0xcb,0x0,0xc6,0x82,0x7a,0xd0,0x86,0x36,0xd3,0xca,0x0,0x0,0xa,0x5f,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x69,0x7a,0x65,0xc1,0x51,0x86,0xc1,0x51,0x64,0xc1,0x51,0x70,0xc1,0x51,0x66,0x27,0x86,0x42,0x86,0x43,0x86,0x44,0x86,0x45,0x86,0x44,0x86,0x43,0x86,0x42,0xc1,0x2,0x88,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x86,0x46,0xf,0x86,0x47,0xbd,0x86,0x41,0xc4,0xc4,0xc4,0x86,0x48,0xe0,0x0,0xe1,0x1,0xc9,0x0,0x1e,0xe0,0x1,0xc7,0x10,0xc6,0x81,0x4c,0xce,0xd3,0xd3,0xc6,0x81,0x59,0xd3,0x0,0x8,0x69,0x73,0x4e,0x75,0x6d,0x62,0x65,0x72,0xb,0x5f,0x6a,0x73,0x6f,0x6e,0x5f,0x70,0x61,0x72,0x73,0x65,0x6,0x4e,0x75,0x6d,0x62,0x65,0x72,0x1,0x73,0x21,0x86,0x4d,0x21,0x86,0x4e,0xc1,0x52,0xde,0xc1,0x52,0xce,0xc1,0x52,0xf4,0xc1,0x53,0x4c,0xc1,0x53,0x64,0xc1,0x53,0x4e,0xc1,0x53,0x68,0xc1,0x53,0x9e,0xc1,0x53,0x8e,0xc1,0x53,0xb4,0xc1,0x53,0xce,0x36,0x86,0x50,0x86,0x51,0x86,0x50,0x86,0x52,0x86,0x52,0x86,0x52,0x86,0x53,0x86,0x54,0x86,0x55,0x86,0x56,0x86,0x56,0x86,0x54,0x86,0x53,0x86,0x57,0x86,0x58,0x86,0x57,0x86,0x59,0x86,0x59,0x86,0x59,0x86,0x5a,0x86,0x5a,0x86,0x5a,0xc1,0x2,0x92,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x86,0x5b,0xf,0x86,0x5c,0xe5,0x57,0x86,0x4c,0x86,0x4f,0x71,0x4c,0x86,0x5d,0xe1,0x1,0xc7,0x1b,0xca,0x0,0xd3,0xdd,0x0,0x0,0x18,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xca,0x0,0xd3,0xdb,0x0,0x0,0x19,0xc2,0xe1,0x1,0xc9,0x0,0x4,0xe1,0x1,0xc7,0x1c,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd3,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x1b,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x45,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x46,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xc2,0xd3,0x0,0x6,0x69,0x73,0x4c,0x69,0x73,0x74,0xc1,0x54,0xa8,0xc1,0x54,0x9c,0xc1,0x54,0xc4,0xc1,0x54,0xd8,0xc1,0x55,0xa,0xc1,0x54,0xfc,0xc1,0x55,0x26,0xc1,0x55,0x3a,0xc1,0x55,0x5e,0x32,0x86,0x60,0x86,0x61,0x86,0x60,0x86,0x62,0x86,0x62,0x86,0x63,0x86,0x63,0x86,0x63,0x86,0x64,0x86,0x65,0x86,0x64,0x86,0x66,0x86,0x66,0x86,0x67,0x86,0x67,0x86,0x67,0x86,0x68,0x86,0x68,0xc1,0x2,0xa4,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x86,0x69,0xf,0x86,0x6a,0xe5,0x56,0xc3,0x14,0xc4,0xc4,0x86,0x6b,0xe1,0x1,0xc7,0x1d,0xca,0x0,0xd3,0xdd,0x0,0x0,0x21,0xe1,0x2,0xc9,0x1,0x21,0xca,0x0,0xc8,0x0,0x1,0xd3,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0xdb,0x0,0x0,0x22,0xc2,0xe1,0x1,0xc7,0x18,0xca,0x0,0xd3,0xdd,0x0,0x0,0x43,0xe1,0x2,0xc9,0x1,0x21,0xca,0x0,0xc8,0x0,0x1,0xd3,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0xdb,0x0,0x0,0x44,0xc2,0xe0,0x1,0xc8,0x0,0x1,0xc6,0x81,0x1e,0xca,0x0,0xd3,0x0,0x9,0x5f,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x32,0x2,0x6c,0x73,0x21,0x86,0x6e,0x22,0x86,0x6f,0x86,0x38,0xc1,0x54,0x70,0x22,0x86,0x71,0x86,0x71,0xc1,0x2,0xa2,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x86,0x72,0xf,0x86,0x73,0xb5,0x86,0x6d,0x86,0x70,0xc4,0xc4,0x86,0x74,0xf0,0x1,0x1,0xca,0x0,0xc6,0x82,0x68,0xd0,0x86,0x6c,0xd3,0x0,0x8,0x5f,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0xc1,0x57,0x7a,0xc1,0x57,0x70,0xc1,0x57,0x9e,0xc1,0x57,0xca,0xc1,0x57,0xd2,0x2a,0x86,0x77,0x86,0x78,0x86,0x77,0x86,0x79,0x86,0x79,0x86,0x7a,0x86,0x7a,0x86,0x7b,0x86,0x7b,0x86,0x7a,0xc1,0x2,0xb6,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x86,0x7c,0xf,0x86,0x7d,0xe5,0x2b,0x86,0x76,0xc4,0x86,0x38,0x4c,0x86,0x7e,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x0,0xe1,0x2,0xc9,0x0,0x21,0xce,0xcb,0x0,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x59,0xd3,0xd3,0x0,0x0,0x5,0x5f,0x6a,0x6f,0x69,0x6e,0x3,0x73,0x65,0x70,0x21,0x87,0x2,0x21,0x87,0x3,0x23,0x87,0x2,0x82,0x54,0x82,0x53,0xc1,0x1,0x2,0x22,0x81,0x34,0x87,0x6,0xc1,0x58,0xfc,0xc1,0x58,0xf0,0xc1,0x59,0x14,0xc1,0x59,0x74,0xc1,0x59,0x7e,0xc1,0x59,0xc0,0xc1,0x59,0xce,0xc1,0x5a,0x14,0xc1,0x5a,0x2,0xc1,0x5a,0x2e,0xc1,0x5a,0x38,0xc1,0x5a,0x7a,0x3f,0x87,0x8,0x87,0x8,0x87,0x9,0x87,0x9,0x87,0x8,0x87,0xa,0x87,0xa,0x87,0xa,0x87,0xb,0x87,0xc,0x87,0xc,0x87,0xb,0x87,0xd,0x87,0xd,0x87,0xe,0x87,0xe,0x87,0xd,0x87,0xf,0x87,0x10,0x87,0x10,0x87,0x11,0x87,0x12,0x87,0x12,0x87,0x11,0x87,0xf,0xc0,0xc0,0xc0,0x87,0x13,0x87,0x13,0x87,0x13,0xc1,0x2,0xc4,0x67,0x7,0x87,0x7,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x87,0x14,0xf,0x87,0x15,0xe5,0x81,0x16,0x87,0x1,0x87,0x4,0x87,0x5,0x82,0x56,0x87,0x16,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x20,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xc6,0x87,0x0,0xd3,0xdb,0x0,0x0,0x21,0xc2,0xca,0x0,0xdc,0x0,0x0,0x2a,0xc6,0x87,0x0,0xd1,0x0,0xe1,0x1,0xc9,0x0,0x29,0xe0,0x1,0xce,0xc6,0x1b,0xc4,0x1,0xd3,0xd3,0xd6,0x1,0xc4,0x2,0xd6,0x2,0xe1,0x2,0xc7,0xa,0xcb,0x2,0xe0,0x0,0xce,0xc6,0x81,0x20,0xd3,0xd3,0xdd,0x0,0x0,0x81,0xe0,0x1,0xe0,0x1,0xcb,0x1,0xc6,0x83,0x39,0xcb,0x0,0xd3,0xc6,0x83,0x39,0xe1,0x1,0xc9,0x0,0x29,0xe0,0x1,0xce,0xc6,0x1b,0xcb,0x2,0xd3,0xd3,0xd3,0xd6,0x1,0xe1,0x2,0xc7,0xc,0xcb,0x2,0xc4,0x1,0xd3,0xd6,0x2,0xdb,0x0,0x0,0x40,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xcb,0x1,0xd3,0x0,0xc1,0x5a,0xca,0x22,0x87,0x18,0x87,0x18,0xc1,0x2,0xda,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x87,0x19,0xf,0x87,0x1a,0xb0,0xc3,0x14,0xc4,0xc4,0x87,0x1b,0xe0,0x1,0xce,0xc6,0x81,0x1e,0xca,0x0,0xd3,0x0,0x7,0x5f,0x61,0x64,0x64,0x41,0x6c,0x6c,0x21,0x86,0x6f,0xc1,0x5a,0xac,0x22,0x87,0x1f,0x87,0x1f,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x87,0x20,0xf,0x87,0x1a,0xb5,0x87,0x1d,0x87,0x1e,0xc4,0xc4,0x87,0x21,0xf0,0x1,0x1,0xca,0x0,0xc6,0x82,0x68,0xd0,0x87,0x1c,0xd3,0x0,0x1,0x20,0x9,0x6b,0x65,0x65,0x70,0x65,0x6d,0x70,0x74,0x79,0x4,0x74,0x72,0x69,0x6d,0x5,0x6c,0x69,0x6d,0x69,0x74,0x7,0x69,0x73,0x52,0x65,0x67,0x65,0x78,0x4,0x66,0x69,0x6e,0x64,0x22,0x85,0x67,0x12,0xc1,0x60,0xa6,0xc1,0x61,0x4,0xc1,0x61,0x12,0xc1,0x61,0x5e,0xc1,0x61,0x72,0xc1,0x61,0x6a,0x31,0x87,0x2a,0x87,0x2a,0x87,0x2b,0x87,0x2b,0x87,0x2b,0x87,0x2c,0x87,0x2c,0x87,0x2c,0x87,0x2d,0x87,0x2d,0x87,0x2e,0x87,0x2e,0x87,0x2f,0x87,0x2f,0x87,0x2f,0x87,0x2e,0x87,0x2d,0xc1,0x3,0x2,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x87,0x30,0xf,0x87,0x31,0xe5,0x4d,0xc3,0xc4,0x87,0x29,0x83,0x61,0x87,0x32,0xe0,0x2,0xc9,0x1,0x0,0xc6,0x87,0x28,0xcf,0x0,0xc8,0x0,0x0,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x2a,0xe1,0x1,0xc7,0x6,0xc4,0x1,0xd3,0xdb,0x0,0x0,0x2b,0xc2,0xe1,0x3,0xc7,0x6,0xc4,0x1,0xcb,0x0,0xe1,0x2,0xc7,0xc,0xe1,0x2,0xc7,0x17,0xcb,0x1,0xcb,0x0,0xd3,0xc4,0x1,0xd3,0xd3,0x0,0xc1,0x61,0xb8,0xc1,0x61,0xc2,0xc1,0x61,0xea,0x27,0x87,0x34,0x87,0x34,0x87,0x35,0x87,0x35,0x87,0x36,0x87,0x36,0x87,0x34,0xc1,0x3,0x8,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x87,0x37,0xf,0x87,0x38,0xe5,0x25,0xc3,0xc4,0xc4,0xc4,0x87,0x39,0xe1,0x3,0xc7,0x6,0xc4,0x1,0xe0,0x2,0xcf,0x0,0xc6,0x87,0x28,0xc9,0x1,0x0,0xc8,0x0,0x0,0xd3,0xe0,0x0,0xc9,0x1,0x0,0xc6,0x81,0x20,0xd3,0xd3,0x0,0x5,0x73,0x74,0x61,0x72,0x74,0x21,0x87,0x3b,0x21,0x87,0x3c,0xc1,0x60,0x84,0xc1,0x60,0x76,0x27,0x87,0x3e,0x87,0x3f,0x87,0x3e,0xc0,0xc0,0xc0,0xc0,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x87,0x40,0xf,0x26,0xbf,0x87,0x28,0x87,0x3d,0xc4,0xc4,0x87,0x41,0xe1,0x1,0xc7,0x1e,0xc9,0x0,0x0,0xd3,0xe3,0x0,0xd0,0x87,0x33,0xd3,0xc0,0xe3,0x0,0xd0,0x87,0x3a,0xd3,0xd4,0x0,0x8,0x69,0x73,0x53,0x74,0x72,0x69,0x6e,0x67,0xc1,0x62,0x82,0x22,0x87,0x44,0x87,0x44,0xc1,0x3,0xe,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x87,0x45,0xf,0x87,0x46,0xb3,0xc3,0xc4,0xc4,0xc4,0x87,0x47,0xe0,0x1,0xc8,0x0,0x0,0xc6,0x87,0x25,0xc9,0x1,0x2,0xd3,0x0,0xc1,0x62,0xfe,0x22,0x87,0x49,0x87,0x49,0xc1,0x3,0x10,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x87,0x4a,0xf,0x87,0x4b,0xb0,0xc3,0xc4,0xc4,0xc4,0x87,0x4c,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x87,0x25,0xd3,0x0,0xc1,0x3,0x12,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0xc4,0xf,0x87,0x4e,0xaa,0xc3,0xc4,0xc4,0xc4,0x87,0x4f,0xc8,0x0,0x0,0x0,0x7,0x70,0x72,0x6f,0x63,0x65,0x73,0x73,0xc1,0x62,0x58,0xc1,0x62,0x4a,0xc1,0x62,0x3a,0xc1,0x62,0x6c,0xc1,0x62,0x5e,0xc1,0x63,0x86,0xc1,0x63,0xb0,0xc1,0x63,0xa4,0xc1,0x63,0xbc,0xc1,0x63,0xe0,0x3c,0x87,0x52,0x87,0x52,0x87,0x53,0x87,0x54,0x87,0x53,0x87,0x55,0x87,0x56,0x87,0x55,0x87,0x52,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x87,0x57,0x87,0x57,0x87,0x57,0x87,0x58,0x87,0x58,0x87,0x59,0x87,0x59,0x87,0x58,0x87,0x5a,0x87,0x5a,0x87,0x5a,0x87,0x5b,0x87,0x5b,0xc1,0x3,0xc,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x87,0x5c,0xf,0x87,0x5d,0xe5,0x6e,0x87,0x51,0x86,0x4f,0x86,0x4e,0x4c,0x87,0x5e,0xe1,0x2,0xc7,0xe,0xe1,0x1,0xc7,0x1f,0xc9,0x0,0x2,0xd3,0xe1,0x1,0xc7,0x1e,0xc9,0x0,0x2,0xd3,0xd3,0xe3,0x0,0xd0,0x87,0x48,0xd3,0xc9,0x0,0x2,0xe3,0x0,0xd0,0x87,0x4d,0xd3,0xc0,0xe3,0x0,0xd0,0x87,0x50,0xd3,0xd4,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xc9,0x0,0x1,0xd3,0xdd,0x0,0x0,0x49,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x58,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0xdb,0x0,0x0,0x59,0xc2,0xe0,0x1,0xc9,0x0,0x4,0xc6,0x81,0x1e,0xcb,0x0,0xd3,0x0,0x5,0x73,0x6c,0x69,0x63,0x65,0x4,0x67,0x6f,0x74,0x6f,0x4,0x6c,0x6f,0x6f,0x70,0x3,0x65,0x6e,0x64,0x22,0x87,0x63,0x82,0x2d,0xc1,0x64,0xcc,0xc1,0x64,0xf2,0xc1,0x65,0x2a,0xc1,0x65,0x34,0xc1,0x65,0x60,0xc1,0x65,0x8c,0xc1,0x65,0xc6,0xc1,0x65,0xd0,0xc1,0x65,0xe6,0xc1,0x66,0x36,0xc1,0x66,0x2a,0xc1,0x66,0x48,0xc1,0x66,0x80,0xc1,0x66,0x8a,0xc1,0x66,0x94,0xc1,0x66,0xc6,0xc1,0x66,0xf4,0xc1,0x66,0xfe,0xc1,0x67,0x8,0xe1,0x30,0x87,0x65,0x87,0x65,0x87,0x66,0x87,0x66,0x87,0x66,0x87,0x67,0x87,0x68,0x87,0x68,0x87,0x67,0x87,0x69,0x87,0x69,0x87,0x69,0x87,0x6a,0x87,0x6a,0x87,0x6a,0x87,0x6b,0x87,0x6c,0x87,0x6d,0x87,0x6d,0x87,0x6d,0x87,0x6c,0x87,0x6b,0x87,0x6e,0x87,0x6e,0x87,0x6f,0x87,0x6f,0x87,0x70,0x87,0x70,0x87,0x70,0x87,0x6e,0x87,0x71,0x87,0x72,0x87,0x73,0x87,0x73,0x87,0x73,0x87,0x72,0x87,0x71,0x87,0x74,0x87,0x74,0x87,0x74,0x87,0x75,0x87,0x75,0x87,0x76,0x87,0x77,0x87,0x77,0x87,0x77,0x87,0x76,0x87,0x75,0xc1,0x3,0x22,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x87,0x78,0xf,0x87,0x79,0xe5,0x81,0x46,0x87,0x62,0x87,0x3d,0x87,0x64,0x83,0x61,0x87,0x7a,0xe1,0x1,0xc9,0x0,0x5,0xca,0x0,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x34,0xe1,0x1,0xc9,0x0,0x6,0xe0,0x2,0xce,0xc6,0x87,0x60,0xca,0x0,0xc2,0xd3,0xd3,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0xdb,0x0,0x0,0x35,0xc2,0xe1,0x2,0xc7,0xb,0xcb,0x0,0xca,0x0,0xd3,0xdd,0x0,0x0,0xba,0xe1,0x1,0xc9,0x0,0x6,0xe0,0x2,0xce,0xc6,0x87,0x60,0xca,0x0,0xe1,0x2,0xc7,0x17,0xcb,0x0,0xc4,0x1,0xd3,0xd3,0xd3,0xc9,0x0,0x3,0xdd,0x0,0x0,0x79,0xe1,0x2,0xc7,0xb,0xe0,0x0,0xc9,0x0,0x4,0xc6,0x81,0x20,0xd3,0xe1,0x2,0xc7,0x17,0xc9,0x0,0x3,0xc4,0x1,0xd3,0xd3,0xdd,0x0,0x0,0x9f,0xe1,0x1,0xc9,0x0,0x6,0xe0,0x2,0xce,0xc6,0x87,0x60,0xe1,0x2,0xc7,0xc,0xcb,0x0,0xcb,0x1,0xd3,0xc2,0xd3,0xd3,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0xdb,0x0,0x0,0xa0,0xc2,0xe1,0x2,0xc7,0x20,0xc4,0x0,0xe1,0x1,0xc9,0x0,0x7,0xe1,0x2,0xc7,0xc,0xcb,0x0,0xcb,0x1,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0xbb,0xc2,0x0,0x6,0x5f,0x73,0x70,0x6c,0x69,0x74,0x2,0x6f,0x6e,0x21,0x87,0x7d,0x21,0x87,0x7e,0x5,0x65,0x6d,0x70,0x74,0x79,0x28,0x87,0x7d,0x88,0x0,0x87,0x25,0x87,0x26,0x81,0x5b,0x87,0x28,0x87,0x51,0x87,0x62,0x28,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0x5f,0x46,0xc1,0x5f,0x3e,0xc1,0x5f,0x50,0xc1,0x5f,0x80,0xc1,0x5f,0xc8,0xc1,0x5f,0xfa,0xc1,0x60,0x2e,0xc1,0x60,0x24,0xc1,0x64,0x6,0xc1,0x64,0x32,0xc1,0x64,0x5c,0xc1,0x64,0x64,0xc1,0x67,0x26,0xc1,0x67,0x42,0xc1,0x67,0x4a,0x3f,0x88,0x3,0x88,0x4,0x88,0x5,0x88,0x5,0x88,0x6,0x88,0x6,0x88,0x3,0x88,0x7,0x88,0x7,0x88,0x8,0x88,0x8,0x88,0x9,0x88,0xa,0x88,0x9,0x88,0xb,0x88,0xb,0x88,0xb,0x88,0xc,0x88,0xc,0x88,0xd,0x88,0xd,0x88,0xe,0x88,0xe,0x88,0xd,0x88,0xf,0x88,0xf,0x88,0x10,0x88,0x10,0x88,0x11,0x88,0x11,0x88,0x10,0xc1,0x2,0xee,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x88,0x12,0xf,0x88,0x13,0xe5,0x81,0x1e,0x87,0x7c,0x87,0x7f,0x88,0x1,0x88,0x2,0x88,0x14,0xca,0x0,0xdc,0x0,0x0,0x9,0xc6,0x87,0x23,0xd1,0x0,0xe1,0x3,0xc7,0x3,0xe0,0x1,0xcc,0xc6,0x82,0x46,0xc6,0x87,0x24,0xd3,0xe0,0x1,0xcc,0xc6,0x1b,0xc6,0x87,0x24,0xd3,0xc0,0xd3,0xd1,0x1,0xe0,0x1,0xcc,0xc6,0x1b,0xc6,0x87,0x25,0xd3,0xd1,0x2,0xe0,0x1,0xcc,0xc6,0x1b,0xc6,0x87,0x26,0xd3,0xd1,0x3,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x4,0xd0,0x87,0x42,0xd1,0x5,0xd0,0x87,0x5f,0xd1,0x6,0xe1,0x2,0xc7,0x8,0xcb,0x0,0xc6,0x87,0x0,0xd3,0xdd,0x0,0x0,0x77,0xe1,0x1,0xcb,0x6,0xce,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xcb,0x4,0xc6,0x81,0x59,0xd3,0xd3,0xdb,0x0,0x0,0x78,0xc2,0xd0,0x87,0x7b,0xd1,0x7,0xe1,0x1,0xcb,0x7,0xc4,0x1,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xcb,0x4,0xc6,0x81,0x59,0xd3,0xd3,0x0,0x1b,0x74,0x69,0x6d,0x65,0x73,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0x6,0x5f,0x74,0x69,0x6d,0x65,0x73,0x22,0x0,0x81,0x77,0xc0,0x84,0xc0,0xe0,0x22,0x88,0x19,0x88,0x1a,0xc1,0x68,0x7a,0xc1,0x68,0x86,0xc1,0x68,0xb4,0xc1,0x68,0xdc,0xc1,0x68,0xfc,0xc1,0x68,0xf2,0xc1,0x69,0x8e,0xc1,0x69,0xa0,0xc1,0x69,0xea,0x39,0x88,0x1c,0x88,0x1c,0x88,0x1c,0x88,0x1d,0x88,0x1d,0x88,0x1d,0x88,0x1e,0x88,0x1e,0x88,0x1f,0x88,0x1f,0x88,0x1f,0x88,0x20,0x88,0x21,0x88,0x20,0x88,0x22,0x88,0x22,0x88,0x22,0x88,0x23,0x88,0x23,0x88,0x23,0xc0,0xc0,0xc0,0x88,0x24,0x88,0x24,0x67,0x7,0x88,0x1b,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x88,0x25,0xf,0x29,0xe5,0x7c,0x88,0x17,0x81,0x3a,0x88,0x18,0x86,0x3b,0x88,0x26,0xe1,0x2,0xc7,0xa,0xce,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x17,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0xdb,0x0,0x0,0x18,0xc2,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdc,0x0,0x0,0x24,0xca,0x0,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x3d,0xe1,0x1,0xc7,0x7,0xc6,0x88,0x16,0xd3,0xdb,0x0,0x0,0x3e,0xc2,0xc4,0x0,0xd6,0x1,0xe1,0x2,0xc7,0xb,0xcb,0x1,0xce,0xd3,0xdd,0x0,0x0,0x59,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0xdb,0x0,0x0,0x5a,0xc2,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x1,0xd3,0xd6,0x1,0xe1,0x1,0xcb,0x0,0xcb,0x1,0xd3,0xdb,0x0,0x0,0x42,0xc2,0x0,0x13,0x74,0x6f,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x18,0x74,0x6f,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0x5,0x6d,0x75,0x6c,0x74,0x69,0xc1,0x6c,0x60,0xc1,0x6c,0x56,0xc1,0x6c,0x6c,0x26,0x88,0x2b,0x88,0x2c,0x88,0x2d,0x88,0x2d,0x88,0x2d,0x88,0x2b,0xc1,0x3,0x66,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x88,0x2e,0xf,0x88,0x2f,0xb8,0xc3,0xc4,0xc4,0xc4,0x88,0x30,0xe1,0x2,0xc7,0x21,0xe1,0x2,0xc7,0x17,0xcf,0x0,0xc4,0x1,0xd3,0xc8,0x0,0x0,0xd3,0x0,0xc1,0x6c,0xc6,0xc1,0x6c,0xbc,0xc1,0x6c,0xce,0x26,0x88,0x32,0x88,0x33,0x88,0x34,0x88,0x34,0x88,0x34,0x88,0x32,0xc1,0x3,0x68,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x88,0x35,0xf,0x88,0x36,0xb8,0xc3,0xc4,0xc4,0xc4,0x88,0x37,0xe1,0x2,0xc7,0x21,0xe1,0x2,0xc7,0x17,0xc8,0x0,0x0,0xc4,0x1,0xd3,0xcf,0x0,0xd3,0x0,0x3,0x5f,0x74,0x6f,0x2,0x74,0x6f,0x21,0x88,0x3a,0x22,0x88,0x3b,0x81,0x39,0x24,0x0,0x81,0x71,0x88,0x3a,0x81,0x77,0xc0,0xc6,0xc1,0x1,0x24,0x22,0x88,0x3e,0x88,0x3f,0xc1,0x6b,0x1a,0xc1,0x6b,0x32,0xc1,0x6b,0x22,0xc1,0x6b,0x48,0xc1,0x6b,0x3e,0xc1,0x6b,0x96,0xc1,0x6b,0xbe,0xc1,0x6b,0xde,0xc1,0x6b,0xd4,0xc1,0x6c,0x44,0xc1,0x6d,0x3e,0xc1,0x6d,0x4c,0xc1,0x6d,0x96,0xe1,0x23,0x88,0x41,0x88,0x41,0x88,0x42,0x88,0x43,0x88,0x42,0x88,0x41,0x88,0x44,0x88,0x45,0x88,0x44,0x88,0x46,0x88,0x46,0x88,0x47,0x88,0x47,0x88,0x47,0x88,0x48,0x88,0x49,0x88,0x48,0x88,0x4a,0x88,0x4a,0x88,0x4a,0xc0,0xc0,0xc0,0xc0,0x88,0x4b,0x88,0x4b,0x88,0x4b,0x88,0x4c,0x88,0x4c,0x88,0x4c,0xc0,0xc0,0xc0,0x88,0x4d,0x88,0x4d,0xc1,0x3,0x5c,0x67,0x7,0x88,0x40,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x88,0x4e,0xf,0x88,0x4f,0xe5,0x81,0x1e,0x88,0x39,0x88,0x3c,0x88,0x3d,0x83,0x26,0x88,0x50,0xe1,0x1,0xc7,0x5,0xe1,0x1,0xc7,0x1b,0xca,0x0,0xd3,0xd3,0xdd,0x0,0x0,0x1c,0xe1,0x1,0xc7,0x7,0xc6,0x88,0x28,0xd3,0xdb,0x0,0x0,0x1d,0xc2,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdc,0x0,0x0,0x29,0xca,0x1,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x42,0xe1,0x1,0xc7,0x7,0xc6,0x88,0x29,0xd3,0xdb,0x0,0x0,0x43,0xc2,0xe1,0x2,0xc7,0xa,0xce,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x88,0x31,0xd3,0xc0,0xe3,0x0,0xd0,0x88,0x38,0xd3,0xd4,0xd2,0x0,0x1,0xd2,0x1,0x2,0xcb,0x1,0xd6,0x3,0xe1,0x2,0xc7,0xb,0xcb,0x3,0xcb,0x2,0xd3,0xdd,0x0,0x0,0x7b,0xe1,0x1,0xc7,0x6,0xc4,0x0,0xd3,0xdb,0x0,0x0,0x7c,0xc2,0xe1,0x2,0xc7,0xc,0xcb,0x3,0xc4,0x1,0xd3,0xd6,0x3,0xe1,0x1,0xcb,0x0,0xcb,0x3,0xd3,0xdb,0x0,0x0,0x63,0xc2,0x0,0x8,0x5f,0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x3,0x49,0x6e,0x74,0x8,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x5,0x69,0x73,0x42,0x69,0x6e,0x8,0x69,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0xa,0x72,0x65,0x61,0x64,0x53,0x74,0x72,0x69,0x6e,0x67,0x6,0x69,0x73,0x43,0x68,0x61,0x72,0x4,0x43,0x68,0x61,0x72,0x7,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x4,0x6a,0x6f,0x69,0x6e,0x4,0x5f,0x73,0x74,0x72,0x1,0x6f,0x21,0x88,0x5d,0x21,0x88,0x5e,0xc1,0x6e,0x70,0xc1,0x6e,0x60,0xc1,0x6e,0x86,0xc1,0x6e,0xa4,0xc1,0x6e,0x9a,0xc1,0x6e,0xba,0xc1,0x6e,0xbe,0xc1,0x6e,0xf0,0xc1,0x6e,0xe0,0xc1,0x6f,0x6,0xc1,0x6f,0xa,0xc1,0x6f,0x3c,0xc1,0x6f,0x30,0xc1,0x6f,0x52,0xc1,0x6f,0x56,0xc1,0x6f,0x88,0xc1,0x6f,0x78,0xc1,0x6f,0x9e,0xc1,0x6f,0xae,0xc1,0x6f,0xa8,0xc1,0x6f,0xa0,0xc1,0x6f,0xdc,0xc1,0x6f,0xd0,0xc1,0x6f,0xf8,0xc1,0x6f,0xea,0xc1,0x70,0xe,0xc1,0x70,0x42,0xc1,0x70,0x2e,0xc1,0x70,0x12,0xc1,0x70,0x62,0xe1,0x3e,0x88,0x60,0x88,0x61,0x88,0x60,0x88,0x62,0x88,0x62,0x88,0x62,0x88,0x63,0x88,0x64,0x88,0x63,0x88,0x65,0x88,0x65,0x88,0x66,0x88,0x66,0x88,0x65,0x88,0x67,0x88,0x68,0x88,0x67,0x88,0x69,0x88,0x69,0x88,0x6a,0x88,0x6a,0x88,0x69,0x88,0x6b,0x88,0x6c,0x88,0x6b,0x88,0x6d,0x88,0x6d,0x88,0x6e,0x88,0x6e,0x88,0x6d,0x88,0x6f,0x88,0x70,0x88,0x6f,0x88,0x71,0x88,0x71,0x88,0x72,0x88,0x73,0x88,0x74,0x88,0x73,0x88,0x72,0x88,0x71,0x88,0x75,0x88,0x76,0x88,0x75,0x88,0x77,0x88,0x78,0x88,0x77,0x88,0x79,0x88,0x79,0x88,0x7a,0x88,0x7b,0x88,0x7c,0x88,0x7c,0x88,0x7b,0x88,0x7a,0x88,0x79,0x88,0x7d,0x88,0x7d,0xc0,0xc0,0xc0,0x88,0x7d,0xc1,0x3,0x7e,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x88,0x7e,0xf,0x88,0x7f,0xe5,0x81,0x68,0x88,0x5c,0x88,0x5f,0xc4,0xc4,0x89,0x0,0xe1,0x1,0xc7,0x1f,0xca,0x0,0xd3,0xdd,0x0,0x0,0x18,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xca,0x0,0xd3,0xdb,0x0,0x0,0x19,0xc2,0xe1,0x1,0xc7,0x24,0xca,0x0,0xd3,0xdd,0x0,0x0,0x36,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd3,0xdb,0x0,0x0,0x37,0xc2,0xe1,0x1,0xc7,0x25,0xca,0x0,0xd3,0xdd,0x0,0x0,0x55,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xca,0x0,0xc6,0x88,0x57,0xd3,0xd3,0xdb,0x0,0x0,0x56,0xc2,0xe1,0x1,0xc7,0x26,0xca,0x0,0xd3,0xdd,0x0,0x0,0x73,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd3,0xdb,0x0,0x0,0x74,0xc2,0xe1,0x1,0xc7,0x1b,0xca,0x0,0xd3,0xdd,0x0,0x0,0x96,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xe1,0x1,0xc7,0x27,0xca,0x0,0xd3,0xc6,0x6,0xd3,0xd3,0xdb,0x0,0x0,0x97,0xc2,0xe1,0x1,0xc7,0x1d,0xca,0x0,0xd3,0xdc,0x0,0x0,0xa9,0xe1,0x1,0xc7,0x18,0xca,0x0,0xd3,0xdd,0x0,0x0,0xd0,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xe0,0x1,0xe0,0x1,0xca,0x0,0xc6,0x88,0x5a,0xc0,0xd3,0xc6,0x83,0x14,0xc9,0x0,0x28,0xd3,0xc6,0x88,0x5b,0xd3,0xd3,0xdb,0x0,0x0,0xd1,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe1,0x1,0xc7,0x2,0xca,0x0,0xd3,0xd3,0x0,0x4,0x72,0x65,0x70,0x72,0xc1,0x70,0xa2,0xc1,0x70,0xd6,0xc1,0x70,0xec,0xc1,0x70,0xe4,0x28,0x89,0x3,0x89,0x3,0x89,0x4,0x89,0x4,0x89,0x4,0x89,0x5,0x89,0x6,0x89,0x5,0xc1,0x3,0x90,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x89,0x7,0xf,0x89,0x8,0xe5,0x2d,0x6,0x88,0x5f,0x86,0x4e,0x4c,0x89,0x9,0xe8,0x0,0xca,0x0,0xc6,0x6,0xd3,0xd1,0x0,0xcb,0x0,0xdd,0x0,0x0,0x1c,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x1d,0xc2,0xe1,0x1,0xc7,0x28,0xca,0x0,0xd3,0x0,0x14,0x5f,0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x5f,0x63,0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,0x6,0x53,0x74,0x72,0x69,0x6e,0x67,0x1,0x61,0x21,0x89,0xd,0x21,0x89,0xe,0xc1,0x74,0x10,0xc1,0x74,0x22,0x24,0x89,0x10,0x89,0x11,0x89,0x11,0x89,0x10,0xc1,0x3,0xaa,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x89,0x12,0xf,0x89,0x13,0xb9,0xc3,0x89,0xf,0xc4,0xc4,0x89,0x14,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x81,0x1e,0xe1,0x1,0xc9,0x2,0x28,0xca,0x0,0xd3,0xd3,0x0,0xc1,0x73,0x42,0xc1,0x73,0x36,0xc1,0x73,0x5a,0xc1,0x73,0x84,0xc1,0x73,0x78,0xc1,0x73,0x9c,0xc1,0x73,0xa6,0xc1,0x73,0xb0,0xc1,0x73,0xd8,0xc1,0x73,0xce,0xc1,0x73,0xf2,0xc1,0x74,0x3a,0x3b,0x89,0x16,0x89,0x16,0x89,0x17,0x89,0x17,0x89,0x16,0x89,0x18,0x89,0x18,0x89,0x18,0x89,0x19,0x89,0x19,0x89,0x1a,0x89,0x1a,0x89,0x19,0x89,0x1b,0x89,0x1b,0x89,0x1c,0x89,0x1d,0x89,0x1d,0x89,0x1c,0x89,0x1b,0x89,0x1e,0x89,0x1f,0x89,0x1e,0x89,0x20,0x89,0x20,0x89,0x21,0x89,0x21,0xc1,0x3,0xa2,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x89,0x22,0xf,0x89,0x23,0xe5,0x73,0x89,0xc,0xc4,0x86,0x38,0x4c,0x89,0x24,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xcc,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x20,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xc6,0x87,0x0,0xd3,0xdb,0x0,0x0,0x21,0xc2,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xcc,0xc6,0x81,0x20,0xd3,0xc4,0x1,0xd3,0xdd,0x0,0x0,0x4c,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe1,0x1,0xc9,0x1,0x28,0xe0,0x1,0xcc,0xc6,0x1b,0xc4,0x1,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0x4d,0xc2,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x0,0xf0,0x1,0x1,0xcc,0xc6,0x82,0x68,0xd0,0x89,0x15,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x5b,0xd3,0x0,0x21,0x89,0xc,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0xc4,0xf,0x89,0x23,0xad,0xc3,0xc4,0x89,0x26,0x4c,0x89,0x27,0xd0,0x89,0x25,0xd1,0x0,0x0,0xf,0x5f,0x69,0x6e,0x73,0x74,0x61,0x6c,0x6c,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0xc1,0x75,0xf8,0x22,0x89,0x2a,0x89,0x2a,0xc1,0x3,0xba,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x89,0x2b,0xf,0x89,0x2c,0xb2,0xc3,0xc4,0xc4,0xc4,0x89,0x2d,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x81,0x1e,0xcf,0x0,0xd3,0x0,0xc1,0x75,0xce,0xc1,0x75,0xc4,0xc1,0x75,0xe2,0xc1,0x76,0x1c,0x27,0x89,0x2f,0x89,0x30,0x89,0x2f,0x89,0x31,0x89,0x31,0x89,0x32,0x89,0x32,0xc1,0x3,0xb6,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x89,0x33,0xf,0x89,0x34,0xe5,0x2b,0x82,0x7a,0x83,0x4,0x86,0x38,0x4c,0x89,0x35,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x0,0xf0,0x1,0x1,0xca,0x0,0xc6,0x82,0x7a,0xd0,0x89,0x2e,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x88,0x5b,0xc6,0x87,0x0,0xd3,0x0,0x21,0x82,0x7a,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0xc4,0xf,0x89,0x34,0xad,0xc3,0xc4,0x89,0x37,0x4c,0x89,0x38,0xd0,0x89,0x36,0xd1,0x0,0x0,0x3,0x42,0x69,0x6e,0x5,0x73,0x70,0x6c,0x69,0x74,0x7,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x22,0x83,0x54,0x88,0x3b,0xc1,0x7a,0xc8,0xc1,0x7a,0xbc,0xc1,0x7a,0xe0,0xc1,0x7a,0xfa,0xc1,0x7b,0xa,0xc1,0x7b,0x30,0xc1,0x7b,0x50,0xc1,0x7b,0x72,0xc1,0x7b,0x5a,0x37,0x89,0x3e,0x89,0x3e,0x89,0x3f,0x89,0x3f,0x89,0x3e,0x89,0x40,0x89,0x40,0x89,0x40,0x89,0x41,0x89,0x41,0x89,0x42,0x89,0x42,0x89,0x41,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x44,0x89,0x44,0x89,0x45,0x89,0x46,0x89,0x46,0x89,0x45,0x89,0x44,0xc1,0x3,0xd8,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x89,0x47,0xf,0x89,0x48,0xe5,0x60,0x89,0x3c,0x89,0x3d,0xc4,0xc4,0x89,0x49,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xca,0x0,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x1f,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xce,0xd3,0xdb,0x0,0x0,0x20,0xc2,0xe1,0x1,0xc7,0x5,0xe0,0x1,0xce,0xc6,0x87,0x28,0xca,0x0,0xd3,0xd3,0xdd,0x0,0x0,0x3e,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xce,0xd3,0xdb,0x0,0x0,0x3f,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x1,0xe0,0x1,0xce,0xc6,0x89,0x3b,0xca,0x0,0xd3,0xc6,0x88,0x5b,0xca,0x1,0xd3,0xd3,0x0,0x21,0x89,0x3c,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0xc4,0xf,0x89,0x48,0xad,0xc3,0xc4,0x89,0x4b,0x4c,0x89,0x4c,0xd0,0x89,0x4a,0xd1,0x0,0x0,0x4,0x41,0x72,0x67,0x73,0x6,0x66,0x69,0x6c,0x74,0x65,0x72,0x3,0x53,0x65,0x74,0x4,0x4c,0x69,0x73,0x74,0x5,0x70,0x65,0x61,0x63,0x68,0x4,0x70,0x6d,0x61,0x70,0x7,0x70,0x66,0x69,0x6c,0x74,0x65,0x72,0x7,0x70,0x72,0x65,0x64,0x75,0x63,0x65,0x4,0x6d,0x65,0x61,0x6e,0x6,0x6d,0x65,0x64,0x69,0x61,0x6e,0x3,0x4d,0x61,0x70,0x4,0x6b,0x65,0x79,0x73,0x1,0x6b,0x21,0x89,0x5a,0x22,0x89,0x5b,0x83,0x3,0xc1,0x85,0xb2,0xc1,0x85,0xc2,0x24,0x89,0x5d,0x89,0x5e,0x89,0x5e,0x89,0x5d,0xc1,0x4,0x28,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x89,0x5f,0xf,0x89,0x60,0xbb,0xc3,0x89,0x5c,0xc4,0xc4,0x89,0x61,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xe0,0x1,0xcf,0x0,0xc6,0x1b,0xca,0x0,0xd3,0xca,0x1,0xd3,0x0,0xc1,0x84,0xec,0xc1,0x85,0x14,0xc1,0x85,0x34,0xc1,0x85,0x2a,0xc1,0x85,0x8a,0xc1,0x85,0x80,0x2c,0x89,0x63,0x89,0x63,0x89,0x64,0x89,0x64,0x89,0x64,0x89,0x65,0x89,0x66,0x89,0x65,0x89,0x67,0x89,0x68,0x89,0x68,0x89,0x67,0xc1,0x4,0x22,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x89,0x69,0xf,0x89,0x6a,0xe5,0x40,0x82,0x68,0x81,0x3a,0x1,0x4c,0x89,0x6b,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdc,0x0,0x0,0xc,0xca,0x0,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x2a,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xf0,0x1,0x1,0xe0,0x0,0xce,0xc6,0x89,0x59,0xd3,0xc6,0x82,0x68,0xd0,0x89,0x62,0xd3,0x0,0x21,0x82,0x68,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0xc4,0xf,0x89,0x6a,0xad,0xc3,0xc4,0x89,0x6d,0x4c,0x89,0x6e,0xd0,0x89,0x6c,0xd1,0x0,0x0,0xc1,0x87,0x10,0xc1,0x87,0x20,0x24,0x89,0x70,0x89,0x71,0x89,0x71,0x89,0x70,0xc1,0x4,0x32,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x89,0x72,0xf,0x89,0x73,0xbb,0xc3,0x89,0x5c,0xc4,0xc4,0x89,0x74,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xe0,0x1,0xcf,0x0,0xc6,0x1b,0xca,0x0,0xd3,0xca,0x1,0xd3,0x0,0xc1,0x86,0x4e,0xc1,0x86,0x76,0xc1,0x86,0x96,0xc1,0x86,0x8c,0xc1,0x86,0xea,0xc1,0x86,0xe0,0x2c,0x89,0x76,0x89,0x76,0x89,0x77,0x89,0x77,0x89,0x77,0x89,0x78,0x89,0x79,0x89,0x78,0x89,0x7a,0x89,0x7b,0x89,0x7b,0x89,0x7a,0xc1,0x4,0x2c,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x89,0x7c,0xf,0x89,0x7d,0xe5,0x40,0x83,0x14,0x81,0x3a,0x1,0x4c,0x89,0x7e,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdc,0x0,0x0,0xc,0xca,0x0,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x4a,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xf0,0x1,0x1,0xe0,0x0,0xce,0xc6,0x89,0x59,0xd3,0xc6,0x83,0x14,0xd0,0x89,0x75,0xd3,0x0,0x21,0x83,0x14,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0xc4,0xf,0x89,0x7d,0xad,0xc3,0xc4,0x8a,0x0,0x4c,0x8a,0x1,0xd0,0x89,0x7f,0xd1,0x0,0x0,0x6,0x4f,0x62,0x6a,0x65,0x63,0x74,0xc1,0x88,0x7a,0xc1,0x88,0x8e,0xc1,0x88,0x82,0x25,0x8a,0x4,0x8a,0x5,0x8a,0x6,0x8a,0x5,0x8a,0x4,0xc1,0x4,0x3e,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8a,0x7,0xf,0x8a,0x8,0xbe,0xc3,0x89,0x5c,0xc4,0xc4,0x8a,0x9,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xe0,0x2,0xc7,0x31,0xc6,0x1b,0xc8,0x0,0x0,0xca,0x0,0xd3,0xca,0x1,0xd3,0x0,0xc,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x5f,0x65,0x61,0x63,0x68,0x1,0x6d,0x21,0x8a,0xc,0x22,0x8a,0xd,0x81,0x39,0x22,0x0,0x89,0x59,0xc1,0x87,0x8a,0xc1,0x87,0xb2,0xc1,0x87,0xd2,0xc1,0x87,0xc8,0xc1,0x88,0x30,0xc1,0x88,0x24,0xc1,0x88,0x52,0x2d,0x8a,0x10,0x8a,0x10,0x8a,0x11,0x8a,0x11,0x8a,0x11,0x8a,0x12,0x8a,0x13,0x8a,0x12,0x8a,0x14,0x8a,0x15,0x8a,0x14,0x8a,0x16,0x8a,0x16,0xc1,0x4,0x36,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x8a,0x17,0xf,0x8a,0x18,0xe5,0x49,0x8a,0xb,0x8a,0xe,0x8a,0xf,0x83,0x61,0x8a,0x19,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdc,0x0,0x0,0xc,0xca,0x1,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x2a,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xe0,0x1,0xc7,0x31,0xc6,0x89,0x59,0xca,0x0,0xd3,0xd1,0x1,0xf0,0x1,0x1,0xcb,0x1,0xc6,0x82,0x68,0xd0,0x8a,0xa,0xd3,0x0,0xc1,0x89,0xec,0xc1,0x8a,0x0,0xc1,0x89,0xf4,0x25,0x8a,0x1b,0x8a,0x1c,0x8a,0x1d,0x8a,0x1c,0x8a,0x1b,0xc1,0x4,0x4a,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8a,0x1e,0xf,0x8a,0x1f,0xbe,0xc3,0x89,0x5c,0xc4,0xc4,0x8a,0x20,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xe0,0x2,0xc7,0x31,0xc6,0x1b,0xc8,0x0,0x0,0xca,0x0,0xd3,0xca,0x1,0xd3,0x0,0xb,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x5f,0x6d,0x61,0x70,0xc1,0x89,0x0,0xc1,0x89,0x28,0xc1,0x89,0x48,0xc1,0x89,0x3e,0xc1,0x89,0xa4,0xc1,0x89,0x98,0xc1,0x89,0xc6,0x2d,0x8a,0x23,0x8a,0x23,0x8a,0x24,0x8a,0x24,0x8a,0x24,0x8a,0x25,0x8a,0x26,0x8a,0x25,0x8a,0x27,0x8a,0x28,0x8a,0x27,0x8a,0x29,0x8a,0x29,0xc1,0x4,0x42,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x8a,0x2a,0xf,0x8a,0x2b,0xe5,0x49,0x8a,0x22,0x8a,0xe,0x8a,0xf,0x83,0x61,0x8a,0x2c,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdc,0x0,0x0,0xc,0xca,0x1,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x4a,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xe0,0x1,0xc7,0x31,0xc6,0x89,0x59,0xca,0x0,0xd3,0xd1,0x1,0xf0,0x1,0x1,0xcb,0x1,0xc6,0x83,0x14,0xd0,0x8a,0x21,0xd3,0x0,0x1c,0x66,0x69,0x6c,0x74,0x65,0x72,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x73,0x20,0x61,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x6f,0x72,0x20,0x66,0x6e,0x7,0x48,0x61,0x73,0x68,0x4d,0x61,0x70,0x8,0x74,0x6f,0x4f,0x62,0x6a,0x65,0x63,0x74,0xe,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,0xc1,0x8a,0x78,0xc1,0x8a,0xa0,0xc1,0x8a,0xc0,0xc1,0x8a,0xb6,0xc1,0x8b,0x3a,0xc1,0x8b,0x24,0xc1,0x8b,0x16,0xc1,0x8b,0x8,0x2f,0x8a,0x32,0x8a,0x32,0x8a,0x33,0x8a,0x33,0x8a,0x33,0x8a,0x34,0x8a,0x35,0x8a,0x34,0x8a,0x36,0x8a,0x37,0x8a,0x38,0x8a,0x39,0x8a,0x38,0x8a,0x37,0x8a,0x36,0xc1,0x4,0x4e,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x8a,0x3a,0xf,0x8a,0x3b,0xe5,0x47,0x8a,0x31,0x8a,0xe,0x1,0x4c,0x8a,0x3c,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdc,0x0,0x0,0xc,0xca,0x1,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x1,0xc7,0x7,0xc6,0x8a,0x2e,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xe0,0x0,0xe0,0x1,0xe0,0x1,0xc7,0x32,0xc6,0x81,0x4c,0xca,0x0,0xd3,0xc6,0x89,0x4f,0xca,0x1,0xd3,0xc6,0x8a,0x30,0xd3,0x0,0x23,0x89,0x5b,0x71,0x83,0x3,0xc1,0x8e,0x2e,0xc1,0x8e,0x42,0x24,0x8a,0x3f,0x8a,0x40,0x8a,0x40,0x8a,0x3f,0xc1,0x4,0x6a,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8a,0x41,0xf,0x8a,0x42,0xbd,0xc3,0x8a,0x3e,0xc4,0xc4,0x8a,0x43,0xe0,0x1,0xc9,0x0,0x1,0xc6,0x81,0x1e,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xca,0x1,0xca,0x2,0xd3,0xd3,0x0,0xc,0x5f,0x68,0x61,0x73,0x68,0x6d,0x61,0x70,0x5f,0x6d,0x61,0x70,0x22,0x0,0x81,0x5b,0xc1,0x8d,0x4c,0xc1,0x8d,0x74,0xc1,0x8d,0x94,0xc1,0x8d,0x8a,0xc1,0x8d,0xec,0xc1,0x8d,0xe2,0xc1,0x8e,0x6,0xc1,0x8e,0x68,0x2f,0x8a,0x47,0x8a,0x47,0x8a,0x48,0x8a,0x48,0x8a,0x48,0x8a,0x49,0x8a,0x4a,0x8a,0x49,0x8a,0x4b,0x8a,0x4c,0x8a,0x4b,0x8a,0x4d,0x8a,0x4d,0x8a,0x4e,0x8a,0x4e,0xc1,0x4,0x62,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8a,0x4f,0xf,0x8a,0x50,0xe5,0x4e,0x8a,0x45,0x81,0x3a,0x8a,0x46,0x83,0x61,0x8a,0x51,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdc,0x0,0x0,0xc,0xca,0x0,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x1,0xc7,0x7,0xc6,0x81,0x4a,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x1,0xf0,0x1,0x1,0xce,0xc6,0x82,0x68,0xd0,0x8a,0x44,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x81,0x59,0xd3,0x0,0x3,0x64,0x65,0x6c,0xc1,0x90,0x54,0xc1,0x90,0x66,0xc1,0x90,0x84,0x27,0x8a,0x54,0x8a,0x54,0x8a,0x55,0x8a,0x55,0x8a,0x54,0x8a,0x56,0x8a,0x56,0xc1,0x4,0x7a,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8a,0x57,0xf,0x8a,0x58,0xe5,0x2b,0xc3,0x8a,0x3e,0xc4,0xc4,0x8a,0x59,0xe1,0x1,0xc7,0x5,0xe1,0x3,0xc9,0x0,0x0,0xca,0x0,0xca,0x1,0xca,0x2,0xd3,0xd3,0xdd,0x0,0x0,0x22,0xe0,0x1,0xce,0xc6,0x8a,0x53,0xca,0x0,0xd3,0xdb,0x0,0x0,0x23,0xc2,0x0,0xf,0x5f,0x68,0x61,0x73,0x68,0x6d,0x61,0x70,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,0xc1,0x8f,0x94,0xc1,0x8f,0xbc,0xc1,0x8f,0xdc,0xc1,0x8f,0xd2,0xc1,0x90,0x2c,0xc1,0x90,0xaa,0x2d,0x8a,0x5c,0x8a,0x5c,0x8a,0x5d,0x8a,0x5d,0x8a,0x5d,0x8a,0x5e,0x8a,0x5f,0x8a,0x5e,0x8a,0x60,0x8a,0x60,0x8a,0x61,0x8a,0x61,0x8a,0x61,0xc1,0x4,0x74,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8a,0x62,0xf,0x8a,0x63,0xe5,0x42,0x8a,0x5b,0x81,0x3a,0x1,0x4c,0x8a,0x64,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xdc,0x0,0x0,0xc,0xca,0x0,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x25,0xe1,0x1,0xc7,0x7,0xc6,0x8a,0x2e,0xd3,0xdb,0x0,0x0,0x26,0xc2,0xf0,0x1,0x1,0xce,0xc6,0x82,0x68,0xd0,0x8a,0x5a,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xce,0xd3,0x0,0x6,0x61,0x64,0x64,0x41,0x6c,0x6c,0x9,0x5f,0x75,0x6e,0x6c,0x6f,0x63,0x6b,0x65,0x64,0xc1,0x99,0x2,0x22,0x8a,0x68,0x8a,0x68,0xc1,0x4,0xb0,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8a,0x69,0xf,0x8a,0x6a,0xae,0xc3,0xc4,0xc4,0xc4,0x8a,0x6b,0xe1,0x1,0xc9,0x0,0x1e,0xce,0xd3,0x0,0xb,0x49,0x64,0x65,0x6e,0x74,0x69,0x74,0x79,0x53,0x65,0x74,0xa,0x73,0x74,0x61,0x63,0x6b,0x74,0x72,0x61,0x63,0x65,0x8,0x6e,0x61,0x6d,0x65,0x73,0x6d,0x61,0x70,0x5,0x73,0x74,0x61,0x63,0x6b,0x3,0x6d,0x73,0x67,0x5,0x63,0x6c,0x61,0x73,0x73,0x11,0x5f,0x65,0x72,0x72,0x6f,0x72,0x43,0x6f,0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x6f,0x72,0x21,0x8a,0x71,0x21,0x8a,0x74,0x21,0x8a,0x70,0xc1,0x9b,0x1e,0xc1,0x9b,0x16,0xc1,0x9b,0xd8,0xc1,0x9b,0xa6,0xc1,0x9b,0x86,0xc1,0x9b,0x5e,0xc1,0x9b,0x4c,0xc1,0x9b,0xca,0x2f,0x8a,0x77,0x8a,0x78,0x8a,0x77,0x8a,0x79,0x8a,0x7a,0x8a,0x7b,0x8a,0x7c,0x8a,0x7d,0x8a,0x7d,0x8a,0x7c,0x8a,0x7b,0x8a,0x7e,0x8a,0x7e,0x8a,0x7a,0x8a,0x79,0xc1,0x4,0xc0,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8a,0x7f,0xf,0x8b,0x0,0xe5,0x49,0x8a,0x73,0x8a,0x75,0x8a,0x76,0x4c,0x8b,0x1,0xe0,0x1,0xc7,0x13,0xc6,0x8a,0x6e,0xc4,0x1,0xd3,0xd1,0x0,0xe0,0x0,0xe0,0x2,0xe0,0x2,0xe0,0x2,0xe0,0x0,0xcc,0xc6,0x8a,0x6f,0xd3,0xc6,0x85,0x55,0xc6,0x8a,0x70,0xcb,0x0,0xd3,0xc6,0x85,0x55,0xc6,0x8a,0x71,0xca,0x0,0xd3,0xc6,0x85,0x55,0xc6,0x8a,0x72,0xe0,0x0,0xce,0xc6,0x8a,0x72,0xd3,0xd3,0xc6,0x8a,0x30,0xd3,0x0,0x5,0x45,0x72,0x72,0x6f,0x72,0xd,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0xe,0x55,0x6e,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x45,0x72,0x72,0x6f,0x72,0x8,0x5f,0x5f,0x6f,0x62,0x6a,0x65,0x63,0x74,0x62,0x47,0xc0,0x6,0xc0,0xc1,0x9d,0x70,0xc1,0x9d,0x66,0x23,0x8b,0x8,0x8b,0x9,0x8b,0x8,0xc1,0x4,0xd0,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8b,0xa,0xf,0x8b,0xb,0xad,0xc3,0xc4,0xc4,0xc4,0x8b,0xc,0xe1,0x1,0xc7,0x7,0xce,0xd3,0x0,0x7,0x45,0x72,0x72,0x6f,0x72,0x3a,0x20,0x1,0xa,0x7,0x73,0x74,0x61,0x63,0x6b,0x3a,0x20,0x5,0x20,0x20,0x61,0x74,0x20,0x1,0x3a,0x2,0x24,0x78,0x4,0x66,0x69,0x6c,0x65,0x25,0x86,0x6e,0x8b,0x13,0x8b,0x14,0x81,0x38,0xf,0x25,0xc1,0xc2,0xc1,0xc1,0xc1,0x22,0x81,0x5e,0x88,0x3f,0xc1,0x9d,0xc4,0xc1,0x9d,0xba,0xc1,0x9d,0xe2,0xc1,0x9e,0xa,0xc1,0x9e,0x36,0xc1,0x9e,0x6a,0xc1,0x9e,0x5e,0xc1,0x9f,0x14,0xc1,0x9f,0x8,0xc1,0x9f,0x44,0xc1,0x9f,0x80,0xc1,0xa0,0x20,0xc1,0xa0,0x26,0x3e,0x8b,0x18,0x8b,0x19,0x8b,0x18,0x8b,0x1a,0x8b,0x1b,0x8b,0x1b,0x8b,0x1a,0x8b,0x1c,0x8b,0x1d,0x8b,0x1e,0x8b,0x1e,0x8b,0x1d,0x8b,0x1c,0x8b,0x1f,0x8b,0x20,0x8b,0x20,0x8b,0x1f,0x8b,0x21,0x8b,0x21,0x8b,0x21,0x8b,0x22,0x8b,0x22,0xc0,0xc0,0xc0,0x8b,0x23,0x8b,0x23,0x8b,0x24,0x8b,0x24,0x8b,0x23,0xc1,0x4,0xd2,0x67,0x7,0x8b,0x17,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8b,0x25,0xf,0x8b,0x26,0xe5,0x81,0x2b,0xc3,0xc4,0x8b,0x15,0x8b,0x16,0x8b,0x27,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x0,0xe0,0x3,0xcb,0x0,0xc6,0x81,0x1e,0xc6,0x8b,0xe,0xe0,0x0,0xce,0xc6,0x8a,0x71,0xd3,0xc6,0x8b,0xf,0xd3,0xe0,0x3,0xcb,0x0,0xc6,0x81,0x1e,0xc6,0x8b,0x10,0xe0,0x0,0xe0,0x0,0xce,0xc6,0x8a,0x70,0xd3,0xc6,0x83,0x6,0xd3,0xc6,0x8b,0xf,0xd3,0xc4,0x1,0xd6,0x1,0xe0,0x1,0xe0,0x0,0xce,0xc6,0x8a,0x70,0xd3,0xc6,0x1b,0xcb,0x1,0xd3,0xd2,0x0,0x2,0xd2,0x1,0x3,0xd2,0x2,0x4,0xe1,0x1,0xc7,0x5,0xcb,0x2,0xd3,0xdd,0x0,0x0,0x68,0xdb,0x0,0x0,0x92,0xdb,0x0,0x0,0x69,0xc2,0xe0,0x7,0xcb,0x0,0xc6,0x81,0x1e,0xc6,0x8b,0x11,0xcb,0x2,0xc6,0x8b,0x12,0xcb,0x4,0xc6,0x87,0x23,0xcb,0x3,0xc6,0x8b,0xf,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x1,0xc4,0x1,0xd3,0xd6,0x1,0xdb,0x0,0x0,0x3e,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x5b,0xd3,0xd3,0x0,0xd,0x44,0x65,0x61,0x64,0x6c,0x6f,0x63,0x6b,0x45,0x72,0x72,0x6f,0x72,0xc1,0xa0,0xa6,0xc1,0xa0,0x9c,0x23,0x8b,0x2a,0x8b,0x2b,0x8b,0x2a,0xc1,0x4,0xec,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8b,0x2c,0xf,0x8b,0x2d,0xad,0xc3,0xc4,0xc4,0xc4,0x8b,0x2e,0xe1,0x1,0xc7,0x7,0xce,0xd3,0x0,0x6,0x73,0x74,0x61,0x63,0x6b,0x73,0x22,0x8a,0x76,0x83,0x3,0x24,0x8b,0x13,0x8b,0x14,0x81,0x38,0xf,0x24,0xc2,0xc1,0xc1,0xc1,0x22,0xe8,0x88,0x1a,0xc1,0xa1,0xc0,0xc1,0xa1,0xfa,0xc1,0xa2,0xb2,0xc1,0xa2,0xea,0xc1,0xa3,0x2e,0x2e,0x8b,0x35,0x8b,0x36,0x8b,0x36,0x8b,0x35,0x8b,0x37,0x8b,0x37,0x8b,0x38,0x8b,0x38,0x8b,0x38,0x8b,0x39,0x8b,0x39,0xc0,0xc0,0xc0,0xc1,0x4,0xf4,0x67,0x7,0x8b,0x34,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8b,0x3a,0xf,0x8b,0x3b,0xe5,0x7b,0xc3,0x8b,0x31,0x8b,0x32,0x8b,0x33,0x8b,0x3c,0xe0,0x5,0xc9,0x0,0x0,0xc6,0x81,0x1e,0xc6,0x8b,0x10,0xca,0x1,0xc6,0x87,0x23,0xe0,0x0,0xca,0x0,0xc6,0x83,0x6,0xd3,0xc6,0x8b,0xf,0xd3,0xc4,0x1,0xd6,0x0,0xe0,0x1,0xca,0x0,0xc6,0x1b,0xcb,0x0,0xd3,0xd2,0x0,0x1,0xd2,0x1,0x2,0xd2,0x2,0x3,0xe1,0x1,0xc7,0x5,0xcb,0x1,0xd3,0xdd,0x0,0x0,0x45,0xdb,0x0,0x0,0x70,0xdb,0x0,0x0,0x46,0xc2,0xe0,0x7,0xc9,0x0,0x0,0xc6,0x81,0x1e,0xc6,0x8b,0x11,0xcb,0x1,0xc6,0x8b,0x12,0xcb,0x3,0xc6,0x87,0x23,0xcb,0x2,0xc6,0x8b,0xf,0xd3,0xe1,0x2,0xc7,0xc,0xcb,0x0,0xc4,0x1,0xd3,0xd6,0x0,0xdb,0x0,0x0,0x20,0xc2,0x0,0xc1,0xa0,0xfa,0xc1,0xa0,0xf0,0xc1,0xa1,0x18,0xc1,0xa1,0x40,0xc1,0xa1,0x7e,0xc1,0xa1,0x70,0xc1,0xa3,0xd6,0xc1,0xa3,0xdc,0x30,0x8b,0x3e,0x8b,0x3f,0x8b,0x3e,0x8b,0x40,0x8b,0x41,0x8b,0x41,0x8b,0x40,0x8b,0x42,0x8b,0x43,0x8b,0x43,0x8b,0x42,0x8b,0x44,0x8b,0x44,0x8b,0x45,0x8b,0x45,0x8b,0x44,0xc1,0x4,0xee,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8b,0x46,0xf,0x8b,0x47,0xe5,0x47,0xc3,0xc4,0x86,0x6f,0x4c,0x8b,0x48,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x0,0xe0,0x3,0xcb,0x0,0xc6,0x81,0x1e,0xc6,0x8b,0xe,0xe0,0x0,0xce,0xc6,0x8a,0x71,0xd3,0xc6,0x8b,0xf,0xd3,0xf0,0x1,0x1,0xe0,0x0,0xce,0xc6,0x8b,0x30,0xd3,0xc6,0x82,0x68,0xd0,0x8b,0x3d,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x88,0x5b,0xd3,0xd3,0x0,0xb,0x69,0x73,0x55,0x73,0x65,0x72,0x43,0x6c,0x61,0x73,0x73,0x4,0x5f,0x69,0x73,0x61,0x5,0x73,0x75,0x70,0x65,0x72,0x3,0x69,0x73,0x61,0x21,0x8a,0x72,0x22,0x88,0x5e,0x8b,0x4e,0x4,0x24,0x63,0x6c,0x73,0x21,0x8b,0x50,0xc0,0xb0,0x22,0xf2,0x8b,0x52,0xc1,0xa4,0x38,0xc1,0xa4,0x22,0xc1,0xa4,0x56,0xc1,0xa4,0x60,0xc1,0xa4,0x58,0xc1,0xa4,0x96,0xc1,0xa4,0xe4,0xc1,0xa5,0x4,0xc1,0xa5,0x36,0xc1,0xa5,0x58,0x36,0x8b,0x54,0x8b,0x55,0x8b,0x54,0x8b,0x56,0x8b,0x56,0x8b,0x57,0x8b,0x58,0x8b,0x57,0x8b,0x56,0x8b,0x59,0x8b,0x59,0x8b,0x5a,0x8b,0x5a,0x8b,0x5a,0x8b,0x5b,0x8b,0x5b,0x8b,0x5b,0x8b,0x5c,0x8b,0x5c,0x8b,0x5d,0x8b,0x5d,0x8b,0x5d,0xc1,0x5,0xa,0x67,0x7,0x8b,0x53,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x8b,0x5e,0xf,0x8b,0x5f,0xe5,0x6c,0x8b,0x4d,0x8b,0x4f,0x8b,0x51,0x82,0x70,0x8b,0x60,0xe1,0x1,0xc7,0x3a,0xca,0x1,0xd3,0xdd,0x0,0x0,0x1f,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe1,0x2,0xc7,0x3b,0xca,0x1,0xca,0x0,0xd3,0xd3,0xdb,0x0,0x0,0x20,0xc2,0xe0,0x0,0xca,0x0,0xc6,0x8a,0x72,0xd3,0xd6,0x0,0xcb,0x0,0xdd,0x0,0x0,0x58,0xe1,0x2,0xc7,0x8,0xcb,0x0,0xca,0x1,0xd3,0xdd,0x0,0x0,0x49,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xc0,0xd3,0xdb,0x0,0x0,0x4a,0xc2,0xe8,0x0,0xcb,0x0,0xc6,0x8b,0x4c,0xd3,0xd6,0x0,0xdb,0x0,0x0,0x2a,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xc1,0xd3,0x0,0x5,0x68,0x65,0x6c,0x6c,0x6f,0xe0,0x2e,0x5b,0x31,0x2c,0x5b,0x32,0x2c,0x5b,0x5d,0x5d,0x2c,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x22,0x2c,0x5b,0x5d,0x5d,0x2e,0x66,0x6c,0x61,0x74,0x74,0x65,0x6e,0x20,0x3d,0x3d,0x20,0x5b,0x31,0x2c,0x32,0x2c,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x22,0x5d,0x8,0x62,0x61,0x63,0x6b,0x77,0x61,0x72,0x64,0x22,0xc0,0x8b,0x64,0x1,0x2f,0x1,0x2e,0xc0,0x5e,0x7,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x21,0x8b,0x14,0x21,0x8b,0x6a,0x6,0x24,0x73,0x6c,0x61,0x73,0x68,0x22,0x81,0x3b,0x8b,0x6c,0xc0,0xf4,0x22,0x81,0x56,0x8b,0x6e,0xc1,0xa6,0x14,0xc1,0xa6,0x56,0xc1,0xa6,0x72,0xc1,0xa6,0x90,0xc1,0xa6,0xa8,0xc1,0xa6,0xda,0xc1,0xa7,0x10,0xc1,0xa6,0xfe,0xc1,0xa7,0x4c,0xc1,0xa7,0x56,0xe1,0x21,0x8b,0x70,0x8b,0x70,0x8b,0x71,0x8b,0x71,0x8b,0x71,0x8b,0x72,0x8b,0x72,0x8b,0x72,0x8b,0x73,0x8b,0x73,0x8b,0x73,0x8b,0x74,0x8b,0x74,0x8b,0x74,0x8b,0x75,0x8b,0x75,0x8b,0x75,0x8b,0x76,0x8b,0x76,0x8b,0x77,0x8b,0x77,0xc0,0xc0,0xc0,0x8b,0x76,0xc0,0xc0,0xc0,0x8b,0x78,0x8b,0x78,0x8b,0x79,0x8b,0x79,0x8b,0x78,0xc1,0x5,0x1e,0x67,0x7,0x8b,0x6f,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x8b,0x7a,0xf,0x8b,0x7b,0xe5,0x81,0x18,0x8b,0x69,0x8b,0x6b,0x8b,0x6d,0x86,0x3b,0x8b,0x7c,0xf0,0x2,0x8b,0x65,0xca,0x0,0xc6,0x87,0x28,0xc6,0x8b,0x66,0xc0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x29,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xc6,0x8b,0x67,0xd3,0xdb,0x0,0x0,0x2a,0xc2,0xe1,0x2,0xc7,0x8,0xcb,0x0,0xc4,0x1,0xd3,0xdd,0x0,0x0,0x45,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xc6,0x8b,0x66,0xd3,0xdb,0x0,0x0,0x46,0xc2,0xe1,0x2,0xc7,0x17,0xcb,0x0,0xc4,0x1,0xd3,0xd6,0x1,0xe1,0x2,0xc7,0x8,0xe0,0x1,0xca,0x0,0xc6,0x1b,0xcb,0x1,0xd3,0xe1,0x1,0xc7,0x27,0xc6,0x8b,0x68,0xd3,0xd3,0xdd,0x0,0x0,0x7a,0xe1,0x2,0xc7,0x17,0xcb,0x1,0xc4,0x1,0xd3,0xd6,0x1,0xdb,0x0,0x0,0x51,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x2,0xca,0x0,0xc6,0x87,0x60,0xc2,0xcb,0x1,0xd3,0xd3,0x0,0xa,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x1c,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2e,0x22,0xb,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x1d,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2f,0x22,0xc,0x2e,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x1e,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2e,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2e,0x22,0xd,0x2e,0x2e,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x2,0x2e,0x2e,0xe0,0x20,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2e,0x2e,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2e,0x2e,0x22,0x16,0x2e,0x2e,0x2f,0x66,0x6f,0x6f,0x2f,0x74,0x65,0x73,0x74,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0xb,0x2e,0x2e,0x2f,0x66,0x6f,0x6f,0x2f,0x74,0x65,0x73,0x74,0xe0,0x32,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2e,0x2e,0x2f,0x66,0x6f,0x6f,0x2f,0x74,0x65,0x73,0x74,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2e,0x2e,0x2f,0x66,0x6f,0x6f,0x2f,0x74,0x65,0x73,0x74,0x22,0x1e,0x2f,0x2f,0x66,0x6f,0x6f,0x2f,0x2e,0x2e,0x2f,0x2f,0x2e,0x2e,0x2f,0x74,0x65,0x73,0x74,0x2f,0x2f,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x11,0x2f,0x2f,0x66,0x6f,0x6f,0x2f,0x2e,0x2e,0x2f,0x2f,0x2e,0x2e,0x2f,0x74,0x65,0x73,0x74,0xe0,0x40,0x64,0x69,0x72,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2f,0x2f,0x66,0x6f,0x6f,0x2f,0x2e,0x2e,0x2f,0x2f,0x2e,0x2e,0x2f,0x74,0x65,0x73,0x74,0x2f,0x2f,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x2f,0x2f,0x66,0x6f,0x6f,0x2f,0x2e,0x2e,0x2f,0x2f,0x2e,0x2e,0x2f,0x74,0x65,0x73,0x74,0x22,0x8,0x66,0x69,0x6c,0x65,0x6e,0x61,0x6d,0x65,0xc1,0xa9,0xe0,0xc1,0xaa,0x22,0xc1,0xaa,0x3e,0xc1,0xaa,0x5e,0xc1,0xaa,0x68,0xc1,0xaa,0x70,0x30,0x8c,0xe,0x8c,0xe,0x8c,0xf,0x8c,0xf,0x8c,0xf,0x8c,0x10,0x8c,0x10,0x8c,0x10,0x8c,0x11,0x8c,0x11,0x8c,0x12,0x8c,0x13,0x8c,0x13,0x8c,0x13,0x8c,0x12,0x8c,0x11,0xc1,0x5,0x3c,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x8c,0x14,0xf,0x8c,0x15,0xe5,0x4c,0x8c,0xd,0x8b,0x6b,0x83,0x57,0x4c,0x8c,0x16,0xf0,0x2,0x8b,0x65,0xca,0x0,0xc6,0x87,0x28,0xc6,0x8b,0x66,0xc0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x5,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x28,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xca,0x0,0xd3,0xdb,0x0,0x0,0x29,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x2,0xca,0x0,0xc6,0x87,0x60,0xe1,0x2,0xc7,0xc,0xcb,0x0,0xc4,0x1,0xd3,0xc2,0xd3,0xd3,0x0,0xe0,0x26,0x66,0x69,0x6c,0x65,0x6e,0x61,0x6d,0x65,0x28,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0xe0,0x27,0x66,0x69,0x6c,0x65,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0xe0,0x28,0x66,0x69,0x6c,0x65,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2e,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0xe0,0x32,0x66,0x69,0x6c,0x65,0x6e,0x61,0x6d,0x65,0x28,0x22,0x2e,0x2e,0x2f,0x66,0x6f,0x6f,0x2f,0x74,0x65,0x73,0x74,0x2f,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x5,0x73,0x6c,0x65,0x65,0x70,0xc1,0xac,0x2c,0x22,0x8c,0x1d,0x8c,0x1d,0xc1,0x5,0x50,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8c,0x1e,0xf,0x8c,0x1f,0xb4,0x8c,0x1c,0x86,0x4f,0xc4,0xc4,0x8c,0x20,0xe0,0x1,0xc9,0x0,0x40,0xc6,0x83,0x15,0xca,0x0,0xd3,0x0,0xc1,0xac,0x5c,0x22,0x8c,0x22,0x8c,0x22,0xc1,0x5,0x52,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8c,0x23,0xf,0x8c,0x24,0xb4,0x83,0x15,0x86,0x4f,0xc4,0xc4,0x8c,0x25,0xe0,0x1,0xc9,0x0,0x40,0xc6,0x83,0x15,0xca,0x0,0xd3,0x0,0xc,0x54,0x45,0x53,0x54,0x20,0x46,0x41,0x49,0x4c,0x45,0x44,0x3a,0xc1,0xac,0xae,0xc1,0xac,0xa4,0xc1,0xac,0xe4,0xc1,0xac,0xd8,0xc1,0xad,0x6,0xc1,0xac,0xfc,0xc1,0xad,0x18,0x2c,0x8c,0x28,0x8c,0x29,0x8c,0x2a,0x8c,0x2b,0x8c,0x2b,0x8c,0x2a,0x8c,0x28,0x8c,0x2c,0x8c,0x2d,0x8c,0x2e,0x8c,0x2e,0x8c,0x2c,0xc1,0x5,0x58,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8c,0x2f,0xf,0x8c,0x30,0xe5,0x2d,0xc3,0x14,0xc4,0xc4,0x8c,0x31,0xe1,0x2,0xc7,0x1,0xc6,0x8c,0x27,0xe0,0x1,0xe0,0x0,0xcd,0x0,0xc6,0x87,0x60,0xd3,0xc6,0x88,0x5b,0xc6,0x87,0x23,0xd3,0xd3,0xe1,0x1,0xc7,0x1,0xe1,0x1,0xc9,0x1,0x29,0xca,0x0,0xd3,0xd3,0x0,0xc1,0xac,0x8c,0xc1,0xad,0x3c,0xc1,0xad,0x30,0x27,0x8c,0x33,0x8c,0x33,0x8c,0x33,0x8c,0x34,0x8c,0x35,0x8c,0x35,0x8c,0x34,0xc1,0x5,0x56,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8c,0x36,0xf,0x8c,0x37,0xbb,0x61,0xc4,0xc4,0xc4,0x8c,0x38,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8c,0x32,0xd3,0xe0,0x0,0xe0,0x0,0xcc,0xc6,0x0,0xd3,0xc6,0x5f,0xd3,0x0,0x61,0x81,0x4c,0xc0,0x4,0x5f,0x73,0x65,0x74,0x4,0x5f,0x67,0x65,0x74,0x63,0x8c,0x3b,0xc0,0x8c,0x3c,0xc0,0x5f,0xc0,0xc1,0xb1,0x8c,0x22,0x8c,0x3e,0x8c,0x3e,0xc1,0x5,0x76,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8c,0x3f,0xf,0x8c,0x40,0xb3,0xc3,0xc4,0xc4,0xc4,0x8c,0x41,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x81,0x1e,0xc6,0x5f,0xd3,0xc2,0x0,0xc1,0xb1,0xe6,0xc1,0xb1,0xf8,0x24,0x8c,0x43,0x8c,0x44,0x8c,0x44,0x8c,0x43,0xc1,0x5,0x78,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8c,0x45,0xf,0x8c,0x46,0xb8,0xc3,0xc4,0xc4,0xc4,0x8c,0x47,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x81,0x1e,0xe0,0x0,0xcc,0xc6,0x8a,0x71,0xd3,0xd3,0xc2,0x0,0x5,0x76,0x61,0x6c,0x75,0x65,0x21,0x8c,0x49,0x22,0x8a,0x74,0x8c,0x4a,0xc1,0xb2,0x5a,0x22,0x8c,0x4c,0x8c,0x4c,0xc1,0x5,0x7a,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8c,0x4d,0xf,0x8c,0x4e,0xb5,0xc3,0x8c,0x4b,0xc4,0xc4,0x8c,0x4f,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x81,0x1e,0xca,0x0,0xd3,0xca,0x1,0x0,0x6,0x65,0x78,0x70,0x65,0x63,0x74,0x8,0x6f,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x62,0x8c,0x51,0xc0,0x8c,0x52,0xc0,0xc1,0x5,0x82,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0xc4,0xf,0x8c,0x54,0xaa,0xc3,0xc4,0xc4,0xc4,0x8c,0x55,0xc9,0x0,0x1,0x0,0x13,0x45,0x78,0x70,0x65,0x63,0x74,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,0x2c,0x20,0x6e,0x6f,0x20,0x27,0xc1,0x5,0x8c,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0xc4,0xf,0x8c,0x58,0xaa,0xc3,0xc4,0xc4,0xc4,0x8c,0x59,0xc8,0x1,0x0,0x0,0xa,0x27,0x20,0x6f,0x62,0x73,0x65,0x72,0x76,0x65,0x64,0x6,0x72,0x65,0x6d,0x6f,0x76,0x65,0xc1,0xb5,0x70,0xc1,0xb5,0x64,0xc1,0xb5,0xd6,0xc1,0xb5,0x86,0xc1,0xb5,0x7c,0xc1,0xb6,0x30,0xc1,0xb6,0x1a,0xc1,0xb6,0x4e,0x37,0x8c,0x5d,0x8c,0x5d,0x8c,0x5e,0x8c,0x5e,0x8c,0x5d,0x8c,0x5f,0x8c,0x60,0x8c,0x61,0xc0,0xc0,0xc0,0xc0,0xc0,0x8c,0x60,0x8c,0x5f,0x8c,0x62,0x8c,0x62,0x8c,0x63,0x8c,0x63,0x8c,0x62,0x8c,0x64,0x8c,0x64,0x8c,0x64,0xc1,0x5,0x8a,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8c,0x65,0xf,0x8c,0x66,0xe5,0x5f,0xc3,0xc4,0xc4,0xc4,0x8c,0x67,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc9,0x1,0x0,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x33,0xe0,0x0,0xe1,0x1,0xc7,0x35,0xe1,0x3,0xc7,0x2,0xc6,0x8c,0x57,0xe1,0x0,0xd0,0x8c,0x5a,0xd3,0xc6,0x8c,0x5b,0xd3,0xd3,0xc6,0x47,0xd3,0xdb,0x0,0x0,0x34,0xc2,0xe1,0x2,0xc7,0x8,0xe0,0x1,0xc9,0x1,0x0,0xc6,0x8c,0x5c,0xc4,0x1,0xd3,0xc8,0x0,0x0,0xd3,0xdd,0x0,0x0,0x57,0xe1,0x2,0xc7,0x6,0xc4,0x1,0xc0,0xd3,0xdb,0x0,0x0,0x58,0xc2,0x0,0x4,0x6e,0x61,0x6d,0x65,0x21,0x8c,0x69,0x21,0x8c,0x6a,0xc1,0xb5,0x22,0x23,0x8c,0x6c,0x8c,0x6c,0x8c,0x6c,0xc1,0x5,0x88,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8c,0x6d,0xf,0x8c,0x6e,0xb1,0xc3,0x8c,0x6b,0xc4,0xc4,0x8c,0x6f,0xf1,0x1,0x1,0xc7,0x3c,0xd0,0x8c,0x68,0xd3,0x0,0x4,0x73,0x65,0x65,0x6e,0x22,0x8c,0x71,0x8c,0x52,0xc1,0xb0,0xbc,0xc1,0xb0,0xb2,0x29,0x8c,0x73,0x8c,0x74,0x8c,0x73,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc1,0x5,0x70,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x8c,0x75,0xf,0x8c,0x76,0xe5,0x42,0xc3,0xc4,0x8c,0x72,0x83,0x61,0x8c,0x77,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x0,0xe1,0x7,0xc7,0x38,0xc6,0x8c,0x3d,0xc6,0x5f,0xd0,0x8c,0x42,0xc6,0x8c,0x3c,0xd0,0x8c,0x48,0xc6,0x8c,0x3b,0xd0,0x8c,0x50,0xd3,0xd1,0x1,0xe1,0x5,0xc7,0x38,0xc6,0x8c,0x53,0xc6,0x8c,0x52,0xd0,0x8c,0x56,0xc6,0x8c,0x51,0xd0,0x8c,0x70,0xd3,0x0,0x22,0xc0,0x0,0xb,0x68,0x65,0x6c,0x6c,0x6f,0x20,0x77,0x6f,0x72,0x6c,0x64,0x24,0xc0,0xc0,0xc0,0x86,0x1e,0x5,0x77,0x6f,0x72,0x6c,0x64,0xe0,0x30,0x73,0x70,0x2e,0x73,0x69,0x7a,0x65,0x20,0x3d,0x3d,0x20,0x32,0x2c,0x20,0x73,0x70,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x22,0x68,0x65,0x6c,0x6c,0x6f,0x22,0x2c,0x20,0x73,0x70,0x5b,0x32,0x5d,0x20,0x3d,0x3d,0x20,0x22,0x77,0x6f,0x72,0x6c,0x64,0x22,0x2,0x73,0x70,0x21,0x8c,0x7e,0xc1,0xb6,0xd2,0xc1,0xb6,0xf6,0xc1,0xb6,0xe8,0xc1,0xb7,0x6,0xc1,0xb6,0xfa,0xc1,0xb7,0x1e,0xc1,0xb7,0x16,0xc1,0xb7,0x42,0xc1,0xb7,0x3a,0x34,0x8d,0x0,0x8d,0x0,0x8d,0x1,0x8d,0x2,0x8d,0x3,0x8d,0x3,0x8d,0x4,0x8d,0x4,0x8d,0x3,0x8d,0x5,0x8d,0x5,0x8d,0x6,0x8d,0x6,0x8d,0x5,0x8d,0x7,0x8d,0x7,0x8d,0x8,0x8d,0x8,0x8d,0x7,0x8d,0x1,0xc1,0x5,0x9a,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x8d,0x9,0xf,0x8d,0xa,0xe5,0x4e,0xc3,0xc4,0x8c,0x7f,0x4c,0x8d,0xb,0xe0,0x0,0xc6,0x8c,0x7a,0xc6,0x89,0x3b,0xd3,0xd1,0x0,0xf1,0x4,0x8c,0x7b,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xcb,0x0,0xc6,0x81,0x20,0xd3,0xc4,0x2,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x1,0xcb,0x0,0xc6,0x1b,0xc4,0x1,0xd3,0xc6,0x8b,0x62,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x1,0xcb,0x0,0xc6,0x1b,0xc4,0x2,0xd3,0xc6,0x8c,0x7c,0xd3,0xc6,0x8c,0x7d,0xd3,0x0,0x11,0x4d,0x6f,0x63,0x6b,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x77,0x6f,0x72,0x6b,0x73,0xa,0x6d,0x2e,0x6f,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x18,0x6d,0x2e,0x6f,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x20,0x3d,0x3d,0x20,0x6d,0x2e,0x6f,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x6,0x66,0x6f,0x6f,0x62,0x61,0x72,0x6,0x6e,0x6f,0x2d,0x77,0x61,0x79,0xe0,0x2b,0x74,0x72,0x79,0x28,0x6d,0x2e,0x65,0x78,0x70,0x65,0x63,0x74,0x28,0x22,0x63,0x61,0x6c,0x6c,0x22,0x29,0x2c,0x20,0x22,0x6e,0x6f,0x2d,0x77,0x61,0x79,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x6e,0x6f,0x2d,0x77,0x61,0x79,0x22,0x3,0x68,0x6d,0x6d,0xe0,0x2a,0x74,0x72,0x79,0x28,0x6d,0x2e,0x65,0x78,0x70,0x65,0x63,0x74,0x28,0x22,0x68,0x6d,0x6d,0x22,0x29,0x2c,0x20,0x22,0x6e,0x6f,0x2d,0x77,0x61,0x79,0x22,0x29,0x20,0x3d,0x3d,0x20,0x22,0x6e,0x6f,0x2d,0x77,0x61,0x79,0x22,0x22,0x8a,0xc,0x81,0x38,0xc1,0xb7,0xa6,0xc1,0xb7,0xc6,0xc1,0xb7,0xb8,0xc1,0xb7,0xc8,0xc1,0xb7,0xf2,0xc1,0xb7,0xe4,0xc1,0xb8,0x8,0xc1,0xb7,0xf4,0xc1,0xb8,0x10,0xc1,0xb8,0x56,0xc1,0xb8,0x44,0xc1,0xb8,0x70,0xc1,0xb8,0xa8,0xc1,0xb8,0xc8,0xc1,0xb8,0xe6,0xc1,0xb9,0x1c,0xc1,0xb9,0xe,0xc1,0xb9,0x5c,0xc1,0xb9,0x22,0xc1,0xb9,0x26,0xc1,0xb9,0x8a,0xc1,0xb9,0x7c,0xc1,0xb9,0xc8,0xc1,0xb9,0x90,0xc1,0xb9,0x94,0xe1,0x31,0x8d,0x16,0x8d,0x16,0x8d,0x17,0x8d,0x18,0x8d,0x19,0x8d,0x19,0x8d,0x17,0x8d,0x1a,0x8d,0x1b,0x8d,0x1c,0x8d,0x1c,0x8d,0x1d,0x8d,0x1d,0x8d,0x1e,0x8d,0x1e,0x8d,0x1c,0x8d,0x1a,0x8d,0x1f,0x8d,0x20,0x8d,0x20,0x8d,0x1f,0x8d,0x21,0x8d,0x21,0x8d,0x22,0x8d,0x22,0x8d,0x23,0x8d,0x23,0x8d,0x24,0x8d,0x24,0x8d,0x25,0x8d,0x26,0x8d,0x27,0x8d,0x27,0x8d,0x28,0x8d,0x29,0x8d,0x29,0x8d,0x28,0x8d,0x27,0x8d,0x25,0x8d,0x2a,0x8d,0x2b,0x8d,0x2c,0x8d,0x2c,0x8d,0x2d,0x8d,0x2e,0x8d,0x2e,0x8d,0x2d,0x8d,0x2c,0x8d,0x2a,0xc1,0x5,0xa2,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8d,0x2f,0xf,0x8d,0x30,0xe5,0x81,0x45,0xc3,0xc4,0x8d,0x15,0x83,0x61,0x8d,0x31,0xe0,0x0,0xc9,0x0,0x36,0xc6,0x81,0x4c,0xd3,0xd1,0x0,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe0,0x0,0xcb,0x0,0xc6,0x8c,0x52,0xd3,0xc6,0x8d,0xe,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xcb,0x0,0xc6,0x8c,0x52,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x8c,0x52,0xd3,0xd3,0xc6,0x8d,0xf,0xd3,0xe0,0x0,0xe0,0x0,0xcb,0x0,0xc6,0x8c,0x52,0xd3,0xc6,0x8d,0x10,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x8c,0x51,0xc6,0x8d,0x10,0xd3,0xe0,0x0,0xcb,0x0,0xc6,0x8c,0x52,0xd3,0xd1,0x1,0xe1,0x1,0xcb,0x1,0xc6,0x8b,0x62,0xd3,0xe0,0x1,0xcb,0x0,0xc6,0x8c,0x51,0xc6,0x5f,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x2,0xc9,0x0,0x4,0xe0,0x1,0xcb,0x0,0xc6,0x8c,0x51,0xc6,0x5f,0xd3,0xc6,0x8d,0x11,0xd3,0xc6,0x8d,0x11,0xd3,0xc6,0x8d,0x12,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x2,0xc9,0x0,0x4,0xe0,0x1,0xcb,0x0,0xc6,0x8c,0x51,0xc6,0x8d,0x13,0xd3,0xc6,0x8d,0x11,0xd3,0xc6,0x8d,0x11,0xd3,0xc6,0x8d,0x14,0xd3,0x0,0xa,0x5f,0x69,0x6f,0x5f,0x67,0x65,0x74,0x65,0x6e,0x76,0xe,0x54,0x4c,0x5f,0x4d,0x4f,0x44,0x55,0x4c,0x45,0x5f,0x50,0x41,0x54,0x48,0x6,0x73,0x79,0x73,0x74,0x65,0x6d,0x6,0x70,0x72,0x65,0x66,0x69,0x78,0xc1,0xba,0xd0,0xc1,0xba,0xc4,0x23,0x8d,0x37,0x8d,0x38,0x8d,0x37,0xc1,0x5,0xc4,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x8d,0x39,0xf,0x8d,0x3a,0xaf,0xc3,0xc4,0xc4,0xc4,0x8d,0x3b,0xe0,0x0,0xc7,0x3e,0xc6,0x8d,0x36,0xd3,0x0,0x7,0x2f,0x6c,0x69,0x62,0x2f,0x74,0x6c,0x1,0x70,0x21,0x8d,0x3e,0x21,0x8d,0x3f,0xc1,0xbb,0x38,0x22,0x8d,0x41,0x8d,0x41,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8d,0x42,0xf,0x8d,0x3a,0xb3,0xc3,0x8d,0x40,0xc4,0xc4,0x8d,0x43,0xe0,0x1,0xc9,0x0,0x37,0xc6,0x81,0x1e,0xca,0x0,0xd3,0x0,0xa,0x5f,0x50,0x61,0x74,0x68,0x5f,0x73,0x74,0x61,0x74,0x3,0x6e,0x65,0x71,0x3,0x69,0x6e,0x6f,0x4,0x73,0x74,0x61,0x74,0x22,0x8b,0x14,0x8d,0x48,0xc1,0xbd,0xf2,0xc1,0xbd,0xde,0xc1,0xbe,0x1a,0xc1,0xbe,0x10,0xc1,0xbe,0x32,0x2e,0xc0,0xc0,0xc0,0x8d,0x4a,0x8d,0x4b,0x8d,0x4a,0x8d,0x4c,0x8d,0x4c,0x8d,0x4d,0x8d,0x4d,0x8d,0x4c,0x8d,0x4e,0x8d,0x4e,0x8d,0x4e,0xc1,0x5,0xd8,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8d,0x4f,0xf,0x8d,0x50,0xe5,0x45,0xc3,0x8d,0x40,0x8d,0x49,0x83,0x61,0x8d,0x51,0xe1,0x3,0xc7,0x2,0xca,0x0,0xc6,0x8b,0x66,0xc8,0x0,0x0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x3f,0xcb,0x0,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x40,0xe0,0x0,0xcb,0x1,0xc6,0x8d,0x47,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x3a,0xe1,0x3,0xc7,0x6,0xc4,0x1,0xcb,0x0,0xcb,0x1,0xd3,0xdb,0x0,0x0,0x3b,0xc2,0x0,0x12,0x66,0x69,0x6c,0x65,0x46,0x72,0x6f,0x6d,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x50,0x61,0x74,0x68,0x4,0x70,0x61,0x74,0x68,0x21,0x8d,0x54,0x22,0x8c,0x6a,0x8d,0x55,0xc1,0xbc,0xfa,0xc1,0xbc,0xe6,0xc1,0xbd,0x22,0xc1,0xbd,0x18,0xc1,0xbd,0x3a,0xc1,0xbd,0x74,0xc1,0xbe,0x5e,0x33,0xc0,0xc0,0xc0,0x8d,0x57,0x8d,0x58,0x8d,0x57,0x8d,0x59,0x8d,0x59,0x8d,0x5a,0x8d,0x5a,0x8d,0x59,0x8d,0x5b,0x8d,0x5b,0x8d,0x5b,0x8d,0x5c,0x8d,0x5c,0x8d,0x5d,0x8d,0x5d,0x8d,0x5d,0xc1,0x5,0xd0,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8d,0x5e,0xf,0x8d,0x5f,0xe5,0x65,0x8d,0x53,0x8d,0x56,0x8d,0x49,0x83,0x61,0x8d,0x60,0xca,0x1,0xdd,0x0,0x0,0x44,0xe1,0x3,0xc7,0x2,0xca,0x1,0xc6,0x8b,0x66,0xca,0x0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x3f,0xcb,0x0,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x40,0xe0,0x0,0xcb,0x1,0xc6,0x8d,0x47,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x3f,0xe1,0x3,0xc7,0x6,0xc4,0x0,0xcb,0x0,0xcb,0x1,0xd3,0xdb,0x0,0x0,0x40,0xc2,0xdb,0x0,0x0,0x45,0xc2,0xf0,0x1,0x1,0xc9,0x0,0x37,0xc6,0x82,0x68,0xd0,0x8d,0x52,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xc2,0xd3,0x0,0xc1,0x17,0x70,0xe0,0x20,0x5b,0x33,0x30,0x30,0x30,0x2c,0x20,0x31,0x39,0x2c,0x20,0x31,0x30,0x2c,0x20,0x39,0x39,0x5d,0x2e,0x73,0x6f,0x72,0x74,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x31,0x30,0xc,0x5f,0x65,0x6e,0x76,0x5f,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0xd,0x5f,0x65,0x6e,0x76,0x5b,0x22,0x41,0x72,0x72,0x61,0x79,0x22,0x5d,0x4,0x41,0x72,0x72,0x61,0x1,0x79,0x12,0x5f,0x65,0x6e,0x76,0x5b,0x22,0x41,0x72,0x72,0x61,0x22,0x20,0x2b,0x20,0x22,0x79,0x22,0x5d,0x10,0x5f,0x76,0x6d,0x5f,0x67,0x65,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0xb,0x5f,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6e,0x65,0x77,0xa,0x3c,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x3e,0xd,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x6b,0x73,0xc1,0xc1,0x3c,0x22,0x8d,0x6d,0x8d,0x6d,0xc1,0x5,0xf6,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8d,0x6e,0xf,0x8d,0x6f,0xb2,0xc3,0x8c,0x6b,0xc4,0xc4,0x8d,0x70,0xe0,0x1,0xc9,0x0,0x0,0xc6,0x1b,0xca,0x0,0xd3,0x0,0xb,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x72,0x75,0x6e,0xc,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x6c,0x69,0x6e,0x6b,0x4,0x5f,0x65,0x6e,0x76,0x5,0x62,0x63,0x6f,0x64,0x65,0x4,0x5f,0x6d,0x6f,0x64,0x5,0x6c,0x69,0x6e,0x6b,0x73,0x6,0x6c,0x69,0x6e,0x6b,0x65,0x64,0x8,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x26,0x8d,0x74,0x8d,0x75,0x8d,0x76,0x8d,0x77,0x8d,0x78,0x8d,0x79,0x26,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xbf,0x6,0xc1,0xbe,0xee,0xc1,0xbf,0x22,0xc1,0xbf,0x14,0xc1,0xbf,0x2a,0xc1,0xbf,0x54,0xc1,0xbf,0x46,0xc1,0xbf,0x5c,0xc1,0xbf,0x6c,0xc1,0xbf,0xb2,0xc1,0xbf,0x92,0xc1,0xc0,0x8a,0xc1,0xc0,0x74,0xc1,0xc0,0xe8,0xc1,0xc0,0xce,0xc1,0xc1,0x1a,0xc1,0xc1,0x80,0xc1,0xc1,0x6a,0xc1,0xc1,0x9a,0xc1,0xc1,0x82,0xe1,0x21,0x8d,0x7c,0x8d,0x7d,0x8d,0x7c,0x8d,0x7e,0x8d,0x7f,0x8e,0x0,0x8e,0x0,0x8d,0x7e,0x8e,0x1,0x8e,0x2,0x8e,0x3,0x8e,0x4,0x8e,0x4,0x8e,0x4,0x8e,0x3,0x8e,0x1,0x8e,0x5,0x8e,0x6,0x8e,0x5,0x8e,0x7,0x8e,0x8,0x8e,0x7,0x8e,0x9,0x8e,0xa,0x8e,0x9,0x8e,0xb,0x8e,0xb,0x8e,0xc,0x8e,0xd,0x8e,0xe,0x8e,0xf,0x8e,0xe,0x8e,0xc,0xc1,0x5,0xe8,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x10,0xf,0x8e,0x11,0xe5,0x7a,0xc3,0xc4,0x8d,0x7a,0x8d,0x7b,0x8e,0x12,0xe1,0x0,0xc7,0x41,0xd3,0xd1,0x0,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe0,0x1,0xcb,0x0,0xc6,0x1b,0xc6,0x81,0x4b,0xd3,0xc6,0x8d,0x65,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe0,0x1,0xcb,0x0,0xc6,0x1b,0xe1,0x2,0xc7,0xc,0xc6,0x8d,0x66,0xc6,0x8d,0x67,0xd3,0xd3,0xc6,0x8d,0x68,0xd3,0xe1,0x0,0xc7,0x42,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x43,0xcb,0x1,0xc6,0x8d,0x6b,0xd3,0xd1,0x2,0xe1,0x1,0xc7,0x44,0xcb,0x2,0xd3,0xd1,0x3,0xf0,0x1,0x1,0xcb,0x3,0xc6,0x83,0x14,0xd0,0x8d,0x71,0xd3,0xd1,0x4,0xe1,0x1,0xc7,0x45,0xe1,0x2,0xc7,0x46,0xcb,0x2,0xcb,0x4,0xd3,0xd3,0xd1,0x5,0x0,0x6,0x67,0x6f,0x74,0x20,0x69,0x74,0xc1,0x6,0x10,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0xc4,0xf,0x8e,0x15,0xaa,0xc3,0x14,0xc4,0xc4,0x8e,0x16,0xc6,0x8e,0x14,0x0,0x5,0x66,0x61,0x6c,0x73,0x65,0xc1,0xc3,0x5a,0xc1,0xc3,0x96,0xc1,0xc3,0xb4,0xc1,0xc3,0xa6,0x29,0x8e,0x19,0x8e,0x19,0x8e,0x19,0x8e,0x1a,0x8e,0x1a,0x8e,0x1a,0x8e,0x1b,0x8e,0x1c,0x8e,0x1b,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x8e,0x1d,0xf,0x8e,0x15,0xe5,0x23,0xc3,0xc4,0xc4,0xc4,0x8e,0x1e,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8e,0x17,0xd3,0xe1,0x2,0xc7,0x17,0xc2,0xc4,0x1,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xc1,0xc6,0x8e,0x18,0xd3,0x0,0xe,0x5f,0x78,0x20,0x3d,0x3d,0x20,0x22,0x67,0x6f,0x74,0x20,0x69,0x74,0x22,0x9,0x69,0x73,0x44,0x65,0x66,0x69,0x6e,0x65,0x64,0x17,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x72,0x65,0x61,0x64,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x27,0x3,0x27,0x3a,0x20,0xc1,0xc5,0x6a,0x22,0x8e,0x24,0x8e,0x24,0xc1,0x6,0x24,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x25,0xf,0x8e,0x26,0xb0,0xc3,0xc4,0xc4,0xc4,0x8e,0x27,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8a,0x71,0xd3,0x0,0xc1,0xc5,0x16,0x28,0x8e,0x29,0x8e,0x29,0xc0,0xc0,0xc0,0xc0,0xc0,0x8e,0x29,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x2a,0xf,0x8e,0x26,0xe5,0x23,0xc3,0x14,0xc4,0xc4,0x8e,0x2b,0xe1,0x3,0xc7,0x6,0xc4,0x1,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8e,0x22,0xc8,0x0,0x0,0xc6,0x8e,0x23,0xe1,0x0,0xd0,0x8e,0x28,0xd3,0xd3,0xd3,0x0,0x4,0x2e,0x74,0x6c,0x62,0xc0,0x5,0x5,0x6d,0x74,0x69,0x6d,0x65,0x17,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x6c,0x6f,0x61,0x64,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x27,0xc1,0xc7,0x98,0x22,0x8e,0x31,0x8e,0x31,0xc1,0x6,0x2c,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x32,0xf,0x8e,0x33,0xaf,0xc3,0xc4,0xc4,0xc4,0x8e,0x34,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0x0,0xc1,0xc7,0x44,0x28,0x8e,0x36,0x8e,0x36,0xc0,0xc0,0xc0,0xc0,0xc0,0x8e,0x36,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x37,0xf,0x8e,0x33,0xe5,0x23,0xc3,0x14,0xc4,0xc4,0x8e,0x38,0xe1,0x3,0xc7,0x6,0xc4,0x2,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8e,0x30,0xc8,0x1,0x0,0xc6,0x8e,0x23,0xe1,0x0,0xd0,0x8e,0x35,0xd3,0xd3,0xd3,0x0,0x24,0xc0,0x8c,0x69,0xc0,0xc0,0x4,0x6c,0x6f,0x61,0x64,0xf,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x46,0x72,0x6f,0x6d,0x46,0x69,0x6c,0x65,0xc1,0xc8,0x9c,0x22,0x8e,0x3d,0x8e,0x3d,0xc1,0x6,0x30,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x3e,0xf,0x8e,0x3f,0xb3,0xc3,0x8c,0x6b,0xc4,0xc4,0x8e,0x40,0xe1,0x2,0xc9,0x2,0x3f,0xca,0x0,0xc9,0x0,0x0,0xd3,0x0,0x16,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x72,0x75,0x6e,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x27,0xc1,0xc9,0x40,0x22,0x8e,0x43,0x8e,0x43,0xc1,0x6,0x32,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x44,0xf,0x8e,0x45,0xb0,0xc3,0xc4,0xc4,0xc4,0x8e,0x46,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8a,0x71,0xd3,0x0,0xc1,0xc8,0xee,0x28,0x8e,0x48,0x8e,0x48,0xc0,0xc0,0xc0,0xc0,0xc0,0x8e,0x48,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x49,0xf,0x8e,0x45,0xe5,0x23,0xc3,0x14,0xc4,0xc4,0x8e,0x4a,0xe1,0x3,0xc7,0x6,0xc4,0x2,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8e,0x42,0xc8,0x1,0x0,0xc6,0x8e,0x23,0xe1,0x0,0xd0,0x8e,0x47,0xd3,0xd3,0xd3,0x0,0x3,0x6d,0x6f,0x64,0x23,0x8d,0x54,0x8e,0x4c,0x81,0x5b,0xc1,0xc7,0x20,0xc1,0xc7,0xdc,0xc1,0xc8,0x16,0xc1,0xc8,0x40,0xc1,0xc8,0x22,0xc1,0xc8,0x62,0xc1,0xc8,0xca,0xc1,0xc9,0x70,0xc1,0xc9,0x9a,0xc1,0xc9,0xac,0x36,0x8e,0x4e,0x8e,0x4e,0x8e,0x4e,0x8e,0x4f,0x8e,0x4f,0x8e,0x50,0x8e,0x51,0x8e,0x52,0x8e,0x51,0x8e,0x53,0x8e,0x53,0x8e,0x50,0x8e,0x54,0x8e,0x54,0x8e,0x54,0x8e,0x55,0x8e,0x55,0x8e,0x56,0x8e,0x56,0x8e,0x57,0x8e,0x57,0x8e,0x56,0xc1,0x6,0x28,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x58,0xf,0x8e,0x59,0xe5,0x6d,0xc3,0xc4,0x8e,0x4d,0x83,0x8,0x8e,0x5a,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8e,0x39,0xd3,0xe1,0x1,0xc9,0x1,0x31,0xc9,0x0,0x1,0xd3,0xd1,0x0,0xf0,0x4,0x8e,0x3a,0xc9,0x1,0x3a,0xc6,0x8e,0x3b,0xe1,0x1,0xc7,0x49,0xc9,0x0,0x1,0xd3,0xe0,0x2,0xc9,0x0,0x1,0xc6,0x87,0x60,0xc2,0xc6,0x8e,0x2e,0xd3,0xc9,0x1,0x3c,0xd0,0x8e,0x41,0xd3,0xd1,0x1,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8e,0x4b,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x82,0x7c,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x6,0xc4,0x1,0xe0,0x2,0xc9,0x1,0x38,0xc6,0x85,0x55,0xc8,0x0,0x0,0xcb,0x2,0xd3,0xd3,0x0,0x3,0x2e,0x74,0x6c,0x1a,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x27,0xc1,0xcb,0x22,0x22,0x8e,0x5e,0x8e,0x5e,0xc1,0x6,0x3e,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x5f,0xf,0x8e,0x60,0xaf,0xc3,0xc4,0xc4,0xc4,0x8e,0x61,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x6,0xd3,0x0,0xc1,0xca,0xc8,0x28,0x8e,0x63,0x8e,0x63,0xc0,0xc0,0xc0,0xc0,0xc0,0x8e,0x63,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x64,0xf,0x8e,0x60,0xe5,0x23,0xc3,0x14,0xc4,0xc4,0x8e,0x65,0xe1,0x3,0xc7,0x6,0xc4,0x2,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8e,0x5d,0xc8,0x1,0x0,0xc6,0x8e,0x23,0xe1,0x0,0xd0,0x8e,0x62,0xd3,0xd3,0xd3,0x0,0xf,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x46,0x72,0x6f,0x6d,0x46,0x69,0x6c,0x65,0xc1,0xcc,0x1c,0x22,0x8e,0x68,0x8e,0x68,0xc1,0x6,0x42,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x69,0xf,0x8e,0x6a,0xb3,0xc3,0x8c,0x6b,0xc4,0xc4,0x8e,0x6b,0xe1,0x2,0xc9,0x2,0x3f,0xca,0x0,0xc9,0x0,0x0,0xd3,0x0,0xc1,0xcc,0xc0,0x22,0x8e,0x6d,0x8e,0x6d,0xc1,0x6,0x44,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x6e,0xf,0x8e,0x6f,0xb0,0xc3,0xc4,0xc4,0xc4,0x8e,0x70,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8a,0x71,0xd3,0x0,0xc1,0xcc,0x6e,0x28,0x8e,0x72,0x8e,0x72,0xc0,0xc0,0xc0,0xc0,0xc0,0x8e,0x72,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x73,0xf,0x8e,0x6f,0xe5,0x23,0xc3,0x14,0xc4,0xc4,0x8e,0x74,0xe1,0x3,0xc7,0x6,0xc4,0x2,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8e,0x42,0xc8,0x1,0x0,0xc6,0x8e,0x23,0xe1,0x0,0xd0,0x8e,0x71,0xd3,0xd3,0xd3,0x0,0xc1,0xca,0xa4,0xc1,0xcb,0x66,0xc1,0xcb,0xa0,0xc1,0xcb,0xca,0xc1,0xcb,0xac,0xc1,0xcc,0x4a,0xc1,0xcc,0xf0,0xc1,0xcd,0x1a,0xc1,0xcd,0x2c,0x34,0x8e,0x76,0x8e,0x76,0x8e,0x76,0x8e,0x77,0x8e,0x77,0x8e,0x78,0x8e,0x79,0x8e,0x7a,0x8e,0x79,0x8e,0x78,0x8e,0x7b,0x8e,0x7b,0x8e,0x7b,0x8e,0x7c,0x8e,0x7c,0x8e,0x7d,0x8e,0x7d,0x8e,0x7e,0x8e,0x7e,0x8e,0x7d,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8e,0x7f,0xf,0x55,0xe5,0x63,0xc3,0xc4,0x8e,0x4d,0x83,0x8,0x8f,0x0,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8e,0x66,0xd3,0xe1,0x1,0xc9,0x1,0x31,0xc9,0x0,0x3,0xd3,0xd1,0x0,0xf0,0x4,0x8e,0x3a,0xc9,0x1,0x3a,0xc6,0x8e,0x3b,0xe1,0x1,0xc7,0x4a,0xc9,0x0,0x3,0xd3,0xc9,0x0,0x3,0xc9,0x1,0x3c,0xd0,0x8e,0x6c,0xd3,0xd1,0x1,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8e,0x75,0xd3,0xe0,0x0,0xcb,0x1,0xc6,0x82,0x7c,0xd3,0xd1,0x2,0xe1,0x2,0xc7,0x6,0xc4,0x1,0xe0,0x2,0xc9,0x1,0x38,0xc6,0x85,0x55,0xc8,0x0,0x0,0xcb,0x2,0xd3,0xd3,0x0,0x4,0x2e,0x6d,0x6f,0x64,0xe0,0x20,0x55,0x6e,0x61,0x62,0x6c,0x65,0x20,0x74,0x6f,0x20,0x6c,0x6f,0x61,0x64,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x64,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x27,0xc1,0xce,0xbe,0x22,0x8f,0x4,0x8f,0x4,0xc1,0x6,0x50,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x5,0xf,0x8f,0x6,0xb0,0xc3,0xc4,0xc4,0xc4,0x8f,0x7,0xe0,0x0,0xc8,0x0,0x0,0xc6,0x8a,0x71,0xd3,0x0,0xc1,0xce,0x58,0x28,0x8f,0x9,0x8f,0x9,0xc0,0xc0,0xc0,0xc0,0xc0,0x8f,0x9,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0xa,0xf,0x8f,0x6,0xe5,0x23,0xc3,0x14,0xc4,0xc4,0x8f,0xb,0xe1,0x3,0xc7,0x6,0xc4,0x2,0xc2,0xe1,0x4,0xc7,0x2,0xc6,0x8f,0x3,0xc8,0x1,0x0,0xc6,0x8e,0x23,0xe1,0x0,0xd0,0x8f,0x8,0xd3,0xd3,0xd3,0x0,0x6,0x64,0x6c,0x6f,0x70,0x65,0x6e,0x21,0x81,0x5b,0xc1,0xce,0x34,0xc1,0xce,0xf4,0xc1,0xce,0xe8,0xc1,0xcf,0x1e,0xc1,0xcf,0x30,0x2b,0x8f,0xf,0x8f,0xf,0x8f,0xf,0x8f,0x10,0x8f,0x11,0x8f,0x10,0x8f,0x12,0x8f,0x12,0x8f,0x13,0x8f,0x13,0x8f,0x12,0xc1,0x6,0x4c,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x14,0xf,0x8f,0x15,0xe5,0x30,0xc3,0xc4,0x8f,0xe,0x4c,0x8f,0x16,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8f,0xc,0xd3,0xe1,0x1,0xc7,0x4b,0xc9,0x0,0x4,0xd3,0xd1,0x0,0xe1,0x2,0xc7,0x6,0xc4,0x1,0xe0,0x2,0xc9,0x1,0x38,0xc6,0x85,0x55,0xc8,0x0,0x0,0xcb,0x0,0xd3,0xd3,0x0,0x12,0x27,0x3a,0x20,0x6e,0x6f,0x20,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x66,0x6f,0x75,0x6e,0x64,0x8,0x72,0x65,0x73,0x6f,0x6c,0x76,0x65,0x32,0x25,0x81,0x5b,0x8b,0x14,0x8d,0x48,0x8b,0x14,0x8b,0x14,0x25,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc4,0x48,0xc1,0xc4,0x76,0xc1,0xc4,0x64,0xc1,0xc4,0x8e,0xc1,0xc4,0xf2,0xc1,0xc5,0xbe,0xc1,0xc5,0xee,0xc1,0xc5,0xfe,0xc1,0xc6,0x3e,0xc1,0xc6,0x30,0xc1,0xc6,0x1a,0xc1,0xc6,0x6,0xc1,0xc6,0x24,0xc1,0xc6,0x4c,0xc1,0xca,0x6,0xc1,0xca,0x34,0xc1,0xcd,0x86,0xc1,0xcd,0xb6,0xc1,0xcf,0x64,0xc1,0xcf,0x84,0xe1,0x3b,0x8f,0x1c,0x8f,0x1c,0x8f,0x1d,0x8f,0x1e,0x8f,0x1d,0x8f,0x1f,0x8f,0x1f,0x8f,0x1f,0x8f,0x20,0x8f,0x20,0x8f,0x20,0x8f,0x21,0xc0,0xc0,0xc0,0x8f,0x21,0xc0,0x8f,0x22,0x8f,0x23,0x8f,0x23,0x8f,0x24,0x8f,0x24,0x8f,0x25,0x8f,0x26,0x8f,0x27,0x8f,0x28,0x8f,0x28,0x8f,0x26,0x8f,0x25,0x8f,0x29,0x8f,0x29,0x8f,0x24,0x8f,0x23,0xc0,0x8f,0x2a,0xc0,0xc0,0xc0,0x8f,0x2a,0xc0,0x8f,0x2b,0xc0,0x8f,0x2c,0xc0,0xc0,0xc0,0x8f,0x2c,0xc0,0x8f,0x2d,0xc0,0x8f,0x2e,0x8f,0x2e,0x8f,0x2e,0x8f,0x2f,0x8f,0x2f,0xc0,0xc0,0xc0,0x8f,0x2f,0xc1,0x6,0x1c,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x30,0xf,0x8f,0x31,0xe5,0x81,0x63,0x8f,0x19,0x8d,0x56,0x8f,0x1a,0x8f,0x1b,0x8f,0x32,0xe0,0x1,0xc9,0x0,0x38,0xc6,0x1b,0xca,0x0,0xd3,0xd1,0x0,0xe1,0x1,0xc7,0x47,0xcb,0x0,0xd3,0xdd,0x0,0x0,0x24,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x25,0xc2,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x8e,0x2c,0xd3,0xe1,0x2,0xc9,0x0,0x39,0xe1,0x2,0xc7,0x2,0xca,0x0,0xc6,0x8e,0x2d,0xd3,0xca,0x1,0xd3,0xd2,0x0,0x1,0xd2,0x1,0x2,0xf1,0x2,0x8c,0x79,0xc7,0x48,0xe1,0x2,0xc7,0x1a,0xcb,0x1,0xe1,0x2,0xc7,0xa,0xe0,0x0,0xe1,0x1,0xc7,0x3f,0xe0,0x2,0xcb,0x1,0xc6,0x87,0x60,0xc2,0xc6,0x8e,0x2e,0xd3,0xd3,0xc6,0x8e,0x2f,0xd3,0xe0,0x0,0xcb,0x2,0xc6,0x8e,0x2f,0xd3,0xd3,0xd3,0xd0,0x8e,0x5b,0xd3,0xe1,0x2,0xc9,0x0,0x39,0xe1,0x2,0xc7,0x2,0xca,0x0,0xc6,0x8e,0x5c,0xd3,0xca,0x1,0xd3,0xd1,0x3,0xf1,0x2,0x8c,0x79,0xc7,0x48,0xcb,0x3,0xd0,0x8f,0x1,0xd3,0xe1,0x2,0xc9,0x0,0x39,0xe1,0x2,0xc7,0x2,0xca,0x0,0xc6,0x8f,0x2,0xd3,0xca,0x1,0xd3,0xd1,0x4,0xf1,0x2,0x8c,0x79,0xc7,0x48,0xcb,0x4,0xd0,0x8f,0x17,0xd3,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xc2,0xd3,0xe1,0x3,0xc7,0x6,0xc4,0x0,0xc2,0xe1,0x3,0xc7,0x2,0xc6,0x8e,0x22,0xca,0x0,0xc6,0x8f,0x18,0xd3,0xd3,0x0,0x7,0x72,0x65,0x73,0x6f,0x6c,0x76,0x65,0x4,0x66,0x61,0x69,0x6c,0x22,0x81,0x5b,0x8f,0x35,0xc1,0xd0,0x56,0xc1,0xd0,0x94,0xc1,0xd0,0xc2,0xc1,0xd0,0xb8,0xc1,0xd0,0xce,0xc1,0xd0,0xc4,0xc1,0xd0,0xf0,0x2e,0x8f,0x37,0x8f,0x37,0x8f,0x38,0x8f,0x38,0x8f,0x38,0x8f,0x39,0x8f,0x3a,0x8f,0x3b,0x8f,0x3c,0x8f,0x3b,0x8f,0x39,0x8f,0x3d,0x8f,0x3d,0x8f,0x3d,0xc1,0x6,0x5c,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x3e,0xf,0x8f,0x3f,0xe5,0x4e,0x8f,0x34,0x8d,0x56,0x8f,0x36,0x83,0x61,0x8f,0x40,0xe1,0x2,0xc9,0x0,0x3e,0xca,0x0,0xca,0x1,0xd3,0xd2,0x0,0x0,0xd2,0x1,0x1,0xcb,0x0,0xdd,0x0,0x0,0x23,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xcb,0x0,0xd3,0xdb,0x0,0x0,0x24,0xc2,0xcb,0x1,0xdd,0x0,0x0,0x3a,0xe1,0x1,0xc7,0x7,0xe1,0x1,0xc7,0x35,0xcb,0x1,0xd3,0xd3,0xdb,0x0,0x0,0x3b,0xc2,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xc3,0xd3,0x0,0x2,0x69,0x6f,0x5,0x66,0x72,0x61,0x6d,0x65,0x4,0x6c,0x69,0x6e,0x6b,0x21,0x8f,0x44,0x26,0xc0,0x8c,0x69,0x8f,0x44,0xc0,0xc0,0xc0,0x6,0x3c,0x65,0x76,0x61,0x6c,0x3e,0xc1,0xd2,0xda,0x22,0x8f,0x48,0x8f,0x48,0xc1,0x6,0x72,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x49,0xf,0x8f,0x4a,0xb0,0xc3,0x8c,0x6b,0xc4,0xc4,0x8f,0x4b,0xe1,0x1,0xc9,0x2,0x3f,0xca,0x0,0xd3,0x0,0xc1,0xd2,0xea,0xc1,0xd2,0x46,0xc1,0xd2,0x8e,0xc1,0xd3,0xa,0x28,0x8f,0x4d,0x8f,0x4e,0x8f,0x4f,0x8f,0x4f,0x8f,0x4e,0x8f,0x50,0x8f,0x50,0x8f,0x4d,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x51,0xf,0x8f,0x4a,0xe5,0x3c,0xc3,0xc4,0xc4,0xc4,0x8f,0x52,0xf0,0x1,0x8f,0x45,0xf0,0x6,0x8f,0x46,0xc9,0x1,0x3a,0xc6,0x8e,0x3b,0xcf,0x0,0xc6,0x8f,0x47,0xe0,0x1,0xcd,0x0,0xc6,0x1b,0xc6,0x8f,0x43,0xd3,0xc8,0x0,0x0,0xc9,0x1,0x3c,0xd0,0x8f,0x4c,0xd3,0xc6,0x8f,0x43,0xe0,0x1,0xcd,0x0,0xc6,0x1b,0xc6,0x8f,0x43,0xd3,0xd3,0x0,0x25,0xc0,0x8c,0x69,0x8f,0x44,0xc0,0xc0,0xc1,0xd3,0xf8,0x22,0x8f,0x55,0x8f,0x55,0xc1,0x6,0x74,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x56,0xf,0x8f,0x57,0xb0,0xc3,0x8c,0x6b,0xc4,0xc4,0x8f,0x58,0xe1,0x1,0xc9,0x2,0x3f,0xca,0x0,0xd3,0x0,0xc1,0xd4,0x8,0xc1,0xd3,0x6e,0xc1,0xd3,0xb6,0xc1,0xd4,0x28,0x28,0x8f,0x5a,0x8f,0x5b,0x8f,0x5c,0x8f,0x5c,0x8f,0x5b,0x8f,0x5d,0x8f,0x5d,0x8f,0x5a,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x5e,0xf,0x8f,0x57,0xe5,0x39,0xc3,0xc4,0xc4,0xc4,0x8f,0x5f,0xf0,0x1,0x8f,0x45,0xf0,0x5,0x8f,0x54,0xc9,0x1,0x3a,0xc6,0x8e,0x3b,0xcf,0x0,0xc6,0x8f,0x47,0xe0,0x1,0xcd,0x0,0xc6,0x1b,0xc6,0x8f,0x43,0xd3,0xc9,0x1,0x3c,0xd0,0x8f,0x59,0xd3,0xc6,0x8f,0x43,0xe0,0x1,0xcd,0x0,0xc6,0x1b,0xc6,0x8f,0x43,0xd3,0xd3,0x0,0x25,0xc0,0x8c,0x69,0xc0,0xc0,0xc0,0xc1,0xd4,0xf8,0x22,0x8f,0x62,0x8f,0x62,0xc1,0x6,0x76,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x63,0xf,0x8f,0x64,0xb0,0xc3,0x8c,0x6b,0xc4,0xc4,0x8f,0x65,0xe1,0x1,0xc9,0x2,0x3f,0xca,0x0,0xd3,0x0,0xc1,0xd5,0x8,0xc1,0xd4,0x8c,0x24,0x8f,0x67,0x8f,0x68,0x8f,0x68,0x8f,0x67,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x69,0xf,0x8f,0x64,0xe5,0x26,0xc3,0xc4,0xc4,0xc4,0x8f,0x6a,0xe0,0x0,0xf0,0x5,0x8f,0x61,0xc9,0x1,0x3a,0xc6,0x8e,0x3b,0xcf,0x0,0xc6,0x8f,0x47,0xc8,0x0,0x0,0xc9,0x1,0x3c,0xd0,0x8f,0x66,0xd3,0xc6,0x82,0x7c,0xd3,0x0,0xc1,0xd5,0xc6,0x22,0x8f,0x6c,0x8f,0x6c,0xc1,0x6,0x78,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x6d,0xf,0x8f,0x6e,0xb0,0xc3,0x8c,0x6b,0xc4,0xc4,0x8f,0x6f,0xe1,0x1,0xc9,0x2,0x3f,0xca,0x0,0xd3,0x0,0xc1,0xd5,0xd6,0xc1,0xd5,0x64,0x24,0x8f,0x71,0x8f,0x72,0x8f,0x72,0x8f,0x71,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x73,0xf,0x8f,0x6e,0xe5,0x23,0xc3,0xc4,0xc4,0xc4,0x8f,0x74,0xe0,0x0,0xf0,0x4,0x8e,0x3a,0xc9,0x1,0x3a,0xc6,0x8e,0x3b,0xcf,0x0,0xc6,0x8f,0x47,0xc9,0x1,0x3c,0xd0,0x8f,0x70,0xd3,0xc6,0x82,0x7c,0xd3,0x0,0x5,0x5f,0x65,0x76,0x61,0x6c,0x3,0x65,0x6e,0x76,0x21,0x8f,0x77,0x21,0x8f,0x78,0xc1,0xd2,0x20,0xc1,0xd2,0xc,0xc1,0xd3,0x34,0x2f,0x8f,0x7a,0x8f,0x7a,0x8f,0x7b,0x8f,0x7b,0x8f,0x7a,0xc0,0xc0,0x8f,0x7c,0x8f,0x7c,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc1,0x6,0x70,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x8f,0x7d,0xf,0x8f,0x7e,0xe5,0x3e,0x8f,0x76,0x8f,0x79,0xc4,0xc4,0x8f,0x7f,0xe1,0x2,0xc7,0x1a,0xe0,0x1,0xcc,0xc6,0x1b,0xc6,0x8f,0x43,0xd3,0xca,0x0,0xd3,0xe3,0x0,0xd0,0x8f,0x53,0xd3,0xe0,0x1,0xcc,0xc6,0x1b,0xc6,0x8f,0x43,0xd3,0xe3,0x0,0xd0,0x8f,0x60,0xd3,0xca,0x0,0xe3,0x0,0xd0,0x8f,0x6b,0xd3,0xc0,0xe3,0x0,0xd0,0x8f,0x75,0xd3,0xd4,0x0,0x4,0x65,0x76,0x61,0x6c,0xf,0x78,0x20,0x3d,0x20,0x34,0x32,0xa,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x78,0xc0,0x54,0xc1,0xd7,0x5c,0xc1,0xd7,0x50,0x25,0x90,0x4,0x90,0x4,0x90,0x5,0x90,0x5,0x90,0x4,0xc1,0x6,0x82,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc2,0xc,0x90,0x6,0xf,0x90,0x7,0xb8,0xc3,0xc4,0xc4,0xc4,0x90,0x8,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xc6,0x90,0x2,0xc6,0x90,0x1,0xd3,0xc6,0x90,0x3,0xd3,0x0,0xf,0x75,0x6e,0x63,0x61,0x75,0x67,0x68,0x74,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0xd,0x5f,0x73,0x65,0x74,0x5f,0x65,0x78,0x69,0x74,0x63,0x6f,0x64,0x65,0xc1,0xd8,0x8,0xc1,0xd7,0xfe,0xc1,0xd8,0x40,0xc1,0xd8,0x64,0xc1,0xd8,0x4a,0x28,0x90,0xc,0x90,0xd,0x90,0xe,0x90,0xe,0x90,0xc,0x90,0xf,0x90,0x10,0x90,0xf,0xc1,0x6,0x8c,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x90,0x11,0xf,0x90,0x12,0xbe,0xc3,0x14,0xc4,0xc4,0x90,0x13,0xe1,0x2,0xc7,0x1,0xc6,0x90,0xa,0xe1,0x1,0xc9,0x1,0x29,0xca,0x0,0xd3,0xd3,0xe1,0x1,0xc7,0x4c,0xc4,0x1,0xd3,0x0,0xb,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x6c,0x69,0x6e,0x65,0x8,0x72,0x65,0x61,0x64,0x6c,0x69,0x6e,0x6b,0xc1,0xda,0x58,0x22,0x90,0x17,0x90,0x17,0xc1,0x6,0x9a,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x90,0x18,0xf,0x90,0x19,0xb3,0xc3,0x8c,0x6b,0xc4,0xc4,0x90,0x1a,0xe1,0x2,0xc9,0x1,0x3f,0xca,0x0,0xc9,0x0,0x1,0xd3,0x0,0x7,0x72,0x75,0x6e,0x6d,0x61,0x69,0x6e,0x2,0x61,0x73,0x21,0x90,0x1d,0x21,0x90,0x1e,0x22,0x8b,0x14,0x8d,0x54,0xc1,0xd7,0xe6,0xc1,0xd8,0x8c,0xc1,0xd8,0x80,0xc1,0xd8,0xa4,0xc1,0xd8,0xd2,0xc1,0xd8,0xb4,0xc1,0xd9,0x56,0xc1,0xd9,0x82,0xc1,0xd9,0x88,0xc1,0xd9,0xca,0xc1,0xda,0x74,0xc1,0xd9,0xdc,0xc1,0xda,0x6,0xc1,0xd9,0xe8,0xc1,0xda,0x82,0xe1,0x21,0x90,0x21,0x90,0x21,0x90,0x21,0x90,0x22,0x90,0x22,0x90,0x23,0x90,0x23,0x90,0x22,0x90,0x24,0x90,0x24,0x90,0x25,0x90,0x26,0x90,0x26,0x90,0x25,0x90,0x24,0x90,0x27,0x90,0x27,0x90,0x28,0x90,0x29,0x90,0x29,0x90,0x28,0x90,0x2a,0x90,0x2a,0x90,0x2b,0x90,0x2c,0x90,0x2d,0x90,0x2e,0x90,0x2d,0x90,0x2c,0x90,0x2f,0x90,0x2f,0x90,0x2b,0x90,0x2a,0xc1,0x6,0x8a,0x67,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x90,0x30,0xf,0x90,0x31,0xe5,0x81,0x11,0x90,0x1c,0x90,0x1f,0x90,0x20,0x83,0x61,0x90,0x32,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x90,0x14,0xd3,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xca,0x0,0xc6,0x81,0x20,0xd3,0xc4,0x0,0xd3,0xdd,0x0,0x0,0x33,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe1,0x0,0xe1,0x1,0xc9,0x0,0x3f,0xc6,0x90,0x15,0xd3,0xd3,0xd3,0xdb,0x0,0x0,0x34,0xc2,0xe0,0x1,0xca,0x0,0xc6,0x1b,0xc4,0x1,0xd3,0xd1,0x0,0xe1,0x1,0xc9,0x0,0x31,0xe0,0x2,0xc9,0x0,0x40,0xc6,0x90,0x16,0xcb,0x0,0xcb,0x0,0xd3,0xd3,0xd1,0x1,0xe1,0x2,0xc7,0x6,0xc4,0x0,0xe0,0x1,0xf0,0x4,0x8e,0x3a,0xc9,0x0,0x3a,0xc6,0x8e,0x3b,0xe1,0x1,0xc7,0x4a,0xcb,0x0,0xd3,0xcb,0x0,0xc9,0x0,0x3c,0xd0,0x90,0x1b,0xd3,0xc6,0x82,0x7c,0xe0,0x2,0xca,0x0,0xc6,0x87,0x60,0xc4,0x2,0xc2,0xd3,0xd3,0xd3,0x0,0x9,0x5f,0x54,0x61,0x73,0x6b,0x5f,0x6e,0x65,0x77,0xc1,0xda,0xae,0x22,0x90,0x35,0x90,0x35,0xc1,0x6,0x9e,0x67,0x7,0xc4,0x8,0xc2,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x90,0x36,0xf,0x90,0x37,0xaf,0xc3,0xc4,0xc4,0xc4,0x90,0x38,0xe1,0x1,0xc9,0x0,0x42,0xcd,0x0,0xd3,0x0,0x6,0x69,0x6f,0x6c,0x6f,0x6f,0x70,0x6,0x3c,0x6d,0x61,0x69,0x6e,0x3e,0x4,0x4d,0x6f,0x63,0x6b,0xd,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x70,0x61,0x74,0x68,0x73,0x8,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x73,0x2,0x5f,0x78,0x4,0x6d,0x61,0x69,0x6e,0xe1,0x44,0x1d,0x31,0x3f,0x49,0x60,0x6f,0x78,0x81,0x1,0x81,0xf,0x81,0x17,0x81,0x21,0x81,0x37,0x81,0x5a,0x81,0x73,0x82,0x29,0x82,0x52,0x82,0x6d,0x83,0x1d,0x83,0x3f,0x83,0x5e,0x84,0x9,0x84,0x32,0x84,0x5d,0x84,0x78,0x85,0x14,0x85,0x28,0x85,0x37,0x85,0x63,0x86,0x4,0x86,0x15,0x86,0x37,0x86,0x41,0x86,0x4c,0x86,0x6d,0x86,0x76,0x87,0x1,0x87,0x1d,0x87,0x7c,0x88,0x17,0x88,0x39,0x88,0x5c,0x6,0x8a,0xb,0x8a,0x22,0x8a,0x31,0x8a,0x45,0x8a,0x5b,0x8a,0x73,0x8b,0x4d,0x8b,0x69,0x8c,0xd,0x8c,0x1c,0x83,0x15,0x61,0x90,0x3c,0x90,0x3d,0x90,0x3e,0x8d,0x53,0x8d,0x79,0x8d,0x74,0x8d,0x74,0x90,0x3f,0x8f,0x19,0x8f,0x34,0x8f,0x42,0x8f,0x76,0x90,0x1c,0x90,0x40,0xe1,0x44,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0x5,0x6c,0x69,0x6e,0x65,0x73,0xc0,0x9a,0xc0,0xf6,0xc1,0x1,0x72,0xc1,0x1,0x74,0xc1,0x1,0xd8,0xc1,0x1,0xda,0xc1,0x2,0xcc,0xc1,0x3,0x9e,0xc1,0x3,0xa0,0xc1,0x3,0xcc,0xc1,0x4,0xc,0xc1,0x4,0x64,0xc1,0x4,0x92,0xc1,0x4,0xca,0xc1,0x4,0xea,0xc1,0x5,0x24,0xc1,0x5,0x26,0xc1,0x5,0x4a,0xc1,0x5,0xd2,0xc1,0x5,0xe6,0xc1,0x6,0x20,0xc1,0x6,0x40,0xc1,0x6,0x84,0xc1,0x6,0xf8,0xc1,0x7,0x2e,0xc1,0x7,0x6a,0xc1,0x7,0xbe,0xc1,0x7,0xd4,0xc1,0x7,0xd6,0xc1,0x8,0x1c,0xc1,0x8,0x68,0xc1,0x8,0xc6,0xc1,0x8,0xc8,0xc1,0x8,0xe4,0xc1,0x9,0x14,0xc1,0x9,0x2e,0xc1,0x9,0x30,0xc1,0x9,0x4c,0xc1,0x9,0x7c,0xc1,0x9,0x96,0xc1,0x9,0x98,0xc1,0xa,0x8,0xc1,0xa,0x6a,0xc1,0xa,0x6c,0xc1,0xa,0xf8,0xc1,0xb,0xb2,0xc1,0xc,0x50,0xc1,0xd,0x0,0xc1,0xd,0x1c,0xc1,0xd,0x4a,0xc1,0xd,0xc4,0xc1,0xd,0xc6,0xc1,0xd,0xf0,0xc1,0xe,0xe,0xc1,0xe,0x38,0xc1,0xe,0x58,0xc1,0xe,0xa6,0xc1,0xe,0xe6,0xc1,0xe,0xe8,0xc1,0xf,0x8c,0xc1,0x10,0x3e,0xc1,0x10,0xdc,0xc1,0x11,0x2c,0xc1,0x11,0x46,0xc1,0x11,0x74,0xc1,0x11,0xec,0xc1,0x11,0xee,0xc1,0x12,0x18,0xc1,0x12,0x36,0xc1,0x12,0x38,0xc1,0x12,0x60,0xc1,0x12,0x8a,0xc1,0x12,0xaa,0xc1,0x13,0x0,0xc1,0x13,0x48,0xc1,0x13,0x6e,0xc1,0x13,0x9a,0xc1,0x13,0x9c,0xc1,0x14,0x52,0xc1,0x14,0xaa,0xc1,0x15,0x78,0xc1,0x15,0xb0,0xc1,0x15,0xfa,0xc1,0x16,0x84,0xc1,0x16,0xd8,0xc1,0x17,0x2,0xc1,0x17,0x34,0xc1,0x17,0x74,0xc1,0x17,0xbe,0xc1,0x17,0xee,0xc1,0x18,0x1c,0xc1,0x18,0x54,0xc1,0x18,0x8a,0xc1,0x19,0xc,0xc1,0x19,0x4c,0xc1,0x19,0x80,0xc1,0x19,0xd8,0xc1,0x1a,0x2,0xc1,0x1a,0x20,0xc1,0x1a,0x56,0xc1,0x1a,0x8e,0xc1,0x1a,0xf8,0xc1,0x1b,0x1a,0xc1,0x1b,0x30,0xc1,0x1b,0x32,0xc1,0x1b,0xf4,0xc1,0x1c,0x26,0xc1,0x1c,0xc8,0xc1,0x1d,0x30,0xc1,0x1d,0x80,0xc1,0x1d,0xae,0xc1,0x1d,0xdc,0xc1,0x1e,0x16,0xc1,0x1e,0x18,0xc1,0x1e,0x40,0xc1,0x1e,0x76,0xc1,0x1e,0x78,0xc1,0x1e,0xa0,0xc1,0x1e,0xbe,0xc1,0x1e,0xd2,0xc1,0x1e,0xf2,0xc1,0x1f,0x40,0xc1,0x1f,0x6a,0xc1,0x1f,0xb2,0xc1,0x1f,0xec,0xc1,0x20,0x1e,0xc1,0x20,0x20,0xc1,0x20,0xae,0xc1,0x21,0x14,0xc1,0x21,0x9e,0xc1,0x22,0x54,0xc1,0x22,0xc8,0xc1,0x23,0x2a,0xc1,0x23,0xa6,0xc1,0x24,0xa,0xc1,0x24,0x5e,0xc1,0x24,0x7e,0xc1,0x24,0xb8,0xc1,0x25,0x26,0xc1,0x25,0x28,0xc1,0x25,0x46,0xc1,0x25,0x6e,0xc1,0x25,0xd6,0xc1,0x26,0x3e,0xc1,0x26,0x40,0xc1,0x26,0x76,0xc1,0x26,0xc8,0xc1,0x26,0xe8,0xc1,0x27,0x8,0xc1,0x27,0xa,0xc1,0x27,0x80,0xc1,0x27,0x94,0xc1,0x27,0xb6,0xc1,0x27,0xf2,0xc1,0x28,0x12,0xc1,0x28,0x14,0xc1,0x28,0xda,0xc1,0x29,0x72,0xc1,0x29,0xa4,0xc1,0x29,0xda,0xc1,0x2a,0x4c,0xc1,0x2a,0xd2,0xc1,0x2b,0x18,0xc1,0x2b,0x44,0xc1,0x2b,0x68,0xc1,0x2b,0x94,0xc1,0x2b,0xbe,0xc1,0x2c,0x0,0xc1,0x2c,0x5c,0xc1,0x2c,0x8c,0xc1,0x2c,0xbe,0xc1,0x2c,0xf4,0xc1,0x2c,0xf6,0xc1,0x2d,0x5a,0xc1,0x2d,0x5c,0xc1,0x2e,0x1e,0xc1,0x2e,0xde,0xc1,0x2e,0xfc,0xc1,0x2f,0x2a,0xc1,0x2f,0xa6,0xc1,0x2f,0xd4,0xc1,0x30,0x20,0xc1,0x30,0x4c,0xc1,0x30,0x80,0xc1,0x30,0xd6,0xc1,0x31,0x1e,0xc1,0x31,0x46,0xc1,0x31,0x52,0xc1,0x31,0x68,0xc1,0x31,0x6a,0xc1,0x32,0x28,0xc1,0x32,0xe0,0xc1,0x33,0x32,0xc1,0x33,0x4e,0xc1,0x33,0x7c,0xc1,0x33,0xf6,0xc1,0x34,0x24,0xc1,0x34,0x66,0xc1,0x34,0xbe,0xc1,0x34,0xee,0xc1,0x35,0x1a,0xc1,0x35,0x4e,0xc1,0x35,0xac,0xc1,0x35,0xfc,0xc1,0x36,0x2a,0xc1,0x36,0x52,0xc1,0x36,0x78,0xc1,0x36,0x86,0xc1,0x36,0x88,0xc1,0x37,0x38,0xc1,0x37,0xa2,0xc1,0x37,0xd2,0xc1,0x38,0x0,0xc1,0x38,0x3a,0xc1,0x38,0x68,0xc1,0x38,0xaa,0xc1,0x39,0x2,0xc1,0x39,0x32,0xc1,0x39,0x5e,0xc1,0x39,0x92,0xc1,0x39,0xc4,0xc1,0x3a,0x14,0xc1,0x3a,0x56,0xc1,0x3a,0x90,0xc1,0x3a,0xb8,0xc1,0x3a,0xde,0xc1,0x3a,0xec,0xc1,0x3a,0xee,0xc1,0x3b,0xac,0xc1,0x3c,0x4e,0xc1,0x3c,0xa2,0xc1,0x3d,0x8,0xc1,0x3d,0x2a,0xc1,0x3d,0x64,0xc1,0x3d,0xd4,0xc1,0x3e,0x2,0xc1,0x3e,0x30,0xc1,0x3e,0x9e,0xc1,0x3e,0xc6,0xc1,0x3f,0x1e,0xc1,0x3f,0x5a,0xc1,0x3f,0x8e,0xc1,0x3f,0xc2,0xc1,0x40,0x14,0xc1,0x40,0x3c,0xc1,0x40,0x56,0xc1,0x40,0x62,0xc1,0x40,0xfc,0xc1,0x41,0x68,0xc1,0x41,0x6a,0xc1,0x41,0xbc,0xc1,0x41,0xe0,0xc1,0x42,0x2c,0xc1,0x42,0x78,0xc1,0x42,0xa6,0xc1,0x43,0x16,0xc1,0x43,0x36,0xc1,0x43,0x38,0xc1,0x43,0x88,0xc1,0x43,0xac,0xc1,0x43,0xf8,0xc1,0x44,0x44,0xc1,0x44,0x72,0xc1,0x44,0xe0,0xc1,0x45,0x0,0xc1,0x45,0x2,0xc1,0x45,0x78,0xc1,0x45,0x9e,0xc1,0x45,0xea,0xc1,0x46,0x1c,0xc1,0x46,0x1e,0xc1,0x46,0x72,0xc1,0x46,0x9c,0xc1,0x46,0xe8,0xc1,0x47,0x34,0xc1,0x47,0x62,0xc1,0x47,0x94,0xc1,0x47,0xf2,0xc1,0x48,0x54,0xc1,0x48,0x56,0xc1,0x48,0xa2,0xc1,0x48,0xd4,0xc1,0x48,0xfc,0xc1,0x49,0x24,0xc1,0x49,0x46,0xc1,0x49,0x74,0xc1,0x49,0xa8,0xc1,0x4a,0x32,0xc1,0x4a,0xe8,0xc1,0x4b,0x16,0xc1,0x4b,0x70,0xc1,0x4b,0xca,0xc1,0x4b,0xcc,0xc1,0x4c,0x2,0xc1,0x4c,0x2e,0xc1,0x4c,0x92,0xc1,0x4c,0xba,0xc1,0x4c,0xf0,0xc1,0x4d,0x4c,0xc1,0x4d,0x7a,0xc1,0x4d,0x7c,0xc1,0x4d,0xc2,0xc1,0x4e,0x6c,0xc1,0x4e,0xde,0xc1,0x4e,0xe0,0xc1,0x4f,0x6,0xc1,0x4f,0x2e,0xc1,0x4f,0x4c,0xc1,0x4f,0x76,0xc1,0x4f,0xc4,0xc1,0x50,0x16,0xc1,0x50,0x44,0xc1,0x50,0x78,0xc1,0x50,0xa2,0xc1,0x50,0xb2,0xc1,0x50,0xb4,0xc1,0x51,0x32,0xc1,0x51,0x96,0xc1,0x51,0x98,0xc1,0x52,0x20,0xc1,0x52,0x70,0xc1,0x52,0xa4,0xc1,0x52,0xc0,0xc1,0x52,0xfa,0xc1,0x53,0x36,0xc1,0x53,0x80,0xc1,0x53,0xba,0xc1,0x53,0xda,0xc1,0x53,0xdc,0xc1,0x54,0x36,0xc1,0x54,0x64,0xc1,0x54,0x86,0xc1,0x54,0xe6,0xc1,0x55,0x48,0xc1,0x55,0x6e,0xc1,0x55,0x7a,0xc1,0x55,0x7c,0xc1,0x56,0x44,0xc1,0x56,0xe8,0xc1,0x57,0x40,0xc1,0x57,0x5c,0xc1,0x57,0x84,0xc1,0x57,0xb6,0xc1,0x57,0xe2,0xc1,0x57,0xe4,0xc1,0x58,0x56,0xc1,0x58,0xbc,0xc1,0x58,0xda,0xc1,0x59,0x1c,0xc1,0x59,0x44,0xc1,0x59,0x46,0xc1,0x59,0x88,0xc1,0x59,0xa6,0xc1,0x59,0xdc,0xc1,0x5a,0x46,0xc1,0x5a,0x66,0xc1,0x5a,0x86,0xc1,0x5a,0x88,0xc1,0x5a,0xdc,0xc1,0x5a,0xde,0xc1,0x5b,0x90,0xc1,0x5b,0xe8,0xc1,0x5c,0x1e,0xc1,0x5c,0x8c,0xc1,0x5c,0xe8,0xc1,0x5d,0x6a,0xc1,0x5d,0xa6,0xc1,0x5e,0x28,0xc1,0x5e,0x46,0xc1,0x5e,0xd6,0xc1,0x5f,0x26,0xc1,0x5f,0xaa,0xc1,0x5f,0xda,0xc1,0x60,0xe,0xc1,0x60,0x10,0xc1,0x60,0x38,0xc1,0x60,0x3a,0xc1,0x60,0x62,0xc1,0x60,0xcc,0xc1,0x61,0x20,0xc1,0x61,0x7a,0xc1,0x61,0xf6,0xc1,0x61,0xf8,0xc1,0x62,0x1e,0xc1,0x62,0x9a,0xc1,0x63,0xa,0xc1,0x63,0x70,0xc1,0x63,0xca,0xc1,0x63,0xf0,0xc1,0x63,0xf2,0xc1,0x64,0x14,0xc1,0x64,0x40,0xc1,0x64,0x74,0xc1,0x64,0x76,0xc1,0x64,0x9e,0xc1,0x64,0xdc,0xc1,0x65,0x4,0xc1,0x65,0x48,0xc1,0x65,0x6e,0xc1,0x65,0xa0,0xc1,0x65,0xf2,0xc1,0x66,0x52,0xc1,0x66,0xa6,0xc1,0x66,0xd4,0xc1,0x67,0x16,0xc1,0x67,0x2e,0xc1,0x67,0x5a,0xc1,0x67,0x5c,0xc1,0x67,0xce,0xc1,0x68,0x44,0xc1,0x68,0x62,0xc1,0x68,0x94,0xc1,0x68,0xce,0xc1,0x69,0x3a,0xc1,0x69,0x3c,0xc1,0x69,0x5c,0xc1,0x69,0x70,0xc1,0x69,0xae,0xc1,0x69,0xd0,0xc1,0x69,0xf6,0xc1,0x69,0xf8,0xc1,0x6a,0x7a,0xc1,0x6a,0xec,0xc1,0x6b,0xc,0xc1,0x6b,0x76,0xc1,0x6b,0xb0,0xc1,0x6c,0x16,0xc1,0x6c,0x18,0xc1,0x6c,0x7e,0xc1,0x6c,0xe4,0xc1,0x6c,0xe6,0xc1,0x6d,0xc,0xc1,0x6d,0x20,0xc1,0x6d,0x5a,0xc1,0x6d,0x7c,0xc1,0x6d,0xa2,0xc1,0x6d,0xa4,0xc1,0x6d,0xf4,0xc1,0x6e,0x38,0xc1,0x6e,0x3a,0xc1,0x6e,0x52,0xc1,0x6e,0x8c,0xc1,0x6e,0xd2,0xc1,0x6f,0x22,0xc1,0x6f,0x6a,0xc1,0x6f,0xc2,0xc1,0x70,0x4e,0xc1,0x70,0x6e,0xc1,0x70,0x70,0xc1,0x70,0x90,0xc1,0x70,0xb6,0xc1,0x70,0xdc,0xc1,0x70,0xf4,0xc1,0x70,0xf6,0xc1,0x71,0x10,0xc1,0x71,0x94,0xc1,0x72,0x18,0xc1,0x72,0xca,0xc1,0x73,0x20,0xc1,0x73,0x62,0xc1,0x73,0xba,0xc1,0x73,0xe2,0xc1,0x74,0x2c,0xc1,0x74,0x46,0xc1,0x74,0x4e,0xc1,0x74,0x50,0xc1,0x74,0xd2,0xc1,0x75,0x50,0xc1,0x75,0xb0,0xc1,0x75,0xd8,0xc1,0x76,0xe,0xc1,0x76,0x30,0xc1,0x76,0x38,0xc1,0x76,0x86,0xc1,0x76,0xd0,0xc1,0x77,0x2e,0xc1,0x77,0x30,0xc1,0x77,0x7c,0xc1,0x77,0xc8,0xc1,0x78,0x10,0xc1,0x78,0x6c,0xc1,0x78,0x6e,0xc1,0x79,0x2a,0xc1,0x79,0x7c,0xc1,0x7a,0x30,0xc1,0x7a,0xa6,0xc1,0x7a,0xec,0xc1,0x7b,0x3c,0xc1,0x7b,0x86,0xc1,0x7b,0x8e,0xc1,0x7b,0x90,0xc1,0x7b,0xda,0xc1,0x7c,0x20,0xc1,0x7c,0x6a,0xc1,0x7c,0xbc,0xc1,0x7d,0xe,0xc1,0x7d,0x64,0xc1,0x7d,0xae,0xc1,0x7d,0xb0,0xc1,0x7e,0xc,0xc1,0x7e,0x58,0xc1,0x7e,0xa0,0xc1,0x7e,0xfa,0xc1,0x7f,0x44,0xc1,0x7f,0x8a,0xc1,0x7f,0xd4,0xc1,0x80,0x26,0xc1,0x80,0x78,0xc1,0x80,0xc6,0xc1,0x81,0x10,0xc1,0x81,0x66,0xc1,0x81,0xbc,0xc1,0x82,0x2,0xc1,0x82,0x48,0xc1,0x82,0x8e,0xc1,0x82,0xd8,0xc1,0x83,0x2a,0xc1,0x83,0x74,0xc1,0x83,0xd2,0xc1,0x84,0x28,0xc1,0x84,0x72,0xc1,0x84,0x74,0xc1,0x84,0xcc,0xc1,0x85,0x6,0xc1,0x85,0x70,0xc1,0x85,0xd2,0xc1,0x85,0xda,0xc1,0x86,0x2e,0xc1,0x86,0x68,0xc1,0x86,0xd0,0xc1,0x87,0x30,0xc1,0x87,0x38,0xc1,0x87,0x6a,0xc1,0x87,0xa4,0xc1,0x88,0xe,0xc1,0x88,0x42,0xc1,0x88,0xac,0xc1,0x88,0xb0,0xc1,0x88,0xe0,0xc1,0x89,0x1a,0xc1,0x89,0x82,0xc1,0x89,0xb6,0xc1,0x8a,0x1e,0xc1,0x8a,0x22,0xc1,0x8a,0x58,0xc1,0x8a,0x92,0xc1,0x8b,0x0,0xc1,0x8b,0x4e,0xc1,0x8b,0x52,0xc1,0x8b,0xa0,0xc1,0x8b,0xea,0xc1,0x8c,0x40,0xc1,0x8c,0x42,0xc1,0x8d,0x0,0xc1,0x8d,0x2c,0xc1,0x8d,0x66,0xc1,0x8d,0xce,0xc1,0x8d,0xf6,0xc1,0x8e,0x5a,0xc1,0x8e,0x78,0xc1,0x8e,0x7c,0xc1,0x8e,0x7e,0xc1,0x8f,0x42,0xc1,0x8f,0x74,0xc1,0x8f,0xae,0xc1,0x90,0x1c,0xc1,0x90,0x96,0xc1,0x90,0xb6,0xc1,0x90,0xba,0xc1,0x90,0xbc,0xc1,0x91,0x18,0xc1,0x91,0x80,0xc1,0x91,0x82,0xc1,0x91,0xe6,0xc1,0x92,0x3a,0xc1,0x92,0x96,0xc1,0x92,0xe2,0xc1,0x93,0x2a,0xc1,0x93,0x76,0xc1,0x93,0xca,0xc1,0x94,0x1e,0xc1,0x94,0xe6,0xc1,0x95,0x38,0xc1,0x95,0x9e,0xc1,0x96,0x0,0xc1,0x96,0x6e,0xc1,0x96,0xdc,0xc1,0x97,0x24,0xc1,0x97,0x6c,0xc1,0x97,0xb4,0xc1,0x98,0x0,0xc1,0x98,0x54,0xc1,0x98,0xa0,0xc1,0x99,0x14,0xc1,0x99,0x6c,0xc1,0x99,0xb8,0xc1,0x99,0xba,0xc1,0x9a,0x12,0xc1,0x9a,0x66,0xc1,0x9a,0xc6,0xc1,0x9a,0xc8,0xc1,0x9a,0xfe,0xc1,0x9b,0x3c,0xc1,0x9b,0xec,0xc1,0x9b,0xee,0xc1,0x9c,0x44,0xc1,0x9c,0xaa,0xc1,0x9d,0x12,0xc1,0x9d,0x48,0xc1,0x9d,0x7c,0xc1,0x9d,0xa0,0xc1,0x9d,0xce,0xc1,0x9e,0x22,0xc1,0x9e,0x84,0xc1,0x9e,0xaa,0xc1,0x9e,0xc6,0xc1,0x9f,0x26,0xc1,0x9f,0x64,0xc1,0x9f,0xdc,0xc1,0xa0,0x4,0xc1,0xa0,0x32,0xc1,0xa0,0x38,0xc1,0xa0,0x7e,0xc1,0xa0,0xb2,0xc1,0xa0,0xd6,0xc1,0xa1,0x4,0xc1,0xa1,0x58,0xc1,0xa1,0xa4,0xc1,0xa2,0x14,0xc1,0xa2,0x42,0xc1,0xa2,0x66,0xc1,0xa2,0xc4,0xc1,0xa3,0xa,0xc1,0xa3,0x8a,0xc1,0xa3,0xba,0xc1,0xa3,0xe8,0xc1,0xa3,0xee,0xc1,0xa3,0xf0,0xc1,0xa4,0x14,0xc1,0xa4,0x76,0xc1,0xa4,0xa4,0xc1,0xa4,0xc4,0xc1,0xa5,0x10,0xc1,0xa5,0x44,0xc1,0xa5,0x66,0xc1,0xa5,0x68,0xc1,0xa5,0xd4,0xc1,0xa5,0xd6,0xc1,0xa5,0xfa,0xc1,0xa6,0x48,0xc1,0xa6,0x7c,0xc1,0xa6,0xb2,0xc1,0xa6,0xe2,0xc1,0xa7,0x38,0xc1,0xa7,0x6a,0xc1,0xa7,0x6c,0xc1,0xa7,0xb4,0xc1,0xa7,0xfe,0xc1,0xa8,0x4a,0xc1,0xa8,0x9a,0xc1,0xa9,0xe,0xc1,0xa9,0x9e,0xc1,0xa9,0xa0,0xc1,0xa9,0xc6,0xc1,0xaa,0x14,0xc1,0xaa,0x4a,0xc1,0xaa,0x7c,0xc1,0xaa,0x7e,0xc1,0xaa,0xda,0xc1,0xab,0x38,0xc1,0xab,0x98,0xc1,0xac,0xc,0xc1,0xac,0xe,0xc1,0xac,0x3e,0xc1,0xac,0x6e,0xc1,0xac,0x70,0xc1,0xac,0x84,0xc1,0xad,0x20,0xc1,0xad,0x48,0xc1,0xad,0x4a,0xc1,0xad,0xa6,0xc1,0xae,0x74,0xc1,0xaf,0x34,0xc1,0xaf,0x58,0xc1,0xaf,0xb4,0xc1,0xaf,0xf0,0xc1,0xb0,0x26,0xc1,0xb0,0x38,0xc1,0xb0,0x7a,0xc1,0xb0,0x94,0xc1,0xb0,0xc6,0xc1,0xb1,0x58,0xc1,0xb1,0xb2,0xc1,0xb2,0x10,0xc1,0xb2,0x7c,0xc1,0xb2,0x90,0xc1,0xb2,0xa4,0xc1,0xb3,0x10,0xc1,0xb3,0x56,0xc1,0xb4,0x30,0xc1,0xb4,0xc8,0xc1,0xb5,0x2,0xc1,0xb5,0x2e,0xc1,0xb5,0xe4,0xc1,0xb6,0x5a,0xc1,0xb6,0x6e,0xc1,0xb6,0x72,0xc1,0xb6,0x74,0xc1,0xb6,0x88,0xc1,0xb6,0x8a,0xc1,0xb6,0xa6,0xc1,0xb6,0xe0,0xc1,0xb7,0x58,0xc1,0xb7,0x5a,0xc1,0xb7,0x8e,0xc1,0xb7,0xb0,0xc1,0xb7,0xdc,0xc1,0xb8,0x3a,0xc1,0xb8,0x66,0xc1,0xb8,0x94,0xc1,0xb8,0xbc,0xc1,0xb8,0xdc,0xc1,0xb9,0x6,0xc1,0xb9,0x74,0xc1,0xb9,0xe0,0xc1,0xb9,0xe2,0xc1,0xb9,0xe4,0xc1,0xba,0x1a,0xc1,0xba,0x4e,0xc1,0xba,0x50,0xc1,0xba,0x7c,0xc1,0xbb,0x4a,0xc1,0xbb,0x4c,0xc1,0xbb,0x96,0xc1,0xbb,0xc4,0xc1,0xbb,0xc6,0xc1,0xbc,0x2e,0xc1,0xbc,0x74,0xc1,0xbc,0x8e,0xc1,0xbc,0xc8,0xc1,0xbd,0x52,0xc1,0xbd,0x8c,0xc1,0xbd,0xc0,0xc1,0xbe,0x4a,0xc1,0xbe,0x6a,0xc1,0xbe,0x6c,0xc1,0xbe,0xbc,0xc1,0xbe,0xbe,0xc1,0xbe,0xd8,0xc1,0xbf,0xc,0xc1,0xbf,0x3e,0xc1,0xbf,0x7a,0xc1,0xbf,0xb8,0xc1,0xc0,0x5e,0xc1,0xc0,0xb6,0xc1,0xc0,0xf6,0xc1,0xc1,0x4c,0xc1,0xc1,0xba,0xc1,0xc1,0xbe,0xc1,0xc1,0xc0,0xc1,0xc1,0xe6,0xc1,0xc2,0x12,0xc1,0xc2,0x3e,0xc1,0xc2,0x40,0xc1,0xc2,0xa4,0xc1,0xc3,0x8,0xc1,0xc3,0x42,0xc1,0xc3,0x44,0xc1,0xc3,0x52,0xc1,0xc3,0x84,0xc1,0xc3,0x9e,0xc1,0xc3,0xc0,0xc1,0xc3,0xc4,0xc1,0xc3,0xf0,0xc1,0xc3,0xf2,0xc1,0xc4,0x24,0xc1,0xc4,0x56,0xc1,0xc4,0x98,0xc1,0xc4,0xea,0xc1,0xc5,0x78,0xc1,0xc5,0xe6,0xc1,0xc6,0xb4,0xc1,0xc7,0x10,0xc1,0xc7,0xb0,0xc1,0xc7,0xea,0xc1,0xc8,0xba,0xc1,0xc9,0x4e,0xc1,0xc9,0x7e,0xc1,0xc9,0xcc,0xc1,0xca,0x2c,0xc1,0xca,0x46,0xc1,0xca,0x94,0xc1,0xcb,0x3a,0xc1,0xcb,0x74,0xc1,0xcc,0x3a,0xc1,0xcc,0xce,0xc1,0xcc,0xfe,0xc1,0xcd,0x4c,0xc1,0xcd,0xae,0xc1,0xcd,0xc8,0xc1,0xce,0x24,0xc1,0xce,0xcc,0xc1,0xcf,0x2,0xc1,0xcf,0x50,0xc1,0xcf,0x70,0xc1,0xcf,0xf4,0xc1,0xcf,0xf6,0xc1,0xd0,0x26,0xc1,0xd0,0x70,0xc1,0xd0,0x9e,0xc1,0xd0,0xdc,0xc1,0xd1,0x6,0xc1,0xd1,0x8,0xc1,0xd1,0xa,0xc1,0xd1,0x30,0xc1,0xd1,0x32,0xc1,0xd1,0xca,0xc1,0xd1,0xf8,0xc1,0xd3,0x20,0xc1,0xd4,0x3e,0xc1,0xd5,0x16,0xc1,0xd5,0xe4,0xc1,0xd5,0xe6,0xc1,0xd6,0xba,0xc1,0xd7,0x8,0xc1,0xd7,0xa,0xc1,0xd7,0x24,0xc1,0xd7,0x68,0xc1,0xd7,0x6a,0xc1,0xd7,0xbe,0xc1,0xd7,0xde,0xc1,0xd8,0x6c,0xc1,0xd8,0x6e,0xc1,0xd8,0xd8,0xc1,0xd9,0x3a,0xc1,0xd9,0x3c,0xc1,0xd9,0x5e,0xc1,0xd9,0xb6,0xc1,0xda,0x8e,0xc1,0xda,0x90,0xc1,0xda,0xbc,0xc1,0xda,0xbe,0xc1,0xdb,0x36,0xc1,0xdb,0x4a,0xc1,0xdb,0x4c,0xc1,0xdb,0xde,0xc1,0xdc,0x32,0xc1,0xdc,0x3c,0xe1,0x86,0x57,0xd2,0x90,0x44,0x90,0x45,0x90,0x46,0x90,0x47,0x90,0x48,0x90,0x49,0x85,0x11,0x90,0x4a,0x88,0x36,0x90,0x4b,0x90,0x4c,0x90,0x4d,0x90,0x4e,0x89,0x7d,0x8a,0x50,0x90,0x4f,0x90,0x50,0x90,0x51,0x90,0x52,0x90,0x53,0x90,0x54,0x90,0x55,0x90,0x56,0x90,0x57,0x90,0x58,0x90,0x59,0x90,0x7,0x90,0x5a,0x90,0x5b,0x90,0x5c,0x90,0x5d,0x90,0x5e,0x90,0x5f,0x90,0x60,0x90,0x61,0x90,0x62,0x90,0x63,0x90,0x64,0x90,0x65,0x90,0x66,0x90,0x67,0x90,0x68,0x90,0x69,0x90,0x6a,0x90,0x6b,0x90,0x6c,0x90,0x6d,0x90,0x6e,0x90,0x6f,0x90,0x70,0x90,0x71,0x90,0x72,0x90,0x73,0x90,0x74,0x90,0x75,0x90,0x76,0x90,0x77,0x90,0x78,0x90,0x79,0x90,0x7a,0x90,0x7b,0x90,0x7c,0x90,0x7d,0x90,0x7e,0x90,0x7f,0x91,0x0,0x91,0x1,0x91,0x2,0x91,0x3,0x91,0x4,0x91,0x5,0x91,0x6,0x91,0x7,0x91,0x8,0x91,0x9,0x91,0xa,0x91,0xb,0x91,0xc,0x91,0xd,0x91,0xe,0x91,0xf,0x91,0x10,0x91,0x11,0x91,0x12,0x91,0x13,0x91,0x14,0x91,0x15,0x91,0x16,0x91,0x17,0x91,0x18,0x91,0x19,0x91,0x1a,0x91,0x1b,0x91,0x1c,0x91,0x1d,0x91,0x1e,0x91,0x1f,0x91,0x20,0x91,0x21,0x91,0x22,0x91,0x23,0x91,0x24,0x91,0x25,0x91,0x26,0x91,0x27,0x91,0x28,0x91,0x29,0x91,0x2a,0x91,0x2b,0x91,0x2c,0x91,0x2d,0x91,0x2e,0x91,0x2f,0x91,0x30,0x91,0x31,0x91,0x32,0x91,0x33,0x91,0x34,0x91,0x35,0x91,0x36,0x91,0x37,0x91,0x38,0x91,0x39,0x91,0x3a,0x91,0x3b,0x91,0x3c,0x91,0x3d,0x91,0x3e,0x91,0x3f,0x91,0x40,0x91,0x41,0x91,0x42,0x91,0x43,0x91,0x44,0x91,0x45,0x91,0x46,0x91,0x47,0x91,0x48,0x91,0x49,0x91,0x4a,0x91,0x4b,0x91,0x4c,0x91,0x4d,0x91,0x4e,0x91,0x4f,0x91,0x50,0x91,0x51,0x91,0x52,0x91,0x53,0x91,0x54,0x91,0x55,0x91,0x56,0x91,0x57,0x91,0x58,0x91,0x59,0x91,0x5a,0x91,0x5b,0x91,0x5c,0x91,0x5d,0x91,0x5e,0x91,0x5f,0x91,0x60,0x91,0x61,0x91,0x62,0x91,0x63,0x91,0x64,0x91,0x65,0x91,0x66,0x91,0x67,0x91,0x68,0x91,0x69,0x91,0x6a,0x91,0x6b,0x91,0x6c,0x91,0x6d,0x91,0x6e,0x91,0x6f,0x91,0x70,0x91,0x71,0x91,0x72,0x91,0x73,0x91,0x74,0x91,0x75,0x91,0x76,0x91,0x77,0x91,0x78,0x91,0x79,0x91,0x7a,0x91,0x7b,0x91,0x7c,0x91,0x7d,0x91,0x7e,0x91,0x7f,0x92,0x0,0x92,0x1,0x92,0x2,0x92,0x3,0x92,0x4,0x92,0x5,0x92,0x6,0x92,0x7,0x92,0x8,0x92,0x9,0x92,0xa,0x92,0xb,0x92,0xc,0x92,0xd,0x92,0xe,0x92,0xf,0x92,0x10,0x92,0x11,0x92,0x12,0x92,0x13,0x92,0x14,0x92,0x15,0x92,0x16,0x92,0x17,0x92,0x18,0x92,0x19,0x92,0x1a,0x92,0x1b,0x92,0x1c,0x92,0x1d,0x92,0x1e,0x92,0x1f,0x92,0x20,0x92,0x21,0x92,0x22,0x92,0x23,0x92,0x24,0x92,0x25,0x92,0x26,0x92,0x27,0x92,0x28,0x92,0x29,0x92,0x2a,0x92,0x2b,0x92,0x2c,0x92,0x2d,0x92,0x2e,0x92,0x2f,0x92,0x30,0x92,0x31,0x92,0x32,0x92,0x33,0x92,0x34,0x92,0x35,0x92,0x36,0x92,0x37,0x92,0x38,0x92,0x39,0x92,0x3a,0x92,0x3b,0x92,0x3c,0x92,0x3d,0x92,0x3e,0x92,0x3f,0x92,0x40,0x92,0x41,0x92,0x42,0x92,0x43,0x92,0x44,0x92,0x45,0x92,0x46,0x92,0x47,0x92,0x48,0x92,0x49,0x92,0x4a,0x92,0x4b,0x92,0x4c,0x92,0x4d,0x92,0x4e,0x92,0x4f,0x92,0x50,0x92,0x51,0x92,0x52,0x92,0x53,0x92,0x54,0x92,0x55,0x92,0x56,0x92,0x57,0x92,0x58,0x92,0x59,0x92,0x5a,0x92,0x5b,0x92,0x5c,0x92,0x5d,0x92,0x5e,0x92,0x5f,0x92,0x60,0x92,0x61,0x92,0x62,0x92,0x63,0x92,0x64,0x92,0x65,0x92,0x66,0x92,0x67,0x92,0x68,0x92,0x69,0x92,0x6a,0x92,0x6b,0x92,0x6c,0x92,0x6d,0x92,0x6e,0x92,0x6f,0x92,0x70,0x92,0x71,0x92,0x72,0x92,0x73,0x92,0x74,0x92,0x75,0x92,0x76,0x92,0x77,0x92,0x78,0x92,0x79,0x92,0x7a,0x92,0x7b,0x92,0x7c,0x92,0x7d,0x92,0x7e,0x92,0x7f,0x93,0x0,0x93,0x1,0x93,0x2,0x93,0x3,0x93,0x4,0x93,0x5,0x93,0x6,0x93,0x7,0x93,0x8,0x93,0x9,0x93,0xa,0x93,0xb,0x93,0xc,0x93,0xd,0x93,0xe,0x93,0xf,0x93,0x10,0x93,0x11,0x93,0x12,0x93,0x13,0x93,0x14,0x93,0x15,0x93,0x16,0x93,0x17,0x93,0x18,0x93,0x19,0x93,0x1a,0x93,0x1b,0x93,0x1c,0x93,0x1d,0x93,0x1e,0x93,0x1f,0x93,0x20,0x93,0x21,0x93,0x22,0x93,0x23,0x93,0x24,0x93,0x25,0x93,0x26,0x93,0x27,0x93,0x28,0x93,0x29,0x93,0x2a,0x93,0x2b,0x93,0x2c,0x93,0x2d,0x93,0x2e,0x93,0x2f,0x93,0x30,0x93,0x31,0x93,0x32,0x93,0x33,0x93,0x34,0x93,0x35,0x93,0x36,0x93,0x37,0x93,0x38,0x93,0x39,0x93,0x3a,0x93,0x3b,0x93,0x3c,0x93,0x3d,0x93,0x3e,0x93,0x3f,0x93,0x40,0x93,0x41,0x93,0x42,0x93,0x43,0x93,0x44,0x93,0x45,0x93,0x46,0x93,0x47,0x93,0x48,0x93,0x49,0x93,0x4a,0x93,0x4b,0x93,0x4c,0x93,0x4d,0x93,0x4e,0x93,0x4f,0x93,0x50,0x93,0x51,0x93,0x52,0x93,0x53,0x93,0x54,0x93,0x55,0x93,0x56,0x93,0x57,0x93,0x58,0x93,0x59,0x93,0x5a,0x93,0x5b,0x93,0x5c,0x93,0x5d,0x93,0x5e,0x93,0x5f,0x93,0x60,0x93,0x61,0x93,0x62,0x93,0x63,0x93,0x64,0x93,0x65,0x93,0x66,0x93,0x67,0x93,0x68,0x93,0x69,0x93,0x6a,0x93,0x6b,0x93,0x6c,0x93,0x6d,0x93,0x6e,0x93,0x6f,0x93,0x70,0x93,0x71,0x93,0x72,0x93,0x73,0x93,0x74,0x93,0x75,0x93,0x76,0x93,0x77,0x93,0x78,0x93,0x79,0x93,0x7a,0x93,0x7b,0x93,0x7c,0x93,0x7d,0x93,0x7e,0x93,0x7f,0x94,0x0,0x94,0x1,0x94,0x2,0x94,0x3,0x94,0x4,0x94,0x5,0x94,0x6,0x94,0x7,0x94,0x8,0x94,0x9,0x94,0xa,0x94,0xb,0x94,0xc,0x94,0xd,0x94,0xe,0x94,0xf,0x94,0x10,0x94,0x11,0x94,0x12,0x94,0x13,0x94,0x14,0x94,0x15,0x94,0x16,0x94,0x17,0x94,0x18,0x94,0x19,0x94,0x1a,0x94,0x1b,0x94,0x1c,0x94,0x1d,0x94,0x1e,0x94,0x1f,0x94,0x20,0x94,0x21,0x94,0x22,0x94,0x23,0x94,0x24,0x94,0x25,0x94,0x26,0x94,0x27,0x94,0x28,0x94,0x29,0x94,0x2a,0x94,0x2b,0x94,0x2c,0x94,0x2d,0x94,0x2e,0x94,0x2f,0x94,0x30,0x94,0x31,0x94,0x32,0x94,0x33,0x94,0x34,0x94,0x35,0x94,0x36,0x94,0x37,0x94,0x38,0x94,0x39,0x94,0x3a,0x94,0x3b,0x94,0x3c,0x94,0x3d,0x94,0x3e,0x94,0x3f,0x94,0x40,0x94,0x41,0x94,0x42,0x94,0x43,0x94,0x44,0x94,0x45,0x94,0x46,0x94,0x47,0x94,0x48,0x94,0x49,0x94,0x4a,0x94,0x4b,0x94,0x4c,0x94,0x4d,0x94,0x4e,0x94,0x4f,0x94,0x50,0x94,0x51,0x94,0x52,0x94,0x53,0x94,0x54,0x94,0x55,0x94,0x56,0x94,0x57,0x94,0x58,0x94,0x59,0x94,0x5a,0x94,0x5b,0x94,0x5c,0x94,0x5d,0x94,0x5e,0x94,0x5f,0x94,0x60,0x94,0x61,0x94,0x62,0x94,0x63,0x94,0x64,0x94,0x65,0x94,0x66,0x94,0x67,0x94,0x68,0x94,0x69,0x94,0x6a,0x94,0x6b,0x94,0x6c,0x94,0x6d,0x94,0x6e,0x94,0x6f,0x94,0x70,0x94,0x71,0x94,0x72,0x94,0x73,0x94,0x74,0x94,0x75,0x94,0x76,0x94,0x77,0x94,0x78,0x94,0x79,0x94,0x7a,0x94,0x7b,0x94,0x7c,0x94,0x7d,0x94,0x7e,0x94,0x7f,0x95,0x0,0x95,0x1,0x95,0x2,0x95,0x3,0x95,0x4,0x95,0x5,0x95,0x6,0x95,0x7,0x95,0x8,0x95,0x9,0x95,0xa,0x95,0xb,0x95,0xc,0x95,0xd,0x95,0xe,0x95,0xf,0x95,0x10,0x95,0x11,0x95,0x12,0x95,0x13,0x95,0x14,0x95,0x15,0x95,0x16,0x95,0x17,0x95,0x18,0x95,0x19,0x95,0x1a,0x95,0x1b,0x95,0x1c,0x95,0x1d,0x95,0x1e,0x95,0x1f,0x95,0x20,0x95,0x21,0x95,0x22,0x95,0x23,0x95,0x24,0x95,0x25,0x95,0x26,0x95,0x27,0x95,0x28,0x95,0x29,0x95,0x2a,0x95,0x2b,0x95,0x2c,0x95,0x2d,0x95,0x2e,0x95,0x2f,0x95,0x30,0x95,0x31,0x95,0x32,0x95,0x33,0x95,0x34,0x95,0x35,0x95,0x36,0x95,0x37,0x95,0x38,0x95,0x39,0x95,0x3a,0x95,0x3b,0x95,0x3c,0x95,0x3d,0x95,0x3e,0x95,0x3f,0x95,0x40,0x95,0x41,0x95,0x42,0x95,0x43,0x95,0x44,0x95,0x45,0x95,0x46,0x95,0x47,0x95,0x48,0x95,0x49,0x95,0x4a,0x95,0x4b,0x95,0x4c,0x95,0x4d,0x95,0x4e,0x95,0x4f,0x95,0x50,0x95,0x51,0x95,0x52,0x95,0x53,0x95,0x54,0x95,0x55,0x95,0x56,0x95,0x57,0x95,0x58,0x95,0x59,0x95,0x5a,0x95,0x5b,0x95,0x5c,0x95,0x5d,0x95,0x5e,0x95,0x5f,0x95,0x60,0x95,0x61,0x95,0x62,0x95,0x63,0x95,0x64,0x95,0x65,0x95,0x66,0x95,0x67,0x95,0x68,0x95,0x69,0x95,0x6a,0x95,0x6b,0x95,0x6c,0x95,0x6d,0x95,0x6e,0x95,0x6f,0x95,0x70,0x95,0x71,0x95,0x72,0x95,0x73,0x95,0x74,0x95,0x75,0x95,0x76,0x95,0x77,0x95,0x78,0x95,0x79,0x95,0x7a,0x95,0x7b,0x95,0x7c,0x95,0x7d,0x95,0x7e,0x95,0x7f,0x96,0x0,0x96,0x1,0x96,0x2,0x96,0x3,0x96,0x4,0x96,0x5,0x96,0x6,0x96,0x7,0x96,0x8,0x96,0x9,0x96,0xa,0x96,0xb,0x96,0xc,0x96,0xd,0x96,0xe,0x96,0xf,0x96,0x10,0x96,0x11,0x96,0x12,0x96,0x13,0x96,0x14,0x96,0x15,0x96,0x16,0x96,0x17,0x96,0x18,0x96,0x19,0x96,0x1a,0x96,0x1b,0x96,0x1c,0x96,0x1d,0x96,0x1e,0x96,0x1f,0x96,0x20,0x96,0x21,0x96,0x22,0x96,0x23,0x96,0x24,0x96,0x25,0x96,0x26,0x96,0x27,0x96,0x28,0x96,0x29,0x96,0x2a,0x96,0x2b,0x96,0x2c,0x96,0x2d,0x96,0x2e,0x96,0x2f,0x96,0x30,0x96,0x31,0x96,0x32,0x96,0x33,0x96,0x34,0x96,0x35,0x96,0x36,0x96,0x37,0x96,0x38,0x96,0x39,0x96,0x3a,0x96,0x3b,0x96,0x3c,0x96,0x3d,0x96,0x3e,0x96,0x3f,0x96,0x40,0x96,0x41,0x96,0x42,0x96,0x43,0x96,0x44,0x96,0x45,0x96,0x46,0x96,0x47,0x96,0x48,0x96,0x49,0x96,0x4a,0x96,0x4b,0x96,0x4c,0x96,0x4d,0x96,0x4e,0x96,0x4f,0x96,0x50,0x96,0x51,0x96,0x52,0x96,0x53,0x96,0x54,0x96,0x55,0x96,0x56,0x96,0x57,0x96,0x58,0x96,0x59,0x96,0x5a,0x96,0x5b,0x96,0x5c,0x96,0x5d,0x96,0x5e,0x96,0x5f,0x96,0x60,0x96,0x61,0x96,0x62,0x96,0x63,0x96,0x64,0x96,0x65,0x96,0x66,0x96,0x67,0x96,0x68,0x96,0x69,0x96,0x6a,0x96,0x6b,0x96,0x6c,0x96,0x6d,0x96,0x6e,0x96,0x6f,0x96,0x70,0x96,0x71,0x96,0x72,0x96,0x73,0x96,0x74,0x96,0x75,0x96,0x76,0x96,0x77,0x96,0x78,0x96,0x79,0x96,0x7a,0x96,0x7b,0x96,0x7c,0x96,0x7d,0x96,0x7e,0x96,0x7f,0x97,0x0,0x97,0x1,0x97,0x2,0x97,0x3,0x97,0x4,0x97,0x5,0x97,0x6,0x97,0x7,0x97,0x8,0x97,0x9,0x97,0xa,0x97,0xb,0x97,0xc,0x97,0xd,0x97,0xe,0x97,0xf,0x97,0x10,0x97,0x11,0x97,0x12,0x97,0x13,0x97,0x13,0xc1,0x3,0x86,0xc1,0x5,0x8,0xc1,0x6,0x5e,0xc1,0x6d,0xb4,0xc1,0x6d,0xbc,0xc1,0x6d,0xb6,0xc1,0x6e,0x4,0xc1,0x6e,0xc,0xc1,0x6e,0x6,0xc1,0x72,0xf2,0xc1,0x72,0xf4,0xc1,0x75,0x6e,0xc1,0x75,0x70,0xc1,0x76,0x56,0xc1,0x76,0x58,0xc1,0x76,0xa4,0xc1,0x76,0xa6,0xc1,0x76,0xee,0xc1,0x76,0xf0,0xc1,0x77,0x40,0xc1,0x77,0x48,0xc1,0x77,0x42,0xc1,0x77,0x8c,0xc1,0x77,0x94,0xc1,0x77,0x8e,0xc1,0x77,0xd8,0xc1,0x77,0xe0,0xc1,0x77,0xda,0xc1,0x78,0x20,0xc1,0x78,0x28,0xc1,0x78,0x22,0xc1,0x79,0x48,0xc1,0x79,0x4a,0xc1,0x7a,0x4e,0xc1,0x7a,0x50,0xc1,0x7b,0xae,0xc1,0x7b,0xb0,0xc1,0x7b,0xf8,0xc1,0x7b,0xfa,0xc1,0x7c,0x3e,0xc1,0x7c,0x40,0xc1,0x7c,0x88,0xc1,0x7c,0x8a,0xc1,0x7c,0xda,0xc1,0x7c,0xdc,0xc1,0x7d,0x2c,0xc1,0x7d,0x2e,0xc1,0x7d,0x82,0xc1,0x7d,0x84,0xc1,0x7d,0xc0,0xc1,0x7d,0xc8,0xc1,0x7d,0xc2,0xc1,0x7e,0x1c,0xc1,0x7e,0x24,0xc1,0x7e,0x1e,0xc1,0x7e,0x68,0xc1,0x7e,0x70,0xc1,0x7e,0x6a,0xc1,0x7e,0xbe,0xc1,0x7e,0xc0,0xc1,0x7f,0x18,0xc1,0x7f,0x1a,0xc1,0x7f,0x62,0xc1,0x7f,0x64,0xc1,0x7f,0xa8,0xc1,0x7f,0xaa,0xc1,0x7f,0xf2,0xc1,0x7f,0xf4,0xc1,0x80,0x44,0xc1,0x80,0x46,0xc1,0x80,0x96,0xc1,0x80,0x98,0xc1,0x80,0xe4,0xc1,0x80,0xe6,0xc1,0x81,0x2e,0xc1,0x81,0x30,0xc1,0x81,0x84,0xc1,0x81,0x86,0xc1,0x81,0xda,0xc1,0x81,0xdc,0xc1,0x82,0x20,0xc1,0x82,0x22,0xc1,0x82,0x66,0xc1,0x82,0x68,0xc1,0x82,0xac,0xc1,0x82,0xae,0xc1,0x82,0xf6,0xc1,0x82,0xf8,0xc1,0x83,0x48,0xc1,0x83,0x4a,0xc1,0x83,0x92,0xc1,0x83,0x94,0xc1,0x83,0xf0,0xc1,0x83,0xf2,0xc1,0x84,0x46,0xc1,0x84,0x48,0xc1,0x84,0x92,0xc1,0x84,0x94,0xc1,0x85,0xf8,0xc1,0x85,0xfa,0xc1,0x8b,0x62,0xc1,0x8b,0x64,0xc1,0x8b,0xb0,0xc1,0x8b,0xb2,0xc1,0x8b,0xfa,0xc1,0x8b,0xfc,0xc1,0x90,0xda,0xc1,0x90,0xdc,0xc1,0x91,0x36,0xc1,0x91,0x38,0xc1,0x92,0x4,0xc1,0x92,0x6,0xc1,0x92,0x58,0xc1,0x92,0x5a,0xc1,0x92,0xb4,0xc1,0x92,0xb6,0xc1,0x93,0x0,0xc1,0x93,0x2,0xc1,0x93,0x48,0xc1,0x93,0x4a,0xc1,0x93,0x94,0xc1,0x93,0x96,0xc1,0x93,0xe8,0xc1,0x93,0xea,0xc1,0x95,0x56,0xc1,0x95,0x58,0xc1,0x95,0x8a,0xc1,0x95,0x78,0xc1,0x95,0xbc,0xc1,0x95,0xbe,0xc1,0x95,0xee,0xc1,0x95,0xdc,0xc1,0x96,0x1e,0xc1,0x96,0x20,0xc1,0x96,0x56,0xc1,0x96,0x44,0xc1,0x96,0x8c,0xc1,0x96,0x8e,0xc1,0x96,0xc4,0xc1,0x96,0xb2,0xc1,0x96,0xfa,0xc1,0x96,0xfc,0xc1,0x97,0x42,0xc1,0x97,0x44,0xc1,0x97,0x8a,0xc1,0x97,0x8c,0xc1,0x97,0xd2,0xc1,0x97,0xd4,0xc1,0x98,0x1e,0xc1,0x98,0x20,0xc1,0x98,0x72,0xc1,0x98,0x74,0xc1,0x98,0xbe,0xc1,0x98,0xc0,0xc1,0x99,0x32,0xc1,0x99,0x34,0xc1,0x99,0x8a,0xc1,0x99,0x8c,0xc1,0x99,0xd8,0xc1,0x99,0xda,0xc1,0x9a,0x30,0xc1,0x9a,0x32,0xc1,0x9a,0x84,0xc1,0x9a,0x86,0xc1,0x9b,0xfe,0xc1,0x9c,0x0,0xc1,0x9c,0x54,0xc1,0x9c,0x56,0xc1,0x9c,0xba,0xc1,0x9c,0xbc,0xc1,0x9d,0x22,0xc1,0x9d,0x24,0xc1,0xa0,0x48,0xc1,0xa0,0x4a,0xc1,0xa5,0x76,0xc1,0xa5,0xb2,0xc1,0xa5,0xa0,0xc1,0xa5,0x7c,0xc1,0xa5,0x82,0xc1,0xa5,0x9a,0xc1,0xa5,0xb8,0xc1,0xa7,0x7a,0xc1,0xa7,0xa6,0xc1,0xa7,0x88,0xc1,0xa7,0xc2,0xc1,0xa7,0xf0,0xc1,0xa7,0xd0,0xc1,0xa8,0xc,0xc1,0xa8,0x3c,0xc1,0xa8,0x1a,0xc1,0xa8,0x58,0xc1,0xa8,0x8a,0xc1,0xa8,0x66,0xc1,0xa8,0xa8,0xc1,0xa8,0xec,0xc1,0xa8,0xb6,0xc1,0xa9,0x1c,0xc1,0xa9,0x70,0xc1,0xa9,0x2a,0xc1,0xaa,0x8c,0xc1,0xaa,0xba,0xc1,0xaa,0x9c,0xc1,0xaa,0xe8,0xc1,0xab,0x18,0xc1,0xaa,0xf8,0xc1,0xab,0x46,0xc1,0xab,0x78,0xc1,0xab,0x56,0xc1,0xab,0xa6,0xc1,0xab,0xec,0xc1,0xab,0xb6,0xc1,0xb6,0x92,0xc1,0xb7,0x62,0xc1,0xba,0x44,0xc1,0xba,0x3a,0xc1,0xbb,0x8,0xc1,0xba,0xf2,0xc1,0xba,0xb8,0xc1,0xba,0x92,0xc1,0xba,0x7e,0xc1,0xbb,0xba,0xc1,0xbb,0xac,0xc1,0xbe,0x7a,0xc1,0xbe,0xb0,0xc1,0xbe,0xa8,0xc1,0xbe,0x9e,0xc1,0xc2,0xc,0xc1,0xc1,0xf4,0xc1,0xc2,0x38,0xc1,0xc2,0x20,0xc1,0xc3,0xd2,0xc1,0xc3,0xd8,0xc1,0xd1,0x22,0xc1,0xd6,0xd8,0xc1,0xd6,0xda,0xc1,0xd7,0x12,0xc1,0xdb,0x3a,0xc1,0xdb,0xec,0xc1,0xdc,0x6,0xc1,0xdb,0xfc,0xc1,0xdc,0x18,0xc1,0xdc,0x22,0xe1,0x84,0x27,0x90,0x47,0x90,0x47,0x90,0x47,0x97,0x15,0x88,0x36,0x97,0x15,0x8a,0x1f,0x89,0x7d,0x8a,0x1f,0x97,0x16,0x90,0x52,0x97,0x16,0x97,0x17,0x90,0x59,0x97,0x17,0x97,0x18,0x93,0x78,0x97,0x19,0x97,0x1a,0x97,0x19,0x97,0x18,0x97,0x1b,0x93,0x79,0x97,0x1c,0x97,0x1d,0x97,0x1c,0x97,0x1b,0x97,0x1e,0x94,0xd,0x97,0x1f,0xc0,0xc0,0x97,0x1e,0x97,0x20,0x94,0x17,0x97,0x21,0xc0,0xc0,0x97,0x20,0x97,0x22,0x94,0x1c,0x97,0x23,0x97,0x22,0x97,0x24,0x94,0x1d,0x97,0x25,0x97,0x24,0x97,0x26,0x94,0x1e,0x97,0x27,0x97,0x26,0x97,0x28,0x94,0x20,0x97,0x29,0x97,0x2a,0x97,0x29,0x97,0x28,0x97,0x2b,0x94,0x21,0x97,0x2c,0x97,0x2d,0x97,0x2c,0x97,0x2b,0x97,0x2e,0x94,0x22,0x97,0x2f,0x97,0x30,0x97,0x2f,0x97,0x2e,0x97,0x31,0x94,0x23,0x97,0x32,0x97,0x33,0x97,0x32,0x97,0x31,0x97,0x34,0x94,0x26,0x97,0x35,0x97,0x34,0x97,0x36,0x94,0x28,0x97,0x37,0xc0,0xc0,0x97,0x36,0x97,0x38,0x94,0x2e,0x97,0x39,0x97,0x38,0x97,0x3a,0x94,0x2f,0x97,0x3b,0x97,0x3a,0x97,0x3c,0x94,0x30,0x97,0x3d,0x97,0x3c,0x97,0x3e,0x94,0x31,0x97,0x3f,0x97,0x3e,0x97,0x40,0x94,0x32,0x97,0x41,0x97,0x40,0x97,0x42,0x94,0x33,0x97,0x43,0x97,0x42,0x97,0x44,0x94,0x34,0x97,0x45,0x97,0x44,0x97,0x46,0x94,0x36,0x97,0x47,0x97,0x48,0x97,0x47,0x97,0x46,0x97,0x49,0x94,0x37,0x97,0x4a,0x97,0x4b,0x97,0x4a,0x97,0x49,0x97,0x4c,0x94,0x38,0x97,0x4d,0x97,0x4e,0x97,0x4d,0x97,0x4c,0x97,0x4f,0x94,0x39,0x97,0x50,0x97,0x4f,0x97,0x51,0x94,0x3a,0x97,0x52,0x97,0x51,0x97,0x53,0x94,0x3b,0x97,0x54,0x97,0x53,0x97,0x55,0x94,0x3c,0x97,0x56,0x97,0x55,0x97,0x57,0x94,0x3d,0x97,0x58,0x97,0x57,0x97,0x59,0x94,0x3e,0x97,0x5a,0x97,0x59,0x97,0x5b,0x94,0x3f,0x97,0x5c,0x97,0x5b,0x97,0x5d,0x94,0x40,0x97,0x5e,0x97,0x5d,0x97,0x5f,0x94,0x41,0x97,0x60,0x97,0x5f,0x97,0x61,0x94,0x42,0x97,0x62,0x97,0x61,0x97,0x63,0x94,0x43,0x97,0x64,0x97,0x63,0x97,0x65,0x94,0x44,0x97,0x66,0x97,0x65,0x97,0x67,0x94,0x45,0x97,0x68,0x97,0x67,0x97,0x69,0x94,0x46,0x97,0x6a,0x97,0x69,0x97,0x6b,0x94,0x47,0x97,0x6c,0x97,0x6b,0x97,0x6d,0x94,0x48,0x97,0x6e,0x97,0x6d,0x97,0x6f,0x94,0x49,0x97,0x70,0x97,0x6f,0x97,0x71,0x94,0x4a,0x97,0x72,0x97,0x71,0x97,0x73,0x94,0x4b,0x97,0x74,0x97,0x73,0x97,0x75,0x94,0x4d,0x97,0x76,0xc0,0xc0,0x97,0x75,0x97,0x77,0x94,0x52,0x97,0x78,0xc0,0xc0,0x97,0x77,0x97,0x79,0x94,0x68,0x97,0x7a,0x97,0x79,0x97,0x7b,0x94,0x69,0x97,0x7c,0x97,0x7b,0x97,0x7d,0x94,0x6a,0x97,0x7e,0x97,0x7d,0x97,0x7f,0x94,0x7d,0x98,0x0,0x97,0x7f,0x98,0x1,0x94,0x7e,0x98,0x2,0x98,0x1,0x98,0x3,0x95,0x1,0x98,0x4,0x98,0x3,0x98,0x5,0x95,0x2,0x98,0x6,0x98,0x5,0x98,0x7,0x95,0x3,0x98,0x8,0x98,0x7,0x98,0x9,0x95,0x4,0x98,0xa,0x98,0x9,0x98,0xb,0x95,0x5,0x98,0xc,0x98,0xb,0x98,0xd,0x95,0x6,0x98,0xe,0x98,0xd,0x98,0xf,0x95,0x7,0x98,0x10,0x98,0xf,0x98,0x11,0x95,0xa,0x98,0x12,0x98,0x13,0x98,0x14,0x98,0x13,0x98,0x11,0x98,0x15,0x95,0xb,0x98,0x16,0x98,0x17,0x98,0x18,0x98,0x17,0x98,0x15,0x98,0x19,0x95,0xc,0x98,0x1a,0x98,0x1b,0x98,0x1c,0x98,0x1b,0x98,0x19,0x98,0x1d,0x95,0xd,0x98,0x1e,0x98,0x1f,0x98,0x20,0x98,0x1f,0x98,0x1d,0x98,0x21,0x95,0xe,0x98,0x22,0x98,0x21,0x98,0x23,0x95,0xf,0x98,0x24,0x98,0x23,0x98,0x25,0x95,0x10,0x98,0x26,0x98,0x25,0x98,0x27,0x95,0x11,0x98,0x28,0x98,0x27,0x98,0x29,0x95,0x12,0x98,0x2a,0x98,0x29,0x98,0x2b,0x95,0x13,0x98,0x2c,0x98,0x2b,0x98,0x2d,0x95,0x14,0x98,0x2e,0x98,0x2d,0x98,0x2f,0x95,0x15,0x98,0x30,0x98,0x2f,0x98,0x31,0x95,0x16,0x98,0x32,0x98,0x31,0x98,0x33,0x95,0x18,0x98,0x34,0x98,0x33,0x98,0x35,0x95,0x19,0x98,0x36,0x98,0x35,0x98,0x37,0x95,0x1a,0x98,0x38,0x98,0x37,0x98,0x39,0x95,0x20,0x98,0x3a,0x98,0x39,0x98,0x3b,0x95,0x21,0x98,0x3c,0x98,0x3b,0x98,0x3d,0x95,0x22,0x98,0x3e,0x98,0x3d,0x98,0x3f,0x95,0x23,0x98,0x40,0xc0,0xc0,0xc0,0x98,0x3f,0x98,0x41,0x95,0x31,0x98,0x42,0xc0,0xc0,0xc0,0x98,0x41,0x98,0x43,0x95,0x49,0x98,0x44,0x98,0x44,0x98,0x45,0x98,0x43,0x98,0x43,0x98,0x46,0x98,0x46,0x98,0x47,0x98,0x47,0x98,0x47,0x98,0x46,0x98,0x48,0x98,0x48,0x98,0x48,0x98,0x43,0x98,0x45,0x98,0x49,0x98,0x49,0x98,0x49,0x98,0x44,0x98,0x43,0x98,0x4a,0x95,0x53,0x98,0x4b,0x98,0x4b,0x98,0x4c,0x98,0x4c,0x98,0x4b,0x98,0x4a,0x98,0x4d,0x95,0x54,0x98,0x4e,0x98,0x4e,0x98,0x4f,0x98,0x4f,0x98,0x4e,0x98,0x4d,0x98,0x50,0x95,0x55,0x98,0x51,0x98,0x51,0x98,0x52,0x98,0x52,0x98,0x51,0x98,0x50,0x98,0x53,0x95,0x56,0x98,0x54,0x98,0x54,0x98,0x55,0x98,0x55,0x98,0x54,0x98,0x53,0x98,0x56,0x95,0x57,0x98,0x57,0x98,0x57,0x98,0x58,0x98,0x58,0x98,0x57,0x98,0x56,0x98,0x59,0x95,0x58,0x98,0x5a,0x98,0x5a,0x98,0x5b,0x98,0x5b,0x98,0x5a,0x98,0x59,0x98,0x5c,0x95,0x5f,0x98,0x5d,0x98,0x5d,0x98,0x5e,0x98,0x5e,0x98,0x5d,0x98,0x5c,0x98,0x5f,0x95,0x60,0x98,0x60,0x98,0x60,0x98,0x61,0x98,0x61,0x98,0x60,0x98,0x5f,0x98,0x62,0x95,0x61,0x98,0x63,0x98,0x63,0x98,0x64,0x98,0x64,0x98,0x63,0x98,0x62,0x98,0x65,0x95,0x62,0x98,0x66,0x98,0x66,0x98,0x67,0x98,0x67,0x98,0x66,0x98,0x65,0xc0,0xc0,0xc0,0x98,0x68,0x98,0x68,0x98,0x69,0x98,0x69,0x98,0x6a,0x98,0x6b,0x98,0x6a,0x98,0x6c,0x98,0x6d,0x98,0x6e,0x98,0x6e,0x98,0x6f,0x98,0x70,0x98,0x6f,0xc0,0xc0,0xc0,0xc0,0xc0,0x98,0x6e,0x98,0x6d,0x98,0x6c,0x98,0x71,0x98,0x72,0x98,0x71,0x98,0x73,0x96,0x2d,0x98,0x74,0x98,0x74,0x98,0x75,0x98,0x76,0x98,0x73,0x98,0x73,0x98,0x73,0x98,0x76,0x98,0x75,0x98,0x74,0x98,0x73,0xc0,0xc0,0x98,0x77,0x98,0x78,0x98,0x77,0x98,0x79,0x98,0x7a,0x98,0x79,0xc0,0xc0,0x98,0x7b,0x96,0x48,0x98,0x7c,0x98,0x7c,0x98,0x7c,0x98,0x7b,0x98,0x7d,0x98,0x7d,0x98,0x7e,0x96,0x7b,0x98,0x7f,0x98,0x7e,0x99,0x0,0x99,0x0,0xc0,0xc0,0xc0,0x99,0x1,0x99,0x1,0x99,0x2,0x99,0x2,0x99,0x3,0x99,0x4,0x99,0x5,0x99,0x6,0x99,0x6,0x99,0x5,0x99,0x3,0x68,0x90,0x43,0x97,0x14,0x7,0xc4,0x8,0xc1,0x9,0xc8,0xa,0xc3,0xb,0xc1,0xc,0x99,0x7,0xf,0xcd,0xe1,0x4e,0x2,0x3,0x4,0x1a,0x2d,0x2f,0x30,0x47,0x7e,0x7f,0x81,0xe,0x81,0x16,0x81,0x1e,0x81,0x1f,0x3e,0x81,0x2b,0x81,0x4b,0x82,0x1d,0x82,0x1e,0x82,0x77,0x82,0x79,0x82,0x7b,0x85,0x26,0x85,0x54,0x86,0x3,0x86,0x20,0x46,0x86,0x4a,0x86,0x4b,0x86,0x5f,0x87,0x27,0x87,0x43,0x87,0x61,0x88,0x2a,0x88,0x52,0x88,0x53,0x88,0x55,0x88,0x56,0x88,0x58,0x88,0x59,0x89,0x2,0x89,0xb,0x89,0xc,0x89,0x29,0x89,0x3a,0x89,0x4e,0x89,0x50,0x89,0x51,0x89,0x58,0x8a,0x3,0x8a,0x2f,0x8a,0x67,0x8a,0x6d,0x8b,0x3,0x8b,0x4,0x8b,0x5,0x8b,0x6,0x8b,0x29,0x8b,0x4a,0x8b,0x4b,0x87,0x62,0x8d,0x33,0x8d,0x35,0x8d,0x45,0x8d,0x46,0x8d,0x64,0x8d,0x69,0x8d,0x6a,0x8d,0x6c,0x8d,0x72,0x8d,0x73,0x8e,0x21,0x2e,0x8e,0x3c,0x8e,0x67,0x8f,0xd,0x90,0xb,0x90,0x34,0xe5,0x8f,0x4f,0x90,0x3b,0xc4,0x90,0x41,0x90,0x42,0x99,0x8,0xf1,0x1,0x1,0xc7,0x0,0xd0,0x19,0xd3,0xd0,0x2c,0xd1,0x0,0xe1,0x2,0xc7,0x4,0xc6,0x2e,0xcb,0x0,0xd3,0xd0,0x3d,0xd1,0x1,0xe1,0x2,0xc7,0x4,0xc6,0x3e,0xcb,0x1,0xd3,0xd0,0x45,0xd1,0x2,0xe1,0x2,0xc7,0x4,0xc6,0x46,0xcb,0x2,0xd3,0xd0,0x58,0xd1,0x3,0xe1,0x2,0xc7,0x4,0xc6,0x59,0xcb,0x3,0xd3,0xd0,0x6e,0xd1,0x4,0xd0,0x77,0xd1,0x5,0xd0,0x7d,0xd1,0x6,0xd0,0x81,0xd,0xd1,0x7,0xd0,0x81,0x15,0xd1,0x8,0xd0,0x81,0x1d,0xd1,0x9,0xd0,0x81,0x29,0xd1,0xa,0xd0,0x81,0x49,0xd1,0xb,0xd0,0x81,0x70,0xd1,0xc,0xd0,0x82,0x1c,0xd1,0xd,0xd0,0x82,0x44,0xd1,0xe,0xd0,0x82,0x67,0xd1,0xf,0xd0,0x82,0x76,0xd1,0x10,0xd0,0x83,0x37,0xd1,0x11,0xd0,0x83,0x46,0xd1,0x12,0xd0,0x83,0x6e,0xd1,0x13,0xd0,0x84,0x1a,0xd1,0x14,0xd0,0x84,0x40,0xd1,0x15,0xd0,0x84,0x70,0xd1,0x16,0xd0,0x85,0xc,0xd1,0x17,0xd0,0x85,0x25,0xd1,0x18,0xd0,0x85,0x33,0xd1,0x19,0xd0,0x85,0x53,0xd1,0x1a,0xd0,0x86,0x2,0xd1,0x1b,0xd0,0x86,0x14,0xd1,0x1c,0xd0,0x86,0x1d,0xd1,0x1d,0xd0,0x86,0x40,0xd1,0x1e,0xd0,0x86,0x49,0xd1,0x1f,0xd0,0x86,0x5e,0xd1,0x20,0xd0,0x86,0x75,0xd1,0x21,0xd0,0x86,0x7f,0xd1,0x22,0xd0,0x87,0x17,0xd1,0x23,0xd0,0x87,0x22,0xd1,0x24,0xd0,0x88,0x15,0xd1,0x25,0xd0,0x88,0x27,0xd1,0x26,0xd0,0x88,0x51,0xd1,0x27,0xe1,0x3,0xc7,0x22,0xe0,0x0,0xc7,0x23,0xc6,0x88,0x54,0xd3,0xc6,0x82,0x7a,0xcb,0x26,0xd3,0xe1,0x3,0xc7,0x22,0xe0,0x0,0xc7,0x23,0xc6,0x88,0x54,0xd3,0xc6,0x88,0x3a,0xcb,0x27,0xd3,0xd0,0x89,0x1,0xd1,0x28,0xd0,0x89,0xa,0xd1,0x29,0xe1,0x2,0xc7,0x29,0xc7,0x2a,0xe1,0x0,0xd0,0x89,0x28,0xd3,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2a,0xc6,0x82,0x7a,0xe1,0x0,0xd0,0x89,0x39,0xd3,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2a,0xc6,0x82,0x68,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2a,0xc6,0x83,0x14,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2a,0xc6,0x81,0x1f,0xcb,0xa,0xd3,0xe1,0x3,0xc7,0x22,0xe0,0x0,0xc7,0x2c,0xc6,0x88,0x54,0xd3,0xc6,0x87,0x28,0xcb,0xd,0xd3,0xe1,0x3,0xc7,0x22,0xe0,0x0,0xc7,0x2c,0xc6,0x88,0x54,0xd3,0xc6,0x82,0x68,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x22,0xe0,0x0,0xc7,0x2c,0xc6,0x88,0x54,0xd3,0xc6,0x83,0x14,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x22,0xe0,0x0,0xc7,0x2c,0xc6,0x88,0x54,0xd3,0xc6,0x81,0x1f,0xcb,0xa,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2a,0xc6,0x89,0x3b,0xcb,0x25,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2a,0xc6,0x89,0x3c,0xe1,0x0,0xd0,0x89,0x4d,0xd3,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2d,0xc6,0x82,0x68,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2d,0xc6,0x83,0x14,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2d,0xc6,0x87,0x28,0xcb,0xd,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2d,0xc6,0x83,0x38,0xcb,0xf,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2d,0xc6,0x89,0x4f,0xcb,0xe,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2d,0xc6,0x88,0x5a,0xcb,0x22,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2d,0xc6,0x88,0x5b,0xcb,0x23,0xd3,0xe1,0x3,0xc7,0x22,0xe0,0x0,0xc7,0x2e,0xc6,0x88,0x54,0xd3,0xc6,0x81,0x1f,0xcb,0xa,0xd3,0xe1,0x3,0xc7,0x22,0xe0,0x0,0xc7,0x2e,0xc6,0x88,0x54,0xd3,0xc6,0x82,0x68,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x22,0xe0,0x0,0xc7,0x2e,0xc6,0x88,0x54,0xd3,0xc6,0x83,0x14,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x81,0x1f,0xcb,0xa,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x82,0x68,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x83,0x14,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x87,0x28,0xcb,0xd,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x89,0x4f,0xcb,0xe,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x83,0x38,0xcb,0xf,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x89,0x52,0xcb,0x13,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x89,0x53,0xcb,0x14,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x89,0x54,0xcb,0x15,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x89,0x55,0xcb,0x16,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x81,0xf,0xcb,0x17,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x81,0x17,0xcb,0x18,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x85,0x27,0xcb,0x10,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x89,0x56,0xcb,0x19,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x89,0x57,0xcb,0x1a,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x85,0x34,0xcb,0x1d,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x86,0x37,0xcb,0x1f,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x88,0x5a,0xcb,0x22,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x2f,0xc6,0x88,0x5b,0xcb,0x23,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x30,0xc6,0x82,0x68,0xe1,0x0,0xd0,0x89,0x6f,0xd3,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x30,0xc6,0x83,0x14,0xe1,0x0,0xd0,0x8a,0x2,0xd3,0xd3,0xd0,0x8a,0x1a,0xd1,0x2a,0xd0,0x8a,0x2d,0xd1,0x2b,0xd0,0x8a,0x3d,0xd1,0x2c,0xe1,0x3,0xc7,0x22,0xc7,0x31,0xc6,0x82,0x68,0xcb,0x2a,0xd3,0xe1,0x3,0xc7,0x22,0xc7,0x31,0xc6,0x83,0x14,0xcb,0x2b,0xd3,0xe1,0x3,0xc7,0x22,0xc7,0x31,0xc6,0x89,0x4f,0xcb,0x2c,0xd3,0xd0,0x8a,0x52,0xd1,0x2d,0xd0,0x8a,0x65,0xd1,0x2e,0xe1,0x3,0xc7,0x2b,0xc7,0x32,0xc6,0x83,0x14,0xcb,0x2d,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x32,0xc6,0x89,0x4f,0xcb,0x2e,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x8a,0x66,0xcb,0x24,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x81,0x1f,0xcb,0xa,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x82,0x68,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x83,0x14,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x87,0x28,0xcb,0xd,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x89,0x4f,0xcb,0xe,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x83,0x38,0xcb,0xf,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x89,0x52,0xe1,0x1,0xc7,0x33,0xcb,0x13,0xd3,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x89,0x53,0xe1,0x1,0xc7,0x33,0xcb,0x14,0xd3,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x89,0x54,0xe1,0x1,0xc7,0x33,0xcb,0x15,0xd3,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x89,0x55,0xe1,0x1,0xc7,0x33,0xcb,0x16,0xd3,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x81,0xf,0xcb,0x17,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x81,0x17,0xcb,0x18,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x85,0x27,0xcb,0x10,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x89,0x56,0xcb,0x19,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x89,0x57,0xcb,0x1a,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x85,0x34,0xcb,0x1d,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x86,0x37,0xd0,0x8a,0x6c,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x88,0x5a,0xcb,0x22,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x10,0xc6,0x88,0x5b,0xcb,0x23,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x34,0xc6,0x82,0x68,0xcb,0xb,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x34,0xc6,0x83,0x14,0xcb,0xc,0xd3,0xe1,0x3,0xc7,0x2b,0xc7,0x34,0xc6,0x83,0x38,0xcb,0xf,0xd3,0xd0,0x8b,0x2,0xd1,0x2f,0xe1,0x3,0xc7,0x22,0xc7,0x35,0xc6,0x5f,0xcb,0x2f,0xd3,0xe1,0x3,0xc7,0x22,0xc7,0x36,0xc6,0x5f,0xcb,0x2f,0xd3,0xe1,0x3,0xc7,0x22,0xc7,0x37,0xc6,0x5f,0xcb,0x2f,0xd3,0xe1,0x3,0xc7,0x22,0xc7,0x35,0xc6,0x8a,0x72,0xe1,0x5,0xc7,0x38,0xc6,0x8b,0x7,0xc6,0x47,0xd0,0x8b,0xd,0xc6,0x6,0xd0,0x8b,0x28,0xd3,0xd3,0xe1,0x3,0xc7,0x22,0xc7,0x39,0xc6,0x8a,0x72,0xe1,0x5,0xc7,0x38,0xc6,0x8b,0x7,0xc6,0x47,0xd0,0x8b,0x2f,0xc6,0x6,0xd0,0x8b,0x49,0xd3,0xd3,0xd0,0x8b,0x61,0xd1,0x30,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe0,0x0,0xe1,0x4,0xc7,0x11,0xc4,0x1,0xe1,0x2,0xc7,0x11,0xc4,0x2,0xe1,0x0,0xc7,0x11,0xd3,0xd3,0xc6,0x8b,0x62,0xe1,0x0,0xc7,0x11,0xd3,0xd3,0xc6,0x88,0x5a,0xd3,0xe1,0x3,0xc7,0x11,0xc4,0x1,0xc4,0x2,0xc6,0x8b,0x62,0xd3,0xd3,0xc6,0x8b,0x63,0xd3,0xd0,0x8b,0x7d,0xd1,0x31,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x1,0xcb,0x31,0xc6,0x8b,0x7e,0xd3,0xc6,0x8b,0x67,0xd3,0xc6,0x8b,0x7f,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x1,0xcb,0x31,0xc6,0x8c,0x0,0xd3,0xc6,0x8b,0x66,0xd3,0xc6,0x8c,0x1,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x1,0xcb,0x31,0xc6,0x8c,0x2,0xd3,0xc6,0x8b,0x67,0xd3,0xc6,0x8c,0x3,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x1,0xcb,0x31,0xc6,0x8c,0x4,0xd3,0xc6,0x8c,0x5,0xd3,0xc6,0x8c,0x6,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x1,0xcb,0x31,0xc6,0x8c,0x7,0xd3,0xc6,0x8c,0x8,0xd3,0xc6,0x8c,0x9,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x1,0xcb,0x31,0xc6,0x8c,0xa,0xd3,0xc6,0x8c,0xb,0xd3,0xc6,0x8c,0xc,0xd3,0xd0,0x8c,0x17,0xd1,0x32,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x1,0xcb,0x32,0xc6,0x8b,0x7e,0xd3,0xc6,0x8b,0x7e,0xd3,0xc6,0x8c,0x18,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x1,0xcb,0x32,0xc6,0x8c,0x0,0xd3,0xc6,0x8b,0x7e,0xd3,0xc6,0x8c,0x19,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x1,0xcb,0x32,0xc6,0x8c,0x2,0xd3,0xc6,0x8b,0x7e,0xd3,0xc6,0x8c,0x1a,0xd3,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe1,0x1,0xcb,0x32,0xc6,0x8c,0x7,0xd3,0xc6,0x8b,0x7e,0xd3,0xc6,0x8c,0x1b,0xd3,0xd0,0x8c,0x21,0xd1,0x33,0xd0,0x8c,0x26,0xd1,0x34,0xd0,0x8c,0x39,0xd1,0x35,0xe1,0x3,0xc7,0x38,0xc6,0x8c,0x3a,0xc6,0x81,0x4c,0xd0,0x8c,0x78,0xd3,0xd1,0x36,0xf1,0x2,0x8c,0x79,0xcb,0x35,0xc6,0x89,0x3b,0xd0,0x8d,0xc,0xd3,0xf1,0x2,0x8c,0x79,0xcb,0x35,0xc6,0x8d,0xd,0xd0,0x8d,0x32,0xd3,0xe0,0x0,0xc7,0x10,0xc6,0x81,0x4c,0xd3,0xd1,0x37,0xf0,0x1,0x1,0xe0,0x1,0xe1,0x2,0xc7,0xe,0xe1,0x1,0xc7,0x3d,0xc6,0x8d,0x34,0xd3,0xe1,0x2,0xc7,0x2,0xe1,0x0,0xd0,0x8d,0x3c,0xd3,0xc6,0x8d,0x3d,0xd3,0xd3,0xc6,0x89,0x3b,0xc6,0x8b,0x12,0xd3,0xc6,0x82,0x68,0xd0,0x8d,0x44,0xd3,0xe0,0x0,0xc7,0x32,0xc6,0x81,0x4c,0xd3,0xd1,0x38,0xd0,0x8d,0x61,0xd1,0x39,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xe0,0x1,0xe0,0x0,0xe1,0x4,0xc7,0x11,0xc6,0x8d,0x62,0xc4,0x13,0xc4,0xa,0xc6,0x88,0x3e,0xd3,0xc6,0x85,0x34,0xd3,0xc6,0x1b,0xc4,0x1,0xd3,0xc4,0xa,0xd3,0xc6,0x8d,0x63,0xd3,0xe1,0x0,0xd0,0x8e,0x13,0xd3,0xd1,0x3a,0xe1,0x0,0xc7,0x41,0xd3,0xd1,0x3b,0xe1,0x0,0xc7,0x41,0xd3,0xd1,0x3c,0xe1,0x0,0xd0,0x8e,0x1f,0xd3,0xd1,0x3d,0xf1,0x2,0x86,0x1f,0xc7,0x19,0xe1,0x2,0xc7,0x8,0xcb,0x3d,0xc6,0x8e,0x14,0xd3,0xc6,0x8e,0x20,0xd3,0xd0,0x8f,0x33,0xd1,0x3e,0xd0,0x8f,0x41,0xd1,0x3f,0xe1,0x1,0xcb,0x3f,0xc6,0x8f,0x42,0xd3,0xd1,0x40,0xd0,0x90,0x0,0xd1,0x41,0xe1,0x3,0xc7,0x2b,0xc7,0x2a,0xc6,0x90,0x1,0xcb,0x41,0xd3,0xf1,0x2,0x8c,0x79,0xcb,0x35,0xc6,0x90,0x1,0xd0,0x90,0x9,0xd3,0xd0,0x90,0x33,0xd1,0x42,0xe1,0x1,0xc7,0x4d,0xd0,0x90,0x39,0xd3,0xd1,0x43,0xe0,0x0,0xcb,0x40,0xc6,0x90,0x3a,0xd3,0xe0,0x0,0xcb,0x43,0xc6,0x8c,0x49,0xd3,0xdd,0x0,0x7,0xc3,0xe1,0x1,0xc7,0x1,0xe1,0x1,0xcb,0x29,0xe0,0x0,0xcb,0x43,0xc6,0x8c,0x49,0xd3,0xd3,0xd3,0xdb,0x0,0x7,0xc4,0xc2,0xc2,0x0,};
+const int modules_init_len = 33374;
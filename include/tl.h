@@ -30,8 +30,9 @@
 #ifndef _lqueue_h_
 typedef struct lqentry lqentry;
 typedef struct lqueue lqueue;
+typedef struct lqnode lqnode;
 struct lqentry { lqentry* next; };
-struct lqueue { lqentry* head; lqentry* tail; };
+struct lqueue { lqnode* head; lqnode* tail; };
 #endif
 
 // all values are tagged pointers, memory based values are aligned to 8 bytes, so 3 tag bits
@@ -68,6 +69,7 @@ static const tlHandle tlIntMin = (tlHead*)((int64_t)0x8000000000000001);
 #define TL_MIN_INT ((int64_t)0xC000000000000000)
 #endif
 
+// on 64 bit, most floats are encoded directly into the pointer, ending with 0b110 (see tlFLOAT)
 // mini strings are 7 (or 3) byte chars encode directly into the pointer, ending with 0b010
 // symbols are tlString* tagged with 0b100 and address > 1024
 // so we use values tagged with 0b100 and < 1024 to encode some special values
@@ -107,12 +109,15 @@ static inline bool tlSymIs_(tlHandle v) { return ((intptr_t)v & 7) == 4 && (intp
 static inline tlSym tlSymAs_(tlHandle v) { assert(tlSymIs_(v)); return (tlSym)v; }
 static inline tlSym tlSymCast_(tlHandle v) { return tlSymIs_(v)?tlSymAs_(v):0; }
 
+static inline bool tlFloatImmediateIs_(tlHandle v) { return ((intptr_t)v & 7) == 6; }
+
 static inline tlHead* tl_head(tlHandle v) { assert(tlRefIs(v)); return (tlHead*)v; }
 
 extern tlKind* tlIntKind;
 extern tlKind* tlSymKind;
 extern tlKind* tlNullKind;
 extern tlKind* tlBoolKind;
+extern tlKind* tlFloatKind;
 
 static inline intptr_t get_kptr(tlHandle v) { return ((tlHead*)v)->kind; }
 
@@ -120,6 +125,7 @@ static inline tlKind* tl_kind(tlHandle v) {
     if (tlRefIs(v)) return (tlKind*)(get_kptr(v) & ~0x7);
     if (tlIntIs(v)) return tlIntKind;
     if (tlSymIs_(v)) return tlSymKind;
+    if (tlFloatImmediateIs_(v)) return tlFloatKind;
     switch ((intptr_t)v) {
         case TL_NULL: return tlNullKind;
         case TL_FALSE: return tlBoolKind;
@@ -200,6 +206,7 @@ TL_REF_TYPE(tlDebugger);
 TL_REF_TYPE(tlBModule);
 
 TL_REF_TYPE(tlQueue);
+TL_REF_TYPE(tlFuture);
 
 bool tlCallableIs(tlHandle v);
 
@@ -419,12 +426,22 @@ tlNative* tlNativeNew(tlNativeCb cb, tlSym name);
 // bulk create native functions and globals (don't overuse these)
 typedef struct { const char* name; tlNativeCb cb; } tlNativeCbs;
 void tl_register_natives(const tlNativeCbs* cbs);
+void tl_register_nocapture_natives(const tlNativeCbs* cbs);
 void tl_register_global(const char* name, tlHandle v);
 
 // task management
 tlTask* tlTaskNew(tlVm* vm, tlObject* locals);
 tlVm* tlTaskGetVm(tlTask* task);
 
+// futures, a value to wait for, completed once by native code or any task
+tlFuture* tlFutureNew();
+bool tlFutureIsDone(tlFuture* future);
+// return false if the future was already completed
+bool tlFutureResolve(tlFuture* future, tlHandle value);
+bool tlFutureReject(tlFuture* future, tlHandle error);
+// might put the task to waiting, returning null, handle with care
+tlHandle tlFutureWait(tlFuture* future, tlTask* task);
+
 // task internals ... cleanup?
 tlTask* tlTaskFromEntry(lqentry* entry);
 lqentry* tlTaskGetEntry(tlTask* task);
@@ -574,12 +591,10 @@ struct tlKind {
 };
 
 // any non-value object will have to be protected from concurrent access
-// NOTE: if we keep all tasks in a global list, we can use 32 (16) bits for the task, and 32 bits as queue
-//       there was a paper about that; collapses 3 pointers into one and has better behavior
+// the lock is thin, just the owning task; once contended, owner becomes a heavy lock, see lock.c
 struct tlLock {
     intptr_t kind;
-    tlTask* owner;
-    lqueue wait_q;
+    tlHandle owner;
 };
 
 // any hotel "operation" can be paused and resumed
@@ -635,7 +650,9 @@ tlQueue* tlQueueNew(int buffersize);
 void tlQueueClose(tlQueue* queue);
 // using these queue methods might put the passed in task to waiting, handle with care
 tlHandle tlQueueAdd(tlQueue* queue, tlTask* task, tlArgs* args);
+tlHandle tlQueueAddAll(tlQueue* queue, tlTask* task, tlList* values);
 tlHandle tlQueueGet(tlQueue* queue, tlTask* task);
+tlHandle tlQueueGetMany(tlQueue* queue, tlTask* task, int max);
 tlHandle tlQueuePoll(tlQueue* queue, tlTask* task);
 
 // ** running code **
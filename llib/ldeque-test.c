@@ -0,0 +1,59 @@
+#include "ldeque.h"
+#include <pthread.h>
+#include <unistd.h>
+#include <sched.h>
+#include <stdbool.h>
+
+#define HAVE_DEBUG
+
+#include "debug.h"
+
+static ldeque d;
+
+#define COUNT 100000
+#define THIEVES 3
+
+static int seen[COUNT];
+static int done;
+
+static void take(long i) {
+    if (__atomic_add_fetch(&seen[i], 1, __ATOMIC_SEQ_CST) != 1) fatal("taken twice: %ld", i);
+}
+
+void * thief(void *data) {
+    long stolen = 0;
+    while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE) || ldeque_size(&d) > 0) {
+        void* v = ldeque_steal(&d);
+        if (!v) { sched_yield(); continue; }
+        take((long)v - 1);
+        stolen++;
+    }
+    print("thief: stole %ld", stolen);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    ldeque_init(&d);
+
+    pthread_t thieves[THIEVES];
+    for (int i = 0; i < THIEVES; i++) pthread_create(&thieves[i], 0, thief, 0);
+
+    // owner pushes in bursts, so the deque grows, and pops some back
+    long popped = 0;
+    for (long i = 0; i < COUNT; i++) {
+        ldeque_push(&d, (void*)(i + 1));
+        if (i % 7 == 0) {
+            void* v = ldeque_pop(&d);
+            if (v) { take((long)v - 1); popped++; }
+        }
+    }
+    void* v;
+    while ((v = ldeque_pop(&d))) { take((long)v - 1); popped++; }
+    __atomic_store_n(&done, 1, __ATOMIC_RELEASE);
+    print("owner: popped %ld", popped);
+
+    for (int i = 0; i < THIEVES; i++) pthread_join(thieves[i], 0);
+    for (long i = 0; i < COUNT; i++) if (seen[i] != 1) fatal("lost: %ld", i);
+    print("ok");
+    return 0;
+}
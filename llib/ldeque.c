@@ -0,0 +1,92 @@
+// ** a work stealing deque **
+//
+// author: Onne Gorter <onne@onnlucky.com>
+//
+// Following "Correct and Efficient Work-Stealing for Weak Memory Models" by
+// Lê, Pop, Cohen and Zappa Nardelli, which puts the fences into the
+// Chase-Lev deque.
+//
+// The owner pushes and pops at bottom, thieves take from top. Only when a
+// single item is left do the owner and thieves race for it, using a cas on
+// top. Top only ever grows, so there is no ABA problem.
+//
+// When full, the owner copies the items into an array twice the size. A
+// thief might still be reading from the old array, so it is never freed;
+// this implies the use of something like a gc.
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+
+#include "ldeque.h"
+
+#define LDEQUE_FIRST 64
+
+struct ldequearray { long size; void* data[]; };
+
+static ldequearray* ldequearray_new(long size) {
+    ldequearray* a = malloc(sizeof(ldequearray) + sizeof(void*) * size);
+    a->size = size;
+    return a;
+}
+
+ldeque* ldeque_init(ldeque* d) {
+    d->top = 0;
+    d->bottom = 0;
+    d->array = ldequearray_new(LDEQUE_FIRST);
+    return d;
+}
+
+static ldequearray* grow(ldeque* d, ldequearray* a, long t, long b) {
+    ldequearray* n = ldequearray_new(a->size * 2);
+    for (long i = t; i < b; i++) n->data[i & (n->size - 1)] = a->data[i & (a->size - 1)];
+    __atomic_store_n(&d->array, n, __ATOMIC_RELEASE);
+    return n;
+}
+
+void ldeque_push(ldeque* d, void* v) {
+    long b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED);
+    long t = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+    ldequearray* a = __atomic_load_n(&d->array, __ATOMIC_RELAXED);
+    if (b - t > a->size - 1) a = grow(d, a, t, b);
+    __atomic_store_n(&a->data[b & (a->size - 1)], v, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+}
+
+void* ldeque_pop(ldeque* d) {
+    long b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED) - 1;
+    ldequearray* a = __atomic_load_n(&d->array, __ATOMIC_RELAXED);
+    __atomic_store_n(&d->bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    long t = __atomic_load_n(&d->top, __ATOMIC_RELAXED);
+
+    if (t > b) {                             // empty
+        __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+        return 0;
+    }
+    void* v = __atomic_load_n(&a->data[b & (a->size - 1)], __ATOMIC_RELAXED);
+    if (t == b) {                            // last item, race the thieves for it
+        if (!__atomic_compare_exchange_n(&d->top, &t, t + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) v = 0;
+        __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+    return v;
+}
+
+void* ldeque_steal(ldeque* d) {
+    long t = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    long b = __atomic_load_n(&d->bottom, __ATOMIC_ACQUIRE);
+    if (t >= b) return 0;
+
+    ldequearray* a = __atomic_load_n(&d->array, __ATOMIC_ACQUIRE);
+    void* v = __atomic_load_n(&a->data[t & (a->size - 1)], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&d->top, &t, t + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) return 0;
+    return v;
+}
+
+long ldeque_size(ldeque* d) {
+    long b = __atomic_load_n(&d->bottom, __ATOMIC_ACQUIRE);
+    long t = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+    return b > t? b - t : 0;
+}
+
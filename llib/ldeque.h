@@ -0,0 +1,32 @@
+#ifndef _ldeque_h_
+#define _ldeque_h_
+
+/// a work stealing deque (Chase-Lev)
+///
+/// A single owner thread pushes and pops at the bottom, any other thread can
+/// steal from the top. Only the owner may call @ldeque_push and @ldeque_pop.
+typedef struct ldeque ldeque;
+
+/// the array holding the items, it grows as needed; old arrays are not freed, a gc reclaims them
+typedef struct ldequearray ldequearray;
+
+/// the implementation of a deque, is given so it can be embedded in larger structs
+struct ldeque { long top; long bottom; ldequearray* array; };
+
+/// Initialize a deque; zeroing is not good enough.
+ldeque* ldeque_init(ldeque* d);
+
+/// Push an item at the bottom, owner only. The item may not be null.
+void ldeque_push(ldeque* d, void* v);
+
+/// Pop the item pushed last, owner only. Null if the deque is empty.
+void* ldeque_pop(ldeque* d);
+
+/// Steal the item pushed first, any thread. Null if the deque is empty or
+/// another thread took the item first.
+void* ldeque_steal(ldeque* d);
+
+/// Rough number of items in the deque, any thread.
+long ldeque_size(ldeque* d);
+
+#endif
@@ -1,6 +1,9 @@
+#define _GNU_SOURCE
 #include "lqueue.h"
 #include <pthread.h>
 #include <unistd.h>
+#include <sched.h>
+#include <time.h>
 
 #define HAVE_DEBUG
 
@@ -10,60 +13,104 @@ static lqueue *q;
 
 struct count {
     lqentry entry;
+    int writer;
     int i;
 };
 
-#define COUNT 10000
+#define COUNT 100000
+#define WRITERS 3
+#define READERS 3
 
+static int total;
+
+static struct count* count_new(int writer, int i) {
+    struct count *c = malloc(sizeof(struct count));
+    lqentry_init((lqentry *)c);
+    c->writer = writer;
+    c->i = i;
+    return c;
+}
+
+// every reader must see the entries of a single writer in the order they were put
 void * reader(void *data) {
-    for (int i = 0; i < 3 * COUNT; i++) {
-        if (i % 73 == 0) usleep(5000);
-        struct count *c;
-        int yielded = 0;
-        while ((c = (struct count *)lqueue_get(q)) == 0) {
-            if (yielded++ == 0) print("reader: yield");
-            //assert(yielded < 10000000);
-            yielded++;
-            sched_yield();
+    int last[WRITERS];
+    for (int w = 0; w < WRITERS; w++) last[w] = -1;
+
+    while (__atomic_load_n(&total, __ATOMIC_ACQUIRE) < WRITERS * COUNT) {
+        struct count *c = (struct count *)lqueue_get_many(q, 1 + (long)data % 4);
+        if (!c) { sched_yield(); continue; }
+        while (c) {
+            struct count *next = (struct count *)c->entry.next;
+            if (c->i <= last[c->writer]) fatal("not fifo: writer %d: %d after %d", c->writer, c->i, last[c->writer]);
+            last[c->writer] = c->i;
+            __atomic_add_fetch(&total, 1, __ATOMIC_ACQ_REL);
+            c = next;
         }
-
-        print("reading: %d", c->i);
-        //assert(c->i == i);
     }
     return 0;
 }
 
+// writers put single entries and chains
 void * writer(void *data) {
-    for (int i = 0; i < COUNT; i++) {
-        print("writing: %d", i);
+    int w = (int)(long)data;
+    for (int i = 0; i < COUNT;) {
+        if (i % 5 == 0 && i + 3 <= COUNT) {
+            struct count *a = count_new(w, i++);
+            struct count *b = count_new(w, i++);
+            struct count *c = count_new(w, i++);
+            a->entry.next = &b->entry;
+            b->entry.next = &c->entry;
+            lqueue_put_many(q, &a->entry);
+        } else {
+            lqueue_put(q, &count_new(w, i++)->entry);
+        }
+    }
+    return 0;
+}
 
-        if (i % 33 == 0) usleep(5000);
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+#define BENCH 200000
 
-        struct count *c = malloc(sizeof(struct count));
-        lqentry_init((lqentry *)c);
-        c->i = i;
-        lqueue_put(q, (lqentry *)c);
+// every thread puts an entry and gets one, like workers passing tasks around
+void * bench(void *data) {
+    struct count *cs = malloc(sizeof(struct count) * 64);
+    for (int i = 0; i < 64; i++) lqueue_put(q, lqentry_init(&cs[i].entry));
+    for (int i = 0; i < BENCH; i++) {
+        lqentry* e;
+        while (!(e = lqueue_get(q))) sched_yield();
+        lqueue_put(q, e);
     }
     return 0;
 }
 
 int main(int argc, char **argv) {
-    if (1 == 0) fatal("oeps");
-
     q = lqueue_new();
-
-    pthread_t treader;
-    pthread_create(&treader, 0, reader, 0);
-
-    pthread_t twriter1;
-    pthread_create(&twriter1, 0, writer, 0);
-    pthread_t twriter2;
-    pthread_create(&twriter2, 0, writer, 0);
-    pthread_t twriter3;
-    pthread_create(&twriter3, 0, writer, 0);
-
-    pthread_join(treader, 0);
-
+    if (lqueue_get(q) || lqueue_peek(q) || lqueue_get_many(q, 10)) fatal("not empty");
+
+    pthread_t threads[WRITERS + READERS];
+    for (int i = 0; i < READERS; i++) pthread_create(&threads[i], 0, reader, (void*)(long)i);
+    for (int i = 0; i < WRITERS; i++) pthread_create(&threads[READERS + i], 0, writer, (void*)(long)i);
+    for (int i = 0; i < WRITERS + READERS; i++) pthread_join(threads[i], 0);
+    if (total != WRITERS * COUNT) fatal("lost: %d", WRITERS * COUNT - total);
+    if (lqueue_get(q)) fatal("not empty");
+    print("ok");
+
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int max = argc > 1? atoi(argv[1]) : (cores > 4? cores : 4);
+    for (int n = 1; n <= max; n++) {
+        q = lqueue_new();
+        pthread_t threads[n];
+        double start = now();
+        for (int i = 0; i < n; i++) pthread_create(&threads[i], 0, bench, 0);
+        for (int i = 0; i < n; i++) pthread_join(threads[i], 0);
+        double took = now() - start;
+        print("threads: %d, ops/sec: %.0f", n, 2.0 * BENCH * n / took);
+    }
     return 0;
 }
 
@@ -2,44 +2,44 @@
 //
 // author: Onne Gorter <onne@onnlucky.com>
 //
-// Notice the queue->head and entry->next pointers are authorative.
-// The queue->tail pointer is just a cache and may point to random entries;
-// this implies the use of something like a gc.
+// Following "Simple, Fast, and Practical Non-Blocking and Blocking Concurrent
+// Queue Algorithms" by Michael and Scott.
 //
+// The queue is a linked list of nodes, head always points to a dummy node, the
+// entries are in the nodes after it. Put links a node after the last node
+// using a cas on its next, get moves head to the next node using a cas on
+// head, that node becomes the new dummy. The tail pointer might lag behind,
+// any thread that notices moves it forward. So the queue is linearizable, and
+// strictly fifo.
 //
-// Notice it might appear there is an ABA problem, but there is not. If a
-// thread tries to find the real tail, but is stalled for a long time, the tail
-// it finds might be an entry about to be put in the queue again. Adding as the
-// next element to this entry is ok, since it will be put in the queue.
+// Nodes are never reused or freed, a stalled thread might still be looking at
+// them, so there is no ABA problem; this implies the use of something like a
+// gc.
 //
-// However, if this second thread is stalled for a long time too, unable to put
-// its two sized entry in the queue. And our first thread inserts yet another
-// entry. Now this second entry might appear in the queue before the first.
-// This is a breach of the fifo contract. So this is a mostly fifo queue.
+// Entries are not linked directly, like they were, because an entry that was
+// just taken would be the dummy node, and could not be put in a queue again
+// until another get moved head past it.
 //
-// A possible solution is to hold on to the previous element too, and disalow
-// longer sized chains. But then tail should point to second to last element.
-// And a zero or one sized queue is special.
-// Never re-using entries is another way.
-// Another solution is to use a thread local variable that verifies:
-// if (tls_last_entry->next == owner(q) && tls_last_entry != tail) goto retry;
-//
-// TODO investigate using the queue as a special node to remove some spacial
-// cases of empty list
-// TODO add memory barriers and explicit load where needed
+// A zeroed queue has no dummy node yet, the first put installs it. Once head
+// and tail are set, they are never null again.
 
 #define _GNU_SOURCE
 #include <stdlib.h>
 
-#include <atomic_ops.h>
 #include "lqueue.h"
 
-#ifndef UNUSED
-#define UNUSED(x) (void)x
-#endif
+struct lqnode { lqnode* next; lqentry* entry; };
+
+static lqnode* lqnode_new(lqentry* e) {
+    lqnode* n = malloc(sizeof(lqnode));
+    n->next = 0;
+    n->entry = e;
+    return n;
+}
 
-static int lqueue_cas(void* addr, const void* nval, const void* oval) {
-    return AO_compare_and_swap(addr, (AO_t)oval, (AO_t)nval);
+static lqnode* load(lqnode** at) { return __atomic_load_n(at, __ATOMIC_ACQUIRE); }
+static int cas(lqnode** at, lqnode* old, lqnode* nval) {
+    return __atomic_compare_exchange_n(at, &old, nval, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
 }
 
 
@@ -51,66 +51,97 @@ lqueue* lqueue_init(lqueue* q) { q->head = 0; q->tail = 0; return q; }
 lqentry* lqentry_new() { return lqentry_init(malloc(sizeof(lqentry))); }
 lqueue* lqueue_new() { return lqueue_init(malloc(sizeof(lqueue))); }
 
-// TODO add volatile
-static lqentry* load(lqentry* i) { return i; }
-static lqentry* owner(lqueue* q) { return (lqentry* )q; }
-
-void lqueue_put(lqueue* q, lqentry* e) {
-    assert(q); assert(e); assert(e->next == 0);
+// install the dummy node if the queue has none yet
+static lqnode* tail(lqueue* q) {
+    lqnode* t = load(&q->tail);
+    if (t) return t;
+    lqnode* h = load(&q->head);
+    if (!h) {
+        lqnode* d = lqnode_new(0);
+        if (!cas(&q->head, 0, d)) d = load(&q->head);
+        h = d;
+    }
+    // no node can be put after the dummy before tail is set, so head cannot have moved yet
+    cas(&q->tail, 0, h);
+    return load(&q->tail);
+}
 
-    // make this node owned by the queue
-    e->next = owner(q);
+// link a chain of nodes after the last node
+static void put(lqueue* q, lqnode* first, lqnode* last) {
     while (1) {
-    retry:;
-        lqentry* h = load(q->head);
-        if (h == 0) {                  // if the queue is empty
-            if (lqueue_cas(&q->head, e, 0)) { // try to update the head
-                q->tail = e;           // update the tail hint
-                return;
-            }
-            continue;                  // failed to update head; retry
+        lqnode* t = tail(q);
+        lqnode* n = load(&t->next);
+        if (t != load(&q->tail)) continue;  // tail moved, retry
+        if (n) {                            // tail is lagging, move it forward
+            cas(&q->tail, t, n);
+            continue;
+        }
+        if (cas(&t->next, 0, first)) {      // linked, now try to update tail
+            cas(&q->tail, t, last);
+            return;
         }
+    }
+}
 
-        lqentry* t = load(q->tail);
-        if (t == 0) t = h;                  // if tail hint is obviously stale (and wrong)
+void lqueue_put(lqueue* q, lqentry* e) {
+    lqnode* n = lqnode_new(e);
+    put(q, n, n);
+}
+
+void lqueue_put_many(lqueue* q, lqentry* e) {
+    if (!e) return;
+    lqnode* first = lqnode_new(e);
+    lqnode* last = first;
+    for (e = e->next; e; e = e->next) {
+        last->next = lqnode_new(e);
+        last = last->next;
+    }
+    put(q, first, last);
+}
 
-        while (t->next != owner(q)) {       // try to get to the real tail
-            t = t->next;
-            if (t == 0) goto retry;         //continue; invalid tail hint
-            if (t == owner(q)) goto retry;  //continue; invalid tail hint
+lqentry* lqueue_get_many(lqueue* q, int max) {
+    if (max <= 0) return 0;
+    while (1) {
+        lqnode* h = load(&q->head);
+        if (!h) return 0;                   // no dummy yet, so empty
+        lqnode* t = load(&q->tail);
+        lqnode* n = load(&h->next);
+        if (h != load(&q->head)) continue;  // head moved, retry
+        if (!n) return 0;                   // empty
+        if (h == t) {                       // tail is lagging, move it forward
+            cas(&q->tail, t, n);
+            continue;
         }
 
-        if (lqueue_cas(&t->next, e, owner(q))) {   // try to update the last node
-            q->tail = e;                    // update the tail hint
-            return;
+        // find the last node to take, never move head past tail
+        lqnode* last = n;
+        for (int i = 1; i < max && last != t; i++) {
+            lqnode* next = load(&last->next);
+            if (!next) break;
+            last = next;
+        }
+        if (!cas(&q->head, h, last)) continue;
+
+        // we own the entries now; nodes never change, and last is the new dummy
+        lqentry* first = n->entry;
+        lqentry* e = first;
+        for (lqnode* at = n; at != last; at = at->next) {
+            e->next = at->next->entry;
+            e = e->next;
         }
+        e->next = 0;
+        return first;
     }
 }
 
 lqentry* lqueue_get(lqueue* q) {
-    while (1) {
-        lqentry* h = load(q->head);
-        if (h == 0) return 0;
-
-        // there are actually items in the queue
-        lqentry* n = h->next;
-        if (lqueue_cas(&h->next, 0, n)) {           // take ownership of head node
-            if (n == owner(q)) {             // if it is a single element queue
-                int res = lqueue_cas(&q->head, 0, h); // update head to zero; we have ownership so it must succeed
-                UNUSED(res);
-                assert(res);
-                q->tail = 0;                 // update tail to zero too
-            } else {
-                int res = lqueue_cas(&q->head, n, h); // advance head to next; we have ownership so it must succeed
-                UNUSED(res);
-                assert(res);
-            }
-            return h;
-        }
-    }
+    return lqueue_get_many(q, 1);
 }
 
 lqentry* lqueue_peek(lqueue* q) {
-    return load(q->head);
+    lqnode* h = load(&q->head);
+    if (!h) return 0;
+    lqnode* n = load(&h->next);
+    return n? n->entry : 0;
 }
 
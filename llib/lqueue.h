@@ -7,11 +7,15 @@ typedef struct lqentry lqentry;
 /// the type of a queue
 typedef struct lqueue lqueue;
 
-/// the implementation of an entry, is given so it can be embedded in larger structs
+/// the queue links entries using nodes, it allocates a node per entry put in the queue
+typedef struct lqnode lqnode;
+
+/// the implementation of an entry, is given so it can be embedded in larger structs; next links
+/// entries into a chain for @lqueue_put_many and @lqueue_get_many, the queue does not use it
 struct lqentry { lqentry* next; };
 
 /// the implementation of a queue, is given so it can be embedded in larger structs
-struct lqueue { lqentry* head; lqentry* tail; };
+struct lqueue { lqnode* head; lqnode* tail; };
 
 /// Create a new entry; it is likely more useful to embed the @lqentry in a
 /// larger struct and use @lqentry_init instead.
@@ -30,9 +34,17 @@ lqueue* lqueue_init(lqueue* q);
 /// queue.
 void lqueue_put(lqueue* q, lqentry* i);
 
+/// Add a chain of entries, linked through their next field, to the queue. The
+/// entries will be next to each other in the queue, in the order of the chain.
+void lqueue_put_many(lqueue* q, lqentry* first);
+
 /// Get the first entry of the queue. Null if no entries exist for this queue.
 lqentry* lqueue_get(lqueue* q);
 
+/// Get up to max entries from the front of the queue, as a chain linked
+/// through their next field, in queue order. Null if no entries exist for this queue.
+lqentry* lqueue_get_many(lqueue* q, int max);
+
 /// Get the first entry of the queue, but not remove it. Null if no entries exist for this queue.
 lqentry* lqueue_peek(lqueue* q);
 
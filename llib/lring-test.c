@@ -0,0 +1,66 @@
+#define _GNU_SOURCE
+#include "lring.h"
+#include <pthread.h>
+#include <sched.h>
+
+#define HAVE_DEBUG
+
+#include "debug.h"
+
+static lring r;
+
+#define COUNT 100000
+#define WRITERS 3
+#define READERS 3
+#define SIZE 7
+
+static int total;
+static int seen[WRITERS][COUNT];
+
+// every reader must see the items of a single writer in the order they were put
+void * reader(void *data) {
+    int last[WRITERS];
+    for (int w = 0; w < WRITERS; w++) last[w] = -1;
+
+    while (__atomic_load_n(&total, __ATOMIC_ACQUIRE) < WRITERS * COUNT) {
+        long v = (long)lring_get(&r);
+        if (!v) { sched_yield(); continue; }
+        v -= 1;
+        int w = v / COUNT, i = v % COUNT;
+        if (i <= last[w]) fatal("not fifo: writer %d: %d after %d", w, i, last[w]);
+        last[w] = i;
+        if (__atomic_add_fetch(&seen[w][i], 1, __ATOMIC_SEQ_CST) != 1) fatal("taken twice: %d %d", w, i);
+        __atomic_add_fetch(&total, 1, __ATOMIC_ACQ_REL);
+    }
+    return 0;
+}
+
+void * writer(void *data) {
+    long w = (long)data;
+    for (long i = 0; i < COUNT; i++) {
+        while (!lring_put(&r, (void*)(w * COUNT + i + 1))) sched_yield();
+        if (lring_count(&r) > SIZE) fatal("overfull: %ld", lring_count(&r));
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    lring_init(&r, 0);
+    if (lring_put(&r, (void*)1) || lring_get(&r)) fatal("size 0 not full and empty");
+
+    lring_init(&r, 3);
+    for (long i = 1; i <= 3; i++) if (!lring_put(&r, (void*)i)) fatal("full too soon");
+    if (lring_put(&r, (void*)4)) fatal("not full");
+    for (long i = 1; i <= 3; i++) if ((long)lring_get(&r) != i) fatal("not fifo");
+    if (lring_get(&r)) fatal("not empty");
+
+    lring_init(&r, SIZE);
+    pthread_t threads[WRITERS + READERS];
+    for (int i = 0; i < READERS; i++) pthread_create(&threads[i], 0, reader, 0);
+    for (int i = 0; i < WRITERS; i++) pthread_create(&threads[READERS + i], 0, writer, (void*)(long)i);
+    for (int i = 0; i < WRITERS + READERS; i++) pthread_join(threads[i], 0);
+    if (total != WRITERS * COUNT) fatal("lost: %d", WRITERS * COUNT - total);
+    if (lring_get(&r)) fatal("not empty");
+    print("ok");
+    return 0;
+}
@@ -0,0 +1,88 @@
+// ** a bounded lock free ring buffer **
+//
+// author: Onne Gorter <onne@onnlucky.com>
+//
+// Following Dmitry Vyukov's "Bounded MPMC queue".
+//
+// Every cell has a sequence number. A cell at position pos is free to put
+// into when its sequence is pos, and ready to get from when it is pos + 1.
+// Putting and getting claim a position with a cas on tail or head, and then
+// publish the cell by updating its sequence. After a get, the sequence becomes
+// pos + size, which is the position that cell will be put into next. So the
+// sequences stay correct for any size, not only powers of two.
+//
+// A thread that claimed a position but did not yet publish the cell, stalls
+// threads that want that same cell; the ring looks full or empty to them.
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+
+#include "lring.h"
+
+struct lringcell { long seq; void* v; };
+
+static long loadseq(long* at) { return __atomic_load_n(at, __ATOMIC_ACQUIRE); }
+static void storeseq(long* at, long v) { __atomic_store_n(at, v, __ATOMIC_RELEASE); }
+static int claim(long* at, long old, long nval) {
+    return __atomic_compare_exchange_n(at, &old, nval, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+lring* lring_init(lring* r, long size) {
+    r->size = size;
+    r->head = 0;
+    r->tail = 0;
+    r->cells = 0;
+    if (size <= 0) return r;
+    r->cells = malloc(sizeof(lringcell) * size);
+    for (long i = 0; i < size; i++) {
+        r->cells[i].seq = i;
+        r->cells[i].v = 0;
+    }
+    return r;
+}
+
+int lring_put(lring* r, void* v) {
+    if (r->size <= 0) return 0;
+    long pos = __atomic_load_n(&r->tail, __ATOMIC_RELAXED);
+    while (1) {
+        lringcell* cell = &r->cells[pos % r->size];
+        long dif = loadseq(&cell->seq) - pos;
+        if (dif == 0) {
+            if (claim(&r->tail, pos, pos + 1)) {
+                cell->v = v;
+                storeseq(&cell->seq, pos + 1);
+                return 1;
+            }
+        } else if (dif < 0) {
+            return 0;                        // full
+        }
+        pos = __atomic_load_n(&r->tail, __ATOMIC_RELAXED);
+    }
+}
+
+void* lring_get(lring* r) {
+    if (r->size <= 0) return 0;
+    long pos = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+    while (1) {
+        lringcell* cell = &r->cells[pos % r->size];
+        long dif = loadseq(&cell->seq) - (pos + 1);
+        if (dif == 0) {
+            if (claim(&r->head, pos, pos + 1)) {
+                void* v = cell->v;
+                cell->v = 0;
+                storeseq(&cell->seq, pos + r->size);
+                return v;
+            }
+        } else if (dif < 0) {
+            return 0;                        // empty
+        }
+        pos = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+    }
+}
+
+long lring_count(lring* r) {
+    long t = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+    long h = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+    return t > h? t - h : 0;
+}
+
@@ -0,0 +1,31 @@
+#ifndef _lring_h_
+#define _lring_h_
+
+/// a bounded lock free fifo ring buffer (Vyukov)
+///
+/// Any thread can put and get. The ring holds at most size items, a ring of
+/// size 0 is always full and always empty.
+typedef struct lring lring;
+
+/// a slot in the ring, with the sequence number telling whose turn it is
+typedef struct lringcell lringcell;
+
+/// the implementation of a ring, is given so it can be embedded in larger structs
+struct lring { long size; long head; long tail; lringcell* cells; };
+
+/// Initialize a ring holding at most size items; zeroing is not good enough,
+/// unless size is 0.
+lring* lring_init(lring* r, long size);
+
+/// Put an item at the end of the ring. The item may not be null. Returns 0
+/// if the ring is full.
+int lring_put(lring* r, void* v);
+
+/// Get the item at the front of the ring. Null if the ring is empty, or if
+/// the item at the front is still being put by another thread.
+void* lring_get(lring* r);
+
+/// Rough number of items in the ring.
+long lring_count(lring* r);
+
+#endif
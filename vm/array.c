@@ -7,6 +7,8 @@
 #include "array.h"
 
 #include "value.h"
+#include "native.h"
+#include "object.h"
 
 tlKind* tlArrayKind;
 
@@ -348,10 +350,14 @@ void array_init() {
         "addAll", null,
         "random", null,
         "each", null,
+        "peach", null,
         "map", null,
+        "pmap", null,
         "find", null,
         "filter", null,
+        "pfilter", null,
         "reduce", null,
+        "preduce", null,
         "min", null,
         "max", null,
         "sum", null,
@@ -366,6 +372,7 @@ void array_init() {
         "new", _Array_new,
         null
     ));
+    tlMethodsReadOnly(cls->methods, "toList", "size", "get", "call", "slice", "toChar", null);
     tlKind _tlArrayKind = {
         .name = "Array",
         .locked = true,
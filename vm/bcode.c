@@ -17,10 +17,14 @@
 #include "eval.h"
 #include "vm.h"
 #include "map.h"
+#include "set.h"
+#include "native.h"
+#include "jit.h"
 
 #include "../llib/lhashmap.h"
 
 static tlNative* g_goto_native;
+static tlNative* g_return_native;
 static tlNative* g_identity;
 static void unwindForGoto(tlTask* task, int deep, tlHandle value);
 static tlHandle resumeBCall(tlTask* task, tlFrame* frame, tlHandle res, tlHandle throw);
@@ -55,6 +59,9 @@ const char* op_name(uint8_t op) {
         case OP_EVGET: return "EVGET";
         case OP_EVSTORE: return "EVSTORE";
         case OP_EVRSTORE: return "EVRSTORE";
+        case OP_JUMP: return "JUMP";
+        case OP_JUMPT: return "JUMPT";
+        case OP_JUMPF: return "JUMPF";
         case OP_MCALL: return "MCALL";
         case OP_FCALL: return "FCALL";
         case OP_BCALL: return "BCALL";
@@ -73,7 +80,9 @@ static tlHandle resumeBFrame(tlTask* task, tlFrame* _frame, tlHandle res, tlHand
 tlDebugger* tlDebuggerFor(tlTask* task);
 bool tlDebuggerStep(tlDebugger* debugger, tlTask* task, tlCodeFrame* frame);
 
-enum { kCodeHasLazy = 1 };
+// kCodeNoEscape: the compiler found no closures are created over the locals, see tlCodeFrameNew
+// kCodeNoCapture: the compiler found the code uses nothing from outer scopes, so OP_BIND can reuse one closure
+enum { kCodeHasLazy = 1, kCodeNoEscape = 2, kCodeNoCapture = 4 };
 
 // against better judgement, modules are linked by mutating
 struct tlBModule {
@@ -151,13 +160,32 @@ tlString* tlBCodeName(tlBCode* code) {
     if (code->debuginfo) return code->debuginfo->name;
     return null;
 }
-tlBClosure* tlBClosureNew(tlBCode* code, tlEnv* env) {
-    tlBClosure* fn = tlAlloc(tlBClosureKind, sizeof(tlBClosure));
+// if env is the locals of a frame of outer, we can copy the display of outer, instead of walking the parents
+static tlBClosure* bclosureNew(tlBCode* code, tlEnv* env, tlBClosure* outer) {
+    int depth = 0;
+    if (outer && env && env->parent == outer->env) {
+        depth = 1 + outer->depth;
+    } else {
+        for (tlEnv* e = env; e; e = e->parent) depth++;
+    }
+    tlBClosure* fn = tlAlloc(tlBClosureKind, sizeof(tlBClosure) + sizeof(tlEnv*) * depth);
     fn->code = code;
     fn->env = env;
+    fn->depth = depth;
+    if (depth == 0) return fn;
+    fn->display[0] = env;
+    if (outer && env->parent == outer->env) {
+        memcpy(fn->display + 1, outer->display, sizeof(tlEnv*) * outer->depth);
+    } else {
+        for (int i = 1; i < depth; i++) fn->display[i] = fn->display[i - 1]->parent;
+    }
     return fn;
 }
 
+tlBClosure* tlBClosureNew(tlBCode* code, tlEnv* env) {
+    return bclosureNew(code, env, null);
+}
+
 bool tlCodeFrameIs(tlHandle v) {
     return tlFrameIs(v) && (tlFrameAs(v)->resumecb == resumeBFrame);
 }
@@ -170,10 +198,34 @@ tlCodeFrame* tlCodeFrameCast(tlHandle v) {
     return (tlCodeFrame*)v;
 }
 
-tlCodeFrame* tlCodeFrameNew(tlArgs* args, tlEnv* locals) {
+// frames for a task are allocated from its frame arena, and released when they return, see frame.c
+// without a task, like for frames handed out as values, they are allocated on the heap
+static void* code_frame_alloc(tlTask* task, size_t bytes) {
+    if (task) return tlFrameArenaAlloc(task, resumeBFrame, bytes);
+    return tlFrameAlloc(resumeBFrame, bytes);
+}
+
+tlCodeFrame* tlCodeFrameNew(tlTask* task, tlArgs* args, tlEnv* locals) {
     tlBClosure* closure = tlBClosureAs(args->fn);
     tlBCode* code = closure->code;
-    tlCodeFrame* frame = tlFrameAlloc(resumeBFrame, sizeof(tlCodeFrame) + sizeof(CallEntry) * code->calldepth);
+    size_t bytes = sizeof(tlCodeFrame) + sizeof(CallEntry) * code->calldepth;
+    if (!locals && tlflag_isset(code, kCodeNoEscape)) {
+        // store the locals in the frame, saving an allocation, unless they escape after all, see frame_locals_escape
+        tlCodeFrame* frame = code_frame_alloc(task, bytes + sizeof(tlEnv) + sizeof(tlHandle) * tlListSize(code->localnames));
+        tlEnv* env = (tlEnv*)((char*)frame + bytes);
+        set_kind(env, tlEnvKind);
+        env->names = code->localnames;
+        env->parent = closure->env;
+        env->args = args;
+        frame->locals = env;
+        frame->inlinelocals = true;
+        frame->callsize = code->calldepth;
+        frame->localsize = tlListSize(code->localnames);
+        return frame;
+    }
+    tlCodeFrame* frame = code_frame_alloc(task, bytes);
+    frame->callsize = code->calldepth;
+    frame->escaped = true;
     if (!locals) {
         frame->locals = tlEnvNew(code->localnames, closure->env);
         frame->locals->args = args;
@@ -187,6 +239,77 @@ tlEnv* tlCodeFrameEnv(tlFrame* frame) {
     return tlCodeFrameAs(frame)->locals;
 }
 
+// when locals stored in the frame are captured, like by a lazy argument, move them to the heap
+static tlEnv* frame_locals_escape(tlCodeFrame* frame) {
+    frame->escaped = true;
+    if (!frame->inlinelocals) return frame->locals;
+    tlEnv* inl = frame->locals;
+    tlEnv* env = tlEnvNew(inl->names, inl->parent);
+    env->args = inl->args;
+    env->link = inl->link;
+    env->imports = inl->imports;
+    memcpy(env->data, inl->data, sizeof(tlHandle) * tlListSize(inl->names));
+    frame->locals = env;
+    frame->inlinelocals = false;
+    return env;
+}
+
+// A call in tail position reuses the frame of its caller: the locals are reset for the callee and
+// evaluation starts over at pc 0, so recursion by goto or in tail position runs in constant space.
+// Returns false if the frame cannot be reused, the call is then invoked as usual.
+static bool frame_tailcall(tlTask* task, tlCodeFrame* frame, tlArgs* invoke, bool isgoto) {
+    if (frame->lazy || frame->bcall || frame->stepping || tlDebuggerFor(task)) return false;
+    // module bodies can run in frames handed out as values, like by eval, those keep their locals
+    tlBCode* current = tlBClosureAs(frame->locals->args->fn)->code;
+    if (current == current->mod->body) return false;
+    tlHandle fn = tlArgsFnInline(invoke);
+    if (!tlBClosureIs(fn)) return false;
+    tlBClosure* closure = tlBClosureAs(fn);
+    // blocks or lazies over the locals might still return to this frame, unless goto leaves it; a
+    // block over the locals itself is fine, a return from it unwinds this frame, see __return
+    if (frame->escaped && !isgoto && closure->env != frame->locals) return false;
+    tlHandle target = tlArgsTargetInline(invoke);
+    if (target && tl_kind(target)->locked) return false;
+    tlBCode* code = closure->code;
+    if (code->calldepth > frame->callsize) return false;
+    // yielding or running out of quota is left to tlInvoke
+    if (task->limit || tlTaskPreempted(task)) return false;
+
+    int size = tlListSize(code->localnames);
+    if (frame->inlinelocals && tlflag_isset(code, kCodeNoEscape) && size <= frame->localsize) {
+        tlEnv* env = frame->locals;
+        env->names = code->localnames;
+        env->parent = closure->env;
+        env->args = invoke;
+        env->link = null;
+        env->imports = null;
+        memset(env->data, 0, sizeof(tlHandle) * frame->localsize);
+    } else {
+        frame->locals = tlEnvNew(code->localnames, closure->env);
+        frame->locals->args = invoke;
+        frame->inlinelocals = false;
+    }
+    frame->escaped = !tlflag_isset(code, kCodeNoEscape);
+    frame->handler = null;
+    frame->invoke = null;
+    frame->pc = 0;
+    return true;
+}
+
+// if the op at pc ends the code, or jumps to its end
+static bool ends_code(const intptr_t* ops, int pc) {
+    if (ops[pc] == OP_JUMP) pc = ops[pc + 1];
+    return ops[pc] == OP_END;
+}
+
+// if the pending call is a return from, or goto out of, the function of frame, which an invoke completes
+// a return must stay in the frame if it has a handler, a goto leaves it before invoking
+static bool is_frame_exit(tlCodeFrame* frame, tlArgs* call) {
+    if (call->fn == g_return_native && frame->handler) return false;
+    if (call->fn != g_return_native && call->fn != g_goto_native) return false;
+    return tlArgsRawSizeInline(call) == 2 && tlArgsGet(call, 0) == tlZero;
+}
+
 tlBLazy* tlBLazyNew(tlArgs* args, tlEnv* locals, int pc) {
     assert(args);
     assert(pc > 0);
@@ -210,33 +333,95 @@ tlBSendToken* tlBSendTokenNew(tlSym method, bool safe) {
     return token;
 }
 
-// TODO instead of argspec as list, do this "raw"
-// TODO speed this up by using an index of sorts
-static int findNamedArg(tlBCode* code, tlSym name) {
-    if (!name) return -1;
-    int size = tlListSize(code->argspec);
-    for (int i = 0; i < size; i++) {
-        tlHandle spec = tlListGet(code->argspec, i);
-        assert(spec);
-        if (spec == tlNull) continue;
-        if (name == tlListGet(tlListAs(spec), 0)) return i; // 0=name 1=default 2=lazy
-    }
-    return -1;
+static tlSym argspecName(tlBCode* code, int at) {
+    tlHandle spec = tlListGet(code->argspec, at);
+    if (!spec || spec == tlNull) return null;
+    tlHandle name = tlListGet(tlListAs(spec), 0); // 0=name 1=default 2=lazy
+    return tlSymIs(name)? tlSymAs(name) : null;
 }
 
-static bool isNameInCall(tlBCode* code, tlList* names, int arg) {
-    tlHandle spec = tlListGet(code->argspec, arg);
-    if (!spec || spec == tlNull) return false;
-    tlHandle name = tlListGet(tlListAs(spec), 0);
-    if (!name || name == tlNull) return false;
+// named calls have to match their args to the argspec of the code they call, which is a scan over
+// both; so per names list, the code keeps that matching as a table in both directions
+#define ARG_MAP_ENTRIES 8
+
+struct tlBArgMap {
+    tlBArgMap* next;
+    tlList* names;
+    int* slots;  // for each arg in the argspec, the raw index of the value in the call, or -1
+    int* params; // for each raw index in the call, the arg in the argspec it is passed as, or -1
+    int data[];
+};
+
+static tlBArgMap* argMapNew(tlBCode* code, tlList* names) {
+    int params = tlListSize(code->argspec);
     int size = tlListSize(names);
-    for (int i = 0; i < size; i++) {
-        if (name == tlListGet(names, i)) return true;
+    tlBArgMap* map = malloc(sizeof(tlBArgMap) + sizeof(int) * (params + size));
+    map->next = null;
+    map->names = names;
+    map->slots = map->data;
+    map->params = map->data + params;
+
+    // explicitly named, or the n'th unnamed value, where n counts the args before it that were not named
+    int unnamed = 0;
+    for (int at = 0; at < params; at++) {
+        tlSym name = argspecName(code, at);
+        int slot = name? tlListIndexOf(names, name) : -1;
+        if (slot < 0) {
+            for (int i = 0, n = 0; i < size; i++) {
+                if (tlSymIs(tlListGet(names, i))) continue;
+                if (n++ == unnamed) { slot = i; break; }
+            }
+            unnamed++;
+        }
+        map->slots[at] = slot;
     }
-    return false;
+
+    // and the reverse, unnamed values are passed as the n'th arg that was not named in the call
+    for (int i = 0, n = 0; i < size; i++) {
+        tlHandle name = tlListGet(names, i);
+        int param = -1;
+        if (tlSymIs(name)) {
+            for (int at = 0; at < params; at++) {
+                if (argspecName(code, at) == name) { param = at; break; }
+            }
+        } else {
+            for (int at = 0, skip = n++; at < params; at++) {
+                tlSym pname = argspecName(code, at);
+                if (pname && tlListIndexOf(names, pname) >= 0) continue;
+                if (skip-- == 0) { param = at; break; }
+            }
+        }
+        map->params[i] = param;
+    }
+    return map;
+}
+
+// copies the first n maps of a chain; readers might be walking the published chain, so it is not
+// cut short in place, the copies share their tables with the originals
+static tlBArgMap* argMapCopy(tlBArgMap* map, int n) {
+    if (!map || n <= 0) return null;
+    tlBArgMap* copy = malloc(sizeof(tlBArgMap));
+    *copy = *map;
+    copy->next = argMapCopy(map->next, n - 1);
+    return copy;
+}
+
+// names are mostly literals from the module, so a pointer compare will do, but calls built from Args are not
+static tlBArgMap* argMapFor(tlBCode* code, tlList* names) {
+    a_var var = (a_var)&code->argmaps;
+    tlBArgMap* head = A_PTR(a_get(var));
+    int entries = 0;
+    for (tlBArgMap* map = head; map; map = map->next, entries++) {
+        if (map->names == names || tlListEquals(map->names, names)) return map;
+    }
+
+    // publish a new map in front; when full, the oldest map is dropped
+    tlBArgMap* map = argMapNew(code, names);
+    map->next = entries < ARG_MAP_ENTRIES? head : argMapCopy(head, ARG_MAP_ENTRIES - 1);
+    a_set(var, A_VAL(map));
+    return map;
 }
 
-// TODO this is dog slow ...
 static bool tlBCallIsLazy(tlArgs* call, int arg) {
     arg -= 2; // 0 == target; 1 == fn; 2 == arg[0]
     if (arg < 0 || !call || arg >= tlArgsRawSizeInline(call)) return false;
@@ -247,30 +432,12 @@ static bool tlBCallIsLazy(tlArgs* call, int arg) {
 
     tlList* names = tlArgsNamesInline(call);
     if (names) {
-        tlHandle name = tlListGet(names, arg);
-        if (tlSymIs(name)) {
-            arg = findNamedArg(code, name);
-            trace("named arg is numer: %d", arg);
-            if (arg == -1) return false;
-        } else {
-            // first figure out the which unnamed argument we are
-            int unnamed = 0;
-            for (int a = 0; a < arg; a++) {
-                if (!tlSymIs(tlListGet(names, a))) unnamed++;
-            }
-            trace("unnamed arg: %d", unnamed);
-            // then figure out which arg that maps to
-            for (arg = 0;; arg++) {
-                if (!isNameInCall(code, names, arg)) {
-                    if (unnamed == 0) break;
-                    unnamed -= 1;
-                }
-            }
-            trace("unnamed arg is numer: %d", arg);
-        }
+        arg = argMapFor(code, names)->params[arg];
+        trace("named call, arg is number: %d", arg);
+        if (arg == -1) return false;
     }
 
-    tlHandle spec = tlListGet(tlBClosureAs(call->fn)->code->argspec, arg);
+    tlHandle spec = tlListGet(code->argspec, arg);
     if (!spec || spec == tlNull) return false;
     return tlTrue == tlListGet(tlListAs(spec), 2); // 0=name 1=default 2=lazy
 }
@@ -295,15 +462,6 @@ static void tlBCallAdd_(tlArgs* call, tlHandle o, int arg) {
     tlArgsSet_(call, arg, o);
 }
 
-static int tlBCallNameIndex(tlList* names, tlSym name) {
-    int size = tlListSize(names);
-    for (int i = 0; i < size; i++) {
-        if (name == tlListGet(names, i)) return i;
-    }
-    return -1;
-}
-
-// TODO this is way to expensive ...
 // get args[n] where n represents n'th original argument, incase names have to be matched
 tlHandle tlBCallGetExtra(tlArgs* call, int at, tlBCode* code) {
     tlList* argspec = tlListAs(tlListGet(code->argspec, at));
@@ -312,25 +470,14 @@ tlHandle tlBCallGetExtra(tlArgs* call, int at, tlBCode* code) {
 
     if (name == s_this) return tlOR_UNDEF(tlArgsTargetInline(call));
 
-    tlList* names = tlArgsNames(call);
+    tlHandle v;
+    tlList* names = tlArgsNamesInline(call);
     if (names) {
-        // figure out if this argument was explicitly passed in as named param
-        tlHandle v = tlArgsGetNamed(call, name);
-        if (v) {
-            trace("ARG(%d) name=%s value=%s", at, tl_str(name), tl_repr(v));
-            return v;
-        }
-
-        // this param was not named, figure out how many other unnamed arguments preceded us
-        int skipped = 0;
-        for (int i = 0; i < at; i++) {
-            tlHandle prevname = tlListGet(tlListGet(code->argspec, i), 0);
-            if (tlBCallNameIndex(names, prevname) < 0) skipped++;
-        }
-        at = skipped;
+        int slot = argMapFor(code, names)->slots[at];
+        v = slot >= 0? tlArgsGetRaw(call, slot) : null;
+    } else {
+        v = tlArgsGet(call, at);
     }
-
-    tlHandle v = tlArgsGet(call, at);
     trace("ARG(%d) value=%s", at, tl_repr(v));
     if (v) return v;
 
@@ -362,6 +509,17 @@ static inline int pcreadsize(const uint8_t* ops, int* pc) {
         res = (res << 6) | (b & 0x3F);
     }
 }
+// jump targets are a fixed 3 bytes, so the compiler knows the size of a jump before its target
+static int dreadjump(const uint8_t** code) {
+    const uint8_t* c = *code;
+    *code = c + 3;
+    return c[0] << 16 | c[1] << 8 | c[2];
+}
+static inline int pcreadjump(const uint8_t* ops, int* pc) {
+    int at = *pc;
+    *pc = at + 3;
+    return ops[at] << 16 | ops[at + 1] << 8 | ops[at + 2];
+}
 static tlHandle dreadref(const uint8_t** code, const tlList* data) {
     uint8_t b = **code;
     if (b > 0xC0) {
@@ -505,6 +663,9 @@ tlBCode* readbytecode(tlBuffer* buf, tlList* data, tlBModule* mod, int size, con
         debuginfo = readref(buf, data, null);
     }
     if (!tlObjectIs(debuginfo) || tlNullIs(debuginfo)) FAIL("code[4] must be debuginfo (object|null)");
+    if (tlObjectIs(debuginfo) && tl_bool(tlObjectGet(debuginfo, tlSYM("noescape")))) tlflag_set(bcode, kCodeNoEscape);
+    if (tlObjectIs(debuginfo) && tl_bool(tlObjectGet(debuginfo, tlSYM("nocapture")))) tlflag_set(bcode, kCodeNoCapture);
+    if (tlObjectIs(debuginfo)) bcode->loopoffsets = tlListCast(tlObjectGet(debuginfo, tlSYM("loops")));
 
     tlBDebugInfo* info = tlBDebugInfoNew();
     info->name = tlStringAs(name);
@@ -779,6 +940,10 @@ static void disasm(tlBCode* bcode) {
                 r = pcreadsize(ops, &pc); r2 = pcreadsize(ops, &pc); r3 = pcreadsize(ops, &pc);
                 print(" %3d 0x%X %s: %d %d <- %d", opc, op, op_name(op), r, r3, r2);
                 break;
+            case OP_JUMP: case OP_JUMPT: case OP_JUMPF: // target
+                r = pcreadjump(ops, &pc);
+                print(" %3d 0x%X %s: %d", opc, op, op_name(op), r);
+                break;
             default: print("OEPS: %d 0x%X %s", opc, op, op_name(op));
         }
         for (int i = opc + 1; i < pc; i++) print(" %3d 0x%02X", i, ops[i]);
@@ -820,21 +985,51 @@ void bpprint(tlHandle v) {
     print("%s", tl_str(v));
 }
 
+// call ops in icode are: op, size, names, site, end
+#define ICALL_SIZE 5
+
+// the size in words of an op and its operands in icode
+static int iop_size(intptr_t op) {
+    switch (op) {
+        case OP_INT: case OP_SYSTEM: case OP_MODULE: case OP_GLOBAL:
+        case OP_ARG: case OP_LOCAL: case OP_ENVARGS: case OP_ENVTHIS:
+        case OP_BIND: case OP_STORE: case OP_VGET: case OP_VSTORE:
+        case OP_INVOKE:
+        case OP_JUMP: case OP_JUMPT: case OP_JUMPF:
+            return 2;
+        case OP_ENVARG: case OP_ENV: case OP_EVGET: case OP_EVSTORE:
+        case OP_RSTORE: case OP_VRSTORE:
+            return 3;
+        case OP_EVRSTORE:
+            return 4;
+        default:
+            if (op & 0x20) return ICALL_SIZE;
+            return 1;
+    }
+}
+
 // for a given pc, find out how many CALLs or GLOBALs we have seen
 int tlBCodePosOpsForPc(tlBCode* code, int pc) {
     int pos = 0;
-    for (int p = 0; p < pc && p < code->size; p++) {
-        uint8_t op = code->code[p];
+    for (int p = 0; p < pc && p < code->isize; p += iop_size(code->icode[p])) {
+        intptr_t op = code->icode[p];
         if (op == OP_GLOBAL) pos++;
         else if (op == OP_INVOKE) pos++;
         else if ((op & 0xE0) == 0xE0) pos++;
     }
-    assert(pos <= (pc + 4) / 2); // not an exact science ... this might trip
     return pos;
 }
 
 // verify and fill in call depth and balancing, and use of locals
+// and translate the code into icode, where each op and each operand takes one word:
+// literals and module data are resolved to their values; globals remain an index, as modules can be relinked
+// call ops are: op, size, names or null, inline cache site or 0, pc after the matching OP_INVOKE
+// OP_INVOKE is: op, pc after the next OP_CERR or -1, to skip the remaining clauses of a conditional
+// jump ops are: op, pc of the target, translated from the byte offset in the code
+// OP_BIND of code that captures nothing becomes OP_MODULE, loading a closure created here
 tlHandle tlBCodeVerify(tlBCode* bcode, const char** error) {
+    if (bcode->icode) return tlNull; // already verified
+
     int locals = tlListSize(bcode->localnames);
     int maxdepth = 0;
     int depth = 0;
@@ -850,8 +1045,26 @@ tlHandle tlBCodeVerify(tlBCode* bcode, const char** error) {
     // print the code
     //disasm(bcode);
 
+    // an op is at least one byte and expands to at most ICALL_SIZE words for two bytes
+    intptr_t* icode = malloc(sizeof(intptr_t) * (bcode->size * 3 + ICALL_SIZE));
+    int isize = 0;
+    int sites = 0;
+    // open calls, and invokes that are waiting for the next OP_CERR
+    int* calls = malloc_atomic(sizeof(int) * bcode->size * 4);
+    int* invokes = calls + bcode->size;
+    int pending = 0;
+    // by byte offset, the pc of each op outside of calls, or -1; and the jumps whose target needs translating
+    int* pcs = invokes + bcode->size;
+    int* jumps = pcs + bcode->size;
+    int njumps = 0;
+    for (int i = 0; i < bcode->size; i++) pcs[i] = -1;
+
+#define EMIT(w) (icode[isize++] = (intptr_t)(w))
     while (true) {
+        int start = isize;
+        if (depth == 0) pcs[code - bcode->code] = start;
         uint8_t op = *code; code++;
+        EMIT(op);
         switch (op) {
             case OP_END: goto exit;
             case OP_TRUE: break;
@@ -860,28 +1073,36 @@ tlHandle tlBCodeVerify(tlBCode* bcode, const char** error) {
             case OP_UNDEF: break;
             case OP_ARGS: break;
             case OP_THIS: break;
-            case OP_INT: dreadsize(&code); break;
-            case OP_SYSTEM: dreadsize(&code); break;
-            case OP_MODULE: dreadref(&code, data); break;
-            case OP_GLOBAL: dreadsize(&code); break;
+            case OP_INT: EMIT(tlINT(dreadsize(&code))); break;
+            case OP_SYSTEM: EMIT(dreadsize(&code)); break;
+            case OP_MODULE:
+                v = dreadref(&code, data);
+                if (!v) FAIL("module data out of range");
+                EMIT(v);
+                break;
+            case OP_GLOBAL:
+                at = dreadsize(&code);
+                if (at >= tlListSize(bcode->mod->links)) FAIL("global out of range");
+                EMIT(at);
+                break;
             case OP_ENV:
             case OP_EVGET:
                 parent = dreadsize(&code);
                 at = dreadsize(&code);
-                UNUSED(at);
                 // TODO check if parent locals actually support these
                 assert(parent >= 0);
                 assert(at >= 0);
                 if (parent > 200) FAIL("parent out of range");
+                EMIT(parent); EMIT(at);
                 break;
             case OP_ENVARG:
                 parent = dreadsize(&code);
                 at = dreadsize(&code);
-                UNUSED(at);
                 // TODO check if parent locals actually support these
                 assert(parent >= 0);
                 assert(at >= 0);
                 if (parent > 200) FAIL("parent out of range");
+                EMIT(parent); EMIT(at);
                 break;
             case OP_ENVARGS:
             case OP_ENVTHIS:
@@ -889,84 +1110,138 @@ tlHandle tlBCodeVerify(tlBCode* bcode, const char** error) {
                 // TODO check if parent locals actually support these
                 assert(parent >= 0);
                 if (parent > 200) FAIL("parent out of range");
+                EMIT(parent);
                 break;
             case OP_LOCAL:
             case OP_VGET:
                 at = dreadsize(&code);
                 assert(at >= 0);
                 if (at >= locals) FAIL("local out of range");
+                EMIT(at);
                 break;
-            case OP_ARG: dreadsize(&code); break;
+            case OP_ARG: EMIT(dreadsize(&code)); break;
             case OP_BIND:
                 v = dreadref(&code, data);
+                if (!tlBCodeIs(v)) FAIL("bind requires code");
                 tlBCodeVerify(tlBCodeAs(v), error); // TODO pass in our locals somehow for ENV
                 if (*error) return null;
+                if (tlflag_isset(tlBCodeAs(v), kCodeNoCapture)) {
+                    // no env needed, so bind once, and load that closure as a constant
+                    icode[start] = OP_MODULE;
+                    EMIT(tlBClosureNew(tlBCodeAs(v), null));
+                    break;
+                }
+                EMIT(v);
                 break;
             case OP_STORE:
             case OP_VSTORE:
                 at = dreadsize(&code);
                 assert(at >= 0);
                 if (at >= locals) FAIL("local store out of range");
+                EMIT(at);
                 break;
             case OP_RSTORE:
             case OP_VRSTORE:
-                dreadsize(&code);
+                EMIT(dreadsize(&code));
                 at = dreadsize(&code);
                 assert(at >= 0);
                 if (at >= locals) FAIL("local store out of range");
+                EMIT(at);
                 break;
             case OP_EVSTORE:
                 parent = dreadsize(&code);
                 at = dreadsize(&code);
-                UNUSED(at);
                 assert(parent >= 0);
                 assert(at >= 0);
                 if (parent > 200) FAIL("parent out of range");
+                EMIT(parent); EMIT(at);
                 break;
             case OP_EVRSTORE:
                 parent = dreadsize(&code);
-                dreadsize(&code);
+                EMIT(parent);
+                EMIT(dreadsize(&code));
                 at = dreadsize(&code);
-                UNUSED(at);
                 assert(parent >= 0);
                 assert(at >= 0);
                 if (parent > 200) FAIL("parent out of range");
+                EMIT(at);
                 break;
 
             case OP_INVOKE:
                 if (depth <= 0) FAIL("invoke without call");
                 if (depth > maxdepth) maxdepth = depth;
                 depth--;
+                EMIT(-1);
+                icode[calls[depth] + 4] = isize;
+                invokes[pending++] = start;
+                break;
+            case OP_CERR:
+                for (int i = 0; i < pending; i++) icode[invokes[i] + 1] = isize;
+                pending = 0;
+                break;
+            case OP_JUMP:
+            case OP_JUMPT:
+            case OP_JUMPF:
+                // the interpreter keeps no state across a jump, so there cannot be a call under construction
+                if (depth != 0) FAIL("jump inside a call");
+                if (code + 3 > bcode->code + bcode->size) FAIL("jump out of range");
+                EMIT(dreadjump(&code));
+                jumps[njumps++] = start + 1;
                 break;
-            case OP_CERR: break;
             case OP_MCALL:
             case OP_FCALL:
             case OP_BCALL:
             case OP_CCALL:
             case OP_SCALL:
             case OP_MCALLS:
-                dreadsize(&code);
-                depth++;
+                EMIT(dreadsize(&code));
+                EMIT(null);
+                EMIT((op & 0x7) == 0? ++sites : 0);
+                EMIT(-1);
+                calls[depth++] = start;
                 break;
             case OP_MCALLN:
             case OP_FCALLN:
             case OP_BCALLN:
             case OP_MCALLNS:
-                dreadsize(&code);
+                EMIT(dreadsize(&code));
                 v = dreadref(&code, data);
-                UNUSED(v);
-                depth++;
+                if (!tlListIs(v)) FAIL("call names must be a list");
+                EMIT(v);
+                EMIT((op & 0x7) == 0? ++sites : 0);
+                EMIT(-1);
+                calls[depth++] = start;
                 break;
             default:
                 warning("%d - %s", op, op_name(op));
                 FAIL("not an opcode");
         }
     }
+#undef EMIT
 exit:;
      if (depth != 0) FAIL("call without invoke");
+     for (int i = 0; i < njumps; i++) {
+         intptr_t target = icode[jumps[i]];
+         if (target < 0 || target >= bcode->size || pcs[target] < 0) FAIL("jump target is not an op outside of calls");
+         icode[jumps[i]] = pcs[target];
+     }
+     int loops = bcode->loopoffsets? tlListSize(bcode->loopoffsets) / 2 : 0;
+     int* looppcs = malloc_atomic(sizeof(int) * (loops * 2 + 1));
+     for (int i = 0; i < loops * 2; i++) {
+         tlHandle offset = tlListGet(bcode->loopoffsets, i);
+         int at = tlIntIs(offset)? tl_int(offset) : -1;
+         if (at < 0 || at >= bcode->size || pcs[at] < 0) FAIL("loop is not around ops outside of calls");
+         looppcs[i] = pcs[at];
+     }
      trace("verified; locals: %d, calldepth: %d, %s", locals, maxdepth, tl_str(bcode));
      bcode->locals = locals;
      bcode->calldepth = maxdepth;
+     bcode->sites = sites;
+     bcode->sitecaches = calloc(sites + 1, sizeof(tlBSiteCache*));
+     bcode->isize = isize;
+     bcode->icode = icode;
+     bcode->loops = loops;
+     bcode->looppcs = looppcs;
      return tlNull;
 }
 
@@ -990,6 +1265,10 @@ tlBModule* tlBModuleLink(tlBModule* mod, tlObject* env, const char** error) {
 tlHandle eval_args(tlTask* task, tlArgs* args);
 tlHandle eval_lazy(tlTask* task, tlBLazy* lazy);
 tlHandle beval(tlTask* task, tlCodeFrame* frame, tlHandle resuming);
+#ifdef TL_JIT
+static tlJitEntryFn jit_entry(tlBCode* bcode);
+static tlHandle jit_eval(tlTask* task, tlCodeFrame* frame, tlJitEntryFn entry);
+#endif
 
 static tlHandle afterYieldQuota(tlTask* task, tlFrame* frame, tlHandle res, tlHandle err) {
     if (!res) return null;
@@ -1039,7 +1318,7 @@ tlHandle tlInvoke(tlTask* task, tlArgs* call) {
     tlHandle fn = tlArgsFnInline(call);
     tlHandle target = tlArgsTargetInline(call);
     trace(" %s invoke %s.%s", tl_str(call), tl_str(target), tl_str(fn));
-    if (target && tl_kind(target)->locked) {
+    if (target && tl_kind(target)->locked && !tlBClosureUnlocked(fn)) {
         if (!tlLockIsOwner(tlLockAs(target), task)) return tlLockAndInvoke(task, call);
     }
 
@@ -1103,76 +1382,38 @@ tlHandle tlEval(tlTask* task, tlHandle v) {
     return v;
 }
 
-static tlBLazy* create_lazy(const uint8_t* ops, const int len, int* ppc, tlArgs* args, tlEnv* locals) {
-    // match CALLs with INVOKEs and wrap it for later execution
-    // notice bytecode vs literals are such that OP_CALL cannot appear in literals
+// a lazy argument is either a single op, or a call upto and including its matching OP_INVOKE
+static tlBLazy* create_lazy(const intptr_t* ops, int* ppc, tlCodeFrame* frame) {
     int pc = *ppc;
-    int start = pc;
-    trace("LAZY: %d - %s(%X)", pc, op_name(ops[pc]), ops[pc]);
-    if ((ops[pc] & 0xE0) != 0xE0) { // not an OP_CALL
-        pc++;
-        while ((ops[pc] & 0xC0) != 0xC0) pc++; // upto the next OP
-        *ppc = pc;
-        // TODO if not mutable, [e]vstore, create a LazyData instead?
-        return tlBLazyNew(args, locals, start);
-    }
-    int depth = 0;
-    while (pc < len) {
-        uint8_t op = ops[pc++];
-        trace("SEARCHING: %d - %d - %s(%X)", depth, pc - 1, op_name(op), op);
-        if (op == OP_INVOKE) {
-            depth--;
-            if (!depth) {
-                *ppc = pc;
-                trace("%d", start);
-                return tlBLazyNew(args, locals, start);
-            }
-        } else if ((op & 0xE0) == 0xE0) { // OP_CALL mask
-            trace("ADDING DEPTH: %X", op);
-            depth++;
-        }
-    }
-    fatal("bytecode invalid");
-    return null;
+    intptr_t op = ops[pc];
+    trace("LAZY: %d - %s(%X)", pc, op_name(op), (int)op);
+    // TODO if not mutable, [e]vstore, create a LazyData instead?
+    *ppc = (op & 0x20)? ops[pc + 4] : pc + iop_size(op);
+    tlEnv* locals = frame_locals_escape(frame);
+    return tlBLazyNew(locals->args, locals, pc);
 }
 
-static int skip_safe_invokes(const uint8_t* ops, const int len, int pc, int skip) {
+// skip forward until so many calls have been invoked, nested calls are skipped as a whole
+static int skip_safe_invokes(const intptr_t* ops, int pc, int skip) {
     int depth = skip;
-    while (pc < len) {
-        uint8_t op = ops[pc++];
-        trace("SEARCHING: %d - %d - %s(%X)", depth, pc - 1, op_name(op), op);
+    while (true) {
+        intptr_t op = ops[pc];
+        trace("SEARCHING: %d - %d - %s(%X)", depth, pc, op_name(op), (int)op);
+        if (op == OP_END) break;
         if (op == OP_INVOKE) {
+            pc += 2;
             depth--;
             if (!depth) {
                 trace("SKIPPED TO: %d", pc);
                 return pc;
             }
-        } else if ((op & 0xE0) == 0xE0) { // OP_CALL mask
-            trace("ADDING DEPTH: %X", op);
-            depth++;
+            continue;
         }
-    }
-    fatal("bytecode invalid");
-    return 0;
-}
-
-// OP_CCALL always looks like this: CCALL, 0, BIND, index, INVOKE
-static int skip_ccall(const uint8_t* ops, const int len, int pc) {
-    while (pc < len) {
-        uint8_t op = ops[pc++];
-        trace("SEARCHING: %d - %s(%X)", pc - 1, op_name(op), op);
-        if (op == OP_INVOKE) return pc;
-    }
-    fatal("bytecode invalid");
-    return 0;
-}
-
-// we don't allow nesting OP_CCALL and OP_CERR, so just skip one past
-static int skip_pcalls(const uint8_t* ops, const int len, int pc) {
-    while (pc < len) {
-        uint8_t op = ops[pc++];
-        trace("SEARCHING: %d - %s(%X)", pc - 1, op_name(op), op);
-        if (op == OP_CERR) return pc;
+        if (op & 0x20) {
+            pc = ops[pc + 4];
+            continue;
+        }
+        pc += iop_size(op);
     }
     fatal("bytecode invalid");
     return 0;
@@ -1193,6 +1434,117 @@ static tlHandle bmethodResolve(tlHandle target, tlSym method, bool safe) {
     return null;
 }
 
+// Per call site inline caches for method calls. A cache holds a few entries keyed on the shape of the
+// receiver: the keys of an object, the class of a user object, or the kind. A cache is never mutated
+// once published, a miss publishes a new copy, so concurrent readers never see partial entries.
+// In place mutations of methods bump the epoch, which invalidates all caches at once.
+#define SITE_CACHE_ENTRIES 4
+
+typedef struct SiteEntry {
+    tlHandle shape; // object->keys, userobject->cls, the class itself, or the kind
+    int classat;    // for objects, the index of the class field, or -1
+    tlHandle klass; // for objects, the value of the class field
+    int field;      // if >= 0, the value is the field at this index in the receiver
+    tlHandle value;
+} SiteEntry;
+
+struct tlBSiteCache {
+    a_val epoch;
+    tlSym method;
+    int size;
+    SiteEntry entries[SITE_CACHE_ENTRIES];
+};
+
+static a_val g_site_epoch;
+
+void tlBSiteCachesInvalidate() {
+    a_inc(&g_site_epoch);
+}
+
+static tlHandle siteShape(tlHandle target) {
+    if (tlObjectIs(target)) return tlObjectAs(target)->keys;
+    if (tlUserObjectIs(target)) return tlUserObjectAs(target)->cls;
+    if (tlClassIs(target) || tlUserClassIs(target)) return target;
+    return tl_kind(target);
+}
+
+static tlHandle siteCacheGet(tlBSiteCache* cache, tlHandle target, tlSym method) {
+    if (!cache || cache->method != method || cache->epoch != a_get(&g_site_epoch)) return null;
+    tlHandle shape = siteShape(target);
+    for (int i = 0; i < cache->size; i++) {
+        const SiteEntry* entry = &cache->entries[i];
+        if (entry->shape != shape) continue;
+        if (tlObjectIs(target)) {
+            tlObject* object = tlObjectAs(target);
+            if (entry->classat >= 0 && object->data[entry->classat] != entry->klass) continue;
+            if (entry->field >= 0) return object->data[entry->field];
+            return entry->value;
+        }
+        if (entry->field >= 0) return tlOR_NULL(tlUserObjectAs(target)->fields[entry->field]);
+        return entry->value;
+    }
+    return null;
+}
+
+// resolve like bmethodResolve, but fill in an entry if the result only depends on the shape of the target
+static tlHandle siteEntryResolve(SiteEntry* entry, tlHandle target, tlSym method, bool safe) {
+    entry->shape = siteShape(target);
+    entry->classat = -1;
+    entry->klass = null;
+    entry->field = -1;
+    entry->value = null;
+
+    if (tlObjectIs(target)) {
+        tlObject* object = tlObjectAs(target);
+        entry->field = tlSetIndexof(object->keys, method);
+        if (entry->field >= 0) return object->data[entry->field];
+        // a getter on the object itself is not cachable by its keys
+        if (tlSetIndexof(object->keys, s__get) >= 0) return objectResolve(object, method);
+        entry->classat = tlSetIndexof(object->keys, s_class);
+        if (entry->classat >= 0) entry->klass = object->data[entry->classat];
+        return entry->value = objectResolve(object, method);
+    }
+    if (tlUserObjectIs(target)) {
+        tlUserObject* oop = tlUserObjectAs(target);
+        entry->value = tlUserClassResolve(oop->cls, method, &entry->field);
+        if (entry->field >= 0) return tlOR_NULL(oop->fields[entry->field]);
+        return entry->value;
+    }
+    // send tokens depend on safe, and are cheap to create anyway
+    if (tl_kind(target)->send) return bmethodResolve(target, method, safe);
+    return entry->value = bmethodResolve(target, method, safe);
+}
+
+static tlHandle bmethodResolveCached(tlBCode* bcode, int site, tlHandle target, tlSym method, bool safe) {
+    if (!site) return bmethodResolve(target, method, safe);
+    a_var var = (a_var)&bcode->sitecaches[site];
+    tlBSiteCache* cache = A_PTR(a_get(var));
+    tlHandle value = siteCacheGet(cache, target, method);
+    if (value) return value;
+
+    // read the epoch before resolving; if an install lands while resolving, the entry is stale and
+    // must carry the older epoch, so the next lookup drops it
+    a_val epoch = a_get(&g_site_epoch);
+    SiteEntry entry;
+    value = siteEntryResolve(&entry, target, method, safe);
+    if (!value || (entry.field < 0 && !entry.value)) return value;
+
+    // publish a new cache with this entry in front; stale or foreign caches are dropped
+    tlBSiteCache* ncache = malloc(sizeof(tlBSiteCache));
+    ncache->epoch = epoch;
+    ncache->method = method;
+    ncache->size = 1;
+    ncache->entries[0] = entry;
+    if (cache && cache->method == method && cache->epoch == epoch) {
+        for (int i = 0; i < cache->size && ncache->size < SITE_CACHE_ENTRIES; i++) {
+            ncache->entries[ncache->size++] = cache->entries[i];
+        }
+    }
+    a_set(var, A_VAL(ncache));
+    return value;
+}
+
+
 tlHandle tlFrameEval(tlTask* task, tlCodeFrame* frame) {
     return beval(task, frame, null);
 }
@@ -1253,11 +1605,11 @@ void tlCodeFrameDump(tlFrame* _frame) {
     }
 }
 
-static tlHandle handleBFrameThrow(tlTask* task, tlCodeFrame* frame, tlHandle throw);
+static tlHandle handleBFrameThrow(tlTask* task, tlCodeFrame* frame, tlHandle handler, tlHandle throw);
 tlHandle eval_resume(tlTask* task, tlFrame* _frame, tlHandle value, tlHandle error) {
     tlCodeFrame* frame = tlCodeFrameAs(_frame);
     //if (error) return tlCodeFrameHandleError(task, frame, error);
-    if (error) return handleBFrameThrow(task, frame, error);
+    if (error) return handleBFrameThrow(task, frame, frame->handler, error);
     if (!value) return null;
 
     return beval(task, frame, value);
@@ -1265,17 +1617,21 @@ tlHandle eval_resume(tlTask* task, tlFrame* _frame, tlHandle value, tlHandle err
 
 tlHandle eval_args(tlTask* task, tlArgs* args) {
     trace("%s", tl_str(args));
-    tlCodeFrame* frame = tlCodeFrameNew(args, null);
+    tlCodeFrame* frame = tlCodeFrameNew(task, args, null);
 
     // init debugger state if needed
     if (tlDebuggerFor(task)) frame->stepping = 1;
 
     tlTaskPushFrame(task, (tlFrame*)frame);
+#ifdef TL_JIT
+    tlJitEntryFn entry = frame->stepping? null : jit_entry(tlBClosureAs(args->fn)->code);
+    if (entry) return jit_eval(task, frame, entry);
+#endif
     return beval(task, frame, null);
 }
 
 tlHandle eval_lazy(tlTask* task, tlBLazy* lazy) {
-    tlCodeFrame* frame = tlCodeFrameNew(lazy->locals->args, lazy->locals);
+    tlCodeFrame* frame = tlCodeFrameNew(task, lazy->locals->args, lazy->locals);
     frame->pc = lazy->pc;
     frame->lazy = true;
 
@@ -1283,6 +1639,98 @@ tlHandle eval_lazy(tlTask* task, tlBLazy* lazy) {
     return beval(task, frame, null);
 }
 
+// Most calls are to natives like add or lt, which only read their args. Those natives are marked
+// kNativeNoCapture, and after they return, their args are kept on the task to build the next call.
+static tlArgs* args_take(tlTask* task, int size, bool hasNames, bool isMethod) {
+    int total = size + (isMethod? 2 : 0) + (hasNames? 1 : 0);
+    if (total >= TL_TASK_SPARE_ARGS) return tlArgsNewNames(size, hasNames, isMethod);
+    tlArgs* args = task->spareargs[total];
+    if (!args) return tlArgsNewNames(size, hasNames, isMethod);
+
+    task->spareargs[total] = null;
+    assert(args->size == total);
+    set_kind(args, tlArgsKind); // clears kIsSetter
+    args->spec = !!isMethod << 1 | !!hasNames;
+    args->fn = null;
+    memset(args->data, 0, sizeof(tlHandle) * total);
+    return args;
+}
+
+static void args_give(tlTask* task, tlArgs* args) {
+    if (args->size >= TL_TASK_SPARE_ARGS) return;
+    task->spareargs[args->size] = args;
+}
+
+// Operators like `a + b` compile to calls to natives like add. When both operands are ints or
+// floats, compute the result here instead, the call and its args are never needed. Returns null to
+// let the native handle it, like for bignums, nulls, strings, overflowing multiplications or NaN.
+static tlHandle native_op_inline(tlArgs* call) {
+    tlNative* fn = tlNativeCast(tlArgsFnInline(call));
+    if (!fn || !fn->op) return null;
+    if (call->spec != 0 || call->size != 2) return null;
+    tlHandle l = call->data[0];
+    tlHandle r = call->data[1];
+
+    if (tlIntIs(l) && tlIntIs(r)) {
+        intptr_t a = tlIntToInt(l);
+        intptr_t b = tlIntToInt(r);
+        switch (fn->op) {
+            case TL_NATIVE_OP_ADD: return tlNUM(a + b); // ints are at most 62 bits, cannot overflow
+            case TL_NATIVE_OP_SUB: return tlNUM(a - b);
+            case TL_NATIVE_OP_MUL: {
+                intptr_t res;
+                if (__builtin_mul_overflow(a, b, &res)) return null;
+                return tlNUM(res);
+            }
+            case TL_NATIVE_OP_EQ: return tlBOOL(a == b);
+            case TL_NATIVE_OP_NEQ: return tlBOOL(a != b);
+            case TL_NATIVE_OP_LT: return tlBOOL(a < b);
+            case TL_NATIVE_OP_LTE: return tlBOOL(a <= b);
+            case TL_NATIVE_OP_GT: return tlBOOL(a > b);
+            case TL_NATIVE_OP_GTE: return tlBOOL(a >= b);
+            case TL_NATIVE_OP_BAND: return tlNUM((intptr_t)((uint32_t)a & (uint32_t)b));
+            case TL_NATIVE_OP_BOR: return tlNUM((intptr_t)((uint32_t)a | (uint32_t)b));
+            case TL_NATIVE_OP_BXOR: return tlNUM((intptr_t)((uint32_t)a ^ (uint32_t)b));
+            case TL_NATIVE_OP_NONE: return null;
+        }
+        return null;
+    }
+
+    if (!(tlFloatIs(l) || tlIntIs(l)) || !(tlFloatIs(r) || tlIntIs(r))) return null;
+    double a = tl_double(l);
+    double b = tl_double(r);
+    if (isnan(a) || isnan(b)) return null;
+    switch (fn->op) {
+        case TL_NATIVE_OP_ADD: return tlFLOAT(a + b);
+        case TL_NATIVE_OP_SUB: return tlFLOAT(a - b);
+        case TL_NATIVE_OP_MUL: return tlFLOAT(a * b);
+        case TL_NATIVE_OP_EQ: return tlBOOL(a == b);
+        case TL_NATIVE_OP_NEQ: return tlBOOL(a != b);
+        case TL_NATIVE_OP_LT: return tlBOOL(a < b);
+        case TL_NATIVE_OP_LTE: return tlBOOL(a <= b);
+        case TL_NATIVE_OP_GT: return tlBOOL(a > b);
+        case TL_NATIVE_OP_GTE: return tlBOOL(a >= b);
+        default: return null;
+    }
+}
+
+// With gcc or clang, the interpreter dispatches ops using computed gotos, jumping from the end of
+// one op directly to the code of the next. When a debugger is attached, a second table routes every
+// op through a step first, so the normal dispatch never checks for a debugger.
+#if defined(__GNUC__) && !defined(TL_NO_COMPUTED_GOTO)
+#define TL_COMPUTED_GOTO 1
+#define TARGET(o) case o: L_##o
+#define DISPATCH() do { \
+    if (call && tlBCallIsLazy(call, arg)) goto again; \
+    frame->pc = pc; \
+    op = ops[pc++]; \
+    goto *dispatch[op]; \
+} while (0)
+#else
+#define TARGET(o) case o
+#define DISPATCH() goto again
+#endif
+
 tlHandle beval(tlTask* task, tlCodeFrame* frame, tlHandle resuming) {
     assert(task);
     assert(tlTaskCurrentFrame(task) == (tlFrame*)frame);
@@ -1296,8 +1744,7 @@ tlHandle beval(tlTask* task, tlCodeFrame* frame, tlHandle resuming) {
     tlBClosure* closure = tlBClosureAs(args->fn);
     tlBCode* bcode = closure->code;
     tlBModule* mod = bcode->mod;
-    tlList* data = mod->data;
-    const uint8_t* ops = bcode->code;
+    const intptr_t* ops = bcode->icode;
 
     trace("%p '%s' env=%p closure=%p", frame, tl_str(bcode->debuginfo->name), closure->env, closure);
     debug_trace_frame(task, frame, args);
@@ -1309,9 +1756,51 @@ tlHandle beval(tlTask* task, tlCodeFrame* frame, tlHandle resuming) {
     tlArgs* call = null; // current call, if any
     int arg = 0; // current argument to a call
 
-    uint8_t op = 0; // current opcode
+    intptr_t op = 0; // current opcode
     tlHandle v = resuming? resuming : tlNull; // tmp result register
 
+#ifdef TL_COMPUTED_GOTO
+    static const void* const optable[256] = {
+        [0 ... 255] = &&L_unknown,
+        [OP_END] = &&L_OP_END,
+        [OP_TRUE] = &&L_OP_TRUE,
+        [OP_FALSE] = &&L_OP_FALSE,
+        [OP_NULL] = &&L_OP_NULL,
+        [OP_UNDEF] = &&L_OP_UNDEF,
+        [OP_INT] = &&L_OP_INT,
+        [OP_SYSTEM] = &&L_OP_SYSTEM,
+        [OP_MODULE] = &&L_OP_MODULE,
+        [OP_GLOBAL] = &&L_OP_GLOBAL,
+        [OP_ENVARG] = &&L_OP_ENVARG,
+        [OP_ENV] = &&L_OP_ENV,
+        [OP_ARG] = &&L_OP_ARG,
+        [OP_LOCAL] = &&L_OP_LOCAL,
+        [OP_ARGS] = &&L_OP_ARGS,
+        [OP_ENVARGS] = &&L_OP_ENVARGS,
+        [OP_THIS] = &&L_OP_THIS,
+        [OP_ENVTHIS] = &&L_OP_ENVTHIS,
+        [OP_BIND] = &&L_OP_BIND,
+        [OP_STORE] = &&L_OP_STORE,
+        [OP_RSTORE] = &&L_OP_RSTORE,
+        [OP_INVOKE] = &&L_OP_INVOKE,
+        [OP_CERR] = &&L_OP_CERR,
+        [OP_VGET] = &&L_OP_VGET,
+        [OP_VSTORE] = &&L_OP_VSTORE,
+        [OP_VRSTORE] = &&L_OP_VRSTORE,
+        [OP_EVGET] = &&L_OP_EVGET,
+        [OP_EVSTORE] = &&L_OP_EVSTORE,
+        [OP_EVRSTORE] = &&L_OP_EVRSTORE,
+        [OP_JUMP] = &&L_OP_JUMP,
+        [OP_JUMPT] = &&L_OP_JUMPT,
+        [OP_JUMPF] = &&L_OP_JUMPF,
+        [OP_MCALL ... 0xFF] = &&L_call,
+    };
+    static const void* const steptable[256] = {
+        [0 ... 255] = &&L_step,
+    };
+    const void* const* dispatch = debugger? steptable : optable;
+#endif
+
     // we did an invoke, and paused the task, but now the result is ready; see OP_INVOKE
     // or we did a resolve, which paused
     if (resuming || frame->stepping == 2) {
@@ -1336,9 +1825,10 @@ tlHandle beval(tlTask* task, tlCodeFrame* frame, tlHandle resuming) {
     }
 
 again:;
+#ifndef TL_COMPUTED_GOTO
     if (debugger && frame->stepping == 1) {
         frame->pc = pc;
-        frame->calls[calltop].at = arg;
+        if (calltop >= 0) frame->calls[calltop].at = arg;
         task->value = v;
         if (!tlDebuggerStep(debugger, task, frame)) {
             frame->stepping = 2;
@@ -1347,35 +1837,64 @@ again:;
         }
     }
     if (debugger && !frame->stepping) frame->stepping = 1;
+#endif
 
     if (tlBCallIsLazy(call, arg)) {
         trace("LAZY %d[%d]", calltop, arg - 2);
-        v = create_lazy(ops, bcode->size, &pc, args, frame->locals);
+        v = create_lazy(ops, &pc, frame);
         tlBCallAdd_(call, v, arg++);
         goto again;
     }
 
-    if (pc < 0 || pc > bcode->size) fatal("bad pc: %d", pc);
+    assert(pc >= 0 && pc < bcode->isize);
     frame->pc = pc;
     op = ops[pc++];
+#ifdef TL_COMPUTED_GOTO
+    goto *dispatch[op];
+
+L_step:
+    // only reached with a debugger attached, frame->pc is still at the op about to be executed
+    if (frame->stepping == 1) {
+        if (calltop >= 0) frame->calls[calltop].at = arg;
+        task->value = v;
+        if (!tlDebuggerStep(debugger, task, frame)) {
+            frame->stepping = 2;
+            trace("pausing for debugger");
+            return null;
+        }
+    }
+    if (!frame->stepping) frame->stepping = 1;
+    goto *optable[op];
+#endif
+
     if (!op) {
+#ifdef TL_COMPUTED_GOTO
+L_OP_END:
+#endif
         assert(v);
         tlTaskPopFrame(task, (tlFrame*)frame);
+        tlFrameArenaRelease(task, frame);
         return v; // OP_END
     }
     assert(op & 0xC0);
 
     // is it a call
     if (op & 0x20) {
-        int size = pcreadsize(ops, &pc);
-        trace("%d call op: 0x%X %s - %d", pc, op, op_name(op), size);
+#ifdef TL_COMPUTED_GOTO
+L_call:;
+#endif
+        int size = ops[pc];
+        tlList* names = (tlList*)ops[pc + 1];
+        int site = ops[pc + 2];
+        trace("%d call op: 0x%X %s - %d", pc, (int)op, op_name(op), size);
 
         if (op == OP_CCALL) {
             if (!tl_bool(v)) {
-                pc = skip_ccall(ops, bcode->size, pc); // predicate is false, skip this clause
+                pc = ops[pc + 3]; // predicate is false, skip this clause
                 goto again;
             }
         }
+        pc += ICALL_SIZE - 1;
 
         // create a new call
         if (calltop >= 0) {
@@ -1384,7 +1903,7 @@ again:;
             trace("push call: %d: %d %s", calltop, arg, tl_str(call));
         }
         arg = 0;
-        call = tlArgsNewNames(size, op & 0x10, (op & 0x7) == 0 || op == OP_SCALL); // size, hasNames, isMethod
+        call = args_take(task, size, op & 0x10, (op & 0x7) == 0 || op == OP_SCALL); // size, hasNames, isMethod
         if (op == OP_SCALL) tlArgsMakeSetter_(call);
         calltop++;
         assert(calltop >= 0 && calltop < bcode->calldepth);
@@ -1394,11 +1913,10 @@ again:;
         frame->calls[calltop].safe = false;
         frame->calls[calltop].bcall = false;
         frame->calls[calltop].ccall = op == OP_CCALL;
+        frame->calls[calltop].site = site;
 
         // load names if it is a named call
-        if (op & 0x10) {
-            int at = pcreadsize(ops, &pc);
-            tlList* names = tlListAs(tlListGet(data, at));
+        if (names) {
             trace("set names: %s", tl_repr(names));
             tlArgsSetNames_(call, names, 0);
 #ifdef HAVE_ASSERT
@@ -1421,23 +1939,26 @@ again:;
             trace("binary call");
             frame->calls[calltop].bcall = true;
         }
-        goto again;
+        DISPATCH();
     }
 
-    trace("%d data op: 0x%X %s", pc, op, op_name(op));
+    trace("%d data op: 0x%X %s", pc, (int)op, op_name(op));
     int at;
     int depth;
 
     switch (op) {
-        case OP_INVOKE: {
+        TARGET(OP_INVOKE): {
             assert(tlTaskCurrentFrame(task) == (tlFrame*)frame);
             assert(call);
             assert(arg - 2 == tlArgsRawSizeInline(call)); // must be done with args here
 
             tlArgs* invoke = call;
             trace("%p invoke: %s %s", frame, tl_str(invoke), tl_str(invoke->fn));
+            int aftercerr = ops[pc++];
             if (frame->calls[calltop].ccall) {
-                pc = skip_pcalls(ops, bcode->size, pc); // about to execute a true clause, skip any others
+                // about to execute a true clause, skip any others
+                if (aftercerr < 0) fatal("bytecode invalid");
+                pc = aftercerr;
             }
             frame->pc = pc;
 
@@ -1458,6 +1979,25 @@ again:;
                 arg = 0;
             }
 
+            // a tail call, or a goto out of this function, continues in this frame, see frame_tailcall
+            if ((calltop < 0 && !frame->handler && ends_code(ops, pc)) || (calltop == 0 && is_frame_exit(frame, call))) {
+                if (frame_tailcall(task, frame, invoke, call && call->fn == g_goto_native)) {
+                    frame->calls[0] = (CallEntry){ .call = null };
+                    calltop = -1;
+                    call = null;
+                    arg = 0;
+                    args = invoke;
+                    closure = tlBClosureAs(args->fn);
+                    bcode = closure->code;
+                    mod = bcode->mod;
+                    ops = bcode->icode;
+                    pc = 0;
+                    v = tlNull;
+                    debug_trace_frame(task, frame, args);
+                    DISPATCH();
+                }
+            }
+
             // check if it is a goto call, and if so, remove all stack frames and jump to the invoke
             if (call && call->fn == g_goto_native) {
                 // check arguments to goto
@@ -1482,24 +2022,28 @@ again:;
                     frame->invoke = invoke;
                     assert(frame->bcall == 1);
                 }
+            } else if ((v = native_op_inline(invoke))) {
+                args_give(task, invoke);
             } else {
                 v = tlInvoke(task, invoke);
+                // natives that completed without capturing their args, hand the args back for reuse
+                if (v && v != invoke && tlNativeNoCapture(tlArgsFnInline(invoke))) args_give(task, invoke);
             }
             if (!v) return null;
             trace("%p after: %d", frame, pc);
             assert(tlTaskCurrentFrame(task) == (tlFrame*)frame);
             break;
         }
-        case OP_CERR: {
+        TARGET(OP_CERR): {
             TL_THROW_NORETURN("no branch taken");
             // TODO remove this duplication
             if (calltop >= 0) frame->calls[calltop].at = arg; // mark as current
             trace("pause attach: %s pc: %d", tl_str(frame), frame->pc);
             return null;
         }
-        case OP_SYSTEM: {
+        TARGET(OP_SYSTEM): {
             // TODO make useful or remove ...
-            at = pcreadsize(ops, &pc);
+            at = ops[pc++];
             UNUSED(at);
             //tlHandle n = tlListGet(data, at);
             //if (n == s_createobject) {
@@ -1509,13 +2053,12 @@ again:;
             //v = tlNull;
             break;
         }
-        case OP_MODULE:
-            at = pcreadsize(ops, &pc);
-            v = tlListGet(data, at);
+        TARGET(OP_MODULE):
+            v = (tlHandle)ops[pc++];
             trace("data %s", tl_str(v));
             break;
-        case OP_GLOBAL:
-            at = pcreadsize(ops, &pc);
+        TARGET(OP_GLOBAL):
+            at = ops[pc++];
             v = tlListGet(mod->linked, at);
             trace("linked %s (%s)", tl_str(v), tl_str(tlListGet(mod->links, at)));
             if (v == tlUnknown) {
@@ -1526,21 +2069,21 @@ again:;
                 return null;
             }
             break;
-        case OP_ENVARG: {
-            depth = pcreadsize(ops, &pc);
-            at = pcreadsize(ops, &pc);
+        TARGET(OP_ENVARG): {
+            depth = ops[pc++];
+            at = ops[pc++];
             assert(depth >= 0 && at >= 0);
-            tlEnv* parent = tlEnvGetParentAt(closure->env, depth);
+            tlEnv* parent = tlBClosureEnvAt(closure, depth);
             v = tlEnvGetArg(parent, at);
             assert(v);
             trace("envarg[%d][%d] -> %s", depth, at, tl_str(v));
             break;
         }
-        case OP_ENV: {
-            depth = pcreadsize(ops, &pc);
-            at = pcreadsize(ops, &pc);
+        TARGET(OP_ENV): {
+            depth = ops[pc++];
+            at = ops[pc++];
             assert(depth >= 0 && at >= 0);
-            tlEnv* parent = tlEnvGetParentAt(closure->env, depth);
+            tlEnv* parent = tlBClosureEnvAt(closure, depth);
             assert(parent);
             v = tlEnvGetVar(parent, at); // TODO only for/until OP_EVGET
             assert(v);
@@ -1548,32 +2091,32 @@ again:;
             trace("env[%d][%d] -> %s", depth, at, tl_str(v));
             break;
         }
-        case OP_ARG:
-            at = pcreadsize(ops, &pc);
+        TARGET(OP_ARG):
+            at = ops[pc++];
             v = tlBCallGetExtra(args, at, bcode);
             trace("arg[%d] %s", at, tl_str(v));
             break;
-        case OP_LOCAL:
-            at = pcreadsize(ops, &pc);
+        TARGET(OP_LOCAL):
+            at = ops[pc++];
             assert(at >= 0 && at < bcode->locals);
             v = tlEnvGetVar(frame->locals, at); // TODO only for/until OP_VGET
             assert(v); // or throw? or undefined?
             if (!v) v = tlNull;
             trace("local %d -> %s", at, tl_str(v));
             break;
-        case OP_ARGS:
+        TARGET(OP_ARGS):
             v = args;
             trace("args: %s", tl_str(v));
             break;
-        case OP_ENVARGS: {
-            depth = pcreadsize(ops, &pc);
-            tlEnv* parent = tlEnvGetParentAt(closure->env, depth);
+        TARGET(OP_ENVARGS): {
+            depth = ops[pc++];
+            tlEnv* parent = tlBClosureEnvAt(closure, depth);
             v = parent->args;
             assert(v);
             trace("envargs[%d] -> %s", depth, tl_str(v));
             break;
         }
-        case OP_THIS: {
+        TARGET(OP_THIS): {
             // TODO is this needed, compiler can figure out the exact this
             v = tlArgsTargetInline(args);
             tlEnv* env = frame->locals;
@@ -1586,9 +2129,9 @@ again:;
             if (!v) v = tlNull;
             break;
         }
-        case OP_ENVTHIS: {
-            depth = pcreadsize(ops, &pc);
-            tlEnv* env = tlEnvGetParentAt(closure->env, depth);
+        TARGET(OP_ENVTHIS): {
+            depth = ops[pc++];
+            tlEnv* env = tlBClosureEnvAt(closure, depth);
             v = tlArgsTargetInline(env->args);
             trace("this: %s (%s)", tl_str(args), tl_str(v));
             while (!v && env) {
@@ -1600,90 +2143,116 @@ again:;
             trace("envthis[%d] -> %s", depth, tl_str(v));
             break;
         }
-        case OP_BIND:
-            at = pcreadsize(ops, &pc);
-            v = tlListGet(data, at);
-            v = tlBClosureNew(tlBCodeAs(v), frame->locals);
+        TARGET(OP_BIND):
+            v = bclosureNew((tlBCode*)ops[pc++], frame_locals_escape(frame), closure);
             trace("%d bind %s", pc, tl_str(v));
             break;
-        case OP_STORE:
-            at = pcreadsize(ops, &pc);
+        TARGET(OP_STORE):
+            at = ops[pc++];
             assert(at >= 0 && at < bcode->locals);
             tlEnvSet_(frame->locals, at, tlFirst(v));
             trace("store %d <- %s", at, tl_str(v));
             break;
-        case OP_RSTORE: {
-            int rat = pcreadsize(ops, &pc);
+        TARGET(OP_RSTORE): {
+            int rat = ops[pc++];
             tlHandle res = tlResultGet(v, rat);
-            at = pcreadsize(ops, &pc);
+            at = ops[pc++];
             tlEnvSet_(frame->locals, at, res);
             trace("result %d <- %s (%d %s)", at, tl_str(res), rat, tl_str(v));
             break;
         }
         // TODO these all need to be thread safe, when we support multithreading again
-        case OP_VGET: {
-            at = pcreadsize(ops, &pc);
+        TARGET(OP_VGET): {
+            at = ops[pc++];
             assert(at >= 0 && at < bcode->locals);
             v = tlEnvGetVar(frame->locals, at);
             if (!v) v = tlNull; // TODO tlUndefined or throw?
             trace("vget %d -> %s", at, tl_str(v));
             break;
         }
-        case OP_VSTORE: {
-            at = pcreadsize(ops, &pc);
+        TARGET(OP_VSTORE): {
+            at = ops[pc++];
             assert(at >= 0 && at < bcode->locals);
             tlEnvSetVar_(frame->locals, at, tlFirst(v));
             trace("vstore %d <- %s", at, tl_str(v));
             break;
         }
-        case OP_VRSTORE: {
-            int rat = pcreadsize(ops, &pc);
+        TARGET(OP_VRSTORE): {
+            int rat = ops[pc++];
             tlHandle res = tlResultGet(v, rat);
-            at = pcreadsize(ops, &pc);
+            at = ops[pc++];
             tlEnvSetVar_(frame->locals, at, res);
             trace("rvstore %d <- %s (%d %s)", at, tl_str(res), rat, tl_str(v));
             break;
         }
-        case OP_EVGET: {
-            depth = pcreadsize(ops, &pc);
-            at = pcreadsize(ops, &pc);
+        TARGET(OP_EVGET): {
+            depth = ops[pc++];
+            at = ops[pc++];
             assert(depth >= 0 && at >= 0);
-            tlEnv* parent = tlEnvGetParentAt(closure->env, depth);
+            tlEnv* parent = tlBClosureEnvAt(closure, depth);
             assert(parent);
             v = tlEnvGetVar(parent, at);
             assert(v);
             trace("env[%d][%d] -> %s", depth, at, tl_str(v));
             break;
         }
-        case OP_EVSTORE: {
-            depth = pcreadsize(ops, &pc);
-            at = pcreadsize(ops, &pc);
+        TARGET(OP_EVSTORE): {
+            depth = ops[pc++];
+            at = ops[pc++];
             assert(depth >= 0 && at >= 0);
-            tlEnv* parent = tlEnvGetParentAt(closure->env, depth);
+            tlEnv* parent = tlBClosureEnvAt(closure, depth);
             assert(parent);
             tlEnvSetVar_(parent, at, v);
             trace("env[%d][%d] <- %s", depth, at, tl_str(v));
             break;
         }
-        case OP_EVRSTORE: {
-            int rat = pcreadsize(ops, &pc);
+        TARGET(OP_EVRSTORE): {
+            int rat = ops[pc++];
             tlHandle res = tlResultGet(v, rat);
-            depth = pcreadsize(ops, &pc);
-            at = pcreadsize(ops, &pc);
+            depth = ops[pc++];
+            at = ops[pc++];
             assert(depth >= 0 && at >= 0);
-            tlEnv* parent = tlEnvGetParentAt(closure->env, depth);
+            tlEnv* parent = tlBClosureEnvAt(closure, depth);
             assert(parent);
             tlEnvSet_(parent, at, res);
             trace("env[%d][%d] <- %s (%d %s)", depth, at, tl_str(res), rat, tl_str(v));
             break;
         }
 
-        case OP_TRUE: v = tlTrue; break;
-        case OP_FALSE: v = tlFalse; break;
-        case OP_NULL: v = tlNull; break;
-        case OP_UNDEF: v = tlUndef(); break;
-        case OP_INT: v = tlINT(pcreadsize(ops, &pc)); break;
-        default: fatal("unknown op: %d (%s)", op, op_name(op));
+        // jumps leave v alone, the compiler uses that for the value of and/or
+        TARGET(OP_JUMP): {
+            assert(!call);
+            int target = ops[pc];
+            if (target <= pc && !tlTaskTick(task)) {
+                // a loop, but out of quota, yield and continue at target when resumed
+                frame->pc = target;
+                if (tlTaskHasError(task)) return null;
+                tlTaskWaitFor(task, null);
+                tlTaskReady(task);
+                return null;
+            }
+            pc = target;
+            DISPATCH();
+        }
+        TARGET(OP_JUMPT):
+            assert(!call);
+            pc = tl_bool(v)? ops[pc] : pc + 1;
+            DISPATCH();
+        TARGET(OP_JUMPF):
+            assert(!call);
+            pc = tl_bool(v)? pc + 1 : ops[pc];
+            DISPATCH();
+
+        TARGET(OP_TRUE): v = tlTrue; break;
+        TARGET(OP_FALSE): v = tlFalse; break;
+        TARGET(OP_NULL): v = tlNull; break;
+        TARGET(OP_UNDEF): v = tlUndef(); break;
+        TARGET(OP_INT): v = (tlHandle)ops[pc++]; break;
+        default:
+#ifdef TL_COMPUTED_GOTO
+L_unknown:
+#endif
+            fatal("unknown op: %d (%s)", (int)op, op_name(op));
     }
 
 resume:;
@@ -1718,9 +2287,10 @@ resume:;
     if (!call) {
         if (frame->lazy) {
             tlTaskPopFrame(task, (tlFrame*)frame);
+            tlFrameArenaRelease(task, frame);
             return v; // if we were evaulating a lazy call, and we are back at "top", OP_END
         }
-        goto again;
+        DISPATCH();
     }
 
     // set the data to the call
@@ -1732,7 +2302,7 @@ resume:;
     if (arg == 2 && target && tlStringIs(call->fn)) {
         tlSym mname = tlSymFromString(call->fn);
         bool safe = frame->calls[calltop].safe;
-        tlHandle method = bmethodResolve(target, mname, safe);
+        tlHandle method = bmethodResolveCached(bcode, frame->calls[calltop].site, target, mname, safe);
         trace("method resolve: %s %s", tl_str(call->fn), tl_str(method));
         if (!method && !safe) {
             TL_THROW_NORETURN("'%s' is not a property of '%s'", tl_str(mname), tl_str(target));
@@ -1756,7 +2326,7 @@ resume:;
             // skip forward in bytecode until so many invokes are skipped
             trace("skipping: %d, top: %d, pc: %d", skip, calltop, pc);
             //disasm(bcode);
-            pc = skip_safe_invokes(ops, bcode->size, pc, skip);
+            pc = skip_safe_invokes(ops, pc, skip);
             trace("skipped: %d, top: %d, pc: %d", skip, calltop, pc);
 
             v = tlNull;
@@ -1772,6 +2342,7 @@ resume:;
                 call = null;
                 if (frame->lazy) {
                     tlTaskPopFrame(task, (tlFrame*)frame);
+                    tlFrameArenaRelease(task, frame);
                     return v; // if we were evaulating a lazy call, and we are back at "top", OP_END
                 }
             }
@@ -1780,9 +2351,440 @@ resume:;
         tlArgsSetMethod_(call, mname);
         call->fn = method;
     }
-    goto again;
+    DISPATCH();
 }
 
+#ifdef TL_JIT
+
+// Hot code is compiled by jit.c into a sequence of calls to the handlers below, one per op, with
+// the operands passed as constants. The handlers mirror the ops in beval, keeping the frame and its
+// call stack exactly as beval would. So whenever the jitted code cannot continue, like when a task
+// suspends, a debugger attaches, or a safe method call does not resolve, beval can take over.
+
+#define JIT_HOT_CALLS 100
+#define JIT_REFUSED ((void*)1)
+#define JIT_COMPILING ((void*)2)
+
+typedef struct JitState {
+    tlTask* task;
+    tlCodeFrame* frame;
+    tlArgs* args;
+    tlBClosure* closure;
+    tlBCode* bcode;
+    const intptr_t* ops;
+    int pc; // target of a TL_JIT_JUMP
+    int calltop;
+    int arg;
+    tlArgs* call;
+    tlHandle v;
+    tlHandle result; // result of the frame, once TL_JIT_EXIT is returned
+} JitState;
+
+// let beval continue this frame, from the op at next, with v as the result of the current op
+static int jit_interpret(JitState* s, tlHandle v, int next) {
+    s->frame->pc = next;
+    if (s->calltop >= 0) s->frame->calls[s->calltop].at = s->arg;
+    s->result = beval(s->task, s->frame, v);
+    return TL_JIT_EXIT;
+}
+
+static int jit_lazy(JitState* s, int pc) {
+    s->v = create_lazy(s->ops, &pc, s->frame);
+    tlBCallAdd_(s->call, s->v, s->arg++);
+    s->pc = pc;
+    return TL_JIT_JUMP;
+}
+
+#define JIT_BEGIN(s) \
+    JitState* s = (JitState*)state; \
+    if (s->call && tlBCallIsLazy(s->call, s->arg)) return jit_lazy(s, pc); \
+    s->frame->pc = pc
+
+// like the resume: part of beval, without bcalls
+static int jit_load(JitState* s, tlHandle v, int next) {
+    s->v = v;
+    tlArgs* call = s->call;
+    if (!call) return TL_JIT_NEXT;
+
+    CallEntry* entry = &s->frame->calls[s->calltop];
+    if (s->arg == 1 && entry->safe) {
+        tlHandle target = tlArgsTargetInline(call);
+        tlHandle fn = tlFirst(v);
+        if (target && tlStringIs(fn)) {
+            tlHandle method = bmethodResolveCached(s->bcode, entry->site, target, tlSymFromString(fn), true);
+            if (!method) return jit_interpret(s, v, next);
+        }
+    }
+
+    tlBCallAdd_(call, tlFirst(v), s->arg++);
+    tlHandle target = tlArgsTargetInline(call);
+    if (s->arg == 2 && target && tlStringIs(call->fn)) {
+        tlSym mname = tlSymFromString(call->fn);
+        tlHandle method = bmethodResolveCached(s->bcode, entry->site, target, mname, entry->safe);
+        if (!method) {
+            tlTask* task = s->task;
+            TL_THROW_NORETURN("'%s' is not a property of '%s'", tl_str(mname), tl_str(target));
+            entry->at = s->arg;
+            s->result = null;
+            return TL_JIT_EXIT;
+        }
+        tlArgsSetMethod_(call, mname);
+        call->fn = method;
+    }
+    return TL_JIT_NEXT;
+}
+
+static int jit_end(void* state, int pc, intptr_t a, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    tlTaskPopFrame(s->task, (tlFrame*)s->frame);
+    tlFrameArenaRelease(s->task, s->frame);
+    s->result = s->v;
+    return TL_JIT_EXIT;
+}
+
+static int jit_call(void* state, int pc, intptr_t opsize, intptr_t names, intptr_t site) {
+    JIT_BEGIN(s);
+    int op = opsize & 0xFF;
+    int size = opsize >> 8;
+    if (op == OP_CCALL && !tl_bool(s->v)) {
+        s->pc = s->ops[pc + 4];
+        return TL_JIT_JUMP;
+    }
+
+    tlCodeFrame* frame = s->frame;
+    if (s->calltop >= 0) frame->calls[s->calltop].at = s->arg;
+    tlArgs* call = args_take(s->task, size, op & 0x10, (op & 0x7) == 0 || op == OP_SCALL);
+    if (op == OP_SCALL) tlArgsMakeSetter_(call);
+    s->calltop++;
+    assert(s->calltop < s->bcode->calldepth);
+    frame->calls[s->calltop] = (CallEntry){
+        .safe = (op & 0x08) != 0, .ccall = op == OP_CCALL, .bcall = false, .at = 0, .site = site, .call = call
+    };
+    if (names) tlArgsSetNames_(call, (tlList*)names, 0);
+    s->call = call;
+    s->arg = 0;
+    if (op & 0x07 && op != OP_SCALL) tlBCallAdd_(call, null, s->arg++);
+    return TL_JIT_NEXT;
+}
+
+static int jit_invoke(void* state, int pc, intptr_t aftercerr, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    tlTask* task = s->task;
+    tlCodeFrame* frame = s->frame;
+    tlArgs* invoke = s->call;
+    bool ccall = frame->calls[s->calltop].ccall;
+    int next = pc + 2;
+    if (ccall) {
+        if (aftercerr < 0) fatal("bytecode invalid");
+        next = aftercerr;
+    }
+    frame->pc = next;
+
+    frame->calls[s->calltop].at = 0;
+    frame->calls[s->calltop].call = null;
+    s->calltop--;
+    if (s->calltop >= 0) {
+        s->call = frame->calls[s->calltop].call;
+        s->arg = frame->calls[s->calltop].at;
+    } else {
+        s->call = null;
+        s->arg = 0;
+    }
+
+    // a tail call continues in this frame, calling itself from the top, anything else is left to beval
+    if ((s->calltop < 0 && !frame->handler && ends_code(s->ops, next)) || (s->calltop == 0 && is_frame_exit(frame, s->call))) {
+        if (frame_tailcall(task, frame, invoke, s->call && s->call->fn == g_goto_native)) {
+            frame->calls[0] = (CallEntry){ .call = null };
+            s->calltop = -1;
+            s->call = null;
+            s->arg = 0;
+            tlBClosure* closure = tlBClosureAs(invoke->fn);
+            if (closure->code != s->bcode) {
+                s->result = beval(task, frame, null);
+                return TL_JIT_EXIT;
+            }
+            s->args = invoke;
+            s->closure = closure;
+            s->v = tlNull;
+            s->pc = 0;
+            return TL_JIT_JUMP;
+        }
+    }
+
+    if (s->call && s->call->fn == g_goto_native) {
+        s->result = null;
+        if (tlArgsRawSizeInline(s->call) != 2) {
+            TL_THROW_NORETURN("goto requires a single argument");
+            return TL_JIT_EXIT;
+        }
+        unwindForGoto(task, tl_int(tlArgsGet(s->call, 0)), tlNull);
+        tlTaskPushResume(task, resumeBCall, invoke);
+        return TL_JIT_EXIT;
+    }
+
+    tlHandle v;
+    if ((v = native_op_inline(invoke))) {
+        args_give(task, invoke);
+    } else {
+        v = tlInvoke(task, invoke);
+        if (v && v != invoke && tlNativeNoCapture(tlArgsFnInline(invoke))) args_give(task, invoke);
+    }
+    // suspended or threw, when resumed, beval continues this frame, see resumeBFrame
+    if (!v) {
+        s->result = null;
+        return TL_JIT_EXIT;
+    }
+    assert(tlTaskCurrentFrame(task) == (tlFrame*)frame);
+    if (tlDebuggerFor(task)) return jit_interpret(s, v, next);
+
+    int r = jit_load(s, v, next);
+    if (r != TL_JIT_NEXT || !ccall) return r;
+    s->pc = next;
+    return TL_JIT_JUMP;
+}
+
+static int jit_cerr(void* state, int pc, intptr_t a, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    tlTask* task = s->task;
+    TL_THROW_NORETURN("no branch taken");
+    if (s->calltop >= 0) s->frame->calls[s->calltop].at = s->arg;
+    s->result = null;
+    return TL_JIT_EXIT;
+}
+
+static int jit_value(void* state, int pc, intptr_t value, intptr_t next, intptr_t c) {
+    JIT_BEGIN(s);
+    return jit_load(s, (tlHandle)value, next);
+}
+
+static int jit_undef(void* state, int pc, intptr_t a, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    return jit_load(s, tlUndef(), pc + 1);
+}
+
+static int jit_system(void* state, int pc, intptr_t a, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    return jit_load(s, tlEnvLocalObject((tlFrame*)s->frame), pc + 2);
+}
+
+static int jit_global(void* state, int pc, intptr_t at, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    tlBModule* mod = s->bcode->mod;
+    tlHandle v = tlListGet(mod->linked, at);
+    if (v == tlUnknown) {
+        tlTask* task = s->task;
+        TL_THROW_NORETURN("'%s' is not known", tl_str(tlListGet(mod->links, at)));
+        if (s->calltop >= 0) s->frame->calls[s->calltop].at = s->arg;
+        s->result = null;
+        return TL_JIT_EXIT;
+    }
+    return jit_load(s, v, pc + 2);
+}
+
+static int jit_envarg(void* state, int pc, intptr_t depth, intptr_t at, intptr_t c) {
+    JIT_BEGIN(s);
+    tlEnv* parent = tlBClosureEnvAt(s->closure, depth);
+    return jit_load(s, tlEnvGetArg(parent, at), pc + 3);
+}
+
+// also OP_EVGET
+static int jit_env(void* state, int pc, intptr_t depth, intptr_t at, intptr_t c) {
+    JIT_BEGIN(s);
+    tlEnv* parent = tlBClosureEnvAt(s->closure, depth);
+    tlHandle v = tlEnvGetVar(parent, at);
+    return jit_load(s, v? v : tlNull, pc + 3);
+}
+
+static int jit_arg(void* state, int pc, intptr_t at, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    return jit_load(s, tlBCallGetExtra(s->args, at, s->bcode), pc + 2);
+}
+
+// also OP_VGET
+static int jit_local(void* state, int pc, intptr_t at, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    tlHandle v = tlEnvGetVar(s->frame->locals, at);
+    return jit_load(s, v? v : tlNull, pc + 2);
+}
+
+static int jit_args(void* state, int pc, intptr_t a, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    return jit_load(s, s->args, pc + 1);
+}
+
+static int jit_envargs(void* state, int pc, intptr_t depth, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    return jit_load(s, tlBClosureEnvAt(s->closure, depth)->args, pc + 2);
+}
+
+static int jit_this(void* state, int pc, intptr_t a, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    tlHandle v = tlArgsTargetInline(s->args);
+    tlEnv* env = s->frame->locals;
+    while (!v && env) {
+        env = env->parent;
+        if (env) v = tlArgsTargetInline(env->args);
+    }
+    return jit_load(s, v? v : tlNull, pc + 1);
+}
+
+static int jit_envthis(void* state, int pc, intptr_t depth, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    tlEnv* env = tlBClosureEnvAt(s->closure, depth);
+    tlHandle v = tlArgsTargetInline(env->args);
+    while (!v && env) {
+        env = env->parent;
+        if (env) v = tlArgsTargetInline(env->args);
+    }
+    return jit_load(s, v? v : tlNull, pc + 2);
+}
+
+static int jit_bind(void* state, int pc, intptr_t code, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    return jit_load(s, bclosureNew((tlBCode*)code, frame_locals_escape(s->frame), s->closure), pc + 2);
+}
+
+static int jit_store(void* state, int pc, intptr_t at, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    tlEnvSet_(s->frame->locals, at, tlFirst(s->v));
+    return jit_load(s, s->v, pc + 2);
+}
+
+static int jit_rstore(void* state, int pc, intptr_t rat, intptr_t at, intptr_t c) {
+    JIT_BEGIN(s);
+    tlEnvSet_(s->frame->locals, at, tlResultGet(s->v, rat));
+    return jit_load(s, s->v, pc + 3);
+}
+
+static int jit_vstore(void* state, int pc, intptr_t at, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    tlEnvSetVar_(s->frame->locals, at, tlFirst(s->v));
+    return jit_load(s, s->v, pc + 2);
+}
+
+static int jit_vrstore(void* state, int pc, intptr_t rat, intptr_t at, intptr_t c) {
+    JIT_BEGIN(s);
+    tlEnvSetVar_(s->frame->locals, at, tlResultGet(s->v, rat));
+    return jit_load(s, s->v, pc + 3);
+}
+
+static int jit_evstore(void* state, int pc, intptr_t depth, intptr_t at, intptr_t c) {
+    JIT_BEGIN(s);
+    tlEnvSetVar_(tlBClosureEnvAt(s->closure, depth), at, s->v);
+    return jit_load(s, s->v, pc + 3);
+}
+
+static int jit_evrstore(void* state, int pc, intptr_t rat, intptr_t depth, intptr_t at) {
+    JIT_BEGIN(s);
+    tlEnvSet_(tlBClosureEnvAt(s->closure, depth), at, tlResultGet(s->v, rat));
+    return jit_load(s, s->v, pc + 4);
+}
+
+static int jit_jump(void* state, int pc, intptr_t target, intptr_t b, intptr_t c) {
+    JIT_BEGIN(s);
+    tlTask* task = s->task;
+    if (target <= pc && !tlTaskTick(task)) {
+        s->frame->pc = target;
+        s->result = null;
+        if (tlTaskHasError(task)) return TL_JIT_EXIT;
+        tlTaskWaitFor(task, null);
+        tlTaskReady(task);
+        return TL_JIT_EXIT;
+    }
+    s->pc = target;
+    return TL_JIT_JUMP;
+}
+
+// also OP_JUMPF, with when as false
+static int jit_jumpt(void* state, int pc, intptr_t target, intptr_t when, intptr_t c) {
+    JIT_BEGIN(s);
+    if (tl_bool(s->v) != when) return TL_JIT_NEXT;
+    s->pc = target;
+    return TL_JIT_JUMP;
+}
+
+// returns null for code the jit does not handle, like binary calls
+static tlJitEntryFn jit_compile(tlBCode* bcode) {
+    const intptr_t* ops = bcode->icode;
+    tlJitCode* code = tlJitCodeNew(bcode->isize, offsetof(JitState, pc));
+    for (int pc = 0; pc < bcode->isize; pc += iop_size(ops[pc])) {
+        intptr_t op = ops[pc];
+        if (op & 0x20) {
+            if ((op & 0x07) == 2) return null; // OP_BCALL and OP_BCALLN
+            tlJitCodeOp(code, pc, jit_call, 3, op | ops[pc + 1] << 8, ops[pc + 2], ops[pc + 3]);
+            continue;
+        }
+        switch (op) {
+            case OP_END: tlJitCodeOp(code, pc, jit_end, 0, 0, 0, 0); break;
+            case OP_TRUE: tlJitCodeOp(code, pc, jit_value, 2, (intptr_t)tlTrue, pc + 1, 0); break;
+            case OP_FALSE: tlJitCodeOp(code, pc, jit_value, 2, (intptr_t)tlFalse, pc + 1, 0); break;
+            case OP_NULL: tlJitCodeOp(code, pc, jit_value, 2, (intptr_t)tlNull, pc + 1, 0); break;
+            case OP_UNDEF: tlJitCodeOp(code, pc, jit_undef, 0, 0, 0, 0); break;
+            case OP_INT: case OP_MODULE: tlJitCodeOp(code, pc, jit_value, 2, ops[pc + 1], pc + 2, 0); break;
+            case OP_SYSTEM: tlJitCodeOp(code, pc, jit_system, 0, 0, 0, 0); break;
+            case OP_GLOBAL: tlJitCodeOp(code, pc, jit_global, 1, ops[pc + 1], 0, 0); break;
+            case OP_ENVARG: tlJitCodeOp(code, pc, jit_envarg, 2, ops[pc + 1], ops[pc + 2], 0); break;
+            case OP_ENV: case OP_EVGET: tlJitCodeOp(code, pc, jit_env, 2, ops[pc + 1], ops[pc + 2], 0); break;
+            case OP_ARG: tlJitCodeOp(code, pc, jit_arg, 1, ops[pc + 1], 0, 0); break;
+            case OP_LOCAL: case OP_VGET: tlJitCodeOp(code, pc, jit_local, 1, ops[pc + 1], 0, 0); break;
+            case OP_ARGS: tlJitCodeOp(code, pc, jit_args, 0, 0, 0, 0); break;
+            case OP_ENVARGS: tlJitCodeOp(code, pc, jit_envargs, 1, ops[pc + 1], 0, 0); break;
+            case OP_THIS: tlJitCodeOp(code, pc, jit_this, 0, 0, 0, 0); break;
+            case OP_ENVTHIS: tlJitCodeOp(code, pc, jit_envthis, 1, ops[pc + 1], 0, 0); break;
+            case OP_BIND: tlJitCodeOp(code, pc, jit_bind, 1, ops[pc + 1], 0, 0); break;
+            case OP_STORE: tlJitCodeOp(code, pc, jit_store, 1, ops[pc + 1], 0, 0); break;
+            case OP_RSTORE: tlJitCodeOp(code, pc, jit_rstore, 2, ops[pc + 1], ops[pc + 2], 0); break;
+            case OP_VSTORE: tlJitCodeOp(code, pc, jit_vstore, 1, ops[pc + 1], 0, 0); break;
+            case OP_VRSTORE: tlJitCodeOp(code, pc, jit_vrstore, 2, ops[pc + 1], ops[pc + 2], 0); break;
+            case OP_EVSTORE: tlJitCodeOp(code, pc, jit_evstore, 2, ops[pc + 1], ops[pc + 2], 0); break;
+            case OP_EVRSTORE: tlJitCodeOp(code, pc, jit_evrstore, 3, ops[pc + 1], ops[pc + 2], ops[pc + 3]); break;
+            case OP_INVOKE: tlJitCodeOp(code, pc, jit_invoke, 1, ops[pc + 1], 0, 0); break;
+            case OP_CERR: tlJitCodeOp(code, pc, jit_cerr, 0, 0, 0, 0); break;
+            case OP_JUMP: tlJitCodeOp(code, pc, jit_jump, 1, ops[pc + 1], 0, 0); break;
+            case OP_JUMPT: tlJitCodeOp(code, pc, jit_jumpt, 2, ops[pc + 1], true, 0); break;
+            case OP_JUMPF: tlJitCodeOp(code, pc, jit_jumpt, 2, ops[pc + 1], false, 0); break;
+            default: return null;
+        }
+    }
+    return tlJitCodeFinish(code);
+}
+
+// returns the compiled code, once the code has been called often enough
+static tlJitEntryFn jit_entry(tlBCode* bcode) {
+    void* jitcode = bcode->jitcode;
+    if (jitcode) return jitcode == JIT_REFUSED || jitcode == JIT_COMPILING? null : (tlJitEntryFn)jitcode;
+    if (++bcode->jitcalls < JIT_HOT_CALLS) return null;
+    if (!tlJitEnabled()) {
+        bcode->jitcode = JIT_REFUSED;
+        return null;
+    }
+
+    // claim the code before compiling, racing threads interpret it until the compiled code is set
+    if (a_swap_if(A_VAR(bcode->jitcode), A_VAL_NB(JIT_COMPILING), 0) != 0) return null;
+    tlJitEntryFn entry = jit_compile(bcode);
+    if (!entry) {
+        trace("jit refused: %s", tl_str(tlBCodeName(bcode)));
+        a_set(A_VAR(bcode->jitcode), A_VAL_NB(JIT_REFUSED));
+        return null;
+    }
+    a_set(A_VAR(bcode->jitcode), A_VAL_NB((void*)entry));
+    return entry;
+}
+
+static tlHandle jit_eval(tlTask* task, tlCodeFrame* frame, tlJitEntryFn entry) {
+    tlArgs* args = frame->locals->args;
+    tlBClosure* closure = tlBClosureAs(args->fn);
+    JitState s = {
+        .task = task, .frame = frame, .args = args, .closure = closure, .bcode = closure->code,
+        .ops = closure->code->icode, .calltop = -1, .v = tlNull,
+    };
+    debug_trace_frame(task, frame, args);
+    entry(&s);
+    return s.result;
+}
+
+#endif
+
 // get stack frame info from a single beval frame
 void tlCodeFrameGetInfo(tlFrame* _frame, tlString** file, tlString** function, tlInt* line) {
     tlCodeFrame* frame = tlCodeFrameAs(_frame);
@@ -1826,13 +2828,12 @@ static tlHandle _env_locals(tlTask* task, tlArgs* args) {
     tlBCode* code = tlBClosureAs(frame->locals->args->fn)->code;
     tlHashMap* res = tlHashMapNew();
 
-    const uint8_t* ops = code->code;
-    int pc = 0;
-    while (pc < frame->pc) {
-        uint8_t op = ops[pc++];
+    const intptr_t* ops = code->icode;
+    for (int pc = 0; pc < frame->pc; pc += iop_size(ops[pc])) {
+        intptr_t op = ops[pc];
         if (op == OP_STORE) {
             trace("OP: %s", op_name(op));
-            int at = pcreadsize(ops, &pc);
+            int at = ops[pc + 1];
             assert(at >= 0 && at < code->locals);
             tlHandle name = tlListGet(code->localnames, at);
             tlHandle v = tlEnvGet(frame->locals, at);
@@ -1894,11 +2895,10 @@ static tlHandle resumeBCall(tlTask* task, tlFrame* frame, tlHandle res, tlHandle
     return eval_args(task, call);
 }
 
-static tlHandle handleBFrameThrow(tlTask* task, tlCodeFrame* frame, tlHandle error) {
+static tlHandle handleBFrameThrow(tlTask* task, tlCodeFrame* frame, tlHandle handler, tlHandle error) {
     assert(tlTaskCurrentFrame(task) != (tlFrame*)frame);
     assert(tlTaskHasError(task));
 
-    tlHandle handler = frame->handler;
     tlArgs* call = null;
     if (tlBClosureIs(handler)) {
         trace("invoke closure as exception handler: %s %s(%s)", tl_str(frame), tl_str(handler), tl_str(error));
@@ -1923,14 +2923,48 @@ static tlHandle handleBFrameThrow(tlTask* task, tlCodeFrame* frame, tlHandle err
     return tlTaskClearError(task, handler);
 }
 
+// the compiler inlines loops into jumps, but break and continue still unwind as errors from calls
+// made inside the loop, like they would for the loop function, so we turn those into jumps here
+static bool handleBFrameLoopThrow(tlTask* task, tlCodeFrame* frame, tlHandle error) {
+    if (error != s_break && error != s_continue) return false;
+    if (frame->lazy) return false; // the pc is from the frame that created the lazy
+
+    tlBCode* bcode = tlBClosureAs(frame->locals->args->fn)->code;
+    int loop = -1;
+    for (int i = 0; i < bcode->loops; i++) {
+        int start = bcode->looppcs[i * 2];
+        int end = bcode->looppcs[i * 2 + 1];
+        if (frame->pc < start || frame->pc >= end) continue;
+        if (loop < 0 || start > bcode->looppcs[loop * 2]) loop = i; // innermost
+    }
+    if (loop < 0) return false;
+
+    trace("%s inside loop %d, pc: %d", tl_str(error), loop, frame->pc);
+    frame->pc = bcode->looppcs[loop * 2 + (error == s_break)];
+    for (int i = 0; i < bcode->calldepth; i++) frame->calls[i] = (CallEntry){ .call = null };
+    frame->bcall = 0;
+    frame->invoke = null;
+    tlTaskClearError(task, tlNull);
+    tlTaskPushFrame(task, (tlFrame*)frame);
+    return true;
+}
+
 static tlHandle resumeBFrame(tlTask* task, tlFrame* _frame, tlHandle value, tlHandle error) {
     trace("running resuming from a frame: %s value=%s, error=%s", tl_str(_frame), tl_str(value), tl_str(error));
     tlCodeFrame* frame = tlCodeFrameAs(_frame);
+    // a frame unwound by a throw, return or goto is done, release it before the handler runs, or
+    // the frames of code that keeps calling and unwinding pile up in the arena
     if (error) {
-        if (frame->handler) return handleBFrameThrow(task, frame, error);
+        if (handleBFrameLoopThrow(task, frame, error)) return null;
+        tlHandle handler = frame->handler;
+        tlFrameArenaRelease(task, frame);
+        if (handler) return handleBFrameThrow(task, frame, handler, error);
+        return null;
+    }
+    if (!value) {
+        tlFrameArenaRelease(task, frame);
         return null;
     }
-    if (!value) return null;
     assert(tlTaskValue(task) == value);
     return beval(task, frame, value);
 }
@@ -2011,9 +3045,9 @@ static tlHandle _module_frame(tlTask* task, tlArgs* args) {
         TL_THROW("frame requires Args as args[2]");
     }
     as->fn = fn;
-    tlCodeFrame* frame = tlCodeFrameNew(as, null);
+    tlCodeFrame* frame = tlCodeFrameNew(null, as, null);
     tlCodeFrame* link = tlCodeFrameCast(tlArgsGet(args, 2));
-    if (link) tlEnvLink_(frame->locals, link->locals, mod->body->localvars);
+    if (link) tlEnvLink_(frame->locals, frame_locals_escape(link), mod->body->localvars);
     return frame;
 }
 
@@ -2089,7 +3123,9 @@ static tlHandle _frame_allStored(tlTask* task, tlArgs* args) {
     tlBClosure* closure = tlBClosureAs(frame->locals->args->fn);
     tlBCode* code = closure->code;
 
-    int op = code->code[code->size - 3];
+    // find the last op before OP_END
+    intptr_t op = OP_END;
+    for (int pc = 0; code->icode[pc] != OP_END; pc += iop_size(code->icode[pc])) op = code->icode[pc];
     switch (op) {
         case OP_STORE: case OP_RSTORE: return tlTrue;
         case OP_VSTORE: case OP_VRSTORE: return tlTrue;
@@ -2124,7 +3160,7 @@ static tlHandle _module_run(tlTask* task, tlArgs* args) {
     if (!frame) {
         tlBClosure* fn = tlBClosureNew(mod->body, null);
         as->fn = fn; // as is a copy ...
-        frame = tlCodeFrameNew(as, null);
+        frame = tlCodeFrameNew(null, as, null);
     }
     trace("MODULE RUN: %s %s %s", tl_str(other), tl_str(frame), tl_str(as));
 
@@ -2359,20 +3395,16 @@ static tlHandle _bclosure_postable(tlTask* task, tlArgs* args) {
 static tlHandle _bclosure_bytecode(tlTask* task, tlArgs* args) {
     TL_TARGET(tlBClosure, fn);
     int opcount = 0;
-    const uint8_t* ops = fn->code->code;
+    const intptr_t* ops = fn->code->icode;
     assert(ops);
-    for (int i = 0; i < fn->code->size; i++) {
-        uint8_t op = ops[i];
-        if ((op & 0xC0) != 0xC0) continue;
+    for (int i = 0; ops[i] != OP_END; i += iop_size(ops[i])) {
         opcount += 1;
     }
 
     int at = 0;
     tlList* list = tlListNew(opcount);
-    for (int i = 0; i < fn->code->size; i++) {
-        uint8_t op = ops[i];
-        if ((op & 0xC0) != 0xC0) continue;
-        tlListSet_(list, at, tlSYM(op_name(op)));
+    for (int i = 0; ops[i] != OP_END; i += iop_size(ops[i])) {
+        tlListSet_(list, at, tlSYM(op_name(ops[i])));
         at += 1;
     }
     assert(tlListGet(list, opcount - 1));
@@ -2414,7 +3446,6 @@ static const tlNativeCbs __bcode_natives[] = {
     { "__list", __list },
     { "__map", __map },
     { "__object", __object },
-    { "return", __return },
     { "_env_locals", _env_locals },
     { "_env_current", _env_current },
     { "_disasm", _disasm },
@@ -2426,6 +3457,8 @@ void bcode_init() {
     tl_register_natives(__bcode_natives);
     g_goto_native = tlNativeNew(__goto, tlSYM("goto"));
     tl_register_global("goto", g_goto_native);
+    g_return_native = tlNativeNew(__return, tlSYM("return"));
+    tl_register_global("return", g_return_native);
     g_identity = tlNativeNew(_identity, tlSYM("identity"));
     tl_register_global("identity", g_identity);
 
@@ -17,6 +17,7 @@ enum {
     OP_CERR,                                                  // end of ccall (conditional) sequence (20)
     OP_VGET, OP_VSTORE, OP_VRSTORE,                           // 21-23, get and set mutables in local env
     OP_EVGET, OP_EVSTORE, OP_EVRSTORE,                        // 24-26, get and set mutables in parent env
+    OP_JUMP, OP_JUMPT, OP_JUMPF,                              // 27-29, jump, if true, if false; outside of calls only
     // upto 31 instructions possible
 
     // 0b1110_0000
@@ -36,6 +37,9 @@ TL_REF_TYPE(tlBLazy);
 TL_REF_TYPE(tlBLazyData);
 TL_REF_TYPE(tlBSendToken);
 
+typedef struct tlBSiteCache tlBSiteCache;
+typedef struct tlBArgMap tlBArgMap;
+
 struct tlBDebugInfo {
     tlHead head;
     tlString* name; // name of function
@@ -59,18 +63,55 @@ struct tlBCode {
     int calldepth;
     int size;
     const uint8_t* code;
+
+    // code translated by tlBCodeVerify into one word per op and per operand, see tlBCodeVerify
+    int isize;
+    const intptr_t* icode;
+
+    // inlined loops, as byte offsets of their start and end, translated into pairs of pcs by tlBCodeVerify
+    tlList* loopoffsets;
+    int loops;
+    const int* looppcs;
+
+    // named calls matched to the argspec, per names list, see argMapFor
+    tlBArgMap* argmaps;
+
+    // inline caches for method calls, indexed by the site operand of call ops
+    int sites;
+    tlBSiteCache** sitecaches;
+
+    // calls counted until the code is hot, then the compiled code, or a marker it is being or cannot be
+    // compiled; see jit.h
+    int jitcalls;
+    void* jitcode;
 };
 
 struct tlBClosure {
     tlHead head;
     tlBCode* code;
     tlEnv* env;
+    // env and all its parents, so OP_ENV and friends don't walk the parent chain, see tlBClosureEnvAt
+    int depth;
+    tlEnv* display[];
 };
 
+// kClosureUnlocked: a method that runs without the lock of its locked target, see tlInvoke; it must
+// only touch its target through other methods, which take the lock themselves
+enum { kClosureUnlocked = 1 };
+
+static inline bool tlBClosureUnlocked(tlHandle fn) {
+    return tlBClosureIs(fn) && tlflag_isset(fn, kClosureUnlocked);
+}
+
+static inline tlEnv* tlBClosureEnvAt(tlBClosure* closure, int depth) {
+    assert(depth >= 0);
+    return depth < closure->depth? closure->display[depth] : null;
+}
+
 typedef struct tlCodeFrame tlCodeFrame;
 
 // TODO something here ... use a max call size, and then bitfields for the booleans
-typedef struct CallEntry { bool safe; bool ccall; bool bcall; int at; tlArgs* call; } CallEntry;
+typedef struct CallEntry { bool safe; bool ccall; bool bcall; int at; int site; tlArgs* call; } CallEntry;
 struct tlCodeFrame {
     tlFrame frame;    // TODO move resumecb into tlCodeFrameKind
     tlEnv* locals;    // locals->args
@@ -80,7 +121,11 @@ struct tlCodeFrame {
     bool lazy;    // if this frame is evaluating a lazy invoke
     int8_t stepping; // if we are stepping
     int8_t bcall; // if this frame is evaluating part of a operator invoke
+    bool inlinelocals; // if locals are stored in this frame, see tlCodeFrameNew
+    bool escaped; // if closures or lazies might refer to the locals
     int pc;
+    int callsize;  // entries in calls, a tail call can reuse this frame for code that needs no more
+    int localsize; // if inlinelocals, the locals the frame has room for
     tlArgs* invoke; // current invoke, here for bcalls, TODO remove by optimizing
     CallEntry calls[];
 };
@@ -98,6 +143,9 @@ void tlCodeFrameDump(tlFrame* frame);
 void tlDumpTraceEvents(int count);
 tlTask* tlDumpTraceGetTask(int count);
 
+// call when methods of classes or objects are mutated in place, drops all method call site caches
+void tlBSiteCachesInvalidate();
+
 // so _super(this, name) can resolve to a field
 tlBLazyData* tlBLazyDataNew(tlHandle data);
 
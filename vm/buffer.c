@@ -8,6 +8,7 @@
 
 #include "value.h"
 #include "string.h"
+#include "native.h"
 
 #define INIT_SIZE 128
 #define MAX_SIZE_INCREMENT (8*1024)
@@ -494,6 +495,7 @@ void buffer_init() {
             "hexdump", _buffer_hexdump,
             null
     );
+    tlMethodsReadOnly(tlBufferKind->klass, "size", "find", "startsWith", null);
 }
 
 void buffer_init_vm(tlVm* vm) {
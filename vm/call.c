@@ -24,6 +24,14 @@ tlSym tlNativeName(tlNative* fn) {
 tlNative* tlNATIVE(tlNativeCb cb, const char* n) {
     return tlNativeNew(cb, tlSYM(n));
 }
+void tlMethodsReadOnly(tlObject* methods, const char* n1, ...) {
+    va_list ap;
+    va_start(ap, n1);
+    for (const char* n = n1; n; n = va_arg(ap, const char*)) {
+        tlflag_set(tlNativeAs(tlObjectGet(methods, tlSYM(n))), kNativeReadOnly);
+    }
+    va_end(ap);
+}
 
 // TODO this should be FromList ... below FromPairs ...
 tlArgs* tlBCallFromListNormal(tlHandle fn, tlList* list) {
@@ -14,16 +14,6 @@
 static tlKind _tlDebuggerKind;
 tlKind* tlDebuggerKind;
 
-// TODO a copy paste
-static inline int pcreadsize(const uint8_t* ops, int* pc) {
-    int res = 0;
-    while (true) {
-        uint8_t b = ops[(*pc)++];
-        if (b < 0x80) { return (res << 7) | b; }
-        res = (res << 6) | (b & 0x3F);
-    }
-}
-
 struct tlDebugger {
     tlHead head;
     bool running;
@@ -59,7 +49,7 @@ bool tlDebuggerStep(tlDebugger* debugger, tlTask* task, tlCodeFrame* frame) {
     if (debugger->running) return true;
 
     tlBClosure* closure = tlBClosureAs(frame->locals->args->fn);
-    const uint8_t* ops = closure->code->code;
+    const intptr_t* ops = closure->code->icode;
     ops = ops + 0;
     trace("step: %d %s", frame->pc, op_name(ops[frame->pc]));
 
@@ -104,7 +94,7 @@ static tlHandle returnStep(tlTask* task, tlFrame* frame, tlHandle res, tlHandle
         if (frame) {
             tlBClosure* closure = tlBClosureAs(frame->locals->args->fn);
             assert(closure);
-            const uint8_t* ops = closure->code->code;
+            const intptr_t* ops = closure->code->icode;
             return tlResultFrom(tlSYM(op_name(ops[frame->pc])), tlINT(frame->pc), closure, null);
         }
     }
@@ -118,20 +108,21 @@ static tlHandle _debugger_step(tlTask* task, tlArgs* args) {
     debugger->waiter = task;
     tlTaskPushResume(task, returnStep, debugger);
 
-    if (debugger->subject) {
-        tlTaskReadyExternal(debugger->subject);
-        debugger->subject = null;
-    }
+    // clear subject before readying it, it might step again on another worker right away
+    tlTask* subject = debugger->subject;
+    debugger->subject = null;
+    if (subject) tlTaskReadyExternal(subject);
     return null;
 }
 
 static tlHandle _debugger_continue(tlTask* task, tlArgs* args) {
     TL_TARGET(tlDebugger, debugger);
     debugger->running = true;
-    if (debugger->subject) {
-        if (!debugger->subject->value) debugger->subject->value = tlNull;
-        tlTaskReadyExternal(debugger->subject);
-        debugger->subject = null;
+    tlTask* subject = debugger->subject;
+    debugger->subject = null;
+    if (subject) {
+        if (!subject->value) subject->value = tlNull;
+        tlTaskReadyExternal(subject);
     }
     return tlNull;
 }
@@ -161,7 +152,7 @@ static tlHandle _debugger_op(tlTask* task, tlArgs* args) {
     if (!frame) return tlNull;
 
     tlBClosure* closure = tlBClosureAs(frame->locals->args->fn);
-    const uint8_t* ops = closure->code->code;
+    const intptr_t* ops = closure->code->icode;
     int pc = frame->pc;
     int op = ops[pc++];
     tlHandle name = tlSYM(op_name(op));
@@ -170,14 +161,16 @@ static tlHandle _debugger_op(tlTask* task, tlArgs* args) {
         case OP_TRUE: case OP_FALSE: case OP_NULL: case OP_UNDEF:
         case OP_INVOKE:
             return tlListFrom1(name);
-        case OP_INT:
-        case OP_GLOBAL: case OP_SYSTEM: case OP_MODULE: case OP_LOCAL: case OP_ARG:
-        case OP_BIND: case OP_STORE:
+        case OP_INT: case OP_MODULE: case OP_BIND:
+            return tlListFrom2(name, (tlHandle)ops[pc]);
+        case OP_GLOBAL: case OP_SYSTEM: case OP_LOCAL: case OP_ARG:
+        case OP_STORE:
         case OP_FCALL: case OP_MCALL: case OP_BCALL:
-            return tlListFrom2(name, tlINT(pcreadsize(ops, &pc)));
+            return tlListFrom2(name, tlINT(ops[pc]));
         case OP_ENV:
+            return tlListFrom3(name, tlINT(ops[pc]), tlINT(ops[pc + 1]));
         case OP_FCALLN: case OP_MCALLN: case OP_BCALLN:
-            return tlListFrom3(name, tlINT(pcreadsize(ops, &pc)), tlINT(pcreadsize(ops, &pc)));
+            return tlListFrom3(name, tlINT(ops[pc]), (tlHandle)ops[pc + 1]);
     }
     return tlNull;
 }
@@ -207,6 +207,7 @@ static tlHandle _install(tlTask* task, tlArgs* args) {
     if (!val) TL_THROW("expected a Value");
     // TODO some safety here?
     tlObjectSet_(map, sym, val);
+    tlBSiteCachesInvalidate();
     return tlNull;
 }
 
@@ -245,9 +246,18 @@ static tlHandle _install_method(tlTask* task, tlArgs* args) {
     tlHandle val = tlArgsGet(args, 2);
     if (!val) TL_THROW("expected a Value");
     tlObjectSet_(cls->methods, sym, val);
+    tlBSiteCachesInvalidate();
     return tlNull;
 }
 
+// mark a function so that, installed as a method on a locked kind, it runs without the lock
+static tlHandle _unlocked(tlTask* task, tlArgs* args) {
+    tlBClosure* fn = tlBClosureCast(tlArgsGet(args, 0));
+    if (!fn) TL_THROW("expected a Function");
+    tlflag_set(fn, kClosureUnlocked);
+    return fn;
+}
+
 tlHandle _with_lock(tlTask* task, tlArgs* args);
 tlHandle _has_lock(tlTask* task, tlArgs* args);
 tlHandle _String_cat(tlTask* task, tlArgs* args);
@@ -264,6 +274,7 @@ static const tlNativeCbs __eval_natives[] = {
     { "_install_global", _install_global },
     { "_install_constructor", _install_constructor },
     { "_install_method", _install_method },
+    { "_unlocked", _unlocked },
 
     { "catch", _catch },
 
@@ -1261,10 +1261,10 @@ static void io_cb(ev_io *ev, int revents) {
     if (revents & EV_READ) {
         trace("CANREAD: %d", ev->fd);
         assert(file->reader);
-        assert(file->reader->lock.owner);
-        tlTask* task = file->reader->lock.owner;
-        tlMessage* msg = tlMessageAs(file->reader->lock.owner->value);
-        tlVm* vm = tlTaskGetVm(file->reader->lock.owner);
+        tlTask* task = tlLockOwner(tlLockAs(file->reader));
+        assert(task);
+        tlMessage* msg = tlMessageAs(task->value);
+        tlVm* vm = tlTaskGetVm(task);
         if (!task->background) a_dec(&vm->waitevent);
         ev->events &= ~EV_READ;
         tlMessageReply(msg, null);
@@ -1272,9 +1272,9 @@ static void io_cb(ev_io *ev, int revents) {
     if (revents & EV_WRITE) {
         trace("CANWRITE: %d", ev->fd);
         assert(file->writer);
-        assert(file->writer->lock.owner);
-        tlTask* task = file->writer->lock.owner;
-        tlMessage* msg = tlMessageAs(file->writer->lock.owner->value);
+        tlTask* task = tlLockOwner(tlLockAs(file->writer));
+        assert(task);
+        tlMessage* msg = tlMessageAs(task->value);
         tlVm* vm = tlTaskGetVm(tlMessageGetSender(msg));
         if (!task->background) a_dec(&vm->waitevent);
         ev->events &= ~EV_WRITE;
@@ -1300,9 +1300,9 @@ static tlHandle _io_close(tlTask* task, tlArgs* args) {
     if (file->ev.events & EV_READ) {
         trace("CLOSED WITH READER");
         assert(file->reader);
-        assert(file->reader->lock.owner);
-        tlMessage* msg = tlMessageAs(file->reader->lock.owner->value);
-        tlTask* task = file->reader->lock.owner;
+        tlTask* task = tlLockOwner(tlLockAs(file->reader));
+        assert(task);
+        tlMessage* msg = tlMessageAs(task->value);
         tlVm* vm = tlVmCurrent(task);
         if (!task->background) a_dec(&vm->waitevent);
         file->ev.events &= ~EV_READ;
@@ -1311,9 +1311,9 @@ static tlHandle _io_close(tlTask* task, tlArgs* args) {
     if (file->ev.events & EV_WRITE) {
         trace("CLOSED WITH WRITER");
         assert(file->writer);
-        assert(file->writer->lock.owner);
-        tlMessage* msg = tlMessageAs(file->writer->lock.owner->value);
-        tlTask* task = file->writer->lock.owner;
+        tlTask* task = tlLockOwner(tlLockAs(file->writer));
+        assert(task);
+        tlMessage* msg = tlMessageAs(task->value);
         tlVm* vm = tlVmCurrent(task);
         if (!task->background) a_dec(&vm->waitevent);
         file->ev.events &= ~EV_WRITE;
@@ -1335,7 +1335,7 @@ static tlHandle _io_waitread(tlTask* task, tlArgs* args) {
     tlFile* file = tlFileFromReader(reader);
     assert(tlFileIs(file));
 
-    assert(reader->lock.owner == msg->sender);
+    assert(tlLockOwner(tlLockAs(reader)) == msg->sender);
     assert(msg->sender->value == msg);
 
     if (file->ev.fd < 0) TL_THROW("file is closed");
@@ -1360,7 +1360,7 @@ static tlHandle _io_waitwrite(tlTask* task, tlArgs* args) {
     tlFile* file = tlFileFromWriter(writer);
     assert(tlFileIs(file));
 
-    assert(writer->lock.owner == msg->sender);
+    assert(tlLockOwner(tlLockAs(writer)) == msg->sender);
     assert(msg->sender->value == msg);
 
     if (file->ev.fd < 0) TL_THROW("file is closed");
@@ -4,6 +4,7 @@
 
 #include "platform.h"
 #include "frame.h"
+#include "task.h"
 
 static tlKind _tlFrameKind = {
     .name = "Frame"
@@ -16,6 +17,87 @@ void* tlFrameAlloc(tlResumeCb cb, size_t bytes) {
     return frame;
 }
 
+// Frames of running code are allocated per task by bumping the top of a chunk. Once such a frame
+// returns, it and all frames allocated after it are dead, so the top is reset to that frame. Frames
+// unwound by a throw, return or goto release themselves the same way. Suspended tasks keep their
+// chunks, and frames handed out as values are allocated with tlFrameAlloc instead.
+// Frames are never moved to the heap when a task suspends, or when something captures the stack.
+// That is safe because nothing outlives a frame while pointing into it: a stack trace copies the
+// file, function and line of every frame (see tlStackTraceNew), and closures and lazies over the
+// locals of a frame get a heap env instead (see frame_locals_escape in bcode.c).
+// Memory above the top is kept zeroed, so new frames start out zeroed, like from tlAlloc, and the
+// collector does not see stale pointers in released frames. Only the header of the frame at the top
+// is left alone, as the caller of a frame that just returned is still read.
+#define CHUNK_FIRST 4096
+#define CHUNK_MAX (64 * 1024)
+
+struct tlFrameChunk {
+    tlFrameChunk* prev;
+    tlFrameChunk* next; // an empty chunk, kept for reuse
+    char* top;
+    char* end;
+    intptr_t data[];
+};
+
+static tlFrameChunk* chunkNext(tlTask* task) {
+    tlFrameChunk* chunk = task->frames;
+    if (chunk && chunk->next) return task->frames = chunk->next;
+
+    size_t size = CHUNK_FIRST;
+    if (chunk) size = chunk->end - (char*)chunk->data;
+    if (chunk && size < CHUNK_MAX) size *= 2;
+    tlFrameChunk* next = calloc(1, sizeof(tlFrameChunk) + size);
+    next->prev = chunk;
+    next->top = (char*)next->data;
+    next->end = next->top + size;
+    if (chunk) chunk->next = next;
+    return task->frames = next;
+}
+
+void* tlFrameArenaAlloc(tlTask* task, tlResumeCb cb, size_t bytes) {
+    if (bytes > CHUNK_FIRST) return tlFrameAlloc(cb, bytes);
+    tlFrameChunk* chunk = task->frames;
+    if (!chunk || chunk->top + bytes > chunk->end) chunk = chunkNext(task);
+
+    tlFrame* frame = (tlFrame*)chunk->top;
+    chunk->top += bytes;
+    frame->kind = (intptr_t)tlFrameKind;
+    frame->caller = null;
+    frame->resumecb = cb;
+    return frame;
+}
+
+// zero from at upto top, including the header that might have been left at top by an earlier release
+static void chunkClear(tlFrameChunk* chunk, char* at) {
+    char* upto = chunk->top + sizeof(tlFrame);
+    if (upto > chunk->end) upto = chunk->end;
+    if (upto > at) memset(at, 0, upto - at);
+}
+
+void tlFrameArenaRelease(tlTask* task, void* from) {
+    char* at = from;
+    tlFrameChunk* found = task->frames;
+    while (found && (at < (char*)found->data || at > found->top)) found = found->prev;
+    if (!found) return; // not from the arena
+
+    for (tlFrameChunk* chunk = task->frames; chunk != found; chunk = chunk->prev) {
+        chunkClear(chunk, (char*)chunk->data);
+        chunk->top = (char*)chunk->data;
+    }
+    chunkClear(found, at + sizeof(tlFrame));
+    found->top = at;
+    task->frames = found;
+}
+
+size_t tlFrameArenaSize(tlTask* task) {
+    size_t size = 0;
+    for (tlFrameChunk* chunk = task->frames; chunk; chunk = chunk->prev) size += chunk->end - (char*)chunk->data;
+    for (tlFrameChunk* chunk = task->frames? task->frames->next : null; chunk; chunk = chunk->next) {
+        size += chunk->end - (char*)chunk->data;
+    }
+    return size;
+}
+
 tlFrame* tlFrameSetResume(tlFrame* frame, tlResumeCb cb) {
     frame->resumecb = cb;
     return frame;
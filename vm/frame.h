@@ -4,6 +4,12 @@
 #include "tl.h"
 
 void* tlFrameAlloc(tlResumeCb cb, size_t bytes);
+
+// allocate a frame from the frame arena of task, release it and all frames allocated after it
+void* tlFrameArenaAlloc(tlTask* task, tlResumeCb cb, size_t bytes);
+void tlFrameArenaRelease(tlTask* task, void* from);
+// the bytes of all chunks of the frame arena of task
+size_t tlFrameArenaSize(tlTask* task);
 void tlFrameGetInfo(tlFrame* frame, tlString** file, tlString** function, tlInt* line);
 
 void frame_init();
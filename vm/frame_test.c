@@ -0,0 +1,58 @@
+// author: Onne Gorter, license: MIT (see license.txt)
+
+#include "platform.h"
+#include "tl.h"
+#include "frame.h"
+
+#include "tests.h"
+
+static size_t sizes[2];
+static int marks;
+
+static tlHandle _mark(tlTask* task, tlArgs* args) {
+    if (marks < 2) sizes[marks] = tlFrameArenaSize(task);
+    marks++;
+    return tlNull;
+}
+
+// run code as a script through init, with a mark() native that records the size of the frame arena
+static void runScript(const char* code) {
+    char file[] = "/tmp/frame_test_XXXXXX";
+    int fd = mkstemp(file);
+    if (fd < 0 || write(fd, code, strlen(code)) != (ssize_t)strlen(code)) fatal("unable to write: %s", file);
+    close(fd);
+
+    marks = 0;
+    setenv("TL_MODULE_PATH", "../modules", 1); // init needs io.tl, tests run from vm/
+    tlVm* vm = tlVmNew(tlSYM("frame_test"), tlArgsNew(0));
+    tlVmInitDefaultEnv(vm);
+    tlVmGlobalSet(vm, tlSYM("mark"), tlNativeNew(_mark, tlSYM("mark")));
+    tlArgs* args = tlArgsNew(1);
+    tlArgsSet_(args, 0, tlSTR(file));
+    tlVmEvalInit(vm, args);
+    tlVmDelete(vm);
+    unlink(file);
+}
+
+TEST(unwound_frames_released) {
+    runScript(
+        "f = n ->\n"
+        "    if n > 0: return n\n"
+        "    0\n"
+        "g = n -> throw \"oops\"\n"
+        "mark()\n"
+        "var i = 0\n"
+        "while i < 20000:\n"
+        "    f(i)\n"
+        "    try(g(i))\n"
+        "    i += 1\n"
+        "mark()\n"
+    );
+    REQUIRE(marks == 2);
+    REQUIRE(sizes[1] - sizes[0] < 64 * 1024);
+}
+
+int main(int argc, char** argv) {
+    tl_init();
+    RUN(unwound_frames_released);
+}
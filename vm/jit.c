@@ -0,0 +1,168 @@
+// author: Onne Gorter, license: MIT (see license.txt)
+
+// a baseline jit, emits x86-64 code that calls an op handler for every op in the bytecode
+
+// The code for a function looks like:
+//   dispatch: cmp eax, 1; jne exit; movsxd rax, [rbx + pc]; mov rcx, table; jmp [rcx + rax * 8]
+//   exit:     pop rbx; ret
+//   badpc:    mov rdi, rbx; mov rax, jit_badpc; call rax
+//   entry:    push rbx; mov rbx, rdi
+//   per op:   mov rdi, rbx; mov esi, pc; mov rdx/rcx/r8, operands; mov rax, fn; call rax
+//             test eax, eax; jnz dispatch
+// So control flow stays in native code, the handlers do the actual work. The table maps every pc to
+// the code of its op, for jumps. The state pointer lives in rbx, which handlers preserve.
+//
+// The table is placed in the mapped memory, after the code. Nothing but the code refers to it, and
+// the gc does not scan mapped memory, so a table allocated from the gc would be collected.
+
+#include "platform.h"
+#include "jit.h"
+
+#ifdef TL_JIT
+
+#include <sys/mman.h>
+
+// enough for the biggest op sequence: 3 + 5 + 3 * 10 + 10 + 2 + 2 + 6
+#define MAX_OP_BYTES 64
+
+struct tlJitCode {
+    int pcs;
+    int pcoffset;
+    int* offsets;  // offset into buf for each pc, or -1
+    int tableat;   // offset into buf of the table address, patched by tlJitCodeFinish
+
+    uint8_t* buf;
+    int len;
+    int size;
+
+    int dispatch;
+    int badpc;
+    int entry;
+};
+
+static int jit_disabled = -1;
+
+bool tlJitEnabled() {
+    if (jit_disabled < 0) {
+        const char* s = getenv("TL_NO_JIT");
+        jit_disabled = s && s[0] && strcmp(s, "0") != 0;
+    }
+    return !jit_disabled;
+}
+
+static void jit_badpc(void* state) {
+    fatal("jit: jump to a pc without code");
+}
+
+static void emit1(tlJitCode* code, uint8_t b) {
+    code->buf[code->len++] = b;
+}
+static void emit2(tlJitCode* code, uint8_t b1, uint8_t b2) {
+    emit1(code, b1); emit1(code, b2);
+}
+static void emit3(tlJitCode* code, uint8_t b1, uint8_t b2, uint8_t b3) {
+    emit1(code, b1); emit1(code, b2); emit1(code, b3);
+}
+static void emit32(tlJitCode* code, int32_t v) {
+    memcpy(code->buf + code->len, &v, 4);
+    code->len += 4;
+}
+static void emit64(tlJitCode* code, int64_t v) {
+    memcpy(code->buf + code->len, &v, 8);
+    code->len += 8;
+}
+
+static void ensure(tlJitCode* code, int bytes) {
+    if (code->len + bytes <= code->size) return;
+    code->size = code->size * 2 + bytes;
+    uint8_t* buf = malloc_atomic(code->size);
+    memcpy(buf, code->buf, code->len);
+    code->buf = buf;
+}
+
+tlJitCode* tlJitCodeNew(int pcs, int pcoffset) {
+    tlJitCode* code = malloc(sizeof(tlJitCode));
+    code->pcs = pcs;
+    code->pcoffset = pcoffset;
+    code->offsets = malloc_atomic(sizeof(int) * pcs);
+    for (int i = 0; i < pcs; i++) code->offsets[i] = -1;
+    code->size = 256 + pcs * 32;
+    code->buf = malloc_atomic(code->size);
+    code->len = 0;
+
+    code->dispatch = code->len;
+    emit3(code, 0x83, 0xF8, 0x01);                    // cmp eax, 1
+    emit2(code, 0x75, 0x14);                          // jne exit (+20)
+    emit3(code, 0x48, 0x63, 0x83); emit32(code, pcoffset); // movsxd rax, dword [rbx + pcoffset]
+    emit2(code, 0x48, 0xB9);                          // mov rcx, table
+    code->tableat = code->len; emit64(code, 0);
+    emit3(code, 0xFF, 0x24, 0xC1);                    // jmp qword [rcx + rax * 8]
+    assert(code->len - code->dispatch == 5 + 20);
+
+    emit1(code, 0x5B);                                // exit: pop rbx
+    emit1(code, 0xC3);                                // ret
+
+    code->badpc = code->len;
+    emit3(code, 0x48, 0x89, 0xDF);                    // mov rdi, rbx
+    emit2(code, 0x48, 0xB8); emit64(code, (intptr_t)jit_badpc); // mov rax, jit_badpc
+    emit2(code, 0xFF, 0xD0);                          // call rax
+
+    // entry, at entry rsp is 8 off from 16 byte alignment, the push fixes that for our calls
+    code->entry = code->len;
+    emit1(code, 0x53);                                // push rbx
+    emit3(code, 0x48, 0x89, 0xFB);                    // mov rbx, rdi
+    return code;
+}
+
+void tlJitCodeOp(tlJitCode* code, int pc, tlJitOpFn fn, int operands, intptr_t a, intptr_t b, intptr_t c) {
+    assert(pc >= 0 && pc < code->pcs);
+    assert(operands >= 0 && operands <= 3);
+    ensure(code, MAX_OP_BYTES);
+    code->offsets[pc] = code->len;
+
+    emit3(code, 0x48, 0x89, 0xDF);                    // mov rdi, rbx
+    emit1(code, 0xBE); emit32(code, pc);              // mov esi, pc
+    if (operands > 0) { emit2(code, 0x48, 0xBA); emit64(code, a); } // mov rdx, a
+    if (operands > 1) { emit2(code, 0x48, 0xB9); emit64(code, b); } // mov rcx, b
+    if (operands > 2) { emit2(code, 0x49, 0xB8); emit64(code, c); } // mov r8, c
+    emit2(code, 0x48, 0xB8); emit64(code, (intptr_t)fn); // mov rax, fn
+    emit2(code, 0xFF, 0xD0);                          // call rax
+    emit2(code, 0x85, 0xC0);                          // test eax, eax
+    emit2(code, 0x0F, 0x85);                          // jnz dispatch
+    emit32(code, code->dispatch - (code->len + 4));
+}
+
+tlJitEntryFn tlJitCodeFinish(tlJitCode* code) {
+    long pagesize = sysconf(_SC_PAGESIZE);
+    size_t tableoffset = (code->len + 7) & ~7;
+    size_t size = (tableoffset + sizeof(void*) * code->pcs + pagesize - 1) & ~(pagesize - 1);
+    uint8_t* mem = mmap(null, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        warning("jit: mmap failed: %s", strerror(errno));
+        return null;
+    }
+    memcpy(mem, code->buf, code->len);
+
+    void** table = (void**)(mem + tableoffset);
+    for (int pc = 0; pc < code->pcs; pc++) {
+        int offset = code->offsets[pc];
+        table[pc] = mem + (offset >= 0? offset : code->badpc);
+    }
+    memcpy(mem + code->tableat, &table, sizeof(table));
+
+    if (mprotect(mem, size, PROT_READ | PROT_EXEC)) {
+        warning("jit: mprotect failed: %s", strerror(errno));
+        munmap(mem, size);
+        return null;
+    }
+    return (tlJitEntryFn)(mem + code->entry);
+}
+
+#else
+
+bool tlJitEnabled() { return false; }
+tlJitCode* tlJitCodeNew(int pcs, int pcoffset) { return null; }
+void tlJitCodeOp(tlJitCode* code, int pc, tlJitOpFn fn, int operands, intptr_t a, intptr_t b, intptr_t c) { }
+tlJitEntryFn tlJitCodeFinish(tlJitCode* code) { return null; }
+
+#endif
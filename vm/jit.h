@@ -0,0 +1,30 @@
+#ifndef _jit_h_
+#define _jit_h_
+
+#include "tl.h"
+
+// a baseline jit for x86-64, turns bytecode into a sequence of calls to op handlers, see bcode.c
+// build with -DTL_NO_JIT to leave it out, or run with TL_NO_JIT=1 set to disable it
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(TL_NO_JIT)
+#define TL_JIT 1
+#endif
+
+// what an op handler returns: continue with the next op, jump to state->pc, or return from the code
+enum { TL_JIT_NEXT = 0, TL_JIT_JUMP = 1, TL_JIT_EXIT = 2 };
+
+// an op handler receives the state, the pc of its op, and up to 3 operands
+typedef int (*tlJitOpFn)(void* state, int pc, intptr_t a, intptr_t b, intptr_t c);
+typedef int (*tlJitEntryFn)(void* state);
+
+typedef struct tlJitCode tlJitCode;
+
+bool tlJitEnabled();
+
+// start code for pcs op positions, pcoffset is where the int pc is stored in state
+tlJitCode* tlJitCodeNew(int pcs, int pcoffset);
+// append a call to fn for the op at pc
+void tlJitCodeOp(tlJitCode* code, int pc, tlJitOpFn fn, int operands, intptr_t a, intptr_t b, intptr_t c);
+// make the code executable, returns the entry, which starts at pc 0
+tlJitEntryFn tlJitCodeFinish(tlJitCode* code);
+
+#endif
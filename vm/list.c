@@ -403,10 +403,14 @@ void list_init() {
         "join", null,
         "random", null,
         "each", null,
+        "peach", null,
         "find", null,
         "filter", null,
+        "pfilter", null,
         "map", null,
+        "pmap", null,
         "reduce", null,
+        "preduce", null,
         "min", null,
         "max", null,
         "sum", null,
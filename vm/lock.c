@@ -1,8 +1,27 @@
 // author: Onne Gorter, license: MIT (see license.txt)
 
 // lock is the "base" class for all mutable things, objects, files, buffers and more
-
-// TODO the "owner" part of this lock is not needed, the lqueue->head is perfectly good as the owner
+//
+// A lock starts out thin: owner is the task holding it, or null. Taking or releasing an
+// uncontended lock is a single cas. A task that finds the lock taken inflates it: it replaces the
+// owner with a heavy lock that has the owner and fifo queues of waiting tasks. A lock never
+// deflates again.
+//
+// A heavy lock can also be shared: natives marked kNativeReadOnly take it shared, and many tasks
+// can run them at the same time. The state of a heavy lock is 0 when free, WRITER when owned, or
+// the number of tasks sharing it. A thin lock has no room to count, so a read only native takes a
+// free thin lock like any other native; only a lock that is already heavy, because it was
+// contended, is shared. Shared holders are not owners, they never suspend or call back into hotel code while
+// holding the lock, so they cannot be part of a deadlock.
+//
+// Before suspending, a task spins for a while if the owner is running on another worker, it will
+// likely release the lock soon. How long it spins adapts per heavy lock: it doubles when spinning
+// got the lock, and halves when it did not.
+//
+// A heavy lock is handed over: on release, the next waiting task becomes the owner and is readied,
+// or, all waiting readers share it and are readied together. Writers and readers take turns, a
+// task wanting to share the lock waits while a writer waits, so neither can starve the other. The
+// state is only 0 when no task is waiting, so a spinning task never overtakes waiting tasks.
 
 #include "../llib/lqueue.h"
 
@@ -12,18 +31,34 @@
 #include "task.h"
 #include "frame.h"
 #include "error.h"
+#include "args.h"
+#include "native.h"
+#include "vm.h"
+
+#define SPIN_MIN 16
+#define SPIN_MAX 2048
 
+#define WRITER -1
+
+static tlKind _tlHeavyLockKind = { .name = "HeavyLock" };
 tlKind* tlHeavyLockKind;
 TL_REF_TYPE(tlHeavyLock);
 
 struct tlHeavyLock {
     intptr_t kind;
     tlTask* owner;
-    lqueue wait_q;
+    a_val state;
+    int spin;
+    lqueue wait_q; // tasks waiting to own the lock
+    lqueue read_q; // tasks waiting to share the lock
 };
 
 tlHeavyLock* tlHeavyLockNew(tlTask* owner) {
-    return null;
+    tlHeavyLock* hlock = tlAlloc(tlHeavyLockKind, sizeof(tlHeavyLock));
+    hlock->owner = owner;
+    hlock->state = owner? WRITER : 0;
+    hlock->spin = SPIN_MIN;
+    return hlock;
 }
 
 bool tlLockIs(tlHandle v) {
@@ -36,100 +71,180 @@ tlLock* tlLockCast(tlHandle v) {
     return (tlLockIs(v))?(tlLock*)v:null;
 }
 tlTask* tlLockOwner(tlLock* lock) {
-    return A_PTR(a_get(A_VAR(lock->owner)));
+    tlHandle owner = A_PTR(a_get(A_VAR(lock->owner)));
+    if (tlHeavyLockIs(owner)) return A_PTR(a_get(A_VAR(tlHeavyLockAs(owner)->owner)));
+    return owner;
 }
 bool tlLockIsOwner(tlLock* lock, tlTask* task) {
-    return a_get(A_VAR(lock->owner)) == A_VAL_NB(task);
+    return tlLockOwner(lock) == task;
 }
 
-static void lockScheduleNext(tlTask* task, tlLock* lock) {
-    trace("NEXT: %s", tl_str(lock));
-    assert(tlLockIs(lock));
-    assert(tlLockIsOwner(lock, task));
-
-    // dequeue the first task in line
-    tlTask* ntask = tlTaskFromEntry(lqueue_get(&lock->wait_q));
-    trace("%p", ntask);
+static inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
 
-    // make it the owner and schedule it; null is perfectly good as owner
-    lock->owner = ntask;
-    if (ntask) tlTaskReady(ntask);
+static tlHeavyLock* heavy(tlLock* lock) {
+    return tlHeavyLockAs(A_PTR(a_get(A_VAR(lock->owner))));
 }
 
-static tlHandle lockEnqueue(tlTask* task, tlLock* lock) {
-    trace("%s", tl_str(lock));
-    assert(tlLockIs(lock));
+// replace a thin lock with a heavy lock; null if the lock was released meanwhile
+static tlHeavyLock* inflate(tlLock* lock) {
+    while (true) {
+        tlHandle owner = A_PTR(a_get(A_VAR(lock->owner)));
+        if (!owner) return null;
+        if (tlHeavyLockIs(owner)) return tlHeavyLockAs(owner);
+        tlHeavyLock* hlock = tlHeavyLockNew(tlTaskAs(owner));
+        if (a_swap_if(A_VAR(lock->owner), A_VAL(hlock), A_VAL_NB(owner)) == A_VAL_NB(owner)) return hlock;
+    }
+}
 
-    // make the task wait and enqueue it
-    tlArray* deadlock = tlTaskWaitFor(task, lock);
-    if (deadlock) return tlDeadlockErrorThrow(task, deadlock);
-    lqueue_put(&lock->wait_q, &task->entry);
+static bool heavyTake(tlTask* task, tlHeavyLock* hlock) {
+    if (a_swap_if(&hlock->state, WRITER, 0) != 0) return false;
+    a_set(A_VAR(hlock->owner), A_VAL_NB(task));
+    task->locks++;
+    return true;
+}
 
-    // try to own the lock, incase another worker released it inbetween ...
-    // notice the task we put in is a place holder, and if we succeed, it might be any task
-    if (a_swap_if(A_VAR(lock->owner), A_VAL_NB(task), 0) == 0) {
-        lockScheduleNext(task, lock);
+static bool heavyTakeShared(tlHeavyLock* hlock) {
+    while (true) {
+        a_val state = a_get(&hlock->state);
+        if (state == WRITER) return false;
+        // let a waiting writer go first, or a stream of readers could keep it out forever
+        if (state > 0 && lqueue_peek(&hlock->wait_q)) return false;
+        if (a_swap_if(&hlock->state, state + 1, state) == state) return true;
     }
-    return null;
 }
 
-static tlHandle lockEnqueueResume(tlTask* task, tlLock* lock, tlResumeCb resume, tlHandle res) {
-    tlArray* deadlock = tlTaskWaitFor(task, lock);
-    if (deadlock) return tlDeadlockErrorThrow(task, deadlock);
+// spin while the owner is running, or while the lock is shared, it might be released soon
+static bool heavySpin(tlTask* task, tlHeavyLock* hlock, bool shared) {
+    int spin = hlock->spin;
+    for (int i = 0; i < spin; i++) {
+        if (shared? heavyTakeShared(hlock) : heavyTake(task, hlock)) {
+            hlock->spin = spin * 2 < SPIN_MAX? spin * 2 : SPIN_MAX;
+            return true;
+        }
+        if (a_get(&hlock->state) == WRITER) {
+            tlTask* owner = A_PTR_NB(a_get(A_VAR(hlock->owner)));
+            if (owner && !a_get(&owner->running)) break;
+        } else if (tlTaskGetVm(task)->nworkers < 2) {
+            break;
+        }
+        cpuRelax();
+    }
+    hlock->spin = spin / 2 > SPIN_MIN? spin / 2 : SPIN_MIN;
+    return false;
+}
 
-    tlTaskPushResume(task, resume, res);
-    lqueue_put(&lock->wait_q, &task->entry);
+// try to own the lock without suspending the task; if this fails, the lock is a heavy lock
+static bool lockTake(tlTask* task, tlLock* lock) {
+    while (true) {
+        if (a_swap_if(A_VAR(lock->owner), A_VAL_NB(task), 0) == 0) { task->locks++; return true; }
+        tlHeavyLock* hlock = inflate(lock);
+        if (!hlock) continue;
+        if (heavyTake(task, hlock)) return true;
+        return heavySpin(task, hlock, false);
+    }
+}
 
-    // try to own the lock, incase another worker released it inbetween ...
-    // notice the task we put in is a place holder, and if we succeed, it might be any task
-    if (a_swap_if(A_VAR(lock->owner), A_VAL_NB(task), 0) == 0) {
-        lockScheduleNext(task, lock);
+// try to own a thin lock, or share a heavy lock, without suspending the task; owned tells which
+static bool lockTakeShared(tlTask* task, tlLock* lock, bool* owned) {
+    while (true) {
+        *owned = true;
+        if (a_swap_if(A_VAR(lock->owner), A_VAL_NB(task), 0) == 0) { task->locks++; return true; }
+        tlHeavyLock* hlock = inflate(lock);
+        if (!hlock) continue;
+        *owned = false;
+        if (heavyTakeShared(hlock)) return true;
+        return heavySpin(task, hlock, true);
     }
-    return null;
 }
 
-static tlHandle XtlTaskPauseResuming(tlResumeCb resume, tlHandle res) { return null; }
-static tlHandle XtlTaskPauseAttach(void* frame) { return null; }
-static tlHandle tlLockTake(tlTask* task, tlLock* lock, tlResumeCb resume, tlHandle res) {
-    // if we are the owner of a light weight lock, no action is required
-    if (lock->owner == task) return res;
-
-    // check if there is a heavy weight lock already and if we are owner, no action required
-    tlHeavyLock* hlock = tlHeavyLockCast(lock->owner);
-    if (hlock) {
-        if (hlock->owner == task) return res;
-        goto heavy;
+static bool handToReaders(tlHeavyLock* hlock) {
+    lqentry* entry = lqueue_get_many(&hlock->read_q, INT_MAX);
+    if (!entry) return false;
+    int n = 0;
+    for (lqentry* e = entry; e; e = e->next) n++;
+    a_set(&hlock->state, n);
+    while (entry) {
+        lqentry* next = entry->next;
+        tlTaskReady(tlTaskFromEntry(entry));
+        entry = next;
     }
+    return true;
+}
 
-upgrade:;
-    tlHandle other = null;
+static bool handToWriter(tlHeavyLock* hlock) {
+    tlTask* ntask = tlTaskFromEntry(lqueue_get(&hlock->wait_q));
+    if (!ntask) return false;
+    ntask->locks++;
+    a_set(A_VAR(hlock->owner), A_VAL(ntask));
+    tlTaskReady(ntask);
+    return true;
+}
 
-    // try to aquire a light weight lock by swapping our task for the null pointer
-    if (!lock->owner) {
-        other = A_PTR_NB(a_swap_if(A_VAR(lock->owner), A_VAL_NB(task), 0));
-        if (!other) return res;
-    }
-    assert(other); // cannot be null
+// the caller holds the state as WRITER, but owner is null; hand the lock to waiting tasks, or
+// release it if there are none
+static void handOff(tlHeavyLock* hlock, bool writerFirst) {
+    trace("NEXT: %s", tl_str(hlock));
+    while (true) {
+        assert(hlock->state == WRITER && !hlock->owner);
+        if (writerFirst) {
+            if (handToWriter(hlock) || handToReaders(hlock)) return;
+        } else {
+            if (handToReaders(hlock) || handToWriter(hlock)) return;
+        }
+        a_set(&hlock->state, 0);
 
-    // if another task has aquired the light weight lock, upgrade the lock
-    if (tlTaskIs(other)) {
-        tlHeavyLock* hlock = tlHeavyLockNew(tlTaskAs(other));
-        a_swap_if(A_VAR(lock->owner), A_VAL_NB(hlock), A_VAL_NB(other));
-        goto upgrade; // always restart: we won, another upgrade won, light weight lock was released
+        // a task might have enqueued itself, and tried to take the lock, before we released it
+        __sync_synchronize();
+        if (!lqueue_peek(&hlock->wait_q) && !lqueue_peek(&hlock->read_q)) return;
+        if (a_swap_if(&hlock->state, WRITER, 0) != 0) return;
     }
+}
 
-    // a heavy weight lock
-    assert(tlHeavyLockIs(other));
-    hlock = tlHeavyLockAs(other);
+static void lockRelease(tlTask* task, tlLock* lock) {
+    trace("RELEASE: %s", tl_str(lock));
+    assert(tlLockIs(lock));
+    assert(tlLockIsOwner(lock, task));
+    assert(task->locks > 0);
+    task->locks--;
+    if (a_swap_if(A_VAR(lock->owner), 0, A_VAL_NB(task)) == A_VAL_NB(task)) return;
+    tlHeavyLock* hlock = heavy(lock);
+    a_set(A_VAR(hlock->owner), 0);
+    handOff(hlock, false);
+}
 
-heavy:;
-    assert(hlock->owner != task); // we cannot be the owner
+// the last task to stop sharing the lock hands it over
+static void lockReleaseShared(tlLock* lock) {
+    trace("RELEASE SHARED: %s", tl_str(lock));
+    tlHeavyLock* hlock = heavy(lock);
+    assert(hlock->state > 0);
+    if (a_dec(&hlock->state) > 0) return;
+    if (!lqueue_peek(&hlock->wait_q) && !lqueue_peek(&hlock->read_q)) return;
+    if (a_swap_if(&hlock->state, WRITER, 0) != 0) return;
+    handOff(hlock, true);
+}
 
-    // try to become the owner, notice owner is never null unless wait queue is empty
-    if (a_swap_if(A_VAR(hlock->owner), A_VAL_NB(task), 0) == 0) return res;
+// suspend the task until the lock is handed to it, call after lockTake or lockTakeShared failed
+static tlHandle lockWait(tlTask* task, tlLock* lock, bool shared, tlResumeCb resume, tlHandle res) {
+    trace("%s", tl_str(lock));
+    tlHeavyLock* hlock = heavy(lock);
 
-    // failed to own lock; pause current task, and enqueue it
-    return XtlTaskPauseResuming(resume, res);
+    // make the task wait and enqueue it
+    tlArray* deadlock = tlTaskWaitFor(task, lock);
+    if (deadlock) return tlDeadlockErrorThrow(task, deadlock);
+    if (resume) tlTaskPushResume(task, resume, res);
+    lqueue_put(shared? &hlock->read_q : &hlock->wait_q, &task->entry);
+
+    // try to take the lock, incase another worker released it inbetween ...
+    // notice we only hold it to hand it off, which might be to any task
+    __sync_synchronize();
+    if (a_swap_if(&hlock->state, WRITER, 0) == 0) {
+        handOff(hlock, !shared);
+    }
+    return null;
 }
 
 typedef struct ReleaseFrame {
@@ -138,7 +253,7 @@ typedef struct ReleaseFrame {
 } ReleaseFrame;
 
 static tlHandle resumeRelease(tlTask* task, tlFrame* _frame, tlHandle value, tlHandle error) {
-    lockScheduleNext(task, tlLockAs(((ReleaseFrame*)_frame)->lock));
+    lockRelease(task, tlLockAs(((ReleaseFrame*)_frame)->lock));
     if (!value) return null;
     tlTaskPopFrame(task, _frame);
     return value;
@@ -147,6 +262,7 @@ static tlHandle resumeRelease(tlTask* task, tlFrame* _frame, tlHandle value, tlH
 // ** lock a native object to send it a message from bytecode **
 tlHandle tlInvoke(tlTask* task, tlArgs* call);
 static tlHandle lockedInvoke(tlTask* task, tlLock* lock, tlArgs* call);
+static tlHandle sharedInvoke(tlTask* task, tlLock* lock, tlArgs* call, bool owned);
 
 static tlHandle resumeInvoke(tlTask* task, tlFrame* _frame, tlHandle value, tlHandle error) {
     trace("%s", tl_str(res));
@@ -155,6 +271,13 @@ static tlHandle resumeInvoke(tlTask* task, tlFrame* _frame, tlHandle value, tlHa
     return lockedInvoke(task, tlLockAs(tlArgsTarget(value)), value);
 }
 
+static tlHandle resumeInvokeShared(tlTask* task, tlFrame* _frame, tlHandle value, tlHandle error) {
+    trace("%s", tl_str(res));
+    if (!value) return null;
+    tlTaskPopFrame(task, _frame);
+    return sharedInvoke(task, tlLockAs(tlArgsTarget(value)), value, false);
+}
+
 tlHandle tlLockAndInvoke(tlTask* task, tlArgs* call) {
     tlLock* lock = tlLockAs(tlArgsTarget(call));
     trace("%s", tl_str(lock));
@@ -162,17 +285,20 @@ tlHandle tlLockAndInvoke(tlTask* task, tlArgs* call) {
 
     if (tlLockIsOwner(lock, task)) return tlInvoke(task, call);
 
-    // if the lock is taken and there are tasks in the queue, there is never a point that owner == null
-    if (a_swap_if(A_VAR(lock->owner), A_VAL_NB(task), 0) != 0) {
-        // failed to own lock; pause current task, and enqueue it
-        return lockEnqueueResume(task, lock, resumeInvoke, call);
+    if (tlNativeReadOnly(tlArgsFnInline(call))) {
+        bool owned;
+        if (!lockTakeShared(task, lock, &owned)) return lockWait(task, lock, true, resumeInvokeShared, call);
+        return sharedInvoke(task, lock, call, owned);
     }
+
+    // failed to own lock; pause current task, and enqueue it
+    if (!lockTake(task, lock)) return lockWait(task, lock, false, resumeInvoke, call);
     return lockedInvoke(task, lock, call);
 }
 
 static tlHandle lockedInvoke(tlTask* task, tlLock* lock, tlArgs* call) {
     trace("%s", tl_str(lock));
-    assert(lock->owner == task);
+    assert(tlLockIsOwner(lock, task));
 
     ReleaseFrame* frame = tlFrameAlloc(resumeRelease, sizeof(ReleaseFrame));
     frame->lock = lock;
@@ -181,11 +307,19 @@ static tlHandle lockedInvoke(tlTask* task, tlLock* lock, tlArgs* call) {
     tlHandle res = tlInvoke(task, call);
     if (!res) return null;
 
-    lockScheduleNext(task, lock);
+    lockRelease(task, lock);
     tlTaskPopFrame(task, (tlFrame*)frame);
     return res;
 }
 
+// a read only native never suspends, so no frame is needed to release the lock later
+static tlHandle sharedInvoke(tlTask* task, tlLock* lock, tlArgs* call, bool owned) {
+    trace("%s", tl_str(lock));
+    tlHandle res = tlNativeKind->run(task, tlArgsFnInline(call), call);
+    if (owned) lockRelease(task, lock); else lockReleaseShared(lock);
+    return res;
+}
+
 // ** with **
 
 typedef struct WithFrame {
@@ -202,7 +336,7 @@ static tlHandle resumeWithUnlock(tlTask* task, tlFrame* _frame, tlHandle value,
         tlLock* lock = tlLockAs(tlArrayGet(frame->locks, i));
         if (!tlLockIsOwner(lock, task)) continue;
         trace("unlocking: %d %s", i, tl_str(lock));
-        lockScheduleNext(task, lock);
+        lockRelease(task, lock);
     }
     if (value) tlTaskPopFrame(task, _frame);
     return value;
@@ -217,9 +351,9 @@ static tlHandle resumeWithLock(tlTask* task, tlFrame* _frame, tlHandle value, tl
     for (;frame->locked < tlArraySize(frame->locks); frame->locked++) {
         tlLock* lock = tlLockAs(tlArrayGet(frame->locks, frame->locked));
         trace("locking: %d %s", frame->locked, tl_str(lock));
-        if (a_swap_if(A_VAR(lock->owner), A_VAL_NB(task), 0) != 0) {
+        if (!lockTake(task, lock)) {
             frame->locked++;
-            return lockEnqueue(task, lock);
+            return lockWait(task, lock, false, null, null);
         }
     }
 
@@ -262,3 +396,6 @@ tlHandle _has_lock(tlTask* task, tlArgs* args) {
     return tlTrue;
 }
 
+void lock_init() {
+    INIT_KIND(tlHeavyLockKind);
+}
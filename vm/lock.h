@@ -6,4 +6,6 @@
 bool tlLockIsOwner(tlLock* lock, tlTask* task);
 tlHandle tlLockAndInvoke(tlTask* task, tlArgs* call);
 
+void lock_init();
+
 #endif
@@ -3,14 +3,47 @@
 
 #include "tl.h"
 
+// kNativeNoCapture: a native that does not store its args anywhere, nor returns them, the caller may reuse them
+// kNativeReadOnly: a method that only reads its locked target, never suspends, and never calls back
+// into hotel code; many tasks may run it at the same time, sharing the lock, see lock.c
+enum { kNativeNoCapture = 1, kNativeReadOnly = 2 };
+
+// operators the interpreter evaluates inline when both operands are ints or floats
+typedef enum {
+    TL_NATIVE_OP_NONE = 0,
+    TL_NATIVE_OP_ADD,
+    TL_NATIVE_OP_SUB,
+    TL_NATIVE_OP_MUL,
+    TL_NATIVE_OP_EQ,
+    TL_NATIVE_OP_NEQ,
+    TL_NATIVE_OP_LT,
+    TL_NATIVE_OP_LTE,
+    TL_NATIVE_OP_GT,
+    TL_NATIVE_OP_GTE,
+    TL_NATIVE_OP_BAND,
+    TL_NATIVE_OP_BOR,
+    TL_NATIVE_OP_BXOR,
+} tlNativeOp;
+
 struct tlNative {
     tlHead head;
     tlNativeCb native;
     tlSym name;
+    tlNativeOp op; // if not TL_NATIVE_OP_NONE, native must compute the same results as the inline version
 };
 tlNative* tlNativeNew(tlNativeCb native, tlSym name);
 tlSym tlNativeName(tlNative* fn);
 
+static inline bool tlNativeNoCapture(tlHandle fn) {
+    return tlNativeIs(fn) && tlflag_isset(fn, kNativeNoCapture);
+}
+
+static inline bool tlNativeReadOnly(tlHandle fn) {
+    return tlNativeIs(fn) && tlflag_isset(fn, kNativeReadOnly);
+}
+// mark the named methods, a null terminated list, as kNativeReadOnly
+void tlMethodsReadOnly(tlObject* methods, const char* n1, ...);
+
 void native_init_first();
 void native_init();
 
@@ -208,17 +208,57 @@ struct tlFloat {
     double value;
 };
 
+#ifndef M32
+// Doubles with an exponent between -127 and 128 are not allocated. Their exponent is rebased so its
+// top 3 bits read 0b110, then the bits are rotated left by 4, putting those bits on the tag and the
+// sign just above it. Zero, denormals, very large or small numbers, infinity and NaN are allocated.
+#define FLOAT_IMMEDIATE_BIAS (0x280ULL << 52)
+
+static tlHandle float_immediate(double d) {
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    uint64_t exp = (bits >> 52) & 0x7FF;
+    if (exp < 0x380 || exp > 0x47F) return null;
+    bits += FLOAT_IMMEDIATE_BIAS;
+    return (tlHandle)(intptr_t)(bits << 4 | bits >> 60);
+}
+
+static double float_immediate_value(tlHandle v) {
+    uint64_t bits = (uint64_t)(intptr_t)v;
+    bits = (bits >> 4 | bits << 60) - FLOAT_IMMEDIATE_BIAS;
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+#endif
+
+static tlHandle tlFloatZero;
+
 tlHandle tlFLOAT(double d) {
+#ifndef M32
+    tlHandle imm = float_immediate(d);
+    if (imm) return imm;
+#endif
+    if (d == 0 && !signbit(d) && tlFloatZero) return tlFloatZero;
     tlFloat* f = tlAlloc(tlFloatKind, sizeof(tlFloat));
     f->value = d;
     return f;
 }
 
+static double float_value(tlHandle v) {
+    assert(tlFloatIs(v));
+#ifndef M32
+    if (tlFloatImmediateIs_(v)) return float_immediate_value(v);
+#endif
+    return ((tlFloat*)v)->value;
+}
+
 static const char* floattoString(tlHandle v, char* buf, int size) {
     snprintf(buf, size, "%.17g", tl_double(v)); return buf;
 }
 static uint32_t floatHash(tlHandle h, tlHandle* unhashable) {
-    return murmurhash2a((uint8_t*)&tlFloatAs(h)->value, sizeof(double)) + 3;
+    double d = float_value(h);
+    return murmurhash2a((uint8_t*)&d, sizeof(double)) + 3;
 }
 static bool floatEquals(tlHandle left, tlHandle right) {
     return tl_double(left) == tl_double(right);
@@ -332,6 +372,7 @@ tlHandle tlNumberFromDouble(double d) {
 tlNum* tlNumTo(tlHandle h) {
     assert(tlNumberIs(h));
     if (tlNumIs(h)) return tlNumAs(h);
+    if (tlIntIs(h)) return tlNumNew(tlIntToInt(h)); // tl_int() would clip to 32 bits
     return tlNumNew(tl_int(h));
 }
 
@@ -545,7 +586,7 @@ tlHandle tlNUM(intptr_t l) {
 
 int64_t tlNumberToInt64(tlHandle h) {
     if (tlIntIs(h)) return tlIntToInt(h);
-    if (tlFloatIs(h)) return (int64_t)tlFloatAs(h)->value;
+    if (tlFloatIs(h)) return (int64_t)float_value(h);
     if (tlNumIs(h)) return tlNumToInt(tlNumAs(h));
     if (tlCharIs(h)) return tlCharAs(h)->value;
     return INT64_MIN;
@@ -554,7 +595,7 @@ int64_t tlNumberToInt64(tlHandle h) {
 int tl_int(tlHandle h) {
     int64_t i;
     if (tlIntIs(h)) i = tlIntToInt(h);
-    else if (tlFloatIs(h)) i = (int64_t)tlFloatAs(h)->value;
+    else if (tlFloatIs(h)) i = (int64_t)float_value(h);
     else if (tlNumIs(h)) i = tlNumToInt(tlNumAs(h));
     else if (tlCharIs(h)) i = tlCharAs(h)->value;
     else { assert(false); return INT_MIN; }
@@ -568,7 +609,7 @@ int tl_int(tlHandle h) {
 int tl_int_or(tlHandle h, int d) {
     int64_t i;
     if (tlIntIs(h)) i = tlIntToInt(h);
-    else if (tlFloatIs(h)) i = (int64_t)tlFloatAs(h)->value;
+    else if (tlFloatIs(h)) i = (int64_t)float_value(h);
     else if (tlNumIs(h)) i = tlNumToInt(tlNumAs(h));
     else if (tlCharIs(h)) i = tlCharAs(h)->value;
     else return d;
@@ -581,7 +622,7 @@ int tl_int_or(tlHandle h, int d) {
 
 double tl_double(tlHandle h) {
     if (tlNullIs(h)) return 0;
-    if (tlFloatIs(h)) return tlFloatAs(h)->value;
+    if (tlFloatIs(h)) return float_value(h);
     if (tlIntIs(h)) return tlIntToDouble(h);
     if (tlNumIs(h)) return tlNumToDouble(tlNumAs(h));
     if (tlCharIs(h)) return tlCharAs(h)->value;
@@ -590,7 +631,7 @@ double tl_double(tlHandle h) {
 }
 
 double tl_double_or(tlHandle h, double d) {
-    if (tlFloatIs(h)) return tlFloatAs(h)->value;
+    if (tlFloatIs(h)) return float_value(h);
     if (tlIntIs(h)) return tlIntToDouble(h);
     if (tlNumIs(h)) return tlNumToDouble(tlNumAs(h));
     if (tlCharIs(h)) return tlCharAs(h)->value;
@@ -1015,6 +1056,7 @@ void number_init() {
     tl_register_global("Char", cconstructor);
 
     INIT_KIND(tlFloatKind);
+    tlFloatZero = tlFLOAT(0);
     INIT_KIND(tlNumKind);
     INIT_KIND(tlCharKind);
 }
@@ -931,16 +931,22 @@ tlHandle userclassResolveStatic(tlUserClass* cls, tlSym name) {
 }
 
 // resolve a name to a method, walking up the super hierarchy as needed; methods before fields
-tlHandle userobjectResolve(tlUserObject* oop, tlSym name) {
-    tlHandle method = tlUserClassMethodResolve(oop->cls, name);
+// if the name is a field, returns null and sets field to its index in instances of the class
+tlHandle tlUserClassResolve(tlUserClass* cls, tlSym name, int* field) {
+    *field = -1;
+    tlHandle method = tlUserClassMethodResolve(cls, name);
     if (method) return method;
 
-    int field = tlSetIndexof(oop->cls->fields, name);
-    if (field < 0) {
-        if (name != s__set) return null;
-        return g_userobject_set;
-    }
-    assert(field >= 0 && field < tlSetSize(oop->cls->fields));
+    *field = tlSetIndexof(cls->fields, name);
+    if (*field < 0 && name == s__set) return g_userobject_set;
+    assert(*field < tlSetSize(cls->fields));
+    return null;
+}
+
+tlHandle userobjectResolve(tlUserObject* oop, tlSym name) {
+    int field;
+    tlHandle method = tlUserClassResolve(oop->cls, name, &field);
+    if (field < 0) return method;
     return tlOR_NULL(oop->fields[field]);
 }
 
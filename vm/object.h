@@ -64,6 +64,7 @@ struct tlUserObject {
 tlUserClass* tlUserClassFor(tlUserObject* oop);
 
 tlHandle userobjectResolve(tlUserObject* oop, tlSym name);
+tlHandle tlUserClassResolve(tlUserClass* cls, tlSym name, int* field);
 tlHandle userclassResolveStatic(tlUserClass* cls, tlSym name);
 
 
@@ -1,6 +1,17 @@
 // author: Onne Gorter, license: MIT (see license.txt)
 
 // a native and language level message queue
+//
+// A Queue is a channel between tasks. It buffers up to size values in a lock free ring, so adding
+// only suspends a task when the ring is full, and getting only when it is empty. A queue without
+// buffer hands every value from an adder directly to a getter.
+//
+// The mutex is only taken to suspend or wake tasks. A task about to wait counts itself, and then
+// looks at the ring one last time. A task that used the ring checks the count of the other side
+// afterwards. So either the waiting task sees the ring changed, or the other task sees it waiting.
+//
+// A waiting adder has the list of values it still has to add as value. A waiting getter has null
+// as value, or the most values it wants, when it wants a list.
 
 #include "../llib/lqueue.h"
 
@@ -23,9 +34,9 @@ tlKind* tlMsgQueueInputKind;
 static tlKind _tlMessageKind = { .name = "Message" };
 tlKind* tlMessageKind;
 
-// TODO actually implement the buffering
 tlQueue* tlQueueNew(int buffer) {
     tlQueue* queue = tlAlloc(tlQueueKind, sizeof(tlQueue));
+    lring_init(&queue->ring, buffer > 0? buffer : 0);
     pthread_mutex_init(&queue->lock, null);
     assert(queue);
     return queue;
@@ -38,6 +49,7 @@ void tlQueueClose(tlQueue* queue) {
     while (true) {
         tlTask* getter = tlTaskFromEntry(lqueue_get(&queue->get_q));
         if (!getter) break;
+        a_dec(&queue->getters);
         getter->value = tlUndef();
         trace("found an getter while closing... giving it values: %s", tl_str(getter->value));
         tlTaskReady(getter);
@@ -45,87 +57,216 @@ void tlQueueClose(tlQueue* queue) {
     pthread_mutex_unlock(&queue->lock);
 }
 
-// add args to the queue, if it returns null, the task is suspended
-tlHandle tlQueueAdd(tlQueue* queue, tlTask* task, tlArgs* args) {
+// a list of first, and more values from the ring, up to max
+static tlList* takeMany(tlQueue* queue, tlHandle first, int max) {
+    tlArray* values = tlArrayNew();
+    tlArrayAdd(values, first);
+    while (tlArraySize(values) < max) {
+        tlHandle v = lring_get(&queue->ring);
+        if (!v) break;
+        tlArrayAdd(values, v);
+    }
+    return tlArrayToList(values);
+}
+
+// the first adder in add_q added its first value, ready it if that was the last one
+static void adderAdvance(tlQueue* queue, tlTask* adder) {
+    tlList* pending = tlListAs(adder->value);
+    int size = tlListSize(pending);
+    if (size > 1) {
+        adder->value = tlListSub(pending, 1, size - 1);
+        return;
+    }
+    lqueue_get(&queue->add_q);
+    a_dec(&queue->adders);
+    adder->value = tlNull;
+    tlTaskReady(adder);
+}
+
+// take the first getter from get_q and give it v, or a list starting with v
+static void getterGive(tlQueue* queue, tlHandle v) {
+    tlTask* getter = tlTaskFromEntry(lqueue_get(&queue->get_q));
+    assert(getter);
+    a_dec(&queue->getters);
+    if (tlIntIs(getter->value)) v = takeMany(queue, v, tl_int(getter->value));
+    trace("found an getter ... giving it values: %s", tl_str(v));
+    getter->value = v;
+    tlTaskReady(getter);
+}
+
+// move values from waiting adders into the ring, and to waiting getters; call with lock held
+static void serve(tlQueue* queue) {
+    while (true) {
+        tlTask* adder = tlTaskFromEntry(lqueue_peek(&queue->add_q));
+        if (adder && lring_put(&queue->ring, tlListGet(tlListAs(adder->value), 0))) {
+            adderAdvance(queue, adder);
+            continue;
+        }
+        if (!lqueue_peek(&queue->get_q)) return;
+        tlHandle v = lring_get(&queue->ring);
+        if (!v) {
+            if (!adder) return;
+            v = tlListGet(tlListAs(adder->value), 0);
+            adderAdvance(queue, adder);
+        }
+        getterGive(queue, v);
+    }
+}
+
+// after using the ring, serve the other side if tasks wait there
+static void wake(tlQueue* queue, a_val* waiting) {
+    __sync_synchronize();
+    if (!a_get(waiting)) return;
     pthread_mutex_lock(&queue->lock);
-    if (!queue->add_q.head) {
-        // we are first
-        tlTask* getter = tlTaskFromEntry(lqueue_get(&queue->get_q));
-        if (getter) {
-            getter->value = tlResultFromArgs(args);
-            trace("found an getter ... giving it values: %s", tl_str(getter->value));
-            tlTaskReady(getter);
-            pthread_mutex_unlock(&queue->lock);
+    serve(queue);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+// add values to the queue, if it returns null, the task is suspended until all are added
+static tlHandle queueAdd(tlQueue* queue, tlTask* task, tlList* values) {
+    int size = tlListSize(values);
+    int at = 0;
+    if (!a_get(&queue->adders)) {
+        while (at < size && lring_put(&queue->ring, tlListGet(values, at))) at++;
+        if (at == size) {
+            wake(queue, &queue->getters);
             return tlNull;
         }
     }
 
-    // enqueue as we are not first, or there is no getter
+    pthread_mutex_lock(&queue->lock);
+    a_inc(&queue->adders);
+    while (at < size && !lqueue_peek(&queue->add_q)) {
+        tlHandle v = tlListGet(values, at);
+        if (lring_put(&queue->ring, v)) { at++; continue; }
+        if (!lqueue_peek(&queue->get_q)) break;
+        // the ring is full, or has no room at all, and a getter waits
+        tlHandle first = lring_get(&queue->ring);
+        if (first) {
+            getterGive(queue, first);
+        } else {
+            getterGive(queue, v);
+            at++;
+        }
+    }
+    if (at == size) {
+        a_dec(&queue->adders);
+        serve(queue);
+        pthread_mutex_unlock(&queue->lock);
+        return tlNull;
+    }
+
+    // enqueue as we are not first, or there is no room
     trace("waiting for getter");
-    task->value = args;
+    task->value = at? tlListSub(values, at, size - at) : values;
     tlTaskWaitFor(task, null);
     lqueue_put(&queue->add_q, &task->entry);
+    serve(queue);
     pthread_mutex_unlock(&queue->lock);
     return null;
 }
 
-// get a value from the queue, will return a tlResult if required, or suspend the task
-tlHandle tlQueueGet(tlQueue* queue, tlTask* task) {
+// get a value, or a list of up to max values, from the queue; if it returns null, the task is
+// suspended, unless poll, then it returns tlNull
+static tlHandle queueGet(tlQueue* queue, tlTask* task, int max, bool poll) {
+    tlHandle v = null;
+    if (!a_get(&queue->getters)) {
+        v = lring_get(&queue->ring);
+        if (v) {
+            if (max) v = takeMany(queue, v, max);
+            wake(queue, &queue->adders);
+            return v;
+        }
+    }
+
     pthread_mutex_lock(&queue->lock);
-    if (!queue->get_q.head) {
-        // we are first
-        tlTask* adder = tlTaskFromEntry(lqueue_get(&queue->add_q));
-        if (adder) {
+    a_inc(&queue->getters);
+    if (!lqueue_peek(&queue->get_q)) {
+        v = lring_get(&queue->ring);
+        tlTask* adder = tlTaskFromEntry(lqueue_peek(&queue->add_q));
+        if (!v && adder) {
             trace("found an adder ... taking its values %s", tl_str(adder->value));
-            tlArgs* res = tlArgsAs(adder->value);
-            adder->value = tlNull;
-            tlTaskReady(adder);
-            pthread_mutex_unlock(&queue->lock);
-            return tlResultFromArgs(res);
+            v = tlListGet(tlListAs(adder->value), 0);
+            adderAdvance(queue, adder);
         }
     }
+    if (v || poll) {
+        a_dec(&queue->getters);
+        if (v && max) v = takeMany(queue, v, max);
+        serve(queue);
+        pthread_mutex_unlock(&queue->lock);
+        return v? v : tlNull;
+    }
 
-    // enqueue as we are not first, or there is no adder
+    // enqueue as we are not first, or there is nothing to get
     trace("waiting for adder");
+    task->value = max? tlINT(max) : tlNull;
     tlTaskWaitFor(task, null);
     lqueue_put(&queue->get_q, &task->entry);
+    serve(queue);
     pthread_mutex_unlock(&queue->lock);
     return null;
 }
 
+tlHandle tlQueueAdd(tlQueue* queue, tlTask* task, tlArgs* args) {
+    return queueAdd(queue, task, tlListFrom1(tlResultFromArgs(args)));
+}
+
+tlHandle tlQueueAddAll(tlQueue* queue, tlTask* task, tlList* values) {
+    if (tlListSize(values) == 0) return tlNull;
+    return queueAdd(queue, task, values);
+}
+
+tlHandle tlQueueGet(tlQueue* queue, tlTask* task) {
+    return queueGet(queue, task, 0, false);
+}
+
+tlHandle tlQueueGetMany(tlQueue* queue, tlTask* task, int max) {
+    assert(max > 0);
+    return queueGet(queue, task, max, false);
+}
+
 tlHandle tlQueuePoll(tlQueue* queue, tlTask* task) {
-    pthread_mutex_lock(&queue->lock);
-    if (!queue->get_q.head) {
-        // we are first
-        tlTask* adder = tlTaskFromEntry(lqueue_get(&queue->add_q));
-        if (adder) {
-            trace("found an adder ... taking its values %s", tl_str(adder->value));
-            tlArgs* res = tlArgsAs(adder->value);
-            adder->value = tlNull;
-            tlTaskReady(adder);
-            pthread_mutex_unlock(&queue->lock);
-            return tlResultFromArgs(res);
-        }
-    }
-    pthread_mutex_unlock(&queue->lock);
-    return tlNull;
+    return queueGet(queue, task, 0, true);
 }
 
+//. object Queue: a channel to pass values between tasks
+
+//. new(size): create a queue buffering up to size values, without size, every #add waits for a #get
 static tlHandle _Queue_new(tlTask* task, tlArgs* args) {
     int size = tl_int_or(tlArgsGet(args, 0), 0);
     return tlQueueNew(size);
 }
 
+//. add(values*): add values to the queue, waits while the queue is full
 static tlHandle _queue_add(tlTask* task, tlArgs* args) {
     TL_TARGET(tlQueue, queue);
     return tlQueueAdd(queue, task, args);
 }
 
+//. addAll(list): add each value in list to the queue, waits until all are added
+static tlHandle _queue_addAll(tlTask* task, tlArgs* args) {
+    TL_TARGET(tlQueue, queue);
+    tlList* values = tlListCast(tlArgsGet(args, 0));
+    if (!values) TL_THROW("expected a List");
+    return tlQueueAddAll(queue, task, values);
+}
+
+//. get: get a value from the queue, waits while the queue is empty
 static tlHandle _queue_get(tlTask* task, tlArgs* args) {
     TL_TARGET(tlQueue, queue);
     return tlQueueGet(queue, task);
 }
 
+//. getMany(max): get a list of at least one and up to max values, waits while the queue is empty
+static tlHandle _queue_getMany(tlTask* task, tlArgs* args) {
+    TL_TARGET(tlQueue, queue);
+    int max = tl_int_or(tlArgsGet(args, 0), -1);
+    if (max <= 0) TL_THROW("expected a positive Number");
+    return tlQueueGetMany(queue, task, max);
+}
+
+//. poll: get a value from the queue, or null if it is empty
 static tlHandle _queue_poll(tlTask* task, tlArgs* args) {
     TL_TARGET(tlQueue, queue);
     return tlQueuePoll(queue, task);
@@ -139,31 +280,71 @@ tlMessage* tlMessageNew(tlTask* task, tlArgs* args) {
     msg->args = args;
     return msg;
 }
+static tlMessage* tlMessageFromEntry(lqentry* entry) {
+    if (!entry) return null;
+    return (tlMessage*)(((char *)entry) - ((intptr_t) &((tlMessage*)0)->entry));
+}
+static tlMsgQueueInput* tlMsgQueueInputNew(tlMsgQueue* queue, bool oneway) {
+    tlMsgQueueInput* input = tlAlloc(tlMsgQueueInputKind, sizeof(tlMsgQueueInput));
+    input->queue = queue;
+    input->oneway = oneway;
+    return input;
+}
 tlMsgQueue* tlMsgQueueNew() {
     tlMsgQueue* queue = tlAlloc(tlMsgQueueKind, sizeof(tlMsgQueue));
-    queue->input = tlAlloc(tlMsgQueueInputKind, sizeof(tlMsgQueueInput));
-    queue->input->queue = queue;
+    queue->input = tlMsgQueueInputNew(queue, false);
+    queue->oneway = tlMsgQueueInputNew(queue, true);
     return queue;
 }
 bool tlMsgQueueIsEmpty(tlMsgQueue* queue) {
     return lqueue_peek(&queue->msg_q) == null;
 }
 
-static void queueSignal(tlMsgQueue* queue) {
-    if (queue->signalcb) queue->signalcb();
-    tlTask* task = tlTaskFromEntry(lqueue_get(&queue->wait_q));
-    if (!task) return;
+// take a message, or when all, a list of all queued messages; null if there are none
+static tlHandle msgQueueTake(tlMsgQueue* queue, bool all) {
+    if (queue->signalcb) a_set(&queue->signaled, 0);
+    if (!all) return tlMessageFromEntry(lqueue_get(&queue->msg_q));
+
+    lqentry* entry = lqueue_get_many(&queue->msg_q, INT_MAX);
+    if (!entry) return null;
+    int size = 0;
+    for (lqentry* e = entry; e; e = e->next) size++;
+    tlList* msgs = tlListNew(size);
+    for (int i = 0; i < size; i++, entry = entry->next) tlListSet_(msgs, i, tlMessageFromEntry(entry));
+    return msgs;
+}
 
-    tlTask* sender = tlTaskFromEntry(lqueue_get(&queue->msg_q));
-    trace("SENDER: %s", tl_str(sender));
-    if (!sender) return;
-    task->value = sender->value;
-    tlTaskReady(task);
+// hand messages to waiting tasks; senders call this after putting a message, and receivers after
+// putting themselves in wait_q, so one of them sees the other
+// a waiting task has tlTrue as value if it wants all messages
+static void msgQueueDeliver(tlMsgQueue* queue) {
+    __sync_synchronize();
+    while (lqueue_peek(&queue->msg_q)) {
+        tlTask* task = tlTaskFromEntry(lqueue_get(&queue->wait_q));
+        if (!task) return;
+        tlHandle v = msgQueueTake(queue, task->value == tlTrue);
+        if (!v) {
+            // another task took the message first
+            lqueue_put(&queue->wait_q, &task->entry);
+            __sync_synchronize();
+            continue;
+        }
+        trace("RECEIVER: %s", tl_str(task));
+        task->value = v;
+        tlTaskReady(task);
+    }
+}
+
+// when many messages are sent, only the first calls signalcb, until the queue is received from
+static void queueSignal(tlMsgQueue* queue) {
+    if (queue->signalcb && a_swap_if(&queue->signaled, 1, 0) == 0) queue->signalcb();
+    msgQueueDeliver(queue);
 }
 
 tlHandle tlMessageReply(tlMessage* msg, tlHandle res) {
     trace("msg.reply: %s", tl_str(msg));
     if (!res) res = tlNull;
+    if (!msg->sender) return res;
     msg->sender->value = res;
     tlTaskReady(msg->sender);
     return res;
@@ -171,6 +352,7 @@ tlHandle tlMessageReply(tlMessage* msg, tlHandle res) {
 tlHandle tlMessageThrow(tlMessage* msg, tlHandle res) {
     trace("msg.throw: %s", tl_str(msg));
     if (!res) res = tlNull;
+    if (!msg->sender) return res;
     msg->sender->value = res;
     msg->sender->hasError = true;
     tlTaskReady(msg->sender);
@@ -181,46 +363,72 @@ tlTask* tlMessageGetSender(tlMessage* msg) {
 }
 
 static tlHandle queueInputReceive(tlTask* task, tlArgs* args, bool safe) {
-    tlMsgQueue* queue = tlMsgQueueInputAs(tlArgsTarget(args))->queue;
+    tlMsgQueueInput* input = tlMsgQueueInputAs(tlArgsTarget(args));
+    tlMsgQueue* queue = input->queue;
+    if (input->oneway) {
+        tlMessage* msg = tlMessageNew(null, args);
+        trace("queue.send oneway: %s %s", tl_str(queue), tl_str(msg));
+        lqueue_put(&queue->msg_q, &msg->entry);
+        queueSignal(queue);
+        return tlNull;
+    }
+
     tlMessage* msg = tlMessageNew(task, args);
     trace("queue.send: %s %s", tl_str(queue), tl_str(msg));
     task->value = msg;
 
-    tlTaskWaitNothing1(task);
-    lqueue_put(&queue->msg_q, &task->entry);
+    tlVm* vm = tlTaskWaitNothing1(task);
+    lqueue_put(&queue->msg_q, &msg->entry);
     queueSignal(queue);
-    tlTaskWaitNothing2(task);
+    tlTaskWaitNothing2(vm);
     return null;
 }
 
-static tlHandle _msg_queue_get(tlTask* task, tlArgs* args) {
-    tlMsgQueue* queue = tlMsgQueueAs(tlArgsTarget(args));
-    trace("queue.get: %s", tl_str(tlTaskCurrent()));
-
-    tlTask* sender = tlTaskFromEntry(lqueue_get(&queue->msg_q));
-    trace("SENDER: %s", tl_str(sender));
-    if (sender) return sender->value;
+static tlHandle msgQueueGet(tlTask* task, tlMsgQueue* queue, bool all) {
+    trace("queue.get: %s", tl_str(task));
+    tlHandle v = msgQueueTake(queue, all);
+    if (v) return v;
 
-    tlTaskWaitNothing1(task);
+    task->value = all? tlTrue : tlNull;
+    tlVm* vm = tlTaskWaitNothing1(task);
     lqueue_put(&queue->wait_q, &task->entry);
-    tlTaskWaitNothing2(task);
+    msgQueueDeliver(queue);
+    tlTaskWaitNothing2(vm);
     return null;
 }
 
+//. get: receive a message, waits until one is sent
+static tlHandle _msg_queue_get(tlTask* task, tlArgs* args) {
+    return msgQueueGet(task, tlMsgQueueAs(tlArgsTarget(args)), false);
+}
+
+//. getAll: receive all queued messages as a list, waits until at least one is sent
+static tlHandle _msg_queue_getAll(tlTask* task, tlArgs* args) {
+    return msgQueueGet(task, tlMsgQueueAs(tlArgsTarget(args)), true);
+}
+
+//. poll: receive a message, or null if none was sent
 static tlHandle _msg_queue_poll(tlTask* task, tlArgs* args) {
-    tlMsgQueue* queue = tlMsgQueueAs(tlArgsTarget(args));
-    trace("queue.get: %s", tl_str(tlTaskCurrent()));
+    tlHandle msg = msgQueueTake(tlMsgQueueAs(tlArgsTarget(args)), false);
+    return msg? msg : tlNull;
+}
 
-    tlTask* sender = tlTaskFromEntry(lqueue_get(&queue->msg_q));
-    trace("SENDER: %s", tl_str(sender));
-    if (sender) return sender->value;
-    return tlNull;
+//. pollAll: receive all queued messages as a list, which is empty if none were sent
+static tlHandle _msg_queue_pollAll(tlTask* task, tlArgs* args) {
+    tlHandle msgs = msgQueueTake(tlMsgQueueAs(tlArgsTarget(args)), true);
+    return msgs? msgs : tlListEmpty();
 }
 
+//. input: an object that sends every message it receives to the queue, the sender waits for a reply
 static tlHandle _msg_queue_input(tlTask* task, tlArgs* args) {
     tlMsgQueue* queue = tlMsgQueueAs(tlArgsTarget(args));
     return queue->input;
 }
+//. oneway: like #input, but the sender does not wait, replies are ignored
+static tlHandle _msg_queue_oneway(tlTask* task, tlArgs* args) {
+    tlMsgQueue* queue = tlMsgQueueAs(tlArgsTarget(args));
+    return queue->oneway;
+}
 static tlHandle _MsgQueue_new(tlTask* task, tlArgs* args) {
     return tlMsgQueueNew();
 }
@@ -254,7 +462,9 @@ void queue_init() {
     queueClass = tlClassObjectFrom("new", _Queue_new, null);
     _tlQueueKind.klass = tlClassObjectFrom(
         "add", _queue_add,
+        "addAll", _queue_addAll,
         "get", _queue_get,
+        "getMany", _queue_getMany,
         "poll", _queue_poll,
         null
     );
@@ -263,8 +473,11 @@ void queue_init() {
     _tlMsgQueueInputKind.send = queueInputReceive;
     _tlMsgQueueKind.klass = tlClassObjectFrom(
         "input", _msg_queue_input,
+        "oneway", _msg_queue_oneway,
         "get", _msg_queue_get,
+        "getAll", _msg_queue_getAll,
         "poll", _msg_queue_poll,
+        "pollAll", _msg_queue_pollAll,
         null
     );
     _tlMessageKind.klass = tlClassObjectFrom(
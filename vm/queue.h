@@ -1,6 +1,8 @@
 #ifndef _queue_h_
 #define _queue_h_
 
+#include "../llib/lring.h"
+
 #include "tl.h"
 #include "platform.h"
 
@@ -12,26 +14,32 @@ typedef void(*tlMsgQueueSignalFn)(void);
 
 struct tlQueue {
     tlHead head;
-    // TODO make more efficient? And we can also swap stuff ...
-    pthread_mutex_t lock;
+    lring ring;           // the buffered values
+    a_val adders;         // tasks (about to be) waiting in add_q
+    a_val getters;        // tasks (about to be) waiting in get_q
+    pthread_mutex_t lock; // only taken to suspend or wake tasks
     lqueue add_q;
     lqueue get_q;
 };
 
 struct tlMsgQueue {
     tlHead head;
-    lqueue msg_q;
-    lqueue wait_q;
+    lqueue msg_q;                // messages
+    lqueue wait_q;               // tasks waiting for messages
     tlMsgQueueSignalFn signalcb;
+    a_val signaled;              // set when signalcb was called, cleared when receiving
     tlMsgQueueInput* input;
+    tlMsgQueueInput* oneway;
 };
 struct tlMsgQueueInput {
     tlHead head;
     tlMsgQueue* queue;
+    bool oneway;
 };
 struct tlMessage {
     tlHead head;
-    tlTask* sender;
+    lqentry entry;
+    tlTask* sender; // null for a oneway message, nobody waits for a reply
     tlArgs* args;
 };
 
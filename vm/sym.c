@@ -9,6 +9,7 @@
 
 #include "value.h"
 #include "string.h"
+#include "native.h"
 
 tlSym s_string;
 tlSym s_block;
@@ -138,6 +139,16 @@ void tl_register_natives(const tlNativeCbs* cbs) {
     }
 }
 
+// natives that never hold on to their args after returning, see tlNativeNoCapture
+void tl_register_nocapture_natives(const tlNativeCbs* cbs) {
+    for (int i = 0; cbs[i].name; i++) {
+        tlSym name = tlSYM(cbs[i].name);
+        tlNative* fn = tlNativeNew(cbs[i].cb, name);
+        tlflag_set(fn, kNativeNoCapture);
+        lhashmap_putif(globals, (void*)cbs[i].name, fn, LHASHMAP_IGNORE);
+    }
+}
+
 tlHandle tl_global(tlSym sym) {
     assert(tlSymIs_(sym));
     assert(globals);
@@ -9,6 +9,9 @@
 // Anything mutable needs to be owned by the task, before it can act upon it.
 //
 // If a task is waiting, it records what is is waiting on, this is used for deadlock detection.
+// Only a task that owns locks, or that other tasks wait for, can close a cycle; other tasks, most
+// of them, never walk the chain of tasks and locks. Walks take shortcuts left by earlier walks, see
+// checkDeadlock.
 
 #include "../llib/lqueue.h"
 
@@ -22,8 +25,6 @@
 #include "error.h"
 #include "bcode.h"
 
-#define START_TICKS 10000
-
 tlHandle tlresult_get(tlHandle v, int at);
 void print_backtrace(tlFrame*);
 
@@ -54,10 +55,6 @@ tlVm* tlTaskGetVm(tlTask* task) {
     return task->worker->vm;
 }
 
-void tlVmScheduleTask(tlVm* vm, tlTask* task) {
-    lqueue_put(&vm->run_q, &task->entry);
-}
-
 tlTask* tlTaskFromEntry(lqentry* entry) {
     if (!entry) return null;
     return (tlTask*)(((char *)entry) - ((intptr_t) &((tlTask*)0)->entry));
@@ -125,6 +122,7 @@ void tlTaskRun(tlTask* task) {
     assert(task->stack);
 
     task->state = TL_STATE_RUN;
+    task->worker->preempt = a_get(&task->worker->vm->preempt);
 
     while (task->stack) {
         if (tlTaskHasError(task)) {
@@ -171,7 +169,6 @@ tlTask* tlTaskNew(tlVm* vm, tlObject* locals) {
     task->id = a_inc(&vm->nexttaskid);
     task->worker = vm->waiter;
     task->locals = locals;
-    task->ticks = START_TICKS;
     trace("new %s", tl_str(task));
     return task;
 }
@@ -232,13 +229,38 @@ static tlTask* taskForLocked(tlHandle on) {
     fatal("not implemented yet: %s", tl_str(on));
     return null;
 }
-static bool checkDeadlock(tlTask* task, tlHandle on) {
+// A walk leaves a shortcut in the task that waits: the last waiting task it reached. As long as
+// vm->waitepoch is unchanged, no task on the chain up to there can have changed what it waits on; a
+// waiting task cannot release its locks, and only readying it ends its wait. So a long chain of tasks
+// blocking one by one is walked once, not again by every task joining it.
+typedef struct WaitTail {
+    tlTask* tail;
+    a_val epoch;
+} WaitTail;
+
+static bool checkDeadlock(tlTask* task, tlHandle on, a_val epoch, tlTask** tail) {
     tlTask* other = taskForLocked(on);
-    if (other == task) { trace("DEADLOCK: %s", tl_str(other)); return true; }
-    if (!other) return false;
-    if (other->state != TL_STATE_WAIT) return false;
-    if (other->waitFor == on) return false; // if a task waits on an object or such ...
-    return checkDeadlock(task, other->waitFor);
+    while (true) {
+        if (other == task) { trace("DEADLOCK: %s", tl_str(other)); return true; }
+        if (!other) return false;
+        if (other->state != TL_STATE_WAIT) return false;
+        if (other->waitFor == on) return false; // if a task waits on an object or such ...
+        *tail = other;
+        WaitTail* cached = A_PTR(a_get(A_VAR(other->waittail)));
+        if (cached && cached->epoch == epoch && cached->tail != other) {
+            other = cached->tail;
+            on = null;
+            continue;
+        }
+        on = other->waitFor;
+        other = taskForLocked(on);
+    }
+}
+// cheap test if checkDeadlock could find anything
+static bool canDeadlock(tlTask* task, tlHandle on) {
+    if (task->locks > 0) return true;
+    if (A_PTR(a_get(A_VAR(task->waiting)))) return true;
+    return on == task;
 }
 static tlArray* deadlocked(tlTask* task, tlHandle on) {
     tlArray* array = tlArrayNew();
@@ -261,20 +283,33 @@ tlArray* tlTaskWaitFor(tlTask* task, tlHandle on) {
     assert(task->value);
     trace("%s.value: %s", tl_str(task), tl_str(task->value));
     tlVm* vm = tlTaskGetVm(task);
+    a_set(A_VAR(task->waittail), 0);
     task->state = TL_STATE_WAIT;
     task->waitFor = on;
 
-    if (checkDeadlock(task, on)) {
+    // read the epoch before walking, a task readied meanwhile makes the shortcut stale
+    a_val epoch = a_get(&vm->waitepoch);
+    tlTask* tail = null;
+    if (canDeadlock(task, on) && checkDeadlock(task, on, epoch, &tail)) {
         task->state = TL_STATE_RUN;
+        a_inc(&vm->waitepoch);
         return deadlocked(task, on);
     }
+    if (tail) {
+        WaitTail* cached = malloc(sizeof(WaitTail));
+        cached->tail = tail;
+        cached->epoch = epoch;
+        a_set(A_VAR(task->waittail), A_VAL(cached));
+    }
 
     if (!tlWorkerIsBound(task->worker)) task->worker = vm->waiter;
     a_dec(&vm->runnable);
     return null;
 }
 
-void tlTaskWaitNothing1(tlTask* task) {
+// once the task is put in a queue, it can be readied and run on another worker, so step two
+// cannot look at the task anymore, it takes the vm that step one returns
+tlVm* tlTaskWaitNothing1(tlTask* task) {
     assert(tlTaskIs(task));
     assert(task->state == TL_STATE_RUN);
     trace("%s.value: %s", tl_str(task), tl_str(task->value));
@@ -282,9 +317,9 @@ void tlTaskWaitNothing1(tlTask* task) {
     task->state = TL_STATE_WAIT;
     task->waitFor = null;
     if (!tlWorkerIsBound(task->worker)) task->worker = vm->waiter;
+    return vm;
 }
-void tlTaskWaitNothing2(tlTask* task) {
-    tlVm* vm = tlTaskGetVm(task);
+void tlTaskWaitNothing2(tlVm* vm) {
     a_dec(&vm->runnable);
 }
 
@@ -294,14 +329,17 @@ void tlTaskReady(tlTask* task) {
     assert(task->state == TL_STATE_WAIT);
     assert(task->stack);
     tlVm* vm = tlTaskGetVm(task);
+    bool chained = task->waitFor != null;
     task->waitFor = null;
     a_inc(&vm->runnable);
     task->state = TL_STATE_READY;
+    // after the state, so a walk that reads the old epoch sees this task is no longer waiting
+    if (chained) a_inc(&vm->waitepoch);
     if (tlWorkerIsBound(task->worker)) {
         tlWorkerSignal(task->worker);
     } else {
         task->worker = null;
-        lqueue_put(&vm->run_q, &task->entry);
+        tlVmScheduleTask(vm, task);
     }
 }
 
@@ -329,7 +367,7 @@ void tlTaskStart(tlTask* task) {
     a_inc(&vm->runnable);
     task->worker = null;
     task->state = TL_STATE_READY;
-    lqueue_put(&vm->run_q, &task->entry);
+    tlVmScheduleTask(vm, task);
 }
 
 void tlTaskCopyValue(tlTask* task, tlTask* other) {
@@ -371,10 +409,12 @@ static tlHandle tlTaskDone(tlTask* task) {
     assert(!task->stack);
     assert(task->value);
     assert(task->state == TL_STATE_RUN);
+    task->frames = null; // no more frames to run, let the collector have the arena
     task->state = tlTaskHasError(task)? TL_STATE_ERROR : TL_STATE_DONE;
     tlVm* vm = tlTaskGetVm(task);
     a_dec(&vm->tasks);
-    a_dec(&vm->runnable);
+    // with many workers, the io task might be blocked waiting for events, while it should exit
+    if (a_dec(&vm->runnable) <= 1 && vm->lock && vm->signalcb) vm->signalcb();
     task->worker = vm->waiter;
     signalWaiters(task);
     signalVm(task);
@@ -455,11 +495,17 @@ tlHandle tlTaskClearError(tlTask* task, tlHandle value) {
     return null;
 }
 
+// true if the task has run for its quantum and should yield, see worker.c
+bool tlTaskPreempted(tlTask* task) {
+    tlWorker* worker = task->worker;
+    return a_get(&worker->vm->preempt) - worker->preempt >= 2;
+}
+
+// called at calls and backward jumps, returns false if the task must yield, or throw when over its limit
 bool tlTaskTick(tlTask* task) {
-    task->ticks -= 1;
-    if (task->ticks <= 0) {
-        task->ticks = START_TICKS;
-        trace("%p out of ticks, resetting", task);
+    if (tlTaskPreempted(task)) {
+        task->worker->preempt = a_get(&task->worker->vm->preempt);
+        trace("%p preempted", task);
         return false;
     }
     if (task->limit) {
@@ -548,6 +594,11 @@ static tlHandle _Task_yield(tlTask* task, tlArgs* args) {
     return null;
 }
 
+//. workers: the number of workers running tasks in parallel
+static tlHandle _Task_workers(tlTask* task, tlArgs* args) {
+    return tlINT(tlTaskGetVm(task)->nworkers);
+}
+
 // TODO really need use something different
 //. locals: return an object with the task local state
 static tlHandle _Task_locals(tlTask* task, tlArgs* args) {
@@ -667,6 +718,200 @@ static tlHandle _task_poll(tlTask* task, tlArgs* args) {
     return tlQueuePoll(other->yields, task);
 }
 
+// ** futures **
+//
+// A Future is a value that is not there yet, without a task computing it. Native code or any task
+// completes it once, with a value or an error, and many tasks can wait for it. Future.all and
+// Future.any combine futures without a task, the combined future listens to the others.
+//
+// Completing claims the future with a cas on state, then publishes the value, and then drains
+// the queues of waiting tasks and listeners. A waiting task or listener puts itself in a queue,
+// and then looks at state; so either it sees the future is done, or the completer sees it.
+
+enum { FUTURE_PENDING = 0, FUTURE_COMPLETING, FUTURE_DONE };
+enum { FUTURE_PLAIN = 0, FUTURE_ALL, FUTURE_ANY };
+
+static tlKind _tlFutureKind = { .name = "Future" };
+tlKind* tlFutureKind;
+
+struct tlFuture {
+    tlHead head;
+    a_val state;
+    tlHandle value;
+    bool error;
+    lqueue wait_q;     // tasks waiting for the value
+    lqueue listen_q;   // combined futures waiting for the value
+    // for combined futures, see Future.all and Future.any
+    int combine;
+    int size;
+    a_val remaining;
+    tlHandle* values;
+};
+
+typedef struct FutureListener {
+    lqentry entry;
+    tlFuture* future;
+    int at;
+} FutureListener;
+
+tlFuture* tlFutureNew() {
+    return tlAlloc(tlFutureKind, sizeof(tlFuture));
+}
+
+bool tlFutureIsDone(tlFuture* future) {
+    return a_get(&future->state) == FUTURE_DONE;
+}
+
+static void futureCombine(tlFuture* future, int at, tlHandle value, bool error);
+
+static void futureNotify(tlFuture* future) {
+    assert(tlFutureIsDone(future));
+    while (true) {
+        tlTask* task = tlTaskFromEntry(lqueue_get(&future->wait_q));
+        if (!task) break;
+        task->value = future->value;
+        task->hasError = future->error;
+        tlTaskReady(task);
+    }
+    while (true) {
+        FutureListener* listener = (FutureListener*)lqueue_get(&future->listen_q);
+        if (!listener) break;
+        futureCombine(listener->future, listener->at, future->value, future->error);
+    }
+}
+
+static bool futureComplete(tlFuture* future, tlHandle value, bool error) {
+    assert(value);
+    if (a_swap_if(&future->state, FUTURE_COMPLETING, FUTURE_PENDING) != FUTURE_PENDING) return false;
+    trace("%s complete: %s%s", tl_str(future), tl_str(value), error? " (error)":"");
+    future->value = value;
+    future->error = error;
+    a_set(&future->state, FUTURE_DONE);
+    __sync_synchronize();
+    futureNotify(future);
+    return true;
+}
+
+bool tlFutureResolve(tlFuture* future, tlHandle value) {
+    return futureComplete(future, value, false);
+}
+
+bool tlFutureReject(tlFuture* future, tlHandle error) {
+    return futureComplete(future, error, true);
+}
+
+tlHandle tlFutureWait(tlFuture* future, tlTask* task) {
+    if (tlFutureIsDone(future)) {
+        if (future->error) return tlTaskError(task, future->value);
+        return future->value;
+    }
+
+    tlVm* vm = tlTaskWaitNothing1(task);
+    lqueue_put(&future->wait_q, &task->entry);
+    __sync_synchronize();
+    if (tlFutureIsDone(future)) futureNotify(future);
+    tlTaskWaitNothing2(vm);
+    return null;
+}
+
+static void futureListen(tlFuture* future, tlFuture* combined, int at) {
+    FutureListener* listener = malloc(sizeof(FutureListener));
+    listener->future = combined;
+    listener->at = at;
+    lqueue_put(&future->listen_q, &listener->entry);
+    __sync_synchronize();
+    if (tlFutureIsDone(future)) futureNotify(future);
+}
+
+// all completes with a list of all values, or the first error; any completes with the first value,
+// or when all failed, the last error
+static void futureCombine(tlFuture* future, int at, tlHandle value, bool error) {
+    if (future->combine == FUTURE_ALL) {
+        if (error) { futureComplete(future, value, true); return; }
+        future->values[at] = value;
+        if (a_dec(&future->remaining) > 0) return;
+        tlList* values = tlListNew(future->size);
+        for (int i = 0; i < future->size; i++) tlListSet_(values, i, future->values[i]);
+        futureComplete(future, values, false);
+        return;
+    }
+    assert(future->combine == FUTURE_ANY);
+    if (!error) { futureComplete(future, value, false); return; }
+    if (a_dec(&future->remaining) > 0) return;
+    futureComplete(future, value, true);
+}
+
+static tlFuture* futureCombined(tlList* list, int combine) {
+    int size = tlListSize(list);
+    tlFuture* future = tlFutureNew();
+    future->combine = combine;
+    future->size = size;
+    future->remaining = size;
+    if (combine == FUTURE_ALL) future->values = malloc(sizeof(tlHandle) * (size + 1));
+    if (combine == FUTURE_ALL && size == 0) futureComplete(future, tlListEmpty(), false);
+
+    // values that are not futures are taken as they are
+    for (int i = 0; i < size; i++) {
+        tlHandle v = tlListGet(list, i);
+        tlFuture* from = tlFutureCast(v);
+        if (from) {
+            futureListen(from, future, i);
+        } else {
+            futureCombine(future, i, v, false);
+        }
+    }
+    return future;
+}
+
+//. object Future: a value that is not there yet, #set or #throw completes it, once
+//. unlike a #Task, it does not run any code itself
+
+//. new: create a future without value
+static tlHandle _Future_new(tlTask* task, tlArgs* args) {
+    return tlFutureNew();
+}
+
+//. all(futures): a future that completes with a list of values when all futures have a value, or
+//. with the first error
+static tlHandle _Future_all(tlTask* task, tlArgs* args) {
+    tlList* list = tlListCast(tlArgsGet(args, 0));
+    if (!list) TL_THROW("expected a List of futures");
+    return futureCombined(list, FUTURE_ALL);
+}
+
+//. any(futures): a future that completes with the first value of any future, or with an error
+//. when all of them fail
+static tlHandle _Future_any(tlTask* task, tlArgs* args) {
+    tlList* list = tlListCast(tlArgsGet(args, 0));
+    if (!list) TL_THROW("expected a List of futures");
+    if (tlListSize(list) == 0) TL_THROW("expected at least one future");
+    return futureCombined(list, FUTURE_ANY);
+}
+
+//. set(value): complete the future with value, returns false if it was already complete
+static tlHandle _future_set(tlTask* task, tlArgs* args) {
+    TL_TARGET(tlFuture, future);
+    return tlBOOL(tlFutureResolve(future, tlOR_NULL(tlArgsGet(args, 0))));
+}
+
+//. throw(error): complete the future with an error, returns false if it was already complete
+static tlHandle _future_throw(tlTask* task, tlArgs* args) {
+    TL_TARGET(tlFuture, future);
+    return tlBOOL(tlFutureReject(future, tlOR_NULL(tlArgsGet(args, 0))));
+}
+
+//. wait: wait for the future to complete, will return its value or throw its error
+static tlHandle _future_wait(tlTask* task, tlArgs* args) {
+    TL_TARGET(tlFuture, future);
+    return tlFutureWait(future, task);
+}
+
+//. isDone: true if the future has completed
+static tlHandle _future_isDone(tlTask* task, tlArgs* args) {
+    TL_TARGET(tlFuture, future);
+    return tlBOOL(tlFutureIsDone(future));
+}
+
 //. background:
 //. returns true if task is a background task, that is, not hold off the vm from exiting
 //. set by calling with a boolean, `Task.current.background(true)`
@@ -767,6 +1012,7 @@ static const tlNativeCbs __task_natives[] = {
 };
 
 static tlObject* taskClass;
+static tlObject* futureClass;
 
 void task_init() {
     tl_register_natives(__task_natives);
@@ -793,18 +1039,36 @@ void task_init() {
         "setLocals", _Task_setLocals,
         "stacktrace", _Task_stacktrace,
         "yield", _Task_yield,
+        "workers", _Task_workers,
         "holdsLock", _Task_holdsLock,
         "bindToThread", _Task_bindToThread,
         "add", _Task_add,
         null
     );
 
+    _tlFutureKind.klass = tlClassObjectFrom(
+        "set", _future_set,
+        "throw", _future_throw,
+        "wait", _future_wait,
+        "value", _future_wait,
+        "isDone", _future_isDone,
+        null
+    );
+    futureClass = tlClassObjectFrom(
+        "new", _Future_new,
+        "all", _Future_all,
+        "any", _Future_any,
+        null
+    );
+
     INIT_KIND(tlTaskKind);
     INIT_KIND(tlWaitQueueKind);
+    INIT_KIND(tlFutureKind);
 }
 
 void task_vm_default(tlVm* vm) {
    tlVmGlobalSet(vm, tlSYM("Task"), taskClass);
+   tlVmGlobalSet(vm, tlSYM("Future"), futureClass);
 }
 
 void tlDumpTaskTrace() {
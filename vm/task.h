@@ -12,21 +12,31 @@ typedef enum {
     TL_STATE_ERROR,     // task is done, value is actually an throw
 } tlTaskState;
 
+typedef struct tlFrameChunk tlFrameChunk;
+
+// small args that can be reused, see tlNativeNoCapture
+#define TL_TASK_SPARE_ARGS 6
+
 // TODO slim this one down ...
 // TODO do we want tasks to know their "parent" for exceptions and such?
 struct tlTask {
     tlHead head;
     tlWorker* worker;  // current worker that is working on this task
     lqentry entry;     // how it gets linked into a queues
+    a_val running;     // set while a worker runs this task, see runTask in worker.c
     tlHandle waiting;   // a single tlTask* or a tlQueue* with many waiting tasks
     tlHandle waitFor;   // what this task is blocked on
+    a_val waittail;     // where the last walk for deadlocks from this task ended, see checkDeadlock
+    int locks;          // how many locks this task owns, see lock.c
 
     tlObject* locals;   // task local storage, for cwd, stdout etc ...
     tlHandle value;     // current value
     tlFrame* stack;     // current frame (== top of stack or current continuation)
+    tlFrameChunk* frames; // where frames of running code are allocated, see frame.c
 
     tlDebugger* debugger; // current debugger
     tlQueue* yields;      // for Task.add and Task.get
+    tlArgs* spareargs[TL_TASK_SPARE_ARGS]; // args handed back after calling a tlNativeNoCapture, by size
 
     // TODO remove these in favor a some flags
     tlTaskState state; // state it is currently in
@@ -34,8 +44,7 @@ struct tlTask {
     bool read; // check if the task.value has been seen, if not, we log a message
     bool background; // if running will it hold off exit? like unix daemon processes
     void* data;
-    long ticks; // tasks will suspend/resume every now and then
-    long limit; // tasks can have a tick limit
+    long limit; // tasks can have a limit on the amount of calls they make
     long id; // task id
 };
 
@@ -48,6 +57,7 @@ void tlTaskEval(tlTask* task, tlHandle v);
 tlHandle tlTaskErrorTake(tlTask* task, char* str);
 
 bool tlTaskTick(tlTask* task);
+bool tlTaskPreempted(tlTask* task);
 
 tlHandle tlTaskClearError(tlTask* task, tlHandle value);
 tlHandle tlTaskError(tlTask* task, tlHandle error);
@@ -59,8 +69,8 @@ void tlTaskPopFrame(tlTask* task, tlFrame* frame);
 void tlTaskPushResume(tlTask* task, tlResumeCb resume, tlHandle value);
 tlHandle tlTaskUnwindFrame(tlTask* task, tlFrame* upto, tlHandle value);
 
-void tlTaskWaitNothing1(tlTask* task);
-void tlTaskWaitNothing2(tlTask* task);
+tlVm* tlTaskWaitNothing1(tlTask* task);
+void tlTaskWaitNothing2(tlVm* vm);
 
 void task_init();
 void task_vm_default(tlVm* vm);
@@ -3,12 +3,16 @@
 // the vm itself, this is the library starting point
 
 #include "../llib/lqueue.h"
+#include "../llib/ldeque.h"
+#include "../llib/lring.h"
 #include "../llib/lhashmap.h"
 
 #include "platform.h"
 #include "vm.h"
 
 #include "../llib/lqueue.c"
+#include "../llib/ldeque.c"
+#include "../llib/lring.c"
 #include "../llib/lhashmap.c"
 
 #include "../boot/init.tlb.h"
@@ -787,6 +791,7 @@ void tl_init() {
     array_init();
     hashmap_init();
     controlflow_init();
+    lock_init();
     mutable_init();
     vm_init();
     debugger_init();
@@ -807,6 +812,8 @@ void hotelparser_init();
 void jsonparser_init();
 void xmlparser_init();
 
+#define DEFAULT_QUANTUM 10000
+
 tlVm* tlVmNew(tlSym procname, tlArgs* args) {
     srandom(time(0));
     tlVm* vm = tlAlloc(tlVmKind, sizeof(tlVm));
@@ -830,6 +837,16 @@ tlVm* tlVmNew(tlSym procname, tlArgs* args) {
 
     vm->locals = tlObjectFrom("cwd", tl_cwd, null);
     vm->exitcode = -1;
+
+    // in microseconds, 0 turns preemption off, tasks then run until they wait or yield
+    vm->quantum = DEFAULT_QUANTUM;
+    const char* quantum = getenv("TL_QUANTUM");
+    if (quantum && quantum[0]) vm->quantum = atoi(quantum);
+
+    vm->nworkers = sysconf(_SC_NPROCESSORS_ONLN);
+    const char* workers = getenv("TL_WORKERS");
+    if (workers && workers[0]) vm->nworkers = atoi(workers);
+    if (vm->nworkers < 1) vm->nworkers = 1;
     return vm;
 }
 
@@ -926,6 +943,27 @@ static const tlNativeCbs __vm_natives[] = {
     { "bool", _bool },
     { "type", _type },
 
+    { "random", _random },
+
+    { "_bless", _bless },
+
+    { "_int_parse", _int_parse },
+    { "_urlencode", _urlencode },
+    { "_urldecode", _urldecode },
+    { "_base64encode", _base64encode },
+    { "_base64decode", _base64decode },
+
+    { "_Buffer_new", _Buffer_new },
+    { "_vm_get_compiler", _vm_get_compiler },
+
+    { "_set_exitcode", _set_exitcode },
+    { "dlopen", _dlopen },
+
+    { 0, 0 },
+};
+
+// operators and math functions only read their arguments, so their args can be reused after the call
+static const tlNativeCbs __vm_nocapture_natives[] = {
     { "eq",   _eq },
     { "neq",  _neq },
     { "not",  _not },
@@ -954,8 +992,6 @@ static const tlNativeCbs __vm_natives[] = {
     { "mod",  _mod },
     { "pow", _pow },
 
-    { "random", _random },
-
     { "sqrt", _sqrt },
     { "sin", _sin },
     { "cos", _cos },
@@ -968,20 +1004,6 @@ static const tlNativeCbs __vm_natives[] = {
     { "cosh", _cosh },
     { "tanh", _tanh },
 
-    { "_bless", _bless },
-
-    { "_int_parse", _int_parse },
-    { "_urlencode", _urlencode },
-    { "_urldecode", _urldecode },
-    { "_base64encode", _base64encode },
-    { "_base64decode", _base64decode },
-
-    { "_Buffer_new", _Buffer_new },
-    { "_vm_get_compiler", _vm_get_compiler },
-
-    { "_set_exitcode", _set_exitcode },
-    { "dlopen", _dlopen },
-
     { 0, 0 },
 };
 
@@ -994,8 +1016,26 @@ static tlKind _tlWorkerKind = {
 tlKind* tlVmKind;
 tlKind* tlWorkerKind;
 
+static void set_native_op(const char* name, tlNativeOp op) {
+    tlNative* fn = tlNativeAs(tl_global(tlSYM(name)));
+    fn->op = op;
+}
+
 void vm_init() {
     tl_register_natives(__vm_natives);
+    tl_register_nocapture_natives(__vm_nocapture_natives);
+    set_native_op("add", TL_NATIVE_OP_ADD);
+    set_native_op("sub", TL_NATIVE_OP_SUB);
+    set_native_op("mul", TL_NATIVE_OP_MUL);
+    set_native_op("eq", TL_NATIVE_OP_EQ);
+    set_native_op("neq", TL_NATIVE_OP_NEQ);
+    set_native_op("lt", TL_NATIVE_OP_LT);
+    set_native_op("lte", TL_NATIVE_OP_LTE);
+    set_native_op("gt", TL_NATIVE_OP_GT);
+    set_native_op("gte", TL_NATIVE_OP_GTE);
+    set_native_op("band", TL_NATIVE_OP_BAND);
+    set_native_op("bor", TL_NATIVE_OP_BOR);
+    set_native_op("bxor", TL_NATIVE_OP_BXOR);
     tlObject* system = tlObjectFrom(
             "prefix", tlSTR(TL_PREFIX),
             "version", tlSTR(TL_VERSION),
@@ -1014,11 +1054,13 @@ void vm_init() {
 }
 
 void tlVmRun(tlVm* vm, tlTask* task) {
-    tlWorker* worker = tlWorkerNew(vm);
     vm->main = task;
     vm->running = true;
 
-    tlWorkerRun(worker);
+    tlVmStartTimer(vm);
+    tlWorkerRun(tlVmStartWorkers(vm));
+    tlVmStopWorkers(vm);
+    tlVmStopTimer(vm);
 }
 
 // TODO tl_str is for debugging, and this should all be done in language
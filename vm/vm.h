@@ -24,6 +24,7 @@ struct tlVm {
     a_val tasks;
     a_val runnable;
     a_val waitevent; // external events ...
+    a_val waitepoch; // bumped when a task waiting on a lock or task is readied, see checkDeadlock
 
     tlSym* procname; // process name aka argv[0]
     tlArgs* args; // startup arguments
@@ -33,12 +34,27 @@ struct tlVm {
     // to wake up select
     tlVmSignalFn signalcb;
 
+    // the worker pool, TL_WORKERS or one per core, see worker.c
+    int nworkers;
+    tlWorker** workers;
+    pthread_t* threads;
+    a_val parked; // workers waiting for tasks
+    a_val busy;   // workers looking for or running a task
+
     // for when we run multithreaded
     pthread_mutex_t* lock;
     pthread_cond_t* signal;
+
+    // preemption, a timer bumps preempt every quantum microseconds, see tlTaskTick and worker.c
+    a_val preempt;
+    int quantum;
+    struct tlVmTimer* timer;
 };
 
 void tlVmStop(tlVm* vm);
+void tlVmScheduleTask(tlVm* vm, tlTask* task);
+void tlVmStartTimer(tlVm* vm);
+void tlVmStopTimer(tlVm* vm);
 
 void vm_init();
 
@@ -8,8 +8,16 @@
 //
 // We can also create a thread dedicated to running a single task, this task will never appear in
 // the vm->run_q, instead whenever it can run, we will signal the thread.
+//
+// The other workers form a pool, one per core unless TL_WORKERS says otherwise. Each has a deque of
+// tasks that are ready to run. A task readied on a worker goes on the bottom of its deque. Workers
+// take from the top of their own deque, so tasks run in the order they became ready, and a task
+// that yields goes behind the others. An idle worker takes tasks readied outside of the pool from
+// vm->run_q, and otherwise steals from the top of another worker's deque. A worker that finds
+// nothing parks on its futex, until a worker readying a task wakes it up.
 
 #include "../llib/lqueue.h"
+#include "../llib/ldeque.h"
 
 #include "platform.h"
 #include "worker.h"
@@ -18,34 +26,147 @@
 #include "vm.h"
 #include "task.h"
 
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
 tlTask* tlTaskFromEntry(lqentry* entry);
 void tlTaskRun(tlTask* task);
 void tlWorkerBind(tlWorker* worker, tlTask* task);
 void tlWorkerUnbind(tlWorker* worker, tlTask* task);
 bool tlVmIsRunning(tlVm* vm);
-void tlVmWaitSignal(tlVm* vm);
+static void wakeAll(tlVm* vm);
+
+// the pool worker running on this thread, if any
+static __thread tlWorker* g_worker;
 
 bool tlVmIsRunning(tlVm* vm) {
-    return vm->running;
+    return __atomic_load_n(&vm->running, __ATOMIC_ACQUIRE);
 }
 void tlVmStop(tlVm* vm) {
     trace("!! VM STOPPING !!");
-    // TODO needs to be a_var oid
-    vm->running = false;
-    if (!vm->lock) return;
-    pthread_cond_broadcast(vm->signal);
+    __atomic_store_n(&vm->running, false, __ATOMIC_RELEASE);
+    wakeAll(vm);
 }
 
-// harmless when we are not (yet) running threaded
-void tlVmSignal(tlVm* vm) {
-    if (!vm->lock) return;
-    pthread_cond_signal(vm->signal);
+#ifdef __linux__
+static void futexWait(int* futex, int value) {
+    syscall(SYS_futex, futex, FUTEX_WAIT_PRIVATE, value, null, null, 0);
 }
-void tlVmWaitSignal(tlVm* vm) {
-    assert(vm->lock);
-    pthread_mutex_lock(vm->lock);
-    pthread_cond_wait(vm->signal, vm->lock);
-    pthread_mutex_unlock(vm->lock);
+static void futexWake(int* futex) {
+    syscall(SYS_futex, futex, FUTEX_WAKE_PRIVATE, 1, null, null, 0);
+}
+#else
+// no futexes, so parked workers poll
+static void futexWait(int* futex, int value) {
+    if (__atomic_load_n(futex, __ATOMIC_ACQUIRE) == value) usleep(1000);
+}
+static void futexWake(int* futex) { }
+#endif
+
+static bool unpark(tlWorker* worker) {
+    if (a_swap_if(&worker->parked, 0, 1) != 1) return false;
+    a_dec(&worker->vm->parked);
+    __atomic_store_n(&worker->futex, 1, __ATOMIC_RELEASE);
+    futexWake(&worker->futex);
+    return true;
+}
+
+static void wakeOne(tlVm* vm) {
+    __sync_synchronize(); // the task must be visible before we look for parked workers
+    if (!a_get(&vm->parked)) return;
+    for (int i = 0; i < vm->nworkers; i++) {
+        if (unpark(vm->workers[i])) return;
+    }
+}
+
+static void wakeAll(tlVm* vm) {
+    for (int i = 0; i < vm->nworkers; i++) unpark(vm->workers[i]);
+}
+
+static bool hasWork(tlVm* vm) {
+    if (lqueue_peek(&vm->run_q)) return true;
+    for (int i = 0; i < vm->nworkers; i++) {
+        if (ldeque_size(&vm->workers[i]->ready)) return true;
+    }
+    return false;
+}
+
+// the first worker returns to tlVmRun once no task is running or ready to run, all are waiting
+static bool done(tlVm* vm, tlWorker* worker) {
+    return worker->id == 0 && !a_get(&vm->busy) && !a_get(&vm->runnable);
+}
+
+// park until woken, unless work came in while parking
+static void park(tlWorker* worker) {
+    tlVm* vm = worker->vm;
+    __atomic_store_n(&worker->futex, 0, __ATOMIC_RELAXED);
+    a_set(&worker->parked, 1);
+    a_inc(&vm->parked);
+    if (!hasWork(vm) && tlVmIsRunning(vm) && !done(vm, worker)) {
+        trace("parking: %s", tl_str(worker));
+        futexWait(&worker->futex, 0);
+    }
+    if (a_swap_if(&worker->parked, 0, 1) == 1) a_dec(&vm->parked);
+}
+
+// tasks readied by a pool worker go on its deque, others go on vm->run_q
+void tlVmScheduleTask(tlVm* vm, tlTask* task) {
+    tlWorker* worker = g_worker;
+    if (worker && worker->vm == vm) {
+        ldeque_push(&worker->ready, task);
+    } else {
+        lqueue_put(&vm->run_q, &task->entry);
+    }
+    wakeOne(vm);
+}
+
+// every so often, look at vm->run_q first, otherwise tasks keep readying each other on the deque
+#define RUN_Q_EVERY 61
+// how many tasks an idle worker takes from vm->run_q at once
+#define RUN_Q_BATCH 16
+
+// run the first task taken, the others go on our deque, where idle workers can steal them
+static tlTask* takeRunQ(tlWorker* worker) {
+    lqentry* entry = lqueue_get_many(&worker->vm->run_q, worker->vm->nworkers > 1? RUN_Q_BATCH : 1);
+    if (!entry) return null;
+    tlTask* task = tlTaskFromEntry(entry);
+    for (entry = entry->next; entry;) {
+        lqentry* next = entry->next;
+        ldeque_push(&worker->ready, tlTaskFromEntry(entry));
+        entry = next;
+    }
+    return task;
+}
+
+static tlTask* nextTask(tlWorker* worker) {
+    tlVm* vm = worker->vm;
+    tlTask* task;
+    if (++worker->schedules % RUN_Q_EVERY == 0) {
+        task = tlTaskFromEntry(lqueue_get(&vm->run_q));
+        if (task) return task;
+    }
+    // take from the top, like a thief would, tasks keep running in the order they were readied
+    task = ldeque_steal(&worker->ready);
+    if (task) return task;
+    task = takeRunQ(worker);
+    if (task) return task;
+    for (int i = 1; i < vm->nworkers; i++) {
+        task = ldeque_steal(&vm->workers[(worker->id + i) % vm->nworkers]->ready);
+        if (task) return task;
+    }
+    return null;
+}
+
+static void runTask(tlWorker* worker, tlTask* task) {
+    // a task can be readied by another worker before the worker that ran it has returned from it
+    while (a_swap_if(&task->running, 1, 0) != 0) sched_yield();
+    tlWorkerBind(worker, task);
+    tlTaskRun(task);
+    tlWorkerUnbind(worker, task);
+    __sync_synchronize();
+    a_set(&task->running, 0);
 }
 
 void tlVmIncExternal(tlVm* vm) {
@@ -125,70 +246,118 @@ tlWorker* tlWorkerNewBind(tlVm* vm, tlTask* task) {
     return worker;
 }
 
-// this will keep on running tasks, waiting if necesairy, until the vm has stopped
-void tlWorkerRunBlocking(tlWorker* worker) {
+// Tasks are preempted by time instead of by counting calls. A timer thread bumps vm->preempt every
+// quantum, code checks it at calls and backward jumps, and a task that has seen it move on twice
+// since it started running yields. So a task runs for at least one quantum and at most two.
+struct tlVmTimer {
+    tlVm* vm;
+    bool stop;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t signal;
+};
+
+void* tltimer_thread(void* data) {
+    struct tlVmTimer* timer = data;
+    long quantum = timer->vm->quantum;
+    pthread_mutex_lock(&timer->lock);
+    while (!timer->stop) {
+        struct timespec until;
+        clock_gettime(CLOCK_REALTIME, &until);
+        long nsec = until.tv_nsec + quantum * 1000;
+        until.tv_sec += nsec / 1000000000;
+        until.tv_nsec = nsec % 1000000000;
+        pthread_cond_timedwait(&timer->signal, &timer->lock, &until);
+        a_inc(&timer->vm->preempt);
+    }
+    pthread_mutex_unlock(&timer->lock);
+    return null;
+}
+
+void tlVmStartTimer(tlVm* vm) {
+    if (vm->timer || vm->quantum <= 0) return;
+    struct tlVmTimer* timer = malloc(sizeof(struct tlVmTimer));
+    timer->vm = vm;
+    timer->stop = false;
+    if (pthread_mutex_init(&timer->lock, null)) fatal("pthread: %s", strerror(errno));
+    if (pthread_cond_init(&timer->signal, null)) fatal("pthread: %s", strerror(errno));
+    if (pthread_create(&timer->thread, null, &tltimer_thread, timer)) fatal("pthread: %s", strerror(errno));
+    vm->timer = timer;
+}
+
+void tlVmStopTimer(tlVm* vm) {
+    struct tlVmTimer* timer = vm->timer;
+    if (!timer) return;
+    pthread_mutex_lock(&timer->lock);
+    timer->stop = true;
+    pthread_cond_signal(&timer->signal);
+    pthread_mutex_unlock(&timer->lock);
+    pthread_join(timer->thread, null);
+    pthread_mutex_destroy(&timer->lock);
+    pthread_cond_destroy(&timer->signal);
+    vm->timer = null;
+}
+
+// this will run tasks, until no task can run anymore, or the vm has stopped
+void tlWorkerRun(tlWorker* worker) {
     assert(tlWorkerIs(worker));
     assert(tlVmIs(worker->vm));
     tlVm* vm = worker->vm;
+    g_worker = worker;
 
     while (tlVmIsRunning(vm)) {
-        tlTask* task = tlTaskFromEntry(lqueue_get(&vm->run_q));
-        if (!task) { tlVmWaitSignal(vm); continue; }
-        tlWorkerBind(worker, task);
-        tlTaskRun(task);
-        tlWorkerUnbind(worker, task);
+        a_inc(&vm->busy);
+        tlTask* task = nextTask(worker);
+        if (task) runTask(worker, task);
+        if (a_dec(&vm->busy) == 0 && !a_get(&vm->runnable)) wakeAll(vm);
+        if (task) continue;
+        if (done(vm, worker)) break;
+        park(worker);
     }
+    g_worker = null;
     trace("done: %s", tl_str(worker));
 }
 
 void* tlworker_thread(void* data) {
-    tlWorker* worker = tlWorkerAs(data);
-    tlWorkerRunBlocking(worker);
-    tlWorkerDelete(worker);
+    tlWorkerRun(tlWorkerAs(data));
     return null;
 }
 
-// TODO before starting threads, make sure the task is bound and ready ...
-void tlVmStartThreads(tlVm* vm, tlWorker* worker, tlTask* task) {
-    trace("start threads: %s", tl_str(task));
+// start the pool; the calling thread becomes the first worker, see tlVmRun
+tlWorker* tlVmStartWorkers(tlVm* vm) {
+    int n = vm->nworkers > 0? vm->nworkers : 1;
+    vm->nworkers = n;
+    vm->workers = malloc(sizeof(tlWorker*) * n);
+    for (int i = 0; i < n; i++) {
+        tlWorker* worker = tlWorkerNew(vm);
+        worker->id = i;
+        ldeque_init(&worker->ready);
+        vm->workers[i] = worker;
+    }
+    if (n == 1) return vm->workers[0];
 
+    // bound workers and the io loop know they run threaded by this
     assert(!vm->lock);
     vm->lock = malloc(sizeof(pthread_mutex_t));
     vm->signal = malloc(sizeof(pthread_cond_t));
     if (pthread_mutex_init(vm->lock, null)) fatal("pthread: %s", strerror(errno));
     if (pthread_cond_init(vm->signal, null)) fatal("pthread: %s", strerror(errno));
 
-    pthread_t thread;
-    tlWorker* nworker = tlWorkerNew(vm);
-    pthread_create(&thread, null, &tlworker_thread, nworker);
-
-    assert(!worker->lock);
-    worker->lock = malloc(sizeof(pthread_mutex_t));
-    worker->signal = malloc(sizeof(pthread_cond_t));
-    if (pthread_mutex_init(worker->lock, null)) fatal("pthread: %s", strerror(errno));
-    if (pthread_cond_init(worker->signal, null)) fatal("pthread: %s", strerror(errno));
-
-    // TODO this is too late to bind ...
-    worker->task = task;
-    pthread_mutex_lock(worker->lock);
-    tlWorkerRunBound(worker);
-    pthread_mutex_unlock(worker->lock);
+    vm->threads = malloc(sizeof(pthread_t) * n);
+    for (int i = 1; i < n; i++) {
+        if (pthread_create(&vm->threads[i], null, &tlworker_thread, vm->workers[i])) {
+            fatal("pthread: %s", strerror(errno));
+        }
+    }
+    return vm->workers[0];
 }
 
-// this will run tasks, until the task queue is empty, or the vm has stopped
-void tlWorkerRun(tlWorker* worker) {
-    assert(tlWorkerIs(worker));
-    assert(tlVmIs(worker->vm));
-    tlVm* vm = worker->vm;
-
-    while (tlVmIsRunning(vm)) {
-        tlTask* task = tlTaskFromEntry(lqueue_get(&vm->run_q));
-        if (!task) break;
-        tlWorkerBind(worker, task);
-        tlTaskRun(task);
-        tlWorkerUnbind(worker, task);
-    }
-    trace("done: %s", tl_str(worker));
+void tlVmStopWorkers(tlVm* vm) {
+    tlVmStop(vm);
+    if (!vm->threads) return;
+    if (vm->signalcb) vm->signalcb(); // a worker might be blocked in the io loop
+    for (int i = 1; i < vm->nworkers; i++) pthread_join(vm->threads[i], null);
+    vm->threads = null;
 }
 
 tlWorker* tlWorkerNew(tlVm* vm) {
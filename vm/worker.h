@@ -3,6 +3,7 @@
 
 #include "tl.h"
 #include "platform.h"
+#include "../llib/ldeque.h"
 
 struct tlWorker {
     tlHead head;
@@ -11,6 +12,15 @@ struct tlWorker {
     tlVm* vm;
     // the current task it is processing, null if none
     tlTask* task;
+    // vm->preempt when the current task started running, see tlTaskTick
+    a_val preempt;
+
+    // for pool workers, the tasks this worker readied, and how it waits for more, see worker.c
+    int id;
+    int schedules;
+    ldeque ready;
+    a_val parked;
+    int futex;
 
     // for bound tasks, when task is not running, thread will wait
     pthread_mutex_t* lock;
@@ -24,4 +34,7 @@ bool tlWorkerIsBound(tlWorker* worker);
 void tlWorkerBind(tlWorker* worker, tlTask* task);
 tlWorker* tlWorkerNewBind(tlVm* vm, tlTask* task);
 
+tlWorker* tlVmStartWorkers(tlVm* vm);
+void tlVmStopWorkers(tlVm* vm);
+
 #endif